@@ -129,6 +129,16 @@ public:
 #endif
     }
 
+    // The page currently on screen
+    uint16_t* frontBuffer() const
+	{
+#ifndef _WIN32
+        return reinterpret_cast<uint16_t*>((control & FrameSelect) ? (VideoMemAddress + 0xA000) : VideoMemAddress);
+#else
+		return reinterpret_cast<uint16_t*>(&g_RawMemory[(control & FrameSelect) ? (VideoMemAddress + 0xA000) : VideoMemAddress]);
+#endif
+    }
+
 	void vSync()
 	{
 #ifndef _WIN32
@@ -234,6 +244,12 @@ public:
 		return reinterpret_cast<Color*>(disp.backBuffer());
 	}
 
+	static Color* frontBuffer()
+	{
+		auto& disp = DisplayControl::Get();
+		return reinterpret_cast<Color*>(disp.frontBuffer());
+	}
+
 #ifdef _WIN32
 	inline static GLFWwindow* s_window;
 	uint32_t m_backBufferTexture;
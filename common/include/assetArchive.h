@@ -0,0 +1,159 @@
+#pragma once
+
+#include <cstdint>
+#include <string_view>
+#include <lz77.h>
+
+// Read only asset archive, built offline by the asset tools.
+// The archive is a single aligned blob: a header, an open addressing directory keyed by name hash, and the asset data.
+// On GBA it is linked into ROM with .incbin, on the host it is memory mapped, so assets are used in place without copies.
+// Entries can also be LZ77 compressed, in which case they are unpacked with the BIOS at load time.
+namespace assets
+{
+	constexpr uint32_t kArchiveMagic = 0x52414247; // "GBAR"
+	constexpr uint32_t kArchiveVersion = 2;
+	constexpr uint32_t kArchiveAlignment = 4; // Every entry starts at a word boundary
+
+	// FNV-1a. Names are only compared by hash, so tools reject archives with colliding names.
+	constexpr uint32_t hashName(std::string_view name)
+	{
+		uint32_t hash = 2166136261u;
+		for (char c : name)
+		{
+			hash ^= uint8_t(c);
+			hash *= 16777619u;
+		}
+		return hash;
+	}
+
+	struct ArchiveHeader
+	{
+		uint32_t magic;
+		uint32_t version;
+		uint32_t numEntries;
+		uint32_t directorySize; // Number of slots. Always a power of two, at least twice numEntries.
+	};
+
+	enum class Compression : uint32_t
+	{
+		None = 0,
+		LZ77 = lz77::kTypeTag
+	};
+
+	struct ArchiveEntry
+	{
+		uint32_t nameHash;
+		uint32_t offset; // From the start of the archive. Zero marks an empty slot.
+		uint32_t size; // Stored bytes
+		Compression compression;
+	};
+
+	class Archive
+	{
+	public:
+		Archive() = default;
+		explicit Archive(const void* data)
+			: m_header(reinterpret_cast<const ArchiveHeader*>(data))
+		{}
+
+		bool valid() const
+		{
+			return m_header && m_header->magic == kArchiveMagic && m_header->version == kArchiveVersion;
+		}
+
+		uint32_t numEntries() const { return m_header->numEntries; }
+
+		// Returns the directory entry with the given name hash, or null if there's no such entry.
+		const ArchiveEntry* entry(uint32_t nameHash) const
+		{
+			auto directory = reinterpret_cast<const ArchiveEntry*>(m_header + 1);
+			uint32_t mask = m_header->directorySize - 1;
+			for (uint32_t slot = nameHash & mask;; slot = (slot + 1) & mask)
+			{
+				const ArchiveEntry& candidate = directory[slot];
+				if (!candidate.offset)
+				{
+					return nullptr;
+				}
+				if (candidate.nameHash == nameHash)
+				{
+					return &candidate;
+				}
+			}
+		}
+
+		// Returns a pointer to the stored data of an entry, or null if there's no such entry.
+		// Compressed entries are returned as they are stored. Use load for those.
+		const void* find(uint32_t nameHash, uint32_t& size) const
+		{
+			const ArchiveEntry* found = entry(nameHash);
+			if (!found)
+			{
+				return nullptr;
+			}
+			size = found->size;
+			return reinterpret_cast<const uint8_t*>(m_header) + found->offset;
+		}
+
+		// Returns the data of an entry ready to use. Uncompressed entries are used in place.
+		// Compressed ones are unpacked to unpackBuffer, which is then moved past them, keeping word alignment.
+		// Pass a VRAM buffer with toVram set, since VRAM can't take byte writes.
+		const void* load(uint32_t nameHash, uint32_t& size, uint8_t*& unpackBuffer, bool toVram = false) const
+		{
+			const void* stored = find(nameHash, size);
+			if (!stored || entry(nameHash)->compression == Compression::None)
+			{
+				return stored;
+			}
+
+			void* dst = unpackBuffer;
+			size = lz77::decompressedSize(stored);
+			if (toVram)
+			{
+				LZ77UnCompVram(stored, dst);
+			}
+			else
+			{
+				LZ77UnCompWram(stored, dst);
+			}
+			unpackBuffer += (size + kArchiveAlignment - 1) & ~(kArchiveAlignment - 1);
+			return dst;
+		}
+
+		// Typed access. count receives the number of whole elements in the entry.
+		template<class T>
+		const T* get(std::string_view name, uint32_t& count) const
+		{
+			uint32_t size = 0;
+			auto data = reinterpret_cast<const T*>(find(hashName(name), size));
+			count = size / sizeof(T);
+			return data;
+		}
+
+		template<class T>
+		const T* get(std::string_view name) const
+		{
+			uint32_t count;
+			return get<T>(name, count);
+		}
+
+		template<class T>
+		const T* load(std::string_view name, uint32_t& count, uint8_t*& unpackBuffer) const
+		{
+			uint32_t size = 0;
+			auto data = reinterpret_cast<const T*>(load(hashName(name), size, unpackBuffer));
+			count = size / sizeof(T);
+			return data;
+		}
+
+		template<class T>
+		const T* load(std::string_view name, uint8_t*& unpackBuffer) const
+		{
+			uint32_t count;
+			return load<T>(name, count, unpackBuffer);
+		}
+
+	private:
+		const ArchiveHeader* m_header = nullptr;
+	};
+}
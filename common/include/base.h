@@ -20,6 +20,7 @@
 #define IWRAM_CODE
 #define EWRAM_CODE
 #define IWRAM_DATA
+#define EWRAM_DATA
 #endif
 
 FORCE_INLINE inline void dbgAssert(bool x)
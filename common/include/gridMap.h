@@ -0,0 +1,120 @@
+#pragma once
+
+#include <bit>
+#include <cstdint>
+
+#include <base.h>
+
+// Grid map for the raycaster, packed so that large maps fit in IWRAM. A 256x256 map takes about 15KB instead of 64KB.
+// Raycasting it costs more per cell than a byte map, so small maps like g_worldMap are better left unpacked.
+// Occupancy is one bit per cell, grouped in blocks of 8x8 cells. Each block is 8 bytes, one per row, with bit i set
+// when column i of that row is solid. A coarse level has one bit per block, set when the block has any solid cell.
+// Values of the solid cells live in a separate table, block by block, in row order within each block.
+// Maps must be closed by solid cells, like g_worldMap, since rays don't check bounds.
+struct GridMap
+{
+	static constexpr int32_t kBlockShift = 3;
+	static constexpr int32_t kBlockSize = 1 << kBlockShift;
+	static constexpr int32_t kBlockMask = kBlockSize - 1;
+
+	int32_t blockCols = 0;
+	int32_t blockRows = 0;
+	const uint8_t* cellBits{}; // kBlockSize bytes per block, blocks in row major order
+	const uint32_t* blockBits{}; // One bit per block
+	const uint32_t* firstValue{}; // Index in values of the first solid cell of each block
+	const uint8_t* values{};
+
+	FORCE_INLINE int32_t blockIndex(int32_t x, int32_t y) const
+	{
+		return (y >> kBlockShift) * blockCols + (x >> kBlockShift);
+	}
+
+	FORCE_INLINE bool blockEmpty(int32_t x, int32_t y) const
+	{
+		int32_t block = blockIndex(x, y);
+		return !((blockBits[block >> 5] >> (block & 31)) & 1);
+	}
+
+	FORCE_INLINE bool solid(int32_t x, int32_t y) const
+	{
+		return (cellBits[blockIndex(x, y) * kBlockSize + (y & kBlockMask)] >> (x & kBlockMask)) & 1;
+	}
+
+	// Only valid for solid cells
+	uint8_t value(int32_t x, int32_t y) const
+	{
+		int32_t block = blockIndex(x, y);
+		const uint8_t* rows = &cellBits[block * kBlockSize];
+		uint32_t index = firstValue[block];
+		for (int32_t row = 0; row < (y & kBlockMask); ++row)
+			index += std::popcount(rows[row]);
+		index += std::popcount(uint8_t(rows[y & kBlockMask] & ((1u << (x & kBlockMask)) - 1)));
+		return values[index];
+	}
+
+	static constexpr uint32_t numBlocks(int32_t cols, int32_t rows)
+	{
+		return uint32_t(cols >> kBlockShift) * uint32_t(rows >> kBlockShift);
+	}
+
+	// Array sizes, in elements, for a map of cols x rows cells. values holds one byte per solid cell.
+	static constexpr uint32_t cellBitsSize(int32_t cols, int32_t rows) { return numBlocks(cols, rows) * kBlockSize; }
+	static constexpr uint32_t blockBitsSize(int32_t cols, int32_t rows) { return (numBlocks(cols, rows) + 31) / 32; }
+	static constexpr uint32_t firstValueSize(int32_t cols, int32_t rows) { return numBlocks(cols, rows); }
+};
+
+// Packs a map with one byte per cell in row major order, zero being empty, into the given arrays.
+// Only counts the solid cells when values is null, which is the size values needs. Returns that count.
+// cols and rows must be multiples of GridMap::kBlockSize. Other sizes return 0 and leave dst empty.
+inline uint32_t packGridMap(const uint8_t* cells, int32_t cols, int32_t rows,
+	uint8_t* cellBits, uint32_t* blockBits, uint32_t* firstValue, uint8_t* values, GridMap& dst)
+{
+	dst = GridMap();
+	if ((cols | rows) & GridMap::kBlockMask)
+		return 0;
+
+	dst.blockCols = cols >> GridMap::kBlockShift;
+	dst.blockRows = rows >> GridMap::kBlockShift;
+	dst.cellBits = cellBits;
+	dst.blockBits = blockBits;
+	dst.firstValue = firstValue;
+	dst.values = values;
+
+	uint32_t numValues = 0;
+	for (int32_t by = 0; by < dst.blockRows; ++by)
+	{
+		for (int32_t bx = 0; bx < dst.blockCols; ++bx)
+		{
+			int32_t block = by * dst.blockCols + bx;
+			if (values)
+			{
+				firstValue[block] = numValues;
+				if ((block & 31) == 0)
+					blockBits[block >> 5] = 0;
+			}
+
+			bool anySolid = false;
+			for (int32_t row = 0; row < GridMap::kBlockSize; ++row)
+			{
+				const uint8_t* src = &cells[(by * GridMap::kBlockSize + row) * cols + bx * GridMap::kBlockSize];
+				uint8_t bits = 0;
+				for (int32_t col = 0; col < GridMap::kBlockSize; ++col)
+				{
+					if (src[col])
+					{
+						bits |= uint8_t(1 << col);
+						if (values)
+							values[numValues] = src[col];
+						++numValues;
+					}
+				}
+				if (values)
+					cellBits[block * GridMap::kBlockSize + row] = bits;
+				anySolid |= bits != 0;
+			}
+			if (values && anySolid)
+				blockBits[block >> 5] |= 1u << (block & 31);
+		}
+	}
+	return numValues;
+}
@@ -0,0 +1,58 @@
+#pragma once
+
+#include <linearMath.h>
+#include <pose.h>
+
+// Decides when a renderer can update only half of the screen columns in a frame.
+// Interlaced frames render either the even or the odd columns on top of the back buffer. With page flipping, that
+// still holds the frame before last, so nothing is copied and the kept half is two frames old. Each page alternates
+// its parity, and the motion limits apply to the pose that page was last drawn from.
+// That is hardly noticeable while the camera moves slowly, but smears on fast turns, so those get a full frame.
+// Renderers must flip pages once per beginFrame.
+class InterlaceController
+{
+public:
+	static constexpr int32_t kFullFrame = -1;
+
+	bool enabled = true;
+
+	// Limits on the motion between the two halves of an interlaced frame, see PoseDelta
+	math::intp16 maxMove = math::intp16(0.125f);
+	math::unorm16 maxTurn = math::unorm16::castFromShiftedInteger<16>(1 << 8); // About 3 columns at 160px and 66 deg
+
+	// Returns the parity of the columns to render this frame, or kFullFrame.
+	int32_t beginFrame(const Pose& view)
+	{
+		m_backPage ^= 1;
+		Page& page = m_pages[m_backPage];
+		bool slow = PoseDelta(page.pose, view).within(maxMove, maxTurn);
+		page.pose = view;
+
+		if (!enabled || !page.hasHistory || !slow)
+		{
+			page.hasHistory = true;
+			return kFullFrame;
+		}
+
+		page.parity ^= 1;
+		return page.parity;
+	}
+
+	// Forces full frames until both pages are redrawn. Call this when the pages no longer hold rendered frames.
+	void reset()
+	{
+		m_pages[0].hasHistory = false;
+		m_pages[1].hasHistory = false;
+	}
+
+private:
+	struct Page
+	{
+		Pose pose; // Of the last frame drawn to this page
+		int32_t parity = 0;
+		bool hasHistory = false;
+	};
+
+	Page m_pages[2];
+	int32_t m_backPage = 0;
+};
@@ -0,0 +1,62 @@
+#pragma once
+
+#include <cstdint>
+
+#ifdef GBA
+#include <base.h> // BIOS decompressors
+#endif
+
+// LZ77 data in the GBA BIOS format (type 0x10).
+// A word header holds the type and the decompressed size. It is followed by blocks of a flag byte and 8 tokens.
+// Flag bits, most significant first, tell literal bytes (0) from 2 byte back references (1).
+// A back reference copies 3 to 18 bytes from 1 to 4096 bytes behind the output.
+
+#ifndef GBA
+// Host versions of the BIOS decompressors
+inline void LZ77UnCompWram(const void* src, void* dst)
+{
+	auto in = reinterpret_cast<const uint8_t*>(src);
+	auto out = reinterpret_cast<uint8_t*>(dst);
+	uint32_t size = (in[1] | (in[2] << 8) | (in[3] << 16));
+	in += 4;
+
+	uint32_t pos = 0;
+	while (pos < size)
+	{
+		uint8_t flags = *in++;
+		for (int i = 0; i < 8 && pos < size; ++i, flags <<= 1)
+		{
+			if (flags & 0x80)
+			{
+				uint32_t length = (in[0] >> 4) + 3;
+				uint32_t distance = (((in[0] & 0xf) << 8) | in[1]) + 1;
+				in += 2;
+				for (uint32_t j = 0; j < length && pos < size; ++j, ++pos)
+				{
+					out[pos] = out[pos - distance];
+				}
+			}
+			else
+			{
+				out[pos++] = *in++;
+			}
+		}
+	}
+}
+
+// VRAM can only be written in halfwords. The BIOS handles that by buffering, so the results are the same.
+inline void LZ77UnCompVram(const void* src, void* dst)
+{
+	LZ77UnCompWram(src, dst);
+}
+#endif // !GBA
+
+namespace lz77
+{
+	constexpr uint8_t kTypeTag = 0x10;
+
+	inline uint32_t decompressedSize(const void* src)
+	{
+		return *reinterpret_cast<const uint32_t*>(src) >> 8;
+	}
+}
@@ -0,0 +1,15 @@
+#pragma once
+
+#include <cstdint>
+#include <Color.h>
+#include <vector.h>
+
+// Indexed triangle mesh with one flat color per face.
+struct Mesh
+{
+	const math::Vec3p8* vertices;
+	const uint16_t* indices;
+	const Color* faceColors;
+	uint16_t numTris;
+	uint16_t numVertices;
+};
@@ -0,0 +1,41 @@
+#pragma once
+
+#include <cstdint>
+#include <linearMath.h>
+
+// Palettized texture with a full mip chain, as emitted by pngToCpp --texture.
+// Texels are stored in column major order so that walls read them sequentially.
+// Same texel format as the textures wadToCpp emits: indices into a palette of 15 bit colors, with 0 transparent.
+struct MipTexture
+{
+	const uint8_t* texels; // All levels back to back
+	const uint16_t* palette; // Shared by all levels
+	const uint32_t* mipOffsets; // Start of each level, in texels
+	uint8_t log2Width;
+	uint8_t log2Height;
+	uint8_t numMips;
+
+	uint32_t height(uint32_t level) const { return 1 << (log2Height - level); }
+
+	// First texel of column u of the given level. u wraps around.
+	const uint8_t* column(uint32_t level, uint32_t u) const
+	{
+		uint32_t mask = (1 << (log2Width - level)) - 1;
+		return &texels[mipOffsets[level] + ((u & mask) << (log2Height - level))];
+	}
+
+	// Picks the finest level with no more than one texel per screen pixel.
+	// pixelsPerUnit is the screen size of a world unit, texelsPerUnit the texture density in world space.
+	uint32_t selectMip(math::intp16 pixelsPerUnit, uint32_t texelsPerUnit) const
+	{
+		uint32_t level = 0;
+		int32_t pixels = pixelsPerUnit.raw;
+		int32_t texels = int32_t(texelsPerUnit) << 16;
+		while (level + 1 < numMips && pixels < texels)
+		{
+			pixels <<= 1;
+			++level;
+		}
+		return level;
+	}
+};
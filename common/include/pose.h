@@ -26,6 +26,25 @@ struct Pose
 	}
 };
 
+// Camera motion between two frames. Renderers compare it against their limits to decide how much of the previous
+// frame they can reuse. Only motion on the ground plane counts, and turns are measured the short way around.
+struct PoseDelta
+{
+	math::intp16 move; // |dx| + |dy|, in world units
+	math::unorm16 turn; // In revolutions, at most half of one
+
+	PoseDelta(const Pose& from, const Pose& to)
+	{
+		move = math::abs(to.pos.x - from.pos.x) + math::abs(to.pos.y - from.pos.y);
+		turn = to.phi - from.phi;
+		if (turn > math::unorm16(0.5f))
+			turn = math::unorm16(0) - turn;
+	}
+
+	bool isZero() const { return move.raw == 0 && turn.raw == 0; }
+	bool within(math::intp16 maxMove, math::unorm16 maxTurn) const { return move <= maxMove && turn <= maxTurn; }
+};
+
 class FPSController
 {
 public:
@@ -52,12 +71,26 @@ public:
 
 	void update();
 
+	// Same as update(), but the planar motion goes through collision.move(pos, displacement),
+	// which can stop it or deflect it.
+	template<class Collision>
+	void update(const Collision& collision)
+	{
+		auto disp = readInput();
+		collision.move(m_pose.pos, disp);
+		m_pose.update();
+	}
+
 	Pose& m_pose;
 	math::intp8 jump = math::intp8(0); // Jump velocity
 
 	// Speed controls
 	math::intp16 horSpeed = math::intp16(0.06125f);
 	math::intp16 angSpeed = math::intp16(0.5f);
+
+private:
+	// Applies turns and vertical motion. Returns the planar displacement for the frame.
+	math::Vec2p16 readInput();
 };
 
 struct PoseFollower
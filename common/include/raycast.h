@@ -1,6 +1,20 @@
 #pragma once
 
+#include <gridMap.h>
 #include <linearMath.h>
 #include <vector.h>
 
-math::intp8 rayCast(math::Vec3p8 rayStart, math::Vec2p8 rayDir, int& hitVal, int& side, const uint8_t* map, int yStride);
\ No newline at end of file
+math::intp8 rayCast(math::Vec3p8 rayStart, math::Vec2p8 rayDir, int& hitVal, int& side, const uint8_t* map, int yStride);
+
+// Same walk and results as rayCast, with the reciprocals of the ray direction read from a table instead of divided.
+// The DDA loop is written so that ARM mode can predicate both steps instead of branching on them.
+// Ray direction components must be within [-2,2], which covers the rays of a 90 degree view through a unit direction.
+math::intp8 rayCastFast(math::Vec3p8 rayStart, math::Vec2p8 rayDir, int& hitVal, int& side, const uint8_t* map, int yStride);
+
+// rayCastFast that also returns the index in map of the cell it hit
+math::intp8 rayCastFastCell(math::Vec3p8 rayStart, math::Vec2p8 rayDir, int& hitVal, int& side, int& hitCell, const uint8_t* map, int yStride);
+
+// rayCastFast for packed maps. Returns the same results as rayCast on the unpacked map.
+// On the host it runs 1.5 to 2x slower than rayCastFast on a byte map, even though blocks without solid cells are crossed in a single step,
+// so it is only worth it for maps too large to keep unpacked.
+math::intp8 rayCastGrid(math::Vec3p8 rayStart, math::Vec2p8 rayDir, int& hitVal, int& side, const GridMap& map);
@@ -230,4 +230,59 @@ void rasterTriangleExp(uint16_t* dst, math::Vec2i scissor, uint16_t color, const
 		}
 		rowPtr = &rowPtr[scissor.x];
 	}
-}
\ No newline at end of file
+}
+
+// Solid color triangle limited to a per column clip window, for geometry placed in a scene that is already drawn.
+// Columns x in [clipBegin, clipEnd) are drawn from row clipTop[x-clipBegin] up to, but not including, clipBottom[x-clipBegin].
+// Edge functions are evaluated in 64 bits, so vertices far outside the screen don't overflow.
+void rasterTriangleClipped(uint16_t* dst, math::Vec2i scissor, uint16_t color, const math::Vec2p8 v[3],
+	const uint8_t* clipTop, const uint8_t* clipBottom, int32_t clipBegin, int32_t clipEnd)
+{
+	int32_t ex[3], ey[3];
+	for (int i = 0; i < 3; ++i)
+	{
+		const Vec2p8& next = v[i == 2 ? 0 : i + 1];
+		ex[i] = next.x.raw - v[i].x.raw;
+		ey[i] = next.y.raw - v[i].y.raw;
+	}
+
+	// Back face culling
+	if (int64_t(ex[0]) * ey[1] - int64_t(ey[0]) * ex[1] >= 0)
+		return;
+
+	// Pixel centers within the bounding box
+	int32_t xStart = max(max(0, clipBegin), (min3(v[0].x, v[1].x, v[2].x) - 0.5_p8).floor() + 1);
+	int32_t xEnd = min(min(scissor.x, clipEnd), (max3(v[0].x, v[1].x, v[2].x) - 0.5_p8).floor() + 1);
+	int32_t yStart = max(0, (min3(v[0].y, v[1].y, v[2].y) - 0.5_p8).floor() + 1);
+	int32_t yEnd = min(scissor.y, (max3(v[0].y, v[1].y, v[2].y) - 0.5_p8).floor() + 1);
+
+	for (int32_t x = xStart; x < xEnd; ++x)
+	{
+		int32_t y0 = max(yStart, int32_t(clipTop[x - clipBegin]));
+		int32_t y1 = min(yEnd, int32_t(clipBottom[x - clipBegin]));
+		if (y0 >= y1)
+			continue;
+
+		// Edge functions at the first pixel center of the column, in .8
+		int32_t px = (x << 8) + 128;
+		int32_t py = (y0 << 8) + 128;
+		int32_t w[3];
+		for (int i = 0; i < 3; ++i)
+		{
+			w[i] = int32_t((int64_t(px - v[i].x.raw) * ey[i] - int64_t(py - v[i].y.raw) * ex[i]) >> 8);
+		}
+
+		uint16_t* pixel = &dst[x + y0 * scissor.x];
+		for (int32_t y = y0; y < y1; ++y)
+		{
+			if ((w[0] > 0) && (w[1] > 0) && (w[2] > 0))
+			{
+				*pixel = color;
+			}
+			w[0] -= ex[0];
+			w[1] -= ex[1];
+			w[2] -= ex[2];
+			pixel += scissor.x;
+		}
+	}
+}
@@ -24,6 +24,15 @@ void FPSController::update()
 }
 
 void CharacterController::update()
+{
+	auto disp = readInput();
+	m_pose.pos.x += disp.x;
+	m_pose.pos.y += disp.y;
+
+	m_pose.update();
+}
+
+Vec2p16 CharacterController::readInput()
 {
 	Vec2p12 dir = {};
 	// left/right : strafe/rotate
@@ -42,8 +51,6 @@ void CharacterController::update()
 	disp.x = (dir.x * m_pose.cosf - dir.y * m_pose.sinf).cast<16>();
 	disp.y = (dir.y * m_pose.cosf + dir.x * m_pose.sinf).cast<16>();
 
-	m_pose.pos.x += disp.x;
-	m_pose.pos.y += disp.y;
 	m_pose.pos.z += horSpeed * (Keypad::Held(Keypad::A) - Keypad::Held(Keypad::B));
 
 
@@ -68,5 +75,5 @@ void CharacterController::update()
 		}
 	}*/
 
-	m_pose.update();
+	return disp;
 }
\ No newline at end of file
@@ -81,4 +81,159 @@ intp8 rayCast(Vec3p8 rayStart, Vec2p8 rayDir, int& hitVal, int& side, const uint
 	//Calculate distance projected on camera direction (Euclidean distance would give fisheye effect!)
 	intp8 hitDistance = (side == 0) ? (sideDistX - deltaDistX) : (sideDistY - deltaDistY);
 	return hitDistance;
-}
\ No newline at end of file
+}
+
+namespace
+{
+	// 1/x for every .8 value of x in (0,2], truncated like 1_p8 / x
+	constexpr int32_t kMaxRcpRaw = 2 << 8;
+
+	struct RcpTable
+	{
+		int32_t rcp[kMaxRcpRaw + 1];
+
+		constexpr RcpTable() : rcp{}
+		{
+			for (int32_t x = 1; x <= kMaxRcpRaw; ++x)
+				rcp[x] = (1 << 16) / x;
+		}
+	};
+
+	constexpr RcpTable kRcpTable;
+
+	// Distance along the ray to the first grid line, and the distance between grid lines, for one axis.
+	// Rays parallel to the axis never cross a line, like rayCast's far sentinel.
+	FORCE_INLINE inline void setupAxis(int32_t startRaw, int32_t dirRaw, int32_t& sideDist, int32_t& deltaDist)
+	{
+		int32_t negMask = dirRaw >> 31;
+		int32_t absDir = (dirRaw ^ negMask) - negMask;
+		dbgAssert(absDir <= kMaxRcpRaw);
+		deltaDist = kRcpTable.rcp[absDir];
+
+		// Fraction of the tile left in the direction of the ray
+		int32_t inTile = startRaw & 0xff;
+		int32_t toLine = (inTile & negMask) | ((256 - inTile) & ~negMask);
+		sideDist = dirRaw ? (toLine * deltaDist) >> 8 : (1 << 28);
+	}
+}
+
+intp8 rayCastFastCell(Vec3p8 rayStart, Vec2p8 rayDir, int& hitVal, int& side, int& hitCell, const uint8_t* map, int yStride)
+{
+	int32_t sideDistX, deltaDistX;
+	int32_t sideDistY, deltaDistY;
+	setupAxis(rayStart.x.raw, rayDir.x.raw, sideDistX, deltaDistX);
+	setupAxis(rayStart.y.raw, rayDir.y.raw, sideDistY, deltaDistY);
+
+	// Walk the map by cell index instead of by tile coordinates
+	int32_t stepX = (rayDir.x.raw >> 31) | 1;
+	int32_t stepY = ((rayDir.y.raw >> 31) | 1) * yStride;
+	int32_t cell = rayStart.x.floor() + yStride * rayStart.y.floor();
+
+	// Both branches are short enough to turn into conditional instructions, leaving the loop as the only branch
+	int32_t hitSide;
+	int32_t hit;
+	do
+	{
+		if (sideDistX < sideDistY)
+		{
+			sideDistX += deltaDistX;
+			cell += stepX;
+			hitSide = 0;
+		}
+		else
+		{
+			sideDistY += deltaDistY;
+			cell += stepY;
+			hitSide = 1;
+		}
+		hit = map[cell];
+	} while (!hit);
+
+	hitVal = hit;
+	side = hitSide;
+	hitCell = cell;
+	return intp8::castFromShiftedInteger<8>(hitSide ? sideDistY - deltaDistY : sideDistX - deltaDistX);
+}
+
+intp8 rayCastFast(Vec3p8 rayStart, Vec2p8 rayDir, int& hitVal, int& side, const uint8_t* map, int yStride)
+{
+	int hitCell;
+	return rayCastFastCell(rayStart, rayDir, hitVal, side, hitCell, map, yStride);
+}
+
+intp8 rayCastGrid(Vec3p8 rayStart, Vec2p8 rayDir, int& hitVal, int& side, const GridMap& map)
+{
+	int32_t sideDistX, deltaDistX;
+	int32_t sideDistY, deltaDistY;
+	setupAxis(rayStart.x.raw, rayDir.x.raw, sideDistX, deltaDistX);
+	setupAxis(rayStart.y.raw, rayDir.y.raw, sideDistY, deltaDistY);
+
+	int32_t stepX = (rayDir.x.raw >> 31) | 1;
+	int32_t stepY = (rayDir.y.raw >> 31) | 1;
+	int32_t x = rayStart.x.floor();
+	int32_t y = rayStart.y.floor();
+
+	// Cells of x and y where the ray enters a block, for the direction of the ray
+	int32_t entryX = (stepX > 0) ? 0 : GridMap::kBlockMask;
+	int32_t entryY = (stepY > 0) ? 0 : GridMap::kBlockMask;
+
+	int32_t hitSide;
+	while (true)
+	{
+		bool newBlock;
+		if (sideDistX < sideDistY)
+		{
+			sideDistX += deltaDistX;
+			x += stepX;
+			hitSide = 0;
+			newBlock = (x & GridMap::kBlockMask) == entryX;
+		}
+		else
+		{
+			sideDistY += deltaDistY;
+			y += stepY;
+			hitSide = 1;
+			newBlock = (y & GridMap::kBlockMask) == entryY;
+		}
+
+		// Jump to the cell where the ray leaves an empty block, taking the same steps the loop above would.
+		// Blocks are only checked on the way in, so cells of non empty blocks cost a single load.
+		while (newBlock && map.blockEmpty(x, y))
+		{
+			// Crossings left before the one that leaves the block, on each axis
+			int32_t crossingsX = entryX ^ GridMap::kBlockMask ^ (x & GridMap::kBlockMask);
+			int32_t crossingsY = entryY ^ GridMap::kBlockMask ^ (y & GridMap::kBlockMask);
+			int32_t exitX = sideDistX + crossingsX * deltaDistX;
+			int32_t exitY = sideDistY + crossingsY * deltaDistY;
+			if (exitX < exitY)
+			{
+				while (sideDistY <= exitX)
+				{
+					sideDistY += deltaDistY;
+					y += stepY;
+				}
+				sideDistX = exitX + deltaDistX;
+				x += (crossingsX + 1) * stepX;
+				hitSide = 0;
+			}
+			else
+			{
+				while (sideDistX < exitY)
+				{
+					sideDistX += deltaDistX;
+					x += stepX;
+				}
+				sideDistY = exitY + deltaDistY;
+				y += (crossingsY + 1) * stepY;
+				hitSide = 1;
+			}
+		}
+
+		if (map.solid(x, y))
+			break;
+	}
+
+	hitVal = map.value(x, y);
+	side = hitSide;
+	return intp8::castFromShiftedInteger<8>(hitSide ? sideDistY - deltaDistY : sideDistX - deltaDistX);
+}
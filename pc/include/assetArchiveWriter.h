@@ -0,0 +1,162 @@
+#pragma once
+
+#include <cstdint>
+#include <cstring>
+#include <fstream>
+#include <iostream>
+#include <string>
+#include <vector>
+
+#include <assetArchive.h>
+#include <lz77Compressor.h>
+
+namespace assets
+{
+    enum class Packing
+    {
+        Raw,
+        Auto, // LZ77 when it saves enough space, unpacked to work RAM
+        AutoVram // Same, for data unpacked straight to VRAM
+    };
+
+    // Collects named blobs and lays them out in the archive format read by assets::Archive
+    class ArchiveWriter
+    {
+    public:
+        // Compression stats and errors go to log
+        explicit ArchiveWriter(std::ostream& log = std::cout) : m_log(log) {}
+
+        // Returns false if the name is already in use, or collides with another name's hash
+        bool add(const std::string& name, const void* data, size_t byteCount, Packing packing = Packing::Raw)
+        {
+            uint32_t nameHash = hashName(name);
+            for (auto& blob : m_blobs)
+            {
+                if (blob.nameHash == nameHash)
+                {
+                    m_log << "Asset name " << name << " collides with " << blob.name << "\n";
+                    return false;
+                }
+            }
+            auto bytes = reinterpret_cast<const uint8_t*>(data);
+            Blob blob = { name, nameHash, Compression::None, byteCount, std::vector<uint8_t>(bytes, bytes + byteCount) };
+
+            // Unpacking costs load time and RAM, so only compress when it saves at least an eighth of the ROM space
+            if (packing != Packing::Raw && byteCount > 0)
+            {
+                lz77::CompressionStats stats;
+                auto packed = lz77::compress(data, byteCount, packing == Packing::AutoVram, &stats);
+                m_log << name << ": " << byteCount << " -> " << packed.size() << " bytes ("
+                    << (100 * packed.size() / byteCount) << "%), ~" << stats.decodeCycles() << " cycles to unpack";
+                if (packed.size() <= byteCount - byteCount / 8)
+                {
+                    blob.compression = Compression::LZ77;
+                    blob.data = std::move(packed);
+                    m_unpackedSize += align(byteCount);
+                }
+                else
+                {
+                    m_log << ", stored uncompressed";
+                }
+                m_log << "\n";
+            }
+
+            m_blobs.push_back(std::move(blob));
+            return true;
+        }
+
+        // Buffer space needed to unpack every compressed entry
+        size_t unpackedSize() const { return m_unpackedSize; }
+
+        struct EntrySize
+        {
+            std::string name;
+            size_t storedSize; // In the archive, aligned
+            size_t unpackedSize; // In the unpack buffer, or 0 if the entry is used in place
+        };
+
+        // In the order entries were added
+        std::vector<EntrySize> entrySizes() const
+        {
+            std::vector<EntrySize> sizes;
+            for (auto& blob : m_blobs)
+                sizes.push_back({ blob.name, align(blob.data.size()), blob.compression == Compression::None ? 0 : align(blob.rawSize) });
+            return sizes;
+        }
+
+        // Lays out the whole archive in memory
+        std::vector<uint8_t> build() const
+        {
+            uint32_t directorySize = 1;
+            while (directorySize < 2 * m_blobs.size())
+                directorySize *= 2;
+
+            std::vector<ArchiveEntry> directory(directorySize, ArchiveEntry{});
+            size_t offset = sizeof(ArchiveHeader) + directorySize * sizeof(ArchiveEntry);
+            std::vector<uint32_t> blobOffsets;
+            for (auto& blob : m_blobs)
+            {
+                offset = align(offset);
+                blobOffsets.push_back(uint32_t(offset));
+
+                // Linear probing, as in Archive::find
+                uint32_t slot = blob.nameHash & (directorySize - 1);
+                while (directory[slot].offset)
+                    slot = (slot + 1) & (directorySize - 1);
+                directory[slot] = { blob.nameHash, uint32_t(offset), uint32_t(blob.data.size()), blob.compression };
+
+                offset += blob.data.size();
+            }
+
+            std::vector<uint8_t> archive(align(offset), 0);
+            ArchiveHeader header = { kArchiveMagic, kArchiveVersion, uint32_t(m_blobs.size()), directorySize };
+            memcpy(archive.data(), &header, sizeof(header));
+            memcpy(&archive[sizeof(header)], directory.data(), directory.size() * sizeof(ArchiveEntry));
+            for (size_t i = 0; i < m_blobs.size(); ++i)
+            {
+                if (!m_blobs[i].data.empty())
+                    memcpy(&archive[blobOffsets[i]], m_blobs[i].data.data(), m_blobs[i].data.size());
+            }
+            return archive;
+        }
+
+        bool save(const std::string& fileName) const
+        {
+            auto archive = build();
+            std::ofstream file(fileName, std::ios_base::binary);
+            file.write(reinterpret_cast<const char*>(archive.data()), archive.size());
+            return file.good();
+        }
+
+        // Writes an assembly file that links the archive binary into ROM under the given symbol.
+        // The binary is found through the assembler's include paths.
+        static bool writeIncbin(const std::string& asmFileName, const std::string& binFileName, const std::string& symbol)
+        {
+            std::ofstream file(asmFileName);
+            file << "\t.section .rodata\n"
+                << "\t.align 2\n"
+                << "\t.global " << symbol << "\n"
+                << symbol << ":\n"
+                << "\t.incbin \"" << binFileName << "\"\n";
+            return file.good();
+        }
+
+    private:
+        static size_t align(size_t offset)
+        {
+            return (offset + kArchiveAlignment - 1) & ~size_t(kArchiveAlignment - 1);
+        }
+
+        struct Blob
+        {
+            std::string name;
+            uint32_t nameHash;
+            Compression compression;
+            size_t rawSize;
+            std::vector<uint8_t> data;
+        };
+        std::ostream& m_log;
+        std::vector<Blob> m_blobs;
+        size_t m_unpackedSize = 0;
+    };
+}
@@ -1,5 +1,6 @@
 #pragma once
 
+#include <algorithm>
 #include <cstdint>
 #include <memory>
 #include <unordered_map>
@@ -167,6 +168,41 @@ struct Image16bit
             }
         }
     }
+
+    // Half resolution copy using a 2x2 box filter.
+    // Texels with at least two transparent samples stay transparent, so color keys survive minification.
+    Image16bit downsample() const
+    {
+        Image16bit result;
+        result.resize(std::max(1, width / 2), std::max(1, height / 2));
+        for (int y = 0; y < result.height; ++y)
+        {
+            for (int x = 0; x < result.width; ++x)
+            {
+                int r = 0, g = 0, b = 0, n = 0;
+                for (int j = 0; j < 2; ++j)
+                {
+                    for (int i = 0; i < 2; ++i)
+                    {
+                        auto c = pixels[std::min(2 * x + i, width - 1) + width * std::min(2 * y + j, height - 1)].c;
+                        if (!(c & (1 << 15)))
+                            continue; // Transparent
+                        r += c & 0x1f;
+                        g += (c >> 5) & 0x1f;
+                        b += (c >> 10) & 0x1f;
+                        ++n;
+                    }
+                }
+                if (n < 3)
+                {
+                    result.at(x, y) = Color16b::transparent();
+                    continue;
+                }
+                result.at(x, y).c = uint16_t(((r + n / 2) / n) | (((g + n / 2) / n) << 5) | (((b + n / 2) / n) << 10) | (1 << 15));
+            }
+        }
+        return result;
+    }
 };
 
 struct GreyScaleImage8bit
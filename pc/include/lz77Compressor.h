@@ -0,0 +1,126 @@
+#pragma once
+
+#include <algorithm>
+#include <cstdint>
+#include <vector>
+
+#include <lz77.h>
+
+namespace lz77
+{
+    struct CompressionStats
+    {
+        uint32_t numBlocks = 0;
+        uint32_t numLiterals = 0;
+        uint32_t numReferences = 0;
+        uint32_t copiedBytes = 0; // Bytes produced by back references
+
+        // Rough cost model of the BIOS decoder reading from ROM. Good for comparing lumps, not for exact budgets.
+        uint32_t decodeCycles() const
+        {
+            return 24 * numBlocks + 20 * numLiterals + 36 * numReferences + 10 * copiedBytes;
+        }
+    };
+
+    // Compresses data for LZ77UnCompWram and LZ77UnCompVram. Output is padded to a whole number of words.
+    // vramSafe keeps back references at least 2 bytes behind. LZ77UnCompVram writes halfwords, so it can't copy from
+    // the byte right before the output.
+    inline std::vector<uint8_t> compress(const void* data, size_t size, bool vramSafe, CompressionStats* stats = nullptr)
+    {
+        constexpr uint32_t kMinMatch = 3;
+        constexpr uint32_t kMaxMatch = 18;
+        constexpr uint32_t kWindow = 4096;
+        constexpr uint32_t kMaxChain = 256; // Candidates tried per position
+        constexpr uint32_t kHashBits = 15;
+        const uint32_t minDistance = vramSafe ? 2 : 1;
+
+        auto src = reinterpret_cast<const uint8_t*>(data);
+        CompressionStats localStats;
+        CompressionStats& counters = stats ? *stats : localStats;
+        counters = {};
+
+        std::vector<uint8_t> out;
+        uint32_t header = kTypeTag | (uint32_t(size) << 8);
+        for (int i = 0; i < 4; ++i)
+            out.push_back(uint8_t(header >> (8 * i)));
+
+        // Chains of earlier positions that start with the same 3 bytes
+        std::vector<int32_t> head(1 << kHashBits, -1);
+        std::vector<int32_t> prev(size, -1);
+        auto hash = [&](size_t pos) {
+            uint32_t key = src[pos] | (src[pos + 1] << 8) | (src[pos + 2] << 16);
+            return (key * 2654435761u) >> (32 - kHashBits);
+        };
+        auto insert = [&](size_t pos) {
+            if (pos + kMinMatch > size)
+                return;
+            uint32_t h = hash(pos);
+            prev[pos] = head[h];
+            head[h] = int32_t(pos);
+        };
+
+        size_t pos = 0;
+        size_t flagsPos = 0;
+        uint32_t token = 8;
+        while (pos < size)
+        {
+            if (token == 8)
+            {
+                flagsPos = out.size();
+                out.push_back(0);
+                token = 0;
+                ++counters.numBlocks;
+            }
+
+            // Longest match within the window
+            uint32_t bestLength = 0;
+            uint32_t bestDistance = 0;
+            if (pos + kMinMatch <= size)
+            {
+                uint32_t maxLength = uint32_t(std::min<size_t>(kMaxMatch, size - pos));
+                uint32_t chain = 0;
+                for (int32_t candidate = head[hash(pos)]; candidate >= 0 && chain < kMaxChain; candidate = prev[candidate], ++chain)
+                {
+                    uint32_t distance = uint32_t(pos - candidate);
+                    if (distance > kWindow)
+                        break;
+                    if (distance < minDistance)
+                        continue;
+                    uint32_t length = 0;
+                    while (length < maxLength && src[candidate + length] == src[pos + length])
+                        ++length;
+                    if (length > bestLength)
+                    {
+                        bestLength = length;
+                        bestDistance = distance;
+                        if (length == maxLength)
+                            break;
+                    }
+                }
+            }
+
+            if (bestLength >= kMinMatch)
+            {
+                out[flagsPos] |= 0x80 >> token;
+                out.push_back(uint8_t(((bestLength - kMinMatch) << 4) | ((bestDistance - 1) >> 8)));
+                out.push_back(uint8_t((bestDistance - 1) & 0xff));
+                ++counters.numReferences;
+                counters.copiedBytes += bestLength;
+                for (uint32_t i = 0; i < bestLength; ++i)
+                    insert(pos + i);
+                pos += bestLength;
+            }
+            else
+            {
+                out.push_back(src[pos]);
+                ++counters.numLiterals;
+                insert(pos);
+                ++pos;
+            }
+            ++token;
+        }
+
+        out.resize((out.size() + 3) & ~size_t(3), 0);
+        return out;
+    }
+}
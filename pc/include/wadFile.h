@@ -0,0 +1,137 @@
+#pragma once
+
+#include <algorithm>
+#include <cstdint>
+#include <cstring>
+#include <span>
+#include <string>
+#include <string_view>
+#include <unordered_map>
+#include <vector>
+
+#include <WAD.h>
+#include <mappedFile.h>
+
+// Read only view of an IWAD or PWAD, mapped into memory.
+// Lumps are returned as spans into the mapping, so nothing is copied. Names are indexed once on open.
+class WadFile
+{
+public:
+    static constexpr int kNotFound = -1;
+
+    WadFile() = default;
+    explicit WadFile(const char* fileName) { open(fileName); }
+
+    // Fails on files that aren't WADs, or whose directory points outside the file
+    bool open(const char* fileName)
+    {
+        close();
+        if (!m_file.open(fileName) || m_file.size() < sizeof(WAD::Header))
+            return fail();
+
+        auto bytes = static_cast<const uint8_t*>(m_file.data());
+        if (memcmp(bytes, "IWAD", 4) != 0 && memcmp(bytes, "PWAD", 4) != 0)
+            return fail();
+
+        auto header = reinterpret_cast<const WAD::Header*>(bytes);
+        if (header->numLumps < 0 || header->dirOffset < 0
+            || size_t(header->dirOffset) + size_t(header->numLumps) * sizeof(WAD::Lump) > m_file.size())
+            return fail();
+
+        m_directory = reinterpret_cast<const WAD::Lump*>(bytes + header->dirOffset);
+        m_numLumps = header->numLumps;
+        for (int i = 0; i < m_numLumps; ++i)
+        {
+            auto& lump = m_directory[i];
+            if (lump.dataOffset < 0 || lump.dataSize < 0 || size_t(lump.dataOffset) + size_t(lump.dataSize) > m_file.size())
+                return fail();
+            m_index[nameKey(lump.lumpName)].push_back(i); // In directory order
+        }
+        return true;
+    }
+
+    void close()
+    {
+        m_file.close();
+        m_index.clear();
+        m_directory = nullptr;
+        m_numLumps = 0;
+    }
+
+    bool isOpen() const { return m_directory != nullptr; }
+    bool isIWAD() const { return isOpen() && !memcmp(m_file.data(), "IWAD", 4); }
+
+    int numLumps() const { return m_numLumps; }
+    const WAD::Lump& lump(int index) const { return m_directory[index]; }
+
+    std::string lumpName(int index) const
+    {
+        auto& name = m_directory[index].lumpName;
+        return std::string(name, strnlen(name, sizeof(name)));
+    }
+
+    std::span<const uint8_t> lumpData(int index) const
+    {
+        auto& lump = m_directory[index];
+        return { static_cast<const uint8_t*>(m_file.data()) + lump.dataOffset, size_t(lump.dataSize) };
+    }
+
+    // Lump contents as an array of T. Trailing bytes that don't make a whole element are ignored.
+    template<class T>
+    std::span<const T> lumpAs(int index) const
+    {
+        auto data = lumpData(index);
+        return { reinterpret_cast<const T*>(data.data()), data.size() / sizeof(T) };
+    }
+
+    // First lump called name in [first, end), or kNotFound. Names compare like Doom does, ignoring case.
+    // Map lumps repeat once per map, so callers look them up within the map's range.
+    int find(std::string_view name, int first = 0, int end = -1) const
+    {
+        if (end < 0)
+            end = m_numLumps;
+        auto entry = m_index.find(nameKey(name));
+        if (entry == m_index.end())
+            return kNotFound;
+        auto& indices = entry->second;
+        auto i = std::lower_bound(indices.begin(), indices.end(), first);
+        return (i != indices.end() && *i < end) ? *i : kNotFound;
+    }
+
+    // Every lump called name, in directory order
+    std::span<const int> findAll(std::string_view name) const
+    {
+        auto entry = m_index.find(nameKey(name));
+        if (entry == m_index.end())
+            return {};
+        return entry->second;
+    }
+
+private:
+    // The 8 name bytes as a single integer, upper case and zero padded
+    static uint64_t nameKey(std::string_view name)
+    {
+        uint64_t key = 0;
+        for (size_t i = 0; i < 8 && i < name.size() && name[i]; ++i)
+        {
+            char c = name[i];
+            if (c >= 'a' && c <= 'z')
+                c = char(c - 'a' + 'A');
+            key |= uint64_t(uint8_t(c)) << (8 * i);
+        }
+        return key;
+    }
+
+    static uint64_t nameKey(const char (&name)[8]) { return nameKey(std::string_view(name, 8)); }
+
+    bool fail()
+    {
+        close();
+        return false;
+    }
+
+    MappedFile m_file;
+    const WAD::Lump* m_directory = nullptr;
+    int m_numLumps = 0;
+    std::unordered_map<uint64_t, std::vector<int>> m_index;
+};
@@ -0,0 +1,51 @@
+#include "brick.h"
+
+extern const uint32_t brickTexels[342] = {
+33620481, 84018179, 17171974, 134678273, 151456265, 201788167, 235867661, 202313483,
+16912388, 202441488, 101122310, 302057222, 117901587, 84347667, 218761997, 336399626,
+67244291, 84087057, 16844295, 336003329, 168232723, 135071499, 218761749, 302844685,
+286654737, 201396483, 16844294, 335611655, 185797387, 302712585, 168430871, 336267786,
+16974865, 302187542, 101122311, 302450182, 151717639, 135465227, 218764554, 336400141,
+50533892, 335679504, 101058054, 302121217, 117902091, 202574099, 185207309, 202313239,
+50402820, 201397763, 100730630, 201457926, 151587335, 135072521, 219613962, 302845197,
+286331158, 201594385, 202115080, 202638600, 151718667, 84480787, 302517268, 201657356,
+51451414, 135332113, 68228611, 201527556, 218565898, 303236871, 117901575, 134875911,
+16912662, 84083203, 51450113, 335741697, 152242951, 134940426, 118163979, 134940429,
+285413635, 83952386, 67174915, 84087041, 118097683, 336137483, 118295817, 202049801,
+17826582, 336658691, 285413634, 335741456, 118163209, 202180875, 319490311, 201918729,
+33752066, 201457936, 285410051, 302187523, 319228685, 201787147, 320015111, 336267529,
+16843025, 135332612, 16974596, 335745283, 118163721, 202050311, 117902087, 84608777,
+50529046, 134353169, 67180033, 201392897, 319425291, 202050317, 218564363, 302583049,
+202509330, 303171604, 16909058, 201593110, 202116101, 336728584, 151458579, 84609290,
+219483403, 84871950, 51774211, 201523971, 101123590, 201721351, 151456009, 302713101,
+352982794, 202182154, 34997014, 302056451, 17170694, 302384897, 151717643, 201919757,
+353176842, 202182157, 51777793, 335741718, 17237510, 302121223, 151456521, 84346634,
+386731274, 302714379, 285282563, 302186769, 33685767, 336004609, 151652617, 302583049,
+185535755, 84545037, 68555009, 335746577, 101057025, 302055681, 151849737, 302713611,
+218958347, 84806410, 17831446, 84083457, 34014727, 84017414, 168232714, 336267531,
+219023885, 202183949, 17892113, 84022787, 101058054, 201393922, 185141513, 84609801,
+185276171, 134941965, 336071692, 202116108, 117901062, 335939335, 336856328, 135009300,
+169283341, 202181901, 386797077, 202705423, 101123847, 84281095, 117507847, 134676743,
+168626709, 84609547, 235736335, 337054987, 101058054, 201786886, 17236231, 84280839,
+168495626, 302648589, 218762007, 336400139, 101057030, 335675654, 117901063, 201459207,
+218959370, 134941963, 386599691, 202050837, 117506305, 335939329, 117507585, 201393927,
+218827530, 84741386, 219614477, 84809483, 100730631, 134284806, 33949447, 134612481,
+168693517, 201984778, 185208341, 302844426, 101058311, 201459201, 17236482, 201786886,
+218828559, 84809485, 218959373, 135727629, 33687297, 134678017, 17171969, 84279559,
+202510856, 201656340, 386600205, 84740622, 135533580, 302319628, 117899526, 302057223,
+402850051, 419496198, 436930314, 453840141, 403771651, 486998300, 436671243, 436933911,
+403702532, 402725889, 503777035, 453839637, 403768068, 521738266, 437455371, 521869850,
+402850582, 537071875, 436671243, 436930311, 419562256, 402850563, 436930311, 436800263,
+402850051, 553845507, 504042274, 436802315, 606282017, 402850307, 521804314, 420087571,
+621614347, 402853891, 553713926, 420153095, 438701323, 553845507, 419496193, 419891722,
+437062923, 402853905, 402719233, 436930311, 453840139, 522262817, 419889436, 521804313,
+436934413, 437069325, 402725889, 419497735, 437062423, 504171275, 419496193, 537331457,
+436931853, 622267149, 486934023, 419823879, 673651237, 621481229, 521739549, 403112193,
+704719107, 739060499, 405612803, 623782667, 788737808, 772221715, 788731951, 806558251,
+788737035, 705113857, 405875725, 438972929, 739060491, 839332353, 856499500, 755046450,
+741683764, 925578799, 708325173, 976369964, 758461225, 59};
+extern const uint32_t brickPalette[30] = {
+2570387456, 2568263957, 3260257523, 2570491156, 2503329396, 2572653878, 2572731987, 2572786041,
+2501089555, 2570568274, 2503460467, 2505544946, 2916396468, 2983636437, 2983499029, 3121918421,
+2914234804, 2916325718, 2916530707, 2918619512, 2708781589, 2778113429, 2708841879, 2775884182,
+2708709781, 2711070069, 2708970836, 2641797460, 2641928533, 2708905301};
@@ -0,0 +1,14 @@
+#pragma once
+#include <cstdint>
+
+constexpr uint32_t brickLog2Width = 5;
+constexpr uint32_t brickLog2Height = 5;
+constexpr uint32_t brickMipCount = 6;
+constexpr uint32_t brickMipOffsets[6] = { 0, 1024, 1280, 1344, 1360, 1364 };
+
+constexpr uint32_t brickTexelsSize = 342;
+extern const uint32_t brickTexels[];
+
+constexpr uint32_t brickPaletteSize = 30;
+extern const uint32_t brickPalette[];
+
@@ -1,3233 +0,0 @@
-#include "C:\repos\GBA\raycaster\assets\e1m1.wad.h"
-
-extern const uint32_t e1m1_WADVertices[1884] = {
-458752, 4293132288, 458752, 4292673536, 1507328, 4293132288, 1507328, 4294508544,
-1507328, 4294017024, 4294901760, 4292673536, 4294901760, 4293132288, 4294426624, 4293132288,
-4293771264, 4293591040, 4293722112, 4293951488, 4293853184, 4294770688, 4294901760, 4294885376,
-458752, 4294885376, 1507328, 4294770688, 4294803456, 4293722112, 65536, 4293722112,
-589824, 4293328896, 4294770688, 4293328896, 4293722112, 4294279168, 4293459968, 4293722112,
-4293459968, 4293656576, 4293459968, 4293591040, 4293656576, 4293591040, 4293656576, 4293001216,
-4293197824, 4293656576, 4293197824, 4293722112, 4293394432, 4293197824, 4292935680, 4293197824,
-4292804608, 4293394432, 4292804608, 4293591040, 4292411392, 4293394432, 4293066752, 4293918720,
-4293066752, 4293656576, 4293197824, 4293918720, 4293066752, 4294115328, 4292935680, 4292935680,
-4292673536, 4292935680, 4292280320, 4292935680, 4292280320, 4293148672, 4292509696, 4293197824,
-4292280320, 4293197824, 4292280320, 4293394432, 4291756032, 4293394432, 4291756032, 4293918720,
-4292149248, 4293918720, 4292149248, 4294082560, 4292673536, 4294082560, 4292673536, 4293918720,
-4292149248, 4292673536, 4292149248, 4292280320, 4292673536, 4292198400, 4292411392, 4292198400,
-4291362816, 4292804608, 4290969600, 4292804608, 4291362816, 4292673536, 4291231744, 4292149248,
-4291493888, 4292149248, 4291231744, 4292280320, 4290969600, 4292280320, 4291493888, 4292542464,
-4291887104, 4292542464, 4291887104, 4292673536, 4291756032, 4292280320, 4291756032, 4292083712,
-4292411392, 4292083712, 4292411392, 4291756032, 4292673536, 4292411392, 4293066752, 4292411392,
-4293066752, 4293066752, 4293328896, 4293066752, 4293328896, 4292149248, 4292935680, 4292149248,
-4292935680, 4291887104, 4293394432, 4291887104, 4292673536, 4291756032, 4294115328, 4291624960,
-4292804608, 4291624960, 4292804608, 4291493888, 4292149248, 4291493888, 4292149248, 4291756032,
-4291624960, 4291756032, 4291624960, 4291887104, 4291231744, 4291887104, 4290707456, 4291887104,
-4290707456, 4292673536, 4290707456, 4293066752, 4291231744, 4293066752, 4291231744, 4293197824,
-4291624960, 4293197824, 4291624960, 4292935680, 4294180864, 4293001216, 4294180864, 4292673536,
-4294246400, 4292673536, 4294246400, 4292935680, 4294770688, 4292935680, 4294770688, 4292411392,
-327680, 4292411392, 327680, 4292149248, 4293984256, 4292673536, 4293722112, 4292673536,
-4293722112, 4291887104, 4293853184, 4291887104, 4293853184, 4292280320, 4294508544, 4292280320,
-4293984256, 4292411392, 4294508544, 4292673536, 4294508544, 4292411392, 4294639616, 4292673536,
-4294639616, 4292149248, 4294901760, 4292149248, 4294901760, 4291756032, 4294508544, 4291887104,
-4294770688, 4291887104, 4294770688, 4291231744, 4294508544, 4291624960, 4294246400, 4291624960,
-4294246400, 4292018176, 4294115328, 4292018176, 458752, 4292149248, 458752, 4292411392,
-1245184, 4292411392, 851968, 4291231744, 851968, 4291362816, 851968, 4291756032,
-4293197824, 4293591040, 4292476928, 1245184, 4292673536, 1048576, 4294508544, 4293459968,
-4294508544, 4293722112, 4294705152, 4293722112, 4294754304, 4293722112, 557056, 4293722112,
-606208, 4293722112, 655360, 4293722112, 851968, 4293722112, 851968, 4293459968,
-4290707456, 4292411392, 4290314240, 4292411392, 4291100672, 4293722112, 4291100672, 4293459968,
-4290576384, 4292673536, 1507328, 4293984256, 1507328, 4293591040, 4290576384, 4293197824,
-360448, 4293525504, 32768, 4293525504, 360448, 4293476352, 32768, 4293476352,
-360448, 4293427200, 32768, 4293427200, 4290445312, 4293722112, 4290707456, 4293722112,
-65536, 327680, 65536, 458752, 4293197824, 65536, 4293197824, 4294672384,
-4293197824, 4294639616, 4293197824, 4294377472, 4292739072, 4294443008, 4292935680, 4294639616,
-4292935680, 4294672384, 4293328896, 4294311936, 4292935680, 65536, 327680, 458752,
-327680, 327680, 4294508544, 4294246400, 851968, 4294246400, 589824, 4294508544,
-327680, 4293722112, 0, 4294508544, 4294508544, 4294508544, 393216, 4294508544,
-360448, 4294475776, 32768, 4294475776, 327680, 4294443008, 65536, 4294443008,
-327680, 4294410240, 65536, 4294410240, 851968, 4294017024, 851968, 4293984256,
-65536, 4293984256, 65536, 4294246400, 327680, 4294148096, 4292509696, 4293148672,
-4292673536, 262144, 4292608000, 4294836224, 4291805184, 1114112, 4291887104, 1245184,
-4291624960, 2031616, 4291624960, 2555904, 4291706880, 2572288, 4292329472, 2572288,
-4292411392, 2555904, 4292411392, 2031616, 4292149248, 1245184, 4292149248, 1769472,
-4291887104, 1769472, 4290576384, 4294639616, 4290625536, 4294639616, 4291493888, 2031616,
-4291493888, 2555904, 4292542464, 2555904, 4292542464, 2031616, 4291887104, 2818048,
-4292149248, 2818048, 4291887104, 2686976, 4292149248, 2686976, 4291952640, 4294443008,
-4291952640, 4294115328, 4290838528, 4293787648, 4290838528, 4293853184, 4290772992, 4293853184,
-4290314240, 4294377472, 4290314240, 4294639616, 4290576384, 4294377472, 4290576384, 4294311936,
-4290625536, 4294377472, 4291051520, 4294246400, 4290707456, 4294246400, 4293197824, 4293787648,
-4293459968, 4293787648, 4290707456, 4293459968, 4290772992, 4293722112, 4290772992, 4293459968,
-4290838528, 4293722112, 4290838528, 4293459968, 4291100672, 4293787648, 4291100672, 4293853184,
-4290838528, 4294115328, 4290772992, 4294115328, 4290707456, 4293853184, 4290707456, 4294115328,
-4290641920, 4293853184, 4290641920, 4294115328, 4290576384, 4293853184, 4290576384, 4294115328,
-4290314240, 4294115328, 4290314240, 4294180864, 4290576384, 4294180864, 4290314240, 4294246400,
-4290576384, 4294246400, 4290314240, 4294311936, 4291100672, 4294115328, 4290314240, 4293853184,
-3407872, 4293197824, 3407872, 4293066752, 3407872, 4293328896, 3407872, 4293459968,
-3407872, 4293722112, 3407872, 4293591040, 3407872, 4293853184, 2949120, 4293066752,
-2981888, 4293197824, 3014656, 4293328896, 3047424, 4293459968, 3080192, 4293591040,
-3112960, 4293722112, 3112960, 4293853184, 3407872, 65536, 3407872, 4294901760,
-3407872, 4294770688, 3407872, 4294639616, 3407872, 4294508544, 3407872, 4294377472,
-3407872, 4294246400, 3112960, 4294246400, 3112960, 4294377472, 3080192, 4294508544,
-3047424, 4294639616, 3014656, 4294770688, 2981888, 4294901760, 2949120, 65536,
-2555904, 4294377472, 2818048, 4294377472, 2818048, 4293722112, 2555904, 4293722112,
-2818048, 4294246400, 2818048, 4293853184, 2555904, 4293853184, 2555904, 4294246400,
-2424832, 4293918720, 2424832, 4294180864, 2293760, 4293722112, 2293760, 4294049792,
-2293760, 4294377472, 2424832, 4294377472, 2424832, 4293722112, 2949120, 4292804608,
-4294639616, 4294246400, 4294901760, 4294246400, 4294901760, 4293853184, 4294901760, 4293984256,
-65536, 4293853184, 1933312, 4293197824, 1933312, 4293459968, 1900544, 4293459968,
-1900544, 4293197824, 4294098944, 4293459968, 1245184, 4290969600, 4294508544, 4290969600,
-4291805184, 2670592, 4291559424, 2686976, 4291559424, 3014656, 4291690496, 2949120,
-4291690496, 2768896, 4292345856, 2949120, 4291690496, 3080192, 4292231168, 2670592,
-4292345856, 2768896, 4292476928, 2949120, 4292476928, 2686976, 4292476928, 3080192,
-4293984256, 4293328896, 4293984256, 4293066752, 4293722112, 4293066752, 4293722112, 4293328896,
-4293722112, 4293459968, 4293984256, 4293459968, 4294115328, 4293328896, 4294115328, 4293066752,
-262144, 4292673536, 262144, 4292608000, 131072, 4292608000, 131072, 4292673536,
-1933312, 4294639616, 1933312, 4294901760, 1900544, 4294901760, 1900544, 4294639616,
-3457024, 4294246400, 2293760, 1802240, 5439488, 1671168, 5439488, 4291887104,
-589824, 4293459968, 4294770688, 4293459968, 4293722112, 4293410816, 4293984256, 4293410816,
-1851392, 4293459968, 1851392, 4293197824, 1851392, 4294639616, 1851392, 4294901760,
-327680, 4294098944, 65536, 4294295552, 65536, 4293771264, 327680, 4293771264,
-4294574080, 4293853184, 4294574080, 4293984256, 4294639616, 4294115328, 4294901760, 4294115328,
-4294639616, 4294443008, 49152, 4294443008, 49152, 4294246400, 4294574080, 4294033408,
-4294901760, 4294033408, 4294852608, 4293853184, 16384, 4293984256, 4294639616, 4294197248,
-4294901760, 4294197248, 851968, 4293853184, 819200, 4293853184, 819200, 4293984256,
-720896, 4293787648, 393216, 4293787648, 393216, 4293984256, 393216, 4294246400,
-393216, 4294443008, 589824, 4294443008, 786432, 4294246400, 589824, 4293984256,
-589824, 4294246400, 393216, 4294049792, 393216, 4294180864, 458752, 4294049792,
-524288, 4294082560, 524288, 4294148096, 458752, 4294180864, 786432, 4293853184,
-786432, 4293984256, 458752, 4293984256, 458752, 4294246400, 4294901760, 4294934528,
-458752, 4294934528, 1081344, 4294377472, 1146880, 4294377472, 1179648, 4294410240,
-1179648, 4294475776, 1146880, 4294508544, 1081344, 4294508544, 1048576, 4294475776,
-1048576, 4294410240, 4294082560, 4294443008, 4294148096, 4294443008, 4294180864, 4294475776,
-4294180864, 4294541312, 4294148096, 4294574080, 4294082560, 4294574080, 4294049792, 4294541312,
-4294049792, 4294475776, 2818048, 4293066752, 2818048, 4292804608, 2899968, 4292804608,
-2899968, 4293066752, 3440640, 4292771840, 3440640, 4292853760, 3440640, 4293459968,
-3440640, 4293820416, 3407872, 4292853760, 3407872, 4292804608, 3358720, 4292771840,
-3358720, 4292804608, 2949120, 4292771840, 1638400, 4292542464, 2031616, 4292771840,
-3031040, 4293853184, 3031040, 4294246400, 3457024, 4293853184, 3538944, 4293853184,
-3538944, 4294246400, 3801088, 4294246400, 3866624, 4294180864, 3866624, 4293918720,
-3801088, 4293853184, 3538944, 4293820416, 3801088, 4293820416, 3899392, 4293918720,
-3899392, 4294180864, 3801088, 4294279168, 3538944, 4294279168, 3440640, 4294279168,
-3899392, 4293820416, 3899392, 4294279168, 2555904, 4294180864, 2555904, 4293918720,
-3440640, 4294639616, 3440640, 278528, 3407872, 327680, 3407872, 278528,
-3440640, 360448, 3145728, 360448, 2981888, 360448, 2949120, 327680,
-2981888, 327680, 3145728, 327680, 2031616, 360448, 2031616, 1638400,
-3194880, 327680, 3194880, 360448, 3407872, 360448, 3194880, 458752,
-3407872, 458752, 3407872, 589824, 3194880, 589824, 4915200, 1409024,
-5177344, 884736, 5177344, 4292804608, 1146880, 4293328896, 1212416, 4293328896,
-1245184, 4293361664, 1245184, 4293427200, 1212416, 4293459968, 1146880, 4293459968,
-1114112, 4293427200, 1114112, 4293361664, 2031616, 4291756032, 1638400, 4291887104,
-4293689344, 4293984256, 4293656576, 4293984256, 4293656576, 4293918720, 4293459968, 4293918720,
-4293656576, 4294311936, 4293656576, 4294246400, 4293689344, 4294246400, 4293197824, 4293885952,
-4293459968, 4293885952, 4294901760, 589824, 458752, 589824, 458752, 458752,
-4294901760, 458752, 65536, 4291362816, 65536, 4291624960, 851968, 4291624960,
-4292231168, 4292935680, 4292411392, 4292673536, 4292280320, 4292673536, 4292231168, 4292673536,
-4293394432, 4291936256, 4293722112, 4291936256, 4292411392, 4292411392, 4292411392, 4292460544,
-4292673536, 4292460544, 4294246400, 4292411392, 4294180864, 4292411392, 983040, 4292018176,
-983040, 4292149248, 720896, 4292149248, 720896, 4292018176, 4290969600, 4292673536,
-4290969600, 4292411392, 4291100672, 4292673536, 4291100672, 4292411392, 4290314240, 4292673536,
-4290314240, 4293459968, 4290641920, 4293459968, 4290641920, 4293197824, 4292411392, 4293591040,
-4291952640, 4293591040, 4291952640, 4293722112, 4292542464, 4293656576, 4292542464, 4293885952,
-4292280320, 4293722112, 4292280320, 4293885952, 4292935680, 4293918720, 4292935680, 4293656576,
-4290445312, 4293459968, 4291166208, 4294377472, 4290625536, 4294836224, 4290625536, 131072,
-4290625536, 262144, 4290625536, 589824, 4290625536, 720896, 4290707456, 720896,
-4291100672, 720896, 4291166208, 720896, 4290592768, 131072, 4290592768, 4294836224,
-4290592768, 589824, 4290592768, 262144, 4291100672, 753664, 4290707456, 753664,
-4291231744, 851968, 4290592768, 753664, 4290592768, 4294672384, 4290150400, 4294672384,
-4289527808, 196608, 4289527808, 1114112, 4290052096, 1507328, 4291100672, 1507328,
-4291231744, 1376256, 4289855488, 1048576, 4291166208, 4294639616, 4290953216, 278528,
-4290854912, 278528, 4290854912, 180224, 4290953216, 180224, 4290838528, 393216,
-4290969600, 393216, 4291035136, 327680, 4291035136, 131072, 4290969600, 65536,
-4290838528, 65536, 4290772992, 131072, 4290772992, 327680, 4290707456, 589824,
-4915200, 4292149248, 4293197824, 458752, 4293197824, 933888, 4293312512, 1048576,
-4294262784, 1048576, 4294377472, 933888, 4294377472, 180224, 4294262784, 65536,
-4293591040, 65536, 4293459968, 196608, 4294115328, 393216, 4294115328, 786432,
-4293722112, 786432, 4293722112, 393216, 4293853184, 524288, 4293951488, 524288,
-4293951488, 655360, 4293853184, 655360, 4293984256, 524288, 4293984256, 655360,
-4293427200, 163840, 4293165056, 425984, 4291821568, 4294115328, 4291624960, 4294115328,
-4291461120, 4294197248, 4291362816, 4294377472, 4291821568, 4294443008, 4291772416, 4294443008,
-4291723264, 4294459392, 4291690496, 4294475776, 4291362816, 4294508544, 4291690496, 4294508544,
-4291362816, 229376, 4291690496, 229376, 4291231744, 229376, 4291231744, 327680,
-4291198976, 720896, 4291362816, 720896, 4291362816, 327680, 4291395584, 327680,
-4291428352, 1032192, 4291510272, 1114112, 4291166208, 671744, 4291166208, 458752,
-4291198976, 458752, 4291198976, 671744, 4291231744, 458752, 4291690496, 327680,
-4291805184, 4294836224, 4291756032, 327680, 4291362816, 458752, 4291493888, 4294164480,
-4291362816, 376832, 4291395584, 458752, 4291428352, 589824, 4291887104, 1572864,
-4292149248, 1572864, 4292149248, 1851392, 4291887104, 1851392, 4292001792, 4294115328,
-4292001792, 4294443008, 4291624960, 458752, 4291887104, 1523712, 4292149248, 1523712,
-4291887104, 1294336, 4291887104, 1425408, 4291854336, 1425408, 4291854336, 1294336,
-4291624960, 1294336, 4291690496, 1425408, 4291493888, 1376256, 4291624960, 1507328,
-4291428352, 1507328, 4291428352, 1572864, 4291428352, 1638400, 4291624960, 1638400,
-4291624960, 1572864, 4291428352, 1703936, 4291428352, 1769472, 4291624960, 1769472,
-4291624960, 1703936, 4291428352, 1835008, 4291624960, 1835008, 4291624960, 1900544,
-4291493888, 1900544, 4291493888, 1998848, 4291624960, 1998848, 4292149248, 1294336,
-4291788800, 2686976, 4291690496, 2588672, 4292345856, 2588672, 4292247552, 2686976,
-4291362816, 131072, 4291690496, 131072, 4292542464, 3145728, 4292673536, 3145728,
-4292804608, 3096576, 4292935680, 3047424, 4293066752, 2998272, 4292673536, 2752512,
-4292542464, 2752512, 4293066752, 2555904, 4292935680, 2621440, 4292804608, 2686976,
-4293197824, 2555904, 4293197824, 2998272, 4293328896, 3080192, 4293459968, 3129344,
-4293459968, 2818048, 4293328896, 2621440, 4293591040, 2883584, 4293591040, 3145728,
-4293885952, 3211264, 4293885952, 3342336, 4294017024, 3473408, 4294148096, 3473408,
-4294410240, 3473408, 4294541312, 3473408, 4294672384, 3342336, 4294672384, 2949120,
-4294541312, 2818048, 4294410240, 2818048, 4294148096, 2818048, 4294017024, 2818048,
-4293885952, 2949120, 4293869568, 2932736, 4294000640, 2801664, 4294148096, 2801664,
-4294410240, 2801664, 4294688768, 2932736, 4294688768, 3358720, 4294557696, 3489792,
-4294410240, 3489792, 4294148096, 3489792, 4294000640, 3489792, 4293869568, 3358720,
-4293754880, 2932736, 4293459968, 2785280, 4294557696, 2801664, 4293869568, 3227648,
-4293689344, 3227648, 4293427200, 3473408, 4293427200, 3997696, 4294639616, 3997696,
-65536, 3866624, 327680, 3473408, 327680, 2818048, 65536, 2424832,
-4293459968, 2359296, 4293885952, 3080192, 4293820416, 3080192, 4293722112, 2949120,
-4293722112, 3211264, 4293820416, 3211264, 4293623808, 2899968, 4293623808, 3162112,
-4292509696, 2949120, 4292509696, 3080192, 4293853184, 3080192, 4293853184, 3211264,
-0, 3735552, 0, 2686976, 4294377472, 3211264, 4294508544, 3211264,
-4294508544, 3080192, 4294377472, 3080192, 4294639616, 3211264, 4294639616, 3080192,
-4294541312, 3047424, 4294541312, 3244032, 3080192, 4294443008, 3080192, 4293656576,
-4291231744, 376832, 4291166208, 4294115328, 4291166208, 4293853184, 4291362816, 4294115328,
-4291362816, 4293853184, 1245184, 4291592192, 1245184, 4291395584, 1376256, 4291428352,
-1376256, 4291559424, 1245184, 4291559424, 1245184, 4291428352, 1638400, 4291624960,
-1638400, 4291362816, 1376256, 4291362816, 1376256, 4291624960, 4291100672, 4293820416,
-4291919872, 262144, 4292673536, 851968, 4292149248, 851968, 4291887104, 655360,
-4292476928, 655360, 4292476928, 458752, 4292083712, 458752, 4291624960, 589824,
-4291723264, 327680, 4293689344, 4294279168, 4293689344, 4293951488, 4292345856, 1245184,
-4292280320, 4294836224, 4292149248, 4294836224, 4291674112, 1114112, 4294344704, 3178496,
-4294344704, 3112960, 4294361088, 3112960, 4294361088, 3178496, 2686976, 4293132288,
-2555904, 4293197824, 2424832, 4293263360, 2293760, 4293328896, 2162688, 4293394432,
-2686976, 4292870144, 2555904, 4292935680, 2424832, 4293001216, 2293760, 4293066752,
-2162688, 4293132288, 2818048, 327680, 2818048, 65536, 2899968, 65536,
-2899968, 327680, 2686976, 262144, 2555904, 196608, 2424832, 131072,
-2293760, 65536, 2162688, 0, 2686976, 0, 2555904, 4294901760,
-2424832, 4294836224, 2293760, 4294770688, 2162688, 4294705152, 2129920, 4293132288,
-2129920, 4293394432, 2129920, 4294705152, 2129920, 0, 3407872, 4293509120,
-3407872, 4294590464, 4291362816, 4294606848, 4291362816, 4294705152, 4291362816, 4294803456,
-4291362816, 4294901760, 4291690496, 4294901760, 4291690496, 4294803456, 4291690496, 4294705152,
-4291690496, 4294606848, 4291362816, 32768, 4291690496, 32768, 4291362816, 4294475776,
-4291428352, 622592, 4291624960, 622592, 4290674688, 4293459968, 4290412544, 4293459968,
-4292984832, 4293656576, 4292984832, 4293918720, 4292542464, 2949120, 4292542464, 3080192,
-4292706304, 3145728, 4292706304, 2752512, 4290609152, 4294115328, 4290609152, 4293853184,
-2424832, 4294246400, 2293760, 4294246400, 2949120, 360448, 2949120, 1564672,
-2949120, 1773568, 1933312, 4294705152, 3407872, 1527808, 3407872, 1755136,
-3538944, 1517568, 5177344, 4294279168, 3899392, 4294246400, 5177344, 4294246400,
-5439488, 1366016, 5439488, 4294246400, 1900544, 4294658048, 161792, 589824,
-4294748160, 4294508544, 4294883328, 4294883328, 1507328, 4294246400, 327680, 4294246400,
-4294651904, 4294246400, 4294723584, 4294443008, 4294553600, 4294846464, 4294332416, 4294821888,
-4293722112, 4294246400, 4293197824, 4294699008, 4293722112, 1048576, 4293722112, 65536,
-4294377472, 786432, 4294115328, 65536, 4294115328, 524288, 4293951488, 393216,
-4293984256, 786432, 4293951488, 786432, 4293722112, 524288, 4293722112, 655360,
-4294725632, 2633728, 0, 3080192, 4294498304, 3080192, 4294688768, 3080192,
-4293459968, 2523136, 0, 2420736, 327680, 3080192, 4294715392, 3778560,
-4294860800, 3923968, 0, 3887104, 4294498304, 3211264, 4294426624, 3489792,
-4293507072, 3983360, 1638400, 4293539840, 5177344, 4293459968, 5439488, 4293459968,
-2883584, 4292804608, 3440640, 4292804608, 5439488, 4292804608, 5163008, 4292771840,
-2674688, 4291971072, 2875392, 4292771840, 4800512, 4291862528, 2625536, 4291780608,
-2162688, 4293382144, 1638400, 4293158912, 4293656576, 4293328896, 4292935680, 4293439488,
-4292935680, 4293591040, 4293394432, 4292673536, 4293066752, 4292673536, 4293328896, 4292673536,
-4293984256, 4293001216, 4294508544, 4292935680, 4294508544, 4293132288, 4294508544, 4293591040,
-4294246400, 4292280320, 4293853184, 4292018176, 4293853184, 4291624960, 4292935680, 4292411392,
-4293328896, 4292411392, 4292935680, 4291624960, 4292935680, 4294115328, 1507328, 4293722112,
-393216, 4293459968, 262144, 4293328896, 0, 4293459968, 131072, 4293328896,
-311296, 4293427200, 81920, 4293427200, 311296, 4293476352, 81920, 4293476352,
-4294770688, 4292673536, 4294639616, 4292411392, 1245184, 4292149248, 983040, 4290969600,
-4294770688, 4291624960, 4294770688, 4290969600, 4294901760, 4292018176, 589824, 4294115328,
-4292149248, 2949120, 4292149248, 3080192, 4292673536, 2772992, 4291887104, 514048,
-4291493888, 589824, 4291497984, 622592, 4291887104, 851968, 4292673536, 655360,
-4292673536, 327680, 4291756032, 4293591040, 4292411392, 4293197824, 4292804608, 4293365760,
-4291952640, 4293918720, 4292812800, 4293148672, 4291362816, 4293197824, 4291756032, 4292149248,
-4291362816, 4292149248, 4291362816, 4291887104, 4291887104, 4292280320, 4291756032, 4292542464,
-4292411392, 4291493888, 4292626432, 4294946816, 4290625536, 180224, 4290592768, 147456,
-4289957888, 589824, 4290707456, 1361920, 4289921024, 753664, 4289798144, 1314816,
-4291035136, 278528, 4290772992, 278528, 4290854912, 65536, 4291035136, 180224,
-4291166208, 4294705152, 4290969600, 4291887104};
-extern const uint32_t e1m1_WADLineDefs[3616] = {
-65536, 1, 0, 196607, 65536, 0, 4294901761, 262147,
-1, 131072, 393215, 65542, 0, 4294901763, 458758, 1,
-262144, 589823, 65545, 0, 4294901765, 720906, 1, 393216,
-851967, 65549, 0, 4294901767, 983054, 1, 524288, 1114111,
-393233, 0, 655369, 655378, 1, 720896, 1310719, 65556,
-0, 4294901772, 1441813, 1, 851968, 1507327, 65559, 0,
-4294901774, 1638424, 1, 983040, 1769471, 65563, 0, 4294901776,
-1900572, 1, 1114112, 2031615, 65564, 0, 4294901778, 2097183,
-1, 1245184, 2228223, 65570, 0, 4294901780, 2359331, 1,
-1376256, 2490367, 65574, 0, 4294901782, 2621479, 1, 1507328,
-2686975, 65577, 0, 4294901784, 2752553, 1, 1638400, 2818047,
-65579, 0, 4294901786, 2883627, 1, 1769472, 2949119, 65581,
-0, 4294901788, 3014701, 1, 1900544, 3080191, 65583, 0,
-4294901790, 3211312, 1, 2031616, 3342335, 65587, 0, 4294901792,
-3473460, 1, 2162688, 3604479, 65588, 0, 4294901794, 3670071,
-1, 2293760, 3801087, 65591, 0, 4294901796, 3735610, 1,
-2424832, 3932159, 65596, 0, 4294901798, 3866680, 1, 2555904,
-4063231, 65590, 0, 4294901800, 3997756, 1, 2686976, 4128767,
-65599, 0, 4294901802, 4194367, 1, 2818048, 4259839, 65601,
-0, 4294901804, 4390978, 1, 2949120, 4456447, 65604, 0,
-4294901806, 4522052, 1, 3080192, 4587519, 65606, 0, 4294901808,
-4653126, 1, 3211264, 4718591, 65608, 0, 4294901810, 4784200,
-1, 3342336, 4325375, 65610, 0, 4294901812, 3276874, 1,
-3473408, 4980735, 65612, 0, 4294901814, 5046348, 1, 3604480,
-5111807, 65614, 0, 4294901816, 5177422, 1, 3735552, 5242879,
-65616, 0, 4294901818, 5308496, 1, 3866624, 5373951, 65618,
-0, 4294901820, 5439570, 1, 3997696, 5570559, 65621, 0,
-4294901822, 5636181, 1, 4128768, 5701631, 65623, 0, 4294901824,
-5767255, 1, 4259840, 5832703, 65625, 0, 4294901826, 5898263,
-1, 4390912, 5963775, 65627, 0, 4294901828, 6029403, 1,
-4521984, 6094847, 65629, 0, 4294901830, 6160477, 1, 4653056,
-6225919, 65631, 0, 4294901832, 6291551, 1, 4784128, 6356991,
-65633, 0, 4294901834, 6488162, 1, 4915200, 6619135, 65637,
-0, 4294901836, 6684773, 1, 5046272, 6750207, 65639, 0,
-4294901838, 6422632, 1, 5177344, 6946815, 65642, 0, 4294901840,
-6881387, 1, 5308416, 7143423, 65643, 0, 4294901842, 7077997,
-1, 5439488, 7274495, 65645, 0, 4294901844, 7274599, 1,
-5570560, 7340031, 65648, 0, 4294901846, 7405680, 1, 5701632,
-7536639, 65651, 0, 4294901848, 7602291, 1, 5832704, 7667711,
-65653, 0, 4294901850, 4915317, 1, 5963776, 6422527, 65654,
-0, 4294901852, 7798902, 1, 6094848, 7864319, 65656, 0,
-4294901854, 7995513, 1, 6225920, 8126463, 65646, 0, 4294901856,
-4063281, 1, 6356992, 8191999, 786453, 0, 6488162, 8257661,
-1, 6553600, 8388607, 393344, 0, 6684773, 8454272, 1,
-6750208, 8519679, 65666, 0, 4294901864, 917634, 1, 6881280,
-8650751, 65668, 0, 4294901866, 8716420, 1, 7012352, 8781823,
-65670, 0, 4294901868, 8847494, 6, 7143424, 8913006, 1114249,
-0, 4294901871, 9109642, 9, 7340032, 9240575, 1114196, 0,
-4294901873, 9306253, 1, 7471104, 9437183, 65676, 0, 4294901875,
-8585360, 4, 7602176, 9502837, 262288, 0, 7798902, 9502734,
-4, 7864320, 9568377, 262276, 0, 8061050, 9568403, 4,
-8126464, 8519805, 262291, 0, 8323198, 8716436, 4, 8388608,
-9764993, 262292, 0, 8585346, 9764993, 4, 8650752, 5374085,
-4980791, 0, 8847494, 9896086, 9, 8912896, 10027007, 1114265,
-0, 4294901897, 10158234, 1, 9043968, 10223615, 1114268, 0,
-4294901899, 10289308, 1, 9175040, 10420223, 65695, 0, 4294901901,
-10485919, 17, 9306112, 10354687, 65697, 0, 4294901903, 10616992,
-1, 9437184, 10223615, 262304, 0, 9568401, 10223775, 4,
-9633792, 10682516, 1114276, 0, 4294901909, 10748056, 4, 9830400,
-10813591, 196736, 0, 4294901912, 10944678, 3, 10027008, 11075583,
-65667, 0, 4294901914, 11141289, 3, 10158080, 11010047, 196779,
-0, 4294901916, 786443, 14, 10289152, 10813598, 393225, 0,
-10485919, 11075755, 12, 10551296, 11272354, 262317, 0, 10748067,
-11468974, 12, 10813440, 11468966, 65709, 0, 4294901927, 11075757,
-1, 11010048, 11272191, 65708, 0, 4294901929, 11403436, 1,
-11141120, 655359, 262162, 0, 11272363, 11010063, 12, 11337728,
-11534510, 262321, 0, 11534511, 11468977, 1, 11599872, 11468799,
-65712, 0, 4294901938, 10879154, 3, 11730944, 327679, 1245325,
-0, 4294901940, 9240755, 6, 11862016, 262326, 917682, 0,
-12058807, 11665587, 19, 12124160, 11862015, 65717, 0, 4294901946,
-11927728, 1, 12255232, 8191999, 65560, 0, 4294901948, 1376276,
-1, 12386304, 2621439, 262268, 0, 12517566, 11993126, 1,
-12582912, 12058623, 65575, 0, 4294901953, 1769509, 4, 12713984,
-1704131, 262243, 0, 12910788, 6422551, 4, 12976128, 1900743,
-65660, 0, 4294901960, 2293787, 1, 13172736, 12124159, 65721,
-0, 4294901962, 12255418, 1, 13303808, 12386303, 262333, 0,
-13435084, 12452029, 1, 13500416, 12582911, 65728, 0, 4294901967,
-12648640, 4, 13631488, 12255441, 1835202, 0, 13828306, 12845251,
-4063236, 13893643, 12910805, 590022, 0, 4294901974, 13107399, 1,
-14090240, 13238271, 65738, 0, 4294901976, 13369547, 1, 14221312,
-13172735, 65725, 0, 4294901978, 13304013, 1, 14352384, 13434879,
-65742, 0, 4294901980, 13172928, 1, 14483456, 13303807, 65729,
-0, 4294901982, 13631695, 12, 14614528, 13697248, 590034, 0,
-4294901985, 13828306, 9, 14811136, 13959167, 590037, 0, 4294901987,
-14090454, 9, 14942208, 14221311, 1114326, 0, 4294901989, 14287065,
-17, 15073280, 14352383, 1114328, 0, 4294901991, 1245209, 4,
-15204352, 1638633, 65755, 0, 4294901994, 1245404, 1, 15400960,
-1638399, 262164, 0, 15532268, 14418139, 6, 15597568, 9896175,
-262365, 0, 15794416, 14614750, 4, 15859712, 14680307, 262369,
-0, 16056564, 9044192, 4, 16121856, 13697271, 262370, 0,
-16318712, 14876882, 4, 16384000, 13762811, 262372, 0, 16580860,
-15007955, 4, 16646144, 15073535, 262375, 0, 16843008, 15270120,
-4, 16908288, 15335683, 786667, 0, 17105156, 15401196, 4,
-17170432, 15532295, 262382, 0, 17367304, 15728879, 4, 17432576,
-15794443, 262359, 0, 17629452, 14745739, 9, 17694720, 14811135,
-590047, 0, 4294902031, 14483679, 9, 17825792, 9961471, 590046,
-0, 4294902033, 14680286, 9, 17956864, 14745599, 590033, 0,
-4294902035, 9044194, 9, 18087936, 15007743, 590066, 0, 4294902037,
-15139049, 9, 18219008, 15204351, 590053, 0, 4294902039, 14942437,
-9, 18350080, 13893631, 590054, 0, 4294902041, 15204582, 9,
-18481152, 15400959, 590067, 0, 4294902043, 15466739, 9, 18612224,
-14155775, 590064, 0, 4294902045, 15597808, 9, 18743296, 15663103,
-590059, 0, 4294902047, 15532268, 9, 18874368, 15597567, 590063,
-0, 4294902049, 15794415, 9, 19005440, 15859711, 590036, 0,
-4294902051, 16056564, 13, 19136512, 16122149, 852212, 0, 19333414,
-16122103, 13, 19398656, 16253225, 65785, 0, 4294902058, 16253178,
-1, 19595264, 16515071, 65788, 0, 4294902060, 16580860, 1,
-19726336, 16646143, 65790, 0, 4294902062, 16711934, 1, 19857408,
-16842751, 65793, 0, 4294902064, 16056571, 4, 19988480, 16515378,
-262388, 0, 20185395, 16122109, 4, 20250624, 16646454, 262391,
-0, 20447543, 16318719, 4, 20512768, 16777530, 262392, 0,
-20709691, 16384257, 4, 20774912, 16908606, 852227, 0, 20971839,
-17039619, 13, 21037056, 17039682, 852229, 0, 21233987, 17236230,
-9, 21299200, 17301503, 590088, 0, 4294902086, 17432841, 1,
-21430272, 17563647, 65804, 0, 4294902088, 17629452, 1, 21561344,
-17694719, 65806, 0, 4294902090, 17760526, 1, 21692416, 17367039,
-262409, 0, 21823820, 17432839, 4, 21889024, 17170767, 262411,
-0, 22085968, 17563909, 4, 22151168, 17039699, 262413, 0,
-22348116, 17694979, 4, 22413312, 16908631, 262415, 0, 22610264,
-17891600, 1, 22675456, 18022399, 65811, 0, 4294902107, 18088209,
-17, 22806528, 18219007, 1114386, 0, 4294902109, 18219283, 17,
-22937600, 18350079, 1114384, 0, 4294902111, 18088215, 29, 23068672,
-18153825, 1900822, 0, 23265634, 18415896, 29, 23330816, 18481509,
-65819, 0, 4294902118, 18678044, 17, 23527424, 18743295, 65817,
-0, 4294902120, 18743576, 1, 23658496, 18808831, 1114394, 0,
-4294902122, 18809083, 12, 23789568, 18547052, 65820, 0, 4294902125,
-18940192, 5767180, 23986180, 19005807, 786723, 262232, 24183152, 19005732,
-1, 24248320, 19267583, 262438, 1, 24379763, 19267879, 17,
-24444928, 19267583, 1114408, 0, 4294902134, 19464199, 1, 24576000,
-19595263, 65835, 0, 4294902136, 7929969, 1, 24707072, 19660799,
-65650, 0, 4294902138, 13435180, 1, 24838144, 12517375, 262444,
-0, 24969596, 19792173, 1, 25034752, 19922943, 65840, 0,
-4294902143, 19857713, 1, 25165824, 19857407, 65842, 0, 4294902145,
-20119758, 1, 25296896, 20185087, 262335, 0, 25428355, 19988788,
-1, 25493504, 20316159, 65846, 0, 4294902150, 20382002, 1,
-25624576, 20512767, 262457, 65624, 25756040, 20578617, 1, 25821184,
-20643839, 65851, 0, 4294902155, 524604, 1, 25952256, 20512767,
-786747, 65598, 26083725, 20775209, 1, 26148864, 20840447, 262460,
-65624, 26280336, 20840760, 1, 26345472, 20905983, 65855, 0,
-4294902163, 20513087, 1, 26476544, 131071, 65856, 0, 4294902165,
-21037376, 17, 26607616, 21102591, 65858, 0, 4294902167, 21168450,
-17, 26738688, 21233663, 65541, 0, 4294902169, 21168448, 4,
-26869760, 19333531, 262440, 1, 27066780, 21299524, 65540, 27131904,
-21365151, 1114437, 0, 4294902176, 21430596, 17, 27328512, 21430271,
-262471, 1, 27460002, 21496072, 1, 27525120, 21626879, 65866,
-0, 4294902181, 21692746, 1, 27656192, 8912895, 393548, 0,
-27787687, 1048908, 6, 27852800, 1114538, 393549, 0, 28049835,
-8323405, 6, 28114944, 21889454, 65852, 0, 4294902191, 21889339,
-1, 28311552, 20840447, 65871, 0, 4294902193, 20447567, 1,
-28442624, 917503, 786435, 0, 28574131, 22020238, 1, 28639232,
-22151167, 65538, 0, 4294902198, 22085928, 1, 28770304, 22085631,
-65831, 0, 4294902200, 196946, 1, 28901376, 917503, 65875,
-0, 4294902202, 21365075, 17, 29032448, 21495807, 1114450, 0,
-4294902204, 22282422, 1, 29163520, 11927551, 65877, 0, 4294902206,
-11600213, 1, 29294592, 1048575, 65878, 0, 4294902208, 19136854,
-1, 29425664, 22347775, 65879, 0, 4294902210, 11010391, 1,
-29556736, 11206655, 196773, 0, 4294902212, 22610264, 1, 29687808,
-22675455, 262435, 0, 29819334, 22741338, 4063236, 29884420, 22806985,
-65885, 0, 4294902218, 22937949, 1, 30081024, 23003135, 65825,
-0, 4294902220, 23003481, 1, 30212096, 23134207, 65827, 0,
-4294902222, 23069019, 1, 30343168, 23068671, 65882, 0, 4294902224,
-22544737, 1, 30474240, 19070975, 65889, 0, 4294902226, 23200035,
-1, 30605312, 23265279, 65716, 0, 4294902228, 22806816, 1,
-30736384, 22740991, 65891, 0, 4294902230, 18874723, 1, 30867456,
-23396351, 65883, 0, 4294902232, 23331105, 1, 30998528, 8847359,
-196965, 0, 4294902234, 11731301, 65574, 31129600, 23396828, 1245542,
-0, 4294902237, 11731303, 19, 31326208, 23658495, 1245545, 0,
-4294902239, 23724393, 19, 31457280, 23855103, 1245548, 0, 4294902241,
-23921004, 19, 31588352, 23986175, 1245550, 0, 4294902243, 23462247,
-65542, 31719424, 24052197, 393584, 0, 31916518, 24183146, 11,
-31981568, 24248319, 1245554, 327783, 4294902249, 23789938, 11, 32112640,
-24248319, 393587, 0, 32244203, 24379763, 6, 32309248, 24379886,
-393589, 0, 32506351, 24510837, 6, 32571392, 24510962, 393586,
-0, 32768499, 23593335, 19, 32833536, 24051711, 1245560, 0,
-4294902262, 23527800, 19, 32964608, 23527423, 1245559, 0, 4294902264,
-24576376, 14, 33095680, 23724538, 393593, 0, 33292795, 24052089,
-6, 33357824, 24117758, 393594, 0, 33554943, 23789946, 6,
-33619968, 24510978, 393594, 0, 33817091, 24314233, 6, 33882112,
-24838662, 65688, 0, 4294902279, 24903844, 1, 34078720, 24969215,
-65548, 0, 4294902281, 24838155, 1, 34209792, 25034751, 196990,
-0, 4294902283, 25100670, 3, 34340864, 25165823, 196992, 0,
-4294902285, 25231744, 3, 34471936, 25296895, 196994, 0, 4294902287,
-25362818, 3, 34603008, 25427967, 196996, 0, 4294902289, 24969604,
-3, 34734080, 25559039, 196998, 0, 4294902291, 25624966, 3,
-34865152, 25690111, 197000, 0, 4294902293, 25756040, 3, 34996224,
-25821183, 197002, 0, 4294902295, 25887114, 3, 35127296, 25952255,
-197004, 0, 4294902297, 25493900, 3, 35258368, 26083327, 262542,
-0, 35389979, 26083727, 1, 35454976, 18874367, 65935, 0,
-4294902302, 26214797, 1, 35586048, 26279935, 65787, 0, 4294902304,
-26345873, 1, 35717120, 26476543, 65940, 0, 4294902306, 26542325,
-13, 35848192, 26542628, 65942, 0, 4294902309, 26542482, 1,
-36044800, 26738687, 65937, 0, 4294902311, 26739094, 1, 36175872,
-26804223, 852255, 0, 36307497, 26673561, 29, 36372480, 26739244,
-65943, 0, 4294902317, 18809241, 1, 36569088, 26935295, 65947,
-0, 4294902319, 26411255, 1, 36700160, 26411007, 1900947, 0,
-36831793, 27001089, 1, 36896768, 27066367, 65813, 0, 4294902324,
-27066644, 1, 37027840, 27131903, 65801, 0, 4294902326, 16384414,
-1, 37158912, 27262975, 65950, 0, 4294902328, 27263304, 1,
-37289984, 27328511, 1900961, 0, 37421626, 27394465, 1, 37486592,
-27459583, 1900963, 0, 37618237, 27525539, 1, 37683200, 27590655,
-1900959, 0, 37814848, 27656613, 29, 37879808, 27722307, 1900968,
-0, 38076996, 27918761, 29, 38141952, 27263559, 65962, 0,
-4294902344, 27197861, 1, 38338560, 27590655, 65958, 0, 4294902346,
-27460007, 1, 38469632, 27459583, 65960, 0, 4294902348, 27328937,
-1, 38600704, 26542079, 65957, 0, 4294902350, 27984298, 1,
-38731776, 27721727, 65964, 0, 4294902352, 27722156, 1, 38862848,
-27852799, 65965, 0, 4294902354, 27853229, 1, 38993920, 18481151,
-65966, 0, 4294902356, 18284974, 1, 39124992, 18284543, 65967,
-0, 4294902358, 18350511, 1, 39256064, 28049407, 65968, 0,
-4294902360, 17105328, 1, 39387136, 28377087, 1900977, 0, 39518810,
-28508594, 9, 39583744, 28573695, 852226, 0, 39715421, 28377523,
-1, 39780352, 28442623, 65972, 0, 4294902368, 28705205, 28,
-39911424, 28770914, 65976, 0, 4294902371, 28705208, 1, 40108032,
-28901375, 1835449, 0, 40239717, 28901813, 1, 40304640, 28770303,
-65978, 0, 4294902376, 29032890, 1, 40435712, 29097983, 65865,
-0, 4294902378, 28443068, 36, 40566784, 29098604, 65981, 0,
-4294902381, 28639677, 1, 40763392, 28966911, 590268, 0, 4294902383,
-17760695, 12, 40894464, 29229681, 3408317, 31, 41091698, 29229492,
-1, 41156608, 29294591, 65970, 0, 4294902389, 29163967, 20,
-41287680, 29229687, 1311168, 0, 41484920, 29426112, 20, 41549824,
-29491835, 1311167, 0, 41747068, 29491649, 4, 41811968, 29360767,
-262591, 0, 42009216, 29557179, 4, 42074112, 29557379, 262596,
-0, 42271364, 29688260, 4, 42336256, 29753991, 197063, 0,
-4294902408, 29884871, 3, 42532864, 29949951, 197065, 0, 4294902410,
-30015945, 3, 42663936, 30081023, 197067, 0, 4294902412, 30147019,
-3, 42795008, 30212095, 197069, 0, 4294902414, 29753805, 3,
-42926080, 21757951, 65998, 0, 4294902416, 30343630, 1, 43057152,
-30474239, 1114577, 0, 4294902418, 30605778, 1, 43188224, 10616831,
-66004, 0, 4294902420, 30802389, 17, 43319296, 14417919, 66007,
-0, 4294902422, 2163159, 17, 43450368, 30670847, 1114584, 0,
-4294902424, 14418392, 1, 43581440, 30474239, 262614, 28, 43713178,
-30474709, 1835012, 43778048, 30605981, 2490401, 0, 43975326, 30933463,
-2031620, 44040192, 30999201, 66010, 0, 4294902434, 31130074, 1,
-44236800, 31260671, 66009, 0, 4294902436, 31195289, 1, 44367872,
-31195135, 65699, 0, 4294902438, 30736852, 1, 44498944, 30539775,
-66002, 0, 4294902440, 31260794, 1, 44630016, 31326207, 66014,
-0, 4294902442, 31392222, 1, 44761088, 31457279, 65659, 0,
-4294902444, 31457369, 1, 44892160, 31522815, 65573, 0, 4294902446,
-31588833, 1, 45023232, 31653887, 66019, 0, 4294902448, 3146211,
-1, 45154304, 31653887, 786469, 0, 45286066, 31654368, 12,
-45350912, 4784821, 66020, 0, 4294902454, 1704420, 1, 45547520,
-6553599, 66021, 0, 4294902456, 6554085, 1, 45678592, 31850495,
-786916, 0, 45810362, 6553673, 12, 45875200, 3343037, 66022,
-0, 4294902462, 31916518, 1, 46071808, 31981567, 66017, 0,
-4294902464, 31981604, 1, 46202880, 32047103, 65602, 0, 4294902466,
-31916520, 12, 46333952, 31851204, 786498, 0, 46531269, 32047210,
-1, 46596096, 32112639, 66026, 0, 4294902472, 6816234, 1,
-46727168, 6029311, 786922, 0, 46858954, 6029801, 12, 46923776,
-32178893, 66028, 0, 4294902478, 32309740, 1, 47120384, 32374783,
-66030, 0, 4294902480, 32178670, 1, 47251456, 5505023, 65672,
-0, 4294902482, 5505160, 3014756, 47382534, 3474132, 66031, 0,
-4294902485, 32506351, 37, 47579136, 32506583, 65594, 0, 4294902488,
-32571887, 1, 47775744, 32636927, 66034, 0, 4294902490, 32506354,
-1, 47906816, 3473407, 4980822, 0, 48038620, 32702601, 17,
-48103424, 32767999, 66036, 0, 4294902495, 32702604, 65572, 48234496,
-32834273, 66038, 0, 4294902498, 9372150, 1, 48431104, 33030143,
-65566, 0, 4294902500, 32965112, 1, 48562176, 33161215, 66040,
-0, 4294902502, 33227258, 1, 48693248, 33357823, 66041, 0,
-4294902504, 33292797, 1, 48824320, 33292287, 66045, 0, 4294902506,
-33489406, 4, 48955392, 33489644, 66042, 0, 4294902509, 33423407,
-1, 49152000, 14024703, 590021, 0, 4294902511, 33554933, 12,
-49283072, 32768753, 262287, 0, 49480434, 14024901, 4, 49545216,
-33620725, 1114329, 0, 4294902518, 33685702, 9, 49741824, 33751039,
-1901059, 0, 49873656, 33817091, 9, 49938432, 33882111, 1901061,
-0, 50070267, 33948165, 589841, 50135048, 34013183, 590343, 0,
-4294902526, 34079239, 28, 50266112, 34079488, 590345, 0, 4294902529,
-34275850, 29, 50462720, 34341635, 1901069, 0, 50660100, 34537998,
-29, 50724864, 34603783, 590350, 0, 4294902536, 34669071, 9,
-50921472, 34734079, 590348, 0, 4294902538, 34210317, 9, 51052544,
-34340863, 590354, 0, 4294902540, 34800146, 9, 51183616, 34865151,
-590356, 0, 4294902542, 34931220, 9, 51314688, 34996223, 590358,
-0, 4294902544, 35062294, 9, 51445760, 35127295, 590360, 0,
-4294902546, 34603544, 9, 51576832, 33751039, 590347, 0, 4294902548,
-33751562, 9, 51707904, 33882111, 590349, 0, 4294902550, 33882636,
-9, 51838976, 34078719, 590351, 0, 4294902552, 34079246, 9,
-51970048, 34865151, 9175577, 0, 52101914, 35062297, 140, 52166656,
-35259165, 1114625, 0, 4294902558, 12976666, 28, 52363264, 35324704,
-262684, 0, 52560673, 35455516, 4, 52625408, 35455780, 262686,
-0, 52822821, 35324446, 4, 52887552, 35586856, 262688, 0,
-53084969, 35717664, 4, 53149696, 35717932, 262690, 0, 53347117,
-35848738, 4, 53411840, 35849008, 262692, 0, 53609265, 35979812,
-4, 53673984, 35980084, 262694, 0, 53871413, 35586598, 4,
-53936128, 33882936, 1835559, 0, 54133561, 34013735, 28, 54198272,
-29688636, 262696, 0, 54395709, 30343720, 4, 54460416, 30344000,
-65946, 0, 4294902593, 36307497, 1, 54657024, 36372479, 66091,
-0, 4294902595, 36438571, 1, 54788096, 36503551, 66093, 0,
-4294902597, 36569645, 1, 54919168, 36634623, 66095, 0, 4294902599,
-36700719, 1, 55050240, 36765695, 66097, 0, 4294902601, 36241969,
-28, 55181312, 36832075, 262707, 0, 55378764, 36962867, 4,
-55443456, 36963151, 262709, 0, 55640912, 36831797, 4, 55705600,
-37094227, 66103, 0, 4294902612, 37225015, 6750225, 55902215, 37289983,
-66105, 0, 4294902614, 37093945, 1, 56033280, 37224447, 787002,
-0, 56165208, 37421626, 12, 56229888, 37421915, 787000, 0,
-56427356, 10093116, 1, 56492032, 36831231, 66108, 0, 4294902623,
-37552290, 1, 56623104, 37617663, 66089, 0, 4294902625, 37617872,
-1, 56754176, 37683199, 66111, 0, 4294902627, 37814848, 1,
-56885248, 37945343, 65743, 0, 4294902629, 37880382, 4, 57016320,
-37684071, 262723, 0, 57213800, 38011456, 12, 57278464, 37815147,
-262725, 0, 57475948, 38208070, 12, 57540608, 38208367, 66117,
-0, 4294902640, 38011461, 1, 57737216, 38076415, 66115, 0,
-4294902642, 37880387, 1, 57868288, 38338559, 787017, 0, 58000244,
-38404680, 1, 58064896, 38469631, 66123, 655422, 4294902647, 38601292,
-1, 58195968, 38731775, 66127, 0, 4294902649, 38863440, 1,
-58327040, 34209791, 590418, 0, 4294902651, 38994514, 28, 58458112,
-38994813, 590362, 0, 4294902654, 39125588, 29, 58654720, 39191424,
-66132, 0, 4294902657, 38535765, 1, 58851328, 38993919, 66133,
-0, 4294902659, 38994516, 1, 58982400, 38797311, 787031, 0,
-59114373, 38339159, 1, 59179008, 39387135, 66137, 0, 4294902664,
-39453261, 1, 59310080, 39256063, 262746, 655448, 59442058, 38666824,
-5767348, 59506698, 37684109, 66139, 0, 4294902670, 37749339, 1,
-59703296, 39518207, 66140, 0, 4294902672, 38666844, 1, 59834368,
-38797311, 66141, 0, 4294902674, 39715421, 1, 59965440, 39845887,
-65732, 0, 4294902676, 39846083, 1, 60096512, 39911423, 262751,
-720984, 60228502, 39911617, 1, 60293120, 39976959, 65731, 0,
-4294902681, 39977156, 1, 60424192, 40042495, 65724, 0, 4294902683,
-39977569, 5767172, 60555275, 2229149, 66147, 0, 4294902686, 10355300,
-1, 60751872, 13631487, 66148, 0, 4294902688, 13632099, 1,
-60882944, 39452671, 1835621, 0, 61014946, 39780966, 1, 61079552,
-39911423, 66151, 0, 4294902693, 40436328, 65572, 61210624, 40436647,
-66150, 0, 4294902696, 40567402, 65572, 61407232, 40502186, 1114729,
-0, 4294902699, 40567400, 17, 61603840, 40632319, 590444, 0,
-4294902701, 40501869, 9, 61734912, 40697855, 590446, 0, 4294902703,
-40698479, 9, 61865984, 40828927, 590448, 0, 4294902705, 40960624,
-9, 61997056, 41025535, 590450, 0, 4294902707, 41157235, 9,
-62128128, 41222143, 590447, 0, 4294902709, 41222770, 9, 62259200,
-41287679, 590454, 0, 4294902711, 41419383, 9, 62390272, 41484287,
-590451, 0, 4294902713, 41484918, 9, 62521344, 41615359, 590455,
-0, 4294902715, 41550459, 9, 62652416, 41549823, 590460, 0,
-4294902717, 40632941, 4, 62783488, 40829887, 262766, 0, 62981056,
-40895087, 4, 63045632, 41157571, 262769, 0, 63243204, 41026163,
-4, 63307776, 41419719, 262773, 0, 63505352, 41288311, 4,
-63569920, 41550795, 262777, 0, 63767500, 41681531, 4, 63832064,
-41681871, 590461, 0, 4294902736, 13042301, 17, 64028672, 12386303,
-1114750, 0, 4294902738, 41615998, 9, 64159744, 13107199, 262332,
-0, 64291796, 40370363, 1, 64356352, 40370175, 66175, 0,
-4294902743, 12714623, 1, 64487424, 19988479, 66176, 0, 4294902745,
-19726977, 1, 64618496, 12517375, 1114753, 0, 4294902747, 19661440,
-17, 64749568, 42008575, 262785, 0, 64881629, 42074422, 1,
-64946176, 42205183, 65844, 0, 4294902752, 42139955, 17, 65077248,
-42139647, 1114303, 0, 4294902754, 42140290, 4, 65208320, 13435876,
-262350, 786535, 65405925, 38273668, 1, 65470464, 38404095, 66181,
-0, 4294902760, 20382005, 4, 65601536, 42337258, 66183, 0,
-4294902763, 42533512, 1, 65798144, 42598399, 66186, 0, 4294902765,
-42730123, 1, 65929216, 42860543, 66190, 0, 4294902767, 42926734,
-1, 66060288, 43057151, 66189, 0, 4294902769, 43057802, 1,
-66191360, 43122687, 66194, 0, 4294902771, 43188882, 1, 66322432,
-43319295, 66197, 0, 4294902773, 42992277, 1, 66453504, 43450367,
-66196, 0, 4294902775, 43451027, 1, 66584576, 43581439, 66201,
-0, 4294902777, 43647641, 29, 66715648, 43647995, 66203, 0,
-4294902780, 43778715, 29, 66912256, 43779070, 66205, 0, 4294902783,
-43909789, 29, 67108864, 43975681, 1901216, 0, 67306498, 44106400,
-1, 67371008, 44171263, 1901218, 0, 67503109, 44237474, 1,
-67567616, 44302335, 1901220, 0, 67699720, 44303013, 1, 67764224,
-44302335, 66214, 0, 4294902795, 44171943, 1, 67895296, 44171263,
-66216, 0, 4294902797, 44630687, 1, 68026368, 44761087, 66206,
-0, 4294902799, 44761757, 1, 68157440, 44892159, 66204, 0,
-4294902801, 44892827, 1, 68288512, 45023231, 66202, 0, 4294902803,
-45023897, 1, 68419584, 44957695, 66222, 0, 4294902805, 45023918,
-29, 68550656, 44827671, 1901229, 0, 68748312, 44827307, 1,
-68812800, 44564479, 1901224, 0, 68944923, 44499622, 1, 69009408,
-44433407, 1901222, 0, 69141534, 44368560, 1, 69206016, 45219839,
-66224, 0, 4294902817, 45220520, 1, 69337088, 45285375, 66208,
-0, 4294902819, 44630706, 29, 69468160, 44631077, 66218, 0,
-4294902822, 44761770, 29, 69664768, 45024296, 66227, 0, 4294902825,
-45351603, 1, 69861376, 45416447, 66229, 0, 4294902827, 45482677,
-1, 69992448, 45547519, 66231, 0, 4294902829, 45613751, 1,
-70123520, 45678591, 66233, 0, 4294902831, 45744825, 1, 70254592,
-45809663, 66235, 0, 4294902833, 45875899, 1, 70385664, 45940735,
-66225, 0, 4294902835, 45941412, 1, 70516736, 46071807, 66239,
-0, 4294902837, 42402443, 4, 70647808, 42927159, 262792, 0,
-70845496, 42533518, 4, 70909952, 42796091, 262794, 0, 71107644,
-43057808, 4, 71172096, 43320383, 262802, 0, 71369792, 43188884,
-4, 71434240, 43385923, 787095, 0, 71631940, 43516605, 12,
-71696384, 46138439, 66241, 0, 4294902856, 46006977, 65540, 71892992,
-46072906, 66242, 0, 4294902859, 43385538, 1, 72089600, 43515903,
-66243, 0, 4294902861, 46138051, 1, 72220672, 46465023, 65845,
-0, 4294902863, 46465335, 1, 72351744, 46596095, 1114814, 0,
-4294902865, 46531261, 1, 72482816, 46268415, 1114823, 0, 4294902867,
-43516615, 1, 72613888, 46596095, 262855, 1, 72746069, 46662326,
-140, 72810496, 46728280, 9175740, 0, 73008217, 46727880, 140,
-73072640, 46793820, 787147, 852056, 73270365, 46990028, 5767180, 73334797,
-46990432, 787146, 852056, 73532513, 47055563, 1, 73596928, 47120383,
-1114831, 11, 4294902884, 46924495, 1, 73728000, 47251455, 66207,
-0, 4294902886, 47186636, 1, 73859072, 43974655, 66257, 0,
-4294902888, 46858961, 1, 73990144, 17498111, 66258, 0, 4294902890,
-17498834, 1, 74121216, 16777215, 66259, 0, 4294902892, 16777939,
-1, 74252288, 38535167, 66260, 0, 4294902894, 39191252, 1,
-74383360, 3735551, 4456529, 0, 74515568, 5832756, 68, 74579968,
-15860851, 2359523, 1, 74777716, 47513842, 17, 74842112, 47644671,
-1114339, 0, 4294902903, 47645397, 9, 74973184, 47710207, 590552,
-0, 4294902905, 47579864, 9, 75104256, 47644671, 262869, 1,
-75236475, 47775864, 1, 75300864, 47906815, 65834, 0, 4294902910,
-47973083, 65540, 75431936, 48039040, 2360030, 1, 75629697, 48038617,
-1, 75694080, 48168959, 66266, 0, 4294902916, 48104155, 17,
-75825152, 48103423, 1114844, 0, 4294902918, 48235231, 1, 75956224,
-48300031, 66273, 0, 4294902920, 48169698, 1, 76087296, 48037887,
-66274, 0, 4294902922, 47907553, 1, 76218368, 14942207, 66275,
-0, 4294902924, 14811875, 9, 76349440, 39452671, 1835748, 0,
-76481678, 12059364, 28, 76546048, 48563345, 1835750, 0, 76743826,
-12714726, 28, 76808192, 12256405, 1835751, 0, 77005974, 48759527,
-28, 77070336, 48759961, 1835753, 0, 77268122, 48890601, 28,
-77332480, 48891037, 1835755, 0, 77530270, 48956005, 28, 77594624,
-38667425, 2359883, 655422, 77792418, 49021529, 1, 77856768, 49086463,
-66135, 0, 4294902949, 49086934, 1, 77987840, 49151999, 65554,
-0, 4294902951, 49152009, 1, 78118912, 49217535, 66000, 0,
-4294902953, 48562302, 1, 78249984, 48627711, 65720, 0, 4294902955,
-49217730, 1, 78381056, 49283071, 65661, 0, 4294902957, 49283257,
-1, 78512128, 49348607, 66289, 0, 4294902959, 39322353, 1,
-78643200, 38928383, 66290, 0, 4294902961, 12190450, 1, 78774272,
-49545215, 787188, 0, 78906547, 49611508, 12, 78970880, 49611958,
-787190, 0, 79168695, 49480438, 12, 79233024, 46924986, 787147,
-852030, 79430843, 26018551, 1, 79495168, 49872895, 66295, 0,
-4294902974, 49808121, 1, 79626240, 50003967, 66297, 0, 4294902976,
-49939195, 1, 79757312, 26148863, 66300, 0, 4294902978, 50135804,
-1, 79888384, 50200575, 66302, 0, 4294902980, 50266878, 1,
-80019456, 50331647, 66304, 0, 4294902982, 50070263, 4, 80150528,
-49808584, 262909, 0, 80348361, 50201337, 4, 80412672, 49939660,
-262911, 0, 80610509, 50332411, 12, 80674816, 26936528, 65945,
-0, 4294902993, 50463489, 4, 80871424, 50529491, 66306, 0,
-4294902996, 50528527, 1, 81068032, 50462719, 66308, 0, 4294902998,
-28771076, 1, 81199104, 50724863, 66305, 0, 4294903000, 50660102,
-1, 81330176, 50855935, 66310, 0, 4294903002, 50791176, 1,
-81461248, 50987007, 66312, 0, 4294903004, 50987778, 1, 81592320,
-51052543, 66315, 0, 4294903006, 51118859, 1, 81723392, 51183615,
-66317, 0, 4294903008, 51249933, 1, 81854464, 50724863, 262922,
-0, 81986786, 51053318, 4, 82051072, 50791653, 262924, 0,
-82248934, 51184392, 4, 82313216, 50922729, 787214, 0, 82511082,
-51315456, 1, 82575360, 51380223, 65829, 0, 4294903021, 51380518,
-1, 82706432, 51445759, 66299, 0, 4294903023, 51446542, 1,
-82837504, 51511295, 65860, 0, 4294903025, 51511621, 1, 82968576,
-51576831, 66313, 0, 4294903027, 51577081, 1, 83099648, 51642367,
-65783, 0, 4294903029, 17171220, 9, 83230720, 17170431, 590612,
-0, 4294903031, 51708486, 1, 83361792, 51773439, 66326, 0,
-4294903033, 51839766, 1, 83492864, 51904511, 66328, 0, 4294903035,
-52036377, 1, 83623936, 52101119, 66331, 0, 4294903037, 52167451,
-1, 83755008, 52232191, 66119, 0, 4294903039, 52232984, 1,
-83886080, 52297727, 66180, 0, 4294903041, 52298373, 1, 84017152,
-52363263, 66329, 0, 4294903043, 52167445, 4, 84148224, 51774725,
-262939, 0, 84346118, 52036375, 4, 84410368, 51905801, 262937,
-0, 84608266, 52298525, 4, 84672512, 42206477, 262789, 0,
-84870414, 52363841, 1, 84934656, 52428799, 66118, 0, 4294903057,
-38798112, 1, 85065728, 52559871, 66336, 0, 4294903059, 52495083,
-1, 85196800, 39780351, 66283, 0, 4294903061, 52560093, 9,
-85327872, 52625407, 590325, 0, 4294903063, 9830912, 9, 85458944,
-32833535, 66339, 0, 4294903065, 33555235, 1, 85590016, 2162687,
-66340, 0, 4294903067, 33489700, 1, 85721088, 33488895, 66341,
-0, 4294903069, 2032421, 1, 85852160, 42795007, 66342, 0,
-4294903071, 46400294, 1, 85983232, 46530559, 66343, 0, 4294903073,
-42337063, 1, 86114304, 42467327, 66344, 0, 4294903075, 42468136,
-1, 86245376, 42991615, 66345, 0, 4294903077, 42664745, 1,
-86376448, 15466495, 590634, 0, 4294903079, 15270698, 9, 86507520,
-15269887, 590635, 0, 4294903081, 15336235, 9, 86638592, 65535};
-extern const uint32_t e1m1_WADSideDefs[9923] = {
-0, 45, 0, 45, 0, 1380013139, 843989332, 38,
-2949120, 0, 2949120, 0, 1414725632, 1096045121, 2503246, 0,
-45, 0, 45, 0, 1380013139, 843989332, 24, 2949120,
-0, 2949120, 0, 1414725632, 1096045121, 2503246, 0, 45,
-0, 45, 0, 1380013139, 843989332, 38, 2949120, 0,
-2949120, 0, 1414725632, 1096045121, 2503246, 0, 45, 0,
-45, 0, 1380013139, 843989332, 24, 2949120, 0, 2949120,
-0, 1414725632, 1096045121, 1585742, 16, 45, 0, 45,
-0, 1380013139, 843989332, 103, 1329790976, 1414877261, 2961989, 0,
-2949120, 0, 6553600, 0, 1414742337, 1498107465, 1414742337, 1498107465,
-45, 0, 38, 2949120, 0, 2949120, 0, 1414725632,
-1096045121, 1585742, 80, 45, 0, 45, 0, 1380013139,
-843989332, 94, 2949120, 0, 2949120, 0, 1414725632, 860312129,
-5439488, 0, 45, 0, 45, 0, 1380013139, 13127,
-83, 2949120, 0, 2949120, 0, 1414725632, 1096045121, 6173262,
-0, 45, 0, 45, 0, 1380013139, 13127, 83,
-2949120, 0, 2949120, 0, 1414725632, 860312129, 5505024, 0,
-45, 0, 45, 0, 1380013139, 13127, 84, 2949120,
-0, 2949120, 0, 1414725632, 860312129, 6422528, 0, 45,
-0, 45, 0, 1380013139, 843989332, 36, 2949120, 0,
-2949120, 0, 1414725632, 860312129, 9502720, 0, 45, 0,
-45, 0, 1380013139, 13127, 83, 2949120, 0, 2949120,
-0, 1414725632, 860312129, 5505024, 0, 45, 0, 45,
-0, 1380013139, 13127, 84, 2949120, 0, 2949120, 0,
-1414725632, 860312129, 5505024, 0, 45, 0, 45, 0,
-1380013139, 13127, 84, 2949120, 0, 2949120, 0, 1414725632,
-860312129, 5505024, 0, 45, 0, 45, 0, 1380013139,
-13127, 84, 2949120, 0, 2949120, 0, 1414725632, 860312129,
-5505024, 0, 45, 0, 45, 0, 1380013139, 13127,
-84, 2949120, 0, 2949120, 0, 1329790976, 1096044621, 5721164,
-0, 45, 0, 45, 0, 1347243843, 1280065876, 87,
-2949120, 0, 2949120, 0, 1329790976, 1096044621, 12012620, 192,
-45, 0, 45, 0, 1347243843, 1280065876, 87, 2949120,
-0, 2949120, 0, 1329790976, 1096044621, 9718860, 192, 45,
-0, 45, 0, 1347243843, 1280065876, 183, 2949120, 0,
-2949120, 0, 1329790976, 1096044621, 12012620, 0, 45, 0,
-45, 0, 1347243843, 1280065876, 87, 2949120, 0, 2949120,
-0, 1329790976, 1096044621, 5721164, 0, 45, 0, 45,
-0, 1347243843, 1280065876, 12582999, 2949120, 0, 2949120, 0,
-1329790976, 1096044621, 5721164, 0, 45, 0, 45, 0,
-1347243843, 1280065876, 87, 2949120, 0, 2949120, 0, 1329790976,
-1096044621, 5721164, 0, 45, 0, 45, 0, 1347243843,
-1280065876, 87, 2949120, 0, 2949120, 0, 1329790976, 1096044621,
-5721164, 0, 45, 0, 45, 0, 1347243843, 1280065876,
-87, 2949120, 0, 2949120, 0, 1329790976, 1096044621, 5721164,
-0, 45, 0, 45, 0, 1347243843, 1280065876, 87,
-2949120, 0, 2949120, 0, 1329790976, 1096044621, 5721164, 0,
-45, 0, 45, 0, 1347243843, 1280065876, 87, 2949120,
-0, 2949120, 0, 1329790976, 1096044621, 5721164, 0, 45,
-0, 45, 0, 1347243843, 1280065876, 87, 2949120, 0,
-2949120, 0, 1329790976, 1096044621, 5721164, 0, 45, 0,
-45, 0, 1347243843, 1280065876, 12582999, 2949120, 0, 2949120,
-0, 1329790976, 1096044621, 5721164, 0, 45, 0, 45,
-0, 1347243843, 1280065876, 87, 2949120, 0, 2949120, 0,
-1329790976, 1096044621, 5721164, 0, 45, 0, 45, 0,
-1347243843, 1280065876, 12582999, 2949120, 0, 2949120, 0, 1329790976,
-1096044621, 5721164, 0, 45, 0, 45, 0, 1347243843,
-1280065876, 148, 2949120, 0, 2949120, 0, 1329790976, 1096044621,
-12012620, 0, 45, 0, 45, 0, 1347243843, 1280065876,
-183, 2949120, 0, 2949120, 0, 1329790976, 1096044621, 12012620,
-192, 45, 0, 45, 0, 1347243843, 1280065876, 146,
-2949120, 0, 2949120, 0, 1329790976, 1096044621, 9587788, 0,
-45, 0, 45, 0, 1347243843, 1280065876, 146, 2949120,
-0, 2949120, 0, 1414725632, 860312129, 5767168, 0, 45,
-0, 45, 0, 1380013139, 13127, 524376, 2949120, 0,
-2949120, 0, 1431502848, 1380929616, 5976660, 0, 45, 0,
-45, 0, 1347243843, 1280065876, 87, 2949120, 0, 2949120,
-0, 1329790976, 1096044621, 5721164, 0, 45, 0, 45,
-0, 1347243843, 1280065876, 87, 2949120, 0, 2949120, 0,
-1329790976, 1096044621, 5721164, 0, 45, 0, 45, 0,
-1347243843, 1280065876, 87, 2949120, 0, 2949120, 0, 1414725632,
-860312129, 5439488, 192, 45, 0, 45, 0, 1347243843,
-1280065876, 87, 2949120, 0, 2949120, 0, 1329790976, 1096044621,
-5721164, 0, 45, 0, 45, 0, 1347243843, 1280065876,
-87, 2949120, 0, 2949120, 0, 1414725632, 860312129, 5767168,
-0, 45, 0, 45, 0, 1347243843, 1280065876, 12582999,
-2949120, 0, 2949120, 0, 1329790976, 1096044621, 5721164, 0,
-45, 0, 45, 0, 1347243843, 1280065876, 87, 2949120,
-0, 2949120, 0, 1329790976, 1096044621, 5721164, 0, 45,
-0, 45, 0, 1347243843, 1280065876, 87, 2949120, 0,
-2949120, 0, 1329790976, 1096044621, 5721164, 0, 45, 0,
-45, 0, 1347243843, 1280065876, 87, 2949120, 0, 2949120,
-0, 1329790976, 1096044621, 5721164, 0, 45, 0, 45,
-0, 1347243843, 1280065876, 87, 2949120, 0, 2949120, 0,
-1329790976, 1096044621, 5721164, 192, 45, 0, 45, 0,
-1347243843, 1280065876, 87, 2949120, 0, 2949120, 0, 1329790976,
-1096044621, 5721164, 192, 45, 0, 45, 0, 1347243843,
-1280065876, 87, 2949120, 0, 2949120, 0, 1329790976, 1096044621,
-5721164, 0, 45, 0, 45, 0, 1347243843, 1280065876,
-12582999, 2949120, 0, 2949120, 0, 1329790976, 1096044621, 5721164,
-0, 45, 0, 45, 0, 1347243843, 1280065876, 87,
-2949120, 0, 2949120, 0, 1329790976, 1096044621, 5721164, 0,
-1380013139, 13127, 1346720851, 54, 45, 0, 83, 1414725632,
-4542031, 2949120, 0, 2949120, 0, 6094848, 0, 45,
-0, 45, 0, 1145130067, 1280065879, 144, 1329790976, 1414877261,
-2961989, 0, 2949120, 0, 6553600, 0, 1414742337, 1498107465,
-1414742337, 1498107465, 45, 0, 38, 2949120, 0, 2949120,
-0, 1414725632, 1096045121, 6566478, 96, 45, 0, 45,
-0, 1380013139, 843989332, 7864421, 2949120, 0, 2949120, 0,
-1414725632, 1096045121, 6697550, 104, 45, 0, 45, 0,
-1380013139, 843989332, 102, 2949120, 0, 2949120, 0, 1414725632,
-1096045121, 6632014, 24, 45, 0, 45, 0, 1380013139,
-843989332, 100, 1329790976, 1414877261, 2961989, 0, 2949120, 0,
-6553600, 0, 1414742337, 1498107465, 1414742337, 1498107465, 45, 0,
-38, 2949128, 0, 2949120, 0, 1280507904, 1096238145, 12340300,
-0, 45, 0, 45, 0, 1145130067, 1280065879, 186,
-2949128, 0, 2949120, 0, 1280507904, 1096238145, 12340300, 0,
-45, 0, 45, 0, 1380013139, 843989332, 38, 2949120,
-0, 2949120, 0, 1280507904, 1096238145, 12405836, 0, 45,
-0, 1464816194, 3553614, 45, 0, 102, 2949120, 0,
-2949120, 0, 2949120, 0, 6750208, 0, 45, 0,
-1464816194, 3553614, 45, 0, 102, 2949120, 0, 2949120,
-0, 2949120, 0, 6750208, 0, 45, 0, 1464816194,
-3553614, 45, 0, 102, 2949120, 0, 2949120, 0,
-2949120, 0, 6750208, 0, 45, 0, 1464816194, 3553614,
-45, 0, 101, 2949120, 0, 2949120, 0, 2949120,
-0, 6684672, 0, 45, 0, 1464816194, 3553614, 45,
-0, 101, 2949120, 0, 2949120, 0, 2949120, 0,
-6684672, 0, 45, 0, 1464816194, 3553614, 45, 0,
-101, 2949120, 0, 2949120, 0, 2949120, 0, 6684672,
-0, 45, 0, 1464816194, 3553614, 45, 0, 100,
-2949120, 0, 2949120, 0, 2949120, 0, 6619136, 0,
-45, 0, 1464816194, 3553614, 45, 0, 100, 2949120,
-0, 2949120, 0, 2949120, 0, 6619136, 0, 45,
-0, 1464816194, 3553614, 45, 0, 100, 2949120, 0,
-2949120, 0, 2949120, 0, 6619136, 0, 1347243843, 1162627412,
-45, 0, 45, 0, 148, 2949120, 0, 2949120,
-0, 2949120, 0, 11993088, 0, 45, 0, 45,
-0, 1145130067, 1280065879, 181, 2949120, 0, 2949120, 0,
-1229717504, 3360084, 1835008, 0, 45, 0, 45, 0,
-1380013139, 860766548, 35, 2949120, 0, 2949120, 0, 1229717504,
-1279411540, 2437973, 0, 45, 0, 45, 0, 1380013139,
-843989332, 36, 2949120, 0, 2949120, 0, 1414725632, 1096045121,
-2372174, 0, 45, 0, 45, 0, 1163151692, 861228098,
-37, 2949120, 0, 2949120, 0, 1414725632, 1096045121, 2372174,
-0, 45, 0, 45, 0, 1380013139, 860766548, 35,
-1414725632, 4542031, 1094778880, 1313428563, 2971979, 0, 2293760, 0,
-45, 0, 45, 0, 45, 0, 37, 1868759040,
-1953853549, 1094791525, 1313428563, 2971979, 0, 2359296, 0, 45,
-0, 45, 0, 45, 0, 37, 2949120, 0,
-2949120, 0, 1229717504, 3360084, 1835008, 0, 1380013139, 843989332,
-1347243843, 1162627412, 45, 0, 27, 2949120, 0, 2949120,
-0, 2949120, 0, 1835008, 0, 45, 0, 45,
-0, 1380013139, 843989332, 38, 2949120, 0, 2949120, 0,
-1414725632, 1096045121, 1585742, 0, 45, 0, 45, 0,
-1380013139, 843989332, 103, 2949120, 0, 2949120, 0, 1414725632,
-1096045121, 1585742, 0, 45, 0, 45, 0, 1380013139,
-843989332, 24, 1414725632, 1096045121, 2961998, 0, 2949120, 0,
-1572864, 0, 1414742337, 1498107465, 1414742337, 1498107465, 45, 0,
-27, 1414725632, 1096045121, 2961998, 0, 2949120, 0, 1572864,
-0, 1414742337, 1498107465, 1414742337, 1498107465, 45, 0, 38,
-1414725632, 1096045121, 1414738510, 3362885, 2949120, 0, 1572864, 0,
-45, 0, 45, 0, 45, 0, 30, 2949120,
-0, 1414725632, 3362885, 2949120, 0, 1966080, 0, 45,
-0, 45, 0, 45, 0, 31, 1414725632, 1096045121,
-1414738510, 3362885, 2949120, 0, 2031616, 0, 45, 0,
-45, 0, 45, 0, 32, 2949120, 0, 2949120,
-0, 1431502848, 1380929616, 2044500, 0, 45, 0, 45,
-0, 1347442003, 844386895, 30, 2949120, 0, 2949120, 0,
-1431502848, 1380929616, 1978964, 0, 45, 0, 45, 0,
-1347442003, 844386895, 31, 1414725632, 1096045121, 2961998, 0, 2949120,
-0, 1572864, 0, 1414742337, 1498107465, 1414742337, 1498107465, 45,
-0, 38, 1414725632, 1096045121, 2961998, 0, 2949120, 0,
-6750208, 0, 45, 0, 45, 0, 45, 0,
-33, 1414725632, 1096045121, 1414738510, 1096045121, 2961998, 0, 2097152,
-0, 45, 0, 45, 0, 45, 0, 33,
-2949120, 0, 2949120, 0, 1229717504, 3491156, 2097152, 0,
-45, 0, 45, 0, 1163151692, 53, 32, 2949120,
-0, 2949120, 0, 1414725632, 1096045121, 1585742, 0, 45,
-0, 45, 0, 1163151692, 52, 114, 1380384768, 1096046913,
-1094798412, 1313428563, 2971979, 0, 2490368, 0, 1414742337, 1498107465,
-1414742337, 1498107465, 45, 0, 114, 1414725632, 1096045121, 2961998,
-0, 2949120, 0, 1572864, 0, 1414742337, 1498107465, 1414742337,
-1498107465, 45, 0, 114, 2949120, 0, 2949120, 0,
-1229717504, 3425620, 7471104, 0, 45, 0, 45, 0,
-1347243843, 826365011, 33, 2949120, 0, 2949120, 0, 1329790976,
-1414746189, 2175553, 0, 45, 0, 45, 0, 1163151692,
-51, 93, 2949120, 0, 2949120, 0, 1229717504, 3360084,
-6094848, 0, 1497453127, 1280065876, 1497453127, 1280065876, 45, 0,
-83, 1380384768, 1096046913, 1380404300, 1096046913, 2968652, 0, 5505024,
-0, 45, 0, 45, 0, 1380013139, 13127, 83,
-2949120, 0, 2949120, 0, 1431502848, 1380929616, 5452372, 0,
-1497453127, 1280065876, 1497453127, 1280065876, 45, 0, 145, 1380384768,
-1096046913, 1380404300, 1096046913, 2968652, 0, 5439488, 0, 1497453127,
-1280065876, 1497453127, 1280065876, 45, 0, 86, 1380384768, 1096046913,
-1380404300, 1096046913, 2968652, 0, 5439488, 0, 1497453127, 1280065876,
-1497453127, 1280065876, 45, 0, 83, 1380384768, 1096046913, 1380404300,
-1096046913, 2968652, 0, 5767168, 0, 45, 0, 45,
-0, 1380013139, 13127, 84, 2949120, 0, 2949120, 0,
-1414725632, 860312129, 9502720, 0, 45, 0, 45, 0,
-1145130067, 1280065879, 163, 2949120, 0, 2949120, 0, 1280507904,
-1096238145, 9260108, 0, 1162889552, 50, 1162889552, 50, 45,
-0, 120, 2949120, 0, 2949120, 0, 2949120, 0,
-7995392, 0, 45, 0, 45, 0, 1162889552, 50,
-120, 2949120, 0, 2949120, 0, 1229979648, 3294544, 7864320,
-0, 1162889552, 50, 1162889552, 50, 45, 0, 120,
-2949120, 0, 2949120, 0, 2949120, 0, 8519680, 7864320,
-1145130067, 1280065879, 1162564942, 1145130067, 45, 0, 142, 1380384768,
-1096046913, 2968652, 0, 2949120, 0, 9043968, 0, 45,
-0, 1347442003, 844386895, 45, 0, 121, 1229979648, 3294544,
-2949120, 0, 2949120, 0, 8978432, 0, 45, 0,
-45, 0, 1347442003, 844386895, 168, 2949120, 0, 2949120,
-0, 1329790976, 1414877261, 8008261, 0, 45, 0, 45,
-0, 1347243843, 843404373, 130, 2949120, 0, 2949120, 0,
-1329790976, 1414877261, 8204869, 0, 45, 0, 45, 0,
-1163151692, 52, 122, 2949120, 0, 2949120, 0, 1229717504,
-3425620, 8192000, 0, 45, 0, 45, 0, 1163151692,
-52, 125, 2949120, 0, 2949120, 0, 1229717504, 3425620,
-8519680, 0, 45, 0, 45, 0, 1163151692, 52,
-130, 1414725632, 1096045121, 2961998, 0, 2949120, 0, 9830400,
-0, 2002872435, 12910, 1346720851, 54, 45, 0, 36,
-2949120, 0, 2949120, 0, 1280507904, 1096238145, 12536908, 0,
-45, 0, 45, 0, 1145130067, 1280065879, 195, 2949120,
-0, 2949120, 0, 1280507904, 1096238145, 10964044, 0, 45,
-0, 45, 0, 1145130067, 1280065879, 167, 2949120, 0,
-2949120, 0, 1431502848, 1380929616, 11022932, 0, 45, 0,
-45, 0, 1145130067, 1280065879, 168, 2949120, 0, 2949120,
-0, 1280507904, 1096238145, 11029580, 0, 45, 0, 1346720851,
-54, 45, 0, 94, 1414725632, 4542031, 2949120, 0,
-2949120, 0, 6225920, 32, 45, 0, 45, 0,
-1380013139, 843989332, 3145823, 2949120, 0, 2949120, 0, 1414725632,
-1096045121, 6238798, 0, 45, 0, 1346720851, 54, 45,
-0, 93, 1414725640, 1096045121, 2961998, 0, 2949120, 0,
-6160384, 0, 1497453127, 1280065876, 1346720851, 54, 45, 0,
-95, 1414725632, 4542031, 1414725632, 4542031, 2949120, 0, 6291456,
-0, 1145130067, 1280065879, 1346720851, 54, 45, 0, 181,
-2949120, 0, 1213399040, 843994945, 2949120, 0, 12058624, 0,
-1145130067, 1280065879, 1346720851, 54, 45, 0, 184, 2949120,
-0, 2949120, 0, 2949120, 0, 12124160, 0, 1145130067,
-1280065879, 1346720851, 54, 45, 0, 185, 2949120, 0,
-2949120, 0, 2949120, 0, 12189696, 0, 1145130067, 1280065879,
-1346720851, 54, 45, 0, 186, 2949120, 0, 2949120,
-0, 2949120, 0, 12451840, 0, 1145130067, 1280065879, 1346720851,
-54, 45, 0, 190, 2949120, 0, 2949120, 0,
-2949120, 0, 12517376, 0, 1145130067, 1280065879, 1346720851, 54,
-45, 0, 191, 2949120, 0, 2949120, 0, 2949120,
-0, 12582912, 0, 1145130067, 1280065879, 1346720851, 54, 45,
-0, 192, 2949120, 0, 2949120, 0, 2949120, 0,
-12779520, 0, 1145130067, 1280065879, 1346720851, 54, 45, 0,
-195, 2949120, 0, 2949120, 0, 2949120, 0, 12845056,
-0, 1145130067, 1280065879, 1346720851, 54, 45, 0, 196,
-2949120, 0, 2949120, 0, 2949120, 0, 12910592, 0,
-1145130067, 1280065879, 1346720851, 54, 45, 0, 197, 2949120,
-0, 2949120, 0, 2949120, 0, 12976128, 0, 1145130067,
-1280065879, 1346720851, 54, 45, 0, 198, 1280507904, 1096238145,
-2968652, 0, 2949120, 0, 13041664, 0, 1145130067, 1280065879,
-1346720851, 54, 45, 0, 199, 1280507904, 1096238145, 2968652,
-0, 2949120, 0, 10747904, 0, 1145130067, 1280065879, 1346720851,
-54, 45, 0, 164, 2949120, 0, 2949120, 0,
-2949120, 0, 10813440, 0, 1145130067, 1280065879, 1346720851, 54,
-45, 0, 165, 2949120, 0, 2949120, 0, 2949120,
-0, 10878976, 0, 1145130067, 1280065879, 1346720851, 54, 45,
-0, 166, 2949120, 0, 2949120, 0, 2949120, 0,
-10944512, 0, 45, 0, 45, 0, 1145130067, 1280065879,
-186, 2949120, 0, 2949120, 0, 1280507904, 1096238145, 12143692,
-0, 45, 0, 45, 0, 1145130067, 1280065879, 184,
-2949120, 0, 2949120, 0, 1280507904, 1096238145, 12078156, 0,
-45, 0, 45, 0, 1145130067, 1280065879, 185, 2949120,
-0, 2949120, 0, 1280507904, 1096238145, 12471372, 0, 45,
-0, 45, 0, 1145130067, 1280065879, 190, 2949120, 0,
-2949120, 0, 1280507904, 1096238145, 12602444, 0, 45, 0,
-45, 0, 1145130067, 1280065879, 197, 2949120, 0, 2949120,
-0, 1280507904, 1096238145, 12864588, 0, 45, 0, 45,
-0, 1145130067, 1280065879, 195, 2949120, 0, 2949120, 0,
-1280507904, 1096238145, 12864588, 0, 45, 0, 45, 0,
-1145130067, 1280065879, 197, 2949120, 0, 2949120, 0, 1280507904,
-1096238145, 13061196, 0, 45, 0, 45, 0, 1145130067,
-1280065879, 199, 2949120, 0, 2949120, 0, 1280507904, 1096238145,
-10898508, 0, 45, 0, 45, 0, 1145130067, 1280065879,
-165, 2949120, 0, 2949120, 0, 1280507904, 1096238145, 10767436,
-0, 45, 0, 45, 0, 1145130067, 1280065879, 164,
-2949120, 0, 2949120, 0, 1280507904, 1096238145, 10832972, 0,
-45, 0, 45, 0, 1145130067, 1280065879, 166, 2949120,
-0, 2949120, 0, 1280507904, 1096238145, 10964044, 160, 1380013139,
-843989332, 1380013139, 843989332, 45, 0, 71, 2949120, 0,
-2949120, 0, 2949120, 0, 4849664, 128, 1380013139, 843989332,
-1380013139, 843989332, 45, 0, 72, 2949120, 0, 2949120,
-0, 2949120, 0, 4849664, 96, 1380013139, 843989332, 1380013139,
-843989332, 45, 0, 73, 2949120, 0, 2949120, 0,
-2949120, 0, 4849664, 32, 45, 0, 45, 0,
-1380013139, 843989332, 65, 2949120, 0, 2949120, 0, 1414725632,
-1096045121, 4338254, 0, 45, 0, 45, 0, 1380013139,
-843989332, 2621511, 2949120, 0, 2949120, 0, 1414725632, 1096045121,
-4731470, 80, 45, 0, 45, 0, 1380013139, 843989332,
-7864393, 2949120, 0, 2949120, 0, 1414725632, 1096045121, 4207182,
-16, 45, 0, 45, 0, 1380013139, 843989332, 262210,
-1414725632, 1096045121, 1414738510, 3493957, 2949120, 0, 4587520, 0,
-45, 0, 45, 0, 45, 0, 262215, 1414725632,
-1096045121, 1414738510, 3493957, 2949120, 0, 4653056, 0, 45,
-0, 45, 0, 45, 0, 262216, 1414725632, 1096045121,
-1414738510, 3493957, 2949120, 0, 4718592, 0, 45, 0,
-45, 0, 45, 0, 262217, 1414725632, 1096045121, 1414738510,
-3493957, 2949120, 0, 4784128, 0, 45, 0, 45,
-0, 45, 0, 262208, 1414725632, 1096045121, 1414738510, 3493957,
-2949120, 0, 4194304, 0, 1380013139, 843989332, 45, 0,
-45, 0, 262209, 1414725632, 1096045121, 1414738510, 3493957, 2949120,
-0, 4259840, 0, 45, 0, 45, 0, 45,
-0, 262210, 1414725632, 1096045121, 1414738510, 3493957, 2949120, 0,
-4325376, 0, 1347243843, 843404373, 45, 0, 45, 0,
-8388670, 1414725632, 1096045121, 1414738510, 1096045121, 2961998, 0, 720896,
-0, 45, 0, 45, 0, 45, 0, 10485783,
-1414725632, 1096045121, 1414738510, 1096045121, 2961998, 0, 786432, 0,
-45, 0, 45, 0, 45, 0, 12582935, 1414725632,
-1096045121, 1414738510, 1096045121, 2961998, 0, 851968, 0, 45,
-0, 45, 0, 45, 0, 16777239, 2949120, 0,
-2949120, 0, 1414725632, 1096045121, 995918, 288, 45, 0,
-45, 0, 1380013139, 843989332, 16, 2949120, 0, 2949120,
-0, 1414725632, 1096045121, 1061454, 72, 45, 0, 45,
-0, 1380013139, 843989332, 7340046, 2949120, 0, 2949120, 0,
-1414725632, 1096045121, 864846, 152, 45, 0, 45, 0,
-1380013139, 843989332, 12582924, 2949120, 0, 2949120, 0, 1414725632,
-1096045121, 733774, 0, 45, 0, 1346720851, 53, 45,
-0, 16, 1329790976, 1414877261, 2961989, 0, 2949120, 0,
-4063232, 0, 45, 0, 1346720851, 53, 45, 0,
-15, 2949120, 0, 2949120, 0, 2949120, 0, 1048576,
-0, 45, 0, 1346720851, 53, 45, 0, 14,
-1414725632, 1096045121, 2961998, 0, 2949120, 0, 983040, 0,
-45, 0, 1346720851, 53, 45, 0, 13, 2949120,
-0, 2949120, 0, 2949120, 0, 917504, 0, 45,
-0, 1346720851, 53, 45, 0, 12, 2949120, 0,
-2949120, 0, 2949120, 0, 851968, 0, 45, 0,
-1346720851, 53, 45, 0, 11, 2949120, 0, 2949120,
-0, 2949120, 0, 786432, 0, 45, 0, 1346720851,
-53, 45, 0, 19, 2949120, 0, 2949120, 0,
-2949120, 0, 720896, 0, 45, 0, 45, 0,
-1347243843, 826365011, 0, 2949120, 0, 2949120, 0, 1329790976,
-1414746189, 4141633, 0, 45, 0, 45, 0, 1163151692,
-51, 0, 2949120, 0, 2949120, 0, 1229717504, 3360084,
-4128768, 0, 45, 0, 45, 0, 1163151692, 51,
-63, 2949120, 0, 2949120, 0, 1229717504, 3360084, 0,
-0, 1464550740, 877415489, 1464550740, 877415489, 45, 0, 62,
-2949120, 0, 2949120, 0, 2949120, 0, 0, 0,
-1464550740, 877415489, 1464550740, 877415489, 45, 0, 62, 2949120,
-0, 2949120, 0, 2949120, 0, 4128768, 0, 1464550740,
-877415489, 1464550740, 877415489, 45, 0, 62, 2949120, 0,
-2949120, 0, 2949120, 0, 65536, 0, 45, 0,
-45, 0, 1347243843, 826365011, 1, 2949120, 0, 2949120,
-0, 1229717504, 3360084, 65536, 0, 1414742337, 1498107465, 1414742337,
-1498107465, 1497453127, 1280065876, 1, 1094778880, 1313428563, 1094801739, 1313428563,
-1380407627, 1096046913, 85068, 0, 45, 0, 45, 0,
-1163151692, 51, 262145, 1414725632, 1096045121, 1414738510, 3493957, 2949120,
-0, 4521984, 0, 1380013139, 843989332, 45, 0, 45,
-0, 70, 2949120, 0, 2949120, 0, 1329790976, 1414746189,
-78401, 0, 45, 0, 1380013139, 860766548, 45, 0,
-109, 1414725632, 1096045121, 2962254, 0, 2949120, 0, 2228224,
-0, 45, 0, 1346720851, 51, 45, 0, 33,
-1414725632, 1096045121, 2962254, 0, 2949120, 0, 7012352, 0,
-45, 0, 45, 0, 1380013139, 860766548, 33, 1229062144,
-1330594887, 2962002, 0, 2949120, 0, 4980736, 0, 45,
-0, 45, 0, 45, 0, 78, 2949120, 0,
-2949120, 0, 1329856512, 1381257807, 5131073, 0, 45, 0,
-45, 0, 1380929348, 1262572116, 78, 2949120, 0, 2949120,
-0, 1414725632, 1096045121, 2503246, 0, 45, 0, 45,
-0, 1347243843, 1280065876, 87, 2949120, 0, 2949120, 0,
-1329790976, 1096044621, 5721164, 0, 45, 0, 45, 0,
-1347243843, 1280065876, 87, 2949120, 0, 2949120, 0, 1229979648,
-3294544, 7864320, 0, 1162889552, 50, 45, 0, 45,
-0, 120, 2949120, 0, 2949120, 0, 2949120, 0,
-8126464, 0, 45, 0, 45, 0, 1464816194, 1314015054,
-123, 2949120, 0, 2949120, 0, 1380057088, 1196316495, 8080978,
-0, 45, 0, 45, 0, 1464816194, 1314015054, 123,
-2949120, 0, 2949120, 0, 1380057088, 1196316495, 8080978, 0,
-45, 0, 45, 0, 1162889552, 50, 120, 1229979648,
-3294544, 2949120, 0, 2949120, 0, 7864320, 0, 45,
-0, 45, 0, 45, 0, 129, 2949120, 0,
-2949120, 0, 1380057088, 1196316495, 8080978, 0, 45, 0,
-45, 0, 1464816194, 1314015054, 123, 2949120, 0, 2949120,
-0, 1380057088, 1196316495, 8080978, 524288, 1145130067, 1280065879, 1145130067,
-1280065879, 45, 0, 89, 1280507904, 1096238145, 2968652, 0,
-2949120, 0, 5898240, 0, 45, 0, 45, 0,
-1145130067, 1280065879, 89, 2949120, 0, 2949120, 0, 1280507904,
-1096238145, 5852236, 0, 45, 0, 45, 0, 1380013139,
-843989332, 38, 2949120, 0, 1280311296, 3232833, 2949120, 0,
-5570560, 0, 1497453127, 55, 45, 0, 45, 0,
-89, 2949120, 0, 2949120, 0, 1414725632, 1096045121, 2503246,
-524288, 45, 0, 45, 0, 45, 0, 38,
-1280507904, 1096238145, 2968652, 0, 2949120, 0, 5570560, 0,
-45, 0, 45, 0, 1145130067, 1280065879, 90, 2949120,
-0, 2949120, 0, 1280507904, 1096238145, 5917772, 0, 45,
-0, 45, 0, 1145130067, 1280065879, 90, 2949120, 0,
-2949120, 0, 1414725632, 1096045121, 2503246, 0, 45, 0,
-45, 0, 1163151692, 52, 104, 2949120, 0, 2949120,
-0, 1329856512, 3363407, 6815744, 0, 45, 0, 45,
-0, 1163151692, 52, 104, 2949120, 0, 2949120, 0,
-1414725632, 1096045121, 2503246, 0, 45, 0, 1346720851, 49,
-45, 0, 38, 1414725632, 3559493, 2949120, 0, 2949120,
-0, 6815744, 0, 1145522498, 844255055, 45, 0, 45,
-0, 38, 2949120, 0, 2949120, 0, 2949120, 0,
-5111808, 0, 1145522498, 844255055, 45, 0, 45, 0,
-4, 2949120, 0, 2949120, 0, 2949120, 0, 1703936,
-0, 45, 0, 45, 0, 1380929348, 1262572116, 26,
-2949120, 0, 2949120, 0, 1329856512, 1381257807, 1723201, 0,
-1145522498, 844255055, 45, 0, 45, 0, 25, 2949120,
-0, 2949120, 0, 2949120, 0, 1703936, 0, 45,
-0, 45, 0, 1347442003, 844386895, 62, 2949120, 0,
-2949120, 0, 1380057088, 827217743, 209972, 0, 45, 0,
-45, 0, 1464816194, 875835726, 3, 1329790976, 1414877261, 2961989,
-0, 2949120, 0, 6553600, 0, 1414742337, 1498107465, 1414742337,
-1498107465, 45, 0, 38, 1329790976, 1414877261, 2961989, 0,
-2949120, 0, 6553600, 0, 1414742337, 1498107465, 1414742337, 1498107465,
-45, 0, 38, 1329790976, 1414877261, 2961989, 0, 2949120,
-0, 6553600, 0, 1414742337, 1498107465, 1414742337, 1498107465, 45,
-0, 38, 1329790976, 1414877261, 2961989, 0, 2949120, 0,
-6553600, 0, 1414742337, 1498107465, 1414742337, 1498107465, 45, 0,
-38, 2949120, 0, 2949120, 0, 1431502848, 1380929616, 5583444,
-0, 45, 0, 45, 0, 1145130067, 1280065879, 85,
-2949120, 0, 2949120, 0, 1431502848, 1380929616, 5583444, 0,
-45, 0, 45, 0, 1145130067, 1280065879, 85, 1414725632,
-1096045121, 2961998, 0, 2949120, 0, 1572864, 0, 45,
-0, 45, 0, 45, 0, 25, 2949120, 0,
-2949120, 0, 1414725632, 1096045121, 2503246, 0, 45, 0,
-45, 0, 1380013139, 843989332, 38, 2949120, 0, 2949120,
-0, 1431502848, 1380929616, 2503252, 0, 45, 0, 45,
-0, 1347442003, 844386895, 38, 2949136, 0, 2949120, 0,
-1414725632, 1096045121, 1651278, 1048576, 45, 0, 45, 0,
-1380013139, 843989332, 25, 2949152, 0, 2949120, 0, 1431502848,
-1380929616, 1651284, 2097152, 45, 0, 45, 0, 1347442003,
-844386895, 25, 2949120, 0, 2949120, 0, 1431502848, 1380929616,
-2175572, 0, 45, 0, 45, 0, 1347442003, 844386895,
-33, 2949120, 0, 2949120, 0, 1414725632, 1096045121, 2175822,
-0, 45, 0, 45, 0, 1347442003, 844386895, 33,
-2949120, 0, 2949120, 0, 1414725632, 1096045121, 2175822, 0,
-45, 0, 45, 0, 1380013139, 860766548, 33, 2949120,
-0, 2949120, 0, 1431502848, 1380929616, 2175572, 0, 45,
-0, 45, 0, 1380013139, 843989332, 24, 2949120, 0,
-2949120, 0, 1414725632, 1096045121, 7025486, 0, 45, 0,
-1346720851, 51, 45, 0, 107, 1414725632, 1096045121, 2962254,
-0, 2949120, 0, 7077888, 0, 45, 0, 1413565520,
-49, 45, 0, 108, 2949120, 0, 2949120, 0,
-2949120, 0, 7143424, 0, 45, 0, 45, 0,
-1380013139, 860766548, 34, 2949120, 0, 2949120, 0, 1414725632,
-1096045121, 2241358, 0, 45, 0, 45, 0, 1380013139,
-860766548, 34, 2949120, 0, 2949120, 0, 1431502848, 1380929616,
-7090772, 0, 45, 0, 45, 0, 1347442003, 844386895,
-2621548, 2949120, 0, 2949120, 0, 1414725632, 1096045121, 7091022,
-0, 45, 0, 45, 0, 1380013139, 860766548, 108,
-2949120, 0, 2949120, 0, 1414725632, 1096045121, 7025486, 0,
-45, 0, 45, 0, 1347442003, 844386895, 107, 2949120,
-0, 2949120, 0, 1414725632, 1096045121, 2175822, 0, 45,
-0, 45, 0, 1347442003, 844386895, 33, 2949120, 0,
-2949120, 0, 1414725632, 1096045121, 2241358, 8, 45, 0,
-45, 0, 1380013139, 860766548, 109, 2949120, 0, 2949120,
-0, 1431502848, 1380929616, 7156308, 0, 45, 0, 45,
-0, 1380013139, 860766548, 109, 2949120, 0, 2949120, 0,
-1431502848, 1380929616, 7156308, 0, 45, 0, 45, 0,
-1380013139, 843989332, 38, 1414725632, 1096045121, 2962254, 0, 2949120,
-0, 2490368, 0, 45, 0, 45, 0, 45,
-0, 116, 2949120, 0, 2949120, 0, 1329856512, 1381257807,
-7621441, 0, 45, 0, 45, 0, 1380929348, 1262572116,
-131188, 2949120, 0, 2949120, 0, 1163132928, 1279350603, 1913164,
-2, 45, 0, 45, 0, 1464550740, 827083841, 131101,
-2949120, 0, 2949120, 0, 1163132928, 1279350603, 1913164, 2,
-45, 0, 45, 0, 1464550740, 827083841, 131101, 2949120,
-0, 2949120, 0, 1163132928, 1279350603, 1913164, 0, 1380929348,
-49, 45, 0, 45, 0, 115, 2949120, 0,
-2949120, 0, 2949120, 0, 7602176, 0, 1464550740, 843861057,
-1313821779, 13125, 45, 0, 29, 2949120, 0, 2949120,
-0, 2949120, 0, 7208960, 2, 45, 0, 45,
-0, 1464550740, 827083841, 112, 2949120, 0, 2949120, 0,
-1465057280, 1297040177, 7274576, 2, 45, 0, 45, 0,
-1464550740, 827083841, 113, 2949120, 0, 1414725632, 860180047, 2949120,
-0, 7340032, 0, 45, 0, 45, 0, 45,
-0, 111, 2949120, 0, 1414725632, 860180047, 2949120, 0,
-7208960, 0, 45, 0, 45, 0, 45, 0,
-111, 2949120, 0, 1414725632, 860180047, 2949120, 0, 7208960,
-0, 45, 0, 45, 0, 45, 0, 111,
-2949120, 0, 1414725632, 860180047, 2949120, 0, 7208960, 0,
-45, 0, 45, 0, 45, 0, 111, 2949120,
-0, 1414725632, 860180047, 2949120, 0, 7405568, 0, 45,
-0, 45, 0, 45, 0, 131183, 2949120, 0,
-2949120, 0, 1163132928, 1279350603, 1913164, 2, 45, 0,
-45, 0, 1464550740, 827083841, 29, 2949120, 0, 2949120,
-0, 1163132928, 1279350603, 7549260, 0, 45, 0, 45,
-0, 1464550740, 827083841, 115, 1163132928, 1279350603, 2961740, 0,
-2949120, 0, 1900544, 0, 45, 0, 45, 0,
-45, 0, 115, 1163132928, 1279350603, 1414738508, 860180047, 2949120,
-0, 1900544, 0, 45, 0, 45, 0, 45,
-0, 112, 1163132928, 1279350603, 1414738508, 860180047, 2949120, 0,
-1900544, 0, 45, 0, 45, 0, 45, 0,
-110, 1163132928, 1279350603, 1414738508, 860180047, 2949120, 0, 1900544,
-0, 45, 0, 45, 0, 45, 0, 110,
-1163132928, 1279350603, 1414738508, 860180047, 2949120, 0, 1900544, 0,
-45, 0, 45, 0, 45, 0, 113, 2949120,
-0, 1414725632, 860180047, 2949120, 0, 7208960, 0, 45,
-0, 45, 0, 45, 0, 113, 2949120, 0,
-1414725632, 860180047, 2949120, 0, 7208960, 0, 45, 0,
-45, 0, 45, 0, 112, 2949120, 0, 2949120,
-0, 1414725632, 1096045121, 1782350, 0, 45, 0, 45,
-0, 1380013139, 843989332, 27, 2949120, 0, 2949120, 0,
-1431502848, 1380929616, 1782356, 0, 45, 0, 45, 0,
-1347442003, 844386895, 27, 2949120, 0, 2949120, 0, 1414725632,
-843402831, 1572864, 0, 45, 0, 45, 0, 1313821779,
-12869, 24, 2949120, 0, 2949120, 0, 1414725632, 843402831,
-1572864, 0, 45, 0, 45, 0, 1313821779, 12869,
-24, 2949120, 0, 2949120, 0, 1414725632, 843402831, 1572864,
-0, 45, 0, 45, 0, 1313821779, 12869, 24,
-2949120, 0, 2949120, 0, 1414725632, 843402831, 1572864, 0,
-45, 0, 45, 0, 1313821779, 12869, 24, 2949120,
-0, 2949120, 0, 1414725632, 843402831, 1572864, 0, 45,
-0, 45, 0, 1313821779, 12869, 24, 2949120, 0,
-2949120, 0, 1414725632, 843402831, 1572864, 0, 45, 0,
-45, 0, 1313821779, 12869, 24, 2949120, 0, 2949120,
-0, 1414725632, 843402831, 1572864, 0, 45, 0, 45,
-0, 1313821779, 12869, 24, 2949120, 0, 2949120, 0,
-1414725632, 843402831, 1572864, 0, 45, 0, 45, 0,
-1313821779, 12869, 262168, 1414725632, 1096045121, 1414738510, 3493957, 2949120,
-0, 5373952, 0, 1497453127, 1280065876, 45, 0, 45,
-0, 69, 2949120, 0, 2949120, 0, 1414725632, 1096045121,
-4534862, 0, 45, 0, 45, 0, 1347442003, 844386895,
-3145797, 2949120, 0, 2949120, 0, 1414725632, 1096045121, 4534862,
-0, 45, 0, 45, 0, 1347442003, 844386895, 69,
-2949120, 0, 2949120, 0, 1380057088, 827217743, 131072, 0,
-45, 0, 45, 0, 1464816194, 12622, 12582914, 1414725632,
-1096045121, 1414738510, 1096045121, 2961998, 0, 4587520, 0, 45,
-0, 45, 0, 45, 0, 74, 2949120, 0,
-2949120, 0, 1431502848, 1380929616, 4600404, 0, 45, 0,
-45, 0, 1380929348, 1347376211, 74, 2949120, 0, 2949120,
-0, 1380057088, 827217743, 131072, 0, 45, 0, 45,
-0, 1347442003, 844386895, 70, 1414725632, 1096045121, 1414738510, 1096045121,
-2961998, 0, 4587520, 0, 45, 0, 45, 0,
-45, 0, 75, 1380057088, 827217743, 1380057088, 827217743, 2949120,
-0, 131072, 0, 45, 0, 45, 0, 45,
-0, 75, 2949120, 0, 2949120, 0, 1329856512, 1414746703,
-4935759, 0, 45, 0, 45, 0, 1380929348, 1347376211,
-75, 2949120, 0, 2949120, 0, 1380057088, 827217743, 131072,
-0, 45, 0, 45, 0, 1380929348, 1347376211, 74,
-1380057088, 827217743, 1380057088, 827217743, 2949120, 0, 131072, 0,
-45, 0, 45, 0, 45, 0, 74, 2949120,
-0, 2949120, 0, 1431502848, 1380929616, 4076116, 0, 45,
-0, 45, 0, 1464550740, 877415489, 62, 2949120, 0,
-2949120, 0, 1163132928, 1279350603, 4076620, 0, 45, 0,
-45, 0, 1347442003, 844386895, 62, 2949120, 0, 2949120,
-0, 1431502848, 1380929616, 4076116, 0, 45, 0, 45,
-0, 1096041805, 12620, 1572926, 2949120, 0, 2949120, 0,
-1162674176, 827081044, 4063232, 0, 1096041805, 12620, 1096041805, 12620,
-45, 0, 62, 2949120, 0, 2949120, 0, 2949120,
-0, 1441792, 0, 45, 0, 45, 0, 1096041805,
-12620, 2097214, 1162674176, 827081044, 1162674176, 827081044, 2949120, 0,
-4063232, 0, 45, 0, 45, 0, 45, 0,
-2097220, 2949120, 0, 2949120, 0, 1162674176, 827081044, 4063232,
-0, 1096041805, 12620, 1096041805, 12620, 45, 0, 62,
-2949120, 0, 2949120, 0, 2949120, 0, 4390912, 0,
-1464816194, 12622, 1464816194, 12622, 45, 0, 2, 2949120,
-0, 2949120, 0, 2949120, 0, 4390912, 0, 1464816194,
-12622, 1464816194, 12622, 45, 0, 2, 2949120, 0,
-2949120, 0, 2949120, 0, 4456448, 0, 1464816194, 12622,
-1464816194, 12622, 45, 0, 2, 2949120, 0, 2949120,
-0, 2949120, 0, 1441792, 0, 45, 0, 45,
-0, 1380929348, 1347376211, 22, 2949120, 0, 2949120, 0,
-1329856512, 1414746703, 4411471, 0, 45, 0, 45, 0,
-1380929348, 1347376211, 67, 2949120, 0, 2949120, 0, 1329856512,
-1414746703, 4477007, 0, 45, 0, 45, 0, 1380929348,
-1347376211, 68, 2949120, 0, 2949120, 0, 1329856512, 1414746703,
-1462351, 0, 45, 0, 45, 0, 1464816194, 12622,
-2, 2949120, 0, 2949120, 0, 1380057088, 827217743, 131072,
-0, 45, 0, 45, 0, 1464816194, 12622, 2,
-2949120, 0, 2949120, 0, 1380057088, 827217743, 131072, 0,
-45, 0, 45, 0, 1464816194, 12622, 2, 2949120,
-0, 2949120, 0, 1380057088, 827217743, 131072, 0, 45,
-0, 45, 0, 1464550740, 877415489, 4194366, 2949120, 0,
-2949120, 0, 1163132928, 1279350603, 4076620, 0, 45, 0,
-45, 0, 1464550740, 877415489, 2097214, 2949120, 0, 2949120,
-0, 1163132928, 1279350603, 4076620, 0, 45, 0, 45,
-0, 1464816194, 12622, 2, 2949120, 0, 2949120, 0,
-1329856512, 1414746703, 1527887, 0, 1464816194, 12622, 1464816194, 12622,
-45, 0, 2, 2949120, 0, 2949120, 0, 2949120,
-0, 1507328, 0, 45, 0, 45, 0, 1347442003,
-844386895, 2097171, 1414725632, 1096045121, 1414738510, 1096045121, 2961998, 0,
-1245184, 0, 45, 0, 45, 0, 45, 0,
-23, 2949120, 0, 2949120, 0, 1329856512, 1414746703, 1527887,
-0, 45, 0, 45, 0, 1464816194, 12622, 2,
-1380057088, 827217743, 1380057088, 827217743, 2949120, 0, 131072, 0,
-45, 0, 45, 0, 45, 0, 20, 2949120,
-0, 2949120, 0, 1414725632, 1096045121, 1258062, 0, 45,
-0, 45, 0, 1380929348, 1347376211, 1572884, 1414725632, 1096045121,
-1414738510, 1096045121, 2961998, 0, 1245184, 0, 45, 0,
-45, 0, 45, 0, 20, 2949120, 0, 2949120,
-0, 1329856512, 1414746703, 1331279, 0, 45, 0, 45,
-0, 1464816194, 12622, 2, 2949120, 0, 2949120, 0,
-1380057088, 827217743, 131072, 0, 45, 0, 45, 0,
-1464816194, 875835726, 3, 1414725688, 1096045121, 1414738510, 1096045121, 2961998,
-0, 1245184, 0, 45, 0, 1347442003, 844386895, 45,
-0, 21, 2949120, 0, 2949120, 0, 1329856512, 1381257807,
-1395521, 0, 45, 0, 45, 0, 1464816194, 12622,
-6815746, 2949120, 0, 2949120, 0, 1414725632, 1096045121, 1258062,
-0, 45, 0, 1346720851, 53, 45, 0, 10,
-1414725632, 1096045121, 2961998, 0, 2949120, 0, 1245184, 7340032,
-1464816194, 12622, 1464816194, 12622, 45, 0, 18, 2949120,
-0, 2949120, 0, 2949120, 0, 1376256, 0, 45,
-0, 45, 0, 1464816194, 12622, 2, 2949120, 0,
-2949120, 0, 1329856512, 1381257807, 1395521, 3145728, 45, 0,
-1464816194, 12622, 45, 0, 2, 2949120, 0, 1431502848,
-1380929616, 2962004, 0, 1179648, 3145728, 45, 0, 1464816194,
-12622, 45, 0, 2, 2949120, 0, 1431502848, 1380929616,
-2962004, 0, 1179648, 3145728, 45, 0, 1464816194, 12622,
-45, 0, 2, 2949120, 0, 1431502848, 1380929616, 2962004,
-0, 1114112, 3145728, 45, 0, 1464816194, 12622, 45,
-0, 2, 2949120, 0, 1431502848, 1380929616, 2962004, 0,
-1114112, 3145728, 45, 0, 1464816194, 12622, 45, 0,
-2, 2949120, 0, 1431502848, 1380929616, 2962004, 0, 1114112,
-3145728, 45, 0, 1464816194, 12622, 45, 0, 17,
-2949120, 0, 1431502848, 1380929616, 2962004, 0, 1179648, 0,
-1464816194, 875835726, 1464816194, 875835726, 45, 0, 2, 2949120,
-0, 2949120, 0, 2949120, 0, 196608, 0, 1464816194,
-875835726, 1464816194, 875835726, 45, 0, 2, 2949120, 0,
-2949120, 0, 2949120, 0, 196608, 0, 1464816194, 875835726,
-1464816194, 875835726, 45, 0, 2, 2949120, 0, 2949120,
-0, 2949120, 0, 196608, 0, 45, 0, 45,
-0, 1313821779, 12869, 38, 2949120, 0, 2949120, 0,
-1414725632, 843402831, 2490368, 0, 45, 0, 45, 0,
-1313821779, 12869, 38, 2949120, 0, 2949120, 0, 1414725632,
-843402831, 2490368, 0, 45, 0, 45, 0, 1313821779,
-12869, 38, 2949120, 0, 2949120, 0, 1414725632, 843402831,
-2490368, 0, 45, 0, 45, 0, 1313821779, 12869,
-38, 2949120, 0, 2949120, 0, 1414725632, 843402831, 2490368,
-0, 45, 0, 45, 0, 1464816194, 875835726, 3,
-2949120, 0, 2949120, 0, 1380057088, 827217743, 209972, 0,
-45, 0, 45, 0, 1380929348, 1262572116, 99, 2949120,
-0, 2949120, 0, 1414725632, 1096045121, 2372174, 0, 45,
-0, 45, 0, 1380013139, 843989332, 36, 2949120, 0,
-2949120, 0, 1329856512, 1381257807, 6507329, 64, 45, 0,
-45, 0, 1380013139, 843989332, 96, 2949120, 0, 2949120,
-0, 1329856512, 1381257807, 6376257, 0, 45, 0, 45,
-0, 1380929348, 1262572116, 97, 2949120, 0, 2949120, 0,
-1414725632, 1096045121, 6304334, 0, 1145522498, 844255055, 45, 0,
-45, 0, 38, 1094778880, 1313428563, 1094801739, 1313428563, 2971979,
-0, 6488064, 0, 1145522498, 844255055, 45, 0, 45,
-0, 36, 1094778880, 1313428563, 1094801739, 1313428563, 2971979, 0,
-6488064, 0, 1380013139, 843989332, 45, 0, 45, 0,
-36, 1094778880, 1313428563, 1094801739, 1313428563, 2971979, 0, 6356992,
-0, 1380013139, 843989332, 45, 0, 45, 0, 96,
-1094778880, 1313428563, 1094801739, 1313428563, 2971979, 0, 6356992, 0,
-45, 0, 45, 0, 1347243843, 1280065876, 28, 2949120,
-0, 2949120, 0, 1329790976, 1096044621, 1854540, 0, 45,
-0, 45, 0, 1347243843, 1280065876, 28, 2949120, 0,
-2949120, 0, 1329790976, 1096044621, 1854540, 0, 45, 0,
-45, 0, 1347243843, 1280065876, 28, 2949120, 0, 2949120,
-0, 1329856512, 1163022927, 2359364, 0, 45, 0, 45,
-0, 1380929348, 4474194, 36, 2949120, 0, 2949120, 0,
-1329790976, 1096044621, 5721164, 0, 45, 0, 45, 0,
-1347243843, 1280065876, 87, 2949120, 0, 2949120, 0, 1329790976,
-1096044621, 5721164, 192, 45, 0, 45, 0, 1347243843,
-1280065876, 87, 2949120, 0, 2949120, 0, 1329790976, 1096044621,
-5721164, 0, 45, 0, 45, 0, 1347442003, 844386895,
-147, 2949120, 0, 2949120, 0, 1414725632, 860312129, 9502720,
-0, 45, 0, 45, 0, 1347442003, 844386895, 147,
-2949120, 0, 2949120, 0, 1329790976, 1230262349, 5719372, 0,
-1380013139, 13127, 45, 0, 45, 0, 145, 1380384768,
-1096046913, 1380404300, 1096046913, 2968652, 0, 9633792, 0, 1347243843,
-1162627412, 1346720851, 51, 45, 0, 87, 1380384768, 1096046913,
-1380404300, 1096046913, 2968652, 0, 9633792, 0, 45, 0,
-45, 0, 1347442003, 844386895, 92, 2949120, 0, 2949120,
-0, 1414725632, 860312129, 5636096, 0, 45, 0, 45,
-0, 1380013139, 13127, 86, 2949120, 0, 2949120, 0,
-1431502848, 1380929616, 6042196, 0, 1380013139, 13127, 45, 0,
-45, 0, 86, 1380384768, 1096046913, 1380404300, 1096046913, 2968652,
-0, 6029312, 0, 1347243843, 1162627412, 1346720851, 51, 45,
-0, 87, 1380384768, 1096046913, 1380404300, 1096046913, 2968652, 0,
-6029312, 0, 45, 0, 45, 0, 1347243843, 1280065876,
-87, 2949120, 0, 2949120, 0, 1431502848, 1380929616, 9777748,
-0, 45, 0, 45, 0, 1380013139, 13127, 145,
-2949120, 0, 2949120, 0, 1414725632, 860312129, 9502720, 0,
-45, 0, 45, 0, 1347442003, 844386895, 149, 1414725632,
-860312129, 2949120, 0, 2949120, 0, 9502720, 0, 1497453127,
-1280065876, 1497453127, 1280065876, 45, 0, 149, 1329790976, 1230262349,
-1414743372, 3362885, 2949120, 0, 5701632, 0, 1497453127, 1280065876,
-1497453127, 1280065876, 45, 0, 149, 2949120, 0, 2949120,
-0, 1329790976, 1096044621, 5721164, 8, 45, 0, 45,
-0, 1347442003, 844386895, 91, 2949120, 0, 2949120, 0,
-1414725632, 860312129, 5767168, 0, 1380013139, 13127, 45, 0,
-45, 0, 88, 1380384768, 1096046913, 1380404300, 1096046913, 2968652,
-0, 5963776, 0, 1347243843, 1162627412, 1346720851, 51, 45,
-0, 87, 1380384768, 1096046913, 1380404300, 1096046913, 2968652, 0,
-5963776, 0, 45, 0, 45, 0, 1347243843, 826627157,
-87, 2949120, 0, 2949120, 0, 1329790976, 1414877261, 5714245,
-0, 45, 0, 45, 0, 1347243843, 826627157, 87,
-2949120, 0, 2949120, 0, 1329790976, 1414877261, 5714245, 0,
-45, 0, 45, 0, 1347243843, 1280065876, 183, 1329790976,
-1096044621, 2968652, 0, 2949120, 0, 11993088, 0, 45,
-0, 45, 0, 45, 0, 188, 2949120, 0,
-2949120, 0, 1329790976, 1096044621, 12012620, 2097216, 1347243843, 1280065876,
-1347243843, 1280065876, 45, 0, 183, 2949120, 0, 2949120,
-0, 2949120, 0, 12255232, 64, 45, 0, 45,
-0, 1347243843, 1280065876, 183, 2949120, 0, 2949120, 0,
-1329790976, 1096044621, 12274764, 0, 45, 0, 45, 0,
-1347243843, 1280065876, 187, 2949120, 0, 2949120, 0, 1329790976,
-1096044621, 12274764, 0, 1347243843, 1280065876, 45, 0, 45,
-0, 146, 2949120, 0, 2949120, 0, 2949120, 0,
-11993088, 524288, 45, 0, 45, 0, 1145130067, 1280065879,
-188, 2949120, 0, 2949120, 0, 1280507904, 1096238145, 12405836,
-524288, 1145130067, 1280065879, 45, 0, 45, 0, 189,
-2949120, 0, 2949120, 0, 2949120, 0, 12320768, 0,
-45, 0, 45, 0, 1145130067, 1280065879, 182, 2949120,
-0, 2949120, 0, 1280507904, 1096238145, 11947084, 0, 45,
-0, 45, 0, 1380013139, 13127, 84, 2949120, 0,
-2949120, 0, 1414725632, 860312129, 5505024, 0, 45, 0,
-45, 0, 1380013139, 13127, 84, 2949120, 0, 2949120,
-0, 1414725632, 860312129, 5505024, 0, 45, 0, 45,
-0, 1380013139, 13127, 84, 2949120, 0, 2949120, 0,
-1414725632, 860312129, 5505024, 0, 45, 0, 45, 0,
-1380013139, 13127, 84, 1414725632, 1380405825, 1414725681, 3362885, 2949120,
-0, 5505024, 0, 45, 0, 45, 0, 45,
-0, 98, 2949120, 0, 2949120, 0, 1414725632, 860312129,
-5505024, 0, 45, 0, 45, 0, 1380013139, 13127,
-84, 2949120, 0, 2949120, 0, 1280507904, 1096238145, 10964044,
-0, 1145130067, 1280065879, 45, 0, 45, 0, 181,
-2949120, 0, 1414725632, 3559493, 2949120, 0, 11927552, 0,
-1145130067, 1280065879, 1346720851, 54, 45, 0, 189, 2949120,
-0, 2949120, 0, 2949120, 0, 11927552, 0, 1145130067,
-1280065879, 1346720851, 54, 45, 0, 167, 2949120, 0,
-2949120, 0, 2949120, 0, 11010048, 0, 45, 0,
-45, 0, 1145130067, 1280065879, 168, 2949120, 0, 2949120,
-0, 1280507904, 1096238145, 11095116, 0, 1145130067, 1280065879, 1145130067,
-1280065879, 45, 0, 169, 2949120, 0, 2949120, 0,
-2949120, 0, 11599872, 0, 45, 0, 45, 0,
-1145130067, 1280065879, 169, 1280507904, 1096238145, 1280527436, 1096238145, 2968652,
-0, 11075584, 0, 45, 0, 45, 0, 45,
-0, 171, 2949240, 0, 2949120, 0, 1465057280, 1095521073,
-11337796, 7340032, 45, 0, 45, 0, 1145130067, 1280065879,
-173, 1280507904, 1096238145, 1280527436, 1096238145, 2968652, 0, 11075584,
-0, 45, 0, 45, 0, 45, 0, 172,
-2949120, 0, 2949120, 0, 1280507904, 1096238145, 11095116, 0,
-1464816194, 12622, 1464816194, 12622, 45, 0, 170, 2949120,
-0, 2949120, 0, 2949120, 0, 11599872, 0, 1464816194,
-12622, 1464816194, 12622, 45, 0, 170, 2949120, 0,
-2949120, 0, 2949120, 0, 11206656, 0, 1464816194, 12622,
-1464816194, 12622, 45, 0, 170, 2949120, 0, 2949120,
-0, 2949120, 0, 11272192, 0, 45, 0, 45,
-0, 1464816194, 12622, 170, 2949120, 0, 2949120, 0,
-1380057088, 827217743, 11141120, 0, 45, 0, 45, 0,
-1464816194, 12622, 170, 2949120, 0, 2949120, 0, 1380057088,
-827217743, 11141120, 0, 45, 0, 45, 0, 1464816194,
-12622, 170, 2949120, 0, 2949120, 0, 1380057088, 827217743,
-11141120, 0, 45, 0, 45, 0, 1464816194, 875835726,
-174, 2949120, 0, 2949120, 0, 1380057088, 827217743, 11416628,
-0, 45, 0, 45, 0, 1464816194, 875835726, 174,
-2949120, 0, 2949120, 0, 1380057088, 827217743, 11416628, 0,
-45, 0, 45, 0, 1464816194, 12622, 170, 2949120,
-0, 2949120, 0, 1380057088, 827217743, 11141120, 0, 45,
-0, 45, 0, 1380929348, 1347376211, 177, 2949120, 0,
-2949120, 0, 1329856512, 1414746703, 11620431, 0, 45, 0,
-45, 0, 1380929348, 1347376211, 171, 2949120, 0, 2949120,
-0, 1329856512, 1414746703, 11227215, 0, 45, 0, 45,
-0, 1380929348, 1347376211, 172, 2949120, 0, 2949120, 0,
-1329856512, 1414746703, 11292751, 0, 45, 0, 1464816194, 875835726,
-45, 0, 170, 2949120, 0, 2949120, 0, 2949120,
-0, 11403264, 0, 45, 0, 1464816194, 875835726, 45,
-0, 170, 2949120, 0, 2949120, 0, 2949120, 0,
-11403264, 0, 45, 0, 45, 0, 1145130067, 1280065879,
-168, 1280507904, 1096238145, 1280527436, 1096238145, 2968652, 0, 11075584,
-0, 45, 0, 45, 0, 45, 0, 168,
-2949120, 0, 1380057088, 1213093711, 2967381, 0, 11468800, 0,
-45, 0, 45, 0, 45, 0, 176, 2949120,
-0, 1380057088, 1213093711, 2967381, 0, 11468800, 0, 45,
-0, 45, 0, 45, 0, 176, 2949120, 0,
-1380057088, 1213093711, 2967381, 0, 11468800, 0, 45, 0,
-45, 0, 45, 0, 176, 2949120, 0, 1380057088,
-1213093711, 2967381, 0, 11468800, 0, 45, 0, 45,
-0, 45, 0, 176, 2949120, 0, 1380057088, 961435471,
-2949174, 0, 11468800, 0, 45, 0, 45, 0,
-45, 0, 169, 2949120, 0, 1380057088, 961435471, 2949174,
-0, 11468800, 0, 45, 0, 45, 0, 45,
-0, 169, 2949120, 0, 1380057088, 961435471, 2949174, 0,
-11468800, 0, 45, 0, 45, 0, 45, 0,
-169, 2949120, 0, 1380057088, 961435471, 2949174, 0, 11468800,
-0, 45, 0, 45, 0, 45, 0, 169,
-2949120, 0, 1380057088, 961435471, 2949174, 0, 11468800, 0,
-45, 0, 45, 0, 45, 0, 169, 2949120,
-0, 1380057088, 961435471, 2949174, 0, 11468800, 0, 45,
-0, 45, 0, 45, 0, 169, 2949120, 0,
-1380057088, 961435471, 2949174, 0, 11468800, 0, 45, 0,
-45, 0, 45, 0, 169, 2949120, 0, 1380057088,
-961435471, 2949174, 0, 11468800, 0, 45, 0, 45,
-0, 45, 0, 169, 1280507904, 1096238145, 1280527436, 1096238145,
-2968652, 0, 11075584, 0, 45, 0, 45, 0,
-45, 0, 173, 1280507904, 1096238145, 1280527436, 1096238145, 2968652,
-0, 11075584, 0, 45, 0, 45, 0, 45,
-0, 173, 1380057088, 827217743, 1380070452, 827217743, 2962484, 0,
-131072, 0, 45, 0, 45, 0, 45, 0,
-3, 1380057088, 827217743, 1380070452, 827217743, 2962484, 0, 131072,
-0, 45, 0, 45, 0, 45, 0, 3,
-2949120, 0, 2949120, 0, 1380057088, 827217743, 131072, 0,
-45, 0, 45, 0, 1162564942, 1145130067, 39, 2949120,
-0, 2949120, 0, 1280507904, 1230128193, 2568784, 0, 45,
-0, 45, 0, 1162564942, 1145130067, 39, 2949120, 0,
-2949120, 0, 1280507904, 1230128193, 2568784, 0, 45, 0,
-45, 0, 1162564942, 1145130067, 39, 2949120, 0, 2949120,
-0, 1280507904, 1230128193, 2568784, 0, 45, 0, 45,
-0, 1162564942, 1145130067, 39, 2949120, 0, 2949120, 0,
-1431175168, 1280525643, 2573377, 0, 1145130067, 1280065879, 1162564942, 1145130067,
-45, 0, 39, 2949120, 0, 2949120, 0, 2949120,
-0, 2293760, 0, 45, 0, 1162564942, 13362, 45,
-0, 39, 2949120, 0, 2949120, 0, 2949120, 0,
-2621440, 0, 45, 0, 1162564942, 13362, 45, 0,
-39, 2949120, 0, 2949120, 0, 2949120, 0, 2621440,
-0, 45, 0, 1162564942, 13362, 45, 0, 39,
-2949120, 0, 2949120, 0, 2949120, 0, 2621440, 0,
-45, 0, 1162564942, 13362, 45, 0, 39, 2949120,
-0, 2949120, 0, 2949120, 0, 2621440, 0, 45,
-0, 45, 0, 1313821779, 13125, 40, 2949240, 0,
-2949120, 0, 1465057280, 1330926385, 2699598, 0, 45, 0,
-45, 0, 1313821779, 13125, 40, 2949120, 0, 2949120,
-0, 1414725632, 860180047, 2621440, 0, 1313821779, 13125, 1313821779,
-13125, 45, 0, 40, 2949120, 0, 2949120, 0,
-2949120, 0, 2686976, 0, 1313821779, 13125, 1313821779, 13125,
-45, 0, 40, 2949120, 0, 2949120, 0, 2949120,
-0, 2686976, 0, 1313821779, 13125, 1313821779, 13125, 45,
-0, 40, 2949120, 0, 2949120, 0, 2949120, 0,
-2686976, 0, 45, 0, 45, 0, 1380013139, 860766548,
-35, 2949120, 0, 2949120, 0, 1431502848, 1380929616, 2306644,
-0, 45, 0, 45, 0, 1380013139, 860766548, 35,
-2949120, 0, 2949120, 0, 1431502848, 1380929616, 2306644, 0,
-45, 0, 45, 0, 1380013139, 843989332, 4194454, 2949120,
-0, 2949120, 0, 1414725632, 1096045121, 9908814, 0, 45,
-0, 45, 0, 1380013139, 843989332, 3145881, 2949120, 0,
-2949120, 0, 1414725632, 1096045121, 9843278, 0, 45, 0,
-1346720851, 54, 45, 0, 150, 1414725632, 1096045121, 2961998,
-0, 2949120, 0, 9895936, 0, 45, 0, 1346720851,
-54, 45, 0, 151, 1414725632, 1096045121, 2961998, 0,
-2949120, 0, 9961472, 0, 45, 0, 1346720851, 54,
-45, 0, 152, 1414725632, 1096045121, 2961998, 0, 2949120,
-0, 10027008, 0, 45, 0, 1346720851, 54, 45,
-0, 153, 1414725632, 1096045121, 2961998, 0, 2949120, 0,
-10092544, 0, 45, 0, 1346720851, 54, 45, 0,
-154, 1414725632, 1096045121, 2961998, 0, 2949120, 0, 10158080,
-4, 45, 0, 45, 0, 1347442003, 844386895, 262298,
-2949120, 0, 2949120, 0, 1431502848, 1380929616, 10039892, 0,
-45, 0, 45, 0, 1380013139, 843989332, 1573016, 2949120,
-0, 2949120, 0, 1414725632, 1096045121, 9908814, 0, 1380013139,
-827212116, 1346720851, 54, 45, 0, 161, 1414725632, 1096045121,
-2961742, 0, 2949120, 0, 10616832, 0, 45, 0,
-45, 0, 1380013139, 843989332, 180, 2949120, 0, 2949120,
-0, 1229717504, 3425620, 11796480, 0, 45, 0, 45,
-0, 1380013139, 12615, 262322, 2949120, 0, 2949120, 0,
-1431502848, 1380929616, 10629716, 0, 45, 0, 45, 0,
-1145130067, 1280065879, 141, 2949120, 0, 2949120, 0, 1280507904,
-1096238145, 11095116, 0, 1145130067, 1280065879, 1145130067, 1280065879, 45,
-0, 169, 2949120, 0, 2949120, 0, 2949120, 0,
-11730944, 0, 45, 0, 45, 0, 1145130067, 1280065879,
-169, 1414725680, 826757697, 1414725632, 826757697, 2949120, 0, 11665408,
-0, 45, 0, 45, 0, 45, 0, 262323,
-2949120, 0, 2949120, 0, 1431502848, 1380929616, 11678292, 0,
-45, 0, 45, 0, 1380013139, 12615, 178, 2949120,
-0, 2949120, 0, 1329856512, 1414746703, 11751503, 0, 45,
-0, 45, 0, 1380929348, 1347376211, 179, 1414725632, 1096045121,
-1414738510, 3559493, 2949120, 0, 10616832, 0, 45, 0,
-45, 0, 45, 0, 143, 2949120, 0, 2949120,
-0, 1414725632, 1096045121, 10629710, 0, 45, 0, 45,
-0, 1145130067, 1280065879, 163, 2949120, 0, 2949120, 0,
-1414725632, 826757697, 11665408, 0, 1380013139, 827212116, 1413565520, 49,
-45, 0, 178, 2949120, 0, 1280311296, 3232833, 2949120,
-0, 11665408, 0, 1380013139, 843989332, 1380013139, 843989332, 45,
-0, 162, 1414725632, 1096045121, 1414738510, 1096045121, 2961998, 0,
-11796480, 0, 45, 0, 45, 0, 1380013139, 843989332,
-152, 2949120, 0, 2949120, 0, 1431502848, 1380929616, 9974356,
-0, 45, 0, 45, 0, 1380013139, 12615, 178,
-2949120, 0, 2949120, 0, 1431502848, 1380929616, 11678292, 0,
-45, 0, 45, 0, 1347442003, 844386895, 143, 2949120,
-0, 2949120, 0, 1280507904, 1096238145, 9391180, 0, 45,
-0, 45, 0, 1162889552, 50, 137, 2949120, 0,
-2949120, 0, 1229979648, 3294544, 8978432, 0, 1162889552, 50,
-1347442003, 844386895, 45, 0, 137, 1380384768, 1096046913, 2968652,
-0, 2949120, 0, 9043968, 0, 45, 0, 45,
-0, 1162889552, 50, 120, 2949120, 0, 2949120, 0,
-1229979648, 3294544, 7929856, 0, 45, 0, 45, 0,
-1162889552, 50, 121, 2949120, 0, 2949120, 0, 1229979648,
-3294544, 7864320, 0, 1162889552, 50, 45, 0, 45,
-0, 120, 1380384768, 1096046913, 2968652, 0, 2949120, 0,
-7929856, 0, 45, 0, 45, 0, 1380013139, 843989332,
-36, 2949120, 0, 2949120, 0, 1414725632, 1096045121, 2372174,
-0, 45, 0, 45, 0, 1347442003, 844386895, 36,
-2949120, 0, 2949120, 0, 1431502848, 1380929616, 2372180, 7864320,
-1145130067, 1280065879, 1162564942, 1145130067, 45, 0, 142, 1280507904,
-1096238145, 1431194700, 1280525643, 2966593, 0, 9371648, 0, 45,
-0, 45, 0, 1347442003, 844386895, 138, 2949120, 0,
-2949120, 0, 1431502848, 1380929616, 9056852, 0, 1380013139, 860766548,
-45, 0, 45, 0, 138, 2949120, 0, 2949120,
-0, 2949120, 0, 9175040, 96, 45, 0, 45,
-0, 1380013139, 843989332, 138, 1329856512, 3232335, 2949120, 0,
-2949120, 0, 9109504, 0, 45, 0, 45, 0,
-45, 0, 140, 2949120, 0, 2949120, 0, 1329856512,
-1381257807, 9194305, 0, 45, 0, 45, 0, 1380929348,
-1262572116, 140, 2949120, 0, 2949120, 0, 1280507904, 1096238145,
-9129036, 0, 45, 0, 45, 0, 1145130067, 1280065879,
-139, 2949120, 0, 2949120, 0, 1280507904, 1096238145, 8932428,
-0, 45, 0, 45, 0, 1145130067, 1280065879, 136,
-2949120, 0, 2949120, 0, 1280507904, 1096238145, 8866892, 0,
-45, 0, 45, 0, 1145130067, 1280065879, 134, 2949120,
-0, 2949120, 0, 1280507904, 1096238145, 8735820, 0, 45,
-0, 45, 0, 1145130067, 1280065879, 133, 2949120, 0,
-2949120, 0, 1280507904, 1096238145, 8801356, 0, 45, 0,
-45, 0, 1145130067, 1280065879, 132, 2949120, 0, 2949120,
-0, 1280507904, 1096238145, 8604748, 0, 45, 0, 45,
-0, 1145130067, 1280065879, 131, 2949120, 0, 2949120, 0,
-1280507904, 1096238145, 8670284, 0, 45, 0, 45, 0,
-1145130067, 1280065879, 119, 2949120, 0, 2949120, 0, 1280507904,
-1096238145, 7818316, 0, 45, 0, 45, 0, 1145130067,
-1280065879, 118, 2949120, 0, 2949120, 0, 1280507904, 1096238145,
-7752780, 32, 1145130067, 1280065879, 1346720851, 54, 45, 0,
-136, 2949120, 0, 2949120, 0, 2949120, 0, 9109504,
-32, 1145130067, 1280065879, 1346720851, 54, 45, 0, 135,
-2949120, 0, 2949120, 0, 2949120, 0, 8912896, 32,
-1145130067, 1280065879, 1346720851, 54, 45, 0, 134, 2949120,
-0, 2949120, 0, 2949120, 0, 8847360, 32, 1145130067,
-1280065879, 1346720851, 54, 45, 0, 133, 2949120, 0,
-2949120, 0, 2949120, 0, 8781824, 32, 1145130067, 1280065879,
-1346720851, 54, 45, 0, 132, 2949120, 0, 2949120,
-0, 2949120, 0, 8716288, 32, 1145130067, 1280065879, 1346720851,
-54, 45, 0, 131, 2949120, 0, 2949120, 0,
-2949120, 0, 8650752, 32, 1145130067, 1280065879, 1346720851, 54,
-45, 0, 119, 2949120, 0, 2949120, 0, 2949120,
-0, 8585216, 32, 1145130067, 1280065879, 1346720851, 54, 45,
-0, 118, 2949120, 0, 2949120, 0, 2949120, 0,
-7798784, 32, 1145130067, 1280065879, 1346720851, 54, 45, 0,
-117, 2949120, 0, 2949120, 0, 2949120, 0, 7733248,
-0, 45, 0, 45, 0, 1145130067, 1280065879, 262261,
-2949120, 0, 2949120, 0, 1431502848, 1380929616, 7680596, 4,
-45, 0, 45, 0, 1347442003, 844386895, 117, 2949120,
-0, 2949120, 0, 1280507904, 1096238145, 7687244, 32, 1145130067,
-1280065879, 45, 0, 45, 0, 117, 2949120, 0,
-2949120, 0, 2949120, 0, 7995392, 0, 45, 0,
-45, 0, 1347442003, 844386895, 138, 2949120, 0, 2949120,
-0, 1414725632, 1096045121, 9056846, 0, 45, 0, 45,
-0, 1347442003, 844386895, 138, 2949120, 0, 2949120, 0,
-1380057088, 1196316495, 8080978, 0, 45, 0, 45, 0,
-1464816194, 1314015054, 123, 2949120, 0, 2949120, 0, 1229717504,
-3491156, 8126464, 0, 45, 0, 45, 0, 1163151692,
-53, 124, 1380057088, 1196316495, 2969170, 0, 2949120, 0,
-8060928, 0, 45, 0, 45, 0, 45, 0,
-124, 2949120, 0, 2949120, 0, 1380057088, 1196316495, 8080978,
-0, 45, 0, 45, 0, 1464816194, 1314015054, 123,
-2949120, 0, 2949120, 0, 1229717504, 3491156, 8454144, 0,
-45, 0, 45, 0, 1163151692, 53, 129, 1380057088,
-1196316495, 2969170, 0, 2949120, 0, 8060928, 0, 45,
-0, 45, 0, 45, 0, 129, 1229979664, 3294544,
-1465057280, 1346981937, 2949189, 0, 7864320, 0, 45, 0,
-45, 0, 45, 0, 18874493, 2949120, 0, 2949120,
-0, 1414725632, 1096045121, 10564174, 48, 45, 0, 45,
-0, 1380013139, 843989332, 161, 1380057088, 827217743, 1414725632, 3559493,
-2949120, 0, 8388608, 0, 45, 0, 45, 0,
-45, 0, 123, 2949120, 0, 2949120, 0, 1380057088,
-827217743, 8388608, 0, 45, 0, 45, 0, 1464816194,
-12622, 126, 2949120, 0, 2949120, 0, 1380057088, 827217743,
-3997696, 0, 45, 0, 45, 0, 1464816194, 12622,
-128, 2949120, 0, 2949120, 0, 1380057088, 827217743, 3997696,
-0, 45, 0, 45, 0, 1464816194, 12622, 126,
-2949120, 0, 2949120, 0, 1380057088, 827217743, 3932160, 0,
-45, 0, 45, 0, 1464816194, 12622, 60, 2949120,
-0, 2949120, 0, 1380057088, 827217743, 3866624, 0, 45,
-0, 45, 0, 1464816194, 12622, 56, 2949120, 0,
-2949120, 0, 1380057088, 827217743, 3670016, 0, 45, 0,
-45, 0, 1464816194, 12622, 59, 2949120, 0, 2949120,
-0, 1380057088, 827217743, 3473408, 0, 45, 0, 45,
-0, 1464816194, 12622, 53, 2949120, 0, 2949120, 0,
-1380057088, 827217743, 2818048, 0, 1464816194, 12622, 1464816194, 12622,
-45, 0, 43, 2949120, 0, 2949120, 0, 2949120,
-0, 3735552, 0, 45, 0, 45, 0, 1464816194,
-12622, 43, 1380057088, 827217743, 1380057088, 827217743, 2949120, 0,
-2818048, 0, 45, 0, 45, 0, 45, 0,
-58, 2949120, 0, 2949120, 0, 1380057088, 827217743, 2818048,
-0, 1464816194, 12622, 1464816194, 12622, 45, 0, 43,
-2949120, 0, 2949120, 0, 2949120, 0, 3276800, 0,
-1464816194, 12622, 1464816194, 12622, 45, 0, 43, 2949120,
-0, 2949120, 0, 2949120, 0, 2883584, 0, 45,
-0, 45, 0, 1464816194, 12622, 43, 1380057088, 827217743,
-1380057088, 827217743, 2949120, 0, 2818048, 0, 45, 0,
-45, 0, 45, 0, 46, 2949120, 0, 2949120,
-0, 1380057088, 827217743, 2818048, 0, 1464816194, 12622, 1464816194,
-12622, 45, 0, 43, 2949120, 0, 2949120, 0,
-2949120, 0, 2949120, 0, 45, 0, 45, 0,
-1380929348, 1347376211, 45, 2949120, 0, 2949120, 0, 1329856512,
-1414746703, 2969679, 0, 45, 0, 45, 0, 1380929348,
-1347376211, 46, 2949120, 0, 2949120, 0, 1329856512, 1414746703,
-3035215, 0, 45, 0, 45, 0, 1380929348, 1347376211,
-44, 2949120, 0, 2949120, 0, 1329856512, 1414746703, 3297359,
-0, 45, 0, 45, 0, 1380929348, 1347376211, 50,
-2949120, 0, 2949120, 0, 1329856512, 1414746703, 3821647, 0,
-45, 0, 45, 0, 1380929348, 1347376211, 58, 2949120,
-0, 2949120, 0, 1329856512, 1414746703, 3756111, 0, 45,
-0, 45, 0, 1380929348, 1347376211, 57, 2949120, 0,
-2949120, 0, 1380057088, 827217743, 2752512, 0, 1464816194, 12622,
-1464816194, 12622, 45, 0, 42, 2949120, 0, 2949120,
-0, 2949120, 0, 3735552, 0, 1464816194, 12622, 1464816194,
-12622, 45, 0, 42, 2949120, 0, 2949120, 0,
-2949120, 0, 3801088, 0, 45, 0, 45, 0,
-1464816194, 12622, 42, 1380057088, 827217743, 1380057088, 827217743, 2949120,
-0, 2752512, 0, 45, 0, 45, 0, 45,
-0, 46, 2949120, 0, 2949120, 0, 1380057088, 827217743,
-2752512, 0, 1464816194, 12622, 1464816194, 12622, 45, 0,
-42, 2949120, 0, 2949120, 0, 2949120, 0, 2949120,
-0, 45, 0, 45, 0, 1464816194, 12622, 42,
-2949120, 0, 2949120, 0, 1380057088, 827217743, 2752512, 0,
-45, 0, 45, 0, 1464816194, 12622, 42, 2949120,
-0, 2949120, 0, 1329856512, 1414746703, 2904143, 0, 1464816194,
-12622, 1464816194, 12622, 45, 0, 42, 2949120, 0,
-2949120, 0, 2949120, 0, 2883584, 0, 45, 0,
-45, 0, 1464816194, 12622, 42, 1380057088, 827217743, 1380057088,
-827217743, 2949120, 0, 2752512, 0, 45, 0, 45,
-0, 45, 0, 50, 2949120, 0, 2949120, 0,
-1380057088, 827217743, 2752512, 0, 45, 0, 45, 0,
-1464816194, 12622, 42, 2949120, 0, 2949120, 0, 1380057088,
-827217743, 2752512, 0, 45, 0, 45, 0, 1464816194,
-12622, 42, 2949120, 0, 2949120, 0, 1380057088, 1213093711,
-3098453, 0, 45, 0, 45, 0, 1464816194, 1196771406,
-47, 2949120, 0, 2949120, 0, 1380057088, 1213093711, 3098453,
-0, 45, 0, 45, 0, 1464816194, 1196771406, 47,
-2949120, 0, 2949120, 0, 1380057088, 1213093711, 3098453, 0,
-45, 0, 45, 0, 1464816194, 1196771406, 47, 2949120,
-0, 2949120, 0, 1380057088, 827217743, 2752512, 0, 45,
-0, 45, 0, 1464816194, 12622, 43, 2949120, 0,
-2949120, 0, 1380057088, 827217743, 3407872, 0, 1464816194, 12622,
-1346720851, 54, 45, 0, 127, 1380057088, 827217743, 2949120,
-0, 2949120, 0, 8388608, 0, 1464816194, 12622, 1346720851,
-54, 45, 0, 126, 2949120, 0, 2949120, 0,
-2949120, 0, 8323072, 0, 1464816194, 12622, 1346720851, 54,
-45, 0, 61, 2949120, 0, 2949120, 0, 2949120,
-0, 8257536, 0, 1464816194, 12622, 1346720851, 54, 45,
-0, 60, 2949120, 0, 2949120, 0, 2949120, 0,
-3997696, 0, 1464816194, 12622, 1346720851, 54, 45, 0,
-59, 2949120, 0, 2949120, 0, 2949120, 0, 3932160,
-0, 1464816194, 12622, 1346720851, 54, 45, 0, 56,
-2949120, 0, 2949120, 0, 2949120, 0, 3866624, 0,
-1464816194, 12622, 1346720851, 54, 45, 0, 53, 2949120,
-0, 2949120, 0, 2949120, 0, 3670016, 0, 1464816194,
-12622, 1346720851, 54, 45, 0, 52, 1380057088, 827217743,
-2949120, 0, 2949120, 0, 3473408, 0, 1464816194, 12622,
-45, 0, 45, 0, 43, 2949120, 0, 2949120,
-0, 2949120, 0, 3538944, 0, 45, 0, 45,
-0, 1464816194, 12622, 52, 1480916992, 1329878089, 2970191, 0,
-2949120, 0, 3407872, 0, 45, 0, 45, 0,
-45, 0, 55, 2949120, 0, 2949120, 0, 1380057088,
-827217743, 3407872, 4, 45, 0, 45, 0, 1347442003,
-844386895, 262196, 2949120, 0, 2949120, 0, 1431502848, 1380929616,
-3420756, 0, 45, 0, 45, 0, 1464816194, 12622,
-262196, 2949120, 0, 2949120, 0, 1431502848, 1380929616, 8401492,
-4, 45, 0, 45, 0, 1347442003, 844386895, 128,
-2949120, 0, 2949120, 0, 1329856512, 1381257807, 3623745, 0,
-45, 0, 45, 0, 1380929348, 1347376211, 54, 2949120,
-0, 2949120, 0, 1329856512, 1381257807, 3623745, 0, 45,
-0, 45, 0, 1380929348, 1347376211, 54, 1480916992, 1329878089,
-2970191, 0, 2949120, 0, 3538944, 0, 45, 0,
-45, 0, 45, 0, 55, 1380057088, 1213093711, 1380075349,
-1213093711, 2967381, 0, 2752512, 0, 45, 0, 45,
-0, 45, 0, 47, 1380057088, 1213093711, 1380075349, 1213093711,
-2967381, 0, 2752512, 0, 45, 0, 45, 0,
-45, 0, 47, 1380057088, 1213093711, 1380075349, 1213093711, 2967381,
-0, 2752512, 0, 45, 0, 45, 0, 45,
-0, 47, 1163132928, 1279350603, 1163145548, 1279350603, 2961740, 0,
-3211264, 0, 1464550740, 827083841, 45, 0, 45, 0,
-43, 1163132928, 1279350603, 1163145548, 1279350603, 2961740, 0, 3211264,
-0, 1464550740, 827083841, 45, 0, 45, 0, 4194347,
-1163132928, 1279350603, 1163145548, 1279350603, 2961740, 0, 3211264, 64,
-1464550740, 827083841, 45, 0, 45, 0, 43, 2949120,
-0, 2949120, 0, 1163132928, 1279350603, 3159372, 0, 45,
-0, 45, 0, 1127307091, 5262671, 48, 2949120, 0,
-2949120, 0, 1163132928, 1279350603, 3159372, 0, 45, 0,
-45, 0, 1464816194, 12622, 43, 2949120, 0, 2949120,
-0, 1431502848, 1380929616, 2830932, 0, 45, 0, 45,
-0, 1464816194, 12622, 43, 2949120, 0, 2949120, 0,
-1431502848, 1380929616, 2830932, 32, 45, 0, 45, 0,
-1380013139, 843989332, 393231, 2949120, 0, 2949120, 0, 1431502848,
-1380929616, 995924, 6, 45, 0, 45, 0, 1347442003,
-844386895, 65, 2949120, 0, 2949120, 0, 1414725632, 1096045121,
-4272718, 0, 45, 0, 45, 0, 1347442003, 844386895,
-1573042, 2949120, 0, 2949120, 0, 1414725632, 826757697, 11665408,
-0, 1347243843, 1162627412, 45, 0, 45, 0, 148,
-2949120, 0, 2949120, 0, 2949120, 0, 5701632, 0,
-1347243843, 1162627412, 45, 0, 45, 0, 87, 2949120,
-0, 2949120, 0, 2949120, 0, 9568256, 0, 1145130067,
-1280065879, 1145130067, 1280065879, 45, 0, 192, 2949120, 0,
-2949120, 0, 2949120, 0, 12713984, 0, 45, 0,
-45, 0, 1145130067, 1280065879, 194, 2949120, 0, 2949120,
-0, 1280507904, 1096238145, 12733516, 0, 45, 0, 45,
-0, 1145130067, 1280065879, 193, 2949120, 0, 2949120, 0,
-1280507904, 1096238145, 12667980, 0, 45, 0, 45, 0,
-1145130067, 1280065879, 193, 1280507904, 1096238145, 1280527436, 1096238145, 2968652,
-0, 12648448, 0, 45, 0, 45, 0, 45,
-0, 194, 2949120, 0, 2949120, 0, 1329790976, 1096044621,
-5721164, 0, 45, 0, 45, 0, 1347243843, 1280065876,
-12582999, 1329790976, 1096044621, 1329810508, 1096044621, 2968652, 0, 6881280,
-0, 45, 0, 45, 0, 45, 0, 12583018,
-1329790976, 1096044621, 1329810508, 1096044621, 2968652, 0, 5701632, 0,
-45, 0, 45, 0, 45, 0, 262250, 2949120,
-0, 2949120, 0, 1431502848, 1380929616, 5714516, 4, 45,
-0, 45, 0, 1347442003, 844386895, 87, 2949120, 0,
-2949120, 0, 1329856512, 1414746703, 6967375, 0, 45, 0,
-45, 0, 1380929348, 1347376211, 106, 2949120, 0, 2949120,
-0, 1163132928, 1279350603, 6894156, 0, 45, 0, 45,
-0, 1464550740, 843861057, 105, 2949120, 0, 2949120, 0,
-1163132928, 1279350603, 6894156, 0, 45, 0, 45, 0,
-1464550740, 843861057, 105, 2949120, 0, 2949120, 0, 1163132928,
-1279350603, 6894156, 4, 45, 0, 45, 0, 1347442003,
-844386895, 191, 2949120, 0, 2949120, 0, 1280507904, 1096238145,
-12536908, 0, 1145130067, 1280065879, 1145130067, 1280065879, 45, 0,
-163, 1380384768, 1096046913, 2968652, 0, 2949120, 0, 9306112,
-0, 1145130067, 1280065879, 1145130067, 1280065879, 45, 0, 163,
-1380384768, 1096046913, 2968652, 0, 2949120, 0, 9306112, 0,
-1145130067, 1280065879, 1145130067, 1280065879, 45, 0, 144, 1380384768,
-1096046913, 2968652, 0, 2949120, 0, 9306112, 0, 1145130067,
-1280065879, 1145130067, 1280065879, 45, 0, 144, 1380384768, 1096046913,
-2968652, 0, 2949120, 0, 9306112, 0, 1145130067, 1280065879,
-1145130067, 1280065879, 45, 0, 141, 1380384768, 1096046913, 2968652,
-0, 2949120, 0, 9306112, 0, 1145130067, 1280065879, 1145130067,
-1280065879, 45, 0, 141, 1380384768, 1096046913, 2968652, 0,
-2949120, 0, 9306112, 0, 1145130067, 1280065879, 1145130067, 1280065879,
-45, 0, 141, 1380384768, 1096046913, 2968652, 0, 2949120,
-0, 9306112, 0, 1145130067, 1280065879, 1145130067, 1280065879, 45,
-0, 141, 1380384768, 1096046913, 2968652, 0, 2949120, 0,
-9306112, 0, 1145130067, 1280065879, 1145130067, 1280065879, 45, 0,
-141, 1380384768, 1096046913, 2968652, 0, 2949120, 0, 9306112,
-7864320, 1145130067, 1280065879, 1162564942, 1145130067, 45, 0, 142,
-1280507904, 1096238145, 1431194700, 1280525643, 2966593, 0, 9371648, 0,
-1380013139, 827212116, 1413565520, 49, 45, 0, 178, 1414725632,
-1096045121, 1280323918, 3232833, 2949120, 0, 11796480, 0, 45,
-0, 45, 0, 1145130067, 1280065879, 262287, 2949120, 0,
-2949120, 0, 1431502848, 1380929616, 9384532, 0, 45, 0,
-45, 0, 1380929348, 4474194, 38, 2949120, 0, 2949120,
-0, 1329856512, 1163022927, 2490436, 0, 45, 0, 45,
-0, 1380929348, 4474194, 38, 2949120, 0, 2949120, 0,
-1329856512, 1163022927, 2490436, 0, 45, 0, 45, 0,
-1145130067, 1280065879, 144, 2949240, 0, 2949120, 0, 1280507904,
-1096238145, 9325644, 0, 45, 0, 45, 0, 1145130067,
-1280065879, 144, 2949120, 0, 2949120, 0, 1280507904, 1330660417,
-9458505, 0, 45, 0, 45, 0, 1145130067, 1280065879,
-163, 2949120, 0, 2949120, 0, 1280507904, 1330660417, 10703689,
-0, 45, 0, 45, 0, 1145130067, 1280065879, 163,
-2949120, 0, 2949120, 0, 1280507904, 1096238145, 9260108, 0,
-45, 0, 45, 0, 1145130067, 1397313360, 141, 1480916992,
-1230197833, 2969159, 0, 2949120, 0, 2818048, 0, 45,
-0, 1347442003, 844386895, 45, 0, 2097203, 1480916992, 1230197833,
-2969159, 0, 2949120, 0, 2818048, 0, 45, 0,
-1347442003, 844386895, 45, 0, 51, 1480916992, 1230197833, 2969159,
-0, 2949120, 0, 2818048, 0, 45, 0, 1347442003,
-844386895, 45, 0, 2097203, 1480916992, 1230197833, 2969159, 0,
-2949120, 0, 2818048, 0, 45, 0, 1347442003, 844386895,
-45, 0, 51, 2949120, 0, 1431502848, 1380929616, 2962004,
-0, 3145728, 0, 1464550740, 843861057, 45, 0, 45,
-0, 18874417, 2949120, 0, 2949120, 0, 1414725632, 1096045121,
-5386830, 216, 45, 0, 45, 0, 1380013139, 843989332,
-9437265, 2949120, 0, 2949120, 0, 1414725632, 1096045121, 5255758,
-72, 45, 0, 45, 0, 1380013139, 843989332, 79,
-2949120, 0, 2949120, 0, 1414725632, 1096045121, 5059150, 0,
-45, 0, 45, 0, 1380013139, 843989332, 4718674, 2949120,
-0, 2949120, 0, 1414725632, 1096045121, 5321294, 144, 45,
-0, 45, 0, 1380013139, 843989332, 14155856, 2949120, 0,
-2949120, 0, 1414725632, 1096045121, 5190222, 288, 45, 0,
-45, 0, 1380013139, 843989332, 262221, 1414725632, 1096045121, 1414738510,
-3493957, 2949120, 0, 5308416, 0, 1497453127, 1280065876, 45,
-0, 45, 0, 262226, 1414725632, 1096045121, 1414738510, 3493957,
-2949120, 0, 5242880, 0, 1497453127, 1280065876, 45, 0,
-45, 0, 262225, 1414725632, 1096045121, 1414738510, 3493957, 2949120,
-0, 5177344, 0, 1497453127, 1280065876, 45, 0, 45,
-0, 262224, 1414725632, 1096045121, 1414738510, 3493957, 2949120, 0,
-5046272, 0, 1497453127, 1280065876, 45, 0, 45, 0,
-262223, 1414725632, 1096045121, 1414738510, 3493957, 2949120, 0, 4980736,
-0, 1380013139, 843989332, 45, 0, 45, 0, 77,
-2949120, 0, 2949120, 0, 1380057088, 827217743, 131072, 0,
-45, 0, 1346720851, 53, 45, 0, 9, 1380384768,
-1096046913, 2968652, 0, 2949120, 0, 655360, 0, 45,
-0, 45, 0, 1380013139, 843989332, 10, 2949120, 0,
-2949120, 0, 1431502848, 1380929616, 668244, 48, 45, 0,
-45, 0, 1380013139, 843989332, 10, 2949120, 0, 2949120,
-0, 1431502848, 1380929616, 668244, 288, 45, 0, 45,
-0, 1380013139, 843989332, 14155785, 2949120, 0, 2949120, 0,
-1414725632, 1096045121, 537166, 144, 45, 0, 45, 0,
-1380013139, 843989332, 4718599, 2949120, 0, 2949120, 0, 1414725632,
-1096045121, 406094, 0, 45, 0, 45, 0, 1380013139,
-843989332, 5, 2949120, 0, 2949120, 0, 1414725632, 1096045121,
-602702, 72, 45, 0, 45, 0, 1380013139, 843989332,
-9437192, 2949120, 0, 2949120, 0, 1414725632, 1096045121, 471630,
-216, 45, 0, 45, 0, 1380013139, 843989332, 18874374,
-2949120, 0, 2949120, 0, 1414725632, 1096045121, 340558, 0,
-45, 0, 1346720851, 53, 45, 0, 8, 1380384768,
-1096046913, 2968652, 0, 2949120, 0, 589824, 0, 45,
-0, 1346720851, 53, 45, 0, 7, 1380384768, 1096046913,
-2968652, 0, 2949120, 0, 524288, 0, 45, 0,
-1346720851, 53, 45, 0, 6, 1380384768, 1096046913, 2968652,
-0, 2949120, 0, 458752, 0, 45, 0, 1346720851,
-53, 45, 0, 5, 1380384768, 1096046913, 2968652, 0,
-2949120, 0, 393216, 0, 45, 0, 1346720851, 53,
-45, 0, 4, 1414725632, 1096045121, 2961998, 0, 2949120,
-0, 327680, 4, 45, 0, 45, 0, 1347442003,
-844386895, 76, 2949120, 0, 2949120, 0, 1414725632, 1096045121,
-4993614, 0, 45, 0, 45, 0, 1380013139, 843989332,
-262220, 2949120, 0, 2949120, 0, 1431502848, 1380929616, 4993620,
-4, 45, 0, 45, 0, 1347442003, 844386895, 4,
-2949120, 0, 2949120, 0, 1414725632, 1096045121, 275022, 0,
-45, 0, 45, 0, 1380013139, 843989332, 262148, 2949120,
-0, 2949120, 0, 1431502848, 1380929616, 275028, 524352, 45,
-0, 45, 0, 1380013139, 843989332, 64, 2949120, 0,
-2949120, 0, 1431502848, 1380929616, 4207188, 1048800, 45, 0,
-45, 0, 1380013139, 843989332, 14, 2949120, 0, 2949120,
-0, 1431502848, 1380929616, 930388, 0, 45, 0, 45,
-0, 1380013139, 843989332, 3145883, 2949120, 0, 2949120, 0,
-1414725632, 1096045121, 10236494, 96, 45, 0, 45, 0,
-1380013139, 843989332, 9437341, 2949120, 0, 2949120, 0, 1414725632,
-1096045121, 10367566, 192, 45, 0, 45, 0, 1380013139,
-843989332, 15728798, 2949120, 0, 2949120, 0, 1414725632, 1096045121,
-10302030, 288, 45, 0, 45, 0, 1380013139, 843989332,
-22020252, 2949120, 0, 2949120, 0, 1414725632, 1096045121, 10170958,
-192, 45, 0, 45, 0, 1380013139, 843989332, 15728799,
-2949120, 0, 2949120, 0, 1414725632, 1096045121, 10498638, 96,
-45, 0, 45, 0, 1380013139, 843989332, 9437344, 2949120,
-0, 2949120, 0, 1414725632, 1096045121, 10433102, 0, 45,
-0, 1346720851, 54, 45, 0, 155, 1414725632, 1096045121,
-2961998, 0, 2949120, 0, 10223616, 0, 45, 0,
-1346720851, 54, 45, 0, 156, 1414725632, 1096045121, 2961998,
-0, 2949120, 0, 10289152, 0, 45, 0, 1346720851,
-54, 45, 0, 157, 1414725632, 1096045121, 2961998, 0,
-2949120, 0, 10354688, 0, 45, 0, 1346720851, 54,
-45, 0, 158, 1414725632, 1096045121, 2961998, 0, 2949120,
-0, 10420224, 0, 45, 0, 1346720851, 54, 45,
-0, 159, 1414725632, 1096045121, 2961998, 0, 2949120, 0,
-10485760, 0, 45, 0, 1346720851, 54, 45, 0,
-160, 1414725632, 1096045121, 2961998, 0, 2949120, 0, 10551296,
-0, 45, 0, 45, 0, 1380013139, 843989332, 262298,
-2949120, 0, 2949120, 0, 1431502848, 1380929616, 10105428, 0,
-45, 0, 45, 0, 1145130067, 1280065879, 141, 2949120,
-0, 2949120, 0, 1280507904, 1096238145, 9260108, 0, 45,
-0, 45, 0, 1145130067, 1280065879, 141, 2949120, 0,
-2949120, 0, 1280507904, 1096238145, 9391180, 0, 45, 0,
-45, 0, 1145130067, 1280065879, 262325, 2949120, 0, 2949120,
-0, 1431502848, 1380929616, 11874900, 0, 45, 0, 45,
-0, 1145130067, 1280065879, 181, 2949120, 0, 2949120, 0,
-1280507904, 1096238145, 11947084, 4, 45, 0, 45, 0,
-1347442003, 844386895, 182, 2949120, 0, 2949120, 0, 1414725632,
-860312129, 6422528, 0, 45, 0, 45, 0, 1347442003,
-844386895, 98, 2949120, 0, 2949120, 0, 1431502848, 1380929616,
-6435412, 0, 45, 0, 45, 0, 1380013139, 13127,
-98, 2949120, 0, 2949120, 0, 1380057088, 827217743, 8388608,
-0, 45, 0, 45, 0, 1464816194, 12622, 128,
-2949120, 0, 2949120, 0, 1380057088, 827217743, 8388608, 0,
-45, 0, 45, 0, 1464816194, 12622, 262272, 2949120,
-0, 2949120, 0, 1431502848, 1380929616, 8335956, 0, 45,
-0, 45, 0, 1464816194, 12622, 127, 2949120, 0,
-2949120, 0, 1380057088, 827217743, 8323072, 4, 45, 0,
-45, 0, 1347442003, 844386895, 262271, 2949120, 0, 2949120,
-0, 1431502848, 1380929616, 12989012, 0, 45, 0, 45,
-0, 1145130067, 1280065879, 198, 2949120, 0, 2949120, 0,
-1280507904, 1096238145, 12995660, 4, 45, 0, 45, 0,
-1347442003, 844386895, 8388806};
-extern const uint32_t e1m1_WADSegments[4389] = {
-17891600, 17825792, 0, 18088209, 18006016, 0, 17826071, 18169856,
-0, 18284820, 18251776, 1, 18678044, 18481152, 0, 53215517,
-18595840, 0, 18613037, 18825216, 6291456, 28967726, 32079872, 1048576,
-29032890, 32129024, 0, 53412283, 33225925, 0, 53477705, 21757518,
-0, 21561787, 32184002, 0, 29033263, 33193156, 63111169, 21300017,
-21381120, 2097152, 51249929, 63946752, 0, 51446542, 64258048, 0,
-51511621, 64359707, 0, 50922258, 64421888, 0, 53543236, 21381120,
-0, 21234449, 64326940, 0, 50856713, 63247076, 0, 51249933,
-63607525, 0, 51184392, 63881216, 0, 50922254, 63913984, 1,
-50791176, 63181540, 0, 51184396, 63541989, 0, 51118855, 63815680,
-0, 50856717, 63848448, 1, 50725639, 63116004, 0, 51118859,
-63476453, 0, 51053318, 63750144, 0, 50791180, 63782912, 1,
-50660102, 63050468, 0, 51053322, 63410917, 0, 50987781, 63684608,
-0, 50725643, 63717376, 1, 50463489, 62701568, 0, 50397957,
-62984932, 0, 50987778, 63345381, 0, 50660106, 63651840, 1,
-17760695, 32555008, 0, 50397954, 62668800, 1, 50463491, 62750720,
-0, 50528527, 62816256, 0, 50594561, 62849024, 0, 28771076,
-62914560, 0, 16974082, 16760832, 0, 17760526, 17320443, 0,
-17694979, 17727488, 0, 16908559, 17760256, 1, 17039619, 16826368,
-0, 17694989, 17254907, 0, 17629444, 17661952, 0, 16974094,
-17694720, 1, 17105156, 16891904, 0, 17629452, 17189371, 0,
-17563909, 17596416, 0, 17039629, 17629184, 1, 17563915, 17123835,
-0, 17498374, 17530880, 0, 17105164, 17563648, 1, 17171220,
-64667648, 0, 51642629, 64733184, 0, 17236230, 16957440, 0,
-17432839, 17465344, 0, 17170699, 17498112, 1, 47317258, 57627364,
-0, 17498834, 57688064, 0, 17301767, 17022976, 0, 17432841,
-17055744, 0, 17367304, 17399808, 0, 17236234, 17432576, 1,
-29491649, 33062912, 0, 53609263, 33225925, 29425664, 53674800, 21757518,
-20971520, 53412658, 33193156, 48365569, 29295042, 33013760, 0, 29360577,
-32948224, 1, 29491647, 32980992, 1, 29426114, 33030144, 1,
-29295040, 33128448, 0, 28705205, 31752192, 0, 53346742, 32079872,
-0, 28639677, 32407552, 0, 29163967, 32817152, 0, 29163966,
-32604160, 0, 29295037, 32784384, 1, 29229504, 32882688, 1,
-29360575, 33095680, 1, 17760514, 17793024, 0, 28508594, 31506432,
-0, 16908723, 31571968, 0, 28836279, 31784960, 0, 28901816,
-31916032, 0, 28443068, 32243712, 0, 29098425, 32440320, 0,
-28770575, 32522240, 1, 28639670, 31719424, 1, 28705208, 31866880,
-0, 28836281, 31948800, 1, 28901813, 32030720, 0, 29098418,
-32276480, 1, 29163964, 32325632, 0, 29229501, 32571392, 1,
-28443070, 32751616, 0, 27918761, 30179328, 0, 27853229, 30965760,
-0, 29557556, 33225923, 48300032, 29622723, 33280741, 0, 53805508,
-33341440, 0, 27263393, 29720576, 1, 27853226, 30146560, 1,
-27918752, 30228480, 0, 27328937, 30588928, 0, 28115766, 30883840,
-2097152, 53936949, 33341440, 50331648, 29557188, 33247972, 1, 54068024,
-21807104, 9699328, 29623095, 33308672, 46137345, 27984298, 30703616, 0,
-28311979, 31277056, 0, 28377520, 31408128, 0, 16908547, 16728064,
-1, 16974084, 16793600, 1, 17039621, 16859136, 1, 17105328,
-31358976, 0, 28311985, 31440896, 1, 28508418, 31539200, 1,
-28377523, 31588352, 0, 29229492, 32669696, 0, 29360574, 32849920,
-0, 29426112, 32915456, 0, 53740338, 33225939, 44105728, 28574129,
-31670272, 0, 21627699, 21757518, 35651584, 54001994, 21807104, 0,
-53608899, 33193156, 1, 196621, 22396928, 0, 25297281, 27230208,
-0, 54133062, 21610496, 0, 851971, 22364160, 1, 196946,
-22712021, 0, 22216717, 22744788, 0, 21365075, 22806528, 0,
-21431098, 21610496, 7733248, 22151495, 22904832, 0, 21233989, 21413888,
-1, 21299526, 21430272, 0, 21430596, 21528576, 0, 21365063,
-21577728, 1, 10748056, 8781824, 0, 720908, 9207808, 1,
-9961851, 26685898, 0, 24903844, 26791478, 0, 786812, 26853376,
-0, 24838155, 26886144, 0, 31064891, 34799616, 7208960, 31130074,
-34914304, 0, 10682843, 35094528, 0, 10748067, 8765440, 0,
-9961636, 8814592, 1, 851980, 523152, 0, 54263977, 9076736,
-0, 11206823, 9142272, 0, 786443, 9175040, 0, 11075755,
-9338880, 0, 721725, 394370, 33161216, 10944678, 8937472, 0,
-25428355, 27377664, 0, 23855467, 25116672, 0, 23921004, 25165824,
-0, 23986541, 25288704, 0, 24772976, 26443776, 0, 23789946,
-26509312, 0, 54394883, 180224, 0, 25100670, 27009024, 0,
-25035133, 26935296, 0, 25166207, 27082752, 0, 25231744, 27156480,
-0, 25362818, 27303936, 0, 24969604, 27451392, 0, 11206825,
-9306112, 1, 11337900, 9404416, 0, 11075757, 9592832, 0,
-11272363, 9674752, 0, 11272365, 9371648, 1, 11468974, 9469952,
-0, 11337903, 9527296, 0, 11403436, 9740288, 0, 11403439,
-9437184, 1, 11600048, 9928704, 0, 11468977, 9977856, 0,
-11534510, 10076160, 0, 11534513, 9895936, 1, 54460592, 10534912,
-0, 22347957, 23019520, 0, 11600213, 23085056, 0, 54526241,
-18907136, 1, 22872897, 23658496, 2621440, 22937949, 23773184, 0,
-18940254, 23822336, 0, 54330178, 394351, 22478848, 11141948, 9076736,
-7012352, 10813610, 23445504, 0, 25624966, 27533312, 0, 18875200,
-18907136, 7995393, 54591836, 23658496, 0, 22806816, 24395776, 0,
-54722570, 394351, 0, 655378, 669025, 0, 1180484, 9781248,
-9437184, 25887114, 27828224, 0, 54657859, 394351, 15400960, 25690503,
-27607040, 0, 25559429, 27459584, 0, 25756040, 27680768, 0,
-25821577, 27754496, 0, 25952651, 27901952, 0, 25493900, 27975680,
-0, 10158917, 8175616, 10682368, 10485915, 8617984, 0, 10289308,
-8306688, 0, 10223775, 8650752, 0, 10223771, 8241152, 0,
-10485919, 8404992, 0, 10158240, 8585216, 1, 10420380, 8683520,
-1, 10551453, 8514844, 0, 30671009, 34144256, 0, 30736852,
-35176448, 0, 54788114, 9814016, 1, 49086934, 60440576, 0,
-1180397, 60489728, 0, 54198745, 34799616, 0, 30999004, 34947072,
-0, 31195289, 35028992, 0, 10027160, 8077312, 0, 36307497,
-42614784, 0, 36373034, 42672128, 0, 54919723, 42729472, 0,
-36700999, 43024384, 17301504, 36766256, 43081728, 0, 36241969, 43147264,
-0, 37028404, 43368448, 0, 36438854, 42729472, 13107200, 36504108,
-42852352, 0, 55050797, 42909696, 0, 36962867, 43286528, 0,
-36569928, 42909696, 4718592, 36635182, 42967040, 0, 55116335, 43024384,
-0, 36897330, 43204608, 0, 54985545, 43024384, 4718592, 36831797,
-43384832, 0, 36832074, 43237376, 8388609, 55247410, 43417600, 1,
-37356087, 43712512, 0, 55181875, 43237376, 1, 36897612, 43253760,
-8388609, 37421626, 43794432, 0, 55313229, 43253760, 7340033, 37225019,
-43876352, 0, 37225015, 43532288, 0, 37159482, 43745280, 1,
-37356091, 43827200, 1, 37421624, 43843584, 1, 55444021, 43335680,
-1, 37028683, 43417600, 5242881, 37159478, 43450368, 0, 55378484,
-43253760, 1, 36963151, 43335680, 8388609, 37290552, 43614208, 0,
-55509838, 43335680, 4194305, 37093945, 43696128, 0, 54853786, 8175616,
-0, 10616992, 8536064, 0, 37552290, 44050664, 0, 36241981,
-44113920, 0, 36766249, 43180032, 1, 10093116, 43946112, 0,
-37487153, 44015616, 0, 44630706, 54272000, 0, 55575241, 56854713,
-0, 46728017, 56934400, 20971520, 44040863, 52535296, 0, 55706317,
-57016320, 1, 43975376, 57402825, 0, 46924626, 57016320, 3801089,
-47186636, 57466880, 0, 43975328, 52502528, 1, 44630687, 53141504,
-0, 44040882, 54222848, 0, 45220521, 54304768, 1, 55771817,
-54345728, 0, 44565159, 53805056, 0, 44499622, 53870592, 0,
-45220520, 54132736, 0, 55837372, 55132160, 0, 45876048, 56854713,
-7929856, 44303011, 52781056, 0, 44434085, 53993472, 0, 44237476,
-52813824, 1, 44303013, 52830208, 0, 44434083, 52928512, 0,
-44368550, 53960704, 1, 44106400, 52592640, 0, 44171937, 52658176,
-0, 44237474, 52723712, 0, 44106402, 52625408, 1, 44171943,
-52969472, 0, 44565153, 53067776, 0, 44499624, 53837824, 1,
-45876053, 55083443, 2097152, 46727868, 56821944, 1, 45744982, 54968320,
-12582912, 45810362, 55027723, 0, 55902907, 55083443, 0, 55640777,
-56901632, 1, 44696403, 54345728, 4718592, 46662487, 56817949, 41811968,
-55640776, 56934400, 0, 56165208, 54850277, 7405568, 56033992, 56785180,
-1, 45613913, 54850276, 10944512, 45679288, 54908918, 0, 55968441,
-54968320, 0, 46662481, 56901632, 12582913, 47055563, 57147392, 0,
-47121102, 57262080, 0, 46924495, 57311232, 0, 46858956, 61554688,
-0, 46858954, 56950784, 0, 46990028, 57049088, 0, 46793421,
-57098240, 0, 46924491, 61587456, 1, 43909789, 52486144, 0,
-46793562, 56983552, 327681, 47252126, 57514552, 0, 56230603, 56983552,
-1, 46858961, 57581568, 0, 44761770, 54419456, 0, 43844254,
-52453376, 1, 43909802, 53190656, 0, 44761757, 53223424, 0,
-44696235, 54452224, 1, 43844252, 52363264, 0, 56296107, 53772288,
-0, 46990026, 57131008, 1, 49677045, 61423616, 0, 49545971,
-61325312, 0, 49611508, 61341696, 0, 49480438, 61505536, 0,
-49480436, 61292544, 1, 49545973, 61374464, 1, 49611510, 61456384,
-1, 49677043, 61472768, 1, 45941412, 55197696, 0, 43516605,
-55853056, 0, 46072510, 55289289, 0, 43451030, 55787520, 0,
-46203584, 55902208, 0, 46006977, 56016896, 0, 46269119, 56070885,
-0, 43385538, 56136421, 0, 46334615, 56169188, 0, 46138051,
-56234724, 0, 43254422, 52007653, 0, 43451027, 52036881, 0,
-43188884, 55721984, 0, 43385495, 55820288, 1, 45941400, 55885824,
-1, 46531261, 56524800, 0, 43516615, 56623104, 0, 46596806,
-56705024, 0, 46203582, 55984128, 1, 46006982, 56459264, 0,
-46596801, 56557568, 0, 46531271, 56737792, 1, 44368560, 54001664,
-0, 45089457, 54072036, 0, 45155156, 55132160, 5242880, 43188882,
-51777182, 0, 43319956, 51881995, 0, 43123349, 55656448, 0,
-43254419, 55754752, 1, 45286063, 54509568, 0, 45351603, 54558720,
-0, 45417140, 54616400, 0, 45482677, 54673408, 0, 56361654,
-56817955, 0, 43582104, 52117504, 0, 43647641, 52174848, 0,
-45023918, 53649408, 0, 43582106, 52207616, 1, 43647662, 53469184,
-0, 45023897, 53501952, 0, 44958383, 53616640, 1, 44958381,
-53575680, 0, 44892844, 53706752, 0, 44827483, 53772288, 4194304,
-56034140, 56817955, 2555904, 43713178, 52232192, 0, 43778715, 52297728,
-0, 43713180, 52330496, 1, 43778732, 53329920, 0, 44892827,
-53362688, 0, 44827309, 53673984, 1, 45548214, 54722560, 0,
-56099511, 54850277, 0, 45482839, 56785186, 8126465, 43123345, 51713730,
-0, 42992277, 51942117, 0, 43057808, 55590912, 0, 43319954,
-55689216, 1, 42795664, 51609600, 0, 43057802, 51642368, 0,
-42599053, 55525376, 0, 42992273, 55623680, 1, 42599049, 51376482,
-0, 42861197, 51473691, 0, 42533518, 55459840, 0, 42795658,
-55558144, 1, 18088215, 18219008, 0, 18219285, 18317312, 0,
-18284974, 31080448, 0, 28246294, 31145984, 0, 18022674, 17924096,
-0, 17957141, 18071552, 0, 18219283, 18104320, 0, 18153750,
-18284544, 1, 18415896, 18366464, 0, 28180761, 30998528, 0,
-18350511, 31227904, 0, 18350361, 18399232, 1, 18546970, 18432000,
-0, 18416428, 18595840, 4194304, 18743576, 18661376, 0, 18481438,
-18710528, 0, 53281051, 18825216, 0, 22020957, 22475052, 4456448,
-16711934, 16135684, 0, 16646391, 16482304, 1, 16318719, 16515072,
-0, 51577081, 64536576, 0, 16188179, 64602112, 0, 16318712,
-15843328, 0, 16711929, 16547840, 1, 16253184, 16580608, 0,
-47382783, 57753600, 0, 16777939, 57814299, 0, 16253178, 15908864,
-0, 16843008, 16203776, 0, 16777464, 16613376, 1, 16384257,
-16646144, 0, 16843002, 16678912, 1, 17301769, 17367040, 1,
-27001089, 29261824, 0, 18153884, 29327360, 0, 27066644, 29360128,
-0, 17367453, 29425664, 0, 21496072, 21626880, 0, 16384414,
-29523968, 0, 27132319, 29589504, 0, 27263304, 29622272, 0,
-27328928, 29687808, 0, 27197860, 29982720, 0, 26476947, 28393472,
-0, 27656613, 30015488, 0, 27591060, 30605312, 0, 27525535,
-29949952, 1, 27591078, 30048256, 1, 27197861, 30294016, 0,
-27656612, 30392320, 0, 27787687, 30097408, 0, 27722156, 30818304,
-0, 53871016, 30883840, 0, 56492855, 33341440, 51380224, 56558393,
-21807104, 76546048, 53936990, 33308672, 20971521, 27394465, 29810688, 0,
-27460002, 29868032, 0, 27394467, 29835264, 1, 27722152, 30130176,
-1, 27460007, 30441472, 0, 27787682, 30474240, 0, 27525539,
-29925376, 0, 28049830, 30736384, 0, 18809083, 18792448, 0,
-56623503, 28082176, 0, 26149151, 28147712, 0, 16056571, 16252928,
-0, 16449823, 18759680, 1, 26542325, 28491776, 0, 26608021,
-28557312, 0, 26739094, 28737536, 0, 18809240, 28803072, 0,
-16056564, 15646720, 0, 16515323, 15939076, 0, 16449781, 16285696,
-1, 15991036, 16318464, 0, 15991030, 15712256, 0, 16580860,
-16004612, 0, 16515316, 16351232, 1, 16122109, 16384000, 0,
-16122103, 15777792, 0, 16646397, 16070148, 0, 16580854, 16416768,
-1, 16187646, 16449536, 0, 26346337, 28327936, 1048576, 26411410,
-29179904, 0, 29688670, 33341440, 76546048, 56755039, 21807104, 101711872,
-56492485, 33308672, 1, 15991029, 15613952, 1, 16122100, 15679488,
-1, 16187638, 15745024, 1, 16056725, 28459008, 1, 26542482,
-28606464, 0, 26411255, 29097984, 0, 26345875, 29212672, 1,
-26280343, 28639232, 0, 26673561, 28835840, 0, 36176739, 42446976,
-1114112, 56885800, 42500929, 0, 26805093, 62586880, 27000832, 56689041,
-28327936, 0, 56820165, 42446976, 0, 26738975, 28770304, 1,
-26804631, 28868608, 1, 26673560, 28950528, 0, 18809241, 28983296,
-0, 57082726, 33915281, 20447232, 36176740, 42468160, 33226753, 21693282,
-21807104, 122683392, 57016651, 33915281, 0, 29688360, 42414207, 1,
-26935706, 29037956, 0, 30344036, 42500929, 71892992, 26870223, 42549248,
-0, 56951195, 62586880, 0, 30278503, 33915281, 90046464, 30343630,
-33977060, 0, 56885711, 42468160, 1, 19267877, 19087360, 0,
-50332520, 62570496, 327680, 51315456, 63995904, 0, 19202831, 64058084,
-0, 51380518, 64156389, 0, 57148155, 62570496, 0, 50004752,
-64159744, 0, 49939195, 61926684, 0, 50332415, 62221595, 0,
-50266874, 62504960, 0, 50004736, 62537728, 1, 19398951, 21348352,
-0, 22085928, 22577152, 0, 19333456, 22609920, 0, 57213265,
-22513580, 0, 19202342, 19120128, 1, 19267879, 19136512, 0,
-19398949, 19234816, 0, 19333416, 21315584, 1, 49873658, 61861148,
-0, 50266878, 62156059, 0, 50201337, 62439424, 0, 49939199,
-62472192, 1, 49808121, 61795612, 0, 50201341, 62090523, 0,
-50135800, 62373888, 0, 49873662, 62406656, 1, 49742584, 61730076,
-0, 50135804, 62024987, 0, 50070263, 62308352, 0, 49808125,
-62341120, 1, 26083725, 28033024, 0, 26018551, 61664540, 0,
-50069902, 61959451, 0, 49742588, 62275584, 1, 26018190, 28000256,
-1, 26084192, 28082176, 524288, 26214797, 28180480, 0, 16449936,
-28246016, 0, 1441813, 786432, 0, 57278486, 901120, 0,
-1376380, 6356992, 0, 8127339, 10687782, 15663104, 57344124, 10720551,
-1, 8127340, 11075584, 4194304, 524604, 20459873, 0, 20709693,
-20676608, 0, 20644152, 20545536, 0, 20775228, 20643840, 1,
-20709710, 22102016, 0, 21889339, 22167552, 0, 21954877, 22265856,
-0, 20447567, 22331392, 0, 6488090, 10999491, 0, 1704813,
-36061184, 23592960, 6488162, 4882432, 0, 1704035, 10966722, 1,
-6422551, 11067392, 0, 1769498, 1015808, 0, 4457326, 2965504,
-8388608, 4522052, 3014656, 0, 57606213, 3129344, 0, 57671703,
-4325376, 0, 1507426, 11034624, 1, 1508202, 901120, 8388608,
-20513080, 20299776, 0, 20578617, 20348928, 0, 20644154, 20398080,
-0, 20447547, 20512768, 1, 5899120, 4325376, 10485760, 5963866,
-4440064, 0, 6094940, 4538368, 0, 57737309, 4587520, 0,
-459634, 294912, 12582912, 8323955, 6537216, 4194305, 19464199, 19292160,
-0, 20775209, 20611072, 0, 20447545, 20267008, 1, 20840760,
-20709376, 0, 20906302, 20824064, 0, 20513087, 20873216, 0,
-6751092, 5046272, 12582912, 7274599, 5554176, 0, 7536754, 5734400,
-0, 7602291, 5783552, 0, 6685557, 4997120, 4194304, 57933926,
-5046272, 0, 7667828, 5865472, 0, 58064971, 3506176, 0,
-57999461, 4997120, 0, 4915317, 5947392, 0, 6422632, 5128192,
-0, 6816234, 36995072, 0, 32112731, 37076992, 0, 6946921,
-5226496, 0, 32047210, 36864000, 0, 6029801, 37109760, 0,
-6029403, 4456448, 0, 32113129, 36929536, 0, 5964266, 37044224,
-1, 32047196, 37142528, 1, 4391799, 2883584, 8388608, 4588408,
-3129344, 20971520, 4653126, 3178496, 0, 57540675, 2965504, 0,
-58196847, 3129344, 12582912, 57475556, 36061184, 0, 31785059, 36159488,
-0, 31719909, 36274176, 0, 4784200, 3276800, 0, 58262390,
-3506176, 8388608, 6619236, 4915200, 0, 6553673, 36306944, 0,
-31719497, 35995648, 0, 6554085, 36225024, 0, 31785444, 36241408,
-1, 4784228, 36339712, 1, 8126485, 6389760, 1, 1572988,
-10567680, 0, 1376276, 10665984, 0, 1310744, 13041664, 0,
-1310739, 770048, 0, 1638424, 933888, 0, 1245209, 12845056,
-0, 1572884, 13074432, 1, 1638419, 12877824, 1, 14352409,
-12926976, 0, 1245404, 13025280, 0, 14418139, 13107200, 0,
-14352604, 13139968, 1, 30867675, 34291712, 0, 14418392, 34521088,
-0, 30933463, 34734080, 0, 2163155, 34701312, 0, 2163159,
-34357248, 0, 30933459, 34455552, 0, 30605345, 34668544, 1,
-30867928, 34766848, 1, 2097183, 1228800, 0, 33423871, 38813696,
-1, 52690976, 66682880, 0, 33489700, 66748416, 0, 52756990,
-66781184, 0, 2032421, 66846720, 0, 2228257, 1267701, 0,
-58327074, 47284224, 0, 589989, 9277087, 0, 54788105, 9781248,
-0, 590660, 9814016, 1048577, 30802384, 34553856, 0, 49152009,
-60588032, 0, 30409454, 60637184, 0, 589832, 345477, 0,
-57868416, 6537216, 1, 8388773, 8896512, 0, 10813449, 9244318,
-1, 30605778, 34111488, 0, 30474709, 34652160, 0, 30540241,
-35241984, 0, 30474704, 34045952, 0, 30802389, 34209792, 0,
-30409174, 34586624, 1, 30736849, 34619392, 1, 2, 98304,
-0, 57802758, 294912, 0, 1048593, 589824, 1, 131945,
-22513580, 6881280, 29819334, 33357824, 0, 8781959, 6963200, 1,
-9307003, 7258112, 8388608, 30081482, 33652736, 0, 56426638, 22475052,
-0, 29884871, 33431552, 0, 29950408, 33505280, 0, 30015945,
-33579008, 0, 30147019, 33726464, 0, 30212556, 33800192, 0,
-29753805, 33873920, 0, 8781957, 6881280, 0, 8847494, 6995968,
-0, 8717180, 7741440, 1441792, 21758087, 21856256, 0, 58523664,
-622592, 0, 58458260, 7741440, 0, 1048908, 21938176, 0,
-8847692, 21823488, 1, 21757968, 21905408, 1, 8388735, 6504448,
-0, 8454272, 6553600, 0, 58589313, 7921664, 0, 8323405,
-22052864, 0, 1115007, 622592, 14680064, 9765758, 7921664, 11862016,
-21823505, 21970944, 0, 1114445, 22003712, 1, 21823615, 22020096,
-1, 58655613, 622592, 10485760, 9699477, 7798784, 0, 8716420,
-6815744, 0, 8650898, 7544832, 0, 9699461, 7774208, 1,
-58720404, 7831552, 1, 8519809, 6619136, 0, 9633922, 7725056,
-0, 9765761, 7831552, 8912897, 8454293, 7888896, 1, 9568403,
-7602176, 0, 58786688, 7831552, 1572865, 8650883, 6750208, 0,
-8585360, 7348224, 0, 9568388, 7577600, 1, 58851474, 7634944,
-1, 917634, 6684672, 0, 9502734, 7528448, 0, 9634691,
-7634944, 8912897, 8519827, 7692288, 1, 9437329, 7405568, 0,
-58917762, 7634944, 1572865, 983054, 524288, 0, 9437315, 7380992,
-1, 9502864, 7438336, 1, 917649, 7495680, 1, 8585384,
-8978432, 0, 11010063, 9830400, 0, 65536, 49152, 0,
-393221, 212992, 0, 20971521, 20938752, 0, 328003, 21200896,
-0, 21168448, 21266432, 0, 6161265, 4587520, 8388608, 58982494,
-4702208, 0, 6881387, 5275648, 0, 6291551, 4718592, 0,
-6357088, 4833280, 0, 59048044, 5324800, 0, 7077997, 5406720,
-0, 6226820, 4702208, 8388608, 7013253, 5324800, 8388608, 21037376,
-21020672, 0, 21102913, 21069824, 0, 21168450, 21118976, 0,
-20971843, 21233664, 1, 7798902, 6045696, 0, 7864439, 6094848,
-0, 32309740, 37257216, 0, 59113592, 58638336, 0, 59179306,
-19365888, 0, 32244203, 37175296, 0, 47776646, 58638336, 8388608,
-19530458, 58703872, 0, 48104157, 58834944, 0, 48038617, 58900480,
-0, 47842014, 58966016, 0, 7406472, 5685248, 8388608, 19596169,
-19365888, 46137344, 7471403, 19480576, 0, 31260794, 35291136, 0,
-31326685, 35340288, 0, 31392222, 35389440, 0, 59310983, 19365888,
-8388608, 7929969, 19398656, 0, 7995513, 6176768, 0, 59375726,
-5455872, 0, 7209083, 6258688, 0, 32178670, 37355520, 0,
-7144330, 5455872, 8388608, 7733345, 5963776, 0, 32375277, 37339136,
-0, 8061407, 35471360, 0, 7340143, 5570560, 0, 59244656,
-5685248, 0, 47973083, 58736640, 0, 48235231, 59162624, 0,
-48300768, 59211776, 0, 48169698, 59244544, 0, 48366300, 59326464,
-0, 47907553, 59392000, 0, 47907548, 58769408, 1, 48038622,
-58802176, 1, 48104155, 59015168, 0, 47973085, 59047936, 0,
-983208, 9863168, 1, 11862196, 10436608, 0, 11928383, 10534912,
-5242880, 22282422, 22986752, 0, 22413327, 23150592, 0, 19136854,
-23216128, 0, 22479188, 23314432, 0, 11010391, 23379968, 0,
-19071266, 18956288, 0, 19005732, 19038208, 0, 23200035, 24248320,
-0, 11796834, 24313856, 0, 19005731, 18989056, 1, 22610264,
-23478272, 0, 19071321, 23527424, 0, 22544737, 24150016, 0,
-23134498, 24215552, 0, 22610211, 23560192, 1, 22741338, 23592960,
-0, 23003481, 23871488, 0, 19071328, 23969792, 0, 23069019,
-24035328, 0, 22675807, 24061058, 0, 18940192, 18874368, 0,
-22675803, 23625728, 1, 23265626, 24461312, 0, 18874723, 24526848,
-0, 22741348, 24625152, 0, 23331105, 24690688, 0, 23658856,
-25001984, 0, 23724393, 25051136, 0, 23593335, 25993216, 0,
-24576376, 26263552, 0, 24707434, 26279936, 0, 24052089, 26345472,
-0, 24117615, 25378816, 0, 24641902, 26066944, 0, 24052619,
-25411584, 4194305, 24379763, 25694948, 0, 24707439, 26378240, 1,
-24314233, 26624000, 0, 59441520, 25411584, 1, 24510837, 25849115,
-0, 24117626, 26411008, 1, 24772982, 26558464, 0, 24445300,
-25772032, 0, 24314228, 25727717, 1, 24379765, 25804800, 1,
-24445302, 25881884, 1, 24183146, 25444352, 0, 24314225, 25624576,
-0, 23724409, 26312704, 1, 24707443, 26656768, 1, 23789938,
-25575424, 0, 24248694, 25919488, 0, 24772971, 26476544, 1,
-24510842, 26591232, 1, 24248689, 25509888, 0, 24183155, 25657344,
-1, 24510834, 25886720, 1, 58392717, 7258112, 0, 9240755,
-10223616, 0, 23396486, 24723456, 0, 11731301, 24788992, 0,
-262974, 180224, 8388608, 10879154, 10108928, 0, 11665412, 10321920,
-0, 9240580, 10207232, 0, 11731085, 10256384, 1, 262322,
-10289152, 1, 11665587, 10371072, 0, 23462247, 25346048, 0,
-23527800, 26083328, 0, 24576358, 26181632, 0, 24641911, 26230784,
-1, 23396531, 24821760, 1, 23462245, 24870912, 0, 11731303,
-24903680, 0, 23527782, 25313280, 1, 41681531, 49709056, 0,
-41812156, 49922048, 0, 41615998, 49987584, 0, 41550459, 49070080,
-0, 41681529, 49094656, 0, 41484922, 49643520, 0, 41615996,
-49676288, 1, 41484918, 48906240, 0, 41353850, 49004544, 0,
-41288311, 49577984, 0, 41550457, 49610752, 1, 12321378, 47146869,
-0, 39977569, 47218688, 0, 12845251, 11698176, 0, 12780129,
-47038464, 0, 39977156, 47071232, 0, 39912034, 47185920, 1,
-41747068, 49758208, 0, 13042301, 49823744, 0, 12320967, 50003968,
-0, 12386492, 11354112, 0, 12320957, 11386880, 1, 13107399,
-11812864, 0, 12386504, 11993088, 0, 13041852, 50036736, 1,
-13435180, 19531786, 0, 19660990, 19603456, 0, 13500621, 50921472,
-0, 42009216, 50569216, 0, 12452140, 19636224, 1, 42008766,
-50421760, 0, 19661440, 50520064, 0, 41943681, 50536448, 1,
-12452029, 11405322, 0, 19726977, 50357704, 0, 19792173, 19677184,
-0, 19923247, 19775488, 0, 20054318, 19862244, 0, 13369547,
-11927552, 0, 13304013, 12075008, 0, 13500620, 12173312, 0,
-13435086, 50954240, 1, 41943344, 50324402, 0, 19858316, 19824640,
-6291456, 59572530, 20185088, 0, 42533512, 51310946, 0, 42926734,
-51539227, 0, 42467983, 55394304, 0, 42861193, 55492608, 1,
-42402702, 55328768, 655360, 42926728, 55427072, 1, 52953735, 67174400,
-0, 42468136, 67300636, 0, 53019279, 67332106, 0, 59638411,
-55328768, 0, 42664745, 67403776, 0, 42402438, 51183616, 0,
-42730123, 51412992, 0, 42664583, 55361536, 1, 52822668, 66928640,
-0, 42337063, 67125248, 0, 20382005, 51134464, 0, 20251332,
-56328192, 0, 46465335, 56360960, 0, 46400294, 67010560, 0,
-52888261, 67043328, 0, 59506993, 19824640, 0, 20382605, 20185088,
-14680064, 20250935, 51167232, 1, 19988788, 20070400, 0, 20316469,
-20168704, 0, 42074422, 50633272, 0, 20185731, 50666574, 0,
-42140290, 50880512, 0, 20119758, 19986422, 0, 12517683, 20045824,
-0, 20119743, 20013056, 1, 42139955, 50733056, 0, 12518018,
-50831360, 0, 42074755, 50913280, 1, 12583103, 11532278, 0,
-12648640, 11583488, 0, 39911617, 46962827, 0, 12583105, 11550720,
-1, 13238473, 11911168, 0, 13172928, 12189696, 0, 12648650,
-12288000, 0, 41288309, 48709632, 0, 41419383, 48807936, 0,
-41222776, 49512448, 0, 41353846, 49545216, 1, 41222770, 48644096,
-0, 41091704, 48873472, 0, 41026163, 49446912, 0, 41419381,
-49479680, 1, 41026161, 48447488, 0, 41157235, 48545792, 0,
-40960628, 49381376, 0, 41091698, 49414144, 1, 40960624, 48381952,
-0, 40829556, 48611328, 0, 40895087, 49315840, 0, 41157233,
-49348608, 1, 40895086, 48321252, 0, 40764015, 49258496, 0,
-40829552, 49283072, 1, 40764012, 48195901, 0, 40829550, 49225728,
-1, 12779716, 11665408, 1, 12845663, 46743552, 0, 39846083,
-46841856, 0, 39780960, 46891008, 0, 39846495, 46858240, 1,
-39780966, 47595520, 0, 40305248, 47693824, 0, 40436328, 47726592,
-0, 40239721, 47792128, 0, 41878119, 50184192, 0, 40698479,
-48290686, 0, 40632941, 49196316, 0, 40567402, 47890432, 0,
-40632939, 48070656, 0, 40501869, 48103424, 0, 40698476, 49163547,
-1, 40370793, 47759360, 1, 40501867, 47857664, 1, 40436330,
-47906816, 0, 40567400, 48005120, 0, 48956303, 60126377, 6488064,
-40174169, 47538176, 0, 59704043, 60159146, 1, 48956005, 60178432,
-0, 40174315, 60211200, 1, 48956304, 66256896, 2097152, 38732375,
-45973504, 1, 39649871, 46612480, 0, 39715421, 46675460, 0,
-39387749, 47570944, 1, 49021529, 60325888, 0, 39256812, 60391424,
-0, 59769438, 66256896, 0, 12255418, 11282749, 0, 48693435,
-59883520, 0, 59835169, 66158592, 0, 38863440, 45359104, 0,
-49414737, 61145088, 0, 12190450, 61210624, 0, 38798112, 66076672,
-0, 52429713, 66158592, 4063232, 52495083, 66207744, 0, 8257661,
-6479872, 0, 48628453, 59736064, 0, 12714726, 59785216, 0,
-48562302, 60735488, 0, 49217730, 60817408, 0, 8192751, 60882944,
-0, 12714171, 11599872, 0, 48627906, 59817984, 1, 12256146,
-59850752, 6291457, 48759527, 59899904, 0, 48825064, 60014592, 0,
-48890601, 60063744, 0, 59704042, 60126377, 0, 48825066, 60030976,
-1, 48759529, 59981824, 1, 60031891, 60801024, 6291456, 48562918,
-59703296, 1, 59900647, 59850752, 1, 48693992, 59932672, 1,
-59966181, 60801024, 0, 48890767, 60159146, 8716289, 12255426, 11632640,
-1, 40370363, 50085888, 0, 12714623, 50249728, 0, 57344039,
-10687782, 0, 2752553, 1605632, 0, 60096554, 1654784, 0,
-1966583, 38387712, 0, 32965112, 38404096, 0, 2622358, 1474560,
-3145728, 2687016, 1523712, 0, 1900572, 1064960, 0, 60228459,
-10720551, 9633793, 57409565, 11075584, 0, 1835038, 1114112, 0,
-60162087, 1474560, 0, 2556823, 10720551, 14417921, 2818965, 1654784,
-6291456, 60293163, 1703936, 0, 33030649, 38518784, 0, 2884504,
-1703936, 6291456, 33096188, 38633472, 0, 33292797, 38715392, 0,
-33227258, 38551552, 0, 33489406, 38846464, 0, 33161727, 38895616,
-0, 33423407, 38928384, 0, 33358331, 38764544, 0, 2359331,
-1343488, 0, 1769509, 10882944, 0, 2293787, 11190272, 0,
-2490405, 1392640, 0, 11993126, 10747904, 0, 2425753, 10915713,
-4194305, 2556087, 10829824, 0, 60358683, 10915713, 1, 5768090,
-4194304, 4194304, 5832792, 4308992, 0, 3407926, 2179072, 0,
-3539005, 2588672, 0, 31457369, 35520512, 0, 3146211, 35815424,
-0, 31654368, 35962880, 0, 5832756, 58069732, 0, 3407961,
-58102501, 1, 31588833, 35684352, 0, 2425314, 35864576, 0,
-2425312, 35586048, 0, 31654370, 35749888, 0, 31588389, 35897344,
-1, 31457763, 35930112, 1, 4194367, 2752512, 0, 4259904,
-2867200, 0, 5242959, 3768320, 0, 5308496, 3817472, 0,
-4129691, 2736128, 4194304, 3670940, 2228224, 4194304, 60620881, 3899392,
-0, 5308472, 58053349, 0, 3670097, 58020580, 1, 3211312,
-2015232, 0, 3997756, 2637824, 0, 60686385, 6324224, 0,
-60751931, 2424832, 0, 3866680, 2506752, 0, 60489790, 2736128,
-0, 3933087, 2424832, 8388608, 4064158, 6324224, 8388608, 5112736,
-3637248, 12582912, 5177422, 3686400, 0, 3342386, 2064384, 0,
-58130498, 2883584, 0, 31850547, 36388864, 0, 4325862, 36765696,
-0, 4849729, 3342336, 0, 4981625, 3506176, 37748736, 5046348,
-3588096, 0, 60817485, 3637248, 0, 4718663, 3260416, 0,
-3276874, 3424256, 0, 31523303, 36519936, 0, 31981604, 36618240,
-0, 31916520, 36732928, 0, 31916518, 36454400, 0, 4325864,
-36683776, 0, 31982055, 36700160, 1, 31850562, 36798464, 1,
-13631695, 12369920, 0, 37617872, 44204032, 0, 13566530, 44367872,
-0, 37880382, 44449792, 0, 37683774, 44269568, 0, 37618242,
-44482560, 1, 37945919, 44510917, 0, 37880387, 44957696, 0,
-2949164, 1785856, 0, 3014701, 1835008, 0, 3080238, 1949696,
-0, 13566160, 12337152, 1, 40043386, 47284224, 4194304, 10355300,
-47316992, 0, 40108239, 47382528, 0, 13632099, 47480832, 0,
-10420382, 8331264, 0, 37683779, 44543686, 1, 38011456, 44572672,
-0, 37945924, 44954341, 0, 39518783, 46362977, 0, 37749339,
-46424064, 0, 37814848, 44323928, 0, 37749316, 44605440, 1,
-38076993, 44633056, 0, 38011461, 44887324, 0, 37814853, 44665825,
-1, 38208070, 44695552, 0, 38076999, 44810240, 0, 52363841,
-65945600, 0, 38142751, 66011136, 0, 38142535, 44728320, 1,
-51708486, 64765952, 0, 38208284, 65257472, 0, 52167445, 65536000,
-0, 51774229, 64831488, 0, 52167451, 65191936, 0, 51708700,
-65568768, 1, 52101910, 65601536, 0, 51839766, 64897024, 0,
-52101914, 65126400, 0, 51774235, 65634304, 1, 52036375, 65667072,
-0, 51905303, 64962560, 0, 52036377, 65060864, 0, 51839770,
-65699840, 1, 51970840, 65732608, 0, 52232984, 65290240, 0,
-51970846, 65519616, 0, 51905305, 65765376, 1, 52298525, 65798144,
-0, 42205981, 65355776, 0, 52298373, 65454080, 0, 52232990,
-65830912, 1, 42271364, 65863680, 0, 38339144, 45023232, 0,
-38273668, 51003392, 0, 42271305, 51101696, 0, 42205829, 65896448,
-1, 38273609, 45056000, 1, 38732366, 45285376, 0, 39256655,
-45940736, 0, 38339159, 46055424, 0, 38666824, 46284800, 0,
-12125089, 11254086, 9175040, 39387736, 46089305, 0, 48497241, 59633792,
-0, 49283257, 60981248, 0, 49349360, 61046784, 0, 39322353,
-61112320, 0, 60883128, 11254086, 0, 12059364, 59637760, 0,
-39387876, 59601023, 1, 48496824, 59670528, 1, 12059540, 60801024,
-16777216, 15466731, 13926400, 1, 15597805, 13959168, 0, 15401198,
-15319040, 0, 15532268, 15351808, 0, 15532270, 13991936, 1,
-15728879, 14024704, 0, 15597808, 15253504, 0, 15663341, 15417344,
-0, 15663344, 14057472, 1, 14090481, 14090240, 0, 15728855,
-15187968, 0, 15794415, 15482880, 0, 13959380, 12533760, 0,
-14090454, 12632064, 0, 15794391, 14123008, 1, 13893873, 15548416,
-0, 12910805, 38993920, 0, 14024901, 39239680, 0, 12976325,
-11730944, 0, 14024920, 12681216, 0, 12910806, 39206912, 1,
-33620506, 41402368, 0, 35258566, 41418752, 1, 14287065, 12746752,
-0, 14155994, 12801730, 0, 14221825, 39297719, 0, 33817506,
-39469056, 1572864, 33882628, 39534592, 0, 36045343, 42246144, 1,
-36110853, 42270720, 0, 34406924, 39960576, 0, 61014541, 40288256,
-0, 61080083, 41240781, 0, 33817093, 39567360, 1, 34341389,
-39927808, 1, 34406916, 40992768, 0, 33882636, 41025536, 0,
-34079239, 39714816, 0, 34013735, 42352640, 0, 34537998, 40009728,
-0, 35062693, 41291361, 29032448, 34013704, 39747584, 1, 34472463,
-39976960, 1, 34537991, 41107456, 0, 34079246, 41205760, 0,
-34669071, 40140800, 0, 35193766, 41240781, 34340864, 61145625, 41291361,
-0, 33948165, 39600128, 0, 34013702, 39649280, 0, 33882663,
-42303488, 1, 36110855, 42385408, 1, 34341393, 40222720, 0,
-61211556, 41240781, 28966912, 34997159, 40573495, 10747904, 35062294, 40632320,
-0, 35193367, 41324130, 1, 34865683, 40461509, 0, 34931220,
-40517632, 0, 61276693, 40573495, 0, 34800153, 41273550, 1,
-34144776, 39780352, 0, 34472464, 40081976, 0, 35127831, 40755200,
-0, 34603544, 40812544, 0, 35389979, 41517056, 0, 35652127,
-41746432, 0, 35717664, 41869312, 0, 61342241, 41926656, 0,
-36045737, 42156032, 4718592, 35586598, 42213376, 0, 35455516, 41598976,
-0, 35914666, 42041344, 3670016, 35979812, 42098688, 0, 61407781,
-42156032, 0, 35521053, 41615360, 0, 35783595, 41926656, 4718592,
-35848738, 41984000, 0, 61473315, 42041344, 0, 35324446, 41697280,
-0, 61539240, 41926656, 1572864, 35324444, 41484288, 1, 35389981,
-41566208, 1, 35455518, 41648128, 1, 35521051, 41730048, 1,
-35979814, 42188800, 1, 35848740, 42008576, 1, 35783203, 41951232,
-1, 35652129, 41836544, 1, 35586592, 41779200, 1, 35717666,
-41893888, 1, 38928905, 45465600, 0, 38994514, 45531136, 0,
-61604435, 45596672, 0, 33685702, 39337984, 0, 33751554, 39403520,
-0, 60948995, 39469056, 0, 12976666, 41451520, 0, 35914277,
-42131456, 1, 35259308, 45596672, 23068672, 34275850, 39895040, 0,
-34210723, 40288256, 3670016, 34734603, 40353792, 0, 34800146, 40402944,
-0, 33686019, 39436288, 1, 34210315, 39862272, 1, 34275842,
-40861696, 0, 33751562, 40894464, 0, 38601292, 45219840, 0,
-39125588, 45629440, 0, 39060054, 45711360, 0, 38535765, 45760512,
-0, 39453261, 46186496, 0, 39191130, 46235648, 1, 38928979,
-45498368, 1, 39060053, 45662208, 1, 39125586, 45809664, 0,
-38994516, 45907968, 0, 39453270, 46202880, 0, 39584346, 46514176,
-0, 38666844, 46579712, 0, 47448651, 57884672, 0, 39191252,
-57950208, 0, 38470222, 60260352, 0, 38404680, 45121536, 0,
-38470218, 45170688, 0, 38273614, 46317568, 1, 38666827, 60227584,
-1, 9896086, 7995392, 0, 14483607, 13221888, 0, 33554933,
-39092224, 0, 52560093, 66355200, 0, 32834338, 66420736, 0,
-9830912, 66469888, 0, 32899573, 38256640, 0, 9372150, 38305792,
-0, 32834048, 39059456, 1, 32768143, 39149568, 1, 52625908,
-66519040, 0, 33555235, 66584576, 0, 5701718, 4145152, 0,
-60424279, 4194304, 0, 5636148, 37966564, 0, 3473460, 2129920,
-0, 5636181, 4063232, 0, 3407958, 37999333, 1, 9896157,
-13189120, 1, 14614750, 13287424, 0, 14483679, 14319616, 0,
-14549143, 14352384, 0, 14549215, 13254656, 1, 14745824, 13352960,
-0, 14614753, 14254080, 0, 14680286, 14417920, 0, 9109642,
-7127040, 0, 14680289, 13320192, 1, 9044192, 13369344, 0,
-14745739, 14188544, 0, 5570644, 4014080, 0, 5505160, 37502976,
-0, 32440373, 37601280, 0, 32506351, 37666816, 0, 32440816,
-37634048, 1, 32571887, 37748736, 0, 32637425, 37863424, 0,
-32506354, 37912576, 0, 5440429, 3964928, 8388608, 8912979, 37437440,
-0, 3801584, 37732352, 0, 3604537, 2342912, 0, 3735610,
-2359296, 0, 61669458, 3964928, 0, 5374007, 7979008, 1,
-60555319, 2228224, 0, 5374877, 3899392, 8388608, 3604562, 7946240,
-0, 8978568, 7045120, 0, 5505164, 7143424, 0, 8912980,
-37535744, 1, 32702601, 38027264, 0, 9175539, 38141952, 1,
-9175183, 7323648, 0, 32768499, 38092800, 0, 32702604, 38174720,
-0, 9372148, 39182336, 0, 14680202, 13402112, 1, 14811345,
-13434880, 0, 13697248, 14499840, 0, 9044194, 14598144, 0,
-13762769, 12402688, 0, 13697250, 13467648, 1, 14876882, 13500416,
-0, 48431331, 59490304, 0, 14811875, 59555840, 0, 13762787,
-13533184, 1, 14942418, 13582336, 0, 15859940, 14614528, 0,
-14876914, 58179584, 0, 47645397, 58327040, 0, 47710935, 58441728,
-0, 47579864, 58490880, 0, 47514326, 58540032, 0, 15859939,
-58146816, 1, 47513842, 58195968, 0, 14877398, 58294272, 0,
-47579861, 58572800, 1, 13828306, 12484608, 0, 13762788, 13615104,
-1, 15007955, 13647872, 0, 14942437, 14811136, 0, 13828325,
-13680640, 1, 15139046, 13713408, 0, 15007975, 14745600, 0,
-15073491, 14909440, 0, 15073511, 13746176, 1, 15270120, 13778944,
-0, 15139049, 14680064, 0, 15204582, 14974976, 0, 15204585,
-13811712, 1, 15401194, 13844480, 0, 53084395, 67436544, 0,
-15270698, 67502080, 0, 53149928, 67600384, 0, 15336235, 67665920,
-0, 15335659, 13877248, 1, 15401196, 13893632, 0, 15925482,
-15040512, 0, 15466739, 15089664, 0};
-extern const uint32_t e1m1_WADSubSectors[448] = {
-4, 262147, 458755, 655363, 851973, 1179650, 1310724, 1572868,
-1835012, 2097156, 2359300, 2621446, 3014660, 3276804, 3538948, 3801093,
-4128773, 4456452, 4718594, 4849666, 4980737, 5046276, 5308420, 5570564,
-5832712, 6356996, 6619140, 6881285, 7208964, 7471106, 7602177, 7667714,
-7798787, 7995399, 8454148, 8716289, 8781827, 8978434, 9109509, 9437186,
-9568260, 9830406, 10223619, 10420226, 10551301, 10878977, 10944514, 11075589,
-11403266, 11534337, 11599873, 11665409, 11730945, 11796481, 11862020, 12124164,
-12386308, 12648452, 12910596, 13172738, 13303810, 13434883, 13631492, 13893634,
-14024705, 14090241, 14155777, 14221313, 14286849, 14352386, 14483458, 14614532,
-14876673, 14942210, 15073283, 15269891, 15466497, 15532039, 15990788, 16252932,
-16515074, 16646147, 16842755, 17039362, 17170436, 17432579, 17629187, 17825794,
-17956868, 18219011, 18415619, 18612227, 18808834, 18939908, 19202049, 19267589,
-19595265, 19660801, 19726340, 19988483, 20185092, 20447234, 20578308, 20840451,
-21037058, 21168132, 21430276, 21692420, 21954563, 22151170, 22282241, 22347780,
-22609921, 22675457, 22740994, 22872065, 22937601, 23003137, 23068676, 23330818,
-23461896, 23986180, 24248324, 24510468, 24772611, 24969220, 25231365, 25559042,
-25690113, 25755652, 26017796, 26279938, 26411012, 26673155, 26869764, 27131908,
-27394052, 27656196, 27918340, 28180483, 28377094, 28770305, 28835845, 29163525,
-29491204, 29753346, 29884420, 30146566, 30539779, 30736388, 30998532, 31260674,
-31391746, 31522820, 31784961, 31850497, 31916035, 32112646, 32505860, 32768004,
-33030148, 33292291, 33488898, 33619975, 34078725, 34406402, 34537476, 34799618,
-34930691, 35127300, 35389443, 35586053, 35913730, 36044804, 36306947, 36503553,
-36569092, 36831236, 37093380, 37355524, 37617668, 37879812, 38141956, 38404098,
-38535170, 38666246, 39059458, 39190531, 39387137, 39452675, 39649282, 39780353,
-39845892, 40108034, 40239106, 40370179, 40566785, 40632324, 40894468, 41156611,
-41353219, 41549827, 41746435, 41943044, 42205187, 42401794, 42532867, 42729476,
-42991620, 43253764, 43515908, 43778052, 44040196, 44302337, 44367876, 44630022,
-45023233, 45088769, 45154306, 45285380, 45547524, 45809667, 46006276, 46268421,
-46596099, 46792705, 46858241, 46923777, 46989313, 47054849, 47120385, 47185921,
-47251460, 47513603, 47710210, 47841284, 48103427, 48300034, 48431106, 48562180,
-48824324, 49086466, 49217540, 49479684, 49741826, 49872902, 50266117, 50593795,
-50790404, 51052546, 51183620, 51445764, 51707911, 52166659, 52363267, 52559874,
-52690945, 52756483, 52953091, 53149697, 53215234, 53346310, 53739524, 54001672,
-54525956, 54788101, 55115782, 55508998, 55902214, 56295426, 56426500, 56688644,
-56950785, 57016323, 57212932, 57475076, 57737219, 57933828, 58195971, 58392580,
-58654724, 58916868, 59179011, 59375620, 59637764, 59899906, 60030980, 60293123,
-60489729, 60555268, 60817411, 61014017, 61079556, 61341697, 61407233, 61472771,
-61669380, 61931521, 61997058, 62128132, 62390277, 62717954, 62849029, 63176709,
-63504387, 63700995, 63897602, 64028674, 64159748, 64421891, 64618500, 64880644,
-65142788, 65404932, 65667076, 65929219, 66125826, 66256900, 66519046, 66912258,
-67043332, 67305476, 67567617, 67633155, 67829762, 67960839, 68419587, 68616197,
-68943873, 69009414, 69402627, 69599236, 69861377, 69926914, 70057988, 70320129,
-70385667, 70582273, 70647812, 70909954, 71041027, 71237635, 71434243, 71630851,
-71827460, 72089601, 72155139, 72351747, 72548354, 72679426, 72810502, 73203713,
-73269250, 73400324, 73662468, 73924609, 73990147, 74186753, 74252291, 74448899,
-74645506, 74776578, 74907652, 75169794, 75300866, 75431938, 75563011, 75759620,
-76021764, 76283908, 76546051, 76742661, 77070337, 77135877, 77463556, 77725701,
-78053380, 78315524, 78577668, 78839812, 79101956, 79364100, 79626244, 79888389,
-80216070, 80609282, 80740355, 80936964, 81199108, 81461252, 81723398, 82116613,
-82444291, 82640900, 82903043, 83099652, 83361794, 83492866, 83623940, 83886083,
-84082692, 84344834, 84475907, 84672516, 84934657, 85000195, 85196806, 85590020,
-85852164, 86114306, 86245380, 86507521, 86573057, 86638593, 86704129, 86769665,
-86835204, 87097350, 87490564, 87752708, 88014854, 88408068, 88670214, 89063428,
-89325574, 89718790, 90112003, 90308611, 90505220, 90767364, 91029508, 91291652,
-91553796, 91815939, 92012548, 92274691, 92471301, 92798980, 93061124, 93323269,
-93650948, 93913092, 94175236, 94437380, 94699524, 94961668, 95223814, 95617028};
-extern const uint32_t e1m1_WADSectors[1300] = {
-220203680, 1397641027, 3235633, 1413565510, 12850, 524543, 178257920, 1329794336,
-1597068110, 1279655991, 842159169, 16711680, 8, 246416320, 1330596934, 828323666,
-1263755078, 12633, 255, 115343360, 1279658336, 928141135, 1598435679, 827935571,
-16711680, 0, 99614960, 1330596934, 945763410, 1279870275, 3497779, 160,
-26214400, 1279659136, 875648065, 1162018816, 1597197385, 10485813, 0, 209715760,
-1413565510, 13361, 1279870275, 3497779, 160, 47185920, 1279659136, 875648065,
-1162018816, 1597197385, 10485813, 0, 209716080, 1413565510, 13361, 1279870275,
-3497779, 160, 68157440, 1279659136, 875648065, 1162018816, 1597197385, 10485813,
-0, 209716400, 1413565510, 13361, 1279870275, 3497779, 160, 99614720,
-1279659136, 875648065, 1162018816, 1597197385, 10485813, 0, 209716880, 1413565510,
-13361, 1279870275, 3497779, 160, 120586240, 1279659136, 875648065, 1162018816,
-1597197385, 10485813, 0, 209717200, 1413565510, 13361, 1279870275, 3497779,
-160, 141557760, 1279659216, 875648065, 1329790976, 1597068110, 10485809, 0,
-214960400, 1413565510, 13361, 1397641027, 3235633, 160, 68157440, 1279659696,
-810700623, 1598436191, 827935571, 15728640, 0, 246416560, 1330596934, 861876306,
-1263755078, 12633, 240, 89128960, 1279659136, 875648065, 1162018816, 1597197385,
-10485813, 0, 188745360, 1413565510, 12338, 1279870275, 3497779, 160,
-89128960, 1279657296, 810700623, 1279669087, 808604737, 10485760, 327689, 230689440,
-1413565510, 12338, 1413565510, 12338, 160, 141557760, 1279658896, 808604737,
-1162018816, 1597197385, 10485813, 0, 110100720, 1330596934, 945763410, 1279870275,
-3497779, 144, 15728640, 1279657456, 877809487, 1162033247, 1597197385, 9437237,
-0, 15728880, 1330596934, 945763410, 1413565510, 12338, 160, 15728640,
-1279656896, 877809487, 1162033247, 1597197385, 8388661, 0, 78643760, 1397641027,
-3235633, 1414089812, 828323397, 524543, 15728640, 1279658176, 877809487, 1162033247,
-1597197385, 7340085, 0, 94372160, 1330596934, 945763410, 1279870275, 3497779,
-144, 26214400, 1279657376, 877809487, 1162033247, 1597197385, 9437237, 0,
-78643680, 1330596934, 945763410, 1330596934, 828322898, 224, 31457280, 1279657136,
-877809487, 1279670367, 877809487, 9449823, 0, 199231440, 1413565510, 13361,
-1414089812, 895432261, 524543, 15728640, 1279656896, 877809487, 1162033247, 1597197385,
-9437237, 0, 62914800, 1330596934, 945763410, 1279870275, 3497779, 144,
-15728640, 1279656896, 877809487, 1162033247, 1597197385, 16711733, 1, 62914800,
-1330596934, 945763410, 1279870275, 3497779, 144, 5242880, 1431176528, 1162297675,
-1279655987, 808539201, 9437184, 7, 89129120, 1330596934, 878654802, 1413565510,
-12337, 144, 10485760, 1279656736, 894586703, 1162032223, 1597197385, 9437237,
-0, 4263573392, 1330596934, 828323666, 1263755078, 12633, 144, 4200595456,
-1279721312, 877809487, 1179465823, 1597526604, 9437233, 0, 4242602832, 1413565510,
-12338, 1413565510, 12338, 144, 4216324096, 1279720672, 808604737, 1279655936,
-808604737, 9437184, 0, 4242602832, 1413565510, 12338, 1413565510, 12338,
-144, 4153409536, 1279720192, 928141135, 1598435679, 827935571, 9437184, 0,
-4226873072, 1330596934, 828322130, 1414089812, 828323397, 255, 4195352576, 1279720752,
-827477839, 1280586079, 910513225, 16724319, 851976, 4242602832, 1413565510, 12338,
-1413565510, 12338, 144, 4200595456, 1279721152, 877809487, 1279670367, 858936385,
-9437184, 0, 4247845472, 1330596934, 945763410, 1380730445, 3235640, 144,
-4211081216, 1279656576, 877809487, 1179465823, 1597526604, 9437233, 0, 4247845472,
-1330596934, 945763410, 1380730445, 3235640, 144, 4200595456, 1279720032, 877809487,
-1279670367, 808604737, 9437184, 0, 42007456, 1330596934, 945763410, 1380730445,
-3235640, 144, 4216324096, 1279720672, 808604737, 1279655936, 808604737, 9437184,
-0, 4242602832, 1413565510, 12338, 1413565510, 12338, 144, 4232052736,
-1279656576, 877809487, 1179465823, 1597526604, 9437233, 0, 42007776, 1330596934,
-945763410, 1380730445, 3235640, 144, 4253024256, 1279656576, 877809487, 1179465823,
-1597526604, 8388657, 0, 246417840, 1413565510, 13361, 1279870275, 3497779,
-160, 178257920, 1329794336, 1597068110, 1279655989, 842159169, 16711680, 8,
-209717200, 1413565510, 13361, 1279870275, 3497779, 160, 141557760, 1279659216,
-875648065, 1329790976, 1597068110, 10485809, 0, 214960400, 1413565510, 13361,
-1397641027, 3235633, 160, 178257920, 1279659456, 808604737, 1279655936, 808604737,
-10485760, 0, 230689440, 1413565510, 12338, 1413565510, 12338, 160,
-78643200, 1279659136, 875648065, 1162018816, 1597197385, 10485813, 0, 209716560,
-1413565510, 13361, 1279870275, 3497779, 160, 99614720, 1279659136, 875648065,
-1162018816, 1597197385, 10485813, 0, 209716880, 1413565510, 13361, 1279870275,
-3497779, 160, 120586240, 1279659136, 875648065, 1162018816, 1597197385, 10485813,
-0, 193988720, 1413565510, 12338, 1279870275, 3497779, 160, 110100480,
-1279658816, 808604737, 1162018816, 1597197385, 10485813, 0, 99614960, 1330596934,
-945763410, 1279870275, 3497779, 160, 26214400, 1279659136, 875648065, 1162018816,
-1597197385, 10485813, 0, 15728880, 1330596934, 945763410, 1413565510, 12338,
-160, 36700160, 1279659136, 875648065, 1162018816, 1597197385, 10485813, 0,
-209715920, 1413565510, 13361, 1279870275, 3497779, 160, 57671680, 1279659136,
-875648065, 1162018816, 1597197385, 10485813, 0, 209716240, 1413565510, 13361,
-1279870275, 3497779, 160, 4289724416, 1279657136, 894586703, 1162031455, 1597197385,
-16711733, 0, 78708656, 1330596934, 828323154, 1279870275, 3497779, 112,
-15728640, 1279658256, 877809487, 1162033247, 1597197385, 8388661, 0, 78708656,
-1330596934, 828323154, 1279870275, 3497779, 112, 4284481536, 1279657696, 894586703,
-1280586079, 910513225, 16724319, 3, 78708656, 1330596934, 828323154, 1279870275,
-3497779, 112, 99614720, 1414727952, 3231813, 1162018816, 1597197385, 7340085,
-65536, 157288000, 1330596934, 828323666, 1414089812, 912209477, 196800, 4289724416,
-1279656576, 894586703, 1162031455, 1597197385, 7340085, 0, 42008496, 1330596934,
-828323154, 1279870275, 3497779, 112, 0, 1279656896, 877809487, 1162033247,
-1597197385, 16711733, 0, 62914640, 1330596934, 945763410, 1279870275, 3497779,
-176, 10485760, 1279656896, 877809487, 1162033247, 1597197385, 10485813, 0,
-62914800, 1330596934, 945763410, 1279870275, 3497779, 144, 15728640, 1279656176,
-877809487, 1279670367, 808604737, 9437184, 458752, 47185920, 1330596934, 861877074,
-1414089812, 912209477, 176, 15728640, 1279656176, 877809487, 1279670367, 808604737,
-9437184, 0, 99614960, 1330596934, 945763410, 1414089812, 828323397, 255,
-20971520, 1279657456, 877809487, 1280587871, 910513225, 16724319, 0, 99615120,
-1330596934, 945763410, 1414089812, 828323397, 255, 31457280, 1279657456, 877809487,
-1280587871, 910513225, 16724319, 0, 68157760, 1330596934, 945763410, 1414089812,
-895432261, 65791, 4284481536, 1279657056, 894586703, 1280586079, 910513225, 16724319,
-8, 4284546912, 1330596934, 828323154, 1330596934, 945763410, 589936, 36700160,
-1279657296, 875648065, 1279655936, 877809487, 8401247, 0, 193987200, 1413565510,
-13361, 1330596934, 828322898, 128, 125829120, 1414728592, 3231813, 1279655936,
-877809487, 8401247, 262144, 104858000, 1330596934, 828323154, 1414089812, 895432261,
-524543, 36700160, 1279657536, 894586703, 1280586079, 910513225, 16725343, 8,
-104858000, 1330596934, 828323154, 1279870275, 3235637, 524400, 26214400, 1279657536,
-894586703, 1162031455, 1597328457, 7340081, 8, 62914800, 1330596934, 945763410,
-1279870275, 3497779, 65791, 15728640, 1279656896, 877809487, 1162033247, 1597197385,
-7340085, 0, 15728880, 1330596934, 945763410, 1413565510, 12338, 589968,
-73400320, 1279659136, 894586703, 1162031455, 1597197385, 7340085, 0, 209716400,
-1330596934, 828323154, 1279870275, 3497779, 112, 89128960, 1279659136, 894586703,
-1162031455, 1597197385, 7340085, 0, 131072000, 1330596934, 945763410, 1380730445,
-3235640, 112, 0, 1279657936, 877809487, 1162033247, 1597197385, 7340085,
-0, 110101600, 1330596934, 828322130, 1413565510, 12850, 852223, 0,
-1279656576, 877809487, 1179465823, 1597526604, 7340081, 0, 0, 1330596934,
-945763410, 1413565510, 12338, 255, 73400332, 1279657616, 827477839, 1279668575,
-842159169, 16711680, 13, 42008096, 1330596934, 945763410, 1380730445, 3235640,
-128, 4273995776, 1279656576, 877809487, 1179465823, 1597526604, 8388657, 0,
-52494176, 1330596934, 945763410, 1414089812, 912209477, 196863, 0, 1279655936,
-877809487, 1279670367, 808604737, 16711680, 786432, 110101600, 1330596934, 828322130,
-1413565510, 12850, 852223, 99614720, 1279659136, 894586703, 1162031455, 1597197385,
-7340085, 0, 209716880, 1330596934, 828323154, 1279870275, 3497779, 112,
-120586240, 1279659136, 894586703, 1162031455, 1597197385, 7340085, 0, 209717200,
-1330596934, 828323154, 1279870275, 3497779, 112, 141557760, 1279659136, 894586703,
-1162031455, 1597197385, 7340085, 0, 209717520, 1330596934, 828323154, 1279870275,
-3497779, 112, 162529280, 1414728832, 3297349, 1162018816, 1597197385, 16711733,
-720896, 209717680, 1330596934, 828323154, 1279870275, 3497779, 255, 162529280,
-1279659136, 894586703, 1162031455, 1597197385, 7340085, 0, 162531760, 1330596934,
-828323154, 1413565510, 12338, 590079, 146800640, 1431180288, 1162297675, 1162018867,
-1597197385, 9437237, 7, 235932080, 1330596934, 828323154, 1279870275, 3497779,
-160, 162529280, 1279659136, 894586703, 1162031455, 1597197385, 11534389, 0,
-335546560, 1095456078, 3360071, 1279870275, 3497779, 458896, 4289724416, 1279657136,
-894586703, 1162031455, 1597197385, 7340085, 0, 115408736, 1330596934, 828323154,
-1414089812, 828323397, 196863, 4289725415, 1279656576, 894586703, 1162031455, 1597197385,
-7340085, 0, 115408736, 1330596934, 828323154, 1414089812, 828323397, 196863,
-4289725415, 1279656576, 894586703, 1162031455, 1597197385, 7340085, 0, 110100880,
-1330596934, 945763410, 1279870275, 3497779, 144, 36700160, 1279657616, 877809487,
-1162033247, 1597197385, 9437237, 0, 110101200, 1330596934, 945763410, 1279870275,
-3497779, 144, 57671680, 1279658096, 877809487, 1162033247, 1597197385, 9437237,
-0, 141558800, 1330596934, 945763410, 1279870275, 3497779, 144, 78643200,
-1279659136, 877809487, 1162033247, 1597197385, 9437237, 0, 209716560, 1330596934,
-945763410, 1279870275, 3497779, 144, 99614720, 1279659136, 877809487, 1162033247,
-1597197385, 9437237, 0, 209716880, 1330596934, 945763410, 1279870275, 3497779,
-144, 120586240, 1279659136, 877809487, 1162033247, 1597197385, 9437237, 0,
-209717200, 1330596934, 945763410, 1279870275, 3497779, 144, 141557760, 1279659136,
-877809487, 1162033247, 1597197385, 9437237, 0, 209717520, 1330596934, 945763410,
-1279870275, 3497779, 144, 146800640, 1431180288, 1162297675, 1162018867, 1597197385,
-9437237, 7, 131072960, 1330596934, 945763410, 1330596934, 895431762, 144,
-68157440, 1279657936, 877809487, 1279670367, 877809487, 9450847, 0, 131073120,
-1330596934, 945763410, 1330596934, 895431762, 144, 78643200, 1279657936, 877809487,
-1279670367, 877809487, 9450847, 0, 131073280, 1330596934, 861877586, 1279870275,
-3497779, 144, 83886080, 1279659696, 894586703, 1162031967, 1597197385, 16711733,
-0, 267386880, 1330596934, 828323666, 1263755078, 12633, 255, 104857600,
-1279659456, 808604737, 1279655936, 808604737, 16711680, 0, 230688320, 1413565510,
-12338, 1413565510, 12338, 255, 83886080, 1279657936, 894586703, 1162031967,
-1597197385, 16711733, 0, 83886080, 1330596934, 828323666, 1263755078, 12633,
-255, 68157440, 1431178928, 1162297675, 1162018867, 1597197385, 16711733, 7,
-246417680, 1330596934, 945763410, 1279870275, 3497779, 255, 104857608, 1279659456,
-808604737, 1279655936, 808604737, 16711680, 0, 125830320, 1330596934, 945763410,
-1279870275, 3497779, 144, 94371840, 1279657856, 808604737, 1162018816, 1597197385,
-9437237, 0, 209717520, 1330596934, 945763410, 1279870275, 3497779, 786687,
-10, 1279657376, 894586703, 1279668575, 877809487, 9450847, 0, 36765616,
-1330596934, 828323154, 1414089812, 895432261, 255, 4284481536, 1279656416, 894586703,
-1280586079, 910513225, 16725343, 8, 94371920, 1330596934, 945763410, 1330596934,
-895431762, 144, 10485760, 1279657376, 877809487, 1279670367, 877809487, 9450847,
-0, 94372080, 1330596934, 945763410, 1330596934, 895431762, 144, 47185920,
-1279656736, 894586703, 1280586079, 910513225, 13663, 8, 4284546912, 1330596934,
-828323154, 1330596934, 945763410, 589920, 4284481542, 1279656496, 894586703, 1280586079,
-910513225, 16725343, 0, 94372160, 1330596934, 945763410, 1330596934, 895431762,
-144, 26214400, 1279657376, 877809487, 1279670367, 877809487, 9450847, 0,
-94372320, 1330596934, 945763410, 1330596934, 895431762, 144, 31457280, 1279657376,
-877809487, 1280587871, 910513225, 16725599, 2, 31457760, 1330596934, 945763410,
-1330596934, 895431762, 589968, 36700160, 1279657376, 877809487, 1279670367, 877809487,
-9450847, 0, 94372480, 1330596934, 945763410, 1330596934, 895431762, 144,
-47185920, 1279657376, 877809487, 1279670367, 877809487, 9450847, 0, 94372640,
-1330596934, 945763410, 1330596934, 895431762, 144, 57671680, 1279657936, 877809487,
-1279670367, 877809487, 9450847, 0};
-extern const uint32_t e1m1_WADNodes[4023] = {
-2555904, 4294246400, 0, 131072, 29360640, 83887232, 29360640, 71304192,
-2147581952, 2031616, 1638400, 917504, 4294895616, 63964736, 88081280, 102499984,
-88081280, 2147713026, 2162688, 4294705152, 4294934528, 0, 44040992, 62915408,
-41943712, 61866832, 2147844100, 2162688, 0, 0, 4294705152, 41943840,
-62915408, 44041024, 67109824, 2147876866, 2424832, 131072, 0, 4294705152,
-46138208, 71304192, 48235392, 75498560, 2148040711, 2293760, 65536, 0,
-4294705152, 41943872, 67109712, 46138240, 75498496, 262147, 2686976, 262144,
-0, 4294705152, 50332576, 79692928, 52429760, 83887296, 2148171785, 2818048,
-327680, 0, 4294705152, 50332608, 83887232, 54526912, 88081664, 2148204550,
-2555904, 196608, 0, 4294705152, 41943936, 75498320, 50332608, 88081536,
-458757, 2949120, 360448, 4294049792, 0, 63964816, 88081280, 41944000,
-88081232, 524289, 2555904, 4294377472, 262144, 0, 29360640, 83887104,
-41944720, 88081232, 589824, 3407872, 4294901760, 4294541312, 0, 50332480,
-102761792, 46138112, 102761808, 2148368396, 3407872, 4294770688, 4294574080, 0,
-46138176, 102761792, 41943744, 102761824, 2148401163, 3407872, 4294377472, 4294672384,
-0, 33555008, 102761856, 29360640, 102761872, 2148630544, 3407872, 4294508544,
-4294639616, 0, 37749376, 102761840, 29360704, 102761856, 884751, 3407872,
-4294639616, 4294606848, 0, 41943872, 102761792, 29360768, 102761840, 917516,
-2949120, 1564672, 458752, 4294932480, 71304732, 102761792, 101320322, 102761792,
-2148761618, 3194880, 589824, 0, 4294836224, 67109952, 95946168, 67109952,
-102761912, 2148892692, 3407872, 589824, 4294754304, 0, 71304834, 102761792,
-67109952, 102761912, 1114128, 3194880, 458752, 0, 4294868992, 63964160,
-95946048, 63964160, 102761912, 2149023766, 3407872, 458752, 4294754304, 0,
-67110530, 102761792, 63964160, 102761792, 1245202, 3145728, 360448, 0,
-4294934528, 62915536, 94373200, 62915536, 102761912, 2149220377, 2949120, 327680,
-32768, 0, 54526912, 102761792, 62915536, 102761808, 1409048, 3145728,
-360448, 4294803456, 0, 63964802, 102761792, 54526928, 102761792, 1441812,
-2949120, 65536, 458752, 0, 29360960, 102761792, 54527618, 102761792,
-1507343, 3801088, 4294279168, 0, 4294934528, 29360592, 115344992, 29360592,
-159385360, 2149416988, 3801088, 4294279168, 4294705152, 0, 30410245, 159385184,
-29360592, 159385184, 1671195, 4915200, 1409024, 262144, 4294443008, 29361669,
-159385184, 80741840, 159385856, 2149449754, 5177344, 884736, 0, 4293361664,
-29361669, 159385184, 29361595, 167774592, 2149515291, 3440640, 4294279168, 0,
-360448, 30409640, 106956336, 41943976, 103810592, 2149679136, 3440640, 360448,
-4294934528, 0, 63964682, 106956320, 61342672, 103810608, 2149810210, 3407872,
-278528, 32768, 0, 30409640, 106956320, 61343242, 106956320, 1966109,
-3538944, 4294246400, 0, 32768, 29361669, 167773792, 30410250, 106956320,
-2031644, 3407872, 1527808, 1507328, 4294848512, 29361674, 167773728, 96142969,
-167773728, 2149842976, 3407872, 65536, 0, 4294836224, 29361794, 102761792,
-29361785, 167773728, 2162712, 2949120, 327680, 0, 4294705152, 29361808,
-88081232, 29361794, 167773504, 2228234, 1851392, 4294639616, 4294623232, 4294836224,
-37749504, 54526592, 41943689, 54526760, 2150072358, 1507328, 4294770688, 0,
-4294705152, 37749440, 41943472, 37749504, 54526592, 2392101, 1900544, 4294901760,
-0, 4294705152, 37749504, 54526384, 41943808, 55575360, 2150105125, 458752,
-458752, 4294836224, 0, 67109952, 8454127, 62915584, 4259776, 2150334506,
-65536, 327680, 262144, 0, 49808320, 8454016, 62915648, 8454080,
-2588713, 4294901760, 4294885376, 524288, 0, 37749496, 42008373, 49742584,
-4286644087, 2150465580, 458752, 4294885376, 4294443008, 0, 49808448, 8454016,
-37749496, 42008373, 2687016, 1507328, 4294770688, 344064, 131072, 37749504,
-55574960, 37749824, 42008373, 2752550, 851968, 4294246400, 4294705152, 262144,
-29360704, 27263168, 29360672, 18874464, 2150596654, 1081344, 4294508544, 4294934528,
-4294934528, 36700736, 28311968, 33554960, 28311968, 2150989876, 1179648, 4294475776,
-4294934528, 32768, 36700736, 31457744, 33555008, 28311968, 2981939, 1179648,
-4294410240, 0, 65536, 34603568, 31457760, 33555008, 31457696, 3047474,
-1081344, 4294377472, 65536, 0, 33554944, 30409136, 33555008, 31457696,
-3113009, 1146880, 4294377472, 32768, 32768, 29360704, 41943504, 33555008,
-31457696, 3178544, 1048576, 4294475776, 0, 4294901760, 29360704, 27263072,
-29360704, 41943456, 3211308, 360448, 4294475776, 4294639616, 0, 36700736,
-6356896, 35652144, 5308336, 2151120950, 327680, 4294410240, 4294705152, 0,
-34603552, 4259776, 29360656, 4259776, 2151252024, 65536, 4294410240, 0,
-32768, 29360672, 4259776, 29360672, 4290313990, 2151284788, 327680, 4294443008,
-4294705152, 0, 35652160, 6356896, 29360672, 4259590, 3473459, 393216,
-4294246400, 0, 196608, 29360704, 41943136, 29360704, 6356742, 3538994,
-589824, 4294508544, 4294770688, 0, 37749824, 55639861, 29360704, 42008326,
-3604523, 1933312, 4294639616, 0, 262144, 29361808, 167773008, 29361216,
-55639814, 3670051, 4294508544, 4294508544, 0, 4294705152, 29360704, 4274060816,
-29360672, 4280942336, 2151514172, 4294748160, 4294508544, 4294729728, 0, 37749495,
-4286054080, 29360704, 4280942096, 3833915, 4294049792, 4294541312, 0, 4294901760,
-36700752, 4259380704, 35652144, 4260429280, 2151972931, 4294148096, 4294574080, 4294901760,
-0, 39846496, 4262526448, 35652176, 4260429280, 3964994, 4294180864, 4294541312,
-4294934528, 32768, 38797920, 4263575056, 35652192, 4262526432, 4030529, 4294082560,
-4294443008, 65536, 0, 35652128, 4262526448, 35652192, 4263575008, 4096064,
-4294180864, 4294475776, 0, 65536, 36700901, 4275502624, 35652192, 4263575008,
-4161599, 4294082560, 4294574080, 4294934528, 4294934528, 29360857, 4268424512, 35652325,
-4275502560, 4227134, 4294148096, 4294443008, 32768, 32768, 29360887, 4286053904,
-29360869, 4275502400, 4259899, 4292935680, 4294639616, 262144, 0, 33555072,
-4232117184, 41943696, 4232117184, 2152169542, 4293197824, 4294672384, 4294705152, 0,
-42992285, 4232117184, 33555088, 4232117184, 4423749, 4293197824, 4294377472, 131072,
-4294901760, 31457792, 4236311616, 29360608, 4246797440, 2152300616, 4293656576, 4294311936,
-0, 4294901760, 29360640, 4246797376, 29360592, 4248894768, 2152333381, 4293197824,
-4294699008, 0, 4294940672, 33555101, 4232117184, 29360640, 4248894528, 4587588,
-4293722112, 4294246400, 0, 32768, 29360887, 4286053696, 29360797, 4248894400,
-4653122, 65536, 458752, 4294836224, 0, 67109952, 4293918592, 62915584,
-4290838464, 2152497227, 4293984256, 655360, 4294934528, 0, 73401504, 4257283504,
-69207136, 4257283504, 2153021523, 4293984256, 524288, 0, 131072, 69207200,
-4261477824, 69207200, 4257283504, 4882514, 4293951488, 524288, 32768, 0,
-65012768, 4261477808, 69207200, 4261477808, 4948049, 4293951488, 655360, 4294868992,
-0, 73401504, 4256234816, 69207136, 4253089088, 2153218134, 4293853184, 524288,
-98304, 0, 65012768, 4256234816, 69207200, 4256234816, 5079125, 4293951488,
-524288, 0, 131072, 65012896, 4261477808, 65012896, 4256234816, 5111884,
-4293722112, 393216, 393216, 0, 54526944, 4261477696, 65012896, 4261477696,
-5210192, 4294115328, 393216, 0, 393216, 54527136, 4269866496, 54527136,
-4261477696, 5275727, 4294115328, 786432, 4294574080, 0, 77595936, 4269866304,
-54527136, 4269866304, 5341262, 4293722112, 786432, 0, 4294574080, 54527264,
-4248894528, 54527264, 4269866304, 5406797, 4294901760, 458752, 0, 131072,
-62915648, 4293918592, 54527264, 4269866048, 5439561, 4293197824, 65536, 0,
-4294633472, 42992640, 4232117184, 54526976, 4240505920, 2153349208, 4293591040, 65536,
-4294836224, 131072, 54527264, 4293917760, 42992640, 4240505792, 5570644, 4293853184,
-4294770688, 1030144, 112640, 29360887, 4286053312, 42992928, 4293917632, 5636168,
-4294541312, 3047424, 131072, 4294868992, 142608640, 4279303808, 149948672, 4275109563,
-2153545819, 4294672384, 2949120, 4294836224, 4294836224, 142608640, 4279303808, 142084288,
-4279828176, 2153578584, 4294672384, 2949120, 16384, 4294950912, 142084352, 4279828096,
-146278656, 4279828248, 2153644121, 4294557696, 2801664, 131072, 131072, 136710400,
-4288741080, 142084352, 4279828096, 5931098, 4293869568, 2932736, 131072, 4294836224,
-142084280, 4257807752, 142084288, 4258332040, 2153939041, 4294017024, 2818048, 4294836224,
-131072, 142608576, 4258332048, 142084288, 4258332040, 6062176, 4294541312, 2818048,
-4294836224, 0, 142608512, 4275109328, 142084224, 4270915088, 2154070115, 4294017024,
-2818048, 4294950912, 4294950912, 142084288, 4258332040, 142084224, 4275109328, 6160477,
-4294148096, 2801664, 262144, 0, 127928440, 4281007296, 142084288, 4275109256,
-6258783, 4294557696, 2801664, 4294950912, 16384, 136710400, 4288740992, 127928512,
-4281007296, 6291547, 0, 2686976, 4293459968, 4294639616, 127928576, 4288740544,
-127928384, 4288740544, 2154102881, 0, 3080192, 0, 4294574080, 127928576,
-4288740544, 129894656, 4259744, 2154168418, 4294715392, 3778560, 251904, 4294924288,
-150997589, 4288741144, 171969180, 4288741157, 2154332263, 0, 3735552, 0,
-4294311936, 150997660, 4288741144, 150997642, 4259744, 2154365028, 4294508544, 3080192,
-0, 131072, 150997312, 4278255296, 150997312, 4274060928, 2154528874, 4294672384,
-3342336, 4294836224, 4294868992, 155191744, 4279303808, 155191632, 4275109563, 2154659948,
-4294688768, 3358720, 4294836224, 131072, 159910344, 4279828184, 159386056, 4279828176,
-2154791022, 4294541312, 3473408, 131072, 4294836224, 155191744, 4279303808, 159386056,
-4279828176, 6815847, 4294410240, 3473408, 131072, 0, 163580352, 4275109520,
-164104648, 4275633816, 2154922096, 4294541312, 3473408, 16384, 16384, 155191752,
-4279828096, 163580360, 4275633808, 6946921, 4294377472, 3211264, 131072, 0,
-150997312, 4278255232, 155191752, 4279828096, 7012454, 4294688768, 3080192, 0,
-278528, 150997660, 4259608, 150997448, 4279828096, 7077989, 4294361088, 3178496,
-4294950912, 0, 154143024, 4269342320, 152045872, 4269342320, 2155249781, 4294344704,
-3112960, 16384, 0, 152045840, 4269342320, 152045872, 4269342320, 7241844,
-4294344704, 3178496, 0, 4294901760, 152045872, 4268818032, 152045872, 4269342320,
-7307379, 4294361088, 3112960, 0, 65536, 150997312, 4269866616, 152045872,
-4269342320, 7372914, 4294377472, 3080192, 0, 131072, 150997660, 4259456,
-150997312, 4269866608, 7405677, 4294377472, 3080192, 131072, 0, 127928576,
-4259008, 150997660, 4259440, 7471203, 4293591040, 2883584, 0, 262144,
-144705856, 4252040448, 142608672, 4244700352, 2155446392, 4293853184, 3080192, 0,
-131072, 150997312, 4254137728, 150997312, 4253089136, 2155577466, 4293820416, 3211264,
-0, 4294836224, 142608704, 4252040384, 150997312, 4254137712, 7667828, 4293591040,
-2883584, 4294836224, 4294901760, 142608704, 4254137536, 133171384, 4253613248, 2155610230,
-4293885952, 2949120, 0, 131072, 146803008, 4254137744, 133171520, 4254137536,
-7831671, 4293459968, 2523136, 0, 262144, 133171520, 4254137536, 136317208,
-4240505984, 2155675768, 4294000640, 3489792, 4294836224, 4294836224, 159910344, 4257807752,
-159386056, 4258332040, 2155970688, 4293885952, 3342336, 131072, 131072, 155191744,
-4258332048, 159386056, 4258332040, 8028287, 4293869568, 3358720, 0, 4294836224,
-155716288, 4253613232, 155191752, 4258332040, 8093822, 4294017024, 3473408, 131072,
-0, 163580352, 4270915024, 163580360, 4270915088, 2156167299, 4294148096, 3489792,
-4294819840, 0, 164104889, 4280679639, 163580360, 4270915024, 8224898, 4294000640,
-3489792, 16384, 4294950912, 155192000, 4258331824, 163580601, 4280679639, 8257660,
-4293427200, 3997696, 1288192, 4294748160, 155192000, 4280679600, 173345472, 4285332656,
-2156200063, 4293722112, 3211264, 98304, 0, 133171520, 4254137472, 155192000,
-4285332656, 8388729, 4293869568, 2932736, 16384, 16384, 127928988, 4259008,
-133171904, 4285332608, 8454259, 4293197824, 2555904, 0, 442368, 134220032,
-4236311616, 134219992, 4232117248, 2156363910, 4293066752, 2555904, 0, 442368,
-134220032, 4236311552, 134220016, 4227922880, 2156396675, 4293328896, 2621440, 0,
-458752, 127929024, 4258944, 134220032, 4236311488, 8650882, 4293312512, 1048576,
-950272, 0, 29361440, 4293917632, 127929024, 4258752, 8716375, 4294901760,
-4294934528, 131072, 360448, 29361808, 167837446, 29362880, 4258752, 8781881,
-2818048, 4293853184, 4294705152, 0, 16777664, 83887232, 12583168, 83887232,
-2156560521, 2293760, 4293722112, 0, 327680, 12583360, 71304192, 4194407,
-52953792, 2156757132, 2424832, 4293918720, 0, 262144, 18874784, 75498560,
-4194752, 71303872, 9011339, 2555904, 4293722112, 0, 131072, 12583360,
-83887232, 4194752, 75498176, 9044104, 3080192, 4293591040, 327680, 0,
-4194432, 102761840, 8388800, 102761856, 2156888206, 3112960, 4293853184, 294912,
-0, 12583168, 102761872, 16777664, 102761872, 2157019280, 3112960, 4293722112,
-0, 131072, 12583360, 102761872, 16777664, 93324544, 2157052045, 3112960,
-4293722112, 294912, 0, 4194496, 102761840, 12583360, 102761728, 9306252,
-2818048, 4293853184, 0, 4294836224, 4194752, 83886784, 4194752, 102761728,
-9371787, 3538944, 4293820416, 262144, 0, 4194544, 115344944, 15728896,
-115344992, 2157281428, 3457024, 4293853184, 4294918144, 0, 16777664, 115344928,
-4194560, 115344944, 9535635, 5177344, 4294246400, 0, 4294180864, 4194752,
-159385360, 4194752, 167774592, 2157412502, 3866624, 4294180864, 0, 4294705152,
-18874816, 117442272, 18874784, 118490880, 2157543576, 3866624, 4293918720, 4294901760,
-4294901760, 16777504, 117442272, 15728880, 118490848, 2157674650, 3899392, 4293918720,
-4294934528, 0, 18874816, 118490848, 15728928, 118490848, 9765012, 3899392,
-4293918720, 0, 262144, 4194752, 167773968, 15729088, 118490848, 9830547,
-3801088, 4293853184, 0, 4294934528, 4194752, 115344928, 4194752, 167773920,
-9896082, 3407872, 4293722112, 0, 4294836224, 4194752, 102761152, 4194752,
-167773728, 9961616, 2949120, 4293066752, 0, 4294705152, 4278255488, 88081696,
-4278255488, 102761792, 2157805724, 3014656, 4293328896, 393216, 0, 4290772992,
-102761808, 64, 102761824, 2158002335, 2981888, 4293197824, 425984, 0,
-4286644160, 102761792, 4290773056, 102761808, 10191006, 2949120, 4293066752, 458752,
-0, 4278255488, 102761760, 4286578752, 102761792, 10223770, 5177344, 4293459968,
-0, 4294311936, 4278190144, 159385136, 4278190144, 167774592, 2158133409, 3440640,
-4292804608, 0, 49152, 4278190144, 167773744, 4279763008, 103810592, 2158166174,
-3407872, 4293197824, 0, 4294836224, 4278190144, 102761760, 4278190144, 167773728,
-10420381, 3440640, 4292771840, 0, 32768, 4277206784, 159385136, 4277206784,
-101188928, 2158395557, 3358720, 4292771840, 81920, 0, 4251582192, 158926010,
-4277206784, 159384896, 10584228, 4915200, 4292149248, 4292728832, 4294789120, 4251582208,
-159384762, 4245487040, 150996130, 2158428322, 5177344, 4292804608, 4294705152, 4294311936,
-4245487360, 159384738, 4248108800, 167774408, 2158493859, 2949120, 4292804608, 4294918144,
-0, 4278190144, 167773472, 4245487360, 167773346, 10748064, 2674688, 4291971072,
-4293931008, 4294885376, 4248895216, 85721792, 4244700521, 79299264, 2158657705, 1933312,
-4293459968, 196608, 4294901760, 4288675904, 62915408, 1703968, 62915504, 2158788779,
-2162688, 4293394432, 0, 4294705152, 4288675904, 62915408, 4286578720, 67109824,
-2158821543, 1900544, 4293197824, 4294918144, 0, 4290773056, 54526760, 4289593280,
-52953792, 2158985390, 1900544, 4293459968, 0, 4294705152, 4289527872, 54526656,
-4290773056, 55575360, 2159018153, 1933312, 4293197824, 0, 262144, 4286578752,
-67109712, 4289527872, 55575232, 11141288, 2424832, 4293263360, 0, 4294705152,
-4284481536, 71304192, 4282449888, 75498560, 2159182001, 2555904, 4293197824, 0,
-4294705152, 4282384384, 75498496, 4280352704, 79692928, 2159214764, 2818048, 4293066752,
-0, 4294705152, 4278255520, 83887296, 4278255488, 88081664, 2159378612, 2686976,
-4293132288, 0, 4294705152, 4280287232, 79692800, 4278255520, 88081600, 11403437,
-2293760, 4293328896, 0, 4294705152, 4286578752, 67109568, 4278190080, 88081408,
-11468971, 2031616, 4292771840, 843776, 0, 4244700912, 85721792, 4278190144,
-88081088, 11534502, 2949120, 4293066752, 32768, 131072, 4245422144, 167773346,
-4244635712, 88081088, 11600037, 3407872, 4293459968, 4294606848, 0, 4194752,
-167772864, 4244635712, 167772864, 11665561, 4292935680, 4293439488, 262144, 149504,
-128, 4246797248, 3539072, 4232117184, 2159509686, 4293984256, 4293459968, 4294705152,
-0, 4194432, 4257283392, 64, 4257283392, 2159640760, 4293656576, 4293591040,
-0, 4294705152, 128, 4246797248, 128, 4257283392, 11862196, 4293394432,
-4293197824, 327680, 4294443008, 4274061248, 4248894624, 4274061248, 4257283232, 2159771834,
-4293394432, 4293197824, 4294508544, 0, 4290838464, 4238408640, 4274061184, 4236311552,
-2159902908, 4293394432, 4292673536, 0, 524288, 4274061248, 4257283232, 4274061248,
-4238408640, 12058807, 4293656576, 4293328896, 0, 4294639616, 4284481536, 4246797600,
-4286578688, 4257283392, 2160099519, 4293656576, 4293001216, 327680, 0, 4274061152,
-4257283360, 4284481536, 4257283360, 12222654, 4293656576, 4293001216, 327680, 4294639616,
-4274061248, 4257283008, 4273995776, 4257283360, 12255417, 4293984256, 4293328896, 4294705152,
-0, 128, 4257283008, 4273995776, 4257283008, 12320950, 4294180864, 4293001216,
-0, 4294639616, 4274061152, 4263574976, 4274061120, 4274060864, 2160230593, 4294098944,
-4293459968, 4294852608, 0, 4194368, 4260953536, 4286578688, 4261477824, 2160427204,
-4294426624, 4293132288, 4294639616, 327680, 4288675968, 4274060792, 4286578752, 4261477824,
-12550339, 4293984256, 4293001216, 196608, 0, 4274061152, 4274060736, 4286578816,
-4274060736, 12583102, 4293984256, 4293328896, 0, 4294705152, 4273995904, 4257283008,
-4273995904, 4274060736, 12648637, 4294246400, 4292018176, 4294836224, 0, 4253089280,
-4265672064, 4240506240, 4261477760, 2160623815, 4294246400, 4291624960, 0, 393216,
-4240506368, 4274060864, 4240506368, 4265672064, 12812486, 4294246400, 4292411392, 0,
-262144, 4265672384, 4274060864, 4265672384, 4265672224, 2160820426, 4294180864, 4292673536,
-0, 4294705152, 4265672384, 4263574976, 4265672384, 4274060832, 12943561, 4293853184,
-4292280320, 655360, 0, 4240506368, 4274060672, 4265672384, 4274060736, 12976324,
-4292935680, 4292411392, 131072, 0, 4257283648, 4236311488, 4265672384, 4236311552,
-2160951500, 4293328896, 4292673536, 0, 4294443008, 4257283776, 4236311488, 4250468032,
-4248894624, 2160984264, 4292935680, 4291887104, 458752, 0, 4240506176, 4253088704,
-4248894808, 4248894624, 2161148111, 4293722112, 4291936256, 4294639616, 0, 4250468032,
-4248894400, 4240506200, 4253088704, 13238473, 4293853184, 4291887104, 0, 393216,
-4240506560, 4274060672, 4240506560, 4253088704, 13304007, 4293984256, 4292673536, 4294705152,
-0, 4273995904, 4274060224, 4240506560, 4274060224, 13369538, 4293197824, 4293656576,
-262144, 0, 8388768, 4240505920, 10485952, 4240505920, 2161279185, 4293197824,
-4293722112, 262144, 0, 8388800, 4240505920, 12583136, 4240505920, 2161311950,
-4293459968, 4293918720, 4294705152, 0, 18874656, 4240505920, 17826080, 4240505920,
-2161541333, 4293197824, 4293885952, 262144, 0, 14680336, 4240505920, 17826080,
-4240505920, 13664468, 4293197824, 4293787648, 262144, 0, 8388832, 4240505920,
-14680352, 4240505920, 13697231, 4293197824, 4293918720, 4294836224, 196608, 18874752,
-4232117248, 25166208, 4227922880, 2161737944, 4292935680, 4293918720, 49152, 0,
-10486048, 4227922880, 18874752, 4232117184, 13861079, 4293197824, 4293656576, 0,
-65536, 8388896, 4240505920, 10486144, 4232117184, 13893842, 4293722112, 4293951488,
-0, 294912, 19923392, 4274060608, 19923392, 4248894768, 2161869018, 4294508544,
-4294246400, 4294180864, 4294672384, 19923392, 4274060592, 8389056, 4274060608, 2161901782,
-4293656576, 4294246400, 0, 4294705152, 18874816, 4246797504, 20971968, 4247846176,
-2162065629, 4293689344, 4293984256, 0, 262144, 8389056, 4274060592, 18874816,
-4247846080, 14155991, 4293459968, 4293885952, 0, 4294868992, 8388992, 4240505792,
-8389056, 4274060480, 14221525, 4293459968, 4293591040, 196608, 0, 4240441472,
-4274060224, 8389056, 4274060224, 14287053, 1507328, 4293722112, 0, 4294836224,
-4194496, 41943360, 6750336, 46137984, 2162262240, 1114112, 4293427200, 0,
-4294901760, 1048624, 29360576, 16, 30409152, 2162655462, 1146880, 4293459968,
-4294934528, 4294934528, 3145792, 30409152, 48, 30409152, 14516453, 1245184,
-4293427200, 4294934528, 32768, 3145792, 33554928, 64, 30409152, 14581988,
-1245184, 4293361664, 0, 65536, 1048624, 33554944, 64, 33554880,
-14647523, 1212416, 4293328896, 32768, 32768, 16, 33554928, 64,
-33554880, 14713058, 1212416, 4293459968, 4294901760, 0, 4194496, 46137664,
-64, 33554880, 14745820, 589824, 4293459968, 0, 4294836224, 64,
-12582944, 64, 20971712, 2162852073, 851968, 4293459968, 4294705152, 0,
-4194496, 20971616, 64, 20971552, 14909672, 4294770688, 4293328896, 0,
-131072, 64, 4292935488, 64, 4282449600, 2163048684, 4294770688, 4293459968,
-4294705152, 0, 4194496, 4288741056, 64, 4292935360, 15040747, 32768,
-4293525504, 327680, 0, 4718688, 5308336, 6291648, 11599696, 2163572980,
-4294803456, 4293722112, 196608, 4294770688, 4718784, 4291362616, 4718784, 11599696,
-15171827, 360448, 4293525504, 196608, 196608, 4718784, 13107256, 4718784,
-11599672, 15237362, 32768, 4293476352, 327680, 0, 3145800, 5308336,
-4718784, 13172536, 15302897, 4294754304, 4293722112, 245760, 4294721536, 3145920,
-4291362592, 3145920, 13172536, 15368432, 360448, 4293476352, 245760, 245760,
-3145920, 14680120, 3145920, 13172512, 15433967, 32768, 4293427200, 327680,
-0, 48, 5308336, 3145920, 14745376, 15499502, 4294705152, 4293722112,
-294912, 4294672384, 192, 4292935360, 192, 14745376, 15532262, 360448,
-4293427200, 294912, 294912, 192, 20971552, 192, 14745280, 15597796,
-851968, 4293459968, 0, 262144, 192, 46137664, 192, 21036736,
-15663330, 4294770688, 4293328896, 786432, 0, 4288675840, 46202560, 192,
-46202560, 15761631, 4294901760, 4292673536, 0, 458752, 4274061216, 8454016,
-4274061120, 4282449600, 2163704054, 4294770688, 4292673536, 0, 4294705152, 4265672384,
-4282449664, 4271963840, 2162656, 2163900665, 4294770688, 4292411392, 524288, 0,
-4257283648, 4259584, 4265672384, 2162432, 15958264, 4294639616, 4292673536, 4294836224,
-0, 4274061216, 8453824, 4257283776, 4259584, 15991026, 458752, 4293132288,
-0, 4294508544, 4257284000, 8453824, 4257283648, 33554560, 2163933429, 4294770688,
-4291231744, 1048576, 0, 4219534336, 25231168, 4227923008, 20971840, 2164293887,
-851968, 4291362816, 4294180864, 0, 4232117440, 21036992, 4219534400, 25231168,
-16220414, 4294770688, 4291624960, 0, 4294574080, 4219534528, 4282449600, 4219534528,
-25231168, 16285949, 720896, 4292018176, 262144, 0, 4244700544, 25231232,
-4253089216, 16842624, 2164424961, 851968, 4291756032, 4294049792, 0, 4244700608,
-25231232, 4240506112, 20971840, 2164457722, 4294901760, 4291756032, 0, 393216,
-4240506304, 25231232, 4240506176, 4282449600, 2164523259, 65536, 4291624960, 786432,
-0, 4219534528, 25231040, 4240506304, 25231040, 16515321, 983040, 4292018176,
-0, 131072, 4219534784, 33554816, 4219534784, 25231040, 16613628, 1376256,
-4291428352, 0, 131072, 4232117440, 46137920, 4234214560, 37749248, 2164687109,
-1245184, 4292149248, 0, 4294410240, 4219534784, 33619648, 4232117440, 46137856,
-16711934, 4294901760, 4292149248, 4294705152, 0, 4257284000, 33619648, 4219534784,
-46202560, 16777462, 4294901760, 4293132288, 4294574080, 0, 4288676032, 46202560,
-4219535264, 46202560, 16842993, 65536, 4293984256, 0, 262144, 12583360,
-4259776, 16777536, 4290838400, 2164818183, 4294574080, 4293984256, 327680, 0,
-16777536, 4286643936, 20971904, 4286643936, 2164949257, 4294639616, 4294115328, 262144,
-0, 16777600, 4286643936, 25166272, 4286643968, 2164982020, 4294901760, 4293853184,
-0, 131072, 12583360, 4259712, 16777664, 4286643936, 17105155, 524288,
-4294082560, 0, 65536, 24117648, 10485920, 23069088, 10485888, 2165408016,
-524288, 4294148096, 4294901760, 32768, 25166272, 12583040, 23069088, 10485888,
-17269007, 458752, 4294049792, 65536, 32768, 20971904, 12583040, 23069120,
-12583040, 17334542, 589824, 4293984256, 0, 262144, 20971968, 18874560,
-20971968, 12583040, 17400077, 458752, 4294180864, 4294901760, 0, 27263424,
-8388704, 23069088, 8388704, 2165604627, 393216, 4294049792, 65536, 0,
-20971872, 8388704, 23069120, 8388704, 17531154, 458752, 4294180864, 0,
-65536, 20971968, 18874496, 20971968, 8388704, 17563914, 393216, 4293984256,
-65536, 0, 14680384, 18874464, 20971968, 18874464, 17662220, 1507328,
-4294017024, 4294311936, 0, 22020544, 41943360, 20971856, 41943360, 2165801238,
-851968, 4293984256, 655360, 0, 12583232, 41943360, 20971968, 41943360,
-17793301, 819200, 4293984256, 0, 4294836224, 16777536, 19923232, 16777536,
-20971824, 2165932312, 851968, 4294017024, 0, 229376, 12583360, 41943360,
-16777536, 20971808, 17891600, 786432, 4294246400, 0, 4294705152, 14680512,
-18874464, 12583360, 41943328, 17957134, 327680, 4294148096, 0, 4294918144,
-12583360, 4259552, 12583360, 41943136, 18022662, 4294803456, 4293722112, 229376,
-0, 4219470016, 46202560, 12583360, 42008288, 18088194, 4294508544, 4293722112,
-0, 4294705152, 4240441792, 4274060224, 4219470272, 46202560, 18153691, 1638400,
-4291887104, 0, 655360, 4244636096, 167772864, 4219470272, 46201792, 18219187,
-3801088, 4294246400, 4294705152, 0, 29362880, 167836608, 4219470272, 167836608,
-18284679, 4291624960, 1900544, 4294836224, 0, 113248000, 4181784832, 111150784,
-4181784800, 2166063386, 4291624960, 1835008, 4294770688, 0, 111150848, 4181784800,
-109053600, 4181784800, 2166096153, 4292149248, 1851392, 4294705152, 0, 111675136,
-4198562112, 109053608, 4198562240, 2166259997, 4291624960, 1835008, 0, 4294901760,
-109053696, 4181784800, 109053696, 4198562112, 18546970, 4291624960, 2031616, 0,
-524288, 117442560, 4181784896, 117442560, 4181784832, 2166456608, 4291493888, 2031616,
-131072, 0, 113248000, 4181784832, 117442560, 4181784832, 18710815, 4291428352,
-1835008, 65536, 65536, 109053696, 4198562016, 113248256, 4181784832, 18743580,
-4291788800, 2686976, 4294868992, 4294868992, 135268416, 4187027808, 134744128, 4187552096,
-2166653219, 4291624960, 2555904, 81920, 16384, 134219784, 4184406336, 135268416,
-4183882016, 2166784293, 4291706880, 2572288, 4294950912, 16384, 134744128, 4187552096,
-134219840, 4184406304, 18940192, 4291706880, 2572288, 98304, 98304, 134744128,
-4198562152, 134219840, 4187552032, 19038498, 4291887104, 2686976, 0, 131072,
-138414208, 4198562240, 138414184, 4187027808, 2166980904, 4291887104, 2818048, 262144,
-0, 138414208, 4198562144, 146802944, 4198562144, 2167013668, 4291690496, 2949120,
-0, 4294787072, 138414336, 4183882016, 138414336, 4198562144, 19235111, 4291887104,
-2686976, 262144, 0, 134219840, 4198562080, 138414336, 4198562080, 19267875,
-4291493888, 2555904, 131072, 0, 109053952, 4198562016, 134220032, 4198562080,
-19333407, 4292804608, 2686976, 4294868992, 65536, 138414368, 4219534144, 140511338,
-4216388416, 2167243052, 4292804608, 2686976, 0, 409600, 136317192, 4223728512,
-138414368, 4219534144, 19497259, 4292673536, 2752512, 0, 393216, 136317216,
-4223728448, 140511520, 4215339776, 2167275818, 4292476928, 2949120, 0, 131072,
-146802944, 4211145440, 146802944, 4209048128, 2167439663, 4292345856, 2768896, 0,
-180224, 135268544, 4209048224, 135268456, 4204853872, 2167570737, 4292231168, 2670592,
-98304, 4294868992, 134744128, 4204329536, 134744128, 4204853864, 2167701811, 4292345856,
-2588672, 4294868992, 98304, 135268544, 4209048176, 134744128, 4204853824, 19792173,
-4292411392, 2555904, 0, 4294443008, 111675400, 4206950976, 117442560, 4211145408,
-2167832885, 4292476928, 2686976, 4294836224, 4294868992, 134744256, 4209048128, 111675400,
-4211145280, 19923247, 4292345856, 2949120, 4294770688, 0, 146802944, 4211145280,
-111675584, 4211145280, 19988780, 4292542464, 3080192, 0, 65536, 136317216,
-4223728384, 111675648, 4211145280, 20054315, 4292149248, 2818048, 0, 4294836224,
-109054208, 4198562016, 111675680, 4223728192, 20119848, 4291624960, 1703936, 4294770688,
-0, 106956416, 4181784800, 104859232, 4181784800, 2167963959, 4291624960, 1638400,
-4294770688, 0, 104859264, 4181784800, 102762048, 4181784800, 2167996725, 4291624960,
-1507328, 4294836224, 4294836224, 96470528, 4181784800, 93849088, 4181784832, 2168226107,
-4291624960, 1507328, 4294770688, 0, 100664864, 4181784800, 93849088, 4181784800,
-20414778, 4291624960, 1572864, 4294770688, 0, 102762112, 4181784800, 93849120,
-4181784800, 20447542, 4292149248, 1572864, 4294705152, 0, 102762112, 4198562240,
-93849120, 4198562240, 2168357181, 4291690496, 1425408, 4294901760, 4294836224, 93849088,
-4183882048, 93849048, 4189124928, 2168488255, 4291854336, 1425408, 0, 4294836224,
-93849088, 4189124928, 93849048, 4190173616, 2168521019, 4291887104, 1572864, 0,
-196608, 93849216, 4198562240, 93849088, 4190173504, 20709690, 4291624960, 1572864,
-0, 4294901760, 93849216, 4181784800, 93849216, 4198562112, 20775225, 4291624960,
-458752, 0, 131072, 62915648, 4190173504, 67109952, 4181784832, 2168750403,
-4291756032, 327680, 4294836224, 131072, 62915648, 4190173440, 62915648, 4185979088,
-2168783167, 4291887104, 514048, 4294705152, 73728, 68879424, 4190173504, 62915648,
-4190173392, 21004610, 4291805184, 1114112, 81920, 131072, 72353152, 4190173442,
-72353088, 4187551968, 2168947014, 4291624960, 622592, 4294770688, 0, 72353152,
-4190173408, 71304272, 4181784896, 2168979778, 4291428352, 589824, 196608, 0,
-62915648, 4190173392, 71304576, 4190173408, 21168449, 4292149248, 851968, 0,
-393216, 79693184, 4215339584, 79693184, 4198562240, 2169143625, 4292476928, 458752,
-4294574080, 0, 67109984, 4209048000, 67109888, 4209048096, 2169274699, 4292476928,
-655360, 0, 4294770688, 67109984, 4209048000, 62915680, 4215339744, 2169307462,
-4291887104, 655360, 589824, 0, 62915680, 4215339456, 73401536, 4215339456,
-2169372999, 4292673536, 851968, 4294443008, 0, 79693184, 4215339456, 62915776,
-4215339456, 21496133, 4292083712, 458752, 4294770688, 55296, 62915968, 4215339456,
-67109915, 4196465088, 2169438537, 4291887104, 1245184, 0, 4294377472, 62915968,
-4190173392, 62915968, 4215339456, 21627204, 4291887104, 1245184, 262144, 0,
-62915968, 4215339216, 92276120, 4198562240, 2169504075, 4291854336, 1294336, 4294737920,
-0, 93849216, 4198562016, 62915992, 4215339216, 21758270, 4292149248, 1769472,
-4294705152, 0, 109054240, 4223727840, 62916224, 4215339216, 21823796, 4292280320,
-4293394432, 4294443008, 0, 2097280, 4206950784, 4290773024, 4206951040, 2169733458,
-4292804608, 4293394432, 0, 196608, 1179776, 4223728512, 4290773024, 4219534016,
-2169864532, 4292411392, 4293591040, 0, 4294770688, 4290773120, 4206950784, 4290773120,
-4223728320, 22020431, 4291952640, 4293722112, 0, 4294836224, 8388896, 4192270720,
-12583200, 4202756576, 2169995606, 4292542464, 4293656576, 0, 229376, 10486048,
-4223728384, 17826064, 4211145344, 2170126680, 4292280320, 4293885952, 0, 4294803456,
-8388896, 4202756480, 10486048, 4223728256, 22217042, 4292804608, 4293591040, 131072,
-0, 4290773120, 4223728000, 8388896, 4223728000, 22282577, 4292509696, 4293197824,
-425984, 241664, 4290773046, 4223728368, 4290773280, 4223728000, 22380881, 4292280320,
-4293148672, 229376, 0, 4282449832, 4219796096, 4289265600, 4223728368, 2170323291,
-4292280320, 4292935680, 0, 212992, 4282449856, 4223728256, 4282449856, 4181784768,
-2170356055, 4292280320, 4292935680, 655360, 262144, 4282449856, 4223728256, 4282449856,
-4223727808, 22577498, 4292509696, 4293197824, 4294737920, 0, 4290773280, 4223728000,
-4282449856, 4223727808, 22610262, 4291362816, 4292804608, 262144, 131072, 4274061120,
-4201183424, 4278255424, 4181784768, 2170519902, 4292280320, 4292673536, 0, 262144,
-4274061120, 4206951040, 4274061120, 4202756712, 2170650976, 4292231168, 4292935680, 0,
-4294705152, 4274061120, 4201183424, 4274061120, 4206951016, 22806875, 4291756032, 4292083712,
-655360, 0, 4244700576, 4206950720, 4255186368, 4185979264, 2170782050, 4291493888,
-4292149248, 131072, 4294705152, 4248894912, 4181784768, 4248894912, 4181784832, 2170913124,
-4291624960, 4291756032, 0, 131072, 4244700608, 4206950720, 4248894912, 4181784768,
-23003486, 4291756032, 4292280320, 0, 4294836224, 4257283712, 4185979136, 4261478016,
-4190173568, 2171109735, 4291887104, 4292542464, 0, 131072, 4261478080, 4198562240,
-4257283712, 4190173440, 23167334, 4291362816, 4292149248, 131072, 0, 4244700608,
-4206950592, 4257283776, 4198562048, 23200096, 4292149248, 4291756032, 4294443008, 0,
-4244700864, 4206950592, 4236311808, 4206950976, 2171142499, 4291887104, 4292673536, 4294443008,
-0, 4274061120, 4206950592, 4236312256, 4206950592, 23331165, 4292935680, 4291624960,
-4294836224, 0, 4240506112, 4223728320, 4236311744, 4219534016, 2171371883, 4292411392,
-4291756032, 262144, 0, 4236311808, 4223728320, 4244700632, 4223728448, 2171404646,
-4292673536, 4292198400, 4294705152, 0, 4258856512, 4223728320, 4236312024, 4223728320,
-23560554, 4292673536, 4292460544, 4294705152, 0, 4267245376, 4215339712, 4265672280,
-4215339712, 2171568494, 4292673536, 4292411392, 262144, 0, 4236312128, 4223728320,
-4265672512, 4215339712, 23658856, 4292411392, 4292083712, 0, 4294639616, 4236312384,
-4206950592, 4236312384, 4223728320, 23724389, 4292935680, 4292935680, 4294705152, 0,
-4282384672, 4223727808, 4236312384, 4223727808, 23789914, 4291821568, 4294115328, 0,
-327680, 25166368, 4192270752, 25166368, 4188076352, 2171699568, 4292001792, 4294443008,
-737280, 0, 25166368, 4223728096, 35652224, 4223728480, 2171896179, 4292149248,
-4294082560, 524288, 0, 18874736, 4215339584, 25166464, 4223728096, 24019314,
-4291952640, 4294443008, 0, 4294639616, 25166368, 4192270656, 18875008, 4223728096,
-24052077, 4291461120, 4294197248, 262144, 262144, 25166376, 4186503408, 27787824,
-4184930496, 2172027253, 4291362816, 4294606848, 327680, 0, 37749360, 4183881920,
-40895136, 4183881920, 2172223864, 4291362816, 4294508544, 327680, 0, 33555008,
-4183881920, 37749408, 4183881920, 24281463, 4291362816, 4294377472, 327680, 98304,
-25166384, 4186503360, 33555104, 4183881920, 24314225, 4291624960, 4294115328, 147456,
-327680, 18875008, 4223727936, 25166496, 4186503360, 24379760, 4291362816, 4294901760,
-327680, 0, 47186688, 4183881920, 50332464, 4183881920, 2172420475, 4291362816,
-4294803456, 327680, 0, 44040912, 4183881920, 47186736, 4183881920, 24543610,
-4291362816, 131072, 327680, 0, 53478240, 4183881920, 56624016, 4183881920,
-2172551549, 4291362816, 229376, 327680, 0, 53478288, 4183881920, 59769792,
-4183881920, 2172584312, 4291362816, 32768, 327680, 0, 44041008, 4183881920,
-53478336, 4183881920, 24707447, 4291919872, 262144, 753664, 0, 51774368,
-4215339472, 60818368, 4215339392, 2172813697, 4291756032, 327680, 163840, 4294901760,
-48235456, 4213832064, 51774400, 4215339392, 24871296, 4291690496, 327680, 0,
-4294868992, 44041152, 4183881920, 48235456, 4215339392, 24904058, 4291362816, 4294705152,
-327680, 0, 18875040, 4223727808, 44041152, 4215339200, 24969589, 4291756032,
-4293918720, 393216, 0, 4236247328, 4223727808, 18875328, 4223727808, 25035116,
-4291723264, 327680, 4294934528, 0, 62916896, 4223727824, 4236248000, 4223727808,
-25100622, 4290314240, 4294180864, 262144, 0, 25166240, 4148229824, 27263424,
-4148229824, 2172944771, 4290314240, 4294311936, 262144, 0, 29360608, 4148229824,
-31457920, 4148229824, 2173075845, 4290314240, 4294246400, 262144, 0, 25166272,
-4148229824, 29360768, 4148229824, 25297281, 4290625536, 4294377472, 4294918144, 0,
-33555072, 4167104320, 29360640, 4167104344, 2173206919, 4290576384, 4294377472, 0,
-4294901760, 25166464, 4148229824, 29360768, 4167104320, 25428355, 4290592768, 589824,
-0, 4294639616, 42992704, 4148753938, 60818496, 4149802824, 2173403530, 4290625536,
-180224, 0, 81920, 58197056, 4156618584, 42992704, 4149802514, 25592201,
-4291100672, 753664, 4294574080, 0, 76547584, 4165007232, 75498640, 4165007232,
-2173600141, 4290707456, 720896, 393216, 0, 71304320, 4165007232, 75499008,
-4165007232, 25723276, 4290625536, 589824, 0, 131072, 71304320, 4152424280,
-71304336, 4148753920, 2173796752, 4290707456, 753664, 4294852608, 0, 76547513,
-4152423904, 71304336, 4152423936, 25854351, 4290707456, 720896, 0, 32768,
-71304704, 4165007232, 71304633, 4152423904, 25887113, 4290592768, 589824, 32768,
-0, 42992704, 4156618258, 71304704, 4165006816, 25952647, 4289855488, 1048576,
-1245184, 458752, 42993152, 4165006816, 85984768, 4165006788, 2173829517, 4290150400,
-4294672384, 4294672384, 1343488, 42993152, 4165006788, 42993058, 4134597952, 2173895054,
-4291100672, 720896, 65536, 0, 75498624, 4167104576, 76547584, 4169201728,
-2174058900, 4291100672, 753664, 0, 4294934528, 42993152, 4165006656, 75499008,
-4169201728, 26214799, 4290953216, 180224, 0, 98304, 58196904, 4162910200,
-58196904, 4160288712, 2174386585, 4290854912, 180224, 98304, 0, 54526840,
-4162910152, 58196904, 4162910152, 26378648, 4290854912, 278528, 0, 4294868992,
-54526888, 4157142944, 54526888, 4162910152, 26444183, 4290953216, 278528, 4294868992,
-0, 61342688, 4162910112, 54526888, 4162910112, 26509718, 4290772992, 131072,
-0, 196608, 54526944, 4162910112, 56624064, 4154521504, 2174419349, 4290969600,
-65536, 4294836224, 0, 54526944, 4162910112, 54526784, 4160812992, 2174484886,
-4291035136, 131072, 4294901760, 4294901760, 54526944, 4162910112, 54526816, 4162910208,
-2174550423, 4290969600, 393216, 65536, 4294901760, 54526944, 4162910112, 62915552,
-4162910208, 2174615960, 4290838528, 393216, 131072, 0, 54526944, 4162910112,
-65012704, 4160812992, 2174681497, 4291035136, 327680, 0, 4294770688, 54526944,
-4162910112, 44041344, 4167104544, 2174747034, 4290838528, 65536, 4294901760, 65536,
-44041344, 4167104416, 41943928, 4167104344, 2174812571, 4290592768, 131072, 0,
-4294705152, 42992488, 4148754032, 48235360, 4149802824, 2174976418, 4290625536, 4294639616,
-0, 196608, 41944192, 4167104344, 42992488, 4149802608, 27066780, 4291198976,
-458752, 0, 212992, 67110016, 4173396080, 67109992, 4168153184, 2175107492,
-4291362816, 327680, 4294836224, 0, 62915584, 4173396096, 59769792, 4173396096,
-2175238566, 4291231744, 458752, 4294934528, 0, 67110016, 4173396064, 59769856,
-4173396096, 27263391, 4291166208, 720896, 0, 4294918144, 41944192, 4167104112,
-59769984, 4173396064, 27328926, 4290838528, 393216, 4294901760, 4294901760, 42993152,
-4169200960, 41944192, 4173395568, 27394449, 4290576384, 4294639616, 49152, 0,
-25166464, 4167104192, 41944576, 4173395264, 27459973, 4290641920, 4293459968, 4294770688,
-0, 4194496, 4152424192, 4290773056, 4150326976, 2175369640, 4291362816, 4292804608,
-4294836224, 262144, 4278255552, 4173396096, 4278255488, 4173395840, 2175500714, 4290838528,
-4293722112, 0, 4294705152, 4194496, 4156618656, 4194496, 4165007296, 2175697325,
-4290772992, 4293722112, 0, 4294705152, 4194496, 4154521472, 4194496, 4165007264,
-27754924, 4291231744, 4293197824, 131072, 0, 4278255552, 4173395840, 4194496,
-4165007232, 27787686, 4290707456, 4293722112, 0, 4294705152, 4290773184, 4152424128,
-4278190272, 4173395840, 27853221, 4290969600, 4292804608, 0, 4294836224, 4265672576,
-4160812928, 4265672384, 4165007360, 2175828399, 4290969600, 4292411392, 0, 4294836224,
-4248895040, 4160812928, 4248894976, 4169201664, 2175959473, 4291231744, 4292280320, 0,
-4294836224, 4248895040, 4169201536, 4248894912, 4173396096, 2175992236, 4291100672, 4292411392,
-4294836224, 0, 4265672576, 4165007232, 4248895040, 4173395840, 28115371, 4290576384,
-4292673536, 131072, 0, 4265672384, 4152424128, 4273995840, 4148229824, 2176156084,
-4290707456, 4292673536, 0, 393216, 4248895360, 4173395840, 4265607232, 4152424128,
-28246446, 4290576384, 4293197824, 4294705152, 262144, 4278190272, 4173395648, 4248830016,
-4173395648, 28311978, 4290838528, 4293787648, 262144, 0, 12583136, 4165007296,
-14680320, 4165007296, 2176287158, 4291166208, 4293853184, 0, 262144, 16777600,
-4173396064, 16777600, 4167104576, 2176483769, 4291100672, 4294115328, 0, 4294705152,
-16777600, 4165007296, 16777600, 4173396032, 28541368, 4290838528, 4293853184, 262144,
-0, 12583168, 4165007296, 16777600, 4173395904, 28574130, 4290707456, 4293853184,
-0, 262144, 16777600, 4154521472, 16777600, 4152424288, 2176680380, 4290772992,
-4293853184, 0, 262144, 16777600, 4156618656, 16777600, 4154521440, 28737979,
-4290576384, 4293853184, 0, 262144, 16777600, 4150327104, 16777600, 4148229824,
-2176811454, 4290641920, 4293853184, 0, 262144, 16777600, 4156618592, 16777600,
-4150326976, 28836279, 4290838528, 4293787648, 0, 65536, 12583296, 4173395904,
-16777600, 4156618432, 28901813, 4290707456, 4293722112, 65536, 0, 4248830144,
-4173395648, 12583296, 4173395648, 28967345, 4290576384, 4294115328, 4294705152, 0,
-25167360, 4173395264, 4248830336, 4173395648, 29032868, 4291362816, 229376, 0,
-98304, 4236249376, 4223727808, 4248831488, 4173395264, 29098368, 4292935680, 4293656576,
-0, 262144, 4219472576, 167836608, 4236249376, 4223726912, 29163800};
-
-void loadMap_e1m1_WAD(WAD::LevelData& dstLevel) {
-	// Load vertex data
-	dstLevel.vertices = (const WAD::Vertex*)e1m1_WADVertices;
-
-	// Load line defs
-	dstLevel.lineDefs = (const WAD::LineDef*)e1m1_WADLineDefs;
-
-	// Load side defs
-	dstLevel.sideDefs = (const WAD::SideDef*)e1m1_WADSideDefs;
-
-	// Load subsectors defs
-	dstLevel.subSectors = (const WAD::SubSector*)e1m1_WADSubSectors;
-
-	// Load segments defs
-	dstLevel.segments = (const WAD::Seg*)e1m1_WADSegments;
-
-	// Load sectors defs
-	dstLevel.sectors = (const WAD::Sector*)e1m1_WADSectors;
-
-	// Load nodes
-	dstLevel.numNodes = (e1m1_WADNodesSize * 4) / sizeof(WAD::Node);
-	dstLevel.nodes = (const WAD::Node*)e1m1_WADNodes;
-}
@@ -1,28 +1,31 @@
 #pragma once
 #include <cstdint>
-#include <base.h>
+#include <assetArchive.h>
 #include <WAD.h>
 
-constexpr uint32_t e1m1_WADVerticesSize = 1884;
-extern const uint32_t e1m1_WADVertices[];
-
-constexpr uint32_t e1m1_WADLineDefsSize = 3616;
-extern const uint32_t e1m1_WADLineDefs[];
-
-constexpr uint32_t e1m1_WADSideDefsSize = 9923;
-extern const uint32_t e1m1_WADSideDefs[];
-
-constexpr uint32_t e1m1_WADSegmentsSize = 4389;
-extern const uint32_t e1m1_WADSegments[];
-
-constexpr uint32_t e1m1_WADSubSectorsSize = 448;
-extern const uint32_t e1m1_WADSubSectors[];
-
-constexpr uint32_t e1m1_WADSectorsSize = 1300;
-extern const uint32_t e1m1_WADSectors[];
-
-constexpr uint32_t e1m1_WADNodesSize = 4023;
-extern const uint32_t e1m1_WADNodes[];
-
-void loadMap_e1m1_WAD(WAD::LevelData& dstLevel);
-
+// Linked in from e1m1.wad.s on GBA. Other platforms should map e1m1.wad.bin instead.
+extern "C" const uint32_t e1m1_WADArchive[];
+
+// Space needed in work RAM for the compressed lumps
+constexpr uint32_t e1m1_WADUnpackedSize = 0;
+
+inline bool loadMap_e1m1_WAD(const assets::Archive& archive, WAD::LevelData& dstLevel, uint8_t* unpackBuffer = nullptr)
+{
+	dstLevel.vertices = archive.load<WAD::PackedVertex>("e1m1_WADVertices", unpackBuffer);
+	dstLevel.lineDefs = archive.load<WAD::LineDef>("e1m1_WADLineDefs", dstLevel.numLineDefs, unpackBuffer);
+	dstLevel.sideDefs = archive.load<WAD::SideDef>("e1m1_WADSideDefs", unpackBuffer);
+	dstLevel.subSectors = archive.load<WAD::SubSector>("e1m1_WADSubSectors", unpackBuffer);
+	dstLevel.segments = archive.load<WAD::Seg>("e1m1_WADSegments", unpackBuffer);
+	dstLevel.sectors = archive.load<WAD::Sector>("e1m1_WADSectors", unpackBuffer);
+	dstLevel.nodes = archive.load<WAD::Node>("e1m1_WADNodes", dstLevel.numNodes, unpackBuffer);
+	dstLevel.segLights = archive.load<uint8_t>("e1m1_WADSegLights", unpackBuffer);
+	dstLevel.segVertices = archive.load<uint16_t>("e1m1_WADSegVertices", unpackBuffer);
+	dstLevel.segFrontSectors = archive.load<uint8_t>("e1m1_WADSegFrontSectors", unpackBuffer);
+	dstLevel.segBackSectors = archive.load<uint8_t>("e1m1_WADSegBackSectors", unpackBuffer);
+	dstLevel.segFlags = archive.load<uint8_t>("e1m1_WADSegFlags", unpackBuffer);
+	dstLevel.blockMap = archive.load<uint16_t>("e1m1_WADBlockMap", unpackBuffer);
+	return dstLevel.vertices && dstLevel.lineDefs && dstLevel.sideDefs && dstLevel.subSectors
+		&& dstLevel.segments && dstLevel.sectors && dstLevel.nodes
+		&& dstLevel.segVertices && dstLevel.segFrontSectors && dstLevel.segBackSectors && dstLevel.segFlags
+		&& dstLevel.segLights && dstLevel.blockMap;
+}
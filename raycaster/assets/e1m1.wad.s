@@ -0,0 +1,5 @@
+	.section .rodata
+	.align 2
+	.global e1m1_WADArchive
+e1m1_WADArchive:
+	.incbin "e1m1.wad.bin"
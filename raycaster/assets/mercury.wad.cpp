@@ -1,1963 +0,0 @@
-#include "C:\repos\GBA\raycaster\assets\mercury.wad.h"
-
-extern const uint32_t mercury_WADVertices[1040] = {
-4294770688, 262144, 4294639616, 262144, 4294377472, 393216, 4294639616, 393216,
-4294508544, 524288, 4294508544, 655360, 4293591040, 917504, 4293328896, 1572864,
-4294770688, 4294443008, 196608, 4294443008, 196608, 262144, 327680, 262144,
-4294770688, 524288, 196608, 524288, 327680, 655360, 196608, 2097152,
-4294246400, 917504, 4294639616, 655360, 851968, 786432, 4294508544, 917504,
-458752, 655360, 458752, 524288, 327680, 393216, 589824, 393216,
-589824, 262144, 4294770688, 917504, 720896, 1703936, 458752, 1966080,
-458752, 2097152, 589824, 2097152, 65536, 1048576, 65536, 1310720,
-196608, 1310720, 196608, 1441792, 65536, 1703936, 4294770688, 1703936,
-4294770688, 1572864, 4294508544, 1572864, 4294639616, 1703936, 1376256, 2883584,
-458752, 1048576, 458752, 1441792, 4294901760, 917504, 458752, 1572864,
-327680, 1703936, 4294639616, 1835008, 4294901760, 1835008, 4294508544, 2097152,
-196608, 3538944, 4294377472, 2097152, 589824, 3538944, 4294901760, 2097152,
-196608, 1835008, 327680, 2359296, 327680, 2228224, 458752, 2228224,
-458752, 2359296, 327680, 3407872, 327680, 3276800, 458752, 3276800,
-458752, 3407872, 4294639616, 3407872, 4294508544, 3407872, 4294508544, 3276800,
-4294639616, 3276800, 4294639616, 2359296, 4294508544, 2359296, 4294508544, 2228224,
-4294639616, 2228224, 4294508544, 2883584, 4294508544, 2752512, 4294639616, 2752512,
-4294639616, 2883584, 327680, 2883584, 327680, 2752512, 458752, 2752512,
-458752, 2883584, 4291887104, 4849664, 4294901760, 3538944, 65536, 3538944,
-4291624960, 4980736, 4294770688, 3538944, 4294377472, 3538944, 4294377472, 262144,
-4293591040, 2883584, 65536, 917504, 196608, 917504, 458752, 917504,
-4294508544, 1048576, 4294639616, 1048576, 4294639616, 1179648, 4294901760, 1179648,
-4294901760, 1572864, 196608, 1572864, 4293984256, 5242880, 4293722112, 5242880,
-4294639616, 4325376, 4294246400, 4325376, 4293984256, 4980736, 4293853184, 4980736,
-4293853184, 4718592, 4291624960, 4718592, 4294246400, 4980736, 4294115328, 4980736,
-4294377472, 5242880, 4294508544, 5242880, 4294115328, 5242880, 4293591040, 6422528,
-4293591040, 6553600, 4294639616, 5242880, 4294639616, 5111808, 4294508544, 6553600,
-720896, 6029312, 4294377472, 5111808, 4294508544, 6029312, 4294770688, 5505024,
-4294377472, 5505024, 4294508544, 5505024, 4294770688, 6160384, 196608, 6160384,
-196608, 5505024, 458752, 6029312, 458752, 5505024, 589824, 5505024,
-458752, 6553600, 1900544, 6553600, 4294901760, 6553600, 4293722112, 8519680,
-4293984256, 8519680, 65536, 6553600, 4293459968, 8519680, 4294246400, 8519680,
-4294901760, 6815744, 65536, 6815744, 589824, 6291456, 589824, 6160384,
-720896, 6160384, 720896, 6291456, 4294246400, 6029312, 4294246400, 5505024,
-4291887104, 5242880, 4293853184, 5505024, 4293459968, 6291456, 4293459968, 6160384,
-4293591040, 6160384, 4293591040, 6291456, 4293853184, 6029312, 4293328896, 6029312,
-4294246400, 8781824, 4293328896, 6553600, 4294508544, 8912896, 4293459968, 6553600,
-4293328896, 6422528, 4293328896, 6815744, 4294508544, 8781824, 4293459968, 6815744,
-4293591040, 6815744, 4293984256, 7340032, 4293984256, 7208960, 4294115328, 7208960,
-4294115328, 7340032, 4293722112, 5505024, 4293591040, 5505024, 4292018176, 5242880,
-4292018176, 5308416, 4293853184, 6815744, 4293459968, 5505024, 4291493888, 5242880,
-4292542464, 5373952, 4292411392, 5308416, 4292411392, 5242880, 4292542464, 5242880,
-4293328896, 5505024, 4291493888, 4980736, 327680, 7340032, 4293459968, 9961472,
-4294639616, 7340032, 4294639616, 6815744, 4293722112, 9568256, 4294770688, 9961472,
-327680, 6815744, 4293328896, 8519680, 4293328896, 7340032, 4293853184, 7340032,
-4294639616, 3801088, 327680, 3801088, 4294901760, 3801088, 65536, 3801088,
-327680, 4325376, 720896, 4325376, 720896, 4980736, 851968, 4980736,
-851968, 5242880, 327680, 5242880, 589824, 5242880, 458752, 5242880,
-327680, 5111808, 589824, 5111808, 589824, 4456448, 4294377472, 4456448,
-4294770688, 5111808, 4294770688, 5242880, 196608, 5242880, 196608, 5111808,
-4292411392, 6029312, 4292411392, 6160384, 4292280320, 6160384, 4292280320, 6029312,
-4294901760, 7471104, 65536, 7471104, 65536, 7602176, 4294901760, 7602176,
-4294639616, 7733248, 327680, 7733248, 327680, 8388608, 4294639616, 8388608,
-4294901760, 8781824, 65536, 8781824, 65536, 8912896, 4294901760, 8912896,
-4294770688, 8912896, 4294770688, 8781824, 4294639616, 8781824, 4294639616, 8912896,
-4294639616, 9043968, 4294770688, 9043968, 4294770688, 9175040, 4294639616, 9175040,
-4294770688, 9306112, 4294508544, 9306112, 65536, 9306112, 65536, 9961472,
-1769472, 9961472, 4293984256, 8912896, 4293591040, 8388608, 4293459968, 8388608,
-4293459968, 8257536, 4293591040, 8257536, 720896, 7340032, 851968, 7340032,
-851968, 7208960, 720896, 7208960, 1507328, 7340032, 1638400, 7340032,
-1638400, 7208960, 1507328, 7208960, 1638400, 6291456, 1769472, 6291456,
-1769472, 6160384, 1638400, 6160384, 1900544, 6029312, 1376256, 6029312,
-1900544, 5505024, 1376256, 5505024, 1638400, 5505024, 1507328, 5242880,
-1376256, 4849664, 1769472, 5505024, 720896, 5505024, 1769472, 6815744,
-4293591040, 5242880, 4293459968, 5242880, 4293591040, 4849664, 4293459968, 5308416,
-4293066752, 5308416, 4293066752, 5242880, 4292935680, 5242880, 4292935680, 5373952,
-2949120, 4294049792, 4292673536, 5505024, 4292804608, 5373952, 2818048, 4293918720,
-4292804608, 5505024, 4292673536, 5373952, 4292935680, 5505024, 4292935680, 6684672,
-4291624960, 6291456, 4291756032, 6684672, 4291887104, 6684672, 4291231744, 5505024,
-4291231744, 6684672, 4291624960, 6684672, 4292542464, 6684672, 4292542464, 5898240,
-4291231744, 5898240, 4291756032, 6553600, 4291887104, 6553600, 4291231744, 6291456,
-4292673536, 6684672, 4292673536, 6946816, 4292804608, 6946816, 4292804608, 6684672,
-4294770688, 7864320, 196608, 7864320, 196608, 8257536, 4294770688, 8257536,
-4294901760, 7864320, 4294901760, 8192000, 65536, 8192000, 65536, 7864320,
-196608, 9699328, 196608, 9568256, 327680, 9568256, 327680, 9699328,
-458752, 9699328, 458752, 9568256, 589824, 9568256, 589824, 9699328,
-1507328, 9961472, 1507328, 9830400, 1769472, 9830400, 1245184, 9961472,
-1245184, 9830400, 1376256, 9830400, 1376256, 9961472, 458752, 9175040,
-458752, 9043968, 589824, 9043968, 589824, 9175040, 720896, 9175040,
-720896, 9043968, 851968, 9043968, 851968, 9175040, 720896, 8912896,
-720896, 8781824, 851968, 8781824, 851968, 8912896, 983040, 8912896,
-983040, 8781824, 1114112, 8781824, 1114112, 8912896, 1245184, 9175040,
-1245184, 9043968, 1376256, 9043968, 1376256, 9175040, 1245184, 9306112,
-1376256, 9306112, 1376256, 9437184, 1245184, 9437184, 983040, 8388608,
-1114112, 8388608, 1114112, 8257536, 983040, 8257536, 983040, 8126464,
-983040, 7995392, 1114112, 7995392, 1114112, 8126464, 1245184, 8126464,
-1245184, 7995392, 1376256, 7995392, 1376256, 8126464, 1507328, 8388608,
-1507328, 8257536, 1638400, 8257536, 1638400, 8388608, 4294770688, 9568256,
-4294639616, 4294705152, 4294639616, 4294836224, 4294508544, 4294836224, 4294508544, 4294705152,
-327680, 4294836224, 327680, 4294705152, 458752, 4294705152, 458752, 4294836224,
-4294770688, 2097152, 4294770688, 1966080, 4292935680, 1966080, 4294508544, 1966080,
-4294246400, 1703936, 720896, 917504, 4294115328, 786432, 4294115328, 262144,
-4293722112, 262144, 4293722112, 786432, 1376256, 917504, 4293328896, 917504,
-65536, 2097152, 65536, 1835008, 327680, 1835008, 851968, 262144,
-1245184, 262144, 1245184, 786432, 1638400, 917504, 1638400, 1572864,
-2031616, 1966080, 2031616, 2883584, 2949120, 1966080, 4292935680, 2883584,
-4292018176, 1966080, 4292018176, 4294049792, 4292149248, 4293918720, 4292542464, 5308416,
-4292935680, 5308416, 4294574080, 2097152, 4294574080, 1966080, 4294639616, 2097152,
-4294639616, 1966080, 4294705152, 2097152, 4294705152, 1966080, 4294443008, 393216,
-4294443008, 262144, 4294508544, 393216, 4294508544, 262144, 4294574080, 393216,
-4294574080, 262144, 393216, 393216, 393216, 262144, 458752, 393216,
-458752, 262144, 524288, 393216, 524288, 262144, 1507328, 5373952,
-1900544, 5373952, 1638400, 5373952, 1769472, 5373952, 1900544, 5242880,
-2031616, 5242880, 2031616, 5308416, 2424832, 5308416, 2424832, 5242880,
-2555904, 5242880, 2555904, 5373952, 2949120, 5373952, 2949120, 5242880,
-3080192, 4849664, 3080192, 5242880, 3473408, 5242880, 1376256, 5242880,
-983040, 5242880, 983040, 4980736, 1114112, 4980736, 1114112, 4718592,
-3342336, 4718592, 3342336, 4980736, 3473408, 4980736, 4294901760, 4980736,
-4294901760, 4849664, 65536, 4849664, 65536, 4980736, 4291887104, 5898240,
-4292542464, 6160384, 4292411392, 5898240, 458752, 6160384, 4294770688, 6553600,
-4294508544, 6422528, 4293459968, 6422528, 4293328896, 6160384, 4293591040, 6029312,
-589824, 6553600, 720896, 6553600, 1769472, 6029312, 1900544, 6291456,
-4293984256, 6815744, 4294639616, 7208960, 327680, 7208960, 851968, 6815744,
-1638400, 6815744, 1769472, 7340032, 4293591040, 7340032, 4293459968, 7340032,
-4293328896, 8388608, 327680, 7864320, 4294639616, 7864320, 196608, 8388608,
-4294639616, 8257536, 196608, 9961472, 458752, 9961472, 4293722112, 9961472,
-4294246400, 8912896, 4294508544, 9043968, 4294508544, 9175040, 1638400, 9830400,
-1769472, 8257536, 4294377472, 917504, 4294115328, 917504, 4293722112, 917504,
-4292018176, 262144, 4292018176, 917504, 458752, 4293918720, 4294770688, 4293918720,
-4294639616, 4293918720, 4294508544, 4293918720, 4294770688, 4294836224, 589824, 917504,
-851968, 917504, 1245184, 917504, 2949120, 917504, 2949120, 262144,
-4294639616, 1572864, 4293459968, 917504, 4294377472, 3276800, 4294377472, 3407872,
-4294639616, 3538944, 4294377472, 2752512, 65536, 1572864, 4294705152, 1835008,
-4294770688, 1835008, 196608, 1703936, 1507328, 917504, 327680, 3538944,
-458752, 3538944, 196608, 3276800, 196608, 2752512, 327680, 2097152,
-4291887104, 4718592, 4291624960, 5242880, 4293591040, 4718592, 4293591040, 4980736,
-589824, 4980736, 4294377472, 4980736, 589824, 4849664, 4294901760, 4456448,
-4294246400, 4456448, 589824, 4325376, 4294115328, 5111808, 720896, 5242880,
-3080192, 4718592, 1376256, 4718592, 3342336, 5242880, 1376256, 4980736};
-extern const uint32_t mercury_WADLineDefs[1782] = {
-589834, 4, 0, 524289, 262144, 0, 196610, 26869784,
-4, 262144, 1441797, 262549, 0, 458758, 2687009, 4,
-524288, 1507337, 262168, 0, 720906, 1769500, 4, 786432,
-13, 262145, 0, 983054, 26476545, 4, 1048576, 720913,
-262154, 0, 1245202, 1441803, 4, 1310720, 3145749, 65586,
-0, 4294901782, 65539, 4, 1507328, 589848, 262152, 0,
-1703961, 786445, 4, 1769472, 917532, 262157, 0, 1966109,
-917589, 4, 2031616, 3276832, 65565, 0, 4294901793, 2752529,
-4, 2228224, 786467, 262161, 0, 2424868, 2162720, 4,
-2490368, 2031655, 262176, 0, 2687016, 2031646, 4, 2752512,
-2621483, 262174, 0, 2949164, 5701672, 4, 3014656, 2687023,
-262184, 0, 3211312, 1703963, 4, 3276800, 1703987, 262513,
-0, 3473460, 1573243, 4, 3538944, 196663, 262166, 0,
-3735608, 1441813, 4, 3801088, 1048635, 262163, 0, 3997756,
-2752537, 4, 4063232, 1638463, 262163, 0, 4259904, 1310806,
-4, 4325376, 1310787, 262165, 0, 4522052, 131155, 4,
-4587520, 5767239, 262181, 0, 4784200, 24707106, 4, 4849664,
-2293835, 262178, 0, 5046348, 2293796, 4, 5111808, 2424911,
-262180, 0, 5308496, 24641551, 4, 5373952, 2752595, 262229,
-0, 5570644, 1638405, 4, 5636096, 262231, 262149, 0,
-5832792, 262147, 4, 5898240, 131163, 262543, 0, 6094940,
-3014701, 4, 6160384, 2490463, 262189, 0, 6357088, 2490405,
-4, 6422528, 3014755, 262195, 0, 6619236, 5308780, 4,
-6684672, 2818151, 262185, 0, 6881384, 24707118, 4, 6946816,
-3342443, 262508, 0, 7143532, 24641587, 4, 7208960, 2883695,
-262187, 0, 7405680, 983088, 4, 7471104, 5308531, 65614,
-0, 4294901876, 3473462, 4, 7667712, 3604598, 262198, 0,
-7864439, 3604536, 4, 7929856, 3473530, 262200, 0, 8126587,
-3735610, 4, 8192000, 3866750, 262202, 0, 8388735, 3866684,
-4, 8454144, 3735682, 262204, 0, 8650883, 3997758, 4,
-8716288, 4128902, 262206, 0, 8913031, 4128832, 4, 8978432,
-3997834, 262208, 0, 9175179, 4259906, 4, 9240576, 4391054,
-262210, 0, 9437327, 4390980, 4, 9502720, 4259986, 262212,
-0, 9699475, 4522054, 4, 9764864, 4653206, 262214, 0,
-9961623, 4653128, 4, 10027008, 4522138, 262216, 0, 10223771,
-4784202, 4, 10289152, 4915358, 262218, 0, 10485919, 4915276,
-4, 10551296, 4784290, 262220, 0, 10748067, 12189774, 1,
-10813440, 5177343, 262223, 0, 10944678, 5177531, 1, 11010048,
-5111807, 262406, 0, 11141289, 3145807, 1, 11206656, 5439487,
-65617, 0, 4294901932, 5374001, 1, 11337728, 23920639, 262541,
-0, 11468974, 1180017, 4, 11534336, 5439665, 262515, 0,
-11731122, 3211311, 4, 11796480, 24051893, 262191, 0, 11993270,
-5636181, 4, 12058624, 1245369, 262232, 0, 12255418, 5767257,
-4, 12320768, 5898429, 262233, 0, 12517566, 5898331, 4,
-12582912, 6029505, 262235, 0, 12779714, 6029405, 4, 12845056,
-3408069, 262237, 0, 13041862, 983068, 4, 13107200, 1179849,
-262523, 0, 13304010, 1835037, 4, 13369344, 9175245, 262221,
-0, 13566158, 13107310, 1, 13631488, 6291455, 262404, 0,
-13762769, 6160479, 1, 13828096, 6225919, 65634, 0, 4294901972,
-6488162, 1, 13959168, 6553599, 65636, 0, 4294901974, 6619236,
-1, 14090240, 6684671, 65616, 0, 4294901976, 6750310, 1,
-14221312, 6422527, 65638, 0, 4294901978, 6357088, 1, 14352384,
-6815743, 65642, 0, 4294901980, 7602280, 1, 14483456, 7143423,
-65647, 0, 4294901982, 6881397, 1, 14614528, 7012351, 65640,
-0, 4294901984, 11337808, 1, 14745600, 8126463, 65730, 0,
-4294901986, 7274610, 4, 14876672, 12779748, 65658, 0, 4294901989,
-6291640, 1, 15073280, 11403263, 65703, 0, 4294901991, 9109620,
-1, 15204352, 7667711, 262261, 0, 15335657, 7667827, 1,
-15400960, 7798783, 65651, 0, 4294901996, 7733367, 1, 15532032,
-7929855, 65655, 0, 4294901998, 7864442, 1, 15663104, 8060927,
-262267, 0, 15794416, 8061186, 1, 15859712, 8257535, 65786,
-0, 4294902003, 8192124, 1, 15990784, 8191999, 262265, 0,
-16122101, 8257647, 1, 16187392, 9109503, 262258, 0, 16318712,
-8650878, 1, 16384000, 8388607, 65664, 0, 4294902011, 8454277,
-1, 16515072, 8323071, 262273, 0, 16646397, 8126593, 1,
-16711680, 8716287, 65713, 0, 4294902016, 8716420, 4, 16842752,
-11796738, 65669, 0, 4294902019, 8585364, 4, 17039360, 8585477,
-262272, 0, 17236230, 8781959, 4, 17301504, 8913161, 262279,
-0, 17498378, 8913033, 4, 17563648, 8782093, 262281, 0,
-17760526, 7012460, 4, 17825792, 9240849, 65697, 0, 4294902034,
-9633964, 1, 18022400, 7077887, 262296, 0, 18153748, 9306255,
-4, 18219008, 9437463, 262287, 0, 18415896, 9437329, 4,
-18481152, 9306395, 262289, 0, 18678044, 9240715, 1, 18743296,
-9175039, 262282, 0, 18874655, 9896085, 1, 18939904, 10027007,
-65685, 0, 4294902050, 10158231, 1, 19070976, 9961471, 262252,
-0, 19202340, 7078044, 1, 19267584, 10092543, 65718, 0,
-4294902055, 10027163, 1, 19398656, 10223615, 262300, 0, 19530025,
-10223781, 1, 19595264, 8388607, 262274, 0, 19726636, 8519861,
-1, 19791872, 10420223, 262301, 0, 19923247, 10354847, 4,
-19988480, 10486066, 262303, 0, 20185395, 10485917, 4, 20250624,
-10551606, 262306, 0, 20447543, 10617092, 1, 20512768, 17235967,
-262404, 0, 20644154, 6226081, 1, 20709376, 10682367, 65702,
-0, 4294902077, 9175207, 1, 20840448, 11206655, 65707, 0,
-4294902079, 11141289, 1, 20971520, 8585215, 65711, 0, 4294902081,
-9961619, 1, 21102592, 9699327, 262290, 0, 21233987, 9240722,
-4, 21299200, 9175366, 65699, 0, 4294902087, 10748067, 1,
-21495808, 15204351, 65847, 0, 4294902089, 8323250, 1, 21626880,
-23330815, 65714, 0, 4294902091, 23265508, 1, 21757952, 11993087,
-65717, 0, 4294902093, 11993270, 4, 21889024, 11993423, 262309,
-0, 22085968, 10813617, 1, 22151168, 11665407, 262320, 0,
-22282579, 11403440, 4, 22347776, 11403606, 262324, 0, 22544727,
-11272358, 1, 22609920, 17039359, 65716, 0, 4294902106, 16974134,
-1, 22740992, 12255231, 65720, 0, 4294902108, 12255418, 4,
-22872064, 12124510, 65723, 0, 4294902111, 12124348, 1, 23068672,
-12451839, 65724, 0, 4294902113, 12386494, 1, 23199744, 12582911,
-65726, 0, 4294902115, 12517568, 1, 23330816, 12779519, 65728,
-0, 4294902117, 12779714, 4, 23461888, 12648807, 65731, 0,
-4294902120, 12648644, 1, 23658496, 12910591, 262341, 0, 23789930,
-12976325, 4, 23855104, 12976493, 262343, 0, 24052078, 7405767,
-4, 24117248, 7405937, 262254, 0, 24314226, 7209069, 1,
-24379392, 6946815, 65645, 0, 4294902133, 6815849, 4, 24510464,
-13107575, 65737, 0, 4294902136, 13238473, 1, 24707072, 13303807,
-65739, 0, 4294902138, 13304008, 4, 24838144, 13304188, 65732,
-0, 4294902141, 13369549, 4, 25034752, 13500799, 262349, 0,
-25231744, 13500623, 4, 25296896, 13369731, 262351, 0, 25493892,
-13631697, 4, 25559040, 13762951, 262353, 0, 25756040, 13762771,
-4, 25821184, 13631883, 262355, 0, 26018188, 13893845, 4,
-26083328, 14025103, 262357, 0, 26280336, 14024919, 4, 26345472,
-13894035, 262359, 0, 26542484, 14155993, 4, 26607616, 14287255,
-262361, 0, 26804632, 14287067, 4, 26869760, 14156187, 262363,
-0, 27066780, 14483676, 4, 27131904, 14483871, 262366, 0,
-27328928, 14614750, 4, 27394048, 14614947, 262364, 0, 27591076,
-14680289, 4, 27656192, 14811559, 262369, 0, 27853224, 14811363,
-4, 27918336, 14680491, 262371, 0, 28115372, 15007894, 1,
-28180480, 15073279, 65764, 0, 4294902191, 14942438, 4, 28311552,
-15139249, 262374, 0, 28508594, 15270016, 1, 28573696, 15335423,
-65686, 0, 4294902197, 15335659, 4, 28704768, 15466935, 262379,
-0, 28901816, 15466733, 4, 28966912, 15335867, 262381, 0,
-29163964, 15663342, 4, 29229056, 15663551, 262384, 0, 29426112,
-15794416, 4, 29491200, 15794627, 262382, 0, 29688260, 15925490,
-4, 29753344, 15925703, 262388, 0, 29950408, 16056564, 4,
-30015488, 16056779, 262386, 0, 30212556, 16187638, 4, 30277632,
-16187855, 262392, 0, 30474704, 16318712, 4, 30539776, 16318931,
-262390, 0, 30736852, 16908400, 4, 30801920, 16515543, 65793,
-0, 4294902232, 16515322, 1, 30998528, 7995391, 262256, 0,
-31130074, 16646557, 1, 31195136, 16777215, 65947, 0, 4294902237,
-16580862, 1, 31326208, 16908287, 65950, 0, 4294902239, 16646401,
-4, 31457280, 16581089, 65794, 0, 4294902242, 16449789, 4,
-31653888, 16450020, 262394, 0, 31850981, 10092694, 4, 31916032,
-10093032, 262292, 0, 32113129, 11731119, 1, 32178176, 17170431,
-65796, 0, 4294902252, 11075748, 1, 32309248, 17301503, 65797,
-0, 4294902254, 17236232, 1, 32440320, 17432575, 65800, 0,
-4294902256, 17367306, 1, 32571392, 17563647, 65928, 0, 4294902258,
-17498382, 1, 32702464, 25100287, 262518, 0, 32834036, 17694992,
-1, 32899072, 18022399, 65808, 0, 4294902263, 17891496, 1,
-33030144, 11272191, 65927, 0, 4294902265, 17629457, 1, 33161216,
-25165823, 262526, 0, 33292795, 17891598, 4, 33357824, 18022910,
-65810, 0, 4294902271, 18874650, 1, 33554432, 18481151, 262420,
-0, 33686017, 18809108, 4, 33751040, 18285060, 65820, 0,
-4294902277, 18284813, 1, 33947648, 17694719, 262416, 0, 34079239,
-18350367, 1, 34144256, 18284543, 65818, 0, 4294902282, 18219285,
-1, 34275328, 18415615, 65817, 0, 4294902284, 18153757, 4,
-34406400, 18743822, 262429, 0, 34603535, 18743574, 4, 34668544,
-18416146, 65813, 0, 4294902291, 18940192, 1, 34865152, 19005439,
-65826, 0, 4294902293, 19071266, 1, 34996224, 18939903, 262435,
-0, 35127831, 18022691, 1, 35192832, 18677759, 65823, 0,
-4294902298, 18546972, 4, 35323904, 18547228, 262426, 0, 35521053,
-19398948, 1, 35586048, 19267583, 65830, 0, 4294902304, 19333414,
-1, 35717120, 19398655, 65828, 0, 4294902306, 19464488, 1,
-35848192, 19529727, 65834, 0, 4294902308, 19595562, 1, 35979264,
-19464191, 262443, 0, 36110886, 19202347, 1, 36175872, 19726335,
-262445, 0, 36307497, 19792173, 4, 36372480, 19792428, 262447,
-0, 36569645, 19661103, 4, 36634624, 19923504, 262449, 0,
-36831793, 20054321, 4, 36896768, 20054580, 262451, 0, 37093941,
-19923251, 4, 37158912, 20185656, 262453, 0, 37356089, 20316469,
-4, 37421056, 15204924, 65846, 0, 4294902333, 15204660, 1,
-37617664, 20447231, 262456, 0, 37749311, 20513080, 4, 37814272,
-20513346, 262458, 0, 38011459, 20578615, 1, 38076416, 20643839,
-65844, 0, 4294902342, 20709691, 4, 38207488, 20709960, 262461,
-0, 38404681, 20840765, 4, 38469632, 20841036, 262459, 0,
-38666829, 20971839, 4, 38731776, 20972112, 262465, 0, 38928977,
-21102913, 4, 38993920, 21103188, 262463, 0, 39191125, 21233987,
-4, 39256064, 21234264, 262469, 0, 39453273, 21365061, 4,
-39518208, 21365340, 262467, 0, 39715421, 21496135, 4, 39780352,
-21496416, 262473, 0, 39977569, 21627209, 4, 40042496, 21627492,
-262471, 0, 40239717, 21758283, 4, 40304640, 21758568, 262477,
-0, 40501865, 21889357, 4, 40566784, 21889644, 262475, 0,
-40764013, 22020431, 4, 40828928, 22020720, 262481, 0, 41026161,
-22151505, 4, 41091072, 22151796, 262479, 0, 41288309, 22282579,
-4, 41353216, 22282872, 262485, 0, 41550457, 22413653, 4,
-41615360, 22413948, 262483, 0, 41812605, 22544727, 4, 41877504,
-22545024, 262489, 0, 42074753, 22675801, 4, 42139648, 22676100,
-262487, 0, 42336901, 22806875, 4, 42401792, 22807176, 262493,
-0, 42599049, 22937949, 4, 42663936, 22938252, 262491, 0,
-42861197, 23069023, 4, 42926080, 23069328, 262497, 0, 43123345,
-23200097, 4, 43188224, 23200404, 262495, 0, 43385493, 11731299,
-4, 43450368, 11731608, 65767, 0, 4294902425, 23331173, 4,
-43646976, 23462555, 262501, 0, 43844252, 23462247, 4, 43909120,
-23331487, 262503, 0, 44106400, 23593321, 4, 44171264, 23724707,
-262505, 0, 44368548, 23724395, 4, 44433408, 23593639, 262507,
-0, 44630696, 23921004, 4, 44695552, 23921323, 262542, 0,
-44892844, 3211348, 1, 44957696, 25427967, 65620, 0, 4294902447,
-24117615, 4, 45088768, 24117937, 262160, 0, 45286066, 1048946,
-4, 45350912, 24314549, 262514, 0, 45548214, 24379763, 4,
-45613056, 24380089, 262517, 0, 45810362, 393589, 4, 45875200,
-5702333, 262230, 0, 46072510, 24182871, 4, 46137344, 23986881,
-262531, 0, 46334658, 24183158, 4, 46399488, 24642245, 262521,
-0, 46596806, 3408249, 4, 46661632, 3408585, 262522, 0,
-46858954, 2883962, 4, 46923776, 24904397, 262523, 0, 47121102,
-24904061, 4, 47185920, 24511185, 262525, 0, 47383250, 23986183,
-4, 47448064, 1049301, 262150, 0, 47645398, 24576006, 4,
-47710208, 24576729, 262151, 0, 47907546, 25231399, 1, 47972352,
-1966079, 65575, 0, 4294902493, 25362820, 1, 48103424, 25559039,
-65924, 0, 4294902495, 25493894, 1, 48234496, 17825791, 65926,
-0, 4294902497, 17760524, 1, 48365568, 25362431, 65804, 0,
-4294902499, 25297281, 1, 48496640, 25296895, 262528, 0, 48628453,
-25100672, 4, 48693248, 25625320, 262536, 0, 48890601, 17432968,
-1, 48955392, 25690111, 65704, 0, 4294902508, 25821577, 4,
-49086464, 25756398, 262191, 0, 49283823, 24052106, 4, 49348608,
-25887474, 262540, 0, 49545971, 25756043, 4, 49610752, 25953014,
-262538, 0, 49808119, 26083725, 4, 49872896, 26018554, 262539,
-0, 50070267, 25952654, 4, 50135040, 26149630, 262544, 0,
-50332415, 5439888, 4, 50397184, 26149634, 262545, 0, 50594563,
-26345873, 4, 50659328, 26346246, 262544, 0, 50856711, 26411409,
-4, 50921472, 26411786, 262548, 0, 51118859, 26345876, 4,
-51183616, 26411790, 262147, 0, 51381007, 26608021, 4, 51445760,
-26608402, 262155, 0, 51643155, 26673557, 4, 51707904, 26673942,
-262552, 0, 51905303, 26608024, 4, 51970048, 26673946, 262553,
-0, 52167451, 26870169, 4, 52232192, 26870558, 262552, 0,
-52429599, 1507737, 4, 52494336, 26936098, 65949, 0, 4294902563,
-27066782, 4, 52690944, 27132709, 65948, 0, 4294902566, 27197852,
-1, 52887552, 27262975, 65952, 0, 4294902568, 27328928, 1,
-53018624, 27394047, 65954, 0, 4294902570, 27460002, 1, 53149696,
-27525119, 65956, 0, 4294902572, 27591076, 1, 53280768, 27656191,
-65958, 0, 4294902574, 27722150, 1, 53411840, 27787263, 65961,
-0, 4294902576, 27984128, 4, 53542912, 27788082, 262400, 0,
-53740339, 27787689, 4, 53805056, 27984694, 65791, 0, 4294902583,
-27984300, 1, 54001664, 28180479, 65964, 0, 4294902585, 28115374,
-1, 54132736, 28311551, 65966, 0, 4294902587, 28246448, 1,
-54263808, 28442623, 65968, 0, 4294902589, 28377522, 1, 54394880,
-27983871, 65970, 0, 4294902591, 27918761, 1, 54525952, 28573695,
-262580, 0, 54657857, 28639668, 4, 54722560, 28640068, 262582,
-0, 54920005, 28508598, 4, 54984704, 840};
-extern const uint32_t mercury_WADSideDefs[6308] = {
-0, 45, 0, 45, 0, 45, 0, 2,
-2949120, 0, 2949120, 0, 2949120, 0, 5636096, 0,
-45, 0, 45, 0, 45, 0, 2, 2949120,
-0, 2949120, 0, 2949120, 0, 5636096, 0, 45,
-0, 45, 0, 45, 0, 6291456, 2949120, 0,
-2949120, 0, 2949120, 0, 5636096, 0, 45, 0,
-1380929348, 51, 45, 0, 6291552, 2949120, 0, 2949120,
-0, 2949120, 0, 5570560, 0, 45, 0, 1464357697,
-5000257, 45, 0, 5, 2949120, 0, 2949120, 0,
-2949120, 0, 1245184, 0, 45, 0, 45, 0,
-45, 0, 0, 2949120, 0, 2949120, 0, 2949120,
-0, 5570560, 0, 45, 0, 1380929348, 51, 45,
-0, 82, 2949120, 0, 2949120, 0, 2949120, 0,
-5439488, 0, 45, 0, 45, 0, 45, 0,
-2, 2949120, 0, 2949120, 0, 2949120, 0, 5636096,
-0, 45, 0, 45, 0, 45, 0, 6291457,
-2949120, 0, 1329856512, 3363407, 2949120, 0, 5636096, 0,
-45, 0, 45, 0, 45, 0, 2, 2949120,
-0, 2949120, 0, 2949120, 0, 5636096, 0, 45,
-0, 45, 0, 45, 0, 96, 2949120, 0,
-2949120, 0, 2949120, 0, 131072, 0, 45, 0,
-45, 0, 1380929348, 51, 18, 2949120, 0, 2949120,
-0, 2949120, 0, 65536, 0, 45, 0, 45,
-0, 45, 0, 2, 2949120, 0, 2949120, 0,
-2949120, 0, 131072, 0, 45, 0, 45, 0,
-45, 0, 86, 2949120, 0, 1397161984, 1162760020, 2949169,
-0, 196608, 0, 45, 0, 45, 0, 45,
-0, 4, 2949120, 0, 1397161984, 1162760020, 2949169, 0,
-196608, 0, 45, 0, 45, 0, 45, 0,
-4, 2949120, 0, 1397161984, 1162760020, 2949169, 0, 196608,
-0, 45, 0, 45, 0, 45, 0, 4,
-2949120, 0, 2949120, 0, 1329856512, 3363407, 1179648, 0,
-45, 0, 1330926407, 3229006, 45, 0, 3, 2949120,
-0, 2949120, 0, 2949120, 0, 262144, 0, 45,
-0, 1330926407, 3229006, 45, 0, 3, 2949120, 0,
-2949120, 0, 2949120, 0, 262144, 0, 45, 0,
-1464357697, 5000257, 45, 0, 5, 2949120, 0, 2949120,
-0, 2949120, 0, 1245184, 0, 45, 0, 1464357697,
-5000257, 45, 0, 5, 2949120, 0, 2949120, 0,
-2949120, 0, 1245184, 0, 45, 0, 1464357697, 5000257,
-45, 0, 5, 2949120, 0, 2949120, 0, 2949120,
-0, 1245184, 0, 45, 0, 1464357697, 5000257, 45,
-0, 5, 2949120, 0, 2949120, 0, 2949120, 0,
-1245184, 0, 45, 0, 1380929348, 51, 45, 0,
-19, 2949120, 0, 2949120, 0, 2949120, 0, 5373952,
-0, 45, 0, 1380929348, 51, 45, 0, 5,
-2949120, 0, 2949120, 0, 2949120, 0, 5373952, 0,
-45, 0, 1380929348, 51, 45, 0, 82, 2949120,
-0, 2949120, 0, 2949120, 0, 5439488, 0, 45,
-0, 1380929348, 51, 45, 0, 82, 2949120, 0,
-2949120, 0, 2949120, 0, 5439488, 0, 45, 0,
-45, 0, 45, 0, 85, 2949120, 0, 2949120,
-0, 2949120, 0, 5636096, 64, 45, 0, 1330926407,
-3229006, 45, 0, 2, 2949120, 0, 2949120, 0,
-2949120, 0, 262144, 0, 45, 0, 1380929348, 51,
-45, 0, 4, 2949120, 0, 2949120, 0, 2949120,
-0, 5570560, 0, 45, 0, 1380929348, 51, 45,
-0, 84, 2949120, 0, 2949120, 0, 2949120, 0,
-5308416, 0, 45, 0, 1380929348, 51, 45, 0,
-4, 2949120, 0, 2949120, 0, 2949120, 0, 1245184,
-0, 45, 0, 45, 0, 45, 0, 19,
-2949120, 0, 2949120, 0, 2949120, 0, 5505024, 0,
-45, 0, 1380929348, 51, 45, 0, 4, 2949120,
-0, 2949120, 0, 2949120, 0, 5570560, 0, 45,
-0, 1380929348, 51, 45, 0, 4, 2949120, 0,
-2949120, 0, 2949120, 0, 5570560, 0, 45, 0,
-1380929348, 51, 45, 0, 93, 2949120, 0, 2949120,
-0, 2949120, 0, 5505024, 0, 45, 0, 1380929348,
-51, 45, 0, 6, 1329856512, 3363407, 2949120, 0,
-2949120, 0, 5308416, 0, 45, 0, 1464357697, 5000257,
-45, 0, 6, 2949120, 0, 2949120, 0, 2949120,
-0, 458752, 0, 45, 0, 1464357697, 5000257, 45,
-0, 6, 2949120, 0, 2949120, 0, 2949120, 0,
-458752, 0, 45, 0, 1464357697, 5000257, 45, 0,
-6, 2949120, 0, 2949120, 0, 2949120, 0, 458752,
-0, 45, 0, 1464357697, 5000257, 45, 0, 6,
-2949120, 0, 2949120, 0, 2949120, 0, 458752, 0,
-45, 0, 1380929348, 51, 45, 0, 9, 1329856512,
-3363407, 2949120, 0, 2949120, 0, 5373952, 0, 45,
-0, 1380929348, 51, 45, 0, 3, 2949120, 0,
-2949120, 0, 2949120, 0, 1245184, 0, 45, 0,
-1380929348, 51, 45, 0, 4, 2949120, 0, 2949120,
-0, 2949120, 0, 5505024, 0, 45, 0, 1380929348,
-51, 45, 0, 4, 2949120, 0, 2949120, 0,
-2949120, 0, 5505024, 0, 45, 0, 1380929348, 51,
-45, 0, 4, 2949120, 0, 2949120, 0, 2949120,
-0, 5505024, 0, 45, 0, 1380929348, 51, 45,
-0, 6291549, 2949120, 0, 2949120, 0, 2949120, 0,
-5505024, 0, 45, 0, 1380929348, 51, 45, 0,
-7, 2949120, 0, 1329856512, 3363407, 2949120, 0, 5308416,
-0, 45, 0, 1380929348, 51, 45, 0, 7,
-2949120, 0, 1329856512, 3363407, 2949120, 0, 5308416, 0,
-45, 0, 1380929348, 51, 45, 0, 7, 2949120,
-0, 1329856512, 3363407, 2949120, 0, 5308416, 0, 45,
-0, 1380929348, 51, 45, 0, 8, 1329856512, 3363407,
-1329856512, 3363407, 2949120, 0, 5308416, 0, 45, 0,
-45, 0, 45, 0, 9, 2949120, 0, 2949120,
-0, 2949120, 0, 1114112, 0, 45, 0, 1380929348,
-51, 45, 0, 19, 2949120, 0, 2949120, 0,
-2949120, 0, 5373952, 524416, 1380929348, 51, 45, 0,
-45, 0, 7, 2949136, 0, 2949120, 0, 2949120,
-0, 524288, 0, 45, 0, 1380929348, 51, 45,
-0, 9, 1329856512, 3363407, 1329856512, 3363407, 2949120, 0,
-5308416, 0, 45, 0, 45, 0, 45, 0,
-8, 1329856520, 3363407, 2949120, 0, 2949120, 0, 589824,
-0, 45, 0, 1380929348, 51, 45, 0, 19,
-2949120, 0, 2949120, 0, 2949120, 0, 5373952, 0,
-45, 0, 45, 0, 45, 0, 9, 2949120,
-0, 2949120, 0, 2949120, 0, 1179648, 0, 45,
-0, 45, 0, 1380929348, 51, 9, 2949120, 0,
-2949120, 0, 2949120, 0, 655360, 0, 45, 0,
-1112686925, 3229004, 45, 0, 18, 2949120, 0, 2949120,
-0, 2949120, 0, 655360, 0, 45, 0, 1112686925,
-3229004, 45, 0, 18, 2949120, 0, 2949120, 0,
-2949120, 0, 655360, 0, 45, 0, 45, 0,
-45, 0, 18, 2949120, 0, 2949120, 0, 2949120,
-0, 655360, 0, 45, 0, 1112686925, 3229004, 45,
-0, 18, 2949120, 0, 2949120, 0, 2949120, 0,
-720896, 0, 45, 0, 1112686925, 3229004, 45, 0,
-18, 2949120, 0, 2949120, 0, 2949120, 0, 720896,
-0, 45, 0, 1112686925, 3229004, 45, 0, 18,
-2949120, 0, 2949120, 0, 2949120, 0, 720896, 0,
-45, 0, 45, 0, 45, 0, 18, 2949120,
-0, 2949120, 0, 2949120, 0, 720896, 0, 45,
-0, 1112686925, 3229004, 45, 0, 18, 2949120, 0,
-2949120, 0, 2949120, 0, 786432, 0, 45, 0,
-1112686925, 3229004, 45, 0, 17, 2949120, 0, 2949120,
-0, 2949120, 0, 786432, 0, 45, 0, 45,
-0, 45, 0, 17, 2949120, 0, 2949120, 0,
-2949120, 0, 786432, 0, 45, 0, 1112686925, 3229004,
-45, 0, 17, 2949120, 0, 2949120, 0, 2949120,
-0, 786432, 0, 45, 0, 1112686925, 3229004, 45,
-0, 17, 2949120, 0, 2949120, 0, 2949120, 0,
-851968, 0, 45, 0, 1112686925, 3229004, 45, 0,
-17, 2949120, 0, 2949120, 0, 2949120, 0, 851968,
-0, 45, 0, 45, 0, 45, 0, 17,
-2949120, 0, 2949120, 0, 2949120, 0, 851968, 0,
-45, 0, 1112686925, 3229004, 45, 0, 17, 2949120,
-0, 2949120, 0, 2949120, 0, 851968, 0, 45,
-0, 1112686925, 3229004, 45, 0, 17, 2949120, 0,
-2949120, 0, 2949120, 0, 917504, 0, 45, 0,
-45, 0, 45, 0, 17, 2949120, 0, 2949120,
-0, 2949120, 0, 917504, 0, 45, 0, 1112686925,
-3229004, 45, 0, 17, 2949120, 0, 2949120, 0,
-2949120, 0, 917504, 0, 45, 0, 1112686925, 3229004,
-45, 0, 17, 2949120, 0, 2949120, 0, 2949120,
-0, 917504, 0, 45, 0, 1112686925, 3229004, 45,
-0, 17, 2949120, 0, 2949120, 0, 2949120, 0,
-983040, 0, 45, 0, 1112686925, 3229004, 45, 0,
-18, 2949120, 0, 2949120, 0, 2949120, 0, 983040,
-0, 45, 0, 1112686925, 3229004, 45, 0, 18,
-2949120, 0, 2949120, 0, 2949120, 0, 983040, 0,
-45, 0, 45, 0, 45, 0, 18, 2949120,
-0, 2949120, 0, 2949120, 0, 983040, 0, 45,
-0, 1112686925, 3229004, 45, 0, 18, 2949120, 0,
-2949120, 0, 1329856512, 3363407, 1048576, 524352, 1380929348, 51,
-45, 0, 45, 0, 9, 2949136, 0, 2949120,
-0, 2949120, 0, 1048576, 0, 45, 0, 45,
-0, 1380929348, 51, 16, 2949120, 0, 2949120, 0,
-2949120, 0, 1310720, 0, 45, 0, 1380929348, 51,
-45, 0, 8388697, 2949120, 0, 2949120, 0, 1329856512,
-3363407, 589824, 0, 45, 0, 45, 0, 1380929348,
-51, 17, 2949120, 0, 2949120, 0, 1329856512, 3363407,
-1114112, 0, 45, 0, 1380929348, 51, 45, 0,
-6291473, 1329856512, 3363407, 2949120, 0, 2949120, 0, 5177344,
-0, 45, 0, 1380929348, 51, 45, 0, 85,
-2949120, 0, 2949120, 0, 2949120, 0, 5701632, 0,
-45, 0, 45, 0, 45, 0, 84, 2949120,
-0, 1329856512, 3363407, 2949120, 0, 5636096, 128, 45,
-0, 1380929348, 51, 45, 0, 17, 1329856512, 3363407,
-2949120, 0, 2949120, 0, 5242880, 0, 45, 0,
-1380929348, 51, 45, 0, 90, 2949120, 0, 2949120,
-0, 2949120, 0, 5242880, 0, 45, 0, 1380929348,
-51, 45, 0, 4, 2949120, 0, 2949120, 0,
-2949120, 0, 1245184, 0, 1380929348, 51, 1380929348, 51,
-45, 0, 19, 2949120, 0, 1329856512, 3363407, 2949120,
-0, 5308416, 0, 45, 0, 1464357697, 5000257, 45,
-0, 6, 2949120, 0, 2949120, 0, 2949120, 0,
-1245184, 0, 45, 0, 1464357697, 5000257, 45, 0,
-6, 2949120, 0, 2949120, 0, 2949120, 0, 1245184,
-0, 45, 0, 1464357697, 5000257, 45, 0, 6,
-2949120, 0, 2949120, 0, 2949120, 0, 1245184, 0,
-45, 0, 1464357697, 5000257, 45, 0, 6, 2949120,
-0, 2949120, 0, 2949120, 0, 1245184, 0, 45,
-0, 1464357697, 5000257, 45, 0, 6, 2949120, 0,
-2949120, 0, 2949120, 0, 1245184, 0, 45, 0,
-1464357697, 5000257, 45, 0, 6, 2949120, 0, 2949120,
-0, 2949120, 0, 1245184, 64, 45, 0, 1380929348,
-51, 45, 0, 18, 1329856512, 3363407, 2949120, 0,
-2949120, 0, 5373952, 0, 45, 0, 1380929348, 51,
-45, 0, 85, 2949120, 0, 2949120, 0, 2949120,
-0, 5701632, 0, 45, 0, 1380929348, 51, 45,
-0, 18, 1329856512, 3363407, 2949120, 0, 2949120, 0,
-5439488, 0, 45, 0, 45, 0, 45, 0,
-20, 2949120, 0, 1329856512, 3363407, 2949120, 0, 5832704,
-128, 45, 0, 45, 0, 1380929348, 51, 21,
-2949120, 0, 2949120, 0, 2949120, 0, 2228224, 0,
-1380929348, 51, 45, 0, 45, 0, 20, 2949120,
-0, 2949120, 0, 1329856512, 3363407, 1310720, 0, 45,
-0, 45, 0, 1380929348, 51, 20, 2949120, 0,
-2949120, 0, 1329856512, 3363407, 1310720, 0, 45, 0,
-45, 0, 1380929348, 51, 20, 2949120, 0, 2949120,
-0, 1329856512, 3363407, 1310720, 0, 45, 0, 45,
-0, 1380929348, 51, 20, 2949120, 0, 2949120, 0,
-1329856512, 3363407, 2490368, 0, 45, 0, 45, 0,
-1380929348, 51, 38, 2949120, 0, 2949120, 0, 1329856512,
-3363407, 2490368, 0, 45, 0, 45, 0, 1380929348,
-51, 38, 2949120, 0, 2949120, 0, 1329856512, 3363407,
-1441792, 0, 45, 0, 45, 0, 1380929348, 51,
-35, 2949120, 0, 2949120, 0, 1329856512, 3363407, 1441792,
-0, 45, 0, 45, 0, 1380929348, 51, 38,
-2949120, 0, 2949120, 0, 1329856512, 3363407, 1310720, 0,
-45, 0, 45, 0, 1380929348, 51, 23, 2949120,
-0, 2949120, 0, 2949120, 0, 1572864, 0, 45,
-0, 45, 0, 45, 0, 35, 2949120, 0,
-2949120, 0, 1329856512, 3363407, 1507328, 0, 45, 0,
-45, 0, 1380929348, 51, 38, 2949120, 0, 2949120,
-0, 1329856512, 3363407, 1310720, 0, 45, 0, 45,
-0, 1380929348, 51, 24, 2949120, 0, 2949120, 0,
-2949120, 0, 1441792, 0, 45, 0, 45, 0,
-45, 0, 24, 2949120, 0, 2949120, 0, 1329856512,
-3363407, 1572864, 0, 45, 0, 45, 0, 1380929348,
-51, 24, 2949120, 0, 2949120, 0, 1329856512, 3363407,
-1572864, 0, 45, 0, 45, 0, 1380929348, 51,
-24, 2949120, 0, 2949120, 0, 1329856512, 3363407, 1572864,
-0, 45, 0, 45, 0, 45, 0, 23,
-2949120, 0, 2949120, 0, 2949120, 0, 1572864, 0,
-45, 0, 45, 0, 1380929348, 51, 24, 2949120,
-0, 2949120, 0, 1329856512, 3363407, 3473408, 0, 45,
-0, 45, 0, 1380929348, 51, 53, 2949120, 0,
-2949120, 0, 2949120, 0, 1572864, 0, 45, 0,
-45, 0, 45, 0, 53, 2949120, 0, 2949120,
-0, 1329856512, 3363407, 1572864, 0, 45, 0, 45,
-0, 45, 0, 24, 2949120, 0, 2949120, 0,
-2949120, 0, 2293760, 0, 45, 0, 45, 0,
-1380929348, 51, 25, 2949120, 0, 2949120, 0, 1329856512,
-3363407, 2359296, 0, 45, 0, 45, 0, 1380929348,
-51, 12582937, 2949120, 0, 2949120, 0, 2949120, 0,
-1572864, 0, 45, 0, 45, 0, 45, 0,
-16777241, 2949120, 0, 2949120, 0, 1329856512, 3363407, 1572864,
-0, 45, 0, 45, 0, 1380929348, 51, 26,
-2949120, 0, 2949120, 0, 2949120, 0, 1638400, 0,
-45, 0, 45, 0, 45, 0, 26, 2949120,
-0, 2949120, 0, 1329856512, 3363407, 1703936, 0, 45,
-0, 45, 0, 45, 0, 46, 2949120, 0,
-2949120, 0, 2949120, 0, 2359296, 0, 45, 0,
-45, 0, 45, 0, 46, 2949120, 0, 2949120,
-0, 2949120, 0, 2359296, 0, 45, 0, 45,
-0, 45, 0, 27, 2949120, 0, 2949120, 0,
-2949120, 0, 3473408, 0, 45, 0, 45, 0,
-45, 0, 27, 2949120, 0, 2949120, 0, 2949120,
-0, 3473408, 0, 45, 0, 45, 0, 45,
-0, 27, 2949120, 0, 2949120, 0, 2949120, 0,
-3473408, 0, 45, 0, 45, 0, 45, 0,
-27, 2949120, 0, 2949120, 0, 2949120, 0, 3473408,
-0, 45, 0, 45, 0, 45, 0, 30,
-2949120, 0, 2949120, 0, 2949120, 0, 2293760, 0,
-45, 0, 45, 0, 1380929348, 51, 28, 2949120,
-0, 2949120, 0, 1329856512, 3363407, 1835008, 0, 45,
-0, 45, 0, 45, 0, 30, 2949120, 0,
-2949120, 0, 2949120, 0, 2293760, 0, 45, 0,
-45, 0, 45, 0, 29, 2949120, 0, 2949120,
-0, 2949120, 0, 2293760, 0, 45, 0, 45,
-0, 45, 0, 29, 2949120, 0, 2949120, 0,
-2949120, 0, 2293760, 0, 45, 0, 45, 0,
-45, 0, 29, 2949120, 0, 2949120, 0, 2949120,
-0, 2293760, 0, 45, 0, 45, 0, 45,
-0, 29, 2949120, 0, 2949120, 0, 2949120, 0,
-2293760, 0, 45, 0, 45, 0, 1380929348, 51,
-35, 2949120, 0, 2949120, 0, 2949120, 0, 1572864,
-0, 45, 0, 45, 0, 45, 0, 35,
-2949120, 0, 2949120, 0, 1329856512, 3363407, 1966080, 0,
-45, 0, 45, 0, 1380929348, 51, 30, 2949120,
-0, 2949120, 0, 1329856512, 3363407, 2031616, 64, 45,
-0, 45, 0, 45, 0, 30, 2949120, 0,
-2949120, 0, 2949120, 0, 2031616, 0, 45, 0,
-45, 0, 1380929348, 51, 31, 2949120, 0, 2949120,
-0, 1329856512, 3363407, 2097152, 0, 45, 0, 45,
-0, 1380929348, 51, 32, 2949120, 0, 2949120, 0,
-2949120, 0, 2031616, 0, 45, 0, 45, 0,
-45, 0, 32, 2949120, 0, 2949120, 0, 1329856512,
-3363407, 2097152, 0, 45, 0, 45, 0, 45,
-0, 54, 2949120, 0, 2949120, 0, 2949120, 0,
-2359296, 0, 45, 0, 45, 0, 1380929348, 51,
-36, 2949120, 0, 2949120, 0, 2949120, 0, 2162688,
-0, 45, 0, 45, 0, 45, 0, 36,
-2949120, 0, 2949120, 0, 2949120, 0, 2162688, 0,
-45, 0, 45, 0, 45, 0, 36, 2949120,
-0, 2949120, 0, 2949120, 0, 2162688, 0, 45,
-0, 45, 0, 45, 0, 36, 2949120, 0,
-2949120, 0, 2949120, 0, 2162688, 0, 45, 0,
-45, 0, 45, 0, 4194340, 2949120, 0, 2949120,
-0, 2949120, 0, 1835008, 0, 45, 0, 45,
-0, 45, 0, 34, 2949120, 0, 2949120, 0,
-1329856512, 3363407, 2228224, 0, 45, 0, 45, 0,
-45, 0, 20, 2949120, 0, 1329856512, 3363407, 2949120,
-0, 5832704, 0, 45, 0, 45, 0, 1380929348,
-51, 8388642, 2949120, 0, 2949120, 0, 1329856512, 3363407,
-1835008, 0, 45, 0, 45, 0, 1380929348, 51,
-20, 2949120, 0, 2949120, 0, 1329856512, 3363407, 5832704,
-0, 45, 0, 45, 0, 1380929348, 51, 89,
-2949120, 0, 2949120, 0, 1329856512, 3363407, 3538944, 0,
-45, 0, 45, 0, 1380929348, 51, 35, 2949120,
-0, 2949120, 0, 2949120, 0, 1835008, 0, 45,
-0, 45, 0, 45, 0, 35, 2949120, 0,
-2949120, 0, 2949120, 0, 1835008, 0, 45, 0,
-45, 0, 45, 0, 35, 2949120, 0, 2949120,
-0, 1329856512, 3363407, 5832704, 0, 45, 0, 45,
-0, 1380929348, 51, 89, 2949120, 0, 2949120, 0,
-1329856512, 3363407, 2359296, 0, 45, 0, 45, 0,
-1380929348, 51, 54, 2949120, 0, 2949120, 0, 1329856512,
-3363407, 3538944, 0, 45, 0, 45, 0, 1380929348,
-51, 76, 2949120, 0, 2949120, 0, 1329856512, 3363407,
-2359296, 0, 45, 0, 45, 0, 45, 0,
-32, 2949120, 0, 2949120, 0, 2949120, 0, 2359296,
-0, 45, 0, 45, 0, 45, 0, 32,
-2949120, 0, 2949120, 0, 2949120, 0, 2359296, 0,
-45, 0, 45, 0, 1380929348, 51, 36, 2949120,
-0, 2949120, 0, 2949120, 0, 1703936, 0, 45,
-0, 45, 0, 45, 0, 36, 2949120, 0,
-2949120, 0, 2949120, 0, 1703936, 0, 45, 0,
-45, 0, 45, 0, 36, 2949120, 0, 2949120,
-0, 2949120, 0, 1703936, 0, 45, 0, 45,
-0, 45, 0, 12582948, 2949120, 0, 2949120, 0,
-1329856512, 3363407, 1835008, 0, 45, 0, 45, 0,
-1380929348, 51, 4194340, 2949120, 0, 2949120, 0, 1329856512,
-3363407, 2359296, 0, 45, 0, 45, 0, 1380929348,
-51, 38, 2949120, 0, 2949120, 0, 2949120, 0,
-1048576, 0, 1380929348, 51, 45, 0, 45, 0,
-38, 2949120, 0, 2949120, 0, 1329856512, 3363407, 2490368,
-0, 45, 0, 45, 0, 1380929348, 51, 38,
-2949120, 0, 2949120, 0, 1329856512, 3363407, 2490368, 0,
-45, 0, 45, 0, 1380929348, 51, 38, 2949120,
-0, 2949120, 0, 1329856512, 3363407, 2490368, 0, 45,
-0, 45, 0, 1380929348, 51, 38, 2949120, 0,
-2949120, 0, 1329856512, 3363407, 2490368, 0, 45, 0,
-45, 0, 45, 0, 23, 1329856512, 3363407, 2949120,
-0, 2949120, 0, 2490368, 0, 45, 0, 45,
-0, 1380929348, 51, 38, 2949120, 0, 2949120, 0,
-1329856512, 3363407, 2490368, 448, 45, 0, 1330926407, 3229006,
-45, 0, 21, 2949120, 0, 2949120, 0, 2949120,
-0, 2490368, 0, 45, 0, 1330926407, 3229006, 45,
-0, 21, 2949120, 0, 2949120, 0, 2949120, 0,
-2490368, 0, 45, 0, 1330926407, 3229006, 45, 0,
-21, 2949120, 0, 2949120, 0, 2949120, 0, 2490368,
-0, 45, 0, 1330926407, 3229006, 45, 0, 21,
-2949120, 0, 2949120, 0, 2949120, 0, 2490368, 0,
-45, 0, 1330926407, 3229006, 45, 0, 21, 2949120,
-0, 2949120, 0, 2949120, 0, 2490368, 0, 45,
-0, 45, 0, 1380929348, 51, 38, 2949120, 0,
-2949120, 0, 1329856512, 3363407, 2490368, 0, 45, 0,
-45, 0, 45, 0, 22, 1329856512, 3363407, 2949120,
-0, 2949120, 0, 2490368, 0, 45, 0, 45,
-0, 1380929348, 51, 39, 2949120, 0, 2949120, 0,
-1329856512, 3363407, 2555904, 0, 45, 0, 45, 0,
-1380929348, 51, 12582951, 1329856512, 3363407, 1397161984, 1162760020, 2949169,
-0, 1376256, 0, 45, 0, 45, 0, 45,
-0, 25165863, 2949120, 0, 2949120, 0, 1329856512, 3363407,
-1376256, 0, 45, 0, 45, 0, 45, 0,
-40, 2949120, 0, 2949120, 0, 2949120, 0, 3932160,
-0, 45, 0, 45, 0, 45, 0, 40,
-2949120, 0, 2949120, 0, 2949120, 0, 3932160, 0,
-45, 0, 45, 0, 45, 0, 40, 2949120,
-0, 2949120, 0, 2949120, 0, 3932160, 0, 45,
-0, 45, 0, 45, 0, 40, 2949120, 0,
-2949120, 0, 2949120, 0, 3932160, 0, 45, 0,
-45, 0, 45, 0, 41, 2949120, 0, 2949120,
-0, 2949120, 0, 2359296, 0, 45, 0, 45,
-0, 45, 0, 41, 2949120, 0, 2949120, 0,
-2949120, 0, 2359296, 0, 45, 0, 45, 0,
-45, 0, 41, 2949120, 0, 2949120, 0, 2949120,
-0, 2359296, 0, 45, 0, 45, 0, 45,
-0, 41, 2949120, 0, 2949120, 0, 2949120, 0,
-2359296, 0, 45, 0, 45, 0, 45, 0,
-42, 2949120, 0, 1397161984, 1162760020, 2949169, 0, 2359296,
-0, 45, 0, 45, 0, 45, 0, 42,
-2949120, 0, 1397161984, 1162760020, 2949169, 0, 2359296, 0,
-45, 0, 45, 0, 45, 0, 42, 2949120,
-0, 2949120, 0, 2949120, 0, 2359296, 0, 45,
-0, 45, 0, 45, 0, 42, 2949120, 0,
-2949120, 0, 2949120, 0, 2359296, 0, 45, 0,
-45, 0, 45, 0, 43, 2949120, 0, 2949120,
-0, 2949120, 0, 2359296, 0, 45, 0, 45,
-0, 45, 0, 43, 2949120, 0, 2949120, 0,
-2949120, 0, 2359296, 0, 45, 0, 45, 0,
-45, 0, 43, 2949120, 0, 2949120, 0, 2949120,
-0, 2359296, 0, 45, 0, 45, 0, 45,
-0, 43, 2949120, 0, 2949120, 0, 2949120, 0,
-2359296, 0, 45, 0, 45, 0, 45, 0,
-44, 2949120, 0, 2949120, 0, 2949120, 0, 2359296,
-0, 45, 0, 45, 0, 45, 0, 44,
-2949120, 0, 2949120, 0, 2949120, 0, 2359296, 0,
-45, 0, 45, 0, 45, 0, 44, 2949120,
-0, 2949120, 0, 2949120, 0, 2359296, 0, 45,
-0, 45, 0, 45, 0, 44, 2949120, 0,
-2949120, 0, 2949120, 0, 2359296, 0, 45, 0,
-45, 0, 45, 0, 45, 2949120, 0, 2949120,
-0, 2949120, 0, 2359296, 0, 45, 0, 45,
-0, 45, 0, 45, 2949120, 0, 2949120, 0,
-2949120, 0, 2359296, 0, 45, 0, 45, 0,
-45, 0, 45, 2949120, 0, 2949120, 0, 2949120,
-0, 2359296, 0, 45, 0, 45, 0, 45,
-0, 45, 2949120, 0, 2949120, 0, 2949120, 0,
-2359296, 0, 45, 0, 45, 0, 1380929348, 51,
-36, 2949120, 0, 2949120, 0, 1329856512, 3363407, 2359296,
-0, 45, 0, 45, 0, 45, 0, 76,
-2949120, 0, 2949120, 0, 2949120, 0, 2359296, 0,
-45, 0, 45, 0, 45, 0, 76, 2949120,
-0, 2949120, 0, 2949120, 0, 2359296, 0, 45,
-0, 45, 0, 1380929348, 51, 46, 2949120, 0,
-2949120, 0, 1329856512, 3363407, 3014656, 0, 45, 0,
-45, 0, 45, 0, 47, 2949120, 0, 2949120,
-0, 2949120, 0, 2359296, 0, 45, 0, 45,
-0, 45, 0, 47, 2949120, 0, 2949120, 0,
-2949120, 0, 2359296, 0, 45, 0, 45, 0,
-45, 0, 47, 2949120, 0, 2949120, 0, 2949120,
-0, 2359296, 0, 45, 0, 45, 0, 45,
-0, 47, 2949120, 0, 2949120, 0, 2949120, 0,
-2359296, 0, 45, 0, 45, 0, 45, 0,
-48, 2949120, 0, 2949120, 0, 2949120, 0, 2359296,
-0, 45, 0, 45, 0, 45, 0, 48,
-2949120, 0, 2949120, 0, 2949120, 0, 2359296, 0,
-45, 0, 45, 0, 45, 0, 48, 2949120,
-0, 2949120, 0, 2949120, 0, 2359296, 0, 45,
-0, 45, 0, 45, 0, 48, 2949120, 0,
-2949120, 0, 2949120, 0, 2359296, 0, 45, 0,
-45, 0, 45, 0, 49, 2949120, 0, 2949120,
-0, 2949120, 0, 2359296, 0, 45, 0, 45,
-0, 45, 0, 49, 2949120, 0, 2949120, 0,
-2949120, 0, 2359296, 0, 45, 0, 45, 0,
-45, 0, 49, 2949120, 0, 2949120, 0, 2949120,
-0, 2359296, 0, 45, 0, 45, 0, 45,
-0, 49, 2949120, 0, 2949120, 0, 2949120, 0,
-2359296, 0, 45, 0, 45, 0, 45, 0,
-50, 2949120, 0, 2949120, 0, 2949120, 0, 3473408,
-0, 45, 0, 45, 0, 45, 0, 50,
-2949120, 0, 2949120, 0, 2949120, 0, 3473408, 0,
-45, 0, 45, 0, 45, 0, 50, 2949120,
-0, 2949120, 0, 2949120, 0, 3473408, 0, 45,
-0, 45, 0, 45, 0, 50, 2949120, 0,
-2949120, 0, 2949120, 0, 3473408, 0, 45, 0,
-45, 0, 45, 0, 24, 2949120, 0, 2949120,
-0, 2949120, 0, 3473408, 0, 45, 0, 45,
-0, 1380929348, 51, 51, 2949120, 0, 2949120, 0,
-1329856512, 3363407, 3342336, 0, 45, 0, 45, 0,
-45, 0, 24, 2949120, 0, 2949120, 0, 2949120,
-0, 3473408, 0, 45, 0, 45, 0, 1380929348,
-51, 52, 2949120, 0, 2949120, 0, 1329856512, 3363407,
-6488064, 128, 45, 0, 45, 0, 1380929348, 51,
-51, 2949120, 0, 2949120, 0, 1329856512, 3363407, 3407872,
-64, 45, 0, 45, 0, 45, 0, 51,
-2949120, 0, 2949120, 0, 2949120, 0, 3407872, 0,
-45, 0, 45, 0, 1380929348, 51, 53, 2949120,
-0, 2949120, 0, 2949120, 0, 3342336, 0, 45,
-0, 45, 0, 45, 0, 53, 2949120, 0,
-2949120, 0, 2949120, 0, 3342336, 0, 45, 0,
-45, 0, 45, 0, 53, 2949120, 0, 2949120,
-0, 2949120, 0, 3014656, 0, 45, 0, 45,
-0, 45, 0, 36, 2949120, 0, 2949120, 0,
-2949120, 0, 3014656, 0, 45, 0, 45, 0,
-45, 0, 36, 2949120, 0, 2949120, 0, 1329856512,
-3363407, 3538944, 0, 45, 0, 45, 0, 1380929348,
-51, 89, 2949120, 0, 1329790976, 1279414349, 1329808725, 1279414349,
-5850453, 0, 45, 0, 45, 0, 1380929348, 51,
-89, 2949120, 0, 1329790976, 1279414349, 1329808725, 1279414349, 5850453,
-0, 45, 0, 45, 0, 1380929348, 51, 89,
-2949120, 0, 2949120, 0, 1329856512, 3363407, 5832704, 0,
-45, 0, 45, 0, 1380929348, 51, 55, 2949120,
-0, 2949120, 0, 1329856512, 3363407, 3604480, 0, 45,
-0, 45, 0, 45, 0, 83, 2949120, 0,
-1329856512, 3363407, 2949120, 0, 5636096, 0, 45, 0,
-45, 0, 1380929348, 51, 37, 2949120, 0, 2949120,
-0, 1329856512, 3363407, 3670016, 0, 45, 0, 45,
-0, 1380929348, 51, 55, 2949120, 0, 2949120, 0,
-1329856512, 3363407, 5832704, 0, 45, 0, 45, 0,
-1380929348, 51, 37, 2949120, 0, 2949120, 0, 2949120,
-0, 5439488, 0, 45, 0, 1380929348, 51, 45,
-0, 86, 2949120, 0, 2949120, 0, 2949120, 0,
-2424832, 0, 1380929348, 51, 1380929348, 51, 45, 0,
-55, 2949120, 0, 2949120, 0, 1329856512, 3363407, 3670016,
-0, 45, 0, 45, 0, 1380929348, 51, 56,
-2949120, 0, 2949120, 0, 2949120, 0, 3735552, 0,
-45, 0, 45, 0, 45, 0, 60, 2949120,
-0, 2949120, 0, 2949120, 0, 3735552, 0, 45,
-0, 45, 0, 45, 0, 60, 2949120, 0,
-2949120, 0, 1329856512, 3363407, 3670016, 0, 45, 0,
-45, 0, 1380929348, 51, 56, 2949120, 0, 2949120,
-0, 2949120, 0, 2424832, 0, 45, 0, 45,
-0, 45, 0, 56, 2949120, 0, 2949120, 0,
-1329856512, 3363407, 3735552, 0, 45, 0, 45, 0,
-1380929348, 51, 60, 2949120, 0, 2949120, 0, 1329856512,
-3363407, 3801088, 0, 45, 0, 45, 0, 1380929348,
-51, 57, 2949120, 0, 2949120, 0, 2949120, 0,
-3801088, 0, 45, 0, 45, 0, 45, 0,
-60, 2949120, 0, 2949120, 0, 2949120, 0, 3801088,
-0, 45, 0, 45, 0, 45, 0, 60,
-2949120, 0, 2949120, 0, 2949120, 0, 3801088, 0,
-45, 0, 45, 0, 45, 0, 60, 2949120,
-0, 2949120, 0, 1329856512, 3363407, 3932160, 0, 45,
-0, 45, 0, 1380929348, 51, 59, 2949120, 0,
-2949120, 0, 1329856512, 3363407, 3866624, 0, 45, 0,
-45, 0, 1380929348, 51, 4194363, 2949120, 0, 2949120,
-0, 2949120, 0, 3670016, 0, 45, 0, 45,
-0, 45, 0, 8388667, 2949120, 0, 2949120, 0,
-1329856512, 3363407, 3670016, 0, 45, 0, 45, 0,
-1380929348, 51, 60, 2949120, 0, 2949120, 0, 2949120,
-0, 3670016, 0, 45, 0, 45, 0, 45,
-0, 60, 2949120, 0, 2949120, 0, 2949120, 0,
-3670016, 0, 45, 0, 45, 0, 45, 0,
-60, 2949120, 0, 2949120, 0, 1329856512, 3363407, 2752512,
-0, 45, 0, 45, 0, 1380929348, 51, 42,
-2949120, 0, 2949120, 0, 1329856512, 3363407, 2752512, 0,
-45, 0, 45, 0, 1380929348, 51, 42, 2949120,
-0, 2949120, 0, 1329856512, 3363407, 3997696, 0, 45,
-0, 45, 0, 1380929348, 51, 61, 2949120, 0,
-2949120, 0, 1329856512, 3363407, 3997696, 64, 1380929348, 51,
-45, 0, 45, 0, 4194346, 2949120, 0, 2949120,
-0, 2949120, 0, 3997696, 128, 45, 0, 45,
-0, 1380929348, 51, 42, 2949120, 0, 2949120, 0,
-2949120, 0, 2359296, 0, 45, 0, 45, 0,
-45, 0, 62, 2949120, 0, 2949120, 0, 2949120,
-0, 2359296, 0, 45, 0, 45, 0, 45,
-0, 62, 2949120, 0, 2949120, 0, 2949120, 0,
-2359296, 0, 45, 0, 45, 0, 45, 0,
-62, 2949120, 0, 2949120, 0, 2949120, 0, 2359296,
-0, 45, 0, 45, 0, 45, 0, 62,
-2949120, 0, 2949120, 0, 2949120, 0, 2359296, 0,
-45, 0, 45, 0, 45, 0, 63, 2949120,
-0, 2949120, 0, 2949120, 0, 2359296, 0, 45,
-0, 45, 0, 45, 0, 63, 2949120, 0,
-2949120, 0, 2949120, 0, 2359296, 0, 45, 0,
-45, 0, 45, 0, 63, 2949120, 0, 2949120,
-0, 2949120, 0, 2359296, 0, 45, 0, 45,
-0, 45, 0, 63, 2949120, 0, 2949120, 0,
-2949120, 0, 2359296, 0, 45, 0, 45, 0,
-45, 0, 64, 2949120, 0, 2949120, 0, 2949120,
-0, 2359296, 0, 45, 0, 45, 0, 45,
-0, 64, 2949120, 0, 2949120, 0, 1329856512, 3363407,
-4194304, 704, 45, 0, 45, 0, 1380929348, 51,
-64, 2949120, 0, 2949120, 0, 2949120, 0, 2359296,
-0, 45, 0, 45, 0, 45, 0, 65,
-2949120, 0, 2949120, 0, 2949120, 0, 2359296, 0,
-45, 0, 45, 0, 45, 0, 65, 2949120,
-0, 2949120, 0, 2949120, 0, 2359296, 0, 45,
-0, 45, 0, 45, 0, 37748801, 2949120, 0,
-2949120, 0, 1329856512, 3363407, 4259840, 640, 45, 0,
-45, 0, 1380929348, 51, 36, 2949120, 0, 2949120,
-0, 2949120, 0, 2359296, 0, 45, 0, 45,
-0, 45, 0, 66, 2949120, 0, 2949120, 0,
-2949120, 0, 2359296, 0, 45, 0, 45, 0,
-45, 0, 66, 2949120, 0, 2949120, 0, 2949120,
-0, 2359296, 0, 45, 0, 45, 0, 45,
-0, 66, 2949120, 0, 2949120, 0, 2949120, 0,
-2359296, 0, 45, 0, 45, 0, 45, 0,
-66, 2949120, 0, 2949120, 0, 2949120, 0, 2359296,
-0, 45, 0, 45, 0, 45, 0, 67,
-2949120, 0, 2949120, 0, 2949120, 0, 2359296, 0,
-45, 0, 45, 0, 45, 0, 67, 2949120,
-0, 2949120, 0, 2949120, 0, 2359296, 0, 45,
-0, 45, 0, 45, 0, 67, 2949120, 0,
-2949120, 0, 2949120, 0, 2359296, 0, 45, 0,
-45, 0, 45, 0, 67, 2949120, 0, 2949120,
-0, 2949120, 0, 2359296, 0, 45, 0, 45,
-0, 45, 0, 68, 2949120, 0, 2949120, 0,
-2949120, 0, 2359296, 0, 45, 0, 45, 0,
-45, 0, 68, 2949120, 0, 2949120, 0, 2949120,
-0, 2359296, 0, 45, 0, 45, 0, 45,
-0, 68, 2949120, 0, 2949120, 0, 2949120, 0,
-2359296, 0, 45, 0, 45, 0, 45, 0,
-68, 2949120, 0, 2949120, 0, 2949120, 0, 2359296,
-0, 45, 0, 45, 0, 45, 0, 69,
-2949120, 0, 2949120, 0, 2949120, 0, 2359296, 0,
-45, 0, 45, 0, 45, 0, 69, 2949120,
-0, 2949120, 0, 2949120, 0, 2359296, 0, 45,
-0, 45, 0, 45, 0, 69, 2949120, 0,
-2949120, 0, 2949120, 0, 2359296, 0, 45, 0,
-45, 0, 45, 0, 69, 2949120, 0, 2949120,
-0, 2949120, 0, 2359296, 0, 45, 0, 45,
-0, 45, 0, 70, 2949120, 0, 2949120, 0,
-2949120, 0, 2359296, 0, 45, 0, 45, 0,
-45, 0, 70, 2949120, 0, 2949120, 0, 2949120,
-0, 2359296, 0, 45, 0, 45, 0, 45,
-0, 70, 2949120, 0, 2949120, 0, 2949120, 0,
-2359296, 0, 45, 0, 45, 0, 45, 0,
-70, 2949120, 0, 2949120, 0, 2949120, 0, 2359296,
-0, 45, 0, 45, 0, 45, 0, 71,
-2949120, 0, 2949120, 0, 2949120, 0, 2359296, 0,
-45, 0, 45, 0, 45, 0, 71, 2949120,
-0, 2949120, 0, 2949120, 0, 2359296, 0, 45,
-0, 45, 0, 45, 0, 71, 2949120, 0,
-2949120, 0, 2949120, 0, 2359296, 0, 45, 0,
-45, 0, 45, 0, 71, 2949120, 0, 2949120,
-0, 2949120, 0, 4718592, 0, 45, 0, 45,
-0, 45, 0, 36, 2949120, 0, 2949120, 0,
-2949120, 0, 4718592, 0, 45, 0, 45, 0,
-45, 0, 36, 2949120, 0, 2949120, 0, 2949120,
-0, 4718592, 0, 45, 0, 45, 0, 45,
-0, 36, 2949120, 0, 2949120, 0, 2949120, 0,
-4718592, 0, 45, 0, 45, 0, 45, 0,
-36, 2949120, 0, 2949120, 0, 2949120, 0, 2359296,
-0, 45, 0, 45, 0, 45, 0, 73,
-2949120, 0, 2949120, 0, 2949120, 0, 2359296, 0,
-45, 0, 45, 0, 45, 0, 73, 2949120,
-0, 2949120, 0, 2949120, 0, 2359296, 0, 45,
-0, 45, 0, 45, 0, 73, 2949120, 0,
-2949120, 0, 2949120, 0, 2359296, 0, 45, 0,
-45, 0, 45, 0, 73, 2949120, 0, 2949120,
-0, 2949120, 0, 2359296, 0, 45, 0, 45,
-0, 45, 0, 74, 2949120, 0, 2949120, 0,
-2949120, 0, 2359296, 0, 45, 0, 45, 0,
-45, 0, 74, 2949120, 0, 2949120, 0, 2949120,
-0, 2359296, 0, 45, 0, 45, 0, 45,
-0, 74, 2949120, 0, 2949120, 0, 2949120, 0,
-2359296, 0, 45, 0, 45, 0, 45, 0,
-74, 2949120, 0, 2949120, 0, 2949120, 0, 2359296,
-0, 45, 0, 45, 0, 45, 0, 75,
-2949120, 0, 2949120, 0, 2949120, 0, 2359296, 0,
-45, 0, 45, 0, 45, 0, 75, 2949120,
-0, 2949120, 0, 2949120, 0, 2359296, 0, 45,
-0, 45, 0, 45, 0, 75, 2949120, 0,
-2949120, 0, 2949120, 0, 2359296, 0, 45, 0,
-45, 0, 45, 0, 75, 2949120, 0, 2949120,
-0, 2949120, 0, 4980736, 0, 45, 0, 45,
-0, 45, 0, 41943094, 2949120, 0, 2949120, 0,
-1329856512, 3363407, 4980736, 0, 45, 0, 45, 0,
-45, 0, 77, 1329856512, 3363407, 1397161984, 1162760020, 2949169,
-0, 5636096, 0, 45, 0, 45, 0, 45,
-0, 77, 1329856512, 3363407, 1397161984, 1162760020, 2949169, 0,
-5636096, 0, 45, 0, 45, 0, 45, 0,
-77, 1329856512, 3363407, 1397161984, 1162760020, 2949169, 0, 5636096,
-0, 45, 0, 45, 0, 45, 0, 77,
-1329856512, 3363407, 1397161984, 1162760020, 2949169, 0, 5636096, 0,
-45, 0, 45, 0, 45, 0, 78, 1329856512,
-3363407, 1397161984, 1162760020, 2949169, 0, 5636096, 0, 45,
-0, 45, 0, 45, 0, 78, 1329856512, 3363407,
-1397161984, 1162760020, 2949169, 0, 5636096, 0, 45, 0,
-45, 0, 45, 0, 78, 1329856512, 3363407, 1397161984,
-1162760020, 2949169, 0, 5636096, 0, 45, 0, 45,
-0, 45, 0, 78, 1329856512, 3363407, 1397161984, 1162760020,
-2949169, 0, 5636096, 0, 45, 0, 45, 0,
-45, 0, 79, 2949120, 0, 1329856512, 3363407, 2949120,
-0, 5308416, 0, 45, 0, 45, 0, 45,
-0, 6291535, 2949120, 0, 1329856512, 3363407, 2949120, 0,
-5308416, 0, 45, 0, 45, 0, 1380929348, 51,
-80, 2949120, 0, 2949120, 0, 1329856512, 3363407, 5242880,
-0, 45, 0, 45, 0, 45, 0, 80,
-2949120, 0, 1329856512, 3363407, 2949120, 0, 5308416, 0,
-45, 0, 45, 0, 45, 0, 80, 2949120,
-0, 1329856512, 3363407, 2949120, 0, 5308416, 0, 45,
-0, 1380929348, 51, 45, 0, 84, 2949120, 0,
-2949120, 0, 2949120, 0, 5767168, 0, 45, 0,
-1380929348, 51, 45, 0, 84, 2949120, 0, 2949120,
-0, 2949120, 0, 5767168, 0, 45, 0, 45,
-0, 45, 0, 88, 2949120, 0, 1329856512, 3363407,
-2949120, 0, 5636096, 0, 45, 0, 45, 0,
-45, 0, 88, 2949120, 0, 1329856512, 3363407, 2949120,
-0, 5636096, 0, 45, 0, 45, 0, 45,
-0, 88, 2949120, 0, 1329856512, 3363407, 2949120, 0,
-5636096, 0, 45, 0, 45, 0, 45, 0,
-19, 2949120, 0, 2949120, 0, 2949120, 0, 5570560,
-0, 45, 0, 1380929348, 51, 45, 0, 85,
-2949120, 0, 2949120, 0, 2949120, 0, 5373952, 0,
-45, 0, 45, 0, 45, 0, 80, 2949120,
-0, 1329856512, 3363407, 2949120, 0, 5636096, 0, 45,
-0, 45, 0, 45, 0, 83, 2949120, 0,
-2949120, 0, 2949120, 0, 5701632, 0, 45, 0,
-1380929348, 51, 45, 0, 8, 1329856512, 3363407, 2949120,
-0, 2949120, 0, 5373952, 0, 45, 0, 1380929348,
-51, 45, 0, 6, 2949120, 0, 2949120, 0,
-2949120, 0, 5373952, 0, 45, 0, 1380929348, 51,
-45, 0, 19, 2949120, 0, 2949120, 0, 2949120,
-0, 5373952, 0, 45, 0, 1380929348, 51, 45,
-0, 19, 2949120, 0, 2949120, 0, 2949120, 0,
-5373952, 0, 45, 0, 45, 0, 45, 0,
-87, 2949120, 0, 1329856512, 3363407, 2949120, 0, 5636096,
-0, 45, 0, 45, 0, 45, 0, 87,
-2949120, 0, 1329856512, 3363407, 2949120, 0, 5636096, 0,
-45, 0, 45, 0, 45, 0, 87, 2949120,
-0, 1329856512, 3363407, 2949120, 0, 5636096, 0, 45,
-0, 45, 0, 45, 0, 80, 2949120, 0,
-1329856512, 3363407, 2949120, 0, 5636096, 0, 45, 0,
-45, 0, 45, 0, 80, 2949120, 0, 2949120,
-0, 2949120, 0, 5767168, 0, 45, 0, 45,
-0, 45, 0, 80, 2949120, 0, 1329856512, 3363407,
-2949120, 0, 5636096, 0, 45, 0, 45, 0,
-45, 0, 80, 2949120, 0, 1329856512, 3363407, 2949120,
-0, 5636096, 0, 45, 0, 45, 0, 1380929348,
-51, 83, 2949120, 0, 2949120, 0, 1329856512, 3363407,
-5439488, 0, 45, 0, 45, 0, 1380929348, 51,
-86, 2949120, 0, 2949120, 0, 1329856512, 3363407, 5636096,
-0, 45, 0, 45, 0, 1380929348, 51, 86,
-2949120, 0, 2949120, 0, 1329856512, 3363407, 5636096, 0,
-45, 0, 45, 0, 1380929348, 51, 86, 2949120,
-0, 2949120, 0, 1329856512, 3363407, 5636096, 0, 45,
-0, 45, 0, 1380929348, 51, 86, 2949120, 0,
-2949120, 0, 2949120, 0, 5439488, 0, 45, 0,
-1380929348, 51, 45, 0, 86, 2949120, 0, 2949120,
-0, 2949120, 0, 5439488, 0, 45, 0, 1380929348,
-51, 45, 0, 86, 2949120, 0, 1329790976, 1279414349,
-1329808725, 1279414349, 5850453, 0, 45, 0, 45, 0,
-1347243843, 1163217986, 2097207, 2949120, 0, 2949120, 0, 1329856512,
-3363407, 5832704, 32, 45, 0, 45, 0, 1380929348,
-51, 55, 2949120, 0, 2949120, 0, 2949120, 0,
-5898240, 0, 45, 0, 45, 0, 45, 0,
-6291547, 2949120, 0, 1329856512, 3363407, 2949120, 0, 1114112,
-0, 1380929348, 51, 45, 0, 45, 0, 6291546,
-2949120, 0, 2949120, 0, 2949120, 0, 5898240, 0,
-45, 0, 1380929348, 51, 45, 0, 81, 2949120,
-0, 2949120, 0, 2949120, 0, 5963776, 0, 45,
-0, 45, 0, 45, 0, 4194396, 2949120, 0,
-1329856512, 3363407, 2949120, 0, 1114112, 32, 1380929348, 51,
-45, 0, 45, 0, 4194395, 2949120, 0, 2949120,
-0, 2949120, 0, 5963776, 32, 45, 0, 1380929348,
-51, 45, 0, 81, 2949120, 0, 2949120, 0,
-2949120, 0, 6029312, 0, 45, 0, 45, 0,
-45, 0, 2097231, 2949120, 0, 1329856512, 3363407, 2949120,
-0, 1114112, 64, 1380929348, 51, 45, 0, 45,
-0, 2097244, 2949120, 0, 2949120, 0, 2949120, 0,
-6029312, 64, 45, 0, 1380929348, 51, 45, 0,
-81, 2949120, 0, 2949120, 0, 2949120, 0, 6094848,
-0, 45, 0, 45, 0, 45, 0, 6291550,
-2949120, 0, 2949120, 0, 2949120, 0, 6094848, 0,
-45, 0, 1380929348, 51, 45, 0, 2097238, 2949120,
-0, 1329856512, 3363407, 2949120, 0, 6160384, 64, 45,
-0, 45, 0, 45, 0, 84, 2949120, 0,
-2949120, 0, 2949120, 0, 6160384, 0, 45, 0,
-45, 0, 45, 0, 4194399, 2949120, 0, 2949120,
-0, 2949120, 0, 6160384, 32, 45, 0, 1380929348,
-51, 45, 0, 4194390, 2949120, 0, 1329856512, 3363407,
-2949120, 0, 6225920, 32, 45, 0, 45, 0,
-45, 0, 84, 2949120, 0, 2949120, 0, 2949120,
-0, 6225920, 0, 45, 0, 45, 0, 45,
-0, 2097153, 2949120, 0, 2949120, 0, 2949120, 0,
-6225920, 64, 45, 0, 1380929348, 51, 45, 0,
-6291542, 2949120, 0, 2949120, 0, 2949120, 0, 65536,
-0, 45, 0, 45, 0, 45, 0, 84,
-2949120, 0, 2949120, 0, 2949120, 0, 6291456, 0,
-45, 0, 45, 0, 45, 0, 6291553, 2949120,
-0, 2949120, 0, 2949120, 0, 6291456, 0, 45,
-0, 45, 0, 45, 0, 2097238, 2949120, 0,
-1329856512, 3363407, 2949120, 0, 6356992, 64, 45, 0,
-45, 0, 45, 0, 85, 2949120, 0, 2949120,
-0, 2949120, 0, 6356992, 0, 45, 0, 45,
-0, 45, 0, 4194402, 2949120, 0, 2949120, 0,
-2949120, 0, 6356992, 32, 45, 0, 45, 0,
-45, 0, 4194390, 2949120, 0, 1329856512, 3363407, 2949120,
-0, 6422528, 32, 45, 0, 45, 0, 45,
-0, 85, 2949120, 0, 2949120, 0, 2949120, 0,
-6422528, 0, 45, 0, 45, 0, 45, 0,
-2097152, 2949120, 0, 2949120, 0, 2949120, 0, 6422528,
-64, 45, 0, 45, 0, 45, 0, 6291542,
-2949120, 0, 2949120, 0, 2949120, 0, 0, 0,
-45, 0, 45, 0, 45, 0, 85, 2949120,
-0, 2949120, 0, 1329856512, 3363407, 6488064, 0, 45,
-0, 45, 0, 45, 0, 52, 2949120, 0,
-2949120, 0, 2949120, 0, 6488064, 0, 45, 0,
-45, 0, 1380929348, 51, 99, 2949120, 0, 2949120,
-0, 1329856512, 3363407, 6488064, 0, 45, 0, 45,
-0, 1380929348, 51, 99, 2949120, 0, 2949120, 0,
-1329856512, 3363407, 6488064, 0, 45, 0, 45, 0,
-1380929348, 51, 99, 2949120, 0, 2949120, 0, 1329856512,
-3363407, 6488064, 0, 45, 0, 45, 0, 1380929348,
-51, 99, 2949120, 0, 2949120, 0, 1329856512, 3363407,
-6488064, 0, 45, 0, 45, 0, 1380929348, 51,
-99, 2949120, 0, 2949120, 0, 1329856512, 3363407, 6488064,
-0, 45, 0, 45, 0, 1380929348, 51, 99,
-2949120, 0, 2949120, 0, 2949120, 0, 6488064, 0,
-45, 0, 45, 0, 45, 0, 100, 2949120,
-0, 2949120, 0, 2949120, 0, 6488064, 0, 45,
-0, 45, 0, 45, 0, 100, 2949120, 0,
-2949120, 0, 2949120, 0, 6488064, 0, 45, 0,
-45, 0, 45, 0, 100, 2949120, 0, 2949120,
-0, 1329856512, 3363407, 6488064, 0, 45, 0, 45,
-0, 1380929348, 51, 100, 2949120, 0, 2949120, 0,
-1329856512, 3363407, 6553600, 0, 45, 0, 45, 0,
-1380929348, 51, 100, 2949120, 0, 2949120, 0, 1329856512,
-3363407, 6553600, 0, 45, 0, 45, 0, 1380929348,
-51, 100, 2949120, 0, 2949120, 0, 1329856512, 3363407,
-6553600, 0, 45, 0, 45, 0, 1380929348, 51,
-100, 2949120, 0, 2949120, 0, 1329856512, 3363407, 6553600,
-0, 45, 0, 45, 0, 1380929348, 51, 100,
-2949120, 0, 1397161984, 1162760020, 2949169, 0, 1376256, 0,
-45, 0, 45, 0, 45, 0, 101, 2949120,
-0, 1397161984, 1162760020, 2949169, 0, 1376256, 0, 45,
-0, 45, 0, 45, 0, 101, 2949120, 0,
-1397161984, 1162760020, 2949169, 0, 1376256, 0, 45, 0,
-45, 0, 45, 0, 101, 2949120, 0, 1397161984,
-1162760020, 2949169, 0, 1376256, 0, 45, 0, 45,
-0, 45, 0, 4288675941};
-extern const uint32_t mercury_WADSegments[2772] = {
-17826066, 20152320, 0, 17957139, 20561920, 0, 17629456, 20938752,
-1, 19071264, 21692416, 0, 18022691, 21757952, 0, 18940192,
-21512192, 0, 19005729, 21561344, 0, 19071266, 21676032, 0,
-18874659, 21725184, 1, 18612503, 20791296, 0, 18284813, 20873216,
-0, 18546972, 21889024, 0, 18088223, 20709376, 1, 18809116,
-21839872, 0, 18612663, 21921792, 20971521, 18743581, 21299200, 1,
-18219285, 21102592, 0, 18153757, 21250048, 0, 18678046, 21331968,
-0, 18743574, 21413888, 0, 18415892, 20660224, 1, 18678037,
-21282816, 1, 18153753, 21430272, 0, 18088217, 20692992, 0,
-18809108, 20742144, 0, 18350367, 20987904, 0, 18415896, 21168128,
-0, 18874650, 20578304, 0, 18481435, 21970944, 0, 13500621,
-15564800, 1, 18481430, 21037056, 0, 18219294, 21381120, 1,
-28836122, 22003712, 1, 13369551, 15663104, 1, 28770745, 21921792,
-4194305, 13369549, 15515648, 0, 13435086, 15532032, 0, 13500623,
-15613952, 0, 13566156, 15695872, 0, 13566158, 15646720, 1,
-13435084, 15482880, 1, 28901659, 21921792, 1, 18547128, 22003712,
-16777217, 11141289, 12500992, 0, 10748067, 12861440, 0, 11075748,
-19529728, 0, 25624747, 20267008, 0, 25690503, 29425664, 0,
-17432968, 29540352, 0, 25690379, 19906560, 0, 17498382, 19922944,
-0, 17891496, 20185088, 0, 17694993, 20447232, 1, 25624968,
-29458432, 1, 11010439, 29573120, 0, 17694992, 20103168, 0,
-17629457, 20332544, 0, 17891598, 20480000, 0, 17826061, 20905984,
-0, 7733367, 8814592, 0, 28967036, 9289728, 0, 8257979,
-9306112, 8388608, 8454270, 9633792, 0, 8126593, 9699328, 0,
-7798904, 8863744, 0, 7864442, 8945664, 0, 7930298, 9289728,
-12582912, 7274610, 8273920, 0, 7667827, 8683520, 0, 7536758,
-8765440, 0, 29032559, 9306112, 0, 10551437, 10452992, 0,
-9633964, 10502144, 0, 10616993, 12025856, 0, 10879138, 12288000,
-0, 9568403, 12648448, 0, 9240722, 12763136, 0, 11272358,
-13664256, 0, 9109620, 8552448, 0, 7602293, 8617984, 1,
-7471242, 9371648, 0, 9044107, 10960896, 0, 9240715, 10911744,
-0, 9109642, 10993664, 1, 9568397, 12730368, 1, 7012460,
-10403840, 0, 9961579, 10584064, 0, 9896085, 11010048, 0,
-9765016, 11091968, 0, 7078039, 11206656, 0, 7274604, 7929856,
-0, 29098095, 8306688, 1, 7077995, 10371072, 1, 9306255,
-10633216, 0, 9371792, 10715136, 0, 9437329, 10797056, 0,
-9502862, 10813440, 0, 7012797, 10551296, 4194305, 9306257, 10846208,
-1, 29163672, 10551296, 1, 9371790, 10665984, 1, 9961918,
-12599296, 4194304, 9437327, 10682368, 1, 29229203, 12599296, 0,
-9634239, 12681216, 8388609, 7471548, 8306688, 4194305, 9044082, 9404416,
-1, 9502864, 10764288, 1, 29294738, 12681216, 1, 7602280,
-7880704, 0, 6881397, 8044544, 0, 7667828, 8585216, 0,
-6815849, 15106048, 0, 17105159, 19644416, 0, 17236232, 19660800,
-0, 17301769, 19742720, 0, 17039455, 7176192, 0, 10551458,
-11993088, 1, 10617092, 12075008, 0, 6226081, 12238848, 0,
-16843004, 18579456, 0, 16515322, 18661376, 0, 16580862, 18907136,
-0, 16646401, 19038208, 0, 16449789, 19152896, 0, 16384251,
-19202048, 0, 7995515, 9011200, 1, 8061186, 9076736, 0,
-16908400, 18530304, 0, 7340153, 18677760, 0, 7340290, 18497536,
-1, 16908541, 19103744, 0, 16580859, 19185664, 1, 12714107,
-8241152, 0, 7995587, 8339456, 0, 8061050, 8978432, 0,
-12779714, 14450688, 0, 26935551, 18825216, 0, 27066779, 31391744,
-0, 27132317, 31457280, 1, 16646557, 18759680, 0, 27132161,
-18989056, 0, 16843006, 19005440, 1, 27066782, 31490048, 0,
-27001246, 31522816, 0, 27197852, 31637504, 0, 27328928, 31735808,
-0, 27394465, 31784960, 0, 27460002, 31899648, 0, 27591076,
-31997952, 0, 27656613, 32047104, 0, 27722150, 32161792, 0,
-29360252, 9175040, 0, 8126906, 9256960, 4194305, 8847494, 10141696,
-1, 8781959, 10108928, 0, 8847496, 10190848, 0, 8913033,
-10272768, 0, 8978566, 10289152, 0, 29426112, 9175040, 4194304,
-8781961, 10321920, 1, 28967033, 9256960, 1, 8913031, 10158080,
-1, 7929968, 18710528, 1, 8978568, 10240000, 1, 16318710,
-18464768, 1, 16187638, 18219008, 0, 16253175, 18333696, 0,
-16318712, 18382848, 0, 16122105, 18432000, 0, 16253177, 18350080,
-1, 16449986, 19234816, 4194305, 16384451, 9158656, 8388608, 16187640,
-18300928, 1, 29491450, 19234816, 1, 29556861, 9158656, 0,
-8192449, 9175040, 8388608, 16122103, 18251776, 1, 11927705, 11354112,
-0, 10027163, 11436032, 0, 10158236, 11501568, 1, 10223781,
-11567104, 0, 11993270, 13238272, 0, 10813623, 13352960, 0,
-10158231, 11157504, 0, 9896044, 11239424, 1, 7078044, 11321344,
-0, 10223771, 11468800, 0, 10354845, 11780096, 1, 11993253,
-13320192, 1, 10813892, 13402112, 20971520, 10485919, 11878400, 1,
-29687984, 13484032, 1, 10289310, 11747328, 0, 10354847, 11829248,
-0, 10420384, 11911168, 0, 10485917, 11927552, 0, 10420382,
-11796480, 1, 29622449, 13402112, 0, 11600325, 13484032, 4194305,
-11403718, 13582336, 12582913, 15794414, 17940480, 1, 15663342, 17694720,
-0, 15728879, 17809408, 0, 15794416, 17858560, 0, 15597809,
-17907712, 0, 29753524, 13582336, 1, 11796935, 13729792, 29360128,
-15728881, 17825792, 1, 15925490, 17956864, 0, 15991027, 18071552,
-0, 16056564, 18120704, 0, 15859957, 18169856, 0, 15663344,
-17776640, 1, 16056562, 18202624, 1, 29819336, 13729792, 4194304,
-15991029, 18087936, 1, 29884675, 13729792, 0, 16974281, 13811712,
-79691776, 15925492, 18038784, 1, 11600004, 9797632, 0, 8650885,
-9863168, 1, 8716468, 9928704, 0, 11534513, 13451264, 0,
-11403440, 13500416, 0, 11796654, 13615104, 0, 8650878, 9453568,
-0, 8454277, 9617408, 0, 8257665, 9666560, 1, 8716420,
-9830400, 0, 14024917, 16072704, 1, 15597807, 17727488, 1,
-22413651, 25542656, 1, 22544727, 25608192, 0, 22282581, 25378816,
-1, 22282579, 25296896, 0, 22348116, 25411584, 0, 22413653,
-25460736, 0, 22217046, 25509888, 0, 22217044, 25329664, 1,
-22348118, 25427968, 1, 22479194, 25788416, 0, 22675801, 25706496,
-0, 22806875, 25870336, 0, 22610264, 25624576, 0, 22479192,
-25575424, 1, 22544729, 25657344, 1, 22610266, 25739264, 1,
-22675799, 25755648, 1, 15335659, 17432576, 0, 15401196, 17514496,
-0, 15466733, 17596416, 0, 15532266, 17678336, 0, 30081482,
-13271040, 8388609, 15532268, 17563648, 1, 30146742, 13189120, 0,
-11928011, 13271040, 12582913, 15466731, 17547264, 1, 10289312, 11960320,
-1, 30015671, 13271040, 1, 13893847, 16236544, 1, 15335661,
-17645568, 1, 8388735, 9502720, 0, 8585344, 10027008, 1,
-8323202, 11599872, 1, 8519861, 11665408, 0, 11862476, 13189120,
-33554432, 15401194, 17465344, 1, 13893845, 16023552, 0, 13959629,
-16105472, 16777216, 30277844, 16203776, 0, 19398948, 22020096, 0,
-19595560, 22478848, 0, 19202347, 22544384, 0, 30343383, 16121856,
-0, 14090704, 16203776, 16777216, 19333414, 22183936, 0, 19464488,
-22298624, 0, 19530025, 22347776, 0, 19595562, 22462464, 0,
-19398955, 22511616, 1, 30409166, 16203776, 4194304, 19136807, 22265856,
-0, 30212310, 16105472, 0, 14025167, 16121856, 16777216, 19267877,
-22102016, 0, 14090454, 16154624, 1, 13762769, 15810560, 1,
-13631697, 15761408, 0, 13697234, 15843328, 0, 13762771, 15859712,
-0, 13828304, 15941632, 0, 13631699, 15974400, 1, 13828306,
-15892480, 1, 13959380, 15990784, 1, 11534510, 13533184, 1,
-13697232, 15728640, 1, 14287065, 16334848, 1, 21233987, 24297472,
-0, 21168452, 24264704, 1, 21233989, 24346624, 1, 21299526,
-24428544, 1, 21365059, 24444928, 1, 21299524, 24313856, 0,
-21365061, 24395776, 0, 21496135, 24559616, 0, 21627209, 24657920,
-0, 21430600, 24526848, 1, 21496137, 24608768, 1, 21561674,
-24690688, 1, 21627207, 24707072, 1, 21561672, 24576000, 0,
-20709691, 23773184, 0, 20644156, 23740416, 1, 20709693, 23822336,
-1, 20775230, 23904256, 1, 20840763, 23920640, 1, 20775228,
-23789568, 0, 20840765, 23871488, 0, 20971839, 24035328, 0,
-20906304, 24002560, 1, 20971841, 24084480, 1, 21037378, 24166400,
-1, 21102911, 24182784, 1, 21102913, 24133632, 0, 21758283,
-24821760, 0, 21037376, 24051712, 0, 21168454, 24477696, 0,
-21430602, 24739840, 0, 30474471, 12910592, 0, 15139046, 17252352,
-1, 19726636, 22659072, 0, 30540241, 12910592, 4194304, 19661103,
-22839296, 0, 19857710, 22757376, 0, 19988784, 22921216, 0,
-19661101, 22626304, 1, 19726638, 22708224, 1, 19792175, 22790144,
-1, 19857708, 22806528, 1, 19792173, 22675456, 0, 20382162,
-12910592, 12582912, 19923251, 23101440, 0, 20447543, 23445504, 0,
-19923249, 22888448, 1, 19988786, 22970368, 1, 20054323, 23052288,
-1, 20119856, 23068672, 1, 20119858, 23019520, 0, 20054321,
-22937600, 0, 20644158, 23953408, 0, 20906306, 24215552, 0,
-21954898, 25280512, 0, 14155993, 16285696, 0, 14221530, 16367616,
-0, 14287067, 16384000, 0, 14352600, 16465920, 0, 14221528,
-16252928, 1, 14155995, 16498688, 1, 14418141, 16531456, 1,
-14352602, 16416768, 1, 14811361, 16859136, 1, 15073508, 17170432,
-1, 23265508, 13123584, 0, 14942438, 17203200, 0, 15073511,
-17285120, 0, 11731299, 26361856, 0, 15138995, 26411008, 0,
-8519807, 11632640, 0, 11468930, 12533760, 0, 8323250, 13025280,
-0, 30605487, 19398656, 0, 14549215, 16695296, 1, 9830554,
-19283968, 1, 14483676, 16564224, 0, 14549213, 16613376, 0,
-14614750, 16662528, 0, 14418143, 16711680, 0, 14483678, 16580608,
-1, 9830868, 17367040, 8388608, 10092694, 19316736, 0, 9699482,
-19365888, 0, 9699459, 9977856, 1, 10092692, 19333120, 1,
-8585364, 10010624, 0, 8388739, 10059776, 0, 15270016, 17317888,
-0, 30671081, 17367040, 0, 14680291, 17022976, 1, 30802389,
-17055744, 4194304, 14680289, 16809984, 0, 14745826, 16891904, 0,
-14811363, 16908288, 0, 14876896, 16990208, 0, 14876898, 16941056,
-1, 15008214, 17055744, 8388608, 14942437, 17104896, 0, 14614748,
-16744448, 1, 14745824, 16777216, 1, 30736534, 17055744, 0,
-11665763, 13074432, 0, 11731411, 19398656, 8388608, 23265459, 26394624,
-1, 23003488, 26099712, 1, 23069025, 26181632, 1, 23134562,
-26263552, 1, 23200095, 26279936, 1, 30867765, 23199744, 0,
-23003490, 26312704, 0, 30933302, 13811712, 0, 20316631, 23199744,
-4194304, 23200097, 26230784, 0, 29950424, 13811712, 50331648, 15859955,
-17989632, 1, 23134560, 26148864, 0, 20185397, 23150592, 1,
-20250934, 23232512, 1, 20316392, 23314432, 0, 15204660, 23330816,
-0, 20250932, 23183360, 0, 20578617, 23543808, 0, 20185402,
-23658496, 0, 21889357, 24920064, 0, 22085968, 25116672, 0,
-22937949, 25968640, 0, 23069023, 26132480, 0, 21692748, 24788992,
-1, 21758285, 24870912, 1, 21823822, 24952832, 1, 21889355,
-24969216, 1, 21823820, 24838144, 0, 22741342, 26050560, 0,
-22872412, 25886720, 0, 22741340, 25837568, 1, 22806877, 25919488,
-1, 22872414, 26001408, 1, 22937947, 26017792, 1, 20513080,
-23461888, 0, 22151505, 25198592, 0, 20382008, 23412736, 1,
-20447545, 23494656, 1, 20513082, 23576576, 1, 20578615, 23592960,
-0, 21692750, 25001984, 0, 22020431, 25034752, 0, 21954896,
-25067520, 1, 22020433, 25149440, 1, 22085970, 25165824, 1,
-22151503, 25247744, 1, 26280338, 30425088, 1, 26411409, 30539776,
-0, 26476947, 30654464, 0, 26345876, 30703616, 0, 26476545,
-557056, 0, 65539, 835584, 0, 26411412, 30621696, 1,
-197011, 30736384, 0, 26542102, 196608, 0, 1441803, 671744,
-0, 26608021, 30851072, 0, 721302, 30900224, 0, 26542486,
-30818304, 1, 26673557, 30932992, 0, 26739095, 31047680, 0,
-26608024, 31096832, 0, 65536, 491520, 0, 655371, 622592,
-0, 720918, 704512, 1, 196609, 802816, 1, 1441795,
-1900544, 0, 786445, 950272, 0, 851982, 1024000, 0,
-917589, 1105920, 0, 2752529, 1187840, 0, 1114124, 1269760,
-0, 5570602, 2818048, 0, 786449, 1302528, 1, 917517,
-991232, 1, 1114154, 1220608, 1, 2752537, 2097152, 0,
-1638405, 2891776, 0, 327684, 2965504, 0, 1638419, 2162688,
-1, 327705, 2924544, 1, 5570574, 1073152, 1, 1310806,
-2285568, 0, 1376276, 2342912, 0, 5636181, 6291456, 0,
-5636116, 2252800, 1, 5701718, 27721728, 1, 851980, 917504,
-1, 196630, 1933312, 1, 1441813, 2007040, 0, 262147,
-3039232, 0, 196612, 3072000, 1, 26280339, 30572544, 1,
-26411011, 30769152, 1, 1442197, 229376, 1, 1376278, 1974272,
-1, 26542487, 30965760, 1, 131155, 2375680, 0, 26148866,
-3080192, 0, 26214799, 30261248, 0, 5439888, 30310400, 0,
-26149264, 30228480, 1, 26280335, 30343168, 0, 26345873, 30457856,
-0, 26214802, 30507008, 0, 1245657, 2031616, 4194304, 262149,
-2998272, 1, 131471, 3112960, 1, 26149265, 30375936, 1,
-30998544, 2031616, 0, 5439490, 2408448, 1, 24313939, 6127616,
-0, 1048946, 27402240, 0, 24248691, 27475968, 0, 24248336,
-27435008, 1, 1049050, 28508160, 16777217, 393589, 27680768, 0,
-31129606, 28508160, 1, 24379765, 27639808, 1, 24444934, 27713536,
-1, 393591, 28573696, 1, 31261148, 28917760, 37748736, 24314226,
-27508736, 1, 24379763, 27557888, 0, 24445300, 27607040, 0,
-31064539, 28508160, 4194305, 23593321, 26755072, 0, 23658858, 26836992,
-0, 23724395, 26918912, 0, 23789928, 26935296, 0, 23724393,
-26804224, 1, 23593323, 26968064, 1, 26607627, 30867456, 1,
-26739094, 31064064, 1, 589834, 49152, 0, 8, 81920,
-0, 524297, 884736, 0, 655369, 16384, 1, 720906,
-589824, 1, 23658856, 26787840, 1, 589832, 851968, 1,
-31392222, 29065216, 75497472, 23331173, 26525696, 0, 23396710, 26542080,
-0, 23462247, 26624000, 0, 23527780, 26705920, 0, 23331175,
-26673152, 1, 31523296, 29065216, 100663296, 524770, 114688, 12582913,
-23396708, 26492928, 1, 31457759, 29065216, 96468992, 31588352, 114688,
-1, 1, 458752, 1, 65940, 524288, 1, 23462245,
-26574848, 1, 26476946, 30670848, 1, 5439859, 6094848, 1,
-23527782, 26656768, 1, 24314228, 27525120, 1, 31195525, 28917760,
-0, 25493894, 28991488, 0, 25559521, 29065216, 104857600, 26214483,
-30277632, 1, 26345872, 30474240, 1, 26673560, 31014912, 1,
-26804631, 31129600, 0, 26870169, 31244288, 0, 26739098, 31293440,
-0, 26869784, 163840, 0, 1572887, 376832, 0, 26804634,
-31211520, 1, 1507737, 31326208, 0, 1310741, 2310144, 1,
-31653975, 27787264, 0, 26673561, 31162368, 1, 26804247, 31358976,
-1, 1507352, 344064, 1, 1573243, 1867776, 0, 1180017,
-6086656, 0, 24838162, 6930432, 0, 24183267, 27787264, 4194304,
-24182802, 6053888, 1, 31719793, 27918336, 1, 1180027, 6897664,
-1, 31785444, 27918336, 4194305, 24838524, 28278784, 0, 24904061,
-28360704, 0, 24510949, 27918336, 16777217, 24969590, 28418048, 0,
-25035126, 19988480, 1, 24969596, 28327936, 1, 24510845, 28385280,
-1, 31916518, 29212672, 33554432, 1573274, 131072, 1, 24838168,
-1835008, 1, 23789930, 26886144, 1, 24904059, 28246016, 1,
-31326479, 29065216, 0, 17760524, 29138944, 0, 17564135, 29212672,
-54525952, 26870168, 31260672, 1, 2097183, 1376256, 0, 2031646,
-1458176, 0, 1966120, 1540096, 0, 2031648, 1409024, 1,
-1966111, 1490944, 1, 6029403, 6635520, 1, 2621470, 1507328,
-1, 5701672, 1622016, 0, 2752597, 2850816, 1, 5570646,
-6324224, 1, 5636183, 27754496, 0, 2621527, 1589248, 1,
-5702115, 27820032, 4194305, 2424920, 2441216, 0, 31981605, 2686976,
-0, 5767257, 6455296, 0, 5832794, 6537216, 0, 2359784,
-2686976, 4194304, 5898331, 6586368, 0, 5963868, 6668288, 0,
-5898329, 6504448, 1, 5963866, 6553600, 1, 1638442, 2129920,
-1, 1245209, 2195456, 0, 5767187, 6373376, 0, 5832792,
-6422528, 1, 2293796, 2637824, 0, 2359331, 2670592, 1,
-2424868, 2719744, 1, 2490405, 3284992, 0, 2490413, 3260416,
-1, 2424870, 3317760, 1, 2949158, 3227648, 0, 23986563,
-27901952, 1, 25362820, 28844032, 0, 25428445, 28917760, 58720256,
-3211348, 27189248, 0, 5505411, 27197440, 0, 24117615, 27303936,
-0, 25362798, 27869184, 0, 23986183, 28467200, 0, 24576489,
-28606464, 4194304, 459127, 28655616, 0, 459118, 28499968, 1,
-24576007, 28688384, 1, 1048595, 2064384, 1, 5767205, 2473984,
-1, 1245272, 6406144, 1, 24052080, 27271168, 1, 24117264,
-27344896, 1, 1048944, 27377664, 0, 393232, 28540928, 0,
-32047110, 28606464, 0, 24641551, 2785280, 0, 5308780, 3424256,
-0, 23855155, 3637248, 0, 3342712, 3702784, 1, 983088,
-3850240, 0, 5111889, 3866624, 0, 5177422, 5570560, 0,
-3145807, 5767168, 0, 3997758, 4456448, 0, 4063295, 4538368,
-0, 4128832, 4620288, 0, 4194365, 4702208, 0, 4128830,
-4571136, 1, 32178666, 5914624, 37748736, 4063293, 4489216, 1,
-32243794, 5832704, 0, 5374443, 5914624, 41943040, 4522054, 4997120,
-0, 4587591, 5079040, 0, 4653128, 5160960, 0, 4718661,
-5177344, 0, 4194367, 4587520, 1, 4522056, 5210112, 1,
-4587589, 5029888, 1, 32113133, 5914624, 20971520, 4259906, 4718592,
-0, 4325443, 4800512, 0, 4390980, 4882432, 0, 4456513,
-4964352, 0, 4325441, 4751360, 1, 4653126, 5046272, 1,
-4456515, 4849664, 1, 3080585, 29720576, 0, 25756043, 29917184,
-0, 4390978, 4833280, 1, 32309297, 5914624, 0, 3211311,
-6193152, 0, 23855185, 3457024, 1, 3997760, 4669440, 1,
-4259908, 4931584, 1, 4718663, 5128192, 1, 5308908, 5832704,
-8388608, 26018156, 5996544, 0, 25887117, 30113792, 0, 3080559,
-6242304, 0, 25821577, 29671424, 0, 25755695, 29687808, 1,
-24052106, 29786112, 0, 25821551, 29753344, 1, 3080241, 6160384,
-1, 24051759, 6275072, 1, 25756042, 29638656, 1, 25952651,
-29868032, 0, 25887113, 29884416, 1, 25821580, 29982720, 0,
-25952650, 29949952, 1, 2097185, 1359872, 1, 6094940, 6684672,
-1, 24707106, 2506752, 0, 32374877, 6717440, 0, 6094900,
-6799360, 0, 3408249, 28049408, 0, 2228259, 2555904, 0,
-6029806, 6717440, 4194304, 2228601, 2539520, 1, 2293794, 2588672,
-1, 3014701, 3145728, 0, 24707118, 3538944, 0, 983416,
-2752512, 1, 24641913, 28000256, 1, 24707124, 28082176, 1,
-3342382, 3358720, 0, 3015033, 3571712, 1, 24641587, 3670016,
-0, 24707448, 28033024, 0, 25887116, 29835264, 1, 26083725,
-30064640, 0, 26018187, 30081024, 1, 25952654, 30179328, 0,
-2949615, 3178496, 6291457, 26083724, 30146560, 1, 32505902, 3178496,
-1, 3014707, 3391488, 1, 3342700, 3604480, 1, 23855469,
-27017216, 1, 23855501, 5963776, 1, 23921004, 27049984, 0,
-26083693, 27099136, 0, 26018190, 30031872, 1, 32440816, 3178496,
-4194305, 23921038, 27066368, 1, 2687009, 262144, 0, 2162720,
-1327104, 0, 2621481, 1687552, 0, 2162729, 294912, 1,
-2687019, 3522560, 0, 2818092, 3792896, 0, 32571485, 6766592,
-1, 2883627, 3760128, 1, 24772652, 28196864, 1, 2883962,
-28229632, 0, 2687016, 1654784, 1, 1703963, 1761280, 0,
-24182810, 1818624, 0, 2818089, 3489792, 1, 31654257, 27820032,
-1, 1704305, 1785856, 1, 24510962, 20021248, 4194304, 24183158,
-27951104, 0, 1769498, 1728512, 1, 25231399, 28704768, 0,
-2555933, 28778496, 0, 25166209, 29343744, 0, 25100672, 29401088,
-0, 32637310, 20021248, 0, 25035135, 20430848, 0, 25100670,
-20398080, 1, 25166207, 29368320, 1, 31850882, 29212672, 0,
-25297281, 29286400, 0, 25231744, 29310976, 1, 3735610, 4210688,
-0, 3801147, 4292608, 0, 3866684, 4374528, 0, 3932217,
-4390912, 0, 32768499, 720896, 4194304, 3735612, 4423680, 1,
-32702512, 720896, 0, 3146229, 3817472, 37748737, 3801145, 4243456,
-1, 4784202, 5259264, 0, 4849739, 5341184, 0, 4915276,
-5423104, 0, 4980809, 5439488, 0, 3866682, 4259840, 1,
-4784204, 5472256, 1, 32834038, 3817472, 20971521, 4849737, 5292032,
-1, 3473462, 3948544, 0, 3538999, 4030464, 0, 3604536,
-4112384, 0, 3670069, 4128768, 0, 3473464, 4161536, 1,
-4915274, 5308416, 1, 3604534, 3997696, 1, 32964636, 6848512,
-0, 32899087, 3817472, 1, 3538997, 3981312, 1, 983543,
-6848512, 4194304, 3277300, 720896, 8388608, 1900594, 1163264, 0,
-3670071, 4079616, 1, 3932219, 4341760, 1, 4980811, 5390336,
-1, 1835037, 6979584, 0, 3408369, 6766592, 4194305, 24772660,
-28114944, 0, 1769500, 442368, 0, 1835023, 6815744, 1,
-3408250, 28147712, 1, 1835035, 409600, 1, 1900572, 6946816,
-1, 5046412, 7061504, 0, 6619640, 7503872, 62914560, 5242981,
-7553024, 0, 9175545, 12320768, 4194304, 11337808, 8159232, 0,
-10944685, 8470528, 0, 33095847, 12320768, 0, 17170509, 5701632,
-0, 33030650, 7503872, 8388608, 5046534, 5734400, 1, 9175117,
-7028736, 1, 17170692, 12173312, 1, 11206826, 12386304, 0,
-10682508, 12779520, 0, 17039621, 19464192, 0, 17367306, 19791872,
-0, 6226180, 7143424, 1, 6160479, 7208960, 0, 6422622,
-7323648, 0, 6488162, 7372800, 0, 17039867, 12140544, 4194304,
-6553699, 7454720, 0, 33161316, 7503872, 0, 33227014, 12140544,
-0, 13107310, 7077888, 0, 12910788, 14614528, 0, 33292485,
-14729216, 0, 7406077, 14827520, 16777216, 7209073, 14876672, 0,
-13304008, 15335424, 0, 12845259, 15400960, 0, 28508598, 33325056,
-0, 12976638, 14729216, 8388608, 33489094, 14778368, 0, 28639668,
-33161216, 0, 33423868, 14729216, 4194304, 28705205, 33243136, 0,
-28508596, 33112064, 1, 28574133, 33193984, 1, 28639670, 33275904,
-1, 28705203, 33292288, 1, 13042175, 14778368, 20971520, 33358023,
-14827520, 0, 28574131, 33144832, 0, 6685184, 7684096, 4194304,
-13041777, 14860288, 1, 33554529, 7684096, 0, 6357088, 7766016,
-0, 12321281, 14123008, 4194304, 12976327, 14745600, 1, 6750310,
-7634944, 0, 33685607, 7815168, 0, 6947330, 7815168, 4194304,
-6815850, 8060928, 0, 7405678, 14909440, 1, 7209069, 14991360,
-0, 7143529, 15007744, 0, 6881384, 15073280, 1, 12714179,
-14417920, 1, 12779713, 14483456, 0, 12648644, 14565376, 0,
-12845253, 14647296, 1, 13172936, 15155200, 0, 13238473, 15204352,
-0, 13304010, 15319040, 0, 13107403, 15368192, 1, 33620157,
-14123008, 0, 12386494, 14204928, 0, 33751234, 14352384, 0,
-12910790, 14696448, 1, 12452031, 14254080, 0, 12517568, 14336000,
-0, 12583427, 14352384, 4194304, 6291640, 8404992, 0, 12058810,
-13860864, 0, 12189883, 13926400, 1, 12255417, 13991936, 0,
-12124348, 14073856, 0, 12189774, 5521408, 0, 5111887, 5603328,
-1, 5177531, 5685248, 0, 12255418, 13893632, 0, 27787520,
-32309248, 1, 33882628, 32800768, 8388608, 27263391, 31653888, 0,
-27525539, 31916032, 0, 27853223, 32178176, 0, 27984128, 32260096,
-0, 16777640, 32342016, 0, 27787689, 32423936, 0, 16712107,
-32440320, 0, 27853224, 32391168, 1, 33817008, 32800768, 0,
-28311985, 32882688, 0, 33948073, 33030144, 0, 28377522, 32931840,
-0, 28443050, 33013760, 0, 27918854, 33030144, 8388608, 34013611,
-32292864, 1, 27984300, 32505856, 0, 28049837, 32587776, 0,
-28115374, 32669696, 0, 16777735, 32292864, 8388609, 28180911, 32718848,
-0, 28246533, 32800768, 62914560};
-extern const uint32_t mercury_WADSubSectors[287] = {
-5, 327684, 589827, 786435, 983041, 1048580, 1310723, 1507332,
-1769474, 1900548, 2162690, 2293764, 2555905, 2621443, 2818051, 3014659,
-3211270, 3604484, 3866629, 4194307, 4390916, 4653063, 5111812, 5373955,
-5570565, 5898243, 6094852, 6356994, 6488067, 6684675, 6881284, 7143428,
-7405571, 7602180, 7864326, 8257540, 8519683, 8716292, 8978434, 9109505,
-9175044, 9437186, 9568259, 9764867, 9961475, 10158084, 10420226, 10551299,
-10747906, 10878980, 11141122, 11272195, 11468803, 11665414, 12058628, 12320771,
-12517378, 12648452, 12910595, 13107202, 13238276, 13500419, 13697028, 13959170,
-14090242, 14221315, 14417926, 14811140, 15073284, 15335425, 15400964, 15663105,
-15728642, 15859714, 15990785, 16056324, 16318468, 16580610, 16711683, 16908292,
-17170438, 17563654, 17956867, 18153476, 18415618, 18546691, 18743297, 18808833,
-18874372, 19136513, 19202050, 19333122, 19464194, 19595268, 19857409, 19922946,
-20054017, 20119556, 20381697, 20447233, 20512772, 20774913, 20840450, 20971524,
-21233666, 21364739, 21561347, 21757954, 21889026, 22020100, 22282241, 22347779,
-22544388, 22806529, 22872068, 23134212, 23396353, 23461890, 23592963, 23789573,
-24117252, 24379394, 24510468, 24772609, 24838147, 25034754, 25165828, 25427970,
-25559044, 25821187, 26017795, 26214403, 26411012, 26673154, 26804227, 27000835,
-27197444, 27459591, 27918340, 28180482, 28311553, 28377092, 28639234, 28770308,
-29032450, 29163524, 29425668, 29687812, 29949956, 30212100, 30474245, 30801926,
-31195137, 31260673, 31326212, 31588354, 31719428, 31981570, 32112644, 32374787,
-32571395, 32768004, 33030148, 33292292, 33554437, 33882114, 34013186, 34144260,
-34406404, 34668548, 34930689, 34996227, 35192835, 35389443, 35586050, 35717124,
-35979266, 36110339, 36306949, 36634632, 37158916, 37421060, 37683204, 37945349,
-38273026, 38404100, 38666242, 38797316, 39059464, 39583747, 39780353, 39845890,
-39976965, 40304642, 40435716, 40697859, 40894466, 41025540, 41287681, 41353219,
-41549826, 41680897, 41746435, 41943045, 42270722, 42401794, 42532869, 42860547,
-43057160, 43581444, 43843586, 43974659, 44171268, 44433410, 44564482, 44695556,
-44957698, 45088771, 45285379, 45481991, 45940740, 46202881, 46268418, 46399492,
-46661633, 46727170, 46858244, 47120386, 47251460, 47513603, 47710212, 47972356,
-48234498, 48365572, 48627716, 48889858, 49020931, 49217540, 49479682, 49610753,
-49676293, 50003971, 50200581, 50528258, 50659330, 50790403, 50987012, 51249154,
-51380227, 51576836, 51838978, 51970050, 52101124, 52363266, 52494338, 52625411,
-52822022, 53215234, 53346307, 53542914, 53673988, 53936131, 54132738, 54263815,
-54722565, 55050243, 55246856, 55771139, 55967746, 56098820, 56360963, 56557570,
-56688644, 56950786, 57081862, 57475076, 57737220, 57999364, 58261507, 58458117,
-58785796, 59047938, 59179015, 59637764, 59899907, 60096516, 60358659};
-extern const uint32_t mercury_WADSectors[663] = {
-838926256, 1346720851, 49, 1263755078, 12633, 192, 4258267136, 1414738432,
-3231813, 1598423040, 827935571, 12582912, 0, 838925696, 1330596934, 945763410,
-1263755078, 12633, 192, 4268752896, 1464218112, 1380275265, 1598423089, 827935571,
-12582912, 0, 838926016, 1330596934, 945763410, 1263755078, 12633, 192,
-4195352576, 1095512576, 3227990, 1598423040, 827935571, 12582912, 0, 838924896,
-1096171852, 49, 1263755078, 12633, 192, 0, 1162097152, 912208205,
-1598423040, 827935571, 12582912, 0, 78643200, 827147588, 13919, 1279870275,
-3497779, 128, 0, 1162086912, 912208205, 1162018816, 1597197385, 12582965,
-0, 167772400, 1330596934, 945763410, 1279870275, 3497779, 192, 15728640,
-1279658496, 877809487, 1162033247, 1597197385, 12582965, 0, 167772400, 1330596934,
-945763410, 1279870275, 3497779, 192, 15728640, 1279658496, 877809487, 1162033247,
-1597197385, 12582965, 0, 167772400, 1330596934, 945763410, 1279870275, 3497779,
-192, 15728640, 1279658496, 877809487, 1162033247, 1597197385, 12582965, 0,
-78643200, 1330596934, 945763410, 1279870275, 3497779, 128, 4289724416, 1464207872,
-1380275265, 1162018865, 1597197385, 12582965, 0, 167837616, 1413568326, 3232325,
-1279870275, 3497779, 192, 0, 1162097152, 912208205, 1598423040, 827935571,
-12582912, 0, 94371840, 1330596934, 945763410, 1279870275, 3497779, 192,
-4289724416, 1464207872, 1380275265, 1162018865, 1597197385, 12582965, 0, 78643200,
-1330596934, 945763410, 1279870275, 3497779, 128, 0, 1279657136, 877809487,
-1162033247, 1597197385, 8388661, 0, 83886080, 1330596934, 945763410, 1279870275,
-3497779, 192, 0, 1279657136, 877809487, 1162033247, 1597197385, 8388661,
-0, 83886080, 1330596934, 945763410, 1279870275, 3497779, 192, 0,
-1279657216, 877809487, 1162033247, 1597197385, 12582965, 0, 83886080, 1330596934,
-945763410, 1279870275, 3497779, 192, 0, 1279657216, 877809487, 1162033247,
-1597197385, 12582965, 0, 83886080, 1330596934, 945763410, 1279870275, 3497779,
-192, 0, 1279657136, 877809487, 1162033247, 1597197385, 8388661, 0,
-83886080, 1330596934, 945763410, 1279870275, 3497779, 192, 0, 1279657216,
-877809487, 1162033247, 1597197385, 12582965, 0, 78643200, 1330596934, 945763410,
-1279870275, 3497779, 128, 4289724416, 1464206592, 1380275265, 1162018865, 1597197385,
-12582965, 0, 83951536, 1413568326, 3232325, 1279870275, 3497779, 192,
-0, 1279657136, 877809487, 1162033247, 1597197385, 8388661, 0, 167772160,
-1330596934, 945763410, 1279870275, 3497779, 192, 0, 1279657216, 877809487,
-1162033247, 1597197385, 11534389, 0, 83886080, 1330596934, 945763410, 1279870275,
-3497779, 192, 0, 1279657216, 877809487, 1162033247, 1597197385, 12582965,
-0, 83886080, 1330596934, 945763410, 1279870275, 3497779, 192, 0,
-1279657216, 877809487, 1162033247, 1597197385, 12582965, 0, 83886080, 1330596934,
-945763410, 1279870275, 3497779, 192, 0, 1279657216, 877809487, 1162033247,
-1597197385, 12582965, 0, 83886080, 1330596934, 945763410, 1279870275, 3497779,
-192, 0, 1279657216, 877809487, 1162033247, 1597197385, 12582965, 0,
-83886080, 1330596934, 945763410, 1279870275, 3497779, 192, 0, 1279657216,
-877809487, 1162033247, 1597197385, 12582965, 0, 83886080, 1330596934, 945763410,
-1279870275, 3497779, 192, 0, 1279657216, 877809487, 1162033247, 1597197385,
-12582965, 0, 78643200, 1330596934, 945763410, 1279870275, 3497779, 128,
-4289724416, 1464206592, 1380275265, 1162018865, 1597197385, 12582965, 0, 83886080,
-1330596934, 945763410, 1279870275, 3497779, 160, 4289724416, 1279657376, 877809487,
-1162033247, 1597197385, 12582965, 0, 83886080, 1330596934, 945763410, 1279870275,
-3497779, 192, 0, 1279657216, 877809487, 1162033247, 1597197385, 12582965,
-0, 83886080, 1330596934, 945763410, 1279870275, 3497779, 192, 0,
-1279657136, 877809487, 1162033247, 1597197385, 8388661, 0, 83951536, 1413568326,
-3232325, 1279870275, 3497779, 192, 0, 1279656576, 877809487, 1162033247,
-1597197385, 5242933, 0, 83951536, 1330596934, 945763410, 1279870275, 3497779,
-192, 4289724416, 1279657216, 877809487, 1162033247, 1597197385, 12582965, 0,
-83886080, 1330596934, 945763410, 1279870275, 3497779, 192, 0, 1279657216,
-877809487, 1162033247, 1597197385, 12582965, 0, 83886080, 1330596934, 945763410,
-1279870275, 3497779, 192, 0, 1279657216, 877809487, 1162033247, 1597197385,
-12582965, 0, 83886080, 1330596934, 945763410, 1279870275, 3497779, 192,
-0, 1279657216, 877809487, 1162033247, 1597197385, 12582965, 0, 83886080,
-1330596934, 945763410, 1279870275, 3497779, 192, 0, 1279657216, 877809487,
-1162033247, 1597197385, 12582965, 0, 83886080, 1330596934, 945763410, 1279870275,
-3497779, 192, 0, 1279657216, 877809487, 1162033247, 1597197385, 12582965,
-0, 83886080, 1330596934, 945763410, 1279870275, 3497779, 192, 0,
-1279657216, 877809487, 1162033247, 1597197385, 12582965, 0, 83886080, 1330596934,
-945763410, 1279870275, 3497779, 192, 4268752896, 1279668736, 877809487, 1162033247,
-1597197385, 12582965, 0, 838925936, 1330596934, 945763410, 1279870275, 3497779,
-192, 173015040, 1414738432, 3231813, 1598423040, 827935571, 12582912, 0,
-838864000, 1330596934, 945763410, 1263755078, 12633, 192, 167772160, 1279668736,
-877809487, 1598437471, 827935571, 12582912, 0, 838863360, 1330596934, 945763410,
-1263755078, 12633, 192, 209715200, 1279668736, 877809487, 1598437471, 827935571,
-12582912, 0, 838860800, 827147588, 13919, 1263755078, 12633, 192,
-0, 1162097152, 912208205, 1598423040, 827935571, 12582912, 0, 838925616,
-1413568326, 3232325, 1263755078, 12633, 192, 209715200, 1279668736, 877809487,
-1598437471, 827935571, 12582912, 0, 838864000, 1330596934, 945763410, 1263755078,
-12633, 192, 4289724416, 1279657376, 3429441, 1162018816, 1597197385, 12582965,
-0, 838863920, 1346720851, 49, 1263755078, 12633, 192, 193986560,
-1414738432, 3231813, 1598423040, 827935571, 12582912, 0, 838863600, 1346720851,
-49, 1263755078, 12633, 192, 4289724416, 1414738432, 3231813, 1598423040,
-827935571, 12582912, 0, 838926096, 1346720851, 49, 1263755078, 12633,
-192, 4268752896, 1414738432, 3231813, 1598423040, 827935571, 12582912, 0,
-838925776, 1346720851, 49, 1263755078, 12633, 192, 4268752896, 1414738432,
-3231813, 1598423040, 827935571, 12582912, 0, 838926096, 1346720851, 49,
-1263755078, 12633, 192, 0, 1279657216, 3429441, 1162018816, 1597197385,
-12582965, 0, 83886080, 1330596934, 945763410, 1279870275, 3497779, 192,
-0, 1279658496, 877809487, 1162033247, 1597197385, 12582965, 0};
-extern const uint32_t mercury_WADNodes[2574] = {
-4292673536, 6684672, 131072, 0, 176164032, 4230020000, 213912896, 4225825696,
-2147581952, 4291756032, 6553600, 131072, 0, 209718400, 4196465120, 209718464,
-4196465120, 2147844100, 4291624960, 6291456, 0, 393216, 201329856, 4192270752,
-201329856, 4188076256, 2147975174, 4291756032, 6553600, 0, 131072, 209718464,
-4196465120, 201329856, 4192270560, 131073, 4291231744, 6291456, 393216, 0,
-188746752, 4196464864, 201329856, 4196464864, 229379, 4292280320, 6029312, 0,
-131072, 192940992, 4213242592, 192940992, 4209048288, 2148302859, 4292280320, 6029312,
-131072, 0, 188746624, 4213242400, 192940992, 4213242592, 360458, 4292411392,
-6160384, 0, 4294836224, 188746688, 4213242400, 188746688, 4217436960, 2148335622,
-4292411392, 6160384, 4294836224, 0, 197135552, 4217436704, 188746688, 4217436704,
-491529, 4292542464, 5898240, 0, 786432, 188746944, 4221631328, 188746944,
-4217436704, 557064, 4291887104, 6684672, 0, 4294836224, 188746944, 4196464864,
-188746944, 4221631008, 589828, 4291231744, 5898240, 1310720, 0, 176163648,
-4221630688, 188746944, 4221630688, 688130, 4292673536, 6684672, 0, 262144,
-176164160, 4230020000, 176164032, 4221630688, 720896, 4292411392, 5308416, 0,
-4294901760, 167774752, 4213242464, 167774752, 4230019936, 2148499470, 4292673536, 5373952,
-131072, 0, 169871936, 4230019936, 171969152, 4225825696, 2148630544, 4292542464,
-5308416, 393216, 0, 167774752, 4230019680, 169872000, 4230019936, 917517,
-4292804608, 5505024, 4294836224, 0, 176164160, 4230019296, 167774848, 4230019680,
-983052, 196608, 6160384, 4294574080, 0, 197135488, 14745504, 176163776,
-14680160, 2148761618, 4294770688, 5505024, 0, 655360, 176163968, 14745504,
-176163968, 4288741152, 2148794385, 4294246400, 5505024, 0, 524288, 176163712,
-4280352416, 176163712, 4271963616, 2149023766, 4293853184, 6029312, 0, 4294443008,
-176163712, 4259380448, 176163712, 4280352224, 1277973, 4293591040, 6553600, 0,
-4294836224, 205524096, 4250991840, 205524096, 4280352096, 2149154840, 4293459968, 6291456,
-131072, 0, 197135360, 4250991904, 201329728, 4250991904, 2149285914, 4293459968,
-6160384, 0, 131072, 197135424, 4250991904, 197135424, 4246797536, 2149318678,
-4293591040, 6160384, 4294836224, 0, 197135424, 4250991840, 192940992, 4250991840,
-2149384215, 4293591040, 6291456, 0, 4294836224, 192941120, 4250991840, 192941120,
-4280352096, 2149449752, 4293591040, 6422528, 4294705152, 0, 205524096, 4280351968,
-192941120, 4280351968, 1638421, 4294246400, 6029312, 262144, 0, 176163712,
-4280351968, 192941184, 4280351968, 1703956, 4294508544, 6029312, 0, 524288,
-176163968, 14745376, 176163968, 4280351968, 1769490, 4293591040, 5505024, 0,
-4294705152, 167774752, 4246797408, 167774848, 4255186272, 2149679136, 4294377472, 5242880,
-0, 262144, 167774848, 4280352480, 167774848, 4255186016, 1933343, 4294508544,
-5505024, 4294836224, 0, 176163968, 14744800, 167774848, 4280351840, 1966108,
-720896, 6029312, 0, 4294443008, 176163712, 23068896, 176163712, 44040544,
-2149875747, 1376256, 5505024, 0, 524288, 176163712, 60818080, 176163712,
-44040416, 2129954, 589824, 5505024, 0, 4294705152, 167774848, 18874592,
-167774784, 52429536, 2150006821, 1638400, 5373952, 131072, 0, 171969088,
-56623904, 171969152, 56623904, 2150137895, 1638400, 5505024, 0, 4294836224,
-167774848, 52429024, 171969152, 56623904, 2293794, 1900544, 5373952, 0,
-4294836224, 167774784, 60818272, 167774752, 77595616, 2150268969, 2424832, 5308416,
-0, 4294901760, 167774784, 77595488, 167774784, 94373088, 2150301733, 1769472,
-5505024, 0, 4294836224, 167774848, 56623328, 167774784, 94372704, 2490404,
-589824, 5505024, 4294836224, 0, 176163712, 60817632, 167774848, 94372064,
-2555937, 589824, 6291456, 131072, 0, 197135360, 23068960, 201329792,
-23068960, 2150531117, 589824, 6291456, 0, 4294836224, 197135488, 18874592,
-197135488, 23068960, 2719788, 720896, 6160384, 4294836224, 0, 197135488,
-23068896, 192940992, 23068896, 2150563882, 1638400, 6291456, 0, 4294836224,
-197135360, 52429152, 197135360, 56623904, 2150727728, 1769472, 6160384, 4294836224,
-0, 197135360, 56623456, 192940992, 56623776, 2150760492, 1769472, 6291456,
-0, 4294836224, 192941056, 56623456, 192941056, 60818272, 2150826029, 1638400,
-6291456, 131072, 0, 192941056, 60817760, 201329792, 60817760, 2150891566,
-720896, 6291456, 0, 4294836224, 192941184, 23068896, 192941184, 60817760,
-3080235, 458752, 6029312, 262144, 0, 167775104, 94372064, 192941184,
-60817632, 3145768, 458752, 5505024, 0, 4294705152, 167775360, 14744672,
-167775360, 94372064, 3211295, 4293591040, 6815744, 4294836224, 0, 218107392,
-4259380448, 209718528, 4250991904, 2151055413, 4294115328, 7208960, 0, 131072,
-230690304, 4284546656, 230690304, 4267769376, 2151252024, 4294115328, 7208960, 4294836224,
-0, 230690304, 4284546592, 218107328, 4284546592, 2151284788, 4293984256, 7340032,
-0, 4294836224, 218107392, 4263575008, 218107392, 4284546592, 3506231, 4293853184,
-7340032, 0, 4294443008, 209718784, 4259380448, 218107392, 4284546528, 3538995,
-720896, 7340032, 0, 4294836224, 230690304, 23068832, 230690304, 27263328,
-2151448635, 851968, 7208960, 4294836224, 0, 230690304, 27263136, 218107328,
-27263136, 2151481400, 1507328, 7208960, 0, 131072, 230690304, 52429536,
-230690304, 48234912, 2151645246, 1638400, 7208960, 4294836224, 0, 230690304,
-52429216, 218107328, 52429216, 2151678010, 1638400, 7340032, 0, 4294836224,
-218107392, 52429216, 218107392, 56623904, 2151743547, 851968, 7340032, 0,
-4294836224, 218107392, 27263136, 218107392, 56623520, 3932217, 65536, 6815744,
-4294836224, 0, 218107392, 10551136, 209718528, 2162656, 2151907394, 327680,
-6815744, 0, 524288, 218107392, 56623264, 209718784, 10551136, 4063293,
-4294639616, 7340032, 0, 4294443008, 209718784, 4284546272, 209718784, 56688480,
-4128823, 4294508544, 6553600, 393216, 0, 167775360, 94436448, 209718784,
-56687840, 4194354, 4292935680, 5373952, 0, 4294901760, 167775552, 4230019296,
-167775744, 94436448, 4259856, 1114112, 8257536, 0, 131072, 264245248,
-35652128, 264245248, 35652064, 2152104005, 983040, 8388608, 131072, 0,
-264245248, 35652064, 268439552, 35652064, 2152136771, 1114112, 8257536, 4294836224,
-0, 264245248, 35652064, 260050880, 35652064, 2152202308, 983040, 7995392,
-131072, 0, 255856448, 35652064, 255856512, 35652064, 2152431690, 1114112,
-7995392, 0, 131072, 255856512, 39846432, 255856512, 35652064, 4620361,
-1114112, 8126464, 4294836224, 0, 260050944, 35652064, 255856512, 39846368,
-4653125, 983040, 8388608, 0, 4294836224, 234885120, 31457440, 255856640,
-39846368, 4751428, 4293591040, 8257536, 4294836224, 0, 264245248, 4250991904,
-234885056, 4250991904, 2152562764, 4293459968, 8257536, 0, 131072, 234885120,
-4250991904, 234885120, 4246797536, 2152595530, 4293591040, 8388608, 0, 4294836224,
-234885120, 4250991840, 234885120, 4284546400, 2152661067, 4293459968, 8388608, 131072,
-0, 234885120, 4284546272, 268439616, 4271963360, 2152726604, 4294770688, 7864320,
-0, 393216, 251662240, 2162656, 251662272, 4288741216, 2153021523, 196608,
-8257536, 4294574080, 0, 264245248, 6356832, 251662272, 2162528, 5144658,
-196608, 8257536, 0, 4294574080, 251662336, 6356832, 251662336, 10485856,
-2153054287, 4294770688, 7864320, 131072, 0, 247467776, 10551136, 251662336,
-10551136, 5275729, 4294639616, 8388608, 655360, 0, 247468032, 10551136,
-268439552, 10551136, 2153119825, 4294901760, 7471104, 0, 131072, 239079040,
-2162656, 239079040, 4292935648, 2153349208, 65536, 7471104, 0, 131072,
-239079040, 2097184, 239079040, 2162656, 5472343, 4294901760, 7602176, 131072,
-0, 239079040, 2162656, 243273408, 10551136, 2153381972, 65536, 7471104,
-4294836224, 0, 239079104, 10551136, 234884672, 10551136, 2153447509, 327680,
-7733248, 4294311936, 0, 247468032, 10551136, 234884800, 10551136, 5636178,
-4294639616, 8388608, 0, 4294311936, 234885184, 4284546272, 234885120, 10551136,
-5701709, 327680, 7733248, 0, 655360, 234885120, 39846048, 234885184,
-10550496, 5767241, 851968, 8781824, 4294836224, 0, 281022720, 27263328,
-281022656, 27263328, 2153676893, 720896, 8912896, 0, 4294836224, 281022720,
-23068704, 281022720, 27263328, 5931100, 1114112, 8781824, 0, 131072,
-281022720, 35652128, 281022720, 35652064, 2153873504, 1114112, 8781824, 4294836224,
-0, 281022720, 35652064, 281022656, 35652064, 2153906268, 983040, 8912896,
-0, 4294836224, 281022720, 31457696, 281022720, 35652064, 6127711, 851968,
-8912896, 0, 4294836224, 281022720, 27263008, 281022720, 35652000, 6160475,
-589824, 9043968, 4294836224, 0, 289411456, 18874592, 289411392, 18874592,
-2154135652, 458752, 9175040, 0, 4294836224, 289411456, 14680288, 289411456,
-18874592, 6324323, 589824, 9175040, 0, 4294836224, 289411456, 18874592,
-289411456, 23068960, 2154168417, 851968, 9175040, 0, 4294836224, 289411456,
-27263328, 289411456, 39846304, 2154332263, 851968, 9043968, 4294836224, 0,
-289411456, 39846240, 285217088, 35651936, 2154365027, 720896, 9175040, 0,
-4294836224, 289411456, 23068896, 285217152, 39846240, 6553698, 720896, 8912896,
-131072, 0, 281022720, 35651616, 285217152, 39846112, 6619231, 327680,
-9568256, 4294836224, 0, 306188928, 10485856, 306188864, 10485856, 2154725485,
-327680, 9568256, 0, 131072, 306188928, 14680224, 306188928, 10485856,
-6783084, 327680, 9699328, 4294836224, 0, 310383360, 14680160, 306188928,
-14680160, 6848619, 196608, 9699328, 0, 4294836224, 297800448, 6291488,
-306189056, 14680160, 6914154, 589824, 9699328, 0, 4294836224, 306188928,
-18874592, 306188928, 18874656, 2154922096, 589824, 9699328, 4294836224, 0,
-310383360, 39846112, 306188928, 18874592, 7045231, 589824, 9568256, 4294836224,
-0, 306189056, 39846112, 293605952, 39846112, 2154954860, 458752, 9699328,
-0, 4294836224, 297800448, 14680096, 293606144, 39846112, 7143530, 458752,
-9175040, 131072, 0, 281022848, 39845920, 293606144, 39845920, 7209062,
-65536, 8781824, 4294836224, 0, 281022720, 2162656, 281022656, 2162656,
-2155118707, 4294901760, 8781824, 0, 131072, 281022720, 2162656, 281022720,
-4292935584, 2155151472, 4294770688, 9306112, 262144, 0, 285217216, 2162592,
-297800448, 2162592, 2155315318, 4294901760, 8912896, 131072, 0, 281022720,
-2162592, 285217536, 2162592, 7471217, 4294770688, 8781824, 4294836224, 0,
-281022720, 4288741216, 281022656, 4288741216, 2155577466, 4294639616, 8912896, 0,
-4294836224, 281022720, 4284546848, 281022720, 4288741216, 7635065, 4294508544, 8781824,
-4294705152, 0, 281022720, 4280352416, 272634048, 4280352416, 2155708540, 4294246400,
-8519680, 0, 262144, 272634112, 4280352416, 272634112, 4271963680, 2155741302,
-4294508544, 8781824, 0, 131072, 281022720, 4288741152, 272634112, 4280352288,
-7798901, 4294639616, 9175040, 0, 4294836224, 289411456, 4284546848, 289411456,
-4288741216, 2155905151, 4294639616, 9175040, 131072, 0, 289411456, 4288741152,
-293605824, 4288741152, 2155937913, 4294770688, 9043968, 4294836224, 0, 289411520,
-4288741152, 285217088, 4288741152, 2156003450, 4294508544, 9306112, 262144, 0,
-285217216, 4288741152, 306189056, 4288740768, 2156068987, 4294639616, 8912896, 131072,
-0, 272634112, 4288740896, 285217536, 4288740768, 8126584, 4293722112, 9568256,
-0, 4293918720, 272634624, 4255186208, 272634624, 4288740768, 8224888, 4294770688,
-8781824, 0, 131072, 281023232, 2162592, 272634624, 4288740640, 8257651,
-65536, 8781824, 0, 131072, 281023232, 39845920, 272634624, 2161952,
-8323183, 4293722112, 8519680, 262144, 0, 234885184, 39910624, 272634624,
-39910688, 8388697, 1507328, 8388608, 131072, 0, 264245248, 52429536,
-268440256, 52429536, 2156232836, 1638400, 8388608, 0, 4294836224, 264245952,
-52429536, 264245952, 56623904, 2156265602, 1638400, 8257536, 4294836224, 0,
-264245952, 56623840, 234885056, 56623840, 2156331139, 1507328, 9830400, 262144,
-0, 234885824, 56623840, 314577664, 56623840, 2156396676, 1507328, 9830400,
-0, 131072, 234885888, 56623840, 255857408, 48235168, 2156462213, 1376256,
-9043968, 4294836224, 0, 289411456, 44040800, 260051264, 44040800, 2156626058,
-1245184, 7995392, 131072, 0, 255856448, 44040800, 255856512, 44040800,
-2156757132, 1376256, 8126464, 4294836224, 0, 260051328, 44040800, 255856512,
-44040800, 8913031, 1245184, 9830400, 131072, 0, 301994688, 44040800,
-314577664, 44040800, 2156888206, 1245184, 9306112, 131072, 0, 293605824,
-44040800, 297800192, 44040800, 2157019280, 1376256, 9437184, 4294836224, 0,
-301994752, 44040800, 293605888, 44040800, 9109642, 1245184, 9175040, 131072,
-0, 255857024, 44040800, 293606144, 44040800, 9175177, 1376256, 9830400,
-0, 131072, 234885888, 56623776, 255857408, 44040800, 9240710, 1245184,
-9961472, 0, 4294836224, 234885888, 39910624, 234885888, 56623712, 9306241,
-4294639616, 7340032, 655360, 0, 167775744, 94435552, 234885888, 56687840,
-9371714, 4294574080, 393216, 0, 4294836224, 8388800, 4282449696, 8388800,
-4284546880, 2157150354, 393216, 393216, 0, 4294836224, 8388800, 12583072,
-8388800, 14680256, 2157281428, 327680, 262144, 0, 131072, 8388800,
-14680224, 8388800, 10551136, 2157314194, 4294639616, 393216, 0, 4294836224,
-8388800, 4284546848, 8388800, 14745440, 9633937, 4294770688, 524288, 4294836224,
-131072, 16777664, 10551136, 16777536, 4288741216, 2157478039, 327680, 655360,
-4294836224, 4294836224, 16777664, 10551136, 16777536, 10485856, 2157510805, 4294508544,
-655360, 262144, 262144, 16777664, 4292935456, 20971968, 4288741152, 2157674650,
-4294639616, 655360, 262144, 262144, 16777664, 10551136, 16777664, 4292935456,
-9896086, 196608, 917504, 262144, 4294705152, 16777664, 14680096, 20971968,
-14680160, 2157805724, 65536, 917504, 262144, 4294705152, 16777664, 10551072,
-16777664, 14680096, 10027160, 4294639616, 393216, 4294836224, 131072, 12583168,
-14745376, 12583168, 4284546848, 2157936798, 458752, 524288, 4294836224, 4294836224,
-12583168, 14745376, 12583168, 14680224, 2157969563, 196608, 524288, 4294574080,
-0, 16777664, 14745376, 12583168, 14745376, 10223770, 4294574080, 393216,
-65536, 0, 8388800, 14745376, 12583360, 14745376, 10289300, 4294443008,
-393216, 0, 4294836224, 8388800, 4278255328, 8388800, 4280352512, 2158133409,
-4294377472, 393216, 65536, 0, 8388800, 4280352480, 12583360, 4280352480,
-2158166175, 4294115328, 786432, 131072, 131072, 8389056, 4276158048, 25166272,
-4271963744, 2158330020, 4293722112, 786432, 4294836224, 131072, 25166272, 4255186272,
-8389056, 4255185504, 2158461094, 4293722112, 786432, 0, 4294443008, 8389056,
-4255185504, 8389056, 4267769248, 2158493858, 4294115328, 262144, 0, 524288,
-8389056, 4276158048, 8389056, 4267768416, 10682529, 4294377472, 262144, 0,
-131072, 8389056, 4280352480, 8389056, 4276157024, 10748064, 4294508544, 524288,
-0, 131072, 8389056, 14745376, 8389056, 4280351328, 10813598, 458752,
-4294705152, 4294836224, 0, 4286644160, 14680224, 4286644096, 14680224, 2158657705,
-327680, 4294836224, 131072, 0, 4286644160, 14680224, 4290773120, 14680224,
-2158690471, 196608, 262144, 0, 4294180864, 4278190208, 6356896, 4278190208,
-10485856, 2158854316, 327680, 4294705152, 0, 131072, 4286578816, 14680224,
-4278190208, 10551200, 11075752, 196608, 4294443008, 4294574080, 0, 4278190208,
-14745504, 4261478144, 14745504, 2158887082, 4294639616, 4294705152, 4294836224, 0,
-4286644160, 4284546848, 4261478272, 4284546848, 2159050927, 4294639616, 4294836224, 0,
-4294836224, 4261478336, 4284546848, 4261478336, 4288741216, 2159083692, 4294508544, 4294836224,
-131072, 0, 4261478336, 4288741152, 4290773120, 4288741152, 2159149229, 4294508544,
-4294705152, 0, 131072, 4261412992, 4288741152, 4261412992, 4280351328, 2159214766,
-4294770688, 4294443008, 0, 786432, 4261412992, 14745504, 4261412992, 4288739936,
-11468971, 4294639616, 262144, 4294901760, 0, 8389056, 14744160, 4261412992,
-14744160, 11534502, 524288, 393216, 0, 4294836224, 8388800, 16777440,
-8388800, 18874624, 2159378612, 524288, 393216, 65536, 0, 8388800,
-18874592, 12583360, 18874592, 2159411378, 720896, 917504, 131072, 4294836224,
-8389056, 27263264, 25166272, 27263328, 2159575223, 1376256, 917504, 4294836224,
-4294836224, 25166272, 44040800, 8389056, 94372448, 2159771834, 1245184, 786432,
-0, 4294443008, 8389056, 39846304, 8389056, 94372448, 11894969, 851968,
-786432, 0, 4294443008, 8389056, 27263264, 8389056, 94372256, 11927732,
-589824, 393216, 0, 4294836224, 8389056, 18874592, 8389056, 94372128,
-11993267, 589824, 262144, 4294901760, 0, 8389056, 94372064, 4261412992,
-94372064, 2159804600, 458752, 655360, 0, 4294836224, 4261413312, 14744160,
-4261413312, 94372064, 12124337, 65536, 1310720, 131072, 0, 33555072,
-14680096, 41943680, 6291488, 2159968445, 65536, 1048576, 0, 262144,
-33555072, 14680096, 33555200, 2162656, 2160001211, 458752, 1048576, 0,
-4294836224, 29360640, 14745568, 29360640, 18874592, 2160165056, 458752, 1048576,
-4294574080, 0, 33555200, 14745568, 29360640, 18939872, 12386492, 4294901760,
-1179648, 4294705152, 0, 37749504, 4292935520, 33555008, 4292935520, 2160361667,
-4294639616, 1179648, 0, 4294836224, 33555200, 4284546848, 33555200, 4292935520,
-12550338, 4294639616, 1048576, 4294836224, 0, 33555200, 4292935456, 29360640,
-4292935456, 2160394432, 4294770688, 1572864, 0, 131072, 50332480, 4288741280,
-50332480, 4288741152, 2160558278, 4294639616, 1835008, 0, 4294836224, 50332544,
-4284546848, 54526848, 4284546912, 2160689352, 4294508544, 1572864, 131072, 131072,
-50332480, 4288741152, 50332544, 4284546848, 12779714, 4294508544, 1572864, 262144,
-0, 29360896, 4292935456, 50332544, 4288741152, 12845249, 4294901760, 1179648,
-0, 393216, 29360896, 18939872, 29361024, 4292935456, 12910782, 4293328896,
-917504, 0, 655360, 29360896, 4246797536, 29361088, 4242603040, 2160951500,
-4293328896, 1572864, 4294574080, 393216, 50333056, 4280351776, 29361088, 4246797344,
-13074635, 4294246400, 917504, 0, 786432, 29361088, 4280352416, 29360960,
-4271963424, 2161082574, 4294508544, 1966080, 4294705152, 4294705152, 29361536, 4280351776,
-29361088, 4280352032, 13172936, 4292935680, 2883584, 0, 4294049792, 29361536,
-4230019680, 29361536, 4280351776, 13271242, 4294508544, 1048576, 0, 524288,
-29361024, 18939680, 29361536, 4280351328, 13304006, 4294508544, 3276800, 0,
-131072, 104859264, 4284546848, 104859264, 4280352480, 2161279185, 4294508544, 3407872,
-131072, 0, 104859264, 4284546784, 109053632, 4284546784, 2161311949, 4294508544,
-2883584, 131072, 0, 88081792, 4284546848, 92276288, 4284546848, 2161475796,
-4294508544, 2752512, 0, 131072, 88081984, 4284546848, 88081984, 4280352480,
-2161508559, 4294639616, 3276800, 4294836224, 0, 104859328, 4284546784, 88081984,
-4284546784, 13631694, 4294508544, 2359296, 131072, 0, 71304320, 4284546848,
-75498816, 4284546848, 2161672407, 4294639616, 2228224, 4294836224, 0, 71304512,
-4284546848, 67109952, 4284546848, 2161705170, 4294508544, 2228224, 0, 131072,
-67110208, 4284546848, 67110208, 4280352480, 2161770707, 4294639616, 2752512, 4294836224,
-0, 88082112, 4284546784, 67110208, 4284546784, 13893841, 4294639616, 3407872,
-0, 4294836224, 67110592, 4284546784, 67110592, 4288741216, 2161836245, 4294770688,
-2097152, 0, 1441792, 67110592, 6356896, 67110592, 4288741088, 14057680,
-4294574080, 1966080, 4294901760, 0, 62915584, 4282449696, 62915520, 4282449696,
-2162000092, 4294508544, 1966080, 0, 131072, 62915584, 4282449696, 62915584,
-4280352480, 2162032856, 4294639616, 1966080, 4294901760, 0, 62915584, 4284546880,
-62915520, 4284546880, 2162196703, 4294574080, 2097152, 0, 4294836224, 62915584,
-4282449632, 62915584, 4284546880, 14287065, 4294770688, 1703936, 262144, 0,
-50332480, 2162592, 54526848, 2162528, 2162458851, 65536, 1703936, 0,
-131072, 50332544, 6291488, 50332544, 2162528, 14450914, 4294901760, 1572864,
-262144, 0, 41943808, 6356960, 50332544, 6356832, 14516449, 65536,
-1835008, 0, 262144, 58721280, 6291488, 58721280, 2162656, 2162589925,
-4294705152, 1966080, 4294901760, 0, 62915584, 4286644064, 58721216, 4286644064,
-2162720999, 4294770688, 1966080, 4294901760, 0, 62915584, 4288741248, 58721216,
-4288741248, 2162917610, 4294770688, 1966080, 0, 131072, 58721280, 4292935584,
-58721280, 4288741248, 14778601, 4294705152, 2097152, 0, 4294836224, 58721280,
-4286644064, 58721280, 4292935552, 14811360, 4294901760, 1835008, 0, 262144,
-58721280, 6356960, 58721280, 4292935520, 14876895, 65536, 1835008, 131072,
-0, 41943936, 6356832, 58721280, 6356832, 14942430, 4294639616, 2097152,
-0, 4294836224, 62915584, 4284546784, 41944064, 6356832, 15007963, 65536,
-2097152, 4294836224, 0, 67110592, 6356704, 41944064, 6356704, 15073495,
-327680, 1703936, 0, 131072, 50332544, 14680224, 54526848, 10485920,
-2163179758, 327680, 1703936, 131072, 4294836224, 46138176, 14680160, 50332544,
-14680224, 15237357, 196608, 1441792, 262144, 0, 33555136, 14680160,
-46138240, 14680160, 15302892, 720896, 1703936, 0, 4294180864, 29361088,
-23068896, 29360960, 48234848, 2163310832, 1638400, 1572864, 0, 4294311936,
-29360896, 52429536, 29361088, 65012512, 2163507443, 2031616, 1966080, 4294574080,
-4294574080, 50333056, 65011936, 29361088, 65012448, 15499506, 458752, 1966080,
-262144, 4294705152, 29361088, 48234720, 29361536, 65011936, 15532267, 2031616,
-2883584, 0, 4294049792, 29361536, 65011936, 29361536, 94372832, 2163540206,
-458752, 1441792, 0, 4294574080, 33555328, 14680160, 29361536, 94372064,
-15663338, 327680, 3407872, 131072, 0, 104859264, 14680224, 109053632,
-14680224, 2163704054, 327680, 3276800, 0, 131072, 104859328, 14680224,
-104859328, 10485856, 2163736817, 327680, 2883584, 131072, 0, 88081792,
-14680224, 92276288, 14680224, 2163900665, 327680, 2752512, 0, 131072,
-88081984, 14680224, 88081984, 10485856, 2163933427, 458752, 3276800, 4294836224,
-0, 104859328, 14680160, 88081984, 14680160, 15991026, 327680, 2359296,
-131072, 0, 71304320, 14680224, 75498816, 14680224, 2164097276, 458752,
-2228224, 4294836224, 0, 71304512, 14680224, 67109952, 14680224, 2164130038,
-327680, 2228224, 0, 131072, 67110208, 14680224, 67110208, 10485856,
-2164195575, 458752, 2752512, 4294836224, 0, 88082112, 14680160, 67110208,
-14680160, 16253173, 458752, 2359296, 0, 4294836224, 67110592, 14680160,
-67110592, 18874592, 2164261113, 458752, 2097152, 0, 4294836224, 58721280,
-14680160, 62915584, 18874592, 2164490498, 196608, 1835008, 131072, 0,
-54526848, 10485856, 58721280, 18874464, 16482561, 458752, 2097152, 4294705152,
-0, 67110592, 18874464, 54526976, 18874464, 16515322, 589824, 2097152,
-786432, 786432, 29361536, 94371936, 54527680, 18874464, 16580848, 196608,
-1441792, 0, 4294836224, 41944768, 6356704, 29361856, 94371936, 16646375,
-4293591040, 2883584, 786432, 4294180864, 29361536, 18938464, 29361856, 94437088,
-16711884, 4294901760, 917504, 131072, 0, 4261413312, 94435936, 29361856,
-94435936, 16777402, 4291624960, 4718592, 0, 262144, 150997504, 4196465056,
-159386112, 4188076384, 2164621572, 4291887104, 4849664, 1703936, 0, 150997312,
-4250991136, 155191808, 4250991136, 2164752646, 4291887104, 5242880, 0, 4294574080,
-150997504, 4196464992, 150997504, 4250991136, 16974082, 4293984256, 4980736, 4294836224,
-0, 159386112, 4263574880, 150997376, 4259380576, 2164883720, 4293591040, 5242880,
-0, 4294574080, 150997504, 4250990944, 150997504, 4263574880, 17105156, 65536,
-4849664, 0, 131072, 155191680, 18874400, 155191680, 2162656, 2165145868,
-4294901760, 4849664, 131072, 0, 142608704, 18939872, 155191680, 18939872,
-17269003, 4294901760, 4849664, 0, 131072, 142608768, 18939872, 142608768,
-4292935392, 2165178632, 65536, 4980736, 4294836224, 0, 159386048, 18939616,
-142608768, 18939616, 17400074, 4294377472, 4456448, 0, 655360, 142608832,
-18939616, 142608832, 4276158112, 2165244170, 589824, 4456448, 4293787648, 0,
-142608832, 18939552, 138414208, 18939552, 2165309707, 4294246400, 4325376, 0,
-655360, 138414528, 18939552, 159386048, 4271963744, 2165375244, 327680, 5111808,
-0, 131072, 163580416, 18874528, 163580416, 6356896, 2165604627, 4294639616,
-5242880, 0, 4294836224, 163580416, 4284546656, 163580416, 18939808, 17727762,
-4294639616, 5111808, 131072, 0, 138414528, 18939488, 163580416, 18939488,
-17760525, 720896, 4980736, 0, 4294311936, 138414592, 23068960, 159386112,
-27263328, 2165735701, 589824, 5111808, 0, 4294311936, 138414592, 18939488,
-138414592, 27263264, 17891600, 65536, 3801088, 4294836224, 0, 121636928,
-10551136, 113248064, 2162656, 2165866775, 4294639616, 4325376, 4294574080, 0,
-138414592, 27328096, 113248320, 10551136, 18022674, 1376256, 4849664, 1703936,
-0, 150997312, 98566816, 155191808, 98566816, 2165997849, 3342336, 4980736,
-0, 4294705152, 150997504, 106956256, 159386112, 111150688, 2166128923, 3080192,
-5242880, 0, 4294574080, 150997504, 98566816, 150997504, 111150560, 18219285,
-1114112, 4980736, 4294836224, 0, 159386112, 44040672, 150997376, 44040736,
-2166259997, 1376256, 4849664, 0, 393216, 150997504, 111149728, 150997504,
-44040672, 18350359, 851968, 5242880, 0, 4294705152, 113248768, 27328096,
-150997504, 111149536, 18415892, 4293984256, 5242880, 0, 4294705152, 150997504,
-4263573856, 113248768, 111214176, 18481414, 4294770688, 3538944, 131072, 0,
-4261414592, 94435936, 113248768, 111212896, 18546945, 4293722112, 5242880, 4294836224,
-0, 167777024, 94435552, 4261415424, 111212896, 18612368};
-
-void loadMap_mercury_WAD(WAD::LevelData& dstLevel) {
-	// Load vertex data
-	dstLevel.vertices = (const WAD::Vertex*)mercury_WADVertices;
-
-	// Load line defs
-	dstLevel.lineDefs = (const WAD::LineDef*)mercury_WADLineDefs;
-
-	// Load side defs
-	dstLevel.sideDefs = (const WAD::SideDef*)mercury_WADSideDefs;
-
-	// Load subsectors defs
-	dstLevel.subSectors = (const WAD::SubSector*)mercury_WADSubSectors;
-
-	// Load segments defs
-	dstLevel.segments = (const WAD::Seg*)mercury_WADSegments;
-
-	// Load sectors defs
-	dstLevel.sectors = (const WAD::Sector*)mercury_WADSectors;
-
-	// Load nodes
-	dstLevel.numNodes = (mercury_WADNodesSize * 4) / sizeof(WAD::Node);
-	dstLevel.nodes = (const WAD::Node*)mercury_WADNodes;
-}
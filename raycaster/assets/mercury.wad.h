@@ -1,28 +1,31 @@
 #pragma once
 #include <cstdint>
-#include <base.h>
+#include <assetArchive.h>
 #include <WAD.h>
 
-constexpr uint32_t mercury_WADVerticesSize = 1040;
-extern const uint32_t mercury_WADVertices[];
-
-constexpr uint32_t mercury_WADLineDefsSize = 1782;
-extern const uint32_t mercury_WADLineDefs[];
-
-constexpr uint32_t mercury_WADSideDefsSize = 6308;
-extern const uint32_t mercury_WADSideDefs[];
-
-constexpr uint32_t mercury_WADSegmentsSize = 2772;
-extern const uint32_t mercury_WADSegments[];
-
-constexpr uint32_t mercury_WADSubSectorsSize = 287;
-extern const uint32_t mercury_WADSubSectors[];
-
-constexpr uint32_t mercury_WADSectorsSize = 663;
-extern const uint32_t mercury_WADSectors[];
-
-constexpr uint32_t mercury_WADNodesSize = 2574;
-extern const uint32_t mercury_WADNodes[];
-
-void loadMap_mercury_WAD(WAD::LevelData& dstLevel);
-
+// Linked in from mercury.wad.s on GBA. Other platforms should map mercury.wad.bin instead.
+extern "C" const uint32_t mercury_WADArchive[];
+
+// Space needed in work RAM for the compressed lumps
+constexpr uint32_t mercury_WADUnpackedSize = 0;
+
+inline bool loadMap_mercury_WAD(const assets::Archive& archive, WAD::LevelData& dstLevel, uint8_t* unpackBuffer = nullptr)
+{
+	dstLevel.vertices = archive.load<WAD::PackedVertex>("mercury_WADVertices", unpackBuffer);
+	dstLevel.lineDefs = archive.load<WAD::LineDef>("mercury_WADLineDefs", dstLevel.numLineDefs, unpackBuffer);
+	dstLevel.sideDefs = archive.load<WAD::SideDef>("mercury_WADSideDefs", unpackBuffer);
+	dstLevel.subSectors = archive.load<WAD::SubSector>("mercury_WADSubSectors", unpackBuffer);
+	dstLevel.segments = archive.load<WAD::Seg>("mercury_WADSegments", unpackBuffer);
+	dstLevel.sectors = archive.load<WAD::Sector>("mercury_WADSectors", unpackBuffer);
+	dstLevel.nodes = archive.load<WAD::Node>("mercury_WADNodes", dstLevel.numNodes, unpackBuffer);
+	dstLevel.segLights = archive.load<uint8_t>("mercury_WADSegLights", unpackBuffer);
+	dstLevel.segVertices = archive.load<uint16_t>("mercury_WADSegVertices", unpackBuffer);
+	dstLevel.segFrontSectors = archive.load<uint8_t>("mercury_WADSegFrontSectors", unpackBuffer);
+	dstLevel.segBackSectors = archive.load<uint8_t>("mercury_WADSegBackSectors", unpackBuffer);
+	dstLevel.segFlags = archive.load<uint8_t>("mercury_WADSegFlags", unpackBuffer);
+	dstLevel.blockMap = archive.load<uint16_t>("mercury_WADBlockMap", unpackBuffer);
+	return dstLevel.vertices && dstLevel.lineDefs && dstLevel.sideDefs && dstLevel.subSectors
+		&& dstLevel.segments && dstLevel.sectors && dstLevel.nodes
+		&& dstLevel.segVertices && dstLevel.segFrontSectors && dstLevel.segBackSectors && dstLevel.segFlags
+		&& dstLevel.segLights && dstLevel.blockMap;
+}
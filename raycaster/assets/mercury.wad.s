@@ -0,0 +1,5 @@
+	.section .rodata
+	.align 2
+	.global mercury_WADArchive
+mercury_WADArchive:
+	.incbin "mercury.wad.bin"
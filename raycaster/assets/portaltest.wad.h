@@ -1,28 +1,31 @@
 #pragma once
 #include <cstdint>
-#include <base.h>
+#include <assetArchive.h>
 #include <WAD.h>
 
-constexpr uint32_t portaltest_WADVerticesSize = 144;
-extern const uint32_t portaltest_WADVertices[];
-
-constexpr uint32_t portaltest_WADLineDefsSize = 242;
-extern const uint32_t portaltest_WADLineDefs[];
-
-constexpr uint32_t portaltest_WADSideDefsSize = 728;
-extern const uint32_t portaltest_WADSideDefs[];
-
-constexpr uint32_t portaltest_WADSegmentsSize = 318;
-extern const uint32_t portaltest_WADSegments[];
-
-constexpr uint32_t portaltest_WADSubSectorsSize = 29;
-extern const uint32_t portaltest_WADSubSectors[];
-
-constexpr uint32_t portaltest_WADSectorsSize = 52;
-extern const uint32_t portaltest_WADSectors[];
-
-constexpr uint32_t portaltest_WADNodesSize = 252;
-extern const uint32_t portaltest_WADNodes[];
-
-void loadMap_portaltest_WAD(WAD::LevelData& dstLevel);
-
+// Linked in from portaltest.wad.s on GBA. Other platforms should map portaltest.wad.bin instead.
+extern "C" const uint32_t portaltest_WADArchive[];
+
+// Space needed in work RAM for the compressed lumps
+constexpr uint32_t portaltest_WADUnpackedSize = 0;
+
+inline bool loadMap_portaltest_WAD(const assets::Archive& archive, WAD::LevelData& dstLevel, uint8_t* unpackBuffer = nullptr)
+{
+	dstLevel.vertices = archive.load<WAD::PackedVertex>("portaltest_WADVertices", unpackBuffer);
+	dstLevel.lineDefs = archive.load<WAD::LineDef>("portaltest_WADLineDefs", dstLevel.numLineDefs, unpackBuffer);
+	dstLevel.sideDefs = archive.load<WAD::SideDef>("portaltest_WADSideDefs", unpackBuffer);
+	dstLevel.subSectors = archive.load<WAD::SubSector>("portaltest_WADSubSectors", unpackBuffer);
+	dstLevel.segments = archive.load<WAD::Seg>("portaltest_WADSegments", unpackBuffer);
+	dstLevel.sectors = archive.load<WAD::Sector>("portaltest_WADSectors", unpackBuffer);
+	dstLevel.nodes = archive.load<WAD::Node>("portaltest_WADNodes", dstLevel.numNodes, unpackBuffer);
+	dstLevel.segLights = archive.load<uint8_t>("portaltest_WADSegLights", unpackBuffer);
+	dstLevel.segVertices = archive.load<uint16_t>("portaltest_WADSegVertices", unpackBuffer);
+	dstLevel.segFrontSectors = archive.load<uint8_t>("portaltest_WADSegFrontSectors", unpackBuffer);
+	dstLevel.segBackSectors = archive.load<uint8_t>("portaltest_WADSegBackSectors", unpackBuffer);
+	dstLevel.segFlags = archive.load<uint8_t>("portaltest_WADSegFlags", unpackBuffer);
+	dstLevel.blockMap = archive.load<uint16_t>("portaltest_WADBlockMap", unpackBuffer);
+	return dstLevel.vertices && dstLevel.lineDefs && dstLevel.sideDefs && dstLevel.subSectors
+		&& dstLevel.segments && dstLevel.sectors && dstLevel.nodes
+		&& dstLevel.segVertices && dstLevel.segFrontSectors && dstLevel.segBackSectors && dstLevel.segFlags
+		&& dstLevel.segLights && dstLevel.blockMap;
+}
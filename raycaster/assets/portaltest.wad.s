@@ -0,0 +1,5 @@
+	.section .rodata
+	.align 2
+	.global portaltest_WADArchive
+portaltest_WADArchive:
+	.incbin "portaltest.wad.bin"
@@ -1,102 +0,0 @@
-#include "C:\repos\GBA\raycaster\assets\test.wad.h"
-
-extern const uint32_t test_WADVertices[48] = {
-4294868992, 327680, 32768, 327680, 98304, 262144, 98304, 4294836224,
-32768, 4294770688, 4294737920, 4294770688, 4294672384, 4294836224, 4294672384, 262144,
-4294737920, 327680, 4294868992, 262144, 4294803456, 196608, 4294868992, 131072,
-4294934528, 196608, 4294803456, 4294770688, 4294803456, 4294639616, 4294934528, 4294639616,
-4294934528, 4294770688, 98304, 131072, 294912, 131072, 294912, 4294901760,
-98304, 4294901760, 4294705152, 294912, 4294934528, 327680, 98304, 65536};
-extern const uint32_t test_WADLineDefs[81] = {
-65536, 1, 0, 131071, 65538, 0, 4294901761, 1114114,
-1, 131072, 262143, 65540, 0, 4294901763, 1048580, 1,
-262144, 393215, 65542, 0, 4294901765, 458758, 1, 393216,
-524287, 65544, 0, 4294901767, 8, 1, 524288, 655359,
-262154, 0, 655369, 720906, 4, 720896, 720908, 262156,
-0, 917517, 589836, 4, 983040, 917520, 65549, 0,
-4294901777, 917519, 1, 1179648, 1114111, 65551, 0, 4294901779,
-851984, 4, 1310720, 851989, 65541, 0, 4294901782, 1179665,
-1, 1507328, 1245183, 65555, 0, 4294901784, 1310739, 1,
-1638400, 1179647, 262164, 0, 1769498, 196628, 1, 1835008,
-65535};
-extern const uint32_t test_WADSideDefs[218] = {
-0, 45, 0, 45, 0, 1380013139, 827212116, 0,
-2949120, 0, 2949120, 0, 1414725632, 1096045121, 12622, 0,
-45, 0, 45, 0, 1380013139, 827212116, 0, 2949120,
-0, 2949120, 0, 1414725632, 1096045121, 12622, 0, 45,
-0, 45, 0, 1380013139, 827212116, 0, 2949120, 0,
-2949120, 0, 1414725632, 1096045121, 12622, 0, 45, 0,
-45, 0, 1380013139, 827212116, 0, 2949120, 0, 2949120,
-0, 1414725632, 1096045121, 12622, 0, 45, 0, 45,
-0, 1380013139, 827212116, 0, 2949120, 0, 2949120, 0,
-2949120, 0, 0, 0, 45, 0, 45, 0,
-45, 0, 2, 2949120, 0, 2949120, 0, 2949120,
-0, 0, 0, 45, 0, 45, 0, 45,
-0, 2, 2949120, 0, 2949120, 0, 2949120, 0,
-0, 0, 45, 0, 45, 0, 45, 0,
-2, 2949120, 0, 2949120, 0, 2949120, 0, 0,
-0, 45, 0, 45, 0, 45, 0, 2,
-2949120, 0, 2949120, 0, 1414725632, 1096045121, 78158, 0,
-45, 0, 45, 0, 1380013139, 827212116, 1, 2949120,
-0, 2949120, 0, 1414725632, 1096045121, 78158, 32, 45,
-0, 45, 0, 45, 0, 0, 2949120, 0,
-2949120, 0, 2949120, 0, 65536, 96, 45, 0,
-45, 0, 1380013139, 827212116, 0, 2949120, 0, 2949120,
-0, 1414725632, 1096045121, 209230, 0, 45, 0, 45,
-0, 1380013139, 827212116, 3, 2949120, 0, 2949120, 0,
-1414725632, 1096045121, 209230, 64, 45, 0, 45, 0,
-45, 0, 0, 2949120, 0, 2949120, 0, 2949120,
-0, 196608, 160, 45, 0, 45, 0, 1380013139,
-827212116, 0};
-extern const uint32_t test_WADSegments[96] = {
-262147, 237568, 0, 1048580, 294912, 0, 393221, 352256,
-0, 458758, 409600, 0, 1376263, 466944, 0, 720906,
-712704, 0, 851984, 1081344, 0, 327693, 1146880, 0,
-196628, 1490944, 0, 1441792, 0, 0, 524309, 466944,
-1507328, 8, 524288, 0, 655369, 630784, 0, 65558,
-0, 2097152, 131073, 122880, 0, 1114114, 180224, 0,
-589836, 811008, 0, 1507345, 1425408, 0, 786443, 729088,
-0, 1310743, 1425408, 2097152, 589834, 598016, 1, 655371,
-679936, 1, 720908, 761856, 1, 786441, 843776, 1,
-851982, 868352, 0, 917519, 950272, 0, 983056, 1032192,
-0, 1048589, 1048576, 1, 1179665, 1179648, 0, 1245202,
-1294336, 0, 1310739, 1343488, 0, 1114132, 1392640, 1};
-extern const uint32_t test_WADSubSectors[7] = {
-9, 589828, 851973, 1179650, 1310724, 1572868, 1835012};
-extern const uint32_t test_WADSectors[26] = {
-62914560, 1330596934, 828321874, 1279870275, 3235633, 192, 20971520, 1279656896,
-810700623, 1162031455, 1597066313, 12582961, 0, 41943360, 1330596934, 828321874,
-1279870275, 3235633, 128, 0, 1279656896, 810700623, 1162031455, 1597066313,
-12582961, 0};
-extern const uint32_t test_WADNodes[54] = {
-4294868992, 131072, 65536, 65536, 4290773056, 6291456, 2097248, 2162656,
-2147778563, 4294934528, 196608, 4294901760, 65536, 128, 6291456, 4290773088,
-6356960, 32770, 4294868992, 262144, 4294901760, 4294901760, 4194432, 2162608,
-4290773120, 6356960, 98305, 4294803456, 196608, 65536, 4294901760, 4286578800,
-6356896, 4290773120, 6356912, 163840, 32768, 4294770688, 4294901760, 0,
-4286578816, 6356896, 4282449792, 2162656, 2147811331, 98304, 262144, 0,
-4294836224, 4282384512, 6356896, 4290773024, 12583008, 2147876868};
-
-void loadMap_test_WAD(WAD::LevelData& dstLevel) {
-	// Load vertex data
-	dstLevel.vertices = (const WAD::Vertex*)test_WADVertices;
-
-	// Load line defs
-	dstLevel.lineDefs = (const WAD::LineDef*)test_WADLineDefs;
-
-	// Load side defs
-	dstLevel.sideDefs = (const WAD::SideDef*)test_WADSideDefs;
-
-	// Load subsectors defs
-	dstLevel.subSectors = (const WAD::SubSector*)test_WADSubSectors;
-
-	// Load segments defs
-	dstLevel.segments = (const WAD::Seg*)test_WADSegments;
-
-	// Load sectors defs
-	dstLevel.sectors = (const WAD::Sector*)test_WADSectors;
-
-	// Load nodes
-	dstLevel.numNodes = (test_WADNodesSize * 4) / sizeof(WAD::Node);
-	dstLevel.nodes = (const WAD::Node*)test_WADNodes;
-}
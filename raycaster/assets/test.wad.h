@@ -1,28 +1,31 @@
 #pragma once
 #include <cstdint>
-#include <base.h>
+#include <assetArchive.h>
 #include <WAD.h>
 
-constexpr uint32_t test_WADVerticesSize = 48;
-extern const uint32_t test_WADVertices[];
-
-constexpr uint32_t test_WADLineDefsSize = 81;
-extern const uint32_t test_WADLineDefs[];
-
-constexpr uint32_t test_WADSideDefsSize = 218;
-extern const uint32_t test_WADSideDefs[];
-
-constexpr uint32_t test_WADSegmentsSize = 96;
-extern const uint32_t test_WADSegments[];
-
-constexpr uint32_t test_WADSubSectorsSize = 7;
-extern const uint32_t test_WADSubSectors[];
-
-constexpr uint32_t test_WADSectorsSize = 26;
-extern const uint32_t test_WADSectors[];
-
-constexpr uint32_t test_WADNodesSize = 54;
-extern const uint32_t test_WADNodes[];
-
-void loadMap_test_WAD(WAD::LevelData& dstLevel);
-
+// Linked in from test.wad.s on GBA. Other platforms should map test.wad.bin instead.
+extern "C" const uint32_t test_WADArchive[];
+
+// Space needed in work RAM for the compressed lumps
+constexpr uint32_t test_WADUnpackedSize = 0;
+
+inline bool loadMap_test_WAD(const assets::Archive& archive, WAD::LevelData& dstLevel, uint8_t* unpackBuffer = nullptr)
+{
+	dstLevel.vertices = archive.load<WAD::PackedVertex>("test_WADVertices", unpackBuffer);
+	dstLevel.lineDefs = archive.load<WAD::LineDef>("test_WADLineDefs", dstLevel.numLineDefs, unpackBuffer);
+	dstLevel.sideDefs = archive.load<WAD::SideDef>("test_WADSideDefs", unpackBuffer);
+	dstLevel.subSectors = archive.load<WAD::SubSector>("test_WADSubSectors", unpackBuffer);
+	dstLevel.segments = archive.load<WAD::Seg>("test_WADSegments", unpackBuffer);
+	dstLevel.sectors = archive.load<WAD::Sector>("test_WADSectors", unpackBuffer);
+	dstLevel.nodes = archive.load<WAD::Node>("test_WADNodes", dstLevel.numNodes, unpackBuffer);
+	dstLevel.segLights = archive.load<uint8_t>("test_WADSegLights", unpackBuffer);
+	dstLevel.segVertices = archive.load<uint16_t>("test_WADSegVertices", unpackBuffer);
+	dstLevel.segFrontSectors = archive.load<uint8_t>("test_WADSegFrontSectors", unpackBuffer);
+	dstLevel.segBackSectors = archive.load<uint8_t>("test_WADSegBackSectors", unpackBuffer);
+	dstLevel.segFlags = archive.load<uint8_t>("test_WADSegFlags", unpackBuffer);
+	dstLevel.blockMap = archive.load<uint16_t>("test_WADBlockMap", unpackBuffer);
+	return dstLevel.vertices && dstLevel.lineDefs && dstLevel.sideDefs && dstLevel.subSectors
+		&& dstLevel.segments && dstLevel.sectors && dstLevel.nodes
+		&& dstLevel.segVertices && dstLevel.segFrontSectors && dstLevel.segBackSectors && dstLevel.segFlags
+		&& dstLevel.segLights && dstLevel.blockMap;
+}
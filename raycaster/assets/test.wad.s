@@ -0,0 +1,5 @@
+	.section .rodata
+	.align 2
+	.global test_WADArchive
+test_WADArchive:
+	.incbin "test.wad.bin"
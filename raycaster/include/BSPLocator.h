@@ -0,0 +1,54 @@
+#pragma once
+
+#include <WAD.h>
+
+// Which side of a node's splitting plane a point is on.
+// 0 is the front (right hand) side, and 1 the back.
+inline int32_t side(const WAD::Plane& plane, const math::intp16& x, const math::intp16& y)
+{
+	// Planes are stored 16 bit. Widen them here, after the loads.
+	auto origin = plane.origin.unpack();
+	auto dir = plane.dir.unpack();
+	math::intp16 relX = x - origin.m_x;
+	math::intp16 relY = y - origin.m_y;
+
+	auto cross = relX * dir.m_y - relY * dir.m_x;
+	// We just care about the sign, so ignore the shift
+	return cross.raw > 0 ? 0 : 1;
+}
+
+// Finds the BSP leaf (subsector) that contains a point, reusing the result of the previous query.
+// The locator keeps the path from the root to the last leaf, and a radius around the last full check
+// in which no plane along that path can be crossed. Queries inside that radius are free. Otherwise, the
+// path is checked top down and re-walked from the first node whose side changed. Nodes below the one
+// that changed are meaningless on the new side, so the walk can't start any deeper than that.
+class BSPLocator
+{
+public:
+	// Returns the index of the subsector containing (x,y)
+	uint16_t update(const WAD::LevelData& level, const math::intp16& x, const math::intp16& y);
+
+	uint16_t subsector() const { return m_leaf; }
+	// Sector the last located point belongs to
+	const WAD::Sector& sector(const WAD::LevelData& level) const;
+
+	// Forget the cached path, e.g. after loading a new level
+	void reset() { m_level = nullptr; }
+
+private:
+	static constexpr uint32_t kMaxDepth = 32;
+	static constexpr uint16_t kLeafMask = (1 << 15);
+
+	// Conservative distance from a point to a plane.
+	// Uses |dx|+|dy| >= |dir|, so it never overestimates.
+	static math::intp16 distanceBound(const WAD::Plane& plane, const math::intp16& x, const math::intp16& y);
+
+	const WAD::LevelData* m_level = nullptr;
+	uint16_t m_path[kMaxDepth + 1]; // Nodes from the root, with the leaf last
+	uint8_t m_sides[kMaxDepth];
+	uint32_t m_depth = 0;
+	uint16_t m_leaf = 0;
+
+	math::Vec2p16 m_anchor; // Position of the last full check
+	math::intp16 m_safeRadius; // Manhattan distance the point can move from m_anchor without crossing any plane in the path
+};
@@ -8,6 +8,10 @@
 #include <vector.h>
 #include <Color.h>
 #include <WAD.h>
+#include <BSPLocator.h>
+#include <interlace.h>
+#include <mesh.h>
+#include <mipTexture.h>
 
 #ifdef GBA
 extern "C" {
@@ -50,6 +54,39 @@ public:
         uint8_t bottom[kMaxWidth];
     };
 
+    // Two sided line with a middle texture.
+    // Recorded during the front to back traversal, and drawn back to front once the world is done.
+    struct MaskedSeg
+    {
+        math::Vec2p16 ndcA;
+        math::Vec2p16 ndcB;
+        math::intp16 bottomH; // Opening between both sectors, relative to the camera
+        math::intp16 topH;
+        int16_t x0, x1; // Unclipped screen range, used for interpolation
+        int16_t clipBegin, clipEnd; // Columns with a clip window in the pool
+        uint16_t clipOffset; // Start of this seg's clip window in the clip pool
+        uint16_t order; // Position in the traversal, shared with meshes
+        Color clr;
+    };
+
+    // Mesh placed in the level.
+    // Meshes are drawn along with masked segs, clipped by whatever was in front of them when traversal reached their subsector.
+    struct MeshInstance
+    {
+        const Mesh* mesh;
+        math::Vec3p16 pos;
+        uint16_t subsector;
+    };
+
+    // Projected mesh waiting to be drawn, with the clip window it had when traversal reached it.
+    struct VisibleMesh
+    {
+        uint16_t instance;
+        int16_t clipBegin, clipEnd;
+        uint16_t clipOffset;
+        uint16_t order;
+    };
+
     static void Merge(VisPlane& dst, const VisPlane& src);
     static bool CanMerge(const VisPlane& a, const VisPlane& b);
 
@@ -58,8 +95,20 @@ public:
     static bool BeginFrame();
     static void EndFrame();
 
+    // Places a mesh at (x,y), with pos.z relative to the floor below it. Returns false when there is no room left.
+    static bool AddMesh(const WAD::LevelData& level, const Mesh& mesh, const math::Vec3p16& pos);
+    static void ClearMeshes();
+
     static inline Color skyClr = BasicColor::SkyBlue;
     static inline Color groundClr = BasicColor::DarkGrey;
+    static inline Color ceilingClr = BasicColor::DarkGrey;
+
+    // Texture for solid walls, shaded by the baked lights. Init sets it.
+    static inline const MipTexture* wallTexture = nullptr;
+    static constexpr uint32_t kWallTexelsPerUnit = 32; // One texel per doom unit
+
+    // Renders half of the columns per frame during slow camera motion
+    static inline InterlaceController interlace;
 
 private:
     inline static DisplayMode displayMode;
@@ -70,21 +119,32 @@ private:
         uint8_t ceilingClip[DisplayMode::Width];
 
         void Clear();
+        void Clear(int32_t parity); // Closes the columns of the other parity
     };
 
-    static bool clipWall(const math::Vec2p16& v0, const math::Vec2p16& v1, math::unorm16 camAngle, math::Vec2p16& ndcA, math::Vec2p16& ndcB);
-    static bool clipSegment(const Pose& view, const WAD::Vertex* vertices, const WAD::Seg& segment, math::Vec2p16& ndcA, math::Vec2p16& ndcB);
+    static bool clipWall(const math::Vec2p16& v0, const math::Vec2p16& v1, math::unorm16 camAngle, math::Vec2p16& ndcA, math::Vec2p16& ndcB, math::Vec2p16& texU);
+    static bool clipSegment(const Pose& view, const WAD::LevelData& level, uint32_t segIndex, math::Vec2p16& ndcA, math::Vec2p16& ndcB, math::Vec2p16& texU);
     static bool clipSolidRanges(math::intp16& first, math::intp16& last);
-    static void RenderSubsector(const WAD::LevelData& level, uint16_t ssIndex, const Pose& view, DepthBuffer& depthBuffer);
-    static void RenderBSPNode(const WAD::LevelData& level, uint16_t nodeIndex, const Pose& view, DepthBuffer& depthBuffer);
+    static bool RenderSubsector(const WAD::LevelData& level, uint16_t ssIndex, const Pose& view, DepthBuffer& depthBuffer);
+    static bool RenderBSPNode(const WAD::LevelData& level, uint16_t nodeIndex, const Pose& view, DepthBuffer& depthBuffer);
     static void RenderWall(
-        const math::Vec2p16& ndcA, const math::Vec2p16& ndcB,
+        const math::Vec2p16& ndcA, const math::Vec2p16& ndcB, const math::Vec2p16& texU,
         const math::intp16& floorH, const math::intp16& ceilingH,
-        Color ceilColr, Color gndClr, const math::intp16& lightLevel,
+        Color ceilColr, Color gndClr, const math::intp16& lightLevelA, const math::intp16& lightLevelB,
         DepthBuffer& depthBuffer);
     static void RenderPortal(const Pose& view,
         const math::Vec2p16& ndcA, const math::Vec2p16& ndcB,
         const math::intp16& floorH, const math::intp16& ceilingH,
         const WAD::Sector& backSector,
         Color ceilColr, Color gndClr, Color clr, DepthBuffer& depthBuffer);
+    static void RecordMaskedSeg(const Pose& view,
+        const math::Vec2p16& ndcA, const math::Vec2p16& ndcB,
+        const math::intp16& floorH, const math::intp16& ceilingH,
+        const WAD::Sector& backSector, Color clr, const DepthBuffer& depthBuffer);
+    static void ProjectMeshes(const Pose& view);
+    static bool RecordMeshes(uint16_t ssIndex, const DepthBuffer& depthBuffer);
+    static void RenderMaskedSeg(const MaskedSeg& seg);
+    static void RenderMesh(const VisibleMesh& visibleMesh);
+    static void RenderDeferred();
+    static void FillFlats(const DepthBuffer& depthBuffer);
 };
\ No newline at end of file
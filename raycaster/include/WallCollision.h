@@ -0,0 +1,29 @@
+#pragma once
+
+#include <WAD.h>
+
+// Keeps the bounding circle of a character out of the walls of a level, sliding along them.
+// Only the linedefs listed in the blockmap cells under the circle are tested, so the cost doesn't grow with the map.
+// The level must have a blockmap.
+class WallCollision
+{
+public:
+	WallCollision(const WAD::LevelData& level)
+		: m_level(level)
+	{}
+
+	// Moves pos by disp, stopping at walls and sliding along them. pos.z is the eye height.
+	void move(math::Vec3p16& pos, const math::Vec2p16& disp) const;
+
+	// Character shape, in world units (32 doom units across, 25.6 up) as Doom's player
+	math::intp16 radius = math::intp16(0.5f); // 16 doom units
+	math::intp16 eyeHeight = math::intp16(1.6f); // 41 doom units above the feet
+	math::intp16 maxStep = math::intp16(0.9375f); // 24 doom units
+	math::intp16 height = math::intp16(2.1875f); // 56 doom units
+
+private:
+	// Whether a character with its feet at the given height can't cross the linedef
+	bool blocks(const WAD::LineDef& lineDef, int32_t feetRaw) const;
+
+	const WAD::LevelData& m_level;
+};
@@ -6,6 +6,7 @@
 #include <Display.h>
 #include <Camera.h>
 #include <vector.h>
+#include <interlace.h>
 
 #ifdef GBA
 extern "C" {
@@ -21,8 +22,17 @@ extern uint8_t g_worldMap[kMapRows * kMapCols];
 class Mode4Renderer
 {
 public:
+    using DisplayMode = Mode4Display;
+
     static void Init();
     static void RenderWorld(const Camera& cam);
+    static bool BeginFrame() { return true; }
+    static void EndFrame() { DisplayControl::Get().flipFrame(); }
+
+    // Casts half of the columns per frame during slow camera motion
+    static inline InterlaceController interlace;
+    // Casts rays only where the visible wall face changes, and interpolates the columns in between
+    static inline bool edgeWalls = true;
 private:
     static void yDLine(uint16_t* backBuffer, unsigned x, unsigned drawStart, unsigned drawEnd, uint16_t worldColor);
     static inline uint32_t sPaletteStart;
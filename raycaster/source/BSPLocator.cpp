@@ -0,0 +1,79 @@
+//
+// Point location in the BSP tree
+//
+
+#include <BSPLocator.h>
+
+using namespace math;
+
+intp16 BSPLocator::distanceBound(const WAD::Plane& plane, const intp16& x, const intp16& y)
+{
+	auto origin = plane.origin.unpack();
+	auto dir = plane.dir.unpack();
+	intp16 relX = x - origin.m_x;
+	intp16 relY = y - origin.m_y;
+	intp16 cross = relX * dir.m_y - relY * dir.m_x;
+	intp16 dirLength = abs(dir.m_x) + abs(dir.m_y);
+	return abs(cross) / dirLength;
+}
+
+uint16_t BSPLocator::update(const WAD::LevelData& level, const intp16& x, const intp16& y)
+{
+	if (m_level == &level)
+	{
+		// Early out while the point stays away from every plane in the path
+		intp16 moved = abs(x - m_anchor.m_x) + abs(y - m_anchor.m_y);
+		if (moved < m_safeRadius)
+		{
+			return m_leaf;
+		}
+	}
+	else
+	{
+		// New level, walk from the root
+		m_level = &level;
+		m_depth = 0;
+		m_path[0] = uint16_t(level.numNodes) - uint16_t(1);
+	}
+
+	// Validate the cached path top down
+	uint32_t depth = 0;
+	intp16 safeRadius = intp16(1 << 14);
+	for (; depth < m_depth; ++depth)
+	{
+		auto& node = level.nodes[m_path[depth]];
+		if (side(node.plane, x, y) != m_sides[depth])
+		{
+			break;
+		}
+		safeRadius = min(safeRadius, distanceBound(node.plane, x, y));
+	}
+
+	// Walk down from the first node that changed
+	uint16_t nodeIndex = m_path[depth];
+	while (!(nodeIndex & kLeafMask))
+	{
+		dbgAssert(depth < kMaxDepth);
+		auto& node = level.nodes[nodeIndex];
+		uint8_t nodeSide = uint8_t(side(node.plane, x, y));
+		m_path[depth] = nodeIndex;
+		m_sides[depth] = nodeSide;
+		++depth;
+		safeRadius = min(safeRadius, distanceBound(node.plane, x, y));
+		nodeIndex = node.child[nodeSide];
+	}
+	m_path[depth] = nodeIndex; // Keep the leaf at the end of the path
+	m_depth = depth;
+	m_leaf = nodeIndex & ~kLeafMask;
+
+	m_anchor = Vec2p16(x, y);
+	m_safeRadius = safeRadius;
+	return m_leaf;
+}
+
+const WAD::Sector& BSPLocator::sector(const WAD::LevelData& level) const
+{
+	// All segs in a subsector belong to the same sector
+	auto& subSector = level.subSectors[m_leaf];
+	return level.sectors[level.segFrontSectors[subSector.firstSegment]];
+}
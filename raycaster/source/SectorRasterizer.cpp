@@ -18,14 +18,27 @@
 #include <portaltest.wad.h>
 #include <e1m1.wad.h>
 
+// Wall texture
+#include <brick.h>
+
 using namespace math;
 using namespace gfx;
 
+const MipTexture brickTexture = {
+	(const uint8_t*)brickTexels,
+	(const uint16_t*)brickPalette,
+	brickMipOffsets,
+	brickLog2Width,
+	brickLog2Height,
+	brickMipCount
+};
+
 // No need to place this method in fast memory
 void SectorRasterizer::Init()
 {
 	displayMode.Init();
 	Display().enableSprites();
+	wallTexture = &brickTexture;
 }
 
 bool SectorRasterizer::BeginFrame()
@@ -40,17 +53,25 @@ void SectorRasterizer::EndFrame()
 
 #define LEVEL 1
 
+// Levels are asset archives, linked into ROM by the .s file next to each one.
+// They are stored uncompressed, so the level is read in place and needs no unpack buffer.
 bool loadWAD(WAD::LevelData& dstLevel)
 {
 #if LEVEL == 0
-    loadMap_test_WAD(dstLevel);
+    assets::Archive archive(test_WADArchive);
+    auto loadMap = loadMap_test_WAD;
 #elif LEVEL == 1
-    loadMap_mercury_WAD(dstLevel);
+    assets::Archive archive(mercury_WADArchive);
+    auto loadMap = loadMap_mercury_WAD;
 #elif LEVEL == 2
-    loadMap_portaltest_WAD(dstLevel);
+    assets::Archive archive(portaltest_WADArchive);
+    auto loadMap = loadMap_portaltest_WAD;
 #elif LEVEL == 3
-    loadMap_e1m1_WAD(dstLevel);
+    assets::Archive archive(e1m1_WADArchive);
+    auto loadMap = loadMap_e1m1_WAD;
 #endif
 
-    return true;
+    // The renderer reads the seg arrays and baked lights, and collision the blockmap, straight from ROM.
+    // The load function fails when the archive misses any of them, e.g. when it comes from an older wadToCpp.
+    return archive.valid() && loadMap(archive, dstLevel, nullptr);
 }
\ No newline at end of file
@@ -10,6 +10,7 @@
 #include <container.h>
 #include <Color.h>
 #include <Device.h>
+#include <Draw.h>
 #include <linearMath.h>
 #include <SectorRasterizer.h>
 
@@ -24,9 +25,141 @@ using namespace gfx;
 //#define FOV 50
 #define FOV 66
 
+// Flats are flat shaded. The ceiling run that starts at the top of each column, and the floor run that ends at the bottom,
+// are only recorded by the wall pass. FillFlats then draws them row by row, which writes sequential pixels and fills
+// the rows shared by every column with a single DMA. Runs that start further in, behind steps, are drawn by the walls.
+int16_t g_ceilingEnd[SectorRasterizer::ScreenWidth];
+int16_t g_floorBegin[SectorRasterizer::ScreenWidth];
+
+void clearFlatRuns()
+{
+	for (int32_t x = 0; x < SectorRasterizer::ScreenWidth; ++x)
+	{
+		g_ceilingEnd[x] = 0;
+		g_floorBegin[x] = SectorRasterizer::ScreenHeight;
+	}
+}
+
+// Columns drawn this frame: every column, or every other column when interlacing
+int32_t g_columnStep = 1;
+int32_t g_columnParity = 0;
+
+// First column at or after x that gets drawn this frame
+inline int32_t firstColumn(int32_t x)
+{
+	return x + ((x ^ g_columnParity) & (g_columnStep - 1));
+}
+
+// Scales a 15 bit color by light/32. Red and blue share a multiply, since their fields are far enough apart not to overflow into each other.
+inline uint16_t shade(uint32_t color, uint32_t light)
+{
+	uint32_t redBlue = (((color & 0x7c1f) * light) >> 5) & 0x7c1f;
+	uint32_t green = (((color & 0x03e0) * light) >> 5) & 0x03e0;
+	return uint16_t(redBlue | green);
+}
+
+#if FOV == 90
+constexpr int32_t kFrustumTanNum = 1;
+constexpr int32_t kFrustumTanDen = 1;
+#elif FOV == 50
+constexpr int32_t kFrustumTanNum = 1;
+constexpr int32_t kFrustumTanDen = 2;
+#elif FOV == 66
+constexpr int32_t kFrustumTanNum = 2;
+constexpr int32_t kFrustumTanDen = 3;
+#endif
+
 static constexpr uint32_t kMaxClipRanges = 32;
 StaticVector<SectorRasterizer::ClipRange, kMaxClipRanges> g_solidRanges;
 
+// Masked segs and meshes are kept along with a copy of the clip window they had when traversal reached them.
+// Clip windows of everything deferred in a frame share a single pool.
+static constexpr uint32_t kMaxMaskedSegs = 32;
+static constexpr uint32_t kMaskedClipPoolSize = 4 * SectorRasterizer::ScreenWidth;
+StaticVector<SectorRasterizer::MaskedSeg, kMaxMaskedSegs> g_maskedSegs;
+uint8_t g_maskedClipTop[kMaskedClipPoolSize];
+uint8_t g_maskedClipBottom[kMaskedClipPoolSize];
+uint32_t g_maskedClipPoolUsed = 0;
+uint16_t g_deferredOrder = 0; // Traversal order of the next masked seg or mesh
+
+// Meshes placed in the level, and their screen space vertices for the current frame.
+// Meshes are dropped as a whole when any vertex gets too close to the camera, instead of clipping their triangles.
+static constexpr uint32_t kMaxMeshes = 8;
+static constexpr uint32_t kMaxMeshVertices = 16;
+constexpr intp16 kMeshNearPlane = 0.125_p16;
+struct ProjectedMesh
+{
+	Vec2p8 vertices[kMaxMeshVertices];
+	int16_t minX, maxX; // Clamped screen columns. Empty when the mesh is not in view.
+};
+StaticVector<SectorRasterizer::MeshInstance, kMaxMeshes> g_meshes;
+StaticVector<SectorRasterizer::VisibleMesh, kMaxMeshes> g_visibleMeshes;
+ProjectedMesh g_projectedMeshes[kMaxMeshes];
+
+// Frustum side planes in world orientation, updated once per frame.
+// Normals point out of the frustum. They are scaled to keep tan(fov/2) = kFrustumTanNum/kFrustumTanDen exact.
+// Components are .12 fixed point.
+struct FrustumPlanes
+{
+	int32_t rightX, rightY;
+	int32_t leftX, leftY;
+};
+FrustumPlanes g_frustum;
+constexpr int32_t kFrustumMargin = 1 << 18; // Keep walls that are within rounding distance of the edge
+
+// Visible set: the BSP nodes and subsectors that can show anything from poses near the one of the last full traversal.
+// It is recorded with the back face and frustum tests relaxed by the limits below, so it holds every seg visible from
+// any pose within them. Following frames walk the BSP in their own front to back order, skipping the subtrees outside
+// the set, which gives the same image as a full traversal.
+// The limits are the camera motion since the recording frame, not per frame like interlacing's.
+static constexpr uint32_t kMaxVisibleSetNodes = 1024; // Also the limit for subsectors
+constexpr intp16 kVisibleSetMaxMove = intp16(0.5f);
+constexpr unorm16 kVisibleSetMaxTurn = unorm16::castFromShiftedInteger<16>(1 << 11); // 1/32 of a revolution
+uint32_t g_visibleNodes[kMaxVisibleSetNodes / 32];
+uint32_t g_visibleSubsectors[kMaxVisibleSetNodes / 32];
+const WAD::LevelData* g_visibleSetLevel = nullptr;
+Pose g_visibleSetPose;
+bool g_visibleSetValid = false;
+bool g_recordVisibleSet = false;
+bool g_replayVisibleSet = false;
+
+// Frustum of every heading within kVisibleSetMaxTurn of the recording one, with its planes pushed out
+// by as far as kVisibleSetMaxMove can move the camera along their normals
+FrustumPlanes g_visibleSetFrustum;
+int32_t g_visibleSetRightMargin;
+int32_t g_visibleSetLeftMargin;
+
+// Side planes for the given headings. Each side can use its own, to cover a turning camera.
+FrustumPlanes frustumPlanes(uint16_t rightPhi, uint16_t leftPhi)
+{
+	// View axes. phi = 0 looks down +y
+	// A point is outside the right side when right.p > tan(fov/2) * fwd.p
+	FrustumPlanes planes;
+	int32_t cosPhi = lu_cos(rightPhi);
+	int32_t sinPhi = lu_sin(rightPhi);
+	planes.rightX = kFrustumTanDen * cosPhi + kFrustumTanNum * sinPhi;
+	planes.rightY = kFrustumTanDen * sinPhi - kFrustumTanNum * cosPhi;
+	cosPhi = lu_cos(leftPhi);
+	sinPhi = lu_sin(leftPhi);
+	planes.leftX = -kFrustumTanDen * cosPhi + kFrustumTanNum * sinPhi;
+	planes.leftY = -kFrustumTanDen * sinPhi - kFrustumTanNum * cosPhi;
+	return planes;
+}
+
+inline bool testBit(const uint32_t* bits, uint32_t i)
+{
+	return (bits[i >> 5] >> (i & 31)) & 1;
+}
+
+inline void setBit(uint32_t* bits, uint32_t i)
+{
+	bits[i >> 5] |= 1u << (i & 31);
+}
+
+// Procedural grate used for middle textures until masked walls get real textures.
+// One bit per texel row, 8 rows per world unit. Zero bits are the color key (transparent).
+static constexpr uint8_t kMaskedTextureRows = 0b00110011;
+
 Color edgeClr[] = {
 	BasicColor::Red,
 	BasicColor::Orange,
@@ -174,8 +307,33 @@ crunch:
 
 // Clips a wall that's already in view space.
 // Returns whether the wall is visible.
-bool SectorRasterizer::clipWall(const Vec2p16& v0, const Vec2p16& v1, unorm16 camAngle, Vec2p16& ndcA, Vec2p16& ndcB)
+bool SectorRasterizer::clipWall(const Vec2p16& v0, const Vec2p16& v1, unorm16 camAngle, Vec2p16& ndcA, Vec2p16& ndcB, Vec2p16& texU)
 {
+	// Cheap rejection before any angle work.
+	// Back faces: the wall must go clockwise around the camera
+	int64_t cross = int64_t(v0.x().raw) * v1.y().raw - int64_t(v0.y().raw) * v1.x().raw;
+	if (cross >= 0)
+	{
+		return false;
+	}
+
+	// Frustum sides: reject walls with both ends outside of the same side plane.
+	// .8 coordinates times .12 normals stay within 32 bits for maps up to 128 units away from the origin.
+	int32_t ax = v0.x().raw >> 8;
+	int32_t ay = v0.y().raw >> 8;
+	int32_t bx = v1.x().raw >> 8;
+	int32_t by = v1.y().raw >> 8;
+	if ((ax * g_frustum.rightX + ay * g_frustum.rightY > kFrustumMargin)
+		&& (bx * g_frustum.rightX + by * g_frustum.rightY > kFrustumMargin))
+	{
+		return false;
+	}
+	if ((ax * g_frustum.leftX + ay * g_frustum.leftY > kFrustumMargin)
+		&& (bx * g_frustum.leftX + by * g_frustum.leftY > kFrustumMargin))
+	{
+		return false;
+	}
+
 	// Compute endpoint angles
 	unorm16 angle0 = fastAtan2(v0.x(), v0.y());
 	unorm16 angle1 = fastAtan2(v1.x(), v1.y());
@@ -288,27 +446,99 @@ bool SectorRasterizer::clipWall(const Vec2p16& v0, const Vec2p16& v1, unorm16 ca
 	dbgAssert(ndcA.y() >= 0_p16);
 	dbgAssert(ndcB.y() >= 0_p16);
 
+	// Texture coordinates, as the distance along the wall from v0 to where each clipped ray hits it.
+	// Baked lighting is interpolated with them.
+	constexpr intp16 minCos = intp16(1 / 64.f); // Avoid blowing up on grazing angles
+	intp16 alongV0 = hyp * Sin(offsetAngle);
+	texU.x() = alongV0 - distanceToPlane * Sin(offset0) / max(minCos, Cos(offset0));
+	texU.y() = alongV0 - distanceToPlane * Sin(offset1) / max(minCos, Cos(offset1));
+
 	return true;
 }
 
-void clear(uint16_t* buffer, uint16_t topClr, uint16_t bottomClr, int area)
+// Draws the flat runs recorded by the wall pass, one row at a time.
+// Columns the BSP left open get the ceiling color above the horizon and the ground color below it.
+void SectorRasterizer::FillFlats(const DepthBuffer& depthBuffer)
 {
-	DMA::Channel0().Fill(&buffer[0 * area / 4], topClr, area / 4);
-	DMA::Channel0().Fill(&buffer[1 * area / 4], topClr, area / 4);
-	DMA::Channel0().Fill(&buffer[2 * area / 4], bottomClr, area / 4);
-	DMA::Channel0().Fill(&buffer[3 * area / 4], bottomClr, area / 4);
+	uint16_t* backbuffer = (uint16_t*)DisplayMode::backBuffer();
+
+	int32_t minCeilingEnd = ScreenHeight, maxCeilingEnd = 0;
+	int32_t minFloorBegin = ScreenHeight, maxFloorBegin = 0;
+	for (int32_t x = firstColumn(0); x < ScreenWidth; x += g_columnStep)
+	{
+		int32_t top = depthBuffer.ceilingClip[x];
+		int32_t bottom = depthBuffer.floorClip[x];
+		if (top < bottom)
+		{
+			// Extend the recorded runs when they reach the open window, and draw the rest of it directly
+			int32_t horizon = max(top, min(bottom, ScreenHeight / 2));
+			if (g_ceilingEnd[x] >= top)
+				g_ceilingEnd[x] = int16_t(max<int32_t>(g_ceilingEnd[x], horizon));
+			else
+			{
+				for (int32_t y = top; y < horizon; ++y)
+					backbuffer[DisplayMode::pixel(x, y)] = ceilingClr.raw;
+			}
+			if (g_floorBegin[x] <= bottom)
+				g_floorBegin[x] = int16_t(min<int32_t>(g_floorBegin[x], horizon));
+			else
+			{
+				for (int32_t y = horizon; y < bottom; ++y)
+					backbuffer[DisplayMode::pixel(x, y)] = groundClr.raw;
+			}
+		}
+		minCeilingEnd = min<int32_t>(minCeilingEnd, g_ceilingEnd[x]);
+		maxCeilingEnd = max<int32_t>(maxCeilingEnd, g_ceilingEnd[x]);
+		minFloorBegin = min<int32_t>(minFloorBegin, g_floorBegin[x]);
+		maxFloorBegin = max<int32_t>(maxFloorBegin, g_floorBegin[x]);
+	}
+
+	// Rows that are flat in every column. Interlaced frames must keep the other columns, so they only get runs.
+	int32_t firstCeilingRow = 0;
+	int32_t lastFloorRow = ScreenHeight;
+	if (g_columnStep == 1)
+	{
+		firstCeilingRow = max(0, minCeilingEnd);
+		lastFloorRow = min<int32_t>(ScreenHeight, maxFloorBegin);
+		uint32_t* dst = reinterpret_cast<uint32_t*>(backbuffer);
+		if (firstCeilingRow > 0)
+			DMA::Channel0().Fill(dst, uint32_t(ceilingClr.raw) | (uint32_t(ceilingClr.raw) << 16), firstCeilingRow * ScreenWidth / 2);
+		if (lastFloorRow < ScreenHeight)
+			DMA::Channel0().Fill(dst + lastFloorRow * ScreenWidth / 2, uint32_t(groundClr.raw) | (uint32_t(groundClr.raw) << 16), (ScreenHeight - lastFloorRow) * ScreenWidth / 2);
+	}
+
+	// The rest of the runs
+	for (int32_t y = firstCeilingRow; y < maxCeilingEnd; ++y)
+	{
+		uint16_t* row = &backbuffer[DisplayMode::pixel(0, y)];
+		for (int32_t x = firstColumn(0); x < ScreenWidth; x += g_columnStep)
+		{
+			if (y < g_ceilingEnd[x])
+				row[x] = ceilingClr.raw;
+		}
+	}
+	for (int32_t y = max(0, minFloorBegin); y < lastFloorRow; ++y)
+	{
+		uint16_t* row = &backbuffer[DisplayMode::pixel(0, y)];
+		for (int32_t x = firstColumn(0); x < ScreenWidth; x += g_columnStep)
+		{
+			if (y >= g_floorBegin[x])
+				row[x] = groundClr.raw;
+		}
+	}
 }
 
 // Clip a segment against the screen.
-// Returns whether the segment is potentially visible, and if so, fills in the clipped vertices into ndcA and ndcB.
+// Returns whether the segment is potentially visible, and if so, fills in the clipped vertices into ndcA and ndcB,
+// and their texture coordinates along the seg into texU.
 // The clipped vertices have the following components:
 // x: screen space x, in the range [-1,1]
 // y: inverse distance to the camera plane.
-bool SectorRasterizer::clipSegment(const Pose& view, const WAD::Vertex* vertices, const WAD::Seg& segment, Vec2p16& ndcA, Vec2p16& ndcB)
+bool SectorRasterizer::clipSegment(const Pose& view, const WAD::LevelData& level, uint32_t segIndex, Vec2p16& ndcA, Vec2p16& ndcB, Vec2p16& texU)
 {
-	// Reconstruct segment vertices
-	auto& v0 = vertices[segment.startVertex];
-	auto& v1 = vertices[segment.endVertex];
+	// Reconstruct segment vertices, widening them from their 16 bit storage
+	auto v0 = level.vertices[level.segVertices[2 * segIndex]].unpack();
+	auto v1 = level.vertices[level.segVertices[2 * segIndex + 1]].unpack();
 
 	auto pos16 = Vec2p16(view.pos.m_x, view.pos.m_y);
 	// Project to view space
@@ -316,72 +546,115 @@ bool SectorRasterizer::clipSegment(const Pose& view, const WAD::Vertex* vertices
 	auto vsB = v1 - pos16;
 
 	// Clip
-	return clipWall(vsA, vsB, view.phi, ndcA, ndcB);
+	return clipWall(vsA, vsB, view.phi, ndcA, ndcB, texU);
+}
+
+// Whether a seg can be visible from some pose within the visible set limits of the current one.
+// Same back face and frustum side tests as clipWall, with room for the camera to move and turn.
+bool inVisibleSetBounds(const Pose& view, const WAD::LevelData& level, uint32_t segIndex)
+{
+	auto pos16 = Vec2p16(view.pos.m_x, view.pos.m_y);
+	auto vsA = level.vertices[level.segVertices[2 * segIndex]].unpack() - pos16;
+	auto vsB = level.vertices[level.segVertices[2 * segIndex + 1]].unpack() - pos16;
+
+	// Moving the camera by d changes the cross product by (b-a) x d, which is at most max(|ex|,|ey|) * (|dx|+|dy|)
+	int64_t cross = int64_t(vsA.x().raw) * vsB.y().raw - int64_t(vsA.y().raw) * vsB.x().raw;
+	int32_t edge = max(abs(vsB.x().raw - vsA.x().raw), abs(vsB.y().raw - vsA.y().raw));
+	if (cross >= int64_t(edge) * kVisibleSetMaxMove.raw)
+	{
+		return false;
+	}
+
+	int32_t ax = vsA.x().raw >> 8;
+	int32_t ay = vsA.y().raw >> 8;
+	int32_t bx = vsB.x().raw >> 8;
+	int32_t by = vsB.y().raw >> 8;
+	const FrustumPlanes& planes = g_visibleSetFrustum;
+	if ((ax * planes.rightX + ay * planes.rightY > g_visibleSetRightMargin)
+		&& (bx * planes.rightX + by * planes.rightY > g_visibleSetRightMargin))
+	{
+		return false;
+	}
+	return (ax * planes.leftX + ay * planes.leftY <= g_visibleSetLeftMargin)
+		|| (bx * planes.leftX + by * planes.leftY <= g_visibleSetLeftMargin);
 }
 
-void SectorRasterizer::RenderSubsector(const WAD::LevelData& level, uint16_t ssIndex, const Pose& view, DepthBuffer& depthBuffer)
+// Only the render hot seg arrays and the baked lights are read for every seg. Of the WAD structs, only the seg offset is read, for texturing.
+// Returns whether the subsector belongs in the visible set, which is only worked out while recording it.
+bool SectorRasterizer::RenderSubsector(const WAD::LevelData& level, uint16_t ssIndex, const Pose& view, DepthBuffer& depthBuffer)
 {
-	constexpr uint16_t FlagTwoSided = 0x04;
 	const WAD::SubSector& subSector = level.subSectors[ssIndex];
+
+	// Subsectors are convex, so their visible segs are all behind anything placed inside them.
+	// Subsectors holding meshes always go in the visible set, since a mesh can show even when none of the segs around it do.
+	bool anyVisible = RecordMeshes(ssIndex, depthBuffer);
 	for (int i = subSector.firstSegment; i < subSector.firstSegment + subSector.segmentCount; ++i)
 	{
-		auto& segment = level.segments[i];
+		if (g_recordVisibleSet)
+		{
+			// Segs outside the relaxed bounds can't be visible now either
+			if (!inVisibleSetBounds(view, level, i))
+			{
+				continue;
+			}
+			anyVisible = true;
+		}
 
-		Vec2p16 ndcA, ndcB;
-		if (!clipSegment(view, level.vertices, segment, ndcA, ndcB))
+		Vec2p16 ndcA, ndcB, texU;
+		if (!clipSegment(view, level, i, ndcA, ndcB, texU))
 		{
 			continue; // Ignore non-visible segments
 		}
 
 		// Locate drawing info
-		auto clrNdx = segment.linedefNum % 8;
-		auto& lineDef = level.lineDefs[segment.linedefNum];
-		auto& frontSide = level.sideDefs[lineDef.SideNum[0]];
-		auto& frontSector = level.sectors[frontSide.sector];
-
-		bool isHor = segment.angle == 0_p16 || segment.angle == 0.5_p16;
-		bool isVer = segment.angle == 0.25_p16 || segment.angle == 0.75_p16;
-
-		intp16 wallLight = 20 * (isHor ? 0.625_p16 : isVer ? 1_p16 : 0.825_p16);
+		uint8_t segFlags = level.segFlags[i];
+		auto& frontSector = level.sectors[level.segFrontSectors[i]];
+
+		// Baked values are for the ends of the seg. Interpolate them to the clipped ends of the wall.
+		intp16 segLength = PointToDist(level.vertices[level.segVertices[2 * i + 1]].unpack() - level.vertices[level.segVertices[2 * i]].unpack());
+		intp16 tA = max(0_p16, min(1_p16, texU.x() / segLength));
+		intp16 tB = max(0_p16, min(1_p16, texU.y() / segLength));
+		// Bytes map to the 0 to 20 range of the wall shading
+		intp16 light0 = intp16::castFromShiftedInteger<8>(20 * level.segLights[2 * i]);
+		intp16 light1 = intp16::castFromShiftedInteger<8>(20 * level.segLights[2 * i + 1]);
+		intp16 wallLightA = light0 + (light1 - light0) * tA;
+		intp16 wallLightB = light0 + (light1 - light0) * tB;
+		// Make texture coordinates relative to the linedef
+		intp16 segOffset = intp16::castFromShiftedInteger<8>(level.segments[i].offset.raw);
+		texU.x() += segOffset;
+		texU.y() += segOffset;
 
 		intp16 floorH = intp16::castFromShiftedInteger<8>(frontSector.floorhHeight.raw) - view.pos.m_z;
 		intp16 ceilingH = intp16::castFromShiftedInteger<8>(frontSector.ceilingHeight.raw) - view.pos.m_z;
-		Color topColor = BasicColor::DarkGrey;
-		//Color topColor = segment.direction ? BasicColor::DarkGrey : skyClr;
-		Color bottomColor = segment.direction ? BasicColor::DarkGrey : groundClr;
+		bool backSide = segFlags & WAD::kSegBackSide;
+		Color topColor = ceilingClr;
+		Color bottomColor = backSide ? BasicColor::DarkGrey : groundClr;
 
-		if (lineDef.SideNum[1] == uint16_t(-1) // No back sector, must be an opaque wall
-			|| !(lineDef.flags & FlagTwoSided)) // Explicitly opaque
+		if (segFlags & WAD::kSegOpaque)
 		{
-			RenderWall(ndcA, ndcB, floorH, ceilingH, topColor, bottomColor, wallLight, depthBuffer);
+			RenderWall(ndcA, ndcB, texU, floorH, ceilingH, topColor, bottomColor, wallLightA, wallLightB, depthBuffer);
 			continue;
 		}
 
-		auto& backSide = level.sideDefs[lineDef.SideNum[1]];
-		auto& backSector = level.sectors[backSide.sector];
+		auto& backSector = level.sectors[level.segBackSectors[i]];
 
-		// Invisible portal
-		if (backSector.floorhHeight == frontSector.floorhHeight
-			&& backSector.ceilingHeight == frontSector.ceilingHeight)
+		// Regular portal. Invisible portals don't need to draw anything
+		// Steps and masked walls are flat shaded, with the light at the middle of the visible part
+		int32_t portalLight = (wallLightA.raw + wallLightB.raw) >> 12;
+		auto renderClr = backSide ? BasicColor::DarkGrey : Color(portalLight, portalLight, portalLight);
+		if (segFlags & WAD::kSegStep)
 		{
-			continue;
+			RenderPortal(view, ndcA, ndcB, floorH, ceilingH, backSector, topColor, bottomColor, renderClr, depthBuffer);
 		}
 
-		// Regular portal
-		auto renderClr = segment.direction ? BasicColor::DarkGrey : Color(wallLight.raw>>11, wallLight.raw >> 11, wallLight.raw >> 11);
-		RenderPortal(view, ndcA, ndcB, floorH, ceilingH, backSector, topColor, bottomColor, renderClr, depthBuffer);
+		// Masked middle texture. Only record it here, it will be drawn once everything behind it is done.
+		if (segFlags & WAD::kSegMasked)
+		{
+			RecordMaskedSeg(view, ndcA, ndcB, floorH, ceilingH, backSector, renderClr, depthBuffer);
+		}
 	}
-}
 
-int32_t side(const WAD::Plane& plane, const intp16& x, const intp16& y)
-{
-	intp16 relX = x - plane.origin.m_x;
-	intp16 relY = y - plane.origin.m_y;
-
-	// It is safe to cast the plane component down to .8 without loss because we know they've been shifted on decompression
-	auto cross = relX * plane.dir.m_y - relY * plane.dir.m_x;
-	// We just care about the sign, so ignore the shift
-	return cross.raw > 0 ? 0 : 1;
+	return anyVisible;
 }
 
 bool insideAABB(const WAD::AABB& aabb, const Vec3p8& pos)
@@ -392,28 +665,80 @@ bool insideAABB(const WAD::AABB& aabb, const Vec3p8& pos)
 		&& (pos.m_y.raw >= aabb.bottom.raw);
 }
 
-void SectorRasterizer::RenderBSPNode(const WAD::LevelData& level, uint16_t nodeIndex, const Pose& view, DepthBuffer& depthBuffer)
+// Height doesn't change which segs are visible, so the camera can still move up and down.
+bool canReuseVisibleSet(const WAD::LevelData& level, const Pose& view)
+{
+	return g_visibleSetValid && g_visibleSetLevel == &level
+		&& PoseDelta(g_visibleSetPose, view).within(kVisibleSetMaxMove, kVisibleSetMaxTurn);
+}
+
+// Starts recording the visible set from this pose, or disables it for levels too large for its bit arrays
+void beginVisibleSet(const WAD::LevelData& level, const Pose& view)
+{
+	uint32_t numSubsectors = level.numNodes + 1;
+	g_visibleSetValid = numSubsectors <= kMaxVisibleSetNodes;
+	g_recordVisibleSet = g_visibleSetValid;
+	if (!g_visibleSetValid)
+	{
+		return;
+	}
+	memset(g_visibleNodes, 0, sizeof(g_visibleNodes));
+	memset(g_visibleSubsectors, 0, sizeof(g_visibleSubsectors));
+	g_visibleSetLevel = &level;
+	g_visibleSetPose = view;
+
+	// The right side plane of the frustum turned right by the limit, and the left one turned left
+	uint16_t turn = kVisibleSetMaxTurn.raw;
+	g_visibleSetFrustum = frustumPlanes(uint16_t(view.phi.raw - turn), uint16_t(view.phi.raw + turn));
+	const FrustumPlanes& planes = g_visibleSetFrustum;
+	int32_t move = kVisibleSetMaxMove.raw >> 8; // .8, like the seg coordinates in the plane tests
+	g_visibleSetRightMargin = kFrustumMargin + move * max(abs(planes.rightX), abs(planes.rightY));
+	g_visibleSetLeftMargin = kFrustumMargin + move * max(abs(planes.leftX), abs(planes.leftY));
+}
+
+// Returns whether the node belongs in the visible set, which is only worked out while recording it.
+// Replaying the set skips the nodes outside of it.
+bool SectorRasterizer::RenderBSPNode(const WAD::LevelData& level, uint16_t nodeIndex, const Pose& view, DepthBuffer& depthBuffer)
 {
 	constexpr uint16_t NodeMask = (1 << 15);
-	auto& node = level.nodes[nodeIndex];
 
 	if (nodeIndex & NodeMask) // Leaf
 	{
+		uint16_t ssIndex = nodeIndex & ~NodeMask;
+		if (g_replayVisibleSet && !testBit(g_visibleSubsectors, ssIndex))
+		{
+			return false;
+		}
 		// Render
-		RenderSubsector(level, nodeIndex & ~NodeMask, view, depthBuffer);
-		return;
+		bool visible = RenderSubsector(level, ssIndex, view, depthBuffer);
+		if (visible && g_recordVisibleSet)
+		{
+			setBit(g_visibleSubsectors, ssIndex);
+		}
+		return visible;
 	}
 	else // Branch
 	{
+		if (g_replayVisibleSet && !testBit(g_visibleNodes, nodeIndex))
+		{
+			return false;
+		}
+		auto& node = level.nodes[nodeIndex];
+
 		// Traverse front to back
 		int frontChild = side(node.plane, view.pos.m_x, view.pos.m_y);
 
 		// Render the node I'm in first
-		RenderBSPNode(level, node.child[frontChild], view, depthBuffer);
+		bool visible = RenderBSPNode(level, node.child[frontChild], view, depthBuffer);
 
 		// Then the node I'm not in
 		// TODO: Check bounding box here
-		RenderBSPNode(level, node.child[frontChild ^ 1], view, depthBuffer);
+		visible |= RenderBSPNode(level, node.child[frontChild ^ 1], view, depthBuffer);
+		if (visible && g_recordVisibleSet)
+		{
+			setBit(g_visibleNodes, nodeIndex);
+		}
+		return visible;
 	}
 }
 
@@ -429,17 +754,55 @@ void SectorRasterizer::RenderWorld(WAD::LevelData& level, const Camera& cam)
 	g_solidRanges[1].begin = ScreenWidth;
 	g_solidRanges[1].end = ScreenWidth;
 
-	// Traverse the BSP (in a random order for now)
+	g_maskedSegs.clear();
+	g_visibleMeshes.clear();
+	g_maskedClipPoolUsed = 0;
+	g_deferredOrder = 0;
+
+	const Pose& view = cam.m_pose;
+
+	g_frustum = frustumPlanes(view.phi.raw, view.phi.raw);
+
+	ProjectMeshes(view);
+
+	// Interlaced frames only redraw half of the columns, over the frame the back buffer still holds.
+	// Closing the other half in the depth buffer makes the rest of the frame skip them.
+	int32_t parity = interlace.beginFrame(view);
+	if (parity == InterlaceController::kFullFrame)
+	{
+		g_columnStep = 1;
+		g_columnParity = 0;
+	}
+	else
+	{
+		g_columnStep = 2;
+		g_columnParity = parity;
+		depthBuffer.Clear(parity);
+	}
+	clearFlatRuns();
+
+	// Traverse the BSP, either within the visible set of a close enough pose, or recording a new one.
 	// Always start at the last node
+	g_replayVisibleSet = canReuseVisibleSet(level, view);
+	if (!g_replayVisibleSet)
+	{
+		beginVisibleSet(level, view);
+	}
 	uint16_t rootNode = uint16_t(level.numNodes) - uint16_t(1);
-	RenderBSPNode(level, rootNode, cam.m_pose, depthBuffer);
+	RenderBSPNode(level, rootNode, view, depthBuffer);
+	g_recordVisibleSet = false;
+	g_replayVisibleSet = false;
+
+	// Flats go in once every wall is drawn, then the second pass for see through geometry and meshes
+	FillFlats(depthBuffer);
+	RenderDeferred();
 }
 
 void SectorRasterizer::RenderWall(
-	const Vec2p16& ndcA, const Vec2p16& ndcB,
+	const Vec2p16& ndcA, const Vec2p16& ndcB, const Vec2p16& texU,
 	const intp16& floorH, const intp16& ceilingH,
 	Color ceilColor, Color gndColor,
-	const intp16& lightLevel, DepthBuffer& depthBuffer)
+	const intp16& lightLevelA, const intp16& lightLevelB, DepthBuffer& depthBuffer)
 {
 	intp16 ssA = ndcA.x() * int(DisplayMode::Width/2) + int(DisplayMode::Width/2);
 	intp16 ssB = ndcB.x() * int(DisplayMode::Width/2) + int(DisplayMode::Width/2);
@@ -462,14 +825,24 @@ void SectorRasterizer::RenderWall(
 	int y1A = (DisplayMode::Height / 2 - hFloorA).floor();
 	
 
-	intp16 lightA = (min(1_p16, ndcA.y()) * lightLevel);
-	intp16 lightB = (min(1_p16, ndcB.y()) * lightLevel);
+	intp16 lightA = (min(1_p16, ndcA.y()) * lightLevelA);
+	intp16 lightB = (min(1_p16, ndcB.y()) * lightLevelB);
 	intp16 dLight = (lightB - lightA) / (ssB - ssA);
 
+	// Textures. u/z is linear in screen space, so interpolate that and divide per column.
+	// The closest end of the wall picks the level, so no part of the wall gets magnified because of it
+	uint32_t mip = wallTexture->selectMip(max(ndcA.y(), ndcB.y()) * int(DisplayMode::Width / 2), kWallTexelsPerUnit);
+	intp16 uOverDA = texU.x() * ndcA.y();
+	intp16 dUOverD = (texU.y() * ndcB.y() - uOverDA) / (ssB - ssA);
+	intp16 dInvD = (ndcB.y() - ndcA.y()) / (ssB - ssA);
+	const intp16 mipTexelsPerUnit = intp16::castFromShiftedInteger<16>((kWallTexelsPerUnit << 16) >> mip);
+	const uint16_t* palette = wallTexture->palette;
+	uint32_t vMask = wallTexture->height(mip) - 1;
+
 	x1 = std::min<int32_t>(x1, DisplayMode::Width-1);
 
 	uint16_t* backbuffer = (uint16_t*)DisplayMode::backBuffer();
-	for(int x = std::max<int32_t>(0,x0); x <= x1; ++x)
+	for(int x = firstColumn(std::max<int32_t>(0,x0)); x <= x1; x += g_columnStep)
 	{		
 		int floorDY = (mFloor * (x - x0)).floor();
 		int ceilDY = (mCeil * (x - x0)).floor();
@@ -485,26 +858,48 @@ void SectorRasterizer::RenderWall(
 		int y1 = std::min<int32_t>(DisplayMode::Height, y1A - floorDY);
 
 		// Ceiling
-		for(int y = ceilingClip; y < min(y0,floorClip); ++y)
+		if (ceilingClip == 0)
 		{
-			auto pixel = DisplayMode::pixel(x, y);
-			backbuffer[pixel] = ceilColor.raw;
+			g_ceilingEnd[x] = int16_t(max<int32_t>(g_ceilingEnd[x], min(y0, floorClip)));
+		}
+		else
+		{
+			for(int y = ceilingClip; y < min(y0,floorClip); ++y)
+			{
+				auto pixel = DisplayMode::pixel(x, y);
+				backbuffer[pixel] = ceilColor.raw;
+			}
 		}
 
-		int light = min(31, (lightA + (x - x0) * dLight).raw >> 11);
-		Color wallClr = Color(light, light, light);
-		// Wall		
-		for(int y = max(y0, ceilingClip); y < min(y1, floorClip); ++y)
+		// Wall
+		intp16 invD = max(intp16(1 / 256.f), ndcA.y() + dInvD * (x - x0));
+		intp16 u = (uOverDA + dUOverD * (x - x0)) / invD;
+		const uint8_t* texColumn = wallTexture->column(mip, (u * mipTexelsPerUnit).floor());
+		uint32_t light = min(31, (lightA + (x - x0) * dLight).raw >> 11) + 1;
+
+		// Texels per screen pixel down the column. Textures are pegged to the ceiling.
+		intp16 dv = mipTexelsPerUnit / (invD * int(DisplayMode::Width / 2));
+		int yStart = max(y0, ceilingClip);
+		intp16 v = dv * (yStart - (y0A - ceilDY));
+		for(int y = yStart; y < min(y1, floorClip); ++y)
 		{
 			auto pixel = DisplayMode::pixel(x, y);
-			backbuffer[pixel] = wallClr.raw;
+			backbuffer[pixel] = shade(palette[texColumn[v.floor() & vMask]], light);
+			v += dv;
 		}
 
 		// Ground
-		for(int y = max(y1, ceilingClip); y < floorClip; ++y)
+		if (floorClip == DisplayMode::Height)
 		{
-			auto pixel = DisplayMode::pixel(x, y);
-			backbuffer[pixel] = gndColor.raw;
+			g_floorBegin[x] = int16_t(min<int32_t>(g_floorBegin[x], max(y1, ceilingClip)));
+		}
+		else
+		{
+			for(int y = max(y1, ceilingClip); y < floorClip; ++y)
+			{
+				auto pixel = DisplayMode::pixel(x, y);
+				backbuffer[pixel] = gndColor.raw;
+			}
 		}
 
 		depthBuffer.ceilingClip[x] = floorClip;
@@ -557,7 +952,7 @@ void SectorRasterizer::RenderPortal(const Pose& view,
 	x1 = std::min<int32_t>(x1, DisplayMode::Width - 1);
 
 	uint16_t* backbuffer = (uint16_t*)DisplayMode::backBuffer();
-	for (int x = std::max<int32_t>(0, x0); x < x1; ++x)
+	for (int x = firstColumn(std::max<int32_t>(0, x0)); x < x1; x += g_columnStep)
 	{
 		int floorClip = depthBuffer.floorClip[x];
 		int ceilingClip = depthBuffer.ceilingClip[x];
@@ -576,10 +971,17 @@ void SectorRasterizer::RenderPortal(const Pose& view,
 		// Draw the ceiling in front;
 
 		int32_t y0 = y0A - ceilDY;
-		for (int y = ceilingClip; y < min(y0, floorClip); ++y)
+		if (ceilingClip == 0)
 		{
-			auto pixel = DisplayMode::pixel(x, y);
-			backbuffer[pixel] = ceilColr.raw;
+			g_ceilingEnd[x] = int16_t(max<int32_t>(g_ceilingEnd[x], min(y0, floorClip)));
+		}
+		else
+		{
+			for (int y = ceilingClip; y < min(y0, floorClip); ++y)
+			{
+				auto pixel = DisplayMode::pixel(x, y);
+				backbuffer[pixel] = ceilColr.raw;
+			}
 		}
 
 		// Draw the top section
@@ -589,7 +991,8 @@ void SectorRasterizer::RenderPortal(const Pose& view,
 			auto pixel = DisplayMode::pixel(x, y);
 			backbuffer[pixel] = wallClr.raw;
 		}
-		depthBuffer.ceilingClip[x] = max(ceilingClip, y1);
+		// The front ceiling hides whatever is behind it too, when the back sector's ceiling is higher
+		depthBuffer.ceilingClip[x] = min(floorClip, max(ceilingClip, max(y0, y1)));
 
 		// Bottom wall
 		int y2 = y2A - backFloorDY;
@@ -599,13 +1002,303 @@ void SectorRasterizer::RenderPortal(const Pose& view,
 			auto pixel = DisplayMode::pixel(x, y);
 			backbuffer[pixel] = wallClr.raw;
 		}
-		depthBuffer.floorClip[x] = max(0, min(floorClip, y2));
 
 		// Ground
-		for (int y = max(y3, ceilingClip); y < floorClip; ++y)
+		if (floorClip == DisplayMode::Height)
 		{
-			auto pixel = DisplayMode::pixel(x, y);
-			backbuffer[pixel] = gndClr.raw;
+			g_floorBegin[x] = int16_t(min<int32_t>(g_floorBegin[x], max(y3, ceilingClip)));
+		}
+		else
+		{
+			for (int y = max(y3, ceilingClip); y < floorClip; ++y)
+			{
+				auto pixel = DisplayMode::pixel(x, y);
+				backbuffer[pixel] = gndClr.raw;
+			}
+		}
+		// Same for the front floor
+		depthBuffer.floorClip[x] = max(ceilingClip, min(floorClip, min(y2, y3)));
+	}
+}
+
+void SectorRasterizer::RecordMaskedSeg(const Pose& view,
+	const Vec2p16& ndcA, const Vec2p16& ndcB,
+	const intp16& floorH, const intp16& ceilingH,
+	const WAD::Sector& backSector, Color clr, const DepthBuffer& depthBuffer)
+{
+	intp16 ssA = ndcA.x() * int(DisplayMode::Width / 2) + int(DisplayMode::Width / 2);
+	intp16 ssB = ndcB.x() * int(DisplayMode::Width / 2) + int(DisplayMode::Width / 2);
+
+	int32_t x0 = ssA.floor();
+	int32_t x1 = ssB.floor() + 1;
+	int32_t clipBegin = std::max<int32_t>(0, x0);
+	int32_t clipEnd = std::min<int32_t>(x1, DisplayMode::Width);
+	if (clipBegin >= clipEnd)
+	{
+		return;
+	}
+
+	// Out of space. Dropping the seg is better than stalling the frame.
+	uint32_t numColumns = clipEnd - clipBegin;
+	if (g_maskedSegs.size() == kMaxMaskedSegs || g_maskedClipPoolUsed + numColumns > kMaskedClipPoolSize)
+	{
+		return;
+	}
+
+	// Keep the current clip window. Everything that has been drawn so far is in front of this seg.
+	bool anyOpen = false;
+	uint8_t* clipTop = &g_maskedClipTop[g_maskedClipPoolUsed];
+	uint8_t* clipBottom = &g_maskedClipBottom[g_maskedClipPoolUsed];
+	for (int x = clipBegin; x < clipEnd; ++x)
+	{
+		uint8_t top = depthBuffer.ceilingClip[x];
+		uint8_t bottom = depthBuffer.floorClip[x];
+		anyOpen |= top < bottom;
+		*clipTop++ = top;
+		*clipBottom++ = bottom;
+	}
+	if (!anyOpen)
+	{
+		return;
+	}
+
+	intp16 backCeiling = intp16::castFromShiftedInteger<8>(backSector.ceilingHeight.raw) - view.pos.m_z;
+	intp16 backFloor = intp16::castFromShiftedInteger<8>(backSector.floorhHeight.raw) - view.pos.m_z;
+
+	MaskedSeg seg;
+	seg.ndcA = ndcA;
+	seg.ndcB = ndcB;
+	seg.bottomH = max(floorH, backFloor);
+	seg.topH = min(ceilingH, backCeiling);
+	seg.x0 = x0;
+	seg.x1 = x1;
+	seg.clipBegin = clipBegin;
+	seg.clipEnd = clipEnd;
+	seg.clipOffset = g_maskedClipPoolUsed;
+	seg.order = g_deferredOrder++;
+	seg.clr = clr;
+	g_maskedSegs.push_back(seg);
+	g_maskedClipPoolUsed += numColumns;
+}
+
+void SectorRasterizer::RenderMaskedSeg(const MaskedSeg& seg)
+{
+	uint16_t* backbuffer = (uint16_t*)DisplayMode::backBuffer();
+
+	intp16 hBottomA = seg.bottomH * seg.ndcA.y() * int(DisplayMode::Width / 2);
+	intp16 hBottomB = seg.bottomH * seg.ndcB.y() * int(DisplayMode::Width / 2);
+	intp16 hTopA = seg.topH * seg.ndcA.y() * int(DisplayMode::Width / 2);
+	intp16 hTopB = seg.topH * seg.ndcB.y() * int(DisplayMode::Width / 2);
+	intp16 mBottom = (hBottomB - hBottomA) / (seg.x1 - seg.x0);
+	intp16 mTop = (hTopB - hTopA) / (seg.x1 - seg.x0);
+	intp16 mInvDepth = (seg.ndcB.y() - seg.ndcA.y()) / (seg.x1 - seg.x0);
+	int y0A = (DisplayMode::Height / 2 - hTopA).floor();
+	int y1A = (DisplayMode::Height / 2 - hBottomA).floor();
+
+	const uint8_t* clipTop = &g_maskedClipTop[seg.clipOffset];
+	const uint8_t* clipBottom = &g_maskedClipBottom[seg.clipOffset];
+	for (int x = seg.clipBegin; x < seg.clipEnd; ++x)
+	{
+		int top = *clipTop++;
+		int bottom = *clipBottom++;
+		int dx = x - seg.x0;
+		int y0 = max(top, y0A - (mTop * dx).floor());
+		int y1 = min(bottom, y1A - (mBottom * dx).floor());
+		if (y0 >= y1)
+		{
+			continue;
+		}
+
+		// World space height of a pixel in this column
+		intp16 invDepth = seg.ndcA.y() + mInvDepth * dx;
+		if (invDepth <= 0_p16)
+		{
+			continue;
+		}
+		intp16 dv = 1_p16 / (invDepth * int(DisplayMode::Width / 2));
+		intp16 v = seg.topH - (intp16(y0) - (DisplayMode::Height / 2 - hTopA - mTop * dx)) * dv;
+
+		for (int y = y0; y < y1; ++y)
+		{
+			// Texel rows go downwards from the top of the opening
+			int texelRow = ((seg.topH - v).raw >> 13) & 0x7;
+			if (kMaskedTextureRows & (1 << texelRow))
+			{
+				backbuffer[DisplayMode::pixel(x, y)] = seg.clr.raw;
+			}
+			v -= dv;
+		}
+	}
+}
+
+bool SectorRasterizer::AddMesh(const WAD::LevelData& level, const Mesh& mesh, const Vec3p16& pos)
+{
+	if (g_meshes.size() == g_meshes.capacity() || mesh.numVertices > kMaxMeshVertices)
+	{
+		return false;
+	}
+
+	BSPLocator locator;
+	MeshInstance instance;
+	instance.mesh = &mesh;
+	instance.subsector = locator.update(level, pos.m_x, pos.m_y);
+	instance.pos = pos;
+	instance.pos.m_z += intp16::castFromShiftedInteger<8>(locator.sector(level).floorhHeight.raw);
+	g_meshes.push_back(instance);
+	g_visibleSetValid = false; // Its subsector may be missing from the visible set
+	return true;
+}
+
+void SectorRasterizer::ClearMeshes()
+{
+	g_meshes.clear();
+}
+
+// Transforms all mesh vertices to screen space, and finds the columns each mesh covers.
+void SectorRasterizer::ProjectMeshes(const Pose& view)
+{
+	// Same projection as walls: x = tan(fov/2)^-1 * right / depth, y = height / depth, both scaled by half the screen width
+	constexpr int32_t kScaleX = (ScreenWidth / 2) * kFrustumTanDen / kFrustumTanNum;
+	constexpr int32_t kScaleY = ScreenWidth / 2;
+	intp16 cosPhi = intp16::castFromShiftedInteger<12>(lu_cos(view.phi.raw));
+	intp16 sinPhi = intp16::castFromShiftedInteger<12>(lu_sin(view.phi.raw));
+
+	for (uint32_t i = 0; i < g_meshes.size(); ++i)
+	{
+		const MeshInstance& instance = g_meshes[i];
+		const Mesh& mesh = *instance.mesh;
+		ProjectedMesh& projected = g_projectedMeshes[i];
+		int32_t minX = ScreenWidth;
+		int32_t maxX = 0;
+
+		bool inFront = true;
+		for (int j = 0; j < mesh.numVertices; ++j)
+		{
+			const Vec3p8& vertex = mesh.vertices[j];
+			intp16 x = instance.pos.m_x - view.pos.m_x + intp16::castFromShiftedInteger<8>(vertex.m_x.raw);
+			intp16 y = instance.pos.m_y - view.pos.m_y + intp16::castFromShiftedInteger<8>(vertex.m_y.raw);
+			intp16 z = instance.pos.m_z - view.pos.m_z + intp16::castFromShiftedInteger<8>(vertex.m_z.raw);
+
+			intp16 right = x * cosPhi + y * sinPhi;
+			intp16 depth = y * cosPhi - x * sinPhi;
+			if (depth < kMeshNearPlane)
+			{
+				inFront = false;
+				break;
+			}
+
+			// .16 * int / .8 = .8. Far off screen vertices don't fit in .16, so divide in 64 bits.
+			int32_t depth8 = depth.raw >> 8;
+			int32_t sx = ((ScreenWidth / 2) << 8) + int32_t(int64_t(right.raw) * kScaleX / depth8);
+			int32_t sy = ((ScreenHeight / 2) << 8) - int32_t(int64_t(z.raw) * kScaleY / depth8);
+			projected.vertices[j] = Vec2p8(intp8::castFromShiftedInteger<8>(sx), intp8::castFromShiftedInteger<8>(sy));
+			minX = min(minX, sx >> 8);
+			maxX = max(maxX, (sx >> 8) + 1);
+		}
+
+		if (!inFront)
+		{
+			minX = ScreenWidth;
+			maxX = 0;
+		}
+		projected.minX = max(0, minX);
+		projected.maxX = min(ScreenWidth, maxX);
+	}
+}
+
+// Keeps the current clip window for every mesh in view inside this subsector.
+// Returns whether the subsector holds any mesh, visible or not.
+bool SectorRasterizer::RecordMeshes(uint16_t ssIndex, const DepthBuffer& depthBuffer)
+{
+	bool anyMesh = false;
+	for (uint32_t i = 0; i < g_meshes.size(); ++i)
+	{
+		if (g_meshes[i].subsector != ssIndex)
+		{
+			continue;
+		}
+		anyMesh = true;
+
+		const ProjectedMesh& projected = g_projectedMeshes[i];
+		int32_t clipBegin = projected.minX;
+		int32_t clipEnd = projected.maxX;
+		uint32_t numColumns = clipEnd - clipBegin;
+		if (clipBegin >= clipEnd
+			|| g_visibleMeshes.size() == g_visibleMeshes.capacity()
+			|| g_maskedClipPoolUsed + numColumns > kMaskedClipPoolSize)
+		{
+			continue;
+		}
+
+		bool anyOpen = false;
+		uint8_t* clipTop = &g_maskedClipTop[g_maskedClipPoolUsed];
+		uint8_t* clipBottom = &g_maskedClipBottom[g_maskedClipPoolUsed];
+		for (int x = clipBegin; x < clipEnd; ++x)
+		{
+			uint8_t top = depthBuffer.ceilingClip[x];
+			uint8_t bottom = depthBuffer.floorClip[x];
+			anyOpen |= top < bottom;
+			*clipTop++ = top;
+			*clipBottom++ = bottom;
+		}
+		if (!anyOpen)
+		{
+			continue;
+		}
+
+		VisibleMesh visibleMesh;
+		visibleMesh.instance = i;
+		visibleMesh.clipBegin = clipBegin;
+		visibleMesh.clipEnd = clipEnd;
+		visibleMesh.clipOffset = g_maskedClipPoolUsed;
+		visibleMesh.order = g_deferredOrder++;
+		g_visibleMeshes.push_back(visibleMesh);
+		g_maskedClipPoolUsed += numColumns;
+	}
+	return anyMesh;
+}
+
+// Faces are not sorted, so meshes should be convex. Back faces are culled by the rasterizer.
+void SectorRasterizer::RenderMesh(const VisibleMesh& visibleMesh)
+{
+	uint16_t* backbuffer = (uint16_t*)DisplayMode::backBuffer();
+	const Mesh& mesh = *g_meshes[visibleMesh.instance].mesh;
+	const ProjectedMesh& projected = g_projectedMeshes[visibleMesh.instance];
+	const uint8_t* clipTop = &g_maskedClipTop[visibleMesh.clipOffset];
+	const uint8_t* clipBottom = &g_maskedClipBottom[visibleMesh.clipOffset];
+
+	const uint16_t* indices = mesh.indices;
+	for (int i = 0; i < mesh.numTris; ++i)
+	{
+		Vec2p8 vertices[3] = {
+			projected.vertices[indices[0]],
+			projected.vertices[indices[1]],
+			projected.vertices[indices[2]]
+		};
+		indices += 3;
+
+		rasterTriangleClipped(
+			backbuffer, { ScreenWidth, ScreenHeight },
+			mesh.faceColors[i].raw, vertices,
+			clipTop, clipBottom, visibleMesh.clipBegin, visibleMesh.clipEnd);
+	}
+}
+
+// Masked segs and meshes were recorded front to back in two separate lists.
+// Merge them walking backwards to draw everything back to front.
+void SectorRasterizer::RenderDeferred()
+{
+	int segNdx = int(g_maskedSegs.size()) - 1;
+	int meshNdx = int(g_visibleMeshes.size()) - 1;
+	while (segNdx >= 0 || meshNdx >= 0)
+	{
+		if (meshNdx < 0 || (segNdx >= 0 && g_maskedSegs[segNdx].order > g_visibleMeshes[meshNdx].order))
+		{
+			RenderMaskedSeg(g_maskedSegs[segNdx--]);
+		}
+		else
+		{
+			RenderMesh(g_visibleMeshes[meshNdx--]);
 		}
 	}
 }
@@ -617,4 +1310,14 @@ void SectorRasterizer::DepthBuffer::Clear()
 		ceilingClip[i] = 0;
 		floorClip[i] = DisplayMode::Height;
 	}
+}
+
+void SectorRasterizer::DepthBuffer::Clear(int32_t parity)
+{
+	for(int i = 0; i < DisplayMode::Width; ++i)
+	{
+		bool open = (i & 1) == parity;
+		ceilingClip[i] = 0;
+		floorClip[i] = open ? DisplayMode::Height : 0;
+	}
 }
\ No newline at end of file
@@ -0,0 +1,140 @@
+//
+// Slide collision against linedefs, accelerated by the blockmap
+//
+
+#include <WallCollision.h>
+
+using namespace math;
+
+namespace
+{
+	constexpr uint16_t kFlagBlocking = 0x01;
+	constexpr int kMaxPasses = 3; // Corners need a second pass, since leaving one wall can push into the other
+
+	uint32_t isqrt(uint64_t x)
+	{
+		uint64_t result = 0;
+		uint64_t bit = uint64_t(1) << 62;
+		while (bit > x)
+			bit >>= 2;
+		while (bit)
+		{
+			if (x >= result + bit)
+			{
+				x -= result + bit;
+				result = (result >> 1) + bit;
+			}
+			else
+				result >>= 1;
+			bit >>= 2;
+		}
+		return uint32_t(result);
+	}
+
+	// Pushes the center of the circle out of the segment [a,b] if they overlap. Returns whether it moved.
+	// Works in .8 so that products of long lines still fit in 64 bits.
+	bool pushOut(const WAD::Vertex& a, const WAD::Vertex& b, int32_t& x, int32_t& y, int32_t radiusRaw)
+	{
+		int64_t ax = a.m_x.raw >> 8;
+		int64_t ay = a.m_y.raw >> 8;
+		int64_t dx = (b.m_x.raw >> 8) - ax;
+		int64_t dy = (b.m_y.raw >> 8) - ay;
+		int64_t px = x >> 8;
+		int64_t py = y >> 8;
+		int64_t r = radiusRaw >> 8;
+
+		// Closest point of the segment
+		int64_t len2 = dx * dx + dy * dy;
+		int64_t t = (px - ax) * dx + (py - ay) * dy;
+		int64_t cx = ax;
+		int64_t cy = ay;
+		if (len2 > 0 && t > 0)
+		{
+			if (t >= len2)
+			{
+				cx += dx;
+				cy += dy;
+			}
+			else
+			{
+				cx += dx * t / len2;
+				cy += dy * t / len2;
+			}
+		}
+
+		int64_t ex = px - cx;
+		int64_t ey = py - cy;
+		int64_t dist2 = ex * ex + ey * ey;
+		if (dist2 >= r * r)
+			return false;
+
+		int64_t dist = isqrt(uint64_t(dist2));
+		if (dist == 0)
+		{
+			// Right on the line. Leave through its front side.
+			if (len2 == 0)
+				return false;
+			ex = dy;
+			ey = -dx;
+			dist = isqrt(uint64_t(len2));
+		}
+		x += int32_t((ex * (r - dist) / dist) << 8);
+		y += int32_t((ey * (r - dist) / dist) << 8);
+		return true;
+	}
+}
+
+bool WallCollision::blocks(const WAD::LineDef& lineDef, int32_t feetRaw) const
+{
+	if (lineDef.SideNum[1] == uint16_t(-1) || (lineDef.flags & kFlagBlocking))
+		return true;
+
+	// Heights are .8, like the renderer reads them
+	auto& front = m_level.sectors[m_level.sideDefs[lineDef.SideNum[0]].sector];
+	auto& back = m_level.sectors[m_level.sideDefs[lineDef.SideNum[1]].sector];
+	int32_t floor = max(front.floorhHeight.raw, back.floorhHeight.raw) << 8;
+	int32_t ceiling = min(front.ceilingHeight.raw, back.ceilingHeight.raw) << 8;
+
+	if (floor - feetRaw > maxStep.raw)
+		return true;
+	return ceiling - max(floor, feetRaw) < height.raw;
+}
+
+void WallCollision::move(Vec3p16& pos, const Vec2p16& disp) const
+{
+	int32_t x = pos.m_x.raw + disp.m_x.raw;
+	int32_t y = pos.m_y.raw + disp.m_y.raw;
+
+	auto blockMap = m_level.blockMap;
+	auto& header = *reinterpret_cast<const WAD::BlockMapHeader*>(blockMap);
+	int32_t feet = (pos.m_z - eyeHeight).raw;
+
+	for (int pass = 0; pass < kMaxPasses; ++pass)
+	{
+		// Cells under the circle
+		int32_t col0 = max(0, (((x - radius.raw) >> 16) - header.originX) >> WAD::kBlockShift);
+		int32_t col1 = min(header.numCols - 1, (((x + radius.raw) >> 16) - header.originX) >> WAD::kBlockShift);
+		int32_t row0 = max(0, (((y - radius.raw) >> 16) - header.originY) >> WAD::kBlockShift);
+		int32_t row1 = min(header.numRows - 1, (((y + radius.raw) >> 16) - header.originY) >> WAD::kBlockShift);
+
+		bool pushed = false;
+		for (int32_t row = row0; row <= row1; ++row)
+		{
+			for (int32_t col = col0; col <= col1; ++col)
+			{
+				auto list = &blockMap[blockMap[WAD::kBlockMapHeaderSize + row * header.numCols + col]];
+				for (; *list != WAD::kBlockListEnd; ++list)
+				{
+					auto& lineDef = m_level.lineDefs[*list];
+					if (blocks(lineDef, feet))
+						pushed |= pushOut(m_level.vertices[lineDef.v0].unpack(), m_level.vertices[lineDef.v1].unpack(), x, y, radius.raw);
+				}
+			}
+		}
+		if (!pushed)
+			break;
+	}
+
+	pos.m_x.raw = x;
+	pos.m_y.raw = y;
+}
@@ -16,6 +16,14 @@
 
 using namespace math;
 
+// Grid raycaster to profile with Timer1. rayCast is the reference, rayCastFast uses reciprocal tables.
+#define FAST_RAYCAST 1
+#if FAST_RAYCAST
+constexpr auto castGridRay = rayCastFast;
+#else
+constexpr auto castGridRay = rayCast;
+#endif
+
 uint8_t g_worldMap[kMapRows * kMapCols] = {
 	1, 1, 1, 1, 1, 1, 1, 1,1, 1, 1, 1, 1, 1, 1, 1,
 	1, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 1,
@@ -80,7 +88,91 @@ void yLine(Color* backBuffer,
 	}
 }
 
-/* Deprecated
+namespace
+{
+	// Where a column ray hit a wall, ready to interpolate across the face
+	struct WallHit
+	{
+		int32_t cell;
+		int32_t side;
+		int32_t invDepth; // .16, so that heights and texture coordinates interpolate linearly across the screen
+		int32_t u; // .8 position along the face, from the corner of its cell
+	};
+
+	// Distances closer than this saturate to full screen height anyway, and keep invDepth in range
+	constexpr int32_t kMinDepthRaw = 16;
+
+	FORCE_INLINE inline bool sameFace(const WallHit& a, const WallHit& b)
+	{
+		return a.cell == b.cell && a.side == b.side;
+	}
+
+	// Column rays of a frame, in the same parametrization as the per column renderer
+	struct GridView
+	{
+		Vec3p8 rayStart;
+		Vec2p8 viewDir;
+		Vec2p8 sideDir;
+		Vec2p8 rayDir0;
+		Vec2p12 dRay;
+		intp8 widthRCP;
+		int lastCol;
+
+		Vec2p8 rayDir(int col) const
+		{
+			return {
+				rayDir0.x() + (col * dRay.x()).cast<8>(),
+				rayDir0.y() + (col * dRay.y()).cast<8>()
+			};
+		}
+
+		WallHit cast(int col) const
+		{
+			Vec2p8 dir = rayDir(col);
+			int cellVal;
+			WallHit hit;
+			intp8 hitDistance = rayCastFastCell(rayStart, dir, cellVal, hit.side, hit.cell, g_worldMap, kMapCols);
+			int32_t depth = max(hitDistance.raw, kMinDepthRaw);
+			hit.invDepth = (1 << 24) / depth;
+
+			// Faces hit while stepping in x run along y, and the other way around
+			int32_t along = hit.side
+				? rayStart.x().raw + ((depth * dir.x().raw) >> 8) - ((hit.cell % kMapCols) << 8)
+				: rayStart.y().raw + ((depth * dir.y().raw) >> 8) - ((hit.cell / kMapCols) << 8);
+			hit.u = max(0, min(along, 255));
+			return hit;
+		}
+
+		// Column of a point on the floor, or lastCol if it is behind the camera
+		int project(int32_t x, int32_t y) const
+		{
+			int32_t relX = (x << 8) - rayStart.x().raw;
+			int32_t relY = (y << 8) - rayStart.y().raw;
+			int32_t depth = relX * viewDir.x().raw + relY * viewDir.y().raw;
+			if (depth <= 0)
+				return lastCol;
+			int32_t lateral = relX * sideDir.x().raw + relY * sideDir.y().raw;
+			// Column rays are rayDir0 + col * dRay, i.e. viewDir + (col * widthRCP - 1) * sideDir
+			int64_t col = (int64_t(lateral + depth) << 8) / (int64_t(depth) * widthRCP.raw);
+			return col < lastCol ? int(col) : lastCol;
+		}
+
+		// Last column the face of hit could cover, if nothing occludes it
+		int lastColumnOf(const WallHit& hit) const
+		{
+			int32_t cellX = hit.cell % kMapCols;
+			int32_t cellY = hit.cell / kMapCols;
+			if (hit.side == 0)
+			{
+				int32_t faceX = (rayStart.x().floor() < cellX) ? cellX : cellX + 1;
+				return max(project(faceX, cellY), project(faceX, cellY + 1));
+			}
+			int32_t faceY = (rayStart.y().floor() < cellY) ? cellY : cellY + 1;
+			return max(project(cellX, faceY), project(cellX + 1, faceY));
+		}
+	};
+}
+
 void Mode4Renderer::RenderWorld(const Camera& cam)
 {	
 	// Reconstruct local axes for fast ray interpolation
@@ -88,6 +180,7 @@ void Mode4Renderer::RenderWorld(const Camera& cam)
 	intp8 sinPhi = cam.m_pose.sinf.cast<8>();
 	Vec2p8 sideDir = { cosPhi, sinPhi }; // 45deg FoV
 	Vec2p8 viewDir = { -sinPhi, cosPhi };
+	Vec3p8 rayStart = { cam.m_pose.pos.x().cast<8>(), cam.m_pose.pos.y().cast<8>(), cam.m_pose.pos.z().cast<8>() };
 
 	// TODO: We can leverage the fact that we're now multiplying by col only and transform the in-loop multiplication into an addition.
 	// On top of that, sideDir.x() * ndcX can really be extracted and transformed into two separate additions too.
@@ -95,6 +188,16 @@ void Mode4Renderer::RenderWorld(const Camera& cam)
 	constexpr intp8 widthRCP = intp8(4.f/(Mode4Display::Width-1));
 	auto backbuffer = DisplayControl::Get().backBuffer();
 
+	// Interlaced frames only cast every other column, over the frame the back buffer still holds
+	int colStep = 1;
+	int firstCol = 0;
+	int32_t parity = interlace.beginFrame(cam.m_pose);
+	if (parity != InterlaceController::kFullFrame)
+	{
+		colStep = 2;
+		firstCol = parity;
+	}
+
 	const uint16_t colorOffset = sPaletteStart | (sPaletteStart<<8);
 	const int16_t wallDColorSeam = (4 | (4<<8)) + colorOffset;
 	const int16_t wallDColorDark = (5 | (5<<8)) + colorOffset;
@@ -103,7 +206,96 @@ void Mode4Renderer::RenderWorld(const Camera& cam)
 	Vec2p8 rayDir0 = viewDir - sideDir;
 	Vec2p12 dRay = { (sideDir.x() * widthRCP).cast<12>(), (sideDir.y() * widthRCP).cast<12>() };
 
-	for(int col = 0; col < Mode4Display::Width/2; col++)
+	auto drawColumn = [&](int col, int lineHeight, int side, int texX)
+	{
+		//calculate lowest and highest pixel to fill in current stripe
+		int drawStart = -lineHeight / 2 + Mode4Display::Height / 2;
+		if(drawStart < 0)drawStart = 0;
+		int drawEnd = lineHeight / 2 + Mode4Display::Height / 2;
+		if(drawEnd > Mode4Display::Height) drawEnd = Mode4Display::Height;
+
+		auto texClr = side ? wallDColorDark : wallDColorLight;
+
+		//draw the pixels of the stripe as a vertical line
+		yDLine(backbuffer, col, drawStart, drawEnd, texX ? texClr : wallDColorSeam);
+	};
+
+	if (edgeWalls)
+	{
+		GridView view = { rayStart, viewDir, sideDir, rayDir0, dRay, widthRCP, 0 };
+		view.lastCol = firstCol + ((Mode4Display::Width/2 - 1 - firstCol) / colStep) * colStep;
+
+		// Fills the columns from c0 to c1, which see the same face.
+		// 1/depth and u/depth are linear in screen space, so there's a single division left per column.
+		auto drawFace = [&](int c0, const WallHit& h0, int c1, const WallHit& h1)
+		{
+			int steps = (c1 - c0) / colStep;
+			int32_t invDepth = h0.invDepth;
+			int32_t uOverDepth = h0.u * h0.invDepth;
+			int32_t dInvDepth = steps ? (h1.invDepth - h0.invDepth) / steps : 0;
+			int32_t dUOverDepth = steps ? (h1.u * h1.invDepth - uOverDepth) / steps : 0;
+			for (int col = c0; col <= c1; col += colStep)
+			{
+				int lineHeight = (Mode4Display::Height * invDepth) >> 16;
+				int texX = ((uOverDepth / invDepth) >> 4) & 0xf;
+				drawColumn(col, lineHeight, h0.side, texX);
+				invDepth += dInvDepth;
+				uOverDepth += dUOverDepth;
+			}
+		};
+
+		int col = firstCol;
+		WallHit hit = view.cast(col);
+		while (true)
+		{
+			// Guess where the face ends from its projected corners, then check the guess with a single ray
+			int end = max(col, view.lastColumnOf(hit));
+			end = col + ((end - col) / colStep) * colStep;
+			WallHit endHit = hit;
+			int next = end + colStep;
+			WallHit nextHit;
+			bool nextCast = false;
+			if (end != col)
+			{
+				endHit = view.cast(end);
+				if (!sameFace(endHit, hit))
+				{
+					// Something occludes the rest of the face. Bisect for the last column that still sees it.
+					int hiCol = end;
+					WallHit hiHit = endHit;
+					end = col;
+					endHit = hit;
+					while (hiCol - end > colStep)
+					{
+						int mid = end + ((hiCol - end) / (2 * colStep)) * colStep;
+						WallHit midHit = view.cast(mid);
+						if (sameFace(midHit, hit))
+						{
+							end = mid;
+							endHit = midHit;
+						}
+						else
+						{
+							hiCol = mid;
+							hiHit = midHit;
+						}
+					}
+					next = hiCol;
+					nextHit = hiHit;
+					nextCast = true;
+				}
+			}
+
+			drawFace(col, hit, end, endHit);
+			if (next > view.lastCol)
+				break;
+			col = next;
+			hit = nextCast ? nextHit : view.cast(col);
+		}
+		return;
+	}
+
+	for(int col = firstCol; col < Mode4Display::Width/2; col += colStep)
 	{
 		// Compute a ray direction for this column
 		Vec2p8 rayDir = { 
@@ -113,7 +305,7 @@ void Mode4Renderer::RenderWorld(const Camera& cam)
 
 		int cellVal;
 		int side;
-		const intp8 hitDistance = rayCast(cam.m_pose.pos, rayDir, cellVal, side, g_worldMap, kMapCols);
+		const intp8 hitDistance = castGridRay(rayStart, rayDir, cellVal, side, g_worldMap, kMapCols);
 		//Calculate height of line to draw on screen
 		int lineHeight = Mode4Display::Height;
 		if(hitDistance > 0_p8) // This could really be > 1, as it will saturate to full screen anyway for distances < 1
@@ -121,22 +313,13 @@ void Mode4Renderer::RenderWorld(const Camera& cam)
 			lineHeight = (intp8(Mode4Display::Height ) / hitDistance).floor();
 		}
 
-		//calculate lowest and highest pixel to fill in current stripe
-		int drawStart = -lineHeight / 2 + Mode4Display::Height / 2;
-		if(drawStart < 0)drawStart = 0;
-		int drawEnd = lineHeight / 2 + Mode4Display::Height / 2;
-		if(drawEnd > Mode4Display::Height) drawEnd = Mode4Display::Height;
-
 		// Wall textures
-		Vec2p8 hitPoint = Vec2p8(cam.m_pose.pos.x(), cam.m_pose.pos.y()) + Vec2p8((hitDistance * rayDir.x()).cast<8>(), (hitDistance * rayDir.y()).cast<8>());
+		Vec2p8 hitPoint = Vec2p8(rayStart.x(), rayStart.y()) + Vec2p8((hitDistance * rayDir.x()).cast<8>(), (hitDistance * rayDir.y()).cast<8>());
 		int texX = ((side ? hitPoint.x() : hitPoint.y()).raw >> 4) & 0xf;
 
-		auto texClr = side ? wallDColorDark : wallDColorLight;
-
-		//draw the pixels of the stripe as a vertical line
-		yDLine(backbuffer, col, drawStart, drawEnd, texX ? texClr : wallDColorSeam);
+		drawColumn(col, lineHeight, side, texX);
 	}
-}*/
+}
 
 void DrawMinimapMode3(Color* backBuffer, Vec3p8 centerPos)
 {
@@ -23,6 +23,7 @@
 // Demo code
 #include <raycaster.h>
 #include <SectorRasterizer.h>
+#include <WallCollision.h>
 #include <Camera.h>
 
 // Levels
@@ -69,6 +70,37 @@ void InitSystems()
 
 volatile uint32_t timerT2 = 0;
 
+// Floorless pyramid, drawn inside the level by the sector rasterizer
+const Vec3p8 pyramidVertices[5] = {
+	{-0.25_p8,-0.25_p8, 0.0_p8},
+	{-0.25_p8, 0.25_p8, 0.0_p8},
+	{ 0.25_p8, 0.25_p8, 0.0_p8},
+	{ 0.25_p8,-0.25_p8, 0.0_p8},
+	{ 0.0_p8, 0.0_p8, 0.5_p8}
+};
+
+const uint16_t pyramidIndices[12] = {
+	1, 0, 4,
+	0, 3, 4,
+	3, 2, 4,
+	2, 1, 4
+};
+
+const Color pyramidColors[4] = {
+	BasicColor::Red,
+	BasicColor::Green,
+	BasicColor::Blue,
+	BasicColor::Yellow
+};
+
+const Mesh pyramid = {
+	pyramidVertices,
+	pyramidIndices,
+	pyramidColors,
+	4,
+	5
+};
+
 // Renderer selection
 #define SECTOR_RASTER 1
 #if SECTOR_RASTER
@@ -105,7 +137,14 @@ int main()
 
     // Load a WAD map
     WAD::LevelData level;
-    loadWAD(level);
+    if (!loadWAD(level))
+    {
+        return 0; // The level is missing data the game needs
+    }
+#if SECTOR_RASTER
+	Renderer::AddMesh(level, pyramid, Vec3p16(0_p16, 2_p16, 0_p16));
+	WallCollision collision(level);
+#endif
 
 	// Unlock the display and start rendering
 	Display().EndBlank();
@@ -117,7 +156,17 @@ int main()
 		Timer1().reset<Timer::e64>(); // Set high precision profiler
 		// Next frame logic
 		Keypad::Update();
+#if SECTOR_RASTER
+		playerController.update(collision);
+#else
 		playerController.update();
+#endif
+		if (Keypad::Pressed(Keypad::SELECT))
+			Renderer::interlace.enabled = !Renderer::interlace.enabled;
+#if !SECTOR_RASTER
+		if (Keypad::Pressed(Keypad::START))
+			Renderer::edgeWalls = !Renderer::edgeWalls;
+#endif
 		// We're actually controlling the camera
 
 #if !SECTOR_RASTER
@@ -132,7 +181,11 @@ int main()
 		}
 
 		// -- Render --
+#if SECTOR_RASTER
 		Renderer::RenderWorld(level, camera);
+#else
+		Renderer::RenderWorld(camera);
+#endif
 #ifdef GBA
 		frameCounter.render(text);
 
@@ -0,0 +1,85 @@
+// Test writing and reading back binary asset archives
+#include <assetArchive.h>
+#include <assetArchiveWriter.h>
+#include <mappedFile.h>
+#include <cassert>
+#include <cstdio>
+#include <string>
+#include <vector>
+
+using namespace assets;
+
+std::vector<uint32_t> makeBlob(uint32_t size, uint32_t seed)
+{
+    std::vector<uint32_t> blob(size);
+    for (uint32_t i = 0; i < size; ++i)
+        blob[i] = seed * 7919 + i;
+    return blob;
+}
+
+void checkArchive(const Archive& archive, uint32_t numBlobs)
+{
+    assert(archive.valid());
+    assert(archive.numEntries() == numBlobs);
+
+    for (uint32_t i = 0; i < numBlobs; ++i)
+    {
+        auto expected = makeBlob(i, i);
+        uint32_t count = 0;
+        auto data = archive.get<uint32_t>("blob" + std::to_string(i), count);
+        assert(data);
+        assert(count == i);
+        assert((reinterpret_cast<uintptr_t>(data) % kArchiveAlignment) == 0);
+        for (uint32_t j = 0; j < count; ++j)
+            assert(data[j] == expected[j]);
+    }
+
+    assert(!archive.get<uint32_t>("missing"));
+}
+
+void testArchive()
+{
+    constexpr uint32_t kNumBlobs = 37;
+    ArchiveWriter writer;
+    for (uint32_t i = 0; i < kNumBlobs; ++i)
+    {
+        auto blob = makeBlob(i, i);
+        assert(writer.add("blob" + std::to_string(i), blob.data(), blob.size() * sizeof(uint32_t)));
+    }
+
+    // Names must be unique
+    uint32_t dummy = 0;
+    assert(!writer.add("blob3", &dummy, sizeof(dummy)));
+
+    // Odd sized entries keep the following ones aligned
+    uint8_t odd[3] = { 1, 2, 3 };
+    ArchiveWriter oddWriter;
+    oddWriter.add("odd", odd, sizeof(odd));
+    oddWriter.add("word", &dummy, sizeof(dummy));
+    auto oddArchive = oddWriter.build();
+    uint32_t size;
+    auto wordData = Archive(oddArchive.data()).find(hashName("word"), size);
+    assert(wordData && size == 4 && (reinterpret_cast<uintptr_t>(wordData) % kArchiveAlignment) == 0);
+
+    // In memory
+    auto archiveData = writer.build();
+    checkArchive(Archive(archiveData.data()), kNumBlobs);
+
+    // Memory mapped from disk
+    const char* fileName = "assetArchiveTest.bin";
+    assert(writer.save(fileName));
+    {
+        MappedFile file(fileName);
+        assert(file.data() && file.size() == archiveData.size());
+        checkArchive(Archive(file.data()), kNumBlobs);
+    }
+    std::remove(fileName);
+}
+
+int main()
+{
+    static_assert(hashName("Nodes") != hashName("Vertices"));
+    testArchive();
+
+    return 0;
+}
@@ -0,0 +1,70 @@
+// Test the collision blockmap built from level linedefs
+#include <blockMap.h>
+#include <cassert>
+#include <vector>
+
+using namespace math;
+
+// Linedefs of the cell at the given world position
+std::vector<uint16_t> cellLines(const std::vector<uint16_t>& blockMap, int x, int y)
+{
+    auto& header = *reinterpret_cast<const WAD::BlockMapHeader*>(blockMap.data());
+    int col = (x - header.originX) >> WAD::kBlockShift;
+    int row = (y - header.originY) >> WAD::kBlockShift;
+    assert(col >= 0 && col < header.numCols && row >= 0 && row < header.numRows);
+
+    std::vector<uint16_t> lines;
+    for (uint32_t i = blockMap[WAD::kBlockMapHeaderSize + row * header.numCols + col]; blockMap[i] != WAD::kBlockListEnd; ++i)
+        lines.push_back(blockMap[i]);
+    return lines;
+}
+
+int main()
+{
+    // A 12x12 room, with a diagonal line across its lower left corner
+    std::vector<WAD::PackedVertex> vertices(6);
+    int coords[6][2] = { { -4, 0 }, { -4, 12 }, { 8, 12 }, { 8, 0 }, { -4, 3 }, { -1, 0 } };
+    for (int i = 0; i < 6; ++i)
+    {
+        vertices[i].x = int16_t(coords[i][0] << WAD::kPackedVertexShift);
+        vertices[i].y = int16_t(coords[i][1] << WAD::kPackedVertexShift);
+    }
+    std::vector<WAD::LineDef> lineDefs(5, WAD::LineDef{});
+    for (uint16_t i = 0; i < 4; ++i)
+    {
+        lineDefs[i].v0 = i;
+        lineDefs[i].v1 = (i + 1) % 4;
+    }
+    lineDefs[4].v0 = 4;
+    lineDefs[4].v1 = 5;
+
+    WAD::LevelData level;
+    level.vertices = vertices.data();
+    level.lineDefs = lineDefs.data();
+    level.numLineDefs = uint32_t(lineDefs.size());
+
+    // Measuring and building agree
+    std::vector<uint16_t> blockMap(buildBlockMap(level, nullptr));
+    assert(buildBlockMap(level, blockMap.data()) == blockMap.size());
+
+    // The grid covers the room from its corner, in 4 unit cells
+    auto& header = *reinterpret_cast<const WAD::BlockMapHeader*>(blockMap.data());
+    assert(header.originX == -4 && header.originY == 0);
+    assert(header.numCols == 4 && header.numRows == 4);
+
+    // Lines are listed in every cell they cross, and only there
+    assert(cellLines(blockMap, -3, 1) == std::vector<uint16_t>({ 0, 3, 4 }));
+    assert(cellLines(blockMap, 5, 1) == std::vector<uint16_t>({ 2, 3 }));
+    assert(cellLines(blockMap, 1, 5).empty());
+    assert(cellLines(blockMap, -3, 5) == std::vector<uint16_t>({ 0 }));
+
+    // Lines on the edge between two cells are listed in both
+    assert(cellLines(blockMap, 1, 9) == std::vector<uint16_t>({ 1 }));
+    assert(cellLines(blockMap, 1, 13) == std::vector<uint16_t>({ 1 }));
+
+    // No lines, no blockmap
+    level.numLineDefs = 0;
+    assert(buildBlockMap(level, nullptr) == 0);
+
+    return 0;
+}
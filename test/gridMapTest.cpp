@@ -0,0 +1,129 @@
+// Test the packed grid map, and raycasting it against the reference raycaster on the unpacked map
+#include <gridMap.h>
+#include <raycast.h>
+#include "rayTestCommon.h"
+#include <cassert>
+#include <cstdio>
+#include <cstdlib>
+#include <vector>
+
+using namespace math;
+
+constexpr int kMapSize = 256;
+
+// Closed map with rooms of scattered pillars, and long empty halls between them
+std::vector<uint8_t> makeMap()
+{
+    std::vector<uint8_t> map(kMapSize * kMapSize, 0);
+    for (int y = 0; y < kMapSize; ++y)
+    {
+        for (int x = 0; x < kMapSize; ++x)
+        {
+            bool border = x == 0 || y == 0 || x == kMapSize - 1 || y == kMapSize - 1;
+            bool room = ((x / 32) + (y / 32)) % 3 == 0;
+            if (border || (room && rand() % 16 == 0))
+                map[x + kMapSize * y] = uint8_t(1 + rand() % 255);
+        }
+    }
+    return map;
+}
+
+void testPacking(const std::vector<uint8_t>& cells, const GridMap& map)
+{
+    for (int y = 0; y < kMapSize; ++y)
+    {
+        for (int x = 0; x < kMapSize; ++x)
+        {
+            uint8_t cell = cells[x + kMapSize * y];
+            assert(map.solid(x, y) == (cell != 0));
+            if (cell)
+                assert(map.value(x, y) == cell);
+        }
+    }
+
+    for (int y = 0; y < kMapSize; y += GridMap::kBlockSize)
+    {
+        for (int x = 0; x < kMapSize; x += GridMap::kBlockSize)
+        {
+            bool empty = true;
+            for (int i = 0; i < GridMap::kBlockSize * GridMap::kBlockSize; ++i)
+                empty &= !cells[x + i % GridMap::kBlockSize + kMapSize * (y + i / GridMap::kBlockSize)];
+            assert(map.blockEmpty(x, y) == empty);
+        }
+    }
+}
+
+struct PackedMap
+{
+    GridMap map;
+    std::vector<uint8_t> cellBits;
+    std::vector<uint32_t> blockBits;
+    std::vector<uint32_t> firstValue;
+    std::vector<uint8_t> values;
+
+    size_t bytes() const { return cellBits.size() + blockBits.size() * 4 + firstValue.size() * 4 + values.size(); }
+};
+
+void pack(const std::vector<uint8_t>& cells, PackedMap& packed)
+{
+    uint32_t numValues = packGridMap(cells.data(), kMapSize, kMapSize, nullptr, nullptr, nullptr, nullptr, packed.map);
+    packed.cellBits.resize(GridMap::cellBitsSize(kMapSize, kMapSize));
+    packed.blockBits.resize(GridMap::blockBitsSize(kMapSize, kMapSize));
+    packed.firstValue.resize(GridMap::firstValueSize(kMapSize, kMapSize));
+    packed.values.resize(numValues);
+    assert(packGridMap(cells.data(), kMapSize, kMapSize, packed.cellBits.data(), packed.blockBits.data(),
+        packed.firstValue.data(), packed.values.data(), packed.map) == numValues);
+}
+
+// Every cell solid, which is more than 16 bit value indices can address
+void testFullMap()
+{
+    std::vector<uint8_t> cells(kMapSize * kMapSize);
+    for (size_t i = 0; i < cells.size(); ++i)
+        cells[i] = uint8_t(1 + i % 255);
+    PackedMap packed;
+    pack(cells, packed);
+    assert(packed.values.size() == cells.size());
+    testPacking(cells, packed.map);
+}
+
+void testBadSize()
+{
+    std::vector<uint8_t> cells(12 * 12, 1);
+    GridMap map;
+    assert(packGridMap(cells.data(), 12, 12, nullptr, nullptr, nullptr, nullptr, map) == 0);
+    assert(map.blockCols == 0 && map.blockRows == 0);
+}
+
+int main()
+{
+    testFullMap();
+    testBadSize();
+
+    srand(1234);
+    auto cells = makeMap();
+    PackedMap packed;
+    pack(cells, packed);
+    const GridMap& map = packed.map;
+    testPacking(cells, map);
+
+    auto rays = makeRays(cells, kMapSize, 20000);
+    for (auto& ray : rays)
+    {
+        int refHit, refSide;
+        int gridHit, gridSide;
+        intp8 refDistance = rayCast(ray.start, ray.dir, refHit, refSide, cells.data(), kMapSize);
+        intp8 gridDistance = rayCastGrid(ray.start, ray.dir, gridHit, gridSide, map);
+        assert(gridHit == refHit);
+        assert(gridSide == refSide);
+        assert(gridDistance.raw == refDistance.raw);
+    }
+
+    int checksum = 0;
+    double reference = timeRays(rays, [&](const Ray& ray, int& hit, int& side) { return rayCastFast(ray.start, ray.dir, hit, side, cells.data(), kMapSize); }, checksum);
+    double grid = timeRays(rays, [&](const Ray& ray, int& hit, int& side) { return rayCastGrid(ray.start, ray.dir, hit, side, map); }, checksum);
+    size_t packedBytes = packed.bytes();
+    printf("%dx%d map: %zu bytes packed, %zu unpacked. rayCastFast: %.1f ns/ray, rayCastGrid: %.1f ns/ray (checksum %d)\n",
+        kMapSize, kMapSize, packedBytes, cells.size(), reference, grid, checksum);
+    return 0;
+}
@@ -0,0 +1,120 @@
+// Test the clipped run-slice line rasterizer used by the automap
+#include <Rasterizer.h>
+#include <cassert>
+#include <cstdlib>
+#include <vector>
+
+using namespace math;
+
+constexpr int kWidth = 160;
+constexpr int kHeight = 128;
+
+struct Pixel
+{
+    int x, y;
+};
+
+// Records every pixel written by the rasterizer
+struct RecordTarget
+{
+    std::vector<Pixel>* pixels;
+
+    void hRun(int x, int y, int length) const
+    {
+        assert(length > 0);
+        for (int i = 0; i < length; ++i)
+            pixels->push_back({ x + i, y });
+    }
+
+    void vRun(int x, int y, int length) const
+    {
+        assert(length > 0);
+        for (int i = 0; i < length; ++i)
+            pixels->push_back({ x, y + i });
+    }
+};
+
+bool contains(const std::vector<Pixel>& pixels, int x, int y)
+{
+    for (auto& p : pixels)
+    {
+        if (p.x == x && p.y == y)
+            return true;
+    }
+    return false;
+}
+
+void testRunSlice()
+{
+    srand(1);
+    for (int i = 0; i < 10000; ++i)
+    {
+        int x0 = rand() % 200 - 20;
+        int y0 = rand() % 200 - 20;
+        int x1 = rand() % 200 - 20;
+        int y1 = rand() % 200 - 20;
+
+        std::vector<Pixel> pixels;
+        rasterLineRuns(RecordTarget{ &pixels }, x0, y0, x1, y1);
+
+        // One pixel per step along the major axis, both ends included
+        int dx = std::abs(x1 - x0);
+        int dy = std::abs(y1 - y0);
+        assert(int(pixels.size()) == std::max(dx, dy) + 1);
+        assert(contains(pixels, x0, y0));
+        assert(contains(pixels, x1, y1));
+
+        // Every pixel stays within half a pixel of the ideal line along the minor axis
+        int major = std::max(dx, dy);
+        for (auto& p : pixels)
+        {
+            int cross = (p.x - x0) * (y1 - y0) - (p.y - y0) * (x1 - x0);
+            assert(2 * std::abs(cross) <= major + 1 || major == 0);
+        }
+    }
+}
+
+void testClipping()
+{
+    // Fully inside lines are untouched
+    int x0 = 3, y0 = 5, x1 = 150, y1 = 100;
+    assert(clipLine(x0, y0, x1, y1, kWidth, kHeight));
+    assert(x0 == 3 && y0 == 5 && x1 == 150 && y1 == 100);
+
+    // Fully outside on one side
+    x0 = -10; y0 = 5; x1 = -1; y1 = 100;
+    assert(!clipLine(x0, y0, x1, y1, kWidth, kHeight));
+
+    // Crossing the whole screen
+    x0 = -100; y0 = 64; x1 = 300; y1 = 64;
+    assert(clipLine(x0, y0, x1, y1, kWidth, kHeight));
+    assert(x0 == 0 && x1 == kWidth - 1 && y0 == 64 && y1 == 64);
+
+    // Random lines never write outside the screen
+    srand(2);
+    for (int i = 0; i < 10000; ++i)
+    {
+        x0 = rand() % 800 - 400;
+        y0 = rand() % 800 - 400;
+        x1 = rand() % 800 - 400;
+        y1 = rand() % 800 - 400;
+        if (!clipLine(x0, y0, x1, y1, kWidth, kHeight))
+            continue;
+
+        std::vector<Pixel> pixels;
+        rasterLineRuns(RecordTarget{ &pixels }, x0, y0, x1, y1);
+        for (auto& p : pixels)
+        {
+            assert(p.x >= 0 && p.x < kWidth);
+            assert(p.y >= 0 && p.y < kHeight);
+        }
+    }
+}
+
+int main()
+{
+    testRunSlice();
+    testClipping();
+
+    return 0;
+}
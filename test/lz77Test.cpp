@@ -0,0 +1,114 @@
+// Test the LZ77 compressor against the host version of the BIOS decompressor
+#include <lz77.h>
+#include <lz77Compressor.h>
+#include <assetArchive.h>
+#include <assetArchiveWriter.h>
+#include <cassert>
+#include <cstdlib>
+#include <vector>
+
+std::vector<uint8_t> makeData(size_t size, int alphabet)
+{
+    std::vector<uint8_t> data(size);
+    for (auto& x : data)
+        x = uint8_t(rand() % alphabet);
+    return data;
+}
+
+void checkRoundTrip(const std::vector<uint8_t>& data, bool vramSafe)
+{
+    auto packed = lz77::compress(data.data(), data.size(), vramSafe);
+    assert(packed.size() % 4 == 0);
+    assert(packed[0] == lz77::kTypeTag);
+    assert(lz77::decompressedSize(packed.data()) == data.size());
+
+    std::vector<uint8_t> unpacked(data.size() + 1, 0xcd);
+    LZ77UnCompWram(packed.data(), unpacked.data());
+    for (size_t i = 0; i < data.size(); ++i)
+        assert(unpacked[i] == data[i]);
+    assert(unpacked[data.size()] == 0xcd); // No writes past the end
+
+    if (!vramSafe)
+        return;
+
+    // Walk the tokens. No back reference may point at the previous byte.
+    size_t in = 4;
+    size_t out = 0;
+    while (out < data.size())
+    {
+        uint8_t flags = packed[in++];
+        for (int i = 0; i < 8 && out < data.size(); ++i, flags <<= 1)
+        {
+            if (flags & 0x80)
+            {
+                uint32_t distance = (((packed[in] & 0xf) << 8) | packed[in + 1]) + 1;
+                assert(distance >= 2);
+                out += (packed[in] >> 4) + 3;
+                in += 2;
+            }
+            else
+            {
+                ++in;
+                ++out;
+            }
+        }
+    }
+}
+
+void testRoundTrips()
+{
+    srand(1);
+    for (bool vramSafe : { false, true })
+    {
+        checkRoundTrip({}, vramSafe);
+        checkRoundTrip({ 42 }, vramSafe);
+        checkRoundTrip(std::vector<uint8_t>(10000, 7), vramSafe); // Runs
+        checkRoundTrip(makeData(10000, 256), vramSafe); // Incompressible
+        for (int i = 0; i < 50; ++i)
+            checkRoundTrip(makeData(rand() % 5000, 1 + rand() % 8), vramSafe);
+    }
+
+    // Repetitive data actually shrinks
+    auto runs = std::vector<uint8_t>(4096, 0);
+    assert(lz77::compress(runs.data(), runs.size(), false).size() < runs.size() / 4);
+}
+
+void testArchiveEntries()
+{
+    auto compressible = std::vector<uint8_t>(1000, 3);
+    auto noise = makeData(1000, 256);
+
+    assets::ArchiveWriter writer;
+    writer.add("compressible", compressible.data(), compressible.size(), assets::Packing::Auto);
+    writer.add("noise", noise.data(), noise.size(), assets::Packing::Auto);
+    auto archiveData = writer.build();
+    assets::Archive archive(archiveData.data());
+    assert(archive.valid());
+
+    // Only the entry that pays off is compressed
+    assert(archive.entry(assets::hashName("compressible"))->compression == assets::Compression::LZ77);
+    assert(archive.entry(assets::hashName("noise"))->compression == assets::Compression::None);
+    assert(writer.unpackedSize() == compressible.size());
+
+    std::vector<uint8_t> unpackMemory(writer.unpackedSize());
+    uint8_t* unpackBuffer = unpackMemory.data();
+    uint32_t count = 0;
+    auto unpacked = archive.load<uint8_t>("compressible", count, unpackBuffer);
+    assert(unpacked == unpackMemory.data() && count == compressible.size());
+    assert(unpackBuffer == unpackMemory.data() + unpackMemory.size());
+    for (uint32_t i = 0; i < count; ++i)
+        assert(unpacked[i] == compressible[i]);
+
+    // Uncompressed entries stay in place
+    auto inPlace = archive.load<uint8_t>("noise", count, unpackBuffer);
+    assert(inPlace > archiveData.data() && inPlace < archiveData.data() + archiveData.size());
+    assert(count == noise.size() && unpackBuffer == unpackMemory.data() + unpackMemory.size());
+}
+
+int main()
+{
+    testRoundTrips();
+    testArchiveEntries();
+
+    return 0;
+}
@@ -0,0 +1,55 @@
+// Rays and timing shared by the raycaster tests
+#pragma once
+
+#include <linearMath.h>
+#include <vector.h>
+#include <chrono>
+#include <cstdlib>
+#include <vector>
+
+struct Ray
+{
+    math::Vec3p8 start;
+    math::Vec2p8 dir;
+};
+
+// Random rays starting in empty cells of a closed mapSize x mapSize map
+inline std::vector<Ray> makeRays(const std::vector<uint8_t>& map, int mapSize, int count)
+{
+    std::vector<Ray> rays;
+    while (int(rays.size()) < count)
+    {
+        Ray ray{};
+        ray.start.x.raw = 256 + rand() % (256 * (mapSize - 2));
+        ray.start.y.raw = 256 + rand() % (256 * (mapSize - 2));
+        if (map[ray.start.x.floor() + mapSize * ray.start.y.floor()])
+            continue;
+
+        // Every direction in [-2,2], with plenty of axis aligned ones
+        ray.dir.x.raw = rand() % 4 ? rand() % 1025 - 512 : 0;
+        ray.dir.y.raw = rand() % 4 ? rand() % 1025 - 512 : 0;
+        if (!ray.dir.x.raw && !ray.dir.y.raw)
+            continue;
+        rays.push_back(ray);
+    }
+    return rays;
+}
+
+// Average ns per ray of cast(ray, hit, side) over all rays.
+// Host timings only say which raycaster does less work. Use the Timer1 profiler for GBA cycles.
+template<class Cast>
+double timeRays(const std::vector<Ray>& rays, Cast cast, int& checksum)
+{
+    constexpr int kPasses = 20;
+    auto start = std::chrono::steady_clock::now();
+    for (int pass = 0; pass < kPasses; ++pass)
+    {
+        for (auto& ray : rays)
+        {
+            int hit, side;
+            checksum += cast(ray, hit, side).raw + hit + side;
+        }
+    }
+    std::chrono::duration<double, std::nano> elapsed = std::chrono::steady_clock::now() - start;
+    return elapsed.count() / (kPasses * rays.size());
+}
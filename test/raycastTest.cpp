@@ -0,0 +1,54 @@
+// Test the table based grid raycaster against the reference one, and time both
+#include <raycast.h>
+#include "rayTestCommon.h"
+#include <cassert>
+#include <cstdio>
+#include <cstdlib>
+#include <vector>
+
+using namespace math;
+
+constexpr int kMapSize = 16;
+
+std::vector<uint8_t> makeMap()
+{
+    std::vector<uint8_t> map(kMapSize * kMapSize, 0);
+    for (int y = 0; y < kMapSize; ++y)
+    {
+        for (int x = 0; x < kMapSize; ++x)
+        {
+            bool border = x == 0 || y == 0 || x == kMapSize - 1 || y == kMapSize - 1;
+            if (border || rand() % 8 == 0)
+                map[x + kMapSize * y] = uint8_t(1 + rand() % 3);
+        }
+    }
+    return map;
+}
+
+void testMatchesReference(const std::vector<uint8_t>& map, const std::vector<Ray>& rays)
+{
+    for (auto& ray : rays)
+    {
+        int refHit, refSide;
+        int fastHit, fastSide;
+        intp8 refDistance = rayCast(ray.start, ray.dir, refHit, refSide, map.data(), kMapSize);
+        intp8 fastDistance = rayCastFast(ray.start, ray.dir, fastHit, fastSide, map.data(), kMapSize);
+        assert(fastHit == refHit);
+        assert(fastSide == refSide);
+        assert(fastDistance.raw == refDistance.raw);
+    }
+}
+
+int main()
+{
+    srand(1234);
+    auto map = makeMap();
+    auto rays = makeRays(map, kMapSize, 20000);
+    testMatchesReference(map, rays);
+
+    int checksum = 0;
+    double reference = timeRays(rays, [&](const Ray& ray, int& hit, int& side) { return rayCast(ray.start, ray.dir, hit, side, map.data(), kMapSize); }, checksum);
+    double fast = timeRays(rays, [&](const Ray& ray, int& hit, int& side) { return rayCastFast(ray.start, ray.dir, hit, side, map.data(), kMapSize); }, checksum);
+    printf("rayCast: %.1f ns/ray, rayCastFast: %.1f ns/ray (checksum %d)\n", reference, fast, checksum);
+    return 0;
+}
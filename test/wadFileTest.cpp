@@ -0,0 +1,115 @@
+// Test the memory mapped WAD reader
+#include <wadFile.h>
+#include <cassert>
+#include <cstdio>
+#include <fstream>
+#include <string>
+#include <vector>
+
+struct TestLump
+{
+    std::string name;
+    std::vector<uint8_t> data;
+};
+
+// Header, then lump data, then the directory, like most tools write them
+bool writeWAD(const char* fileName, const char* magic, const std::vector<TestLump>& lumps)
+{
+    std::vector<uint8_t> data;
+    std::vector<WAD::Lump> directory;
+    for (auto& lump : lumps)
+    {
+        WAD::Lump& entry = directory.emplace_back();
+        entry.dataOffset = int32_t(sizeof(WAD::Header) + data.size());
+        entry.dataSize = int32_t(lump.data.size());
+        memset(entry.lumpName, 0, sizeof(entry.lumpName));
+        memcpy(entry.lumpName, lump.name.data(), std::min<size_t>(lump.name.size(), 8));
+        data.insert(data.end(), lump.data.begin(), lump.data.end());
+    }
+
+    WAD::Header header;
+    memcpy(&header.Signature, magic, 4);
+    header.numLumps = int32_t(directory.size());
+    header.dirOffset = int32_t(sizeof(WAD::Header) + data.size());
+
+    std::ofstream file(fileName, std::ios_base::binary);
+    file.write(reinterpret_cast<const char*>(&header), sizeof(header));
+    file.write(reinterpret_cast<const char*>(data.data()), data.size());
+    file.write(reinterpret_cast<const char*>(directory.data()), directory.size() * sizeof(WAD::Lump));
+    return file.good();
+}
+
+void testLookup()
+{
+    const char* fileName = "wadFileTest.wad";
+    std::vector<TestLump> lumps = {
+        { "E1M1", {} },
+        { "THINGS", { 1, 2 } },
+        { "VERTEXES", { 1, 0, 2, 0, 3, 0, 4, 0 } },
+        { "E1M2", {} },
+        { "THINGS", { 3 } },
+        { "VERTEXES", { 5, 0, 6, 0 } },
+        { "PLAYPAL", { 7, 7, 7 } },
+    };
+    assert(writeWAD(fileName, "IWAD", lumps));
+    {
+        WadFile wad(fileName);
+        assert(wad.isOpen() && wad.isIWAD());
+        assert(wad.numLumps() == int(lumps.size()));
+        assert(wad.lumpName(3) == "E1M2");
+
+        // First match, or the first match within a range
+        assert(wad.find("VERTEXES") == 2);
+        assert(wad.find("VERTEXES", 3) == 5);
+        assert(wad.find("VERTEXES", 3, 5) == WadFile::kNotFound);
+        assert(wad.find("MISSING") == WadFile::kNotFound);
+        assert(wad.findAll("THINGS").size() == 2);
+
+        // Case doesn't matter, and 8 character names have no terminator
+        assert(wad.find("playpal") == 6);
+
+        // Lumps are views into the file
+        auto vertices = wad.lumpAs<int16_t>(wad.find("VERTEXES", 3));
+        assert(vertices.size() == 2 && vertices[0] == 5 && vertices[1] == 6);
+        assert(wad.lumpData(6).size() == 3 && wad.lumpData(6)[2] == 7);
+    }
+    std::remove(fileName);
+}
+
+void testValidation()
+{
+    const char* fileName = "wadFileTest.wad";
+
+    // Wrong magic
+    assert(writeWAD(fileName, "ZWAD", { { "THINGS", { 1 } } }));
+    assert(!WadFile(fileName).isOpen());
+
+    // PWADs are fine too
+    assert(writeWAD(fileName, "PWAD", { { "THINGS", { 1 } } }));
+    WadFile pwad(fileName);
+    assert(pwad.isOpen() && !pwad.isIWAD());
+    pwad.close();
+
+    // Truncated directory
+    {
+        std::ofstream file(fileName, std::ios_base::binary);
+        WAD::Header header;
+        memcpy(&header.Signature, "PWAD", 4);
+        header.numLumps = 100;
+        header.dirOffset = sizeof(WAD::Header);
+        file.write(reinterpret_cast<const char*>(&header), sizeof(header));
+    }
+    assert(!WadFile(fileName).isOpen());
+
+    // Missing file
+    std::remove(fileName);
+    assert(!WadFile(fileName).isOpen());
+}
+
+int main()
+{
+    testLookup();
+    testValidation();
+
+    return 0;
+}
@@ -9,6 +9,7 @@
 
 #include <gfx/tile.h>
 #include <imageUtils.h>
+#include <assetArchiveWriter.h>
 
 #define STB_IMAGE_IMPLEMENTATION
 #include "stb_image.h"
@@ -132,6 +133,100 @@ void buildMapAffineBackground(const RawImage& srcImage, const std::string& input
     std::cout << "Map Size: " << palettizedMap.width << "x" << palettizedMap.height << "\n";
 }
 
+// Builds a full mip chain for a wall texture, with texels stored in column major order.
+// Wall renderers walk textures down columns, so this keeps each column sequential in ROM.
+// Mips are stored back to back, from full resolution to a single row or column.
+// Texels are indices into a palette shared by all mips, with 0 reserved for transparency, like the textures wadToCpp emits.
+// With writeArchive, texels go into a binary archive linked with .incbin instead of a generated cpp file.
+bool buildMipTexture(const RawImage& srcImage, const std::string& tag, bool writeArchive, assets::Packing packing)
+{
+    auto isPow2 = [](int32_t x) { return x > 0 && (x & (x - 1)) == 0; };
+    if (!isPow2(srcImage.width) || !isPow2(srcImage.height))
+    {
+        std::cout << "Texture size must be a power of two\n";
+        return false;
+    }
+
+    auto log2 = [](int32_t x) { uint32_t n = 0; while (x > 1) { x >>= 1; ++n; } return n; };
+    uint32_t log2Width = log2(srcImage.width);
+    uint32_t log2Height = log2(srcImage.height);
+    uint32_t numMips = std::min(log2Width, log2Height) + 1;
+
+    // Gather all mips into a single strip, so they are palettized together
+    Image16bit strip;
+    std::vector<uint32_t> mipOffsets;
+    Image16bit mip = Image16bit(srcImage);
+    for (uint32_t level = 0; level < numMips; ++level)
+    {
+        mipOffsets.push_back(uint32_t(strip.pixels.size()));
+        for (int x = 0; x < mip.width; ++x)
+        {
+            for (int y = 0; y < mip.height; ++y)
+            {
+                strip.pixels.push_back(mip.at(x, y));
+            }
+        }
+        mip = mip.downsample();
+    }
+    uint32_t numTexels = uint32_t(strip.pixels.size());
+    strip.width = int32_t(numTexels);
+    strip.height = 1;
+
+    PaletteImage8 palettized(strip);
+    auto& palette = palettized.palette;
+    if (palette.size() > 256)
+    {
+        std::cout << "Texture has " << palette.size() - 1 << " colors counting its mips. Only 255 fit in the palette\n";
+        return false;
+    }
+    std::vector<uint8_t>& texels = palettized.pixels;
+    // Keep the buffer a multiple of 4 bytes
+    texels.resize((texels.size() + 3) & ~3, 0);
+
+    // --- Serialize data ---
+    std::string name = std::filesystem::path(tag).filename().string();
+    std::ofstream outHeader(tag + ".h");
+    outHeader << "#pragma once\n#include <cstdint>\n\n";
+    outHeader << "constexpr uint32_t " << name << "Log2Width = " << log2Width << ";\n";
+    outHeader << "constexpr uint32_t " << name << "Log2Height = " << log2Height << ";\n";
+    outHeader << "constexpr uint32_t " << name << "MipCount = " << numMips << ";\n";
+    outHeader << "constexpr uint32_t " << name << "MipOffsets[" << numMips << "] = { ";
+    for (uint32_t level = 0; level < numMips; ++level)
+    {
+        outHeader << mipOffsets[level] << (level + 1 < numMips ? ", " : " };\n\n");
+    }
+    if (writeArchive)
+    {
+        assets::ArchiveWriter archive;
+        archive.add(name + "Texels", texels.data(), texels.size(), packing);
+        archive.add(name + "Palette", palette.data(), palette.size() * sizeof(Color16b), packing);
+        if (!archive.save(tag + ".bin")
+            || !assets::ArchiveWriter::writeIncbin(tag + ".s", name + ".bin", name + "Archive"))
+        {
+            std::cout << "Unable to write archive " << tag << ".bin\n";
+            return false;
+        }
+        outHeader << "// Linked in from " << name << ".s. Look up " << name << "Texels and " << name << "Palette in it.\n";
+        outHeader << "extern \"C\" const uint32_t " << name << "Archive[];\n";
+        outHeader << "constexpr uint32_t " << name << "UnpackedSize = " << archive.unpackedSize() << ";\n";
+    }
+    else
+    {
+        std::ofstream outCppFile(tag + ".cpp");
+        outCppFile << "#include \"" << name << ".h\"\n\n";
+
+        appendBuffer(outCppFile, outHeader, name + "Texels", texels.data(), texels.size());
+        appendBuffer(outCppFile, outHeader, name + "Palette", palette.data(), palette.size() * sizeof(Color16b));
+    }
+
+    // Print stats
+    std::cout << "Texture size: " << srcImage.width << "x" << srcImage.height << "\n";
+    std::cout << "Mip levels: " << numMips << "\n";
+    std::cout << "Total texels: " << numTexels << "\n";
+    std::cout << "Palette size: " << palette.size() << "\n";
+    return true;
+}
+
 enum class ColorFormat
 {
     e15bit,
@@ -145,6 +240,9 @@ struct ProgramOptions
     bool breakdownTiles = false;
     bool palettize = false;
     bool saveTilemap = false;
+    bool mipTexture = false;
+    bool writeArchive = false;
+    assets::Packing packing = assets::Packing::Raw;
     ColorFormat targetColor = ColorFormat::e256;
     std::string output;
 
@@ -171,6 +269,19 @@ struct ProgramOptions
             {
                 breakdownTiles = true;
             }
+            else if (argi == "--texture")
+            {
+                mipTexture = true;
+            }
+            else if (argi == "--archive")
+            {
+                writeArchive = true;
+            }
+            else if (argi == "--lz77")
+            {
+                writeArchive = true;
+                packing = assets::Packing::Auto;
+            }
             else if (argi == "--out" && i+1 < _argc)
             {
                 output = _argv[++i];
@@ -271,6 +382,12 @@ int main(int _argc, const char** _argv)
         return 0;
     }
 
+    // Direct color wall textures with mips
+    if (programOptions.mipTexture)
+    {
+        return buildMipTexture(srcImage, programOptions.output, programOptions.writeArchive, programOptions.packing) ? 0 : -1;
+    }
+
     // Discretize colors
     Image16bit image16 = Image16bit(srcImage);
 
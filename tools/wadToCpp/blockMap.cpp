@@ -0,0 +1,85 @@
+#include "blockMap.h"
+
+using namespace WAD;
+
+namespace
+{
+    // Whether the segment touches the box [x0,x1]x[y0,y1]. Coordinates are raw .16
+    bool segmentTouchesBox(const Vertex& a, const Vertex& b, int32_t x0, int32_t y0, int32_t x1, int32_t y1)
+    {
+        int32_t ax = a.x.raw, ay = a.y.raw;
+        int32_t bx = b.x.raw, by = b.y.raw;
+        if ((ax < x0 && bx < x0) || (ax > x1 && bx > x1) || (ay < y0 && by < y0) || (ay > y1 && by > y1))
+            return false;
+
+        // Bounding boxes overlap, so the segment touches the box unless all corners are on the same side of it
+        int64_t dx = bx - ax;
+        int64_t dy = by - ay;
+        bool anyFront = false, anyBack = false;
+        for (int32_t cx : { x0, x1 })
+        {
+            for (int32_t cy : { y0, y1 })
+            {
+                int64_t cross = dx * (cy - ay) - dy * (cx - ax);
+                anyFront |= cross >= 0;
+                anyBack |= cross <= 0;
+            }
+        }
+        return anyFront && anyBack;
+    }
+}
+
+uint32_t buildBlockMap(const LevelData& level, uint16_t* dst)
+{
+    if (!level.numLineDefs)
+        return 0;
+
+    int32_t minX = 0x7fff, minY = 0x7fff, maxX = -0x8000, maxY = -0x8000;
+    for (uint32_t i = 0; i < level.numLineDefs; ++i)
+    {
+        for (uint16_t v : { level.lineDefs[i].v0, level.lineDefs[i].v1 })
+        {
+            int32_t x = level.vertices[v].x >> kPackedVertexShift;
+            int32_t y = level.vertices[v].y >> kPackedVertexShift;
+            minX = x < minX ? x : minX;
+            minY = y < minY ? y : minY;
+            maxX = x > maxX ? x : maxX;
+            maxY = y > maxY ? y : maxY;
+        }
+    }
+
+    BlockMapHeader header;
+    header.originX = int16_t(minX);
+    header.originY = int16_t(minY);
+    header.numCols = uint16_t(((maxX - minX) >> kBlockShift) + 1);
+    header.numRows = uint16_t(((maxY - minY) >> kBlockShift) + 1);
+    if (dst)
+        *reinterpret_cast<BlockMapHeader*>(dst) = header;
+
+    constexpr int32_t kCellSize = 1 << (kBlockShift + 16); // Raw .16
+    uint32_t size = kBlockMapHeaderSize + header.numCols * header.numRows;
+    for (uint32_t row = 0; row < header.numRows; ++row)
+    {
+        int32_t y0 = (minY << 16) + int32_t(row) * kCellSize;
+        for (uint32_t col = 0; col < header.numCols; ++col)
+        {
+            int32_t x0 = (minX << 16) + int32_t(col) * kCellSize;
+            if (dst)
+                dst[kBlockMapHeaderSize + row * header.numCols + col] = uint16_t(size);
+            for (uint32_t i = 0; i < level.numLineDefs; ++i)
+            {
+                auto& lineDef = level.lineDefs[i];
+                if (segmentTouchesBox(level.vertices[lineDef.v0].unpack(), level.vertices[lineDef.v1].unpack(), x0, y0, x0 + kCellSize, y0 + kCellSize))
+                {
+                    if (dst)
+                        dst[size] = uint16_t(i);
+                    ++size;
+                }
+            }
+            if (dst)
+                dst[size] = kBlockListEnd;
+            ++size;
+        }
+    }
+    return size;
+}
@@ -0,0 +1,9 @@
+#pragma once
+
+#include <cstdint>
+#include <WAD.h>
+
+// Builds the blockmap of a level into dst (see WAD::BlockMapHeader), or only measures it when dst is null.
+// Returns its size in uint16_t, which must stay below 64K for the offsets to fit.
+// Tests every linedef against every cell, which is why it runs here and the game loads the result from ROM.
+uint32_t buildBlockMap(const WAD::LevelData& level, uint16_t* dst);
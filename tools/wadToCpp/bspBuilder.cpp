@@ -0,0 +1,464 @@
+#include "bspBuilder.h"
+
+#include <algorithm>
+#include <atomic>
+#include <cmath>
+#include <thread>
+
+namespace
+{
+    struct Vec2d
+    {
+        double x, y;
+
+        Vec2d operator+(const Vec2d& b) const { return { x + b.x, y + b.y }; }
+        Vec2d operator-(const Vec2d& b) const { return { x - b.x, y - b.y }; }
+        Vec2d operator*(double s) const { return { x * s, y * s }; }
+    };
+
+    double cross(const Vec2d& a, const Vec2d& b) { return a.x * b.y - a.y * b.x; }
+    double dot(const Vec2d& a, const Vec2d& b) { return a.x * b.x + a.y * b.y; }
+    double length(const Vec2d& a) { return std::sqrt(a.x * a.x + a.y * a.y); }
+
+    constexpr double kDoomUnitsPerUnit = 1 << WAD::kPackedVertexShift;
+
+    Vec2d toVec2d(const WAD::PackedVertex& v)
+    {
+        return { v.x / kDoomUnitsPerUnit, v.y / kDoomUnitsPerUnit };
+    }
+
+    constexpr double kOnLineEpsilon = 1.0 / 1024; // World units
+    constexpr uint16_t kLeafFlag = 1 << 15;
+
+    // Splitting a seg costs clipping one more seg every frame. Imbalance only costs depth in the point locator,
+    // which runs once per frame and usually early outs, so it weighs much less.
+    constexpr double kSplitWeight = bspCost::kSegCycles;
+    constexpr double kImbalanceWeight = bspCost::kNodeCycles / 16.0;
+
+    // Below this many seg tests per node, spawning threads costs more than it saves
+    constexpr size_t kMinParallelWork = 1 << 14;
+
+    struct BuildSeg
+    {
+        Vec2d a, b;
+        int32_t v0, v1;
+        int16_t lineDef;
+        int16_t direction;
+        double offset; // Doom units along the linedef, from the start of this side
+        uint16_t sector;
+    };
+
+    struct Partition
+    {
+        Vec2d origin;
+        Vec2d dir;
+        double invLength;
+
+        // Positive in front, which is the right hand side of dir, like WAD segs and the renderer's side()
+        double distance(const Vec2d& p) const { return cross(p - origin, dir) * invLength; }
+    };
+
+    enum class Side { Front, Back, Split };
+
+    Side classify(const Partition& partition, const BuildSeg& seg, double& da, double& db)
+    {
+        da = partition.distance(seg.a);
+        db = partition.distance(seg.b);
+        bool aOn = std::abs(da) <= kOnLineEpsilon;
+        bool bOn = std::abs(db) <= kOnLineEpsilon;
+        if (aOn && bOn) // Collinear, goes with the side it faces
+            return dot(seg.b - seg.a, partition.dir) > 0 ? Side::Front : Side::Back;
+        if ((da >= 0 || aOn) && (db >= 0 || bOn))
+            return Side::Front;
+        if ((da <= 0 || aOn) && (db <= 0 || bOn))
+            return Side::Back;
+        return Side::Split;
+    }
+
+    struct Score
+    {
+        double cost;
+        uint32_t front, back, splits;
+        uint32_t offLine; // Split vertices that rounding moves off the partition line
+    };
+
+    class Builder
+    {
+    public:
+        Builder(const WAD::LevelData& level, uint32_t numVertices, unsigned numThreads, BSPBuildResult& result, std::ostream& log)
+            : m_level(level), m_result(result), m_log(log)
+        {
+            m_result.vertices.assign(level.vertices, level.vertices + numVertices);
+            m_numThreads = std::max(1u, numThreads);
+        }
+
+        uint16_t build(std::vector<BuildSeg>& segs)
+        {
+            if (isLeaf(segs))
+                return emitLeaf(segs);
+
+            Partition partition;
+            if (!pickPartition(segs, partition) && !sectorPartition(segs, partition))
+            {
+                m_log << "Warning: no partition separates " << segs.size() << " segs, leaving them in one subsector\n";
+                return emitLeaf(segs);
+            }
+
+            std::vector<BuildSeg> front, back;
+            split(segs, partition, front, back);
+            segs.clear();
+            segs.shrink_to_fit();
+
+            if (front.empty() || back.empty()) // Can only happen on broken maps
+            {
+                m_log << "Warning: degenerate BSP split, leaving " << front.size() + back.size() << " segs in one subsector\n";
+                auto& all = front.empty() ? back : front;
+                return emitLeaf(all);
+            }
+
+            WAD::Node node{};
+            node.plane.origin = toVertex(partition.origin);
+            node.plane.dir = toVertex(partition.dir);
+            node.aabb[0] = bounds(front);
+            node.aabb[1] = bounds(back);
+            node.child[0] = build(front);
+            node.child[1] = build(back);
+            m_result.nodes.push_back(node);
+            return uint16_t(m_result.nodes.size() - 1);
+        }
+
+    private:
+        // Rounds to whole doom units, like Doom's node builders do with split vertices
+        static WAD::PackedVertex toVertex(const Vec2d& v)
+        {
+            WAD::PackedVertex result;
+            result.x = int16_t(std::lround(v.x * kDoomUnitsPerUnit));
+            result.y = int16_t(std::lround(v.y * kDoomUnitsPerUnit));
+            return result;
+        }
+
+        // In Doom units, like the AABBs of the original nodes
+        static WAD::AABB bounds(const std::vector<BuildSeg>& segs)
+        {
+            double minX = segs[0].a.x, maxX = minX;
+            double minY = segs[0].a.y, maxY = minY;
+            for (auto& s : segs)
+            {
+                minX = std::min({ minX, s.a.x, s.b.x });
+                maxX = std::max({ maxX, s.a.x, s.b.x });
+                minY = std::min({ minY, s.a.y, s.b.y });
+                maxY = std::max({ maxY, s.a.y, s.b.y });
+            }
+            WAD::AABB aabb;
+            aabb.left.raw = int16_t(std::floor(minX * kDoomUnitsPerUnit));
+            aabb.right.raw = int16_t(std::ceil(maxX * kDoomUnitsPerUnit));
+            aabb.bottom.raw = int16_t(std::floor(minY * kDoomUnitsPerUnit));
+            aabb.top.raw = int16_t(std::ceil(maxY * kDoomUnitsPerUnit));
+            return aabb;
+        }
+
+        // Convex and within a single sector. The renderer takes the sector of a subsector from its first seg.
+        // Pieces of the same linedef are collinear, even when their rounded split vertices are slightly off it.
+        bool isLeaf(const std::vector<BuildSeg>& segs) const
+        {
+            for (auto& s : segs)
+            {
+                if (s.sector != segs[0].sector)
+                    return false;
+            }
+            for (auto& s : segs)
+            {
+                Partition p = partitionOf(s);
+                for (auto& t : segs)
+                {
+                    if (t.lineDef == s.lineDef)
+                        continue;
+                    if (p.distance(t.a) < -kOnLineEpsilon || p.distance(t.b) < -kOnLineEpsilon)
+                        return false;
+                }
+            }
+            return true;
+        }
+
+        uint16_t emitLeaf(const std::vector<BuildSeg>& segs)
+        {
+            WAD::SubSector subSector;
+            subSector.firstSegment = int16_t(m_result.segments.size());
+            subSector.segmentCount = int16_t(segs.size());
+            for (auto& s : segs)
+            {
+                auto& seg = m_result.segments.emplace_back();
+                seg.startVertex = int16_t(s.v0);
+                seg.endVertex = int16_t(s.v1);
+                seg.angle = segAngle(s);
+                seg.linedefNum = s.lineDef;
+                seg.direction = s.direction;
+                seg.offset.raw = int16_t(std::lround(s.offset));
+            }
+            m_result.subSectors.push_back(subSector);
+            return uint16_t(kLeafFlag | (m_result.subSectors.size() - 1));
+        }
+
+        // Binary angle of the side, taken from the whole linedef so that split pieces keep exact axis angles
+        int16_t segAngle(const BuildSeg& s) const
+        {
+            auto& lineDef = m_level.lineDefs[s.lineDef];
+            Vec2d dir = toVec2d(m_level.vertices[lineDef.v1]) - toVec2d(m_level.vertices[lineDef.v0]);
+            if (s.direction)
+                dir = dir * -1;
+            const double pi = std::acos(-1.0);
+            long bam = std::lround(std::atan2(dir.y, dir.x) / (2 * pi) * 65536);
+            return int16_t(uint16_t(bam & 0xffff));
+        }
+
+        // The supporting line of the seg's linedef, facing the same way as the seg.
+        // Using the whole linedef keeps the plane direction long, which the renderer's fixed point side test needs.
+        Partition partitionOf(const BuildSeg& s) const
+        {
+            auto& lineDef = m_level.lineDefs[s.lineDef];
+            Vec2d v0 = toVec2d(m_level.vertices[lineDef.v0]);
+            Vec2d v1 = toVec2d(m_level.vertices[lineDef.v1]);
+            Partition p;
+            p.origin = s.direction ? v1 : v0;
+            p.dir = s.direction ? v0 - v1 : v1 - v0;
+            p.invLength = 1 / length(p.dir);
+            return p;
+        }
+
+        // Where the seg crosses the partition, rounded to whole doom units like every stored vertex
+        static WAD::PackedVertex splitVertex(const BuildSeg& seg, double da, double db)
+        {
+            double t = da / (da - db);
+            return toVertex(seg.a + (seg.b - seg.a) * t);
+        }
+
+        Score score(const std::vector<BuildSeg>& segs, const Partition& partition) const
+        {
+            Score s{ 0, 0, 0, 0, 0 };
+            for (auto& seg : segs)
+            {
+                double da, db;
+                switch (classify(partition, seg, da, db))
+                {
+                case Side::Front: ++s.front; break;
+                case Side::Back: ++s.back; break;
+                default:
+                    ++s.front;
+                    ++s.back;
+                    ++s.splits;
+                    if (std::abs(partition.distance(toVec2d(splitVertex(seg, da, db)))) > kOnLineEpsilon)
+                        ++s.offLine;
+                    break;
+                }
+            }
+            double imbalance = std::abs(double(s.front) - double(s.back));
+            s.cost = s.splits * kSplitWeight + imbalance * kImbalanceWeight;
+            return s;
+        }
+
+        // Whether a is a better partition than b. Both must leave segs on each side.
+        // A split vertex off the partition line would leave one of its pieces across it, so those only go if nothing else does.
+        static bool better(const Score& a, const Score& b)
+        {
+            if ((a.offLine == 0) != (b.offLine == 0))
+                return a.offLine == 0;
+            return a.cost < b.cost;
+        }
+
+        // Best linedef to split the set with. Fails when no linedef leaves segs on both sides.
+        bool pickPartition(const std::vector<BuildSeg>& segs, Partition& best) const
+        {
+            // One candidate per linedef and side
+            std::vector<size_t> candidates;
+            std::vector<uint8_t> seen(2 * m_level.numLineDefs, 0);
+            for (size_t i = 0; i < segs.size(); ++i)
+            {
+                auto& flag = seen[2 * segs[i].lineDef + segs[i].direction];
+                if (!flag)
+                    candidates.push_back(i);
+                flag = 1;
+            }
+
+            std::vector<Score> scores(candidates.size());
+            std::atomic<size_t> next = 0;
+            auto worker = [&]()
+            {
+                for (size_t i = next++; i < candidates.size(); i = next++)
+                    scores[i] = score(segs, partitionOf(segs[candidates[i]]));
+            };
+
+            size_t work = candidates.size() * segs.size();
+            unsigned numThreads = work < kMinParallelWork ? 1 : m_numThreads;
+            std::vector<std::thread> threads;
+            for (unsigned t = 1; t < numThreads; ++t)
+                threads.emplace_back(worker);
+            worker();
+            for (auto& t : threads)
+                t.join();
+
+            int bestIndex = -1;
+            for (size_t i = 0; i < candidates.size(); ++i)
+            {
+                if (!scores[i].front || !scores[i].back)
+                    continue;
+                if (bestIndex < 0 || better(scores[i], scores[bestIndex]))
+                    bestIndex = int(i);
+            }
+            if (bestIndex < 0)
+                return false;
+            best = partitionOf(segs[candidates[bestIndex]]);
+            return true;
+        }
+
+        // Convex sets that still hold more than one sector, e.g. facing walls of two rooms with nothing between them.
+        // Tries the lines through every two vertices of the set. Those are whole doom units, so the node plane is stored exactly.
+        // Fails when none of them leaves segs on both sides.
+        bool sectorPartition(const std::vector<BuildSeg>& segs, Partition& best) const
+        {
+            std::vector<int32_t> vertices;
+            for (auto& s : segs)
+            {
+                vertices.push_back(s.v0);
+                vertices.push_back(s.v1);
+            }
+            std::sort(vertices.begin(), vertices.end());
+            vertices.erase(std::unique(vertices.begin(), vertices.end()), vertices.end());
+
+            bool found = false;
+            Score bestScore{};
+            for (size_t i = 0; i < vertices.size(); ++i)
+            {
+                for (size_t j = i + 1; j < vertices.size(); ++j)
+                {
+                    Partition p;
+                    p.origin = toVec2d(m_result.vertices[vertices[i]]);
+                    p.dir = toVec2d(m_result.vertices[vertices[j]]) - p.origin;
+                    double len = length(p.dir);
+                    if (len == 0)
+                        continue;
+                    p.invLength = 1 / len;
+
+                    Score s = score(segs, p);
+                    if (!s.front || !s.back)
+                        continue;
+                    if (!found || better(s, bestScore))
+                    {
+                        best = p;
+                        bestScore = s;
+                        found = true;
+                    }
+                }
+            }
+            return found;
+        }
+
+        void split(const std::vector<BuildSeg>& segs, const Partition& partition, std::vector<BuildSeg>& front, std::vector<BuildSeg>& back)
+        {
+            for (auto& seg : segs)
+            {
+                double da, db;
+                switch (classify(partition, seg, da, db))
+                {
+                case Side::Front: front.push_back(seg); break;
+                case Side::Back: back.push_back(seg); break;
+                default:
+                {
+                    WAD::PackedVertex v = splitVertex(seg, da, db);
+                    if (std::abs(partition.distance(toVec2d(v))) > kOnLineEpsilon)
+                        m_log << "Warning: split vertex at (" << v.x << ", " << v.y << ") rounded off its partition line\n";
+                    int32_t vIndex = int32_t(m_result.vertices.size());
+                    m_result.vertices.push_back(v);
+
+                    BuildSeg first = seg;
+                    BuildSeg second = seg;
+                    first.b = second.a = toVec2d(v);
+                    first.v1 = second.v0 = vIndex;
+                    second.offset = seg.offset + length(second.a - seg.a) * kDoomUnitsPerUnit;
+                    (da > 0 ? front : back).push_back(first);
+                    (da > 0 ? back : front).push_back(second);
+                    break;
+                }
+                }
+            }
+        }
+
+        const WAD::LevelData& m_level;
+        BSPBuildResult& m_result;
+        std::ostream& m_log;
+        unsigned m_numThreads;
+    };
+
+    void measureNode(const WAD::LevelData& level, uint16_t nodeIndex, uint32_t depth, BSPStats& stats, uint64_t& depthSum, uint32_t& numLeaves)
+    {
+        if (nodeIndex & kLeafFlag)
+        {
+            stats.maxDepth = std::max(stats.maxDepth, depth);
+            depthSum += depth;
+            ++numLeaves;
+            return;
+        }
+        auto& node = level.nodes[nodeIndex];
+        measureNode(level, node.child[0], depth + 1, stats, depthSum, numLeaves);
+        measureNode(level, node.child[1], depth + 1, stats, depthSum, numLeaves);
+    }
+}
+
+BSPStats measureBSP(const WAD::LevelData& level, uint32_t numSubsectors, uint32_t numSegments)
+{
+    BSPStats stats;
+    stats.numNodes = level.numNodes;
+    stats.numSubsectors = numSubsectors;
+    stats.numSegments = numSegments;
+    stats.traversalCycles = uint64_t(stats.numNodes) * bspCost::kNodeCycles
+        + uint64_t(numSubsectors) * bspCost::kLeafCycles
+        + uint64_t(numSegments) * bspCost::kSegCycles;
+
+    if (!level.numNodes)
+        return stats;
+    uint64_t depthSum = 0;
+    uint32_t numLeaves = 0;
+    measureNode(level, uint16_t(level.numNodes - 1), 0, stats, depthSum, numLeaves);
+    stats.meanLeafDepth = numLeaves ? double(depthSum) / numLeaves : 0;
+    return stats;
+}
+
+BSPBuildResult buildBSP(const WAD::LevelData& level, uint32_t numVertices, unsigned numThreads, std::ostream& log)
+{
+    BSPBuildResult result;
+
+    // One seg per linedef side
+    std::vector<BuildSeg> segs;
+    for (uint32_t i = 0; i < level.numLineDefs; ++i)
+    {
+        auto& lineDef = level.lineDefs[i];
+        for (int16_t direction = 0; direction < 2; ++direction)
+        {
+            if (lineDef.SideNum[direction] == 0xffff)
+                continue;
+            BuildSeg& seg = segs.emplace_back();
+            seg.v0 = direction ? lineDef.v1 : lineDef.v0;
+            seg.v1 = direction ? lineDef.v0 : lineDef.v1;
+            seg.a = toVec2d(level.vertices[seg.v0]);
+            seg.b = toVec2d(level.vertices[seg.v1]);
+            seg.lineDef = int16_t(i);
+            seg.direction = direction;
+            seg.offset = 0;
+            seg.sector = level.sideDefs[lineDef.SideNum[direction]].sector;
+        }
+    }
+
+    Builder builder(level, numVertices, numThreads, result, log);
+    uint16_t root = builder.build(segs);
+    if (root & kLeafFlag) // A single convex room still needs a node for the renderer to start from
+    {
+        // Everything is in front of a plane far below the level. The back child is an empty subsector.
+        WAD::Node node{};
+        node.plane.origin.y = INT16_MIN;
+        node.plane.dir.x = -1 << WAD::kPackedVertexShift;
+        node.child[0] = root;
+        node.child[1] = uint16_t(kLeafFlag | result.subSectors.size());
+        result.subSectors.push_back({ 0, int16_t(result.segments.size()) });
+        result.nodes.push_back(node);
+    }
+    return result;
+}
@@ -0,0 +1,234 @@
+#include "bspLayout.h"
+
+#include <vector>
+
+namespace
+{
+    constexpr uint16_t kLeafFlag = 1 << 15;
+    constexpr uint32_t kUnassigned = ~0u;
+
+    double toDouble(int16_t packed) { return packed / double(1 << WAD::kPackedVertexShift); }
+
+    // Same test as the renderer, in floating point
+    int side(const WAD::Plane& plane, double x, double y)
+    {
+        double relX = x - toDouble(plane.origin.x);
+        double relY = y - toDouble(plane.origin.y);
+        double cross = relX * toDouble(plane.dir.y) - relY * toDouble(plane.dir.x);
+        return cross > 0 ? 0 : 1;
+    }
+
+    // Counts reads that continue where the previous read of the same array left off
+    struct AccessStream
+    {
+        uint32_t last = kUnassigned;
+        uint64_t sequential = 0;
+        uint64_t total = 0;
+
+        void read(uint32_t element)
+        {
+            if (element == last || element == last + 1)
+                ++sequential;
+            ++total;
+            last = element;
+        }
+
+        double ratio() const { return total ? double(sequential) / total : 0; }
+    };
+
+    struct TraversalRecorder
+    {
+        const WAD::LevelData& level;
+        double x, y;
+        AccessStream nodes, subSectors, segs, vertices;
+
+        void visit(uint16_t nodeIndex)
+        {
+            if (nodeIndex & kLeafFlag)
+            {
+                uint32_t ss = nodeIndex & ~kLeafFlag;
+                subSectors.read(ss);
+                auto& subSector = level.subSectors[ss];
+                for (int i = 0; i < subSector.segmentCount; ++i)
+                {
+                    auto& seg = level.segments[subSector.firstSegment + i];
+                    segs.read(subSector.firstSegment + i);
+                    vertices.read(seg.startVertex);
+                    vertices.read(seg.endVertex);
+                }
+                return;
+            }
+            nodes.read(nodeIndex);
+            auto& node = level.nodes[nodeIndex];
+            int front = side(node.plane, x, y);
+            visit(node.child[front]);
+            visit(node.child[front ^ 1]);
+        }
+    };
+
+    struct Renumbering
+    {
+        const WAD::LevelData& level;
+        std::vector<uint32_t> nodeOrder; // Old node index for each new slot, excluding the root
+        std::vector<uint32_t> subSectorOrder; // Old subsector index for each new slot
+        std::vector<uint32_t> newNode;
+        std::vector<uint32_t> newSubSector;
+
+        void visit(uint16_t nodeIndex)
+        {
+            if (nodeIndex & kLeafFlag)
+            {
+                uint32_t ss = nodeIndex & ~kLeafFlag;
+                if (newSubSector[ss] == kUnassigned)
+                {
+                    newSubSector[ss] = uint32_t(subSectorOrder.size());
+                    subSectorOrder.push_back(ss);
+                }
+                return;
+            }
+            if (newNode[nodeIndex] == kUnassigned)
+            {
+                newNode[nodeIndex] = uint32_t(nodeOrder.size());
+                nodeOrder.push_back(nodeIndex);
+            }
+            auto& node = level.nodes[nodeIndex];
+            visit(node.child[0]);
+            visit(node.child[1]);
+        }
+    };
+}
+
+LayoutStats measureLayout(const WAD::LevelData& level, uint32_t numSubsectors)
+{
+    LayoutStats stats;
+    if (!level.numNodes)
+        return stats;
+
+    AccessStream nodes, subSectors, segs, vertices;
+    for (uint32_t ss = 0; ss < numSubsectors; ++ss)
+    {
+        auto& subSector = level.subSectors[ss];
+        if (!subSector.segmentCount)
+            continue;
+
+        // Center of the seg vertices, which is inside the subsector since it's convex
+        double x = 0, y = 0;
+        for (int i = 0; i < subSector.segmentCount; ++i)
+        {
+            auto& seg = level.segments[subSector.firstSegment + i];
+            x += toDouble(level.vertices[seg.startVertex].x) + toDouble(level.vertices[seg.endVertex].x);
+            y += toDouble(level.vertices[seg.startVertex].y) + toDouble(level.vertices[seg.endVertex].y);
+        }
+        TraversalRecorder recorder{ level, x / (2 * subSector.segmentCount), y / (2 * subSector.segmentCount), {}, {}, {}, {} };
+        recorder.visit(uint16_t(level.numNodes - 1));
+
+        for (auto [dst, src] : { std::pair{ &nodes, &recorder.nodes }, { &subSectors, &recorder.subSectors }, { &segs, &recorder.segs }, { &vertices, &recorder.vertices } })
+        {
+            dst->sequential += src->sequential;
+            dst->total += src->total;
+        }
+    }
+
+    stats.nodes = nodes.ratio();
+    stats.subSectors = subSectors.ratio();
+    stats.segs = segs.ratio();
+    stats.vertices = vertices.ratio();
+    uint64_t sequential = nodes.sequential + subSectors.sequential + segs.sequential + vertices.sequential;
+    uint64_t total = nodes.total + subSectors.total + segs.total + vertices.total;
+    stats.total = total ? double(sequential) / total : 0;
+    return stats;
+}
+
+BSPBuildResult optimizeLayout(WAD::LevelData& level, uint32_t numVertices, uint32_t numSubsectors)
+{
+    BSPBuildResult result;
+    if (!level.numNodes)
+        return result;
+
+    // Nodes and subsectors
+    uint32_t root = level.numNodes - 1;
+    Renumbering order{ level, {}, {}, {}, {} };
+    order.newNode.assign(level.numNodes, kUnassigned);
+    order.newSubSector.assign(numSubsectors, kUnassigned);
+    order.newNode[root] = root; // Keep it out of the sequence
+    order.visit(level.nodes[root].child[0]);
+    order.visit(level.nodes[root].child[1]);
+    for (uint32_t i = 0; i < root; ++i) // Unreachable data keeps its relative order at the end
+    {
+        if (order.newNode[i] == kUnassigned)
+        {
+            order.newNode[i] = uint32_t(order.nodeOrder.size());
+            order.nodeOrder.push_back(i);
+        }
+    }
+    order.nodeOrder.push_back(root);
+    for (uint32_t i = 0; i < numSubsectors; ++i)
+    {
+        if (order.newSubSector[i] == kUnassigned)
+        {
+            order.newSubSector[i] = uint32_t(order.subSectorOrder.size());
+            order.subSectorOrder.push_back(i);
+        }
+    }
+
+    auto remapChild = [&](uint16_t child)
+    {
+        if (child & kLeafFlag)
+            return uint16_t(kLeafFlag | order.newSubSector[child & ~kLeafFlag]);
+        return uint16_t(order.newNode[child]);
+    };
+    for (uint32_t oldIndex : order.nodeOrder)
+    {
+        auto& node = result.nodes.emplace_back(level.nodes[oldIndex]);
+        node.child[0] = remapChild(node.child[0]);
+        node.child[1] = remapChild(node.child[1]);
+    }
+
+    // Segs follow their subsectors
+    for (uint32_t oldIndex : order.subSectorOrder)
+    {
+        auto subSector = level.subSectors[oldIndex];
+        int16_t first = int16_t(result.segments.size());
+        for (int i = 0; i < subSector.segmentCount; ++i)
+            result.segments.push_back(level.segments[subSector.firstSegment + i]);
+        subSector.firstSegment = first;
+        result.subSectors.push_back(subSector);
+    }
+
+    // Vertices in order of first use
+    std::vector<uint32_t> newVertex(numVertices, kUnassigned);
+    auto useVertex = [&](int16_t& v)
+    {
+        if (newVertex[v] == kUnassigned)
+        {
+            newVertex[v] = uint32_t(result.vertices.size());
+            result.vertices.push_back(level.vertices[v]);
+        }
+        v = int16_t(newVertex[v]);
+    };
+    for (auto& seg : result.segments)
+    {
+        useVertex(seg.startVertex);
+        useVertex(seg.endVertex);
+    }
+    for (uint32_t i = 0; i < numVertices; ++i)
+    {
+        if (newVertex[i] == kUnassigned)
+        {
+            newVertex[i] = uint32_t(result.vertices.size());
+            result.vertices.push_back(level.vertices[i]);
+        }
+    }
+    auto lineDefs = const_cast<WAD::LineDef*>(level.lineDefs);
+    for (uint32_t i = 0; i < level.numLineDefs; ++i)
+    {
+        lineDefs[i].v0 = uint16_t(newVertex[lineDefs[i].v0]);
+        lineDefs[i].v1 = uint16_t(newVertex[lineDefs[i].v1]);
+    }
+
+    level.vertices = result.vertices.data();
+    level.segments = result.segments.data();
+    level.subSectors = result.subSectors.data();
+    level.nodes = result.nodes.data();
+    return result;
+}
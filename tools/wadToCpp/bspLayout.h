@@ -0,0 +1,27 @@
+#pragma once
+
+#include <cstdint>
+#include <WAD.h>
+
+#include "bspBuilder.h"
+
+// Fraction of ROM reads during BSP traversal that hit the same or the next element of the array read last.
+// GBA cartridge ROM serves those as sequential accesses, everything else pays the non-sequential wait states.
+// Measured by traversing the tree front to back from the center of every subsector.
+struct LayoutStats
+{
+    double nodes = 0;
+    double subSectors = 0;
+    double segs = 0;
+    double vertices = 0;
+    double total = 0;
+};
+
+LayoutStats measureLayout(const WAD::LevelData& level, uint32_t numSubsectors);
+
+// Renumbers the level so traversal reads ROM as sequentially as possible:
+// Nodes in depth first order, front child first. The root stays last, which is where the renderer starts.
+// Subsectors in the order their leaves are reached, with their segs back to back in the same order.
+// Vertices in the order segs first use them. Linedefs are remapped in place.
+// Segs that no subsector references are dropped.
+BSPBuildResult optimizeLayout(WAD::LevelData& level, uint32_t numVertices, uint32_t numSubsectors);
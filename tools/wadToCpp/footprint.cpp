@@ -0,0 +1,87 @@
+#include "footprint.h"
+
+#include <algorithm>
+#include <iomanip>
+
+void FootprintReport::addArray(const std::string& name, uint32_t romBytes, uint32_t ewramBytes)
+{
+    m_arrays.push_back({ name, romBytes, ewramBytes });
+}
+
+void FootprintReport::addLimit(const std::string& what, uint32_t value, uint32_t limit)
+{
+    m_limits.push_back({ what, value, limit });
+}
+
+void FootprintReport::measureFrame(const WAD::LevelData& level, uint32_t numVertices, uint32_t numSubsectors, uint32_t numSegments)
+{
+    // Side test and children of every node
+    uint32_t nodeBytes = sizeof(WAD::Plane) + 2 * sizeof(uint16_t);
+    // Hot seg arrays, and both vertices for the backface and frustum tests
+    uint32_t segBytes = 2 * sizeof(uint16_t) + 3 * sizeof(uint8_t) + 2 * sizeof(WAD::PackedVertex);
+    m_traversalBytes = level.numNodes * nodeBytes + numSubsectors * sizeof(WAD::SubSector) + numSegments * segBytes;
+
+    // What the same traversal would read if vertices and planes were stored as 16.16
+    uint32_t wideVertexBytes = sizeof(WAD::Vertex) - sizeof(WAD::PackedVertex);
+    m_packedFrameSavings = level.numNodes * 2 * wideVertexBytes + numSegments * 2 * wideVertexBytes;
+    m_packedRomSavings = numVertices * wideVertexBytes + level.numNodes * 2 * wideVertexBytes;
+
+    // Both sectors, baked lights and the texture offset of the cold seg
+    m_drawnSegBytes = 2 * sizeof(WAD::Sector) + 2 * sizeof(uint8_t) + sizeof(WAD::Seg);
+
+    m_largestSubsector = 0;
+    for (uint32_t i = 0; i < numSubsectors; ++i)
+    {
+        uint32_t count = uint32_t(level.subSectors[i].segmentCount);
+        if (count > m_largestSubsector)
+        {
+            m_largestSubsector = count;
+            m_largestSubsectorIndex = i;
+        }
+    }
+}
+
+bool FootprintReport::print(std::ostream& log, const MemoryBudget& budget) const
+{
+    uint32_t romTotal = 0;
+    uint32_t ewramTotal = 0;
+    size_t nameWidth = 8;
+    for (auto& a : m_arrays)
+        nameWidth = std::max(nameWidth, a.name.size());
+
+    log << std::left << std::setw(int(nameWidth)) << "Array" << std::right << std::setw(10) << "ROM" << std::setw(10) << "EWRAM" << "\n";
+    for (auto& a : m_arrays)
+    {
+        log << std::left << std::setw(int(nameWidth)) << a.name << std::right << std::setw(10) << a.romBytes << std::setw(10) << a.ewramBytes << "\n";
+        romTotal += a.romBytes;
+        ewramTotal += a.ewramBytes;
+    }
+    log << std::left << std::setw(int(nameWidth)) << "Total" << std::right << std::setw(10) << romTotal << std::setw(10) << ewramTotal << "\n"
+        << std::left;
+    log << "Per frame: " << m_traversalBytes << " bytes to traverse, plus " << m_drawnSegBytes << " per drawn seg\n";
+    log << "16 bit vertices and planes save " << m_packedFrameSavings << " bytes per frame and " << m_packedRomSavings << " bytes of ROM\n";
+    log << "Largest subsector: " << m_largestSubsector << " segs (#" << m_largestSubsectorIndex << ")\n";
+
+    bool ok = true;
+    auto checkBudget = [&](const char* what, uint32_t value, uint32_t limit)
+    {
+        if (limit && value > limit)
+        {
+            log << "Warning: " << what << " is " << value << " bytes, over the budget of " << limit << "\n";
+            ok = false;
+        }
+    };
+    checkBudget("ROM", romTotal, budget.rom);
+    checkBudget("EWRAM", ewramTotal, budget.ewram);
+    checkBudget("Per frame traversal", m_traversalBytes, budget.frameBytes);
+
+    for (auto& l : m_limits)
+    {
+        if (l.value > l.limit)
+        {
+            log << "Warning: " << l.what << " is " << l.value << ", over the limit of " << l.limit << "\n";
+            ok = false;
+        }
+    }
+    return ok;
+}
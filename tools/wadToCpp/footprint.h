@@ -0,0 +1,59 @@
+#pragma once
+
+#include <cstdint>
+#include <ostream>
+#include <string>
+#include <vector>
+#include <WAD.h>
+
+// Per level limits, in bytes. Zero means no limit.
+struct MemoryBudget
+{
+    uint32_t rom = 0;
+    uint32_t ewram = 0; // Unpack buffer for compressed arrays
+    uint32_t frameBytes = 0; // Level data read by a full BSP traversal
+};
+
+// Where each converted array ends up on the GBA, and how much of it a frame reads.
+// Arrays live in ROM and are read in place, unless they are compressed. Those are unpacked to EWRAM on load.
+// Level data never goes to IWRAM, so it has no column here.
+class FootprintReport
+{
+public:
+    void addArray(const std::string& name, uint32_t romBytes, uint32_t ewramBytes);
+
+    // A count the data format or the renderer can't go over, like 15 bit node indices
+    void addLimit(const std::string& what, uint32_t value, uint32_t limit);
+
+    // Bytes read every frame by walking the whole tree and clipping every seg, which the renderer does without
+    // bounding box culling, plus what each seg that ends up drawn reads on top
+    // Also measures what storing vertices and node planes in 16 bits saves over 16.16.
+    void measureFrame(const WAD::LevelData& level, uint32_t numVertices, uint32_t numSubsectors, uint32_t numSegments);
+
+    // Prints the table and warns about anything over budget or over a limit. Returns false in that case.
+    bool print(std::ostream& log, const MemoryBudget& budget) const;
+
+private:
+    struct Array
+    {
+        std::string name;
+        uint32_t romBytes;
+        uint32_t ewramBytes;
+    };
+
+    struct Limit
+    {
+        std::string what;
+        uint32_t value;
+        uint32_t limit;
+    };
+
+    std::vector<Array> m_arrays;
+    std::vector<Limit> m_limits;
+    uint32_t m_traversalBytes = 0;
+    uint32_t m_drawnSegBytes = 0;
+    uint32_t m_packedFrameSavings = 0;
+    uint32_t m_packedRomSavings = 0;
+    uint32_t m_largestSubsector = 0;
+    uint32_t m_largestSubsectorIndex = 0;
+};
@@ -0,0 +1,146 @@
+#include "lightBake.h"
+
+#include <algorithm>
+#include <atomic>
+#include <cmath>
+#include <thread>
+
+namespace
+{
+    struct Vec2d
+    {
+        double x, y;
+
+        Vec2d operator+(const Vec2d& b) const { return { x + b.x, y + b.y }; }
+        Vec2d operator-(const Vec2d& b) const { return { x - b.x, y - b.y }; }
+        Vec2d operator*(double s) const { return { x * s, y * s }; }
+    };
+
+    double cross(const Vec2d& a, const Vec2d& b) { return a.x * b.y - a.y * b.x; }
+    double length(const Vec2d& a) { return std::sqrt(a.x * a.x + a.y * a.y); }
+
+    Vec2d toVec2d(const WAD::PackedVertex& v)
+    {
+        return { v.x / double(1 << WAD::kPackedVertexShift), v.y / double(1 << WAD::kPackedVertexShift) };
+    }
+
+    struct Occluder
+    {
+        Vec2d a, b;
+    };
+
+    // Bake parameters, in world units (1 unit = 32 doom units)
+    constexpr double kOcclusionRadius = 2.0;
+    constexpr double kOcclusionStrength = 0.6;
+    constexpr double kSampleOffset = 1.0 / 16;
+    constexpr int kNumRays = 16;
+
+    // Distance along the ray to the closest occluder, or kOcclusionRadius if none is in range
+    double traceRay(const std::vector<Occluder>& occluders, const Vec2d& origin, const Vec2d& dir)
+    {
+        double closest = kOcclusionRadius;
+        for (auto& o : occluders)
+        {
+            Vec2d edge = o.b - o.a;
+            double denom = cross(dir, edge);
+            if (std::abs(denom) < 1e-9)
+                continue; // Parallel
+            Vec2d rel = o.a - origin;
+            double t = cross(rel, edge) / denom;
+            double s = cross(rel, dir) / denom;
+            if (t > 0 && s >= 0 && s <= 1)
+                closest = std::min(closest, t);
+        }
+        return closest;
+    }
+
+    // Fraction of the light that reaches a point in front of a wall, in [1-kOcclusionStrength, 1]
+    double ambientOcclusion(const std::vector<Occluder>& occluders, const Vec2d& origin, const Vec2d& normal)
+    {
+        const double pi = std::acos(-1.0);
+        double occlusion = 0;
+        for (int i = 0; i < kNumRays; ++i)
+        {
+            // Spread rays over the half plane in front of the wall, skipping the grazing directions
+            double angle = pi * ((i + 0.5) / kNumRays - 0.5) * 0.9;
+            Vec2d dir = {
+                normal.x * std::cos(angle) - normal.y * std::sin(angle),
+                normal.x * std::sin(angle) + normal.y * std::cos(angle)
+            };
+            double t = traceRay(occluders, origin, dir);
+            occlusion += 1 - t / kOcclusionRadius;
+        }
+        return 1 - kOcclusionStrength * occlusion / kNumRays;
+    }
+}
+
+std::vector<uint8_t> bakeSegLights(const WAD::LevelData& level, int numSegments, int numLineDefs, unsigned numThreads)
+{
+    constexpr uint16_t FlagTwoSided = 0x04;
+
+    // Walls that block light: one sided lines, and two sided lines with no opening
+    std::vector<Occluder> occluders;
+    for (int i = 0; i < numLineDefs; ++i)
+    {
+        auto& lineDef = level.lineDefs[i];
+        bool solid = lineDef.SideNum[1] == uint16_t(-1) || !(lineDef.flags & FlagTwoSided);
+        if (!solid)
+        {
+            auto& front = level.sectors[level.sideDefs[lineDef.SideNum[0]].sector];
+            auto& back = level.sectors[level.sideDefs[lineDef.SideNum[1]].sector];
+            solid = std::min(front.ceilingHeight.raw, back.ceilingHeight.raw) <= std::max(front.floorhHeight.raw, back.floorhHeight.raw);
+        }
+        if (solid)
+            occluders.push_back({ toVec2d(level.vertices[lineDef.v0]), toVec2d(level.vertices[lineDef.v1]) });
+    }
+
+    std::vector<uint8_t> lights(2 * numSegments);
+    std::atomic<int> nextSeg = 0;
+    auto worker = [&]()
+    {
+        for (int i = nextSeg++; i < numSegments; i = nextSeg++)
+        {
+            auto& segment = level.segments[i];
+            auto& lineDef = level.lineDefs[segment.linedefNum];
+            auto& side = level.sideDefs[lineDef.SideNum[segment.direction]];
+            auto& sector = level.sectors[side.sector];
+
+            // Same orientation classes the renderer used before baking
+            bool isHor = segment.angle == 0 || segment.angle == int16_t(0x8000);
+            bool isVer = segment.angle == 0x4000 || segment.angle == int16_t(0xC000);
+            double shade = isHor ? 0.625 : isVer ? 1.0 : 0.825;
+            double sectorLight = std::clamp<int>(sector.lightLevel.raw, 0, 255);
+
+            Vec2d v0 = toVec2d(level.vertices[segment.startVertex]);
+            Vec2d v1 = toVec2d(level.vertices[segment.endVertex]);
+            Vec2d dir = v1 - v0;
+            double len = length(dir);
+            if (len <= 0)
+            {
+                lights[2 * i] = lights[2 * i + 1] = uint8_t(sectorLight * shade);
+                continue;
+            }
+            dir = dir * (1 / len);
+            Vec2d normal = { dir.y, -dir.x }; // Segs face right
+
+            // Sample just in front of each end, slightly inside the seg so the wall itself isn't hit
+            double offset = std::min(kSampleOffset, len / 2);
+            Vec2d p0 = v0 + dir * offset + normal * kSampleOffset;
+            Vec2d p1 = v1 - dir * offset + normal * kSampleOffset;
+            double ao0 = ambientOcclusion(occluders, p0, normal);
+            double ao1 = ambientOcclusion(occluders, p1, normal);
+
+            lights[2 * i] = uint8_t(std::clamp(sectorLight * shade * ao0, 0.0, 255.0));
+            lights[2 * i + 1] = uint8_t(std::clamp(sectorLight * shade * ao1, 0.0, 255.0));
+        }
+    };
+
+    std::vector<std::thread> threads;
+    for (unsigned t = 1; t < numThreads; ++t)
+        threads.emplace_back(worker);
+    worker();
+    for (auto& t : threads)
+        t.join();
+
+    return lights;
+}
@@ -0,0 +1,11 @@
+#pragma once
+
+#include <cstdint>
+#include <vector>
+#include <WAD.h>
+
+// Bakes a light value for both ends of every seg.
+// Each value combines the sector light level, a fixed shade per wall orientation, and ambient occlusion
+// from nearby solid walls (which also darkens corners). Output is two bytes per seg, in seg order.
+// Work is spread over numThreads threads.
+std::vector<uint8_t> bakeSegLights(const WAD::LevelData& level, int numSegments, int numLineDefs, unsigned numThreads);
@@ -1,3 +1,4 @@
+#include <algorithm>
 #include <cassert>
 #include <string>
 #include <iostream>
@@ -6,8 +7,20 @@
 #include <fstream>
 #include <memory>
 #include <unordered_map>
+#include <atomic>
+#include <sstream>
+#include <thread>
 #include <xxhash/xxh3.h>
 #include <WAD.h>
+#include <assetArchiveWriter.h>
+#include <wadFile.h>
+
+#include "blockMap.h"
+#include "bspBuilder.h"
+#include "bspLayout.h"
+#include "footprint.h"
+#include "lightBake.h"
+#include "textures.h"
 
 struct WADMetrics
 {
@@ -18,6 +31,7 @@ struct WADMetrics
     int numSectors;
     int numSubsectors;
     int numNodes;
+    int blockMapSize; // In uint16_t
 
     // BBox
     int minX, minY;
@@ -25,26 +39,32 @@ struct WADMetrics
 
     int totalSize;
 
-    void print()
+    void print(std::ostream& log)
     {
-        std::cout << "BBox: (" << minX << "," << minY << ") to (" << maxX << "," << maxY << ")\n";
-        std::cout << "Vertices: " << numVertices << ", size: " << numVertices * sizeof(WAD::Vertex) << "\n";
-        std::cout << "Lines: " << numLineDefs << "\n";
-        std::cout << "Sides: " << numSideDefs << "\n";
-        std::cout << "Segments: " << numSegments << "\n";
-        std::cout << "Sectors: " << numSectors << ", size: " << numSectors * sizeof(WAD::Sector) << "\n";
-        std::cout << "SubSectors: " << numSubsectors << "\n";
-        std::cout << "BSP Nodes: " << numNodes << ", size: " << numNodes * sizeof(WAD::Node) << "\n";
-        std::cout << "Total size: " << totalSize << "\n";
+        log << "BBox: (" << minX << "," << minY << ") to (" << maxX << "," << maxY << ")\n";
+        log << "Vertices: " << numVertices << ", size: " << numVertices * sizeof(WAD::PackedVertex) << "\n";
+        log << "Lines: " << numLineDefs << "\n";
+        log << "Sides: " << numSideDefs << "\n";
+        log << "Segments: " << numSegments << "\n";
+        log << "Sectors: " << numSectors << ", size: " << numSectors * sizeof(WAD::Sector) << "\n";
+        log << "SubSectors: " << numSubsectors << "\n";
+        log << "BSP Nodes: " << numNodes << ", size: " << numNodes * sizeof(WAD::Node) << "\n";
+        log << "Blockmap size: " << blockMapSize * sizeof(uint16_t) << "\n";
+        log << "Total size: " << totalSize << "\n";
     }
 };
 
 struct WADTemporaries
 {
-    std::vector<uint8_t> rawWAD;
+    // Lumps the converter modifies in place. The rest are read straight from the mapped file.
+    std::vector<WAD::LineDef> lineDefs;
+    std::vector<WAD::SideDef> sideDefs;
+    std::vector<WAD::Sector> sectors;
+    TextureNames wallTextureNames{ true }; // What the texture ids in sideDefs and sectors stand for
+    TextureNames flatNames{ false };
     std::vector<WAD::CompressedVertex> compressedVertices;
     std::vector<WAD::CompressedNode> compressedNodes;
-    std::vector<WAD::Vertex> vertices;
+    std::vector<WAD::PackedVertex> vertices;
     std::vector<WAD::Node> nodes;
 
     void decompressVertices()
@@ -53,10 +73,10 @@ struct WADTemporaries
 
         for (auto v : compressedVertices)
         {
+            // Packed vertices count whole doom units, just like the WAD
             auto& dst = vertices.emplace_back();
-            // This is effectively a division by 256, because the final number is .16
-            dst.m_x.raw = int(v.x.raw) << 8;
-            dst.m_y.raw = int(v.y.raw) << 8;
+            dst.x = v.x.raw;
+            dst.y = v.y.raw;
         }
     }
 
@@ -67,11 +87,10 @@ struct WADTemporaries
         for (const auto& cNode : compressedNodes)
         {
             auto& dst = nodes.emplace_back();
-            // This is effectively a division by 256, because the final number is .16
-            dst.plane.origin.m_x.raw = int(cNode.x.raw) << 8;
-            dst.plane.origin.m_y.raw = int(cNode.y.raw) << 8;
-            dst.plane.dir.m_x.raw = int(cNode.dx.raw) << 8;
-            dst.plane.dir.m_y.raw = int(cNode.dy.raw) << 8;
+            dst.plane.origin.x = cNode.x.raw;
+            dst.plane.origin.y = cNode.y.raw;
+            dst.plane.dir.x = cNode.dx.raw;
+            dst.plane.dir.y = cNode.dy.raw;
             dst.aabb[0] = cNode.aabb[0];
             dst.aabb[1] = cNode.aabb[1];
             dst.child[0] = cNode.child[0];
@@ -82,10 +101,11 @@ struct WADTemporaries
 
 void serializeData(const void* data, size_t byteCount, const std::string& variableName, std::ostream& out)
 {
-    // Only multiples of 4 bytes supported
-    //assert(byteCount % 4 == 0);
+    // Lumps may be views into a mapped file, so pad a copy to whole dwords rather than reading past their end
     auto dwordCount = (byteCount+3) / 4;
-    uint32_t* packedData = (uint32_t*)data;
+    std::vector<uint32_t> paddedData(dwordCount, 0);
+    memcpy(paddedData.data(), data, byteCount);
+    const uint32_t* packedData = paddedData.data();
 
     out << "extern const uint32_t " << variableName << "[" << dwordCount << "] = {\n";
  
@@ -128,7 +148,7 @@ void appendBuffer(std::ostream& cpp, std::ostream& header, const std::string& va
     serializeData(data, byteCount, variableName, cpp);
 }
 
-void writeLoadFunction(std::ofstream& header, std::ofstream& cpp, std::string mapName)
+void writeLoadFunction(std::ofstream& header, std::ofstream& cpp, std::string mapName, bool hasTextures)
 {
     // Write the prototype
     header << "void loadMap_" << mapName << "(WAD::LevelData& dstLevel);\n\n";
@@ -136,9 +156,10 @@ void writeLoadFunction(std::ofstream& header, std::ofstream& cpp, std::string ma
     // Write the implementation
     cpp << "void loadMap_" << mapName << "(WAD::LevelData& dstLevel) {\n"
         << "\t// Load vertex data\n"
-        << "\tdstLevel.vertices = (const WAD::Vertex*)" << mapName << "Vertices;\n"
+        << "\tdstLevel.vertices = (const WAD::PackedVertex*)" << mapName << "Vertices;\n"
         << "\n"
         << "\t// Load line defs\n"
+        << "\tdstLevel.numLineDefs = (" << mapName << "LineDefsSize * 4) / sizeof(WAD::LineDef);\n"
         << "\tdstLevel.lineDefs = (const WAD::LineDef*)" << mapName << "LineDefs;\n"
         << "\n"
         << "\t// Load side defs\n"
@@ -156,7 +177,29 @@ void writeLoadFunction(std::ofstream& header, std::ofstream& cpp, std::string ma
         << "\t// Load nodes\n"
         << "\tdstLevel.numNodes = (" << mapName << "NodesSize * 4) / sizeof(WAD::Node);\n"
         << "\tdstLevel.nodes = (const WAD::Node*)" << mapName << "Nodes;\n"
-        << "}\n";
+        << "\n"
+        << "\t// Load baked lighting\n"
+        << "\tdstLevel.segLights = (const uint8_t*)" << mapName << "SegLights;\n"
+        << "\n"
+        << "\t// Load render hot seg data\n"
+        << "\tdstLevel.segVertices = (const uint16_t*)" << mapName << "SegVertices;\n"
+        << "\tdstLevel.segFrontSectors = (const uint8_t*)" << mapName << "SegFrontSectors;\n"
+        << "\tdstLevel.segBackSectors = (const uint8_t*)" << mapName << "SegBackSectors;\n"
+        << "\tdstLevel.segFlags = (const uint8_t*)" << mapName << "SegFlags;\n"
+        << "\n"
+        << "\t// Load collision blockmap\n"
+        << "\tdstLevel.blockMap = (const uint16_t*)" << mapName << "BlockMap;\n";
+    if (hasTextures)
+    {
+        cpp << "\n"
+            << "\t// Load textures\n"
+            << "\tdstLevel.wallTextures = (const WAD::WallTexture*)" << mapName << "WallTextures;\n"
+            << "\tdstLevel.textureColumns = " << mapName << "TextureColumns;\n"
+            << "\tdstLevel.texels = (const uint8_t*)" << mapName << "Texels;\n"
+            << "\tdstLevel.flats = (const uint8_t*)" << mapName << "Flats;\n"
+            << "\tdstLevel.texturePalette = (const uint16_t*)" << mapName << "TexturePalette;\n";
+    }
+    cpp << "}\n";
 }
 
 void adjustUnits(const WAD::LevelData& level, WADMetrics& metrics)
@@ -165,17 +208,19 @@ void adjustUnits(const WAD::LevelData& level, WADMetrics& metrics)
     if (!metrics.numVertices)
         return;
 
-    auto vertices = const_cast<WAD::Vertex*>(level.vertices);
+    auto vertices = const_cast<WAD::PackedVertex*>(level.vertices);
 
-    // Compute bounding box and center the level around 0 for better use of our finite range
-    int minX = vertices[0].m_x.raw;
-    int minY = vertices[0].m_y.raw;
-    int maxX = vertices[0].m_x.raw;
-    int maxY = vertices[0].m_y.raw;
+    // Compute bounding box and center the level around 0 for better use of our finite range.
+    // Packed vertices are already world units with 5 fractional bits, so centering is all that's left.
+    // The center is rounded to a whole doom unit to keep them exact.
+    int minX = vertices[0].x;
+    int minY = vertices[0].y;
+    int maxX = vertices[0].x;
+    int maxY = vertices[0].y;
     for (int i = 0; i < metrics.numVertices; ++i)
     {
-        int x = vertices[i].m_x.raw;
-        int y = vertices[i].m_y.raw;
+        int x = vertices[i].x;
+        int y = vertices[i].y;
         minX = std::min(minX, x);
         maxX = std::max(maxX, x);
         minY = std::min(minY, y);
@@ -183,15 +228,16 @@ void adjustUnits(const WAD::LevelData& level, WADMetrics& metrics)
     }
     int x0 = (minX + maxX) / 2;
     int y0 = (minY + maxY) / 2;
-    metrics.minX = minX - x0;
-    metrics.minY = minY - y0;
-    metrics.maxX = maxX - x0;
-    metrics.maxY = maxY - y0;
+    // Metrics keep the 24.8 doom units they always had
+    metrics.minX = (minX - x0) << 8;
+    metrics.minY = (minY - y0) << 8;
+    metrics.maxX = (maxX - x0) << 8;
+    metrics.maxY = (maxY - y0) << 8;
 
     for (int i = 0; i < metrics.numVertices; ++i)
     {
-        vertices[i].m_x.raw = (vertices[i].m_x.raw - x0) * 8;
-        vertices[i].m_y.raw = (vertices[i].m_y.raw - y0) * 8;
+        vertices[i].x = int16_t(vertices[i].x - x0);
+        vertices[i].y = int16_t(vertices[i].y - y0);
     }
 
     // Nodes
@@ -199,10 +245,8 @@ void adjustUnits(const WAD::LevelData& level, WADMetrics& metrics)
     for (int i = 0; i < metrics.numNodes; ++i)
     {
         auto& plane = nodes[i].plane;
-        plane.origin.m_x.raw = (plane.origin.m_x.raw - x0) * 8;
-        plane.origin.m_y.raw = (plane.origin.m_y.raw - y0) * 8;
-        plane.dir.m_x.raw = plane.dir.m_x.raw * 8;
-        plane.dir.m_y.raw = plane.dir.m_y.raw * 8;
+        plane.origin.x = int16_t(plane.origin.x - x0);
+        plane.origin.y = int16_t(plane.origin.y - y0);
     }
 
     // TODO: AABBs and possibly texture offsets
@@ -216,7 +260,45 @@ void adjustUnits(const WAD::LevelData& level, WADMetrics& metrics)
     }
 }
 
-void serializeWAD(const WAD::LevelData& level, const WADMetrics& metrics, const std::string& inputFileName)
+void printBSPStats(std::ostream& log, const char* name, const BSPStats& stats)
+{
+    log << name << ": " << stats.numNodes << " nodes, " << stats.numSubsectors << " subsectors, " << stats.numSegments << " segs, "
+        << "depth " << stats.maxDepth << " max / " << stats.meanLeafDepth << " mean, traversal ~" << stats.traversalCycles << " cycles\n";
+}
+
+void printLayoutStats(std::ostream& log, const char* name, const LayoutStats& stats)
+{
+    log << name << ": " << int(stats.total * 100) << "% (nodes " << int(stats.nodes * 100)
+        << "%, subsectors " << int(stats.subSectors * 100) << "%, segs " << int(stats.segs * 100)
+        << "%, vertices " << int(stats.vertices * 100) << "%)\n";
+}
+
+void rebuildBSP(WAD::LevelData& level, WADMetrics& metrics, unsigned numThreads, BSPBuildResult& result, std::ostream& log)
+{
+    auto original = measureBSP(level, metrics.numSubsectors, metrics.numSegments);
+    result = buildBSP(level, metrics.numVertices, numThreads, log);
+
+    int oldSize = metrics.numVertices * sizeof(WAD::PackedVertex) + metrics.numSegments * sizeof(WAD::Seg)
+        + metrics.numSubsectors * sizeof(WAD::SubSector) + metrics.numNodes * sizeof(WAD::Node);
+    level.vertices = result.vertices.data();
+    level.segments = result.segments.data();
+    level.subSectors = result.subSectors.data();
+    level.nodes = result.nodes.data();
+    level.numNodes = uint32_t(result.nodes.size());
+    metrics.numVertices = int(result.vertices.size());
+    metrics.numSegments = int(result.segments.size());
+    metrics.numSubsectors = int(result.subSectors.size());
+    metrics.numNodes = int(result.nodes.size());
+    int newSize = metrics.numVertices * sizeof(WAD::PackedVertex) + metrics.numSegments * sizeof(WAD::Seg)
+        + metrics.numSubsectors * sizeof(WAD::SubSector) + metrics.numNodes * sizeof(WAD::Node);
+    metrics.totalSize += newSize - oldSize;
+
+    auto rebuilt = measureBSP(level, metrics.numSubsectors, metrics.numSegments);
+    printBSPStats(log, "Original BSP", original);
+    printBSPStats(log, "Rebuilt BSP", rebuilt);
+}
+
+void serializeWAD(const WAD::LevelData& level, const WADMetrics& metrics, const std::vector<uint8_t>& segLights, const TextureData& textures, const std::string& inputFileName, FootprintReport& footprint)
 {
     // --- Serialize data ---
     std::ofstream outHeader(inputFileName + ".h");
@@ -229,147 +311,262 @@ void serializeWAD(const WAD::LevelData& level, const WADMetrics& metrics, const
     auto fileWithoutExtension = inputFile.stem().string();
     auto variableName = fileWithoutExtension + "_WAD";
 
-    appendBuffer(outCppFile, outHeader, variableName + "Vertices", level.vertices, sizeof(WAD::Vertex) * metrics.numVertices);
-    appendBuffer(outCppFile, outHeader, variableName + "LineDefs", level.lineDefs, sizeof(WAD::LineDef) * metrics.numLineDefs);
-    appendBuffer(outCppFile, outHeader, variableName + "SideDefs", level.sideDefs, sizeof(WAD::SideDef) * metrics.numSideDefs);
-    appendBuffer(outCppFile, outHeader, variableName + "Segments", level.segments, sizeof(WAD::Seg) * metrics.numSegments);
-    appendBuffer(outCppFile, outHeader, variableName + "SubSectors", level.subSectors, sizeof(WAD::SubSector) * metrics.numSubsectors);
-    appendBuffer(outCppFile, outHeader, variableName + "Sectors", level.sectors, sizeof(WAD::Sector) * metrics.numSectors);
-    appendBuffer(outCppFile, outHeader, variableName + "Nodes", level.nodes, sizeof(WAD::Node) * level.numNodes);
+    // Everything stays in ROM
+    auto appendArray = [&](const std::string& name, const void* data, size_t byteCount)
+    {
+        appendBuffer(outCppFile, outHeader, name, data, byteCount);
+        footprint.addArray(name, uint32_t((byteCount + 3) & ~size_t(3)), 0);
+    };
+
+    appendArray(variableName + "Vertices", level.vertices, sizeof(WAD::PackedVertex) * metrics.numVertices);
+    appendArray(variableName + "LineDefs", level.lineDefs, sizeof(WAD::LineDef) * metrics.numLineDefs);
+    appendArray(variableName + "SideDefs", level.sideDefs, sizeof(WAD::SideDef) * metrics.numSideDefs);
+    appendArray(variableName + "Segments", level.segments, sizeof(WAD::Seg) * metrics.numSegments);
+    appendArray(variableName + "SubSectors", level.subSectors, sizeof(WAD::SubSector) * metrics.numSubsectors);
+    appendArray(variableName + "Sectors", level.sectors, sizeof(WAD::Sector) * metrics.numSectors);
+    appendArray(variableName + "Nodes", level.nodes, sizeof(WAD::Node) * level.numNodes);
+    appendArray(variableName + "SegLights", segLights.data(), segLights.size());
+    uint32_t segBytes = (metrics.numSegments + 3) & ~3; // Byte arrays are padded to whole dwords
+    appendArray(variableName + "SegVertices", level.segVertices, 2 * sizeof(uint16_t) * metrics.numSegments);
+    appendArray(variableName + "SegFrontSectors", level.segFrontSectors, segBytes);
+    appendArray(variableName + "SegBackSectors", level.segBackSectors, segBytes);
+    appendArray(variableName + "SegFlags", level.segFlags, segBytes);
+    appendArray(variableName + "BlockMap", level.blockMap, sizeof(uint16_t) * metrics.blockMapSize);
+    bool hasTextures = !textures.palette.empty();
+    if (hasTextures)
+    {
+        appendArray(variableName + "WallTextures", textures.wallTextures.data(), sizeof(WAD::WallTexture) * textures.wallTextures.size());
+        appendArray(variableName + "TextureColumns", textures.columns.data(), sizeof(uint32_t) * textures.columns.size());
+        appendArray(variableName + "Texels", textures.texels.data(), textures.texels.size());
+        appendArray(variableName + "Flats", textures.flats.data(), textures.flats.size());
+        appendArray(variableName + "TexturePalette", textures.palette.data(), sizeof(uint16_t) * textures.palette.size());
+    }
     outCppFile << "\n";
-    writeLoadFunction(outHeader, outCppFile, variableName);
+    writeLoadFunction(outHeader, outCppFile, variableName, hasTextures);
 }
 
-std::vector<uint8_t> loadRawWAD(std::string_view fileName)
+// Writes the level into a binary archive, plus the assembly file that links it into ROM and a header with the load function.
+// Names in the archive match the symbols serializeWAD would generate.
+// With Packing::Auto, lumps that compress well are stored as LZ77 and unpacked by the load function.
+bool serializeWADArchive(const WAD::LevelData& level, const WADMetrics& metrics, const std::vector<uint8_t>& segLights, const TextureData& textures, const std::string& inputFileName, assets::Packing packing, FootprintReport& footprint, std::ostream& log)
 {
-    std::vector<uint8_t> rawData;
-
-    std::ifstream wadFile(fileName.data(), std::ios_base::ate | std::ios_base::binary);
-    uint32_t size = wadFile.tellg();
-    wadFile.seekg(std::ios_base::beg);
-    size -= wadFile.tellg();
+    std::filesystem::path inputFile = inputFileName;
+    auto fileWithoutExtension = inputFile.stem().string();
+    auto variableName = fileWithoutExtension + "_WAD";
 
-    uint32_t alignedSize = 4 * ((size + 3) / 4);
-    assert(alignedSize >= size);
-    rawData.resize(alignedSize, 0);
+    assets::ArchiveWriter archive(log);
+    bool ok = archive.add(variableName + "Vertices", level.vertices, sizeof(WAD::PackedVertex) * metrics.numVertices, packing)
+        && archive.add(variableName + "LineDefs", level.lineDefs, sizeof(WAD::LineDef) * metrics.numLineDefs, packing)
+        && archive.add(variableName + "SideDefs", level.sideDefs, sizeof(WAD::SideDef) * metrics.numSideDefs, packing)
+        && archive.add(variableName + "Segments", level.segments, sizeof(WAD::Seg) * metrics.numSegments, packing)
+        && archive.add(variableName + "SubSectors", level.subSectors, sizeof(WAD::SubSector) * metrics.numSubsectors, packing)
+        && archive.add(variableName + "Sectors", level.sectors, sizeof(WAD::Sector) * metrics.numSectors, packing)
+        && archive.add(variableName + "Nodes", level.nodes, sizeof(WAD::Node) * level.numNodes, packing)
+        && archive.add(variableName + "SegLights", segLights.data(), segLights.size(), packing)
+        && archive.add(variableName + "SegVertices", level.segVertices, 2 * sizeof(uint16_t) * metrics.numSegments, packing)
+        && archive.add(variableName + "SegFrontSectors", level.segFrontSectors, metrics.numSegments, packing)
+        && archive.add(variableName + "SegBackSectors", level.segBackSectors, metrics.numSegments, packing)
+        && archive.add(variableName + "SegFlags", level.segFlags, metrics.numSegments, packing)
+        && archive.add(variableName + "BlockMap", level.blockMap, sizeof(uint16_t) * metrics.blockMapSize, packing);
+    bool hasTextures = !textures.palette.empty();
+    if (ok && hasTextures)
+    {
+        ok = archive.add(variableName + "WallTextures", textures.wallTextures.data(), sizeof(WAD::WallTexture) * textures.wallTextures.size(), packing)
+            && archive.add(variableName + "TextureColumns", textures.columns.data(), sizeof(uint32_t) * textures.columns.size(), packing)
+            && archive.add(variableName + "Texels", textures.texels.data(), textures.texels.size(), packing)
+            && archive.add(variableName + "Flats", textures.flats.data(), textures.flats.size(), packing)
+            && archive.add(variableName + "TexturePalette", textures.palette.data(), sizeof(uint16_t) * textures.palette.size(), packing);
+    }
+    if (!ok)
+        return false;
+    for (auto& entry : archive.entrySizes())
+        footprint.addArray(entry.name, uint32_t(entry.storedSize), uint32_t(entry.unpackedSize));
 
-    wadFile.read((char*)rawData.data(), size);
+    auto binFileName = inputFile.filename().string() + ".bin";
+    if (!archive.save(inputFileName + ".bin")
+        || !assets::ArchiveWriter::writeIncbin(inputFileName + ".s", binFileName, variableName + "Archive"))
+        return false;
 
-    return rawData;
+    std::ofstream header(inputFileName + ".h");
+    header << "#pragma once\n#include <cstdint>\n#include <assetArchive.h>\n#include <WAD.h>\n\n"
+        << "// Linked in from " << inputFile.filename().string() << ".s on GBA. Other platforms should map " << binFileName << " instead.\n"
+        << "extern \"C\" const uint32_t " << variableName << "Archive[];\n\n"
+        << "// Space needed in work RAM for the compressed lumps\n"
+        << "constexpr uint32_t " << variableName << "UnpackedSize = " << archive.unpackedSize() << ";\n\n"
+        << "inline bool loadMap_" << variableName << "(const assets::Archive& archive, WAD::LevelData& dstLevel, uint8_t* unpackBuffer = nullptr)\n"
+        << "{\n"
+        << "\tdstLevel.vertices = archive.load<WAD::PackedVertex>(\"" << variableName << "Vertices\", unpackBuffer);\n"
+        << "\tdstLevel.lineDefs = archive.load<WAD::LineDef>(\"" << variableName << "LineDefs\", dstLevel.numLineDefs, unpackBuffer);\n"
+        << "\tdstLevel.sideDefs = archive.load<WAD::SideDef>(\"" << variableName << "SideDefs\", unpackBuffer);\n"
+        << "\tdstLevel.subSectors = archive.load<WAD::SubSector>(\"" << variableName << "SubSectors\", unpackBuffer);\n"
+        << "\tdstLevel.segments = archive.load<WAD::Seg>(\"" << variableName << "Segments\", unpackBuffer);\n"
+        << "\tdstLevel.sectors = archive.load<WAD::Sector>(\"" << variableName << "Sectors\", unpackBuffer);\n"
+        << "\tdstLevel.nodes = archive.load<WAD::Node>(\"" << variableName << "Nodes\", dstLevel.numNodes, unpackBuffer);\n"
+        << "\tdstLevel.segLights = archive.load<uint8_t>(\"" << variableName << "SegLights\", unpackBuffer);\n"
+        << "\tdstLevel.segVertices = archive.load<uint16_t>(\"" << variableName << "SegVertices\", unpackBuffer);\n"
+        << "\tdstLevel.segFrontSectors = archive.load<uint8_t>(\"" << variableName << "SegFrontSectors\", unpackBuffer);\n"
+        << "\tdstLevel.segBackSectors = archive.load<uint8_t>(\"" << variableName << "SegBackSectors\", unpackBuffer);\n"
+        << "\tdstLevel.segFlags = archive.load<uint8_t>(\"" << variableName << "SegFlags\", unpackBuffer);\n"
+        << "\tdstLevel.blockMap = archive.load<uint16_t>(\"" << variableName << "BlockMap\", unpackBuffer);\n";
+    if (hasTextures)
+    {
+        header << "\tdstLevel.wallTextures = archive.load<WAD::WallTexture>(\"" << variableName << "WallTextures\", unpackBuffer);\n"
+            << "\tdstLevel.textureColumns = archive.load<uint32_t>(\"" << variableName << "TextureColumns\", unpackBuffer);\n"
+            << "\tdstLevel.texels = archive.load<uint8_t>(\"" << variableName << "Texels\", unpackBuffer);\n"
+            << "\tdstLevel.flats = archive.load<uint8_t>(\"" << variableName << "Flats\", unpackBuffer);\n"
+            << "\tdstLevel.texturePalette = archive.load<uint16_t>(\"" << variableName << "TexturePalette\", unpackBuffer);\n";
+    }
+    header << "\treturn dstLevel.vertices && dstLevel.lineDefs && dstLevel.sideDefs && dstLevel.subSectors\n"
+        << "\t\t&& dstLevel.segments && dstLevel.sectors && dstLevel.nodes\n"
+        << "\t\t&& dstLevel.segVertices && dstLevel.segFrontSectors && dstLevel.segBackSectors && dstLevel.segFlags\n"
+        << "\t\t&& dstLevel.segLights && dstLevel.blockMap;\n"
+        << "}\n";
+    return header.good();
 }
 
-const WAD::Lump* findLump(const std::string& name, const WAD::Lump* directory, int numLumps)
+// A map starts with a marker lump named after it (E1M1, MAP01, or anything in a PWAD), followed by THINGS.
+std::vector<int> findMapMarkers(const WadFile& wad)
 {
-    for (int i = 0; i < numLumps; ++i)
+    std::vector<int> markers;
+    for (int things : wad.findAll("THINGS"))
     {
-        auto& lump = directory[i];
-        if (!strncmp(name.c_str(), lump.lumpName, name.size()))
-            return &lump;
+        if (things > 0)
+            markers.push_back(things - 1);
     }
-    return nullptr;
+    return markers;
 }
 
-bool loadWAD(WAD::LevelData& dstLevel, WADTemporaries& temporaryLevelData, WADMetrics& metrics, std::string_view fileName)
+template<class T>
+std::vector<T> copyLump(const WadFile& wad, int lump)
 {
-    temporaryLevelData.rawWAD = loadRawWAD(fileName);
-    if (temporaryLevelData.rawWAD.empty())
-        return false;
-
-    const uint8_t* byteData = reinterpret_cast<const uint8_t*>(temporaryLevelData.rawWAD.data());
-
-    // Verify WAD format
-    const char* defString = reinterpret_cast<const char*>(byteData);
-    
-    if (strncmp(defString, "PWAD", 4) != 0)
-        return false;
+    auto data = wad.lumpAs<T>(lump);
+    return std::vector<T>(data.begin(), data.end());
+}
 
-    // Load header and directory
-    auto wadHeader = reinterpret_cast<const WAD::Header*>(byteData);
-    auto directory = reinterpret_cast<const WAD::Lump*>(&byteData[wadHeader->dirOffset]);
-
-    // Locate lumps
-    auto* lineDefsLump = findLump("LINEDEFS", directory, wadHeader->numLumps);
-    auto* sideDefsLump = findLump("SIDEDEFS", directory, wadHeader->numLumps);
-    auto* verticesLump = findLump("VERTEXES", directory, wadHeader->numLumps);
-    auto* segLumps = findLump("SEGS", directory, wadHeader->numLumps);
-    auto* ssectorLumps = findLump("SSECTORS", directory, wadHeader->numLumps);
-    auto* nodeLumps = findLump("NODES", directory, wadHeader->numLumps);
-    auto* sectorLumps = findLump("SECTORS", directory, wadHeader->numLumps);
-
-    if (!lineDefsLump ||
-        !sideDefsLump ||
-        !verticesLump ||
-        !segLumps ||
-        !ssectorLumps ||
-        !nodeLumps ||
-        !sectorLumps)
+bool loadWAD(WAD::LevelData& dstLevel, WADTemporaries& temporaryLevelData, WADMetrics& metrics, const WadFile& wad, int mapMarker)
+{
+    // Locate lumps, only among the ones that belong to this map, which end where the next map starts
+    int first = mapMarker + 1;
+    int nextThings = wad.find("THINGS", first + 1);
+    int end = nextThings == WadFile::kNotFound ? wad.numLumps() : nextThings - 1;
+    int lineDefsLump = wad.find("LINEDEFS", first, end);
+    int sideDefsLump = wad.find("SIDEDEFS", first, end);
+    int verticesLump = wad.find("VERTEXES", first, end);
+    int segLumps = wad.find("SEGS", first, end);
+    int ssectorLumps = wad.find("SSECTORS", first, end);
+    int nodeLumps = wad.find("NODES", first, end);
+    int sectorLumps = wad.find("SECTORS", first, end);
+
+    if (lineDefsLump == WadFile::kNotFound ||
+        sideDefsLump == WadFile::kNotFound ||
+        verticesLump == WadFile::kNotFound ||
+        segLumps == WadFile::kNotFound ||
+        ssectorLumps == WadFile::kNotFound ||
+        nodeLumps == WadFile::kNotFound ||
+        sectorLumps == WadFile::kNotFound)
         return false;
 
     metrics.totalSize =
-        lineDefsLump->dataSize +
-        sideDefsLump->dataSize +
+        wad.lump(lineDefsLump).dataSize +
+        // sideDefsLump.dataSize +, texture names become ids.
         // verticesLump.dataSize +, used preprocessed vertex data instead.
-        segLumps->dataSize +
-        ssectorLumps->dataSize +
-        nodeLumps->dataSize;// +
+        wad.lump(segLumps).dataSize +
+        wad.lump(ssectorLumps).dataSize +
+        wad.lump(nodeLumps).dataSize;// +
         //sectorLumps->dataSize;
 
     // Load vertex data
-    metrics.numVertices = verticesLump->dataSize / sizeof(WAD::CompressedVertex);
-    metrics.totalSize += metrics.numVertices * sizeof(WAD::Vertex);
-    temporaryLevelData.compressedVertices.resize(metrics.numVertices);
-    memcpy(temporaryLevelData.compressedVertices.data(), &byteData[verticesLump->dataOffset], verticesLump->dataSize);
+    temporaryLevelData.compressedVertices = copyLump<WAD::CompressedVertex>(wad, verticesLump);
+    metrics.numVertices = int(temporaryLevelData.compressedVertices.size());
+    metrics.totalSize += metrics.numVertices * sizeof(WAD::PackedVertex);
 
     // Load line defs
-    metrics.numLineDefs = lineDefsLump->dataSize / sizeof(WAD::LineDef);
-    dstLevel.lineDefs = (const WAD::LineDef*)(&byteData[lineDefsLump->dataOffset]);
-
-    // Load side defs
-    metrics.numSideDefs = sideDefsLump->dataSize / sizeof(WAD::SideDef);
-    dstLevel.sideDefs = (const WAD::SideDef*)(&byteData[sideDefsLump->dataOffset]);
+    temporaryLevelData.lineDefs = copyLump<WAD::LineDef>(wad, lineDefsLump);
+    metrics.numLineDefs = int(temporaryLevelData.lineDefs.size());
+    dstLevel.numLineDefs = metrics.numLineDefs;
+    dstLevel.lineDefs = temporaryLevelData.lineDefs.data();
+
+    // Load side defs, replacing texture names with ids
+    auto& sideDefs = temporaryLevelData.sideDefs;
+    for (auto& raw : wad.lumpAs<WAD::RawSideDef>(sideDefsLump))
+    {
+        auto& side = sideDefs.emplace_back();
+        side.xOffet = raw.xOffet;
+        side.yOffset = raw.yOffset;
+        side.upperTexture = temporaryLevelData.wallTextureNames.id(raw.upperTextureName);
+        side.lowerTexture = temporaryLevelData.wallTextureNames.id(raw.lowerTextureName);
+        side.middleTexture = temporaryLevelData.wallTextureNames.id(raw.middleTextureName);
+        side.sector = raw.sector;
+        side.padding = 0;
+    }
+    metrics.numSideDefs = int(sideDefs.size());
+    metrics.totalSize += metrics.numSideDefs * sizeof(WAD::SideDef);
+    dstLevel.sideDefs = sideDefs.data();
 
     // Load nodes
-    dstLevel.numNodes = nodeLumps->dataSize / sizeof(WAD::CompressedNode);
+    temporaryLevelData.compressedNodes = copyLump<WAD::CompressedNode>(wad, nodeLumps);
+    dstLevel.numNodes = uint32_t(temporaryLevelData.compressedNodes.size());
     metrics.totalSize += dstLevel.numNodes * sizeof(WAD::Node);
-    temporaryLevelData.compressedNodes.resize(dstLevel.numNodes);
     metrics.numNodes = dstLevel.numNodes;
-    memcpy(temporaryLevelData.compressedNodes.data(), &byteData[nodeLumps->dataOffset], nodeLumps->dataSize);
 
     // Load subsectors
-    metrics.numSubsectors = ssectorLumps->dataSize / sizeof(WAD::SubSector);
-    dstLevel.subSectors = (const WAD::SubSector*)&byteData[ssectorLumps->dataOffset];
+    auto subSectors = wad.lumpAs<WAD::SubSector>(ssectorLumps);
+    metrics.numSubsectors = int(subSectors.size());
+    dstLevel.subSectors = subSectors.data();
 
     // Load segments
-    metrics.numSegments = segLumps->dataSize / sizeof(WAD::Seg);
-    dstLevel.segments = (const WAD::Seg*)(&byteData[segLumps->dataOffset]);
+    auto segments = wad.lumpAs<WAD::Seg>(segLumps);
+    metrics.numSegments = int(segments.size());
+    dstLevel.segments = segments.data();
 
-    // Load sectors
-    metrics.numSectors = sectorLumps->dataSize / sizeof(WAD::Sector);
-    dstLevel.sectors = (const WAD::Sector*)&byteData[sectorLumps->dataOffset];
+    // Load sectors, replacing flat names with ids
+    for (auto& raw : wad.lumpAs<WAD::RawSector>(sectorLumps))
+    {
+        auto& sector = temporaryLevelData.sectors.emplace_back();
+        sector.floorhHeight.raw = raw.floorhHeight.raw;
+        sector.ceilingHeight.raw = raw.ceilingHeight.raw;
+        sector.floorTexture = temporaryLevelData.flatNames.id(raw.floorTextureName);
+        sector.ceilingTexture = temporaryLevelData.flatNames.id(raw.ceilingTextureName);
+        sector.lightLevel.raw = raw.lightLevel.raw;
+        sector.type = raw.type;
+        sector.tagNumber = raw.tagNumber;
+    }
+    metrics.numSectors = int(temporaryLevelData.sectors.size());
+    dstLevel.sectors = temporaryLevelData.sectors.data();
 
     return true;
 }
 
-int main(int _argc, const char** _argv)
+struct ConversionOptions
 {
-    // Parse arguments
-    if (_argc < 2)
-    {
-        std::cout << "Not enough arguments\n";
-        return -1;
-    }
+    bool writeArchive = false;
+    assets::Packing packing = assets::Packing::Raw;
+    bool buildNodes = false;
+    unsigned threadsPerMap = 1; // For the node builder and light bake. Batches split the cores between maps first.
+    MemoryBudget budget;
+    const WadFile* iwad = nullptr; // Textures and flats the map's own WAD doesn't have are looked up here
+};
 
-    std::string fileName = _argv[1];
+// One map to convert. Batches convert several at once, so everything they print goes to a log of their own.
+struct MapJob
+{
+    const WadFile* wad; // Shared by all the maps in the file
+    std::string wadFile;
+    int mapMarker; // Directory index of the map's marker lump
+    std::string outputName; // Generated files are named after this, like a single map WAD would be
+};
 
+bool convertMap(const MapJob& job, const ConversionOptions& options, std::ostream& log)
+{
     // Read WAD file into a buffer
     WAD::LevelData parsedWAD;
     WADMetrics metrics;
     // Needs to keep alive the following data until after serialization of all the data
     WADTemporaries temporaryLevelData;
-    if (!loadWAD(parsedWAD, temporaryLevelData, metrics, fileName))
+    if (!loadWAD(parsedWAD, temporaryLevelData, metrics, *job.wad, job.mapMarker))
     {
-        std::cout << "Unable to load WAD file " << fileName << "\n";
-        return -1;
+        log << "Unable to load WAD file " << job.wadFile << "\n";
+        return false;
     }
     temporaryLevelData.decompressVertices();
     temporaryLevelData.decompressNodes();
@@ -379,11 +576,258 @@ int main(int _argc, const char** _argv)
     // Translate units from "Doom compatible" to a common frame where we correct for Doom's 1.25 aspect ratio.
     adjustUnits(parsedWAD, metrics);
 
-    // Write into a header/cpp pair
-    serializeWAD(parsedWAD, metrics, fileName);
+    // Optionally replace the WAD's own tree with one built for our renderer
+    BSPBuildResult rebuiltBSP;
+    if (options.buildNodes)
+        rebuildBSP(parsedWAD, metrics, options.threadsPerMap, rebuiltBSP, log);
+
+    // Renumber nodes, subsectors, segs and vertices in traversal order
+    auto layoutBefore = measureLayout(parsedWAD, metrics.numSubsectors);
+    auto optimizedBSP = optimizeLayout(parsedWAD, metrics.numVertices, metrics.numSubsectors);
+    metrics.numSegments = int(optimizedBSP.segments.size());
+    auto layoutAfter = measureLayout(parsedWAD, metrics.numSubsectors);
+    printLayoutStats(log, "Sequential ROM reads before layout", layoutBefore);
+    printLayoutStats(log, "Sequential ROM reads after layout", layoutAfter);
+
+    // Precompute wall lighting
+    auto segLights = bakeSegLights(parsedWAD, metrics.numSegments, metrics.numLineDefs, options.threadsPerMap);
+    segLights.resize((segLights.size() + 3) & ~3, 0); // Serialization works on whole dwords
+
+    // Split out the data the renderer reads during traversal
+    uint32_t paddedSegments = (metrics.numSegments + 3) & ~3;
+    std::vector<uint16_t> segVertices(2 * metrics.numSegments);
+    std::vector<uint8_t> segFrontSectors(paddedSegments, 0);
+    std::vector<uint8_t> segBackSectors(paddedSegments, 0);
+    std::vector<uint8_t> segFlags(paddedSegments, 0);
+    WAD::buildSegRenderData(parsedWAD, metrics.numSegments, segVertices.data(), segFrontSectors.data(), segBackSectors.data(), segFlags.data());
+    parsedWAD.segVertices = segVertices.data();
+    parsedWAD.segFrontSectors = segFrontSectors.data();
+    parsedWAD.segBackSectors = segBackSectors.data();
+    parsedWAD.segFlags = segFlags.data();
+
+    // Linedef lists for collision, on the final vertex and linedef numbering
+    metrics.blockMapSize = int(buildBlockMap(parsedWAD, nullptr));
+    std::vector<uint16_t> blockMap(metrics.blockMapSize);
+    buildBlockMap(parsedWAD, blockMap.data());
+    parsedWAD.blockMap = blockMap.data();
+
+    // Textures the level uses, from the map's WAD first like Doom would load a PWAD over its IWAD
+    std::vector<const WadFile*> textureSources = { job.wad };
+    if (options.iwad)
+        textureSources.push_back(options.iwad);
+    TextureData textures;
+    if (buildTextures(textureSources, temporaryLevelData.wallTextureNames.names(), temporaryLevelData.flatNames.names(), textures, log))
+    {
+        parsedWAD.wallTextures = textures.wallTextures.data();
+        parsedWAD.textureColumns = textures.columns.data();
+        parsedWAD.texels = textures.texels.data();
+        parsedWAD.flats = textures.flats.data();
+        parsedWAD.texturePalette = textures.palette.data();
+    }
+
+    // Limits of the data format and the renderer
+    FootprintReport footprint;
+    footprint.measureFrame(parsedWAD, metrics.numVertices, metrics.numSubsectors, metrics.numSegments);
+    footprint.addLimit("Node count", parsedWAD.numNodes, 0x7fff); // Child indices have 15 bits
+    footprint.addLimit("Subsector count", metrics.numSubsectors, 0x7fff);
+    footprint.addLimit("Seg count", metrics.numSegments, 0x7fff); // Signed 16 bit indices
+    footprint.addLimit("Vertex count", metrics.numVertices, 0x7fff);
+    footprint.addLimit("Sector count", metrics.numSectors, WAD::kNoSector); // 8 bit indices, with one value reserved
+    footprint.addLimit("Blockmap size", metrics.blockMapSize, 0xffff); // 16 bit cell offsets
+    footprint.addLimit("BSP depth", measureBSP(parsedWAD, metrics.numSubsectors, metrics.numSegments).maxDepth, 32); // BSPLocator::kMaxDepth
+
+    // Write into a header/cpp pair, or a binary archive
+    if (options.writeArchive)
+    {
+        if (!serializeWADArchive(parsedWAD, metrics, segLights, textures, job.outputName, options.packing, footprint, log))
+        {
+            log << "Unable to write archive for " << job.outputName << "\n";
+            return false;
+        }
+    }
+    else
+    {
+        serializeWAD(parsedWAD, metrics, segLights, textures, job.outputName, footprint);
+    }
 
     // Finally print metrics
-    metrics.print();
+    metrics.print(log);
+    return footprint.print(log, options.budget);
+}
 
-    return 0;
-}
\ No newline at end of file
+// Every map in a WAD becomes a job. A WAD with a single map keeps its own name for the output, like before batching.
+// Maps of a WAD with several are named after their marker, e.g. e1m1.wad, prefixed with the WAD name when there
+// are several input files.
+bool addMapJobs(const WadFile& wad, const std::string& wadFile, bool prefixWithWadName, std::vector<MapJob>& jobs)
+{
+    auto markers = findMapMarkers(wad);
+    if (markers.empty())
+    {
+        std::cout << "No maps found in " << wadFile << "\n";
+        return false;
+    }
+    if (markers.size() == 1)
+    {
+        jobs.push_back({ &wad, wadFile, markers[0], wadFile });
+        return true;
+    }
+
+    std::filesystem::path wadPath = wadFile;
+    for (int marker : markers)
+    {
+        auto mapName = wad.lumpName(marker);
+        std::transform(mapName.begin(), mapName.end(), mapName.begin(), [](char c) { return char(std::tolower(c)); });
+        if (prefixWithWadName)
+            mapName = wadPath.stem().string() + "_" + mapName;
+        jobs.push_back({ &wad, wadFile, marker, (wadPath.parent_path() / (mapName + ".wad")).string() });
+    }
+    return true;
+}
+
+// Byte counts for budgets, e.g. 4096, 64K or 2M
+uint32_t parseBytes(const std::string& text)
+{
+    size_t end = 0;
+    unsigned long value = std::stoul(text, &end);
+    if (end < text.size() && (text[end] == 'K' || text[end] == 'k'))
+        value *= 1024;
+    else if (end < text.size() && (text[end] == 'M' || text[end] == 'm'))
+        value *= 1024 * 1024;
+    return uint32_t(value);
+}
+
+void printUsage()
+{
+    std::cout << "Usage: wadToCpp [options] <map.wad>...\n"
+        "  --archive               Write an asset archive and its loader instead of C arrays\n"
+        "  --lz77                  Like --archive, compressing lumps where it pays off\n"
+        "  --build-nodes           Rebuild the BSP instead of using the WAD's nodes\n"
+        "  --rom-budget=<bytes>    Fail maps that take more ROM, e.g. 64K\n"
+        "  --ewram-budget=<bytes>  Fail maps that unpack more to EWRAM\n"
+        "  --frame-budget=<bytes>  Fail maps whose BSP traversal reads more\n"
+        "  --iwad=<file>           IWAD to read textures missing from the map WADs\n";
+}
+
+int main(int _argc, const char** _argv)
+{
+
+    std::vector<std::string> wadFiles;
+    std::string iwadFile;
+    ConversionOptions options;
+    for (int i = 1; i < _argc; ++i)
+    {
+        auto argi = std::string(_argv[i]);
+        if (argi == "--archive")
+        {
+            options.writeArchive = true;
+        }
+        else if (argi == "--lz77") // Only meaningful for archives
+        {
+            options.writeArchive = true;
+            options.packing = assets::Packing::Auto;
+        }
+        else if (argi == "--build-nodes")
+        {
+            options.buildNodes = true;
+        }
+        else if (argi.rfind("--rom-budget=", 0) == 0)
+        {
+            options.budget.rom = parseBytes(argi.substr(argi.find('=') + 1));
+        }
+        else if (argi.rfind("--ewram-budget=", 0) == 0)
+        {
+            options.budget.ewram = parseBytes(argi.substr(argi.find('=') + 1));
+        }
+        else if (argi.rfind("--frame-budget=", 0) == 0)
+        {
+            options.budget.frameBytes = parseBytes(argi.substr(argi.find('=') + 1));
+        }
+        else if (argi.rfind("--iwad=", 0) == 0)
+        {
+            iwadFile = argi.substr(argi.find('=') + 1);
+        }
+        else if (argi.rfind("--", 0) == 0)
+        {
+            std::cout << "Unknown option " << argi << "\n";
+            printUsage();
+            return -1;
+        }
+        else
+        {
+            wadFiles.push_back(argi);
+        }
+    }
+    if (wadFiles.empty())
+    {
+        printUsage();
+        return -1;
+    }
+
+    WadFile iwad;
+    if (!iwadFile.empty())
+    {
+        if (!iwad.open(iwadFile.c_str()))
+        {
+            std::cout << "Unable to load IWAD " << iwadFile << "\n";
+            return -1;
+        }
+        options.iwad = &iwad;
+    }
+
+    std::vector<std::unique_ptr<WadFile>> wads;
+    std::vector<MapJob> jobs;
+    for (auto& wadFile : wadFiles)
+    {
+        auto& wad = wads.emplace_back(std::make_unique<WadFile>());
+        if (!wad->open(wadFile.c_str()))
+        {
+            std::cout << "Unable to load WAD file " << wadFile << "\n";
+            return -1;
+        }
+        if (!addMapJobs(*wad, wadFile, wadFiles.size() > 1, jobs))
+            return -1;
+    }
+    for (size_t i = 0; i < jobs.size(); ++i)
+    {
+        for (size_t j = 0; j < i; ++j)
+        {
+            if (jobs[i].outputName == jobs[j].outputName)
+            {
+                std::cout << "Maps in " << jobs[j].wadFile << " and " << jobs[i].wadFile << " would both be written to " << jobs[i].outputName << "\n";
+                return -1;
+            }
+        }
+    }
+
+    // Convert maps concurrently. Logs are kept per map and printed in input order, so output doesn't depend on timing.
+    std::vector<std::ostringstream> logs(jobs.size());
+    std::vector<uint8_t> succeeded(jobs.size(), 0);
+    std::atomic<size_t> nextJob = 0;
+    auto worker = [&]()
+    {
+        for (size_t i = nextJob++; i < jobs.size(); i = nextJob++)
+            succeeded[i] = convertMap(jobs[i], options, logs[i]);
+    };
+
+    unsigned numCores = std::max(1u, std::thread::hardware_concurrency());
+    unsigned numThreads = std::min<unsigned>(numCores, unsigned(jobs.size()));
+    options.threadsPerMap = std::max(1u, numCores / numThreads); // Cores left over by the map workers
+    std::vector<std::thread> threads;
+    for (unsigned t = 1; t < numThreads; ++t)
+        threads.emplace_back(worker);
+    worker();
+    for (auto& t : threads)
+        t.join();
+
+    int result = 0;
+    for (size_t i = 0; i < jobs.size(); ++i)
+    {
+        if (jobs.size() > 1)
+            std::cout << "--- " << jobs[i].outputName << " ---\n";
+        std::cout << logs[i].str();
+        if (!succeeded[i])
+            result = -1;
+    }
+
+    return result;
+}
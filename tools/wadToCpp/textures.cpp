@@ -0,0 +1,329 @@
+#include "textures.h"
+
+#include <algorithm>
+#include <cctype>
+#include <cstring>
+#include <span>
+#include <unordered_map>
+#include <imageUtils.h>
+#include <wadFile.h>
+
+namespace
+{
+    constexpr int16_t kTransparent = -1;
+    constexpr uint32_t kMaxColors = 256;
+
+    // Little endian field at a byte offset, or zero if it is out of bounds
+    template<class T>
+    T read(std::span<const uint8_t> data, size_t offset)
+    {
+        T value{};
+        if (offset + sizeof(T) <= data.size())
+            memcpy(&value, data.data() + offset, sizeof(T));
+        return value;
+    }
+
+    std::string upperName(const char* name)
+    {
+        std::string result(name, strnlen(name, 8));
+        for (auto& c : result)
+            c = char(toupper(uint8_t(c)));
+        return result;
+    }
+
+    std::span<const uint8_t> findLump(const std::vector<const WadFile*>& sources, const std::string& name)
+    {
+        for (auto wad : sources)
+        {
+            int lump = wad->find(name);
+            if (lump != WadFile::kNotFound)
+                return wad->lumpData(lump);
+        }
+        return {};
+    }
+
+    // Flats live between F_START and F_END, or FF_START and FF_END in PWADs
+    std::span<const uint8_t> findFlat(const std::vector<const WadFile*>& sources, const std::string& name)
+    {
+        for (auto wad : sources)
+        {
+            int start = wad->find("F_START");
+            if (start == WadFile::kNotFound)
+                start = wad->find("FF_START");
+            int end = wad->find("F_END");
+            if (end == WadFile::kNotFound)
+                end = wad->find("FF_END");
+
+            int lump = wad->find(name, std::max(start, 0), end);
+            if (lump != WadFile::kNotFound)
+                return wad->lumpData(lump);
+        }
+        return {};
+    }
+
+    // Entry of a TEXTURE1 or TEXTURE2 lump, with the PNAMES its patch indices refer to
+    struct TextureDef
+    {
+        std::span<const uint8_t> data; // maptexture_t: name[8], masked, width, height, columndirectory, patchcount, patches
+        std::span<const uint8_t> patchNames;
+    };
+
+    constexpr size_t kTextureDefSize = 22;
+    constexpr size_t kPatchDefSize = 10; // originx, originy, patch, stepdir, colormap
+
+    // A definition in an earlier source replaces the ones with the same name after it
+    std::unordered_map<std::string, TextureDef> readTextureDefs(const std::vector<const WadFile*>& sources)
+    {
+        std::unordered_map<std::string, TextureDef> defs;
+        for (auto wad : sources)
+        {
+            int patchNames = wad->find("PNAMES");
+            if (patchNames == WadFile::kNotFound)
+                continue;
+            for (auto lumpName : { "TEXTURE1", "TEXTURE2" })
+            {
+                int lump = wad->find(lumpName);
+                if (lump == WadFile::kNotFound)
+                    continue;
+                auto data = wad->lumpData(lump);
+                int32_t count = read<int32_t>(data, 0);
+                for (int32_t i = 0; i < count; ++i)
+                {
+                    int32_t offset = read<int32_t>(data, 4 + 4 * size_t(i));
+                    if (offset <= 0 || size_t(offset) + kTextureDefSize > data.size())
+                        continue;
+                    auto def = data.subspan(offset);
+                    defs.try_emplace(upperName(reinterpret_cast<const char*>(def.data())), TextureDef{ def, wad->lumpData(patchNames) });
+                }
+            }
+        }
+        return defs;
+    }
+
+    // Draws a patch, in Doom's picture format, into a column major texture of PLAYPAL indices
+    void drawPatch(std::span<const uint8_t> patch, int originX, int originY, int width, int height, std::vector<int16_t>& dst)
+    {
+        int patchWidth = read<int16_t>(patch, 0);
+        for (int x = 0; x < patchWidth; ++x)
+        {
+            int dstX = originX + x;
+            if (dstX < 0 || dstX >= width)
+                continue;
+
+            // Columns are runs of opaque texels (posts): top row, length, padding byte, texels, padding byte
+            size_t offset = read<uint32_t>(patch, 8 + 4 * size_t(x));
+            while (offset + 3 <= patch.size() && patch[offset] != 0xff)
+            {
+                int top = patch[offset];
+                int length = patch[offset + 1];
+                size_t texels = offset + 3;
+                if (texels + length > patch.size())
+                    break;
+                for (int i = 0; i < length; ++i)
+                {
+                    int dstY = originY + top + i;
+                    if (dstY >= 0 && dstY < height)
+                        dst[dstX * height + dstY] = patch[texels + i];
+                }
+                offset = texels + length + 1;
+            }
+        }
+    }
+
+    void composeTexture(const TextureDef& def, const std::vector<const WadFile*>& sources, WAD::WallTexture& texture, std::vector<int16_t>& texels, std::ostream& log)
+    {
+        texture.width = uint16_t(std::max<int16_t>(read<int16_t>(def.data, 12), 0));
+        texture.height = uint16_t(std::max<int16_t>(read<int16_t>(def.data, 14), 0));
+        texels.assign(size_t(texture.width) * texture.height, kTransparent);
+
+        int32_t numPatchNames = read<int32_t>(def.patchNames, 0);
+        int patchCount = read<int16_t>(def.data, 20);
+        for (int i = 0; i < patchCount; ++i)
+        {
+            size_t patchDef = kTextureDefSize + i * kPatchDefSize;
+            int16_t patchIndex = read<int16_t>(def.data, patchDef + 4);
+            if (patchIndex < 0 || patchIndex >= numPatchNames || 4 + 8 * size_t(patchIndex + 1) > def.patchNames.size())
+            {
+                log << "Warning: bad patch index " << patchIndex << " in texture " << upperName(reinterpret_cast<const char*>(def.data.data())) << "\n";
+                continue;
+            }
+            auto patchName = upperName(reinterpret_cast<const char*>(def.patchNames.data()) + 4 + 8 * patchIndex);
+            auto patch = findLump(sources, patchName);
+            if (patch.empty())
+            {
+                log << "Warning: missing patch " << patchName << "\n";
+                continue;
+            }
+            drawPatch(patch, read<int16_t>(def.data, patchDef), read<int16_t>(def.data, patchDef + 2), texture.width, texture.height, texels);
+        }
+    }
+
+    // Maps PLAYPAL indices to a palette of the 15 bit colors the level uses, with entry 0 left for transparency.
+    // PLAYPAL colors that end up equal in 15 bits share an entry. If there are still too many, the least used
+    // colors are replaced by the closest one kept.
+    std::vector<uint8_t> buildPalette(std::span<const uint8_t> playPal, const std::vector<uint32_t>& usage, std::vector<uint16_t>& palette)
+    {
+        std::vector<uint16_t> colors(kMaxColors);
+        std::unordered_map<uint16_t, uint32_t> colorUsage;
+        for (uint32_t i = 0; i < kMaxColors; ++i)
+        {
+            colors[i] = Color16b(Color3f{ playPal[3 * i], playPal[3 * i + 1], playPal[3 * i + 2] }).c;
+            if (usage[i])
+                colorUsage[colors[i]] += usage[i];
+        }
+
+        std::vector<std::pair<uint16_t, uint32_t>> used(colorUsage.begin(), colorUsage.end());
+        std::sort(used.begin(), used.end(), [](auto& a, auto& b) { return a.second != b.second ? a.second > b.second : a.first < b.first; });
+        used.resize(std::min<size_t>(used.size(), kMaxColors - 1));
+
+        palette.assign(1, Color16b::transparent().c);
+        std::unordered_map<uint16_t, uint8_t> paletteIndex;
+        for (auto& color : used)
+        {
+            paletteIndex[color.first] = uint8_t(palette.size());
+            palette.push_back(color.first);
+        }
+        if (palette.size() % 2 != 0) // Keep it a multiple of 4 bytes
+            palette.push_back(0);
+
+        auto distance = [](uint16_t a, uint16_t b)
+        {
+            int d = 0;
+            for (int shift = 0; shift < 15; shift += 5)
+            {
+                int channel = int((a >> shift) & 0x1f) - int((b >> shift) & 0x1f);
+                d += channel * channel;
+            }
+            return d;
+        };
+
+        std::vector<uint8_t> remap(kMaxColors, 0);
+        for (uint32_t i = 0; i < kMaxColors; ++i)
+        {
+            if (!usage[i])
+                continue;
+            auto kept = paletteIndex.find(colors[i]);
+            if (kept != paletteIndex.end())
+            {
+                remap[i] = kept->second;
+                continue;
+            }
+            int best = 1;
+            for (int j = 2; j <= int(used.size()); ++j)
+            {
+                if (distance(colors[i], palette[j]) < distance(colors[i], palette[best]))
+                    best = j;
+            }
+            remap[i] = uint8_t(best);
+        }
+        return remap;
+    }
+}
+
+TextureNames::TextureNames(bool reserveNoTexture)
+{
+    if (reserveNoTexture)
+        m_names.push_back("-");
+}
+
+uint16_t TextureNames::id(const char (&name)[8])
+{
+    auto upper = upperName(name);
+    auto pos = std::find(m_names.begin(), m_names.end(), upper);
+    if (pos != m_names.end())
+        return uint16_t(pos - m_names.begin());
+    m_names.push_back(upper);
+    return uint16_t(m_names.size() - 1);
+}
+
+bool buildTextures(const std::vector<const WadFile*>& sources, const std::vector<std::string>& wallNames,
+    const std::vector<std::string>& flatNames, TextureData& dst, std::ostream& log)
+{
+    dst = {};
+    auto playPal = findLump(sources, "PLAYPAL");
+    auto defs = readTextureDefs(sources);
+    if (playPal.size() < 3 * kMaxColors || defs.empty())
+    {
+        log << "No palette or texture definitions found, skipping textures\n";
+        return false;
+    }
+
+    // Compose everything in PLAYPAL indices first, to know which colors are used
+    std::vector<uint32_t> usage(kMaxColors, 0);
+    std::vector<std::vector<int16_t>> wallTexels(wallNames.size());
+    dst.wallTextures.resize(wallNames.size(), WAD::WallTexture{});
+    for (size_t i = 0; i < wallNames.size(); ++i)
+    {
+        if (wallNames[i] == "-")
+            continue;
+        auto def = defs.find(wallNames[i]);
+        if (def == defs.end())
+        {
+            log << "Warning: missing texture " << wallNames[i] << "\n";
+            continue;
+        }
+        composeTexture(def->second, sources, dst.wallTextures[i], wallTexels[i], log);
+        for (auto texel : wallTexels[i])
+        {
+            if (texel != kTransparent)
+                ++usage[texel];
+        }
+    }
+
+    constexpr uint32_t kFlatArea = WAD::kFlatSize * WAD::kFlatSize;
+    std::vector<std::span<const uint8_t>> flatLumps;
+    for (auto& name : flatNames)
+    {
+        auto flat = findFlat(sources, name);
+        if (flat.size() < kFlatArea)
+        {
+            log << "Warning: missing flat " << name << "\n";
+            flat = {};
+        }
+        flatLumps.push_back(flat);
+        for (auto texel : flat.first(flat.empty() ? 0 : kFlatArea))
+            ++usage[texel];
+    }
+
+    auto remap = buildPalette(playPal, usage, dst.palette);
+
+    // Columns, with repeated ones stored once
+    std::unordered_map<std::string, uint32_t> columnOffsets;
+    for (size_t i = 0; i < wallNames.size(); ++i)
+    {
+        auto& texture = dst.wallTextures[i];
+        texture.firstColumn = uint32_t(dst.columns.size());
+        std::string column(texture.height, '\0');
+        for (uint32_t x = 0; x < texture.width; ++x)
+        {
+            for (uint32_t y = 0; y < texture.height; ++y)
+            {
+                int16_t texel = wallTexels[i][x * texture.height + y];
+                column[y] = char(texel == kTransparent ? 0 : remap[texel]);
+            }
+            auto [entry, isNew] = columnOffsets.try_emplace(column, uint32_t(dst.texels.size()));
+            if (isNew)
+                dst.texels.insert(dst.texels.end(), column.begin(), column.end());
+            dst.columns.push_back(entry->second);
+        }
+    }
+    dst.texels.resize((dst.texels.size() + 3) & ~size_t(3), 0); // Serialization works on whole dwords
+
+    // Flats are stored row major in the WAD
+    dst.flats.resize(flatNames.size() * kFlatArea, 0);
+    for (size_t i = 0; i < flatLumps.size(); ++i)
+    {
+        if (flatLumps[i].empty())
+            continue;
+        auto flat = &dst.flats[i * kFlatArea];
+        for (uint32_t x = 0; x < WAD::kFlatSize; ++x)
+        {
+            for (uint32_t y = 0; y < WAD::kFlatSize; ++y)
+                flat[x * WAD::kFlatSize + y] = remap[flatLumps[i][y * WAD::kFlatSize + x]];
+        }
+    }
+
+    log << "Textures: " << wallNames.size() << " walls in " << dst.texels.size() << " bytes, " << flatNames.size() << " flats, "
+        << dst.palette.size() << " colors\n";
+    return true;
+}
@@ -0,0 +1,41 @@
+#pragma once
+
+#include <cstdint>
+#include <ostream>
+#include <string>
+#include <vector>
+#include <WAD.h>
+
+class WadFile;
+
+// Assigns ids to texture names in order of first use. Names compare like in Doom, ignoring case.
+class TextureNames
+{
+public:
+    // Wall tables reserve id 0 for "-", so that WAD::kNoTexture means no texture
+    explicit TextureNames(bool reserveNoTexture);
+
+    uint16_t id(const char (&name)[8]);
+
+    const std::vector<std::string>& names() const { return m_names; }
+
+private:
+    std::vector<std::string> m_names;
+};
+
+// Level textures, ready to serialize. See WAD::LevelData for the layout.
+struct TextureData
+{
+    std::vector<WAD::WallTexture> wallTextures;
+    std::vector<uint32_t> columns;
+    std::vector<uint8_t> texels;
+    std::vector<uint8_t> flats;
+    std::vector<uint16_t> palette;
+};
+
+// Composes the named wall textures from their patches, and extracts the named flats.
+// Lumps are searched in each WAD of sources in order, so a PWAD goes before the IWAD it modifies.
+// Texels are remapped from PLAYPAL to a palette of the 15 bit colors the level uses, merging the least used ones
+// if there are too many. Returns false, leaving dst empty, when the sources have no palette or texture definitions.
+bool buildTextures(const std::vector<const WadFile*>& sources, const std::vector<std::string>& wallNames,
+    const std::vector<std::string>& flatNames, TextureData& dst, std::ostream& log);
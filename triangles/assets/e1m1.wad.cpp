@@ -1,2487 +1,1625 @@
-#include "C:\repos\GBA\raycaster\assets\e1m1.wad.h"
+#include "e1m1.wad.h"
 
-extern const uint32_t e1m1_WADVertices[1884] = {
-458752, 4293132288, 458752, 4292673536, 1507328, 4293132288, 1507328, 4294508544,
-1507328, 4294017024, 4294901760, 4292673536, 4294901760, 4293132288, 4294426624, 4293132288,
-4293771264, 4293591040, 4293722112, 4293951488, 4293853184, 4294770688, 4294901760, 4294885376,
-458752, 4294885376, 1507328, 4294770688, 4294803456, 4293722112, 65536, 4293722112,
-589824, 4293328896, 4294770688, 4293328896, 4293722112, 4294279168, 4293459968, 4293722112,
-4293459968, 4293656576, 4293459968, 4293591040, 4293656576, 4293591040, 4293656576, 4293001216,
-4293197824, 4293656576, 4293197824, 4293722112, 4293394432, 4293197824, 4292935680, 4293197824,
-4292804608, 4293394432, 4292804608, 4293591040, 4292411392, 4293394432, 4293066752, 4293918720,
-4293066752, 4293656576, 4293197824, 4293918720, 4293066752, 4294115328, 4292935680, 4292935680,
-4292673536, 4292935680, 4292280320, 4292935680, 4292280320, 4293148672, 4292509696, 4293197824,
-4292280320, 4293197824, 4292280320, 4293394432, 4291756032, 4293394432, 4291756032, 4293918720,
-4292149248, 4293918720, 4292149248, 4294082560, 4292673536, 4294082560, 4292673536, 4293918720,
-4292149248, 4292673536, 4292149248, 4292280320, 4292673536, 4292198400, 4292411392, 4292198400,
-4291362816, 4292804608, 4290969600, 4292804608, 4291362816, 4292673536, 4291231744, 4292149248,
-4291493888, 4292149248, 4291231744, 4292280320, 4290969600, 4292280320, 4291493888, 4292542464,
-4291887104, 4292542464, 4291887104, 4292673536, 4291756032, 4292280320, 4291756032, 4292083712,
-4292411392, 4292083712, 4292411392, 4291756032, 4292673536, 4292411392, 4293066752, 4292411392,
-4293066752, 4293066752, 4293328896, 4293066752, 4293328896, 4292149248, 4292935680, 4292149248,
-4292935680, 4291887104, 4293394432, 4291887104, 4292673536, 4291756032, 4294115328, 4291624960,
-4292804608, 4291624960, 4292804608, 4291493888, 4292149248, 4291493888, 4292149248, 4291756032,
-4291624960, 4291756032, 4291624960, 4291887104, 4291231744, 4291887104, 4290707456, 4291887104,
-4290707456, 4292673536, 4290707456, 4293066752, 4291231744, 4293066752, 4291231744, 4293197824,
-4291624960, 4293197824, 4291624960, 4292935680, 4294180864, 4293001216, 4294180864, 4292673536,
-4294246400, 4292673536, 4294246400, 4292935680, 4294770688, 4292935680, 4294770688, 4292411392,
-327680, 4292411392, 327680, 4292149248, 4293984256, 4292673536, 4293722112, 4292673536,
-4293722112, 4291887104, 4293853184, 4291887104, 4293853184, 4292280320, 4294508544, 4292280320,
-4293984256, 4292411392, 4294508544, 4292673536, 4294508544, 4292411392, 4294639616, 4292673536,
-4294639616, 4292149248, 4294901760, 4292149248, 4294901760, 4291756032, 4294508544, 4291887104,
-4294770688, 4291887104, 4294770688, 4291231744, 4294508544, 4291624960, 4294246400, 4291624960,
-4294246400, 4292018176, 4294115328, 4292018176, 458752, 4292149248, 458752, 4292411392,
-1245184, 4292411392, 851968, 4291231744, 851968, 4291362816, 851968, 4291756032,
-4293197824, 4293591040, 4292476928, 1245184, 4292673536, 1048576, 4294508544, 4293459968,
-4294508544, 4293722112, 4294705152, 4293722112, 4294754304, 4293722112, 557056, 4293722112,
-606208, 4293722112, 655360, 4293722112, 851968, 4293722112, 851968, 4293459968,
-4290707456, 4292411392, 4290314240, 4292411392, 4291100672, 4293722112, 4291100672, 4293459968,
-4290576384, 4292673536, 1507328, 4293984256, 1507328, 4293591040, 4290576384, 4293197824,
-360448, 4293525504, 32768, 4293525504, 360448, 4293476352, 32768, 4293476352,
-360448, 4293427200, 32768, 4293427200, 4290445312, 4293722112, 4290707456, 4293722112,
-65536, 327680, 65536, 458752, 4293197824, 65536, 4293197824, 4294672384,
-4293197824, 4294639616, 4293197824, 4294377472, 4292739072, 4294443008, 4292935680, 4294639616,
-4292935680, 4294672384, 4293328896, 4294311936, 4292935680, 65536, 327680, 458752,
-327680, 327680, 4294508544, 4294246400, 851968, 4294246400, 589824, 4294508544,
-327680, 4293722112, 0, 4294508544, 4294508544, 4294508544, 393216, 4294508544,
-360448, 4294475776, 32768, 4294475776, 327680, 4294443008, 65536, 4294443008,
-327680, 4294410240, 65536, 4294410240, 851968, 4294017024, 851968, 4293984256,
-65536, 4293984256, 65536, 4294246400, 327680, 4294148096, 4292509696, 4293148672,
-4292673536, 262144, 4292608000, 4294836224, 4291805184, 1114112, 4291887104, 1245184,
-4291624960, 2031616, 4291624960, 2555904, 4291706880, 2572288, 4292329472, 2572288,
-4292411392, 2555904, 4292411392, 2031616, 4292149248, 1245184, 4292149248, 1769472,
-4291887104, 1769472, 4290576384, 4294639616, 4290625536, 4294639616, 4291493888, 2031616,
-4291493888, 2555904, 4292542464, 2555904, 4292542464, 2031616, 4291887104, 2818048,
-4292149248, 2818048, 4291887104, 2686976, 4292149248, 2686976, 4291952640, 4294443008,
-4291952640, 4294115328, 4290838528, 4293787648, 4290838528, 4293853184, 4290772992, 4293853184,
-4290314240, 4294377472, 4290314240, 4294639616, 4290576384, 4294377472, 4290576384, 4294311936,
-4290625536, 4294377472, 4291051520, 4294246400, 4290707456, 4294246400, 4293197824, 4293787648,
-4293459968, 4293787648, 4290707456, 4293459968, 4290772992, 4293722112, 4290772992, 4293459968,
-4290838528, 4293722112, 4290838528, 4293459968, 4291100672, 4293787648, 4291100672, 4293853184,
-4290838528, 4294115328, 4290772992, 4294115328, 4290707456, 4293853184, 4290707456, 4294115328,
-4290641920, 4293853184, 4290641920, 4294115328, 4290576384, 4293853184, 4290576384, 4294115328,
-4290314240, 4294115328, 4290314240, 4294180864, 4290576384, 4294180864, 4290314240, 4294246400,
-4290576384, 4294246400, 4290314240, 4294311936, 4291100672, 4294115328, 4290314240, 4293853184,
-3407872, 4293197824, 3407872, 4293066752, 3407872, 4293328896, 3407872, 4293459968,
-3407872, 4293722112, 3407872, 4293591040, 3407872, 4293853184, 2949120, 4293066752,
-2981888, 4293197824, 3014656, 4293328896, 3047424, 4293459968, 3080192, 4293591040,
-3112960, 4293722112, 3112960, 4293853184, 3407872, 65536, 3407872, 4294901760,
-3407872, 4294770688, 3407872, 4294639616, 3407872, 4294508544, 3407872, 4294377472,
-3407872, 4294246400, 3112960, 4294246400, 3112960, 4294377472, 3080192, 4294508544,
-3047424, 4294639616, 3014656, 4294770688, 2981888, 4294901760, 2949120, 65536,
-2555904, 4294377472, 2818048, 4294377472, 2818048, 4293722112, 2555904, 4293722112,
-2818048, 4294246400, 2818048, 4293853184, 2555904, 4293853184, 2555904, 4294246400,
-2424832, 4293918720, 2424832, 4294180864, 2293760, 4293722112, 2293760, 4294049792,
-2293760, 4294377472, 2424832, 4294377472, 2424832, 4293722112, 2949120, 4292804608,
-4294639616, 4294246400, 4294901760, 4294246400, 4294901760, 4293853184, 4294901760, 4293984256,
-65536, 4293853184, 1933312, 4293197824, 1933312, 4293459968, 1900544, 4293459968,
-1900544, 4293197824, 4294098944, 4293459968, 1245184, 4290969600, 4294508544, 4290969600,
-4291805184, 2670592, 4291559424, 2686976, 4291559424, 3014656, 4291690496, 2949120,
-4291690496, 2768896, 4292345856, 2949120, 4291690496, 3080192, 4292231168, 2670592,
-4292345856, 2768896, 4292476928, 2949120, 4292476928, 2686976, 4292476928, 3080192,
-4293984256, 4293328896, 4293984256, 4293066752, 4293722112, 4293066752, 4293722112, 4293328896,
-4293722112, 4293459968, 4293984256, 4293459968, 4294115328, 4293328896, 4294115328, 4293066752,
-262144, 4292673536, 262144, 4292608000, 131072, 4292608000, 131072, 4292673536,
-1933312, 4294639616, 1933312, 4294901760, 1900544, 4294901760, 1900544, 4294639616,
-3457024, 4294246400, 2293760, 1802240, 5439488, 1671168, 5439488, 4291887104,
-589824, 4293459968, 4294770688, 4293459968, 4293722112, 4293410816, 4293984256, 4293410816,
-1851392, 4293459968, 1851392, 4293197824, 1851392, 4294639616, 1851392, 4294901760,
-327680, 4294098944, 65536, 4294295552, 65536, 4293771264, 327680, 4293771264,
-4294574080, 4293853184, 4294574080, 4293984256, 4294639616, 4294115328, 4294901760, 4294115328,
-4294639616, 4294443008, 49152, 4294443008, 49152, 4294246400, 4294574080, 4294033408,
-4294901760, 4294033408, 4294852608, 4293853184, 16384, 4293984256, 4294639616, 4294197248,
-4294901760, 4294197248, 851968, 4293853184, 819200, 4293853184, 819200, 4293984256,
-720896, 4293787648, 393216, 4293787648, 393216, 4293984256, 393216, 4294246400,
-393216, 4294443008, 589824, 4294443008, 786432, 4294246400, 589824, 4293984256,
-589824, 4294246400, 393216, 4294049792, 393216, 4294180864, 458752, 4294049792,
-524288, 4294082560, 524288, 4294148096, 458752, 4294180864, 786432, 4293853184,
-786432, 4293984256, 458752, 4293984256, 458752, 4294246400, 4294901760, 4294934528,
-458752, 4294934528, 1081344, 4294377472, 1146880, 4294377472, 1179648, 4294410240,
-1179648, 4294475776, 1146880, 4294508544, 1081344, 4294508544, 1048576, 4294475776,
-1048576, 4294410240, 4294082560, 4294443008, 4294148096, 4294443008, 4294180864, 4294475776,
-4294180864, 4294541312, 4294148096, 4294574080, 4294082560, 4294574080, 4294049792, 4294541312,
-4294049792, 4294475776, 2818048, 4293066752, 2818048, 4292804608, 2899968, 4292804608,
-2899968, 4293066752, 3440640, 4292771840, 3440640, 4292853760, 3440640, 4293459968,
-3440640, 4293820416, 3407872, 4292853760, 3407872, 4292804608, 3358720, 4292771840,
-3358720, 4292804608, 2949120, 4292771840, 1638400, 4292542464, 2031616, 4292771840,
-3031040, 4293853184, 3031040, 4294246400, 3457024, 4293853184, 3538944, 4293853184,
-3538944, 4294246400, 3801088, 4294246400, 3866624, 4294180864, 3866624, 4293918720,
-3801088, 4293853184, 3538944, 4293820416, 3801088, 4293820416, 3899392, 4293918720,
-3899392, 4294180864, 3801088, 4294279168, 3538944, 4294279168, 3440640, 4294279168,
-3899392, 4293820416, 3899392, 4294279168, 2555904, 4294180864, 2555904, 4293918720,
-3440640, 4294639616, 3440640, 278528, 3407872, 327680, 3407872, 278528,
-3440640, 360448, 3145728, 360448, 2981888, 360448, 2949120, 327680,
-2981888, 327680, 3145728, 327680, 2031616, 360448, 2031616, 1638400,
-3194880, 327680, 3194880, 360448, 3407872, 360448, 3194880, 458752,
-3407872, 458752, 3407872, 589824, 3194880, 589824, 4915200, 1409024,
-5177344, 884736, 5177344, 4292804608, 1146880, 4293328896, 1212416, 4293328896,
-1245184, 4293361664, 1245184, 4293427200, 1212416, 4293459968, 1146880, 4293459968,
-1114112, 4293427200, 1114112, 4293361664, 2031616, 4291756032, 1638400, 4291887104,
-4293689344, 4293984256, 4293656576, 4293984256, 4293656576, 4293918720, 4293459968, 4293918720,
-4293656576, 4294311936, 4293656576, 4294246400, 4293689344, 4294246400, 4293197824, 4293885952,
-4293459968, 4293885952, 4294901760, 589824, 458752, 589824, 458752, 458752,
-4294901760, 458752, 65536, 4291362816, 65536, 4291624960, 851968, 4291624960,
-4292231168, 4292935680, 4292411392, 4292673536, 4292280320, 4292673536, 4292231168, 4292673536,
-4293394432, 4291936256, 4293722112, 4291936256, 4292411392, 4292411392, 4292411392, 4292460544,
-4292673536, 4292460544, 4294246400, 4292411392, 4294180864, 4292411392, 983040, 4292018176,
-983040, 4292149248, 720896, 4292149248, 720896, 4292018176, 4290969600, 4292673536,
-4290969600, 4292411392, 4291100672, 4292673536, 4291100672, 4292411392, 4290314240, 4292673536,
-4290314240, 4293459968, 4290641920, 4293459968, 4290641920, 4293197824, 4292411392, 4293591040,
-4291952640, 4293591040, 4291952640, 4293722112, 4292542464, 4293656576, 4292542464, 4293885952,
-4292280320, 4293722112, 4292280320, 4293885952, 4292935680, 4293918720, 4292935680, 4293656576,
-4290445312, 4293459968, 4291166208, 4294377472, 4290625536, 4294836224, 4290625536, 131072,
-4290625536, 262144, 4290625536, 589824, 4290625536, 720896, 4290707456, 720896,
-4291100672, 720896, 4291166208, 720896, 4290592768, 131072, 4290592768, 4294836224,
-4290592768, 589824, 4290592768, 262144, 4291100672, 753664, 4290707456, 753664,
-4291231744, 851968, 4290592768, 753664, 4290592768, 4294672384, 4290150400, 4294672384,
-4289527808, 196608, 4289527808, 1114112, 4290052096, 1507328, 4291100672, 1507328,
-4291231744, 1376256, 4289855488, 1048576, 4291166208, 4294639616, 4290953216, 278528,
-4290854912, 278528, 4290854912, 180224, 4290953216, 180224, 4290838528, 393216,
-4290969600, 393216, 4291035136, 327680, 4291035136, 131072, 4290969600, 65536,
-4290838528, 65536, 4290772992, 131072, 4290772992, 327680, 4290707456, 589824,
-4915200, 4292149248, 4293197824, 458752, 4293197824, 933888, 4293312512, 1048576,
-4294262784, 1048576, 4294377472, 933888, 4294377472, 180224, 4294262784, 65536,
-4293591040, 65536, 4293459968, 196608, 4294115328, 393216, 4294115328, 786432,
-4293722112, 786432, 4293722112, 393216, 4293853184, 524288, 4293951488, 524288,
-4293951488, 655360, 4293853184, 655360, 4293984256, 524288, 4293984256, 655360,
-4293427200, 163840, 4293165056, 425984, 4291821568, 4294115328, 4291624960, 4294115328,
-4291461120, 4294197248, 4291362816, 4294377472, 4291821568, 4294443008, 4291772416, 4294443008,
-4291723264, 4294459392, 4291690496, 4294475776, 4291362816, 4294508544, 4291690496, 4294508544,
-4291362816, 229376, 4291690496, 229376, 4291231744, 229376, 4291231744, 327680,
-4291198976, 720896, 4291362816, 720896, 4291362816, 327680, 4291395584, 327680,
-4291428352, 1032192, 4291510272, 1114112, 4291166208, 671744, 4291166208, 458752,
-4291198976, 458752, 4291198976, 671744, 4291231744, 458752, 4291690496, 327680,
-4291805184, 4294836224, 4291756032, 327680, 4291362816, 458752, 4291493888, 4294164480,
-4291362816, 376832, 4291395584, 458752, 4291428352, 589824, 4291887104, 1572864,
-4292149248, 1572864, 4292149248, 1851392, 4291887104, 1851392, 4292001792, 4294115328,
-4292001792, 4294443008, 4291624960, 458752, 4291887104, 1523712, 4292149248, 1523712,
-4291887104, 1294336, 4291887104, 1425408, 4291854336, 1425408, 4291854336, 1294336,
-4291624960, 1294336, 4291690496, 1425408, 4291493888, 1376256, 4291624960, 1507328,
-4291428352, 1507328, 4291428352, 1572864, 4291428352, 1638400, 4291624960, 1638400,
-4291624960, 1572864, 4291428352, 1703936, 4291428352, 1769472, 4291624960, 1769472,
-4291624960, 1703936, 4291428352, 1835008, 4291624960, 1835008, 4291624960, 1900544,
-4291493888, 1900544, 4291493888, 1998848, 4291624960, 1998848, 4292149248, 1294336,
-4291788800, 2686976, 4291690496, 2588672, 4292345856, 2588672, 4292247552, 2686976,
-4291362816, 131072, 4291690496, 131072, 4292542464, 3145728, 4292673536, 3145728,
-4292804608, 3096576, 4292935680, 3047424, 4293066752, 2998272, 4292673536, 2752512,
-4292542464, 2752512, 4293066752, 2555904, 4292935680, 2621440, 4292804608, 2686976,
-4293197824, 2555904, 4293197824, 2998272, 4293328896, 3080192, 4293459968, 3129344,
-4293459968, 2818048, 4293328896, 2621440, 4293591040, 2883584, 4293591040, 3145728,
-4293885952, 3211264, 4293885952, 3342336, 4294017024, 3473408, 4294148096, 3473408,
-4294410240, 3473408, 4294541312, 3473408, 4294672384, 3342336, 4294672384, 2949120,
-4294541312, 2818048, 4294410240, 2818048, 4294148096, 2818048, 4294017024, 2818048,
-4293885952, 2949120, 4293869568, 2932736, 4294000640, 2801664, 4294148096, 2801664,
-4294410240, 2801664, 4294688768, 2932736, 4294688768, 3358720, 4294557696, 3489792,
-4294410240, 3489792, 4294148096, 3489792, 4294000640, 3489792, 4293869568, 3358720,
-4293754880, 2932736, 4293459968, 2785280, 4294557696, 2801664, 4293869568, 3227648,
-4293689344, 3227648, 4293427200, 3473408, 4293427200, 3997696, 4294639616, 3997696,
-65536, 3866624, 327680, 3473408, 327680, 2818048, 65536, 2424832,
-4293459968, 2359296, 4293885952, 3080192, 4293820416, 3080192, 4293722112, 2949120,
-4293722112, 3211264, 4293820416, 3211264, 4293623808, 2899968, 4293623808, 3162112,
-4292509696, 2949120, 4292509696, 3080192, 4293853184, 3080192, 4293853184, 3211264,
-0, 3735552, 0, 2686976, 4294377472, 3211264, 4294508544, 3211264,
-4294508544, 3080192, 4294377472, 3080192, 4294639616, 3211264, 4294639616, 3080192,
-4294541312, 3047424, 4294541312, 3244032, 3080192, 4294443008, 3080192, 4293656576,
-4291231744, 376832, 4291166208, 4294115328, 4291166208, 4293853184, 4291362816, 4294115328,
-4291362816, 4293853184, 1245184, 4291592192, 1245184, 4291395584, 1376256, 4291428352,
-1376256, 4291559424, 1245184, 4291559424, 1245184, 4291428352, 1638400, 4291624960,
-1638400, 4291362816, 1376256, 4291362816, 1376256, 4291624960, 4291100672, 4293820416,
-4291919872, 262144, 4292673536, 851968, 4292149248, 851968, 4291887104, 655360,
-4292476928, 655360, 4292476928, 458752, 4292083712, 458752, 4291624960, 589824,
-4291723264, 327680, 4293689344, 4294279168, 4293689344, 4293951488, 4292345856, 1245184,
-4292280320, 4294836224, 4292149248, 4294836224, 4291674112, 1114112, 4294344704, 3178496,
-4294344704, 3112960, 4294361088, 3112960, 4294361088, 3178496, 2686976, 4293132288,
-2555904, 4293197824, 2424832, 4293263360, 2293760, 4293328896, 2162688, 4293394432,
-2686976, 4292870144, 2555904, 4292935680, 2424832, 4293001216, 2293760, 4293066752,
-2162688, 4293132288, 2818048, 327680, 2818048, 65536, 2899968, 65536,
-2899968, 327680, 2686976, 262144, 2555904, 196608, 2424832, 131072,
-2293760, 65536, 2162688, 0, 2686976, 0, 2555904, 4294901760,
-2424832, 4294836224, 2293760, 4294770688, 2162688, 4294705152, 2129920, 4293132288,
-2129920, 4293394432, 2129920, 4294705152, 2129920, 0, 3407872, 4293509120,
-3407872, 4294590464, 4291362816, 4294606848, 4291362816, 4294705152, 4291362816, 4294803456,
-4291362816, 4294901760, 4291690496, 4294901760, 4291690496, 4294803456, 4291690496, 4294705152,
-4291690496, 4294606848, 4291362816, 32768, 4291690496, 32768, 4291362816, 4294475776,
-4291428352, 622592, 4291624960, 622592, 4290674688, 4293459968, 4290412544, 4293459968,
-4292984832, 4293656576, 4292984832, 4293918720, 4292542464, 2949120, 4292542464, 3080192,
-4292706304, 3145728, 4292706304, 2752512, 4290609152, 4294115328, 4290609152, 4293853184,
-2424832, 4294246400, 2293760, 4294246400, 2949120, 360448, 2949120, 1564672,
-2949120, 1773568, 1933312, 4294705152, 3407872, 1527808, 3407872, 1755136,
-3538944, 1517568, 5177344, 4294279168, 3899392, 4294246400, 5177344, 4294246400,
-5439488, 1366016, 5439488, 4294246400, 1900544, 4294658048, 161792, 589824,
-4294748160, 4294508544, 4294883328, 4294883328, 1507328, 4294246400, 327680, 4294246400,
-4294651904, 4294246400, 4294723584, 4294443008, 4294553600, 4294846464, 4294332416, 4294821888,
-4293722112, 4294246400, 4293197824, 4294699008, 4293722112, 1048576, 4293722112, 65536,
-4294377472, 786432, 4294115328, 65536, 4294115328, 524288, 4293951488, 393216,
-4293984256, 786432, 4293951488, 786432, 4293722112, 524288, 4293722112, 655360,
-4294725632, 2633728, 0, 3080192, 4294498304, 3080192, 4294688768, 3080192,
-4293459968, 2523136, 0, 2420736, 327680, 3080192, 4294715392, 3778560,
-4294860800, 3923968, 0, 3887104, 4294498304, 3211264, 4294426624, 3489792,
-4293507072, 3983360, 1638400, 4293539840, 5177344, 4293459968, 5439488, 4293459968,
-2883584, 4292804608, 3440640, 4292804608, 5439488, 4292804608, 5163008, 4292771840,
-2674688, 4291971072, 2875392, 4292771840, 4800512, 4291862528, 2625536, 4291780608,
-2162688, 4293382144, 1638400, 4293158912, 4293656576, 4293328896, 4292935680, 4293439488,
-4292935680, 4293591040, 4293394432, 4292673536, 4293066752, 4292673536, 4293328896, 4292673536,
-4293984256, 4293001216, 4294508544, 4292935680, 4294508544, 4293132288, 4294508544, 4293591040,
-4294246400, 4292280320, 4293853184, 4292018176, 4293853184, 4291624960, 4292935680, 4292411392,
-4293328896, 4292411392, 4292935680, 4291624960, 4292935680, 4294115328, 1507328, 4293722112,
-393216, 4293459968, 262144, 4293328896, 0, 4293459968, 131072, 4293328896,
-311296, 4293427200, 81920, 4293427200, 311296, 4293476352, 81920, 4293476352,
-4294770688, 4292673536, 4294639616, 4292411392, 1245184, 4292149248, 983040, 4290969600,
-4294770688, 4291624960, 4294770688, 4290969600, 4294901760, 4292018176, 589824, 4294115328,
-4292149248, 2949120, 4292149248, 3080192, 4292673536, 2772992, 4291887104, 514048,
-4291493888, 589824, 4291497984, 622592, 4291887104, 851968, 4292673536, 655360,
-4292673536, 327680, 4291756032, 4293591040, 4292411392, 4293197824, 4292804608, 4293365760,
-4291952640, 4293918720, 4292812800, 4293148672, 4291362816, 4293197824, 4291756032, 4292149248,
-4291362816, 4292149248, 4291362816, 4291887104, 4291887104, 4292280320, 4291756032, 4292542464,
-4292411392, 4291493888, 4292626432, 4294946816, 4290625536, 180224, 4290592768, 147456,
-4289957888, 589824, 4290707456, 1361920, 4289921024, 753664, 4289798144, 1314816,
-4291035136, 278528, 4290772992, 278528, 4290854912, 65536, 4291035136, 180224,
-4291166208, 4294705152, 4290969600, 4291887104};
+extern const uint32_t e1m1_WADVertices[942] = {
+4276094176, 4276094304, 4271900000, 4271899872, 4276094048, 4276094112, 4271899808, 4271899744,
+11535776, 11535328, 52429792, 50070944, 57672800, 56755616, 4286579632, 4292871088,
+1056, 4286579744, 4286579728, 1040, 4284482480, 2098272, 4288676960, 4195488,
+4290774176, 6292704, 4292871392, 8389920, 1312, 10487136, 2098528, 10487200,
+2098592, 2098568, 10487176, 2098816, 4292871808, 4292871600, 4288677504, 4288677312,
+4284483200, 4284483024, 4280288736, 4280288896, 4282910336, 4276094592, 4276094448, 4278191584,
+4271900288, 4271900144, 18876032, 18875928, 48891520, 56166016, 14681624, 14681728,
+11535872, 11535792, 11535896, 11536000, 10487424, 8914560, 10487216, 10487296,
+10487320, 4272949056, 4272948928, 4272949104, 48563904, 45091168, 28314080, 4272949728,
+4271900480, 4271900352, 4271900528, 4271901152, 43715168, 4271901280, 4272948880, 4284483216,
+8914576, 11536016, 53480032, 4288676576, 4280287968, 4280287792, 4280287760, 4292871072,
+4285072288, 4284482440, 4292871048, 4284482464, 10485792, 10485920, 4292346080, 4292411360,
+4293984224, 4293918944, 18874447, 18874592, 14680288, 14680224, 4280287232, 4280352661,
+4280287520, 4280287424, 4292345815, 4271899040, 4279239168, 4277142016, 4271898816, 4278190272,
+4278190368, 4271899008, 4271898912, 4271898848, 4271899360, 4276093488, 4277142080, 4276093456,
+4279239232, 4279238832, 4279238672, 4278190240, 4278190112, 4277141664, 4277141536, 4271898784,
+4271898656, 4273471520, 4271964128, 4271964006, 4278255497, 4278190104, 4271898648, 4291166006,
+4280352544, 4271963936, 4278255216, 4279303808, 4271964000, 4278255456, 4288740832, 4290379466,
+4273012128, 4271963552, 4282449488, 4281400896, 4281400960, 4278255184, 4282449520, 4279303744,
+4286446752, 4285594784, 4285594656, 4284546208, 4276157600, 4284546080, 4274060512, 4274060672,
+4271963520, 4271963536, 4273012112, 18939872, 14745568, 14680096, 14744736, 29949088,
+33619160, 33619360, 2162080, 2162016, 6356256, 25230752, 12647840, 33619624,
+29949664, 25231072, 25230944, 5832416, 2162344, 2162272, 12648032, 16842336,
+12647952, 16842256, 16842272, 25230880, 21036576, 25230864, 21036560, 16842144,
+16842208, 21036448, 21036512, 2161824, 2161696, 13696144, 5307664, 89718584,
+93912952, 85983232, 84344714, 98566144, 94437232, 90242864, 98631392, 98631451,
+97582896, 98631456, 98631544, 89718384, 89718512, 89718312, 75562272, 80805152,
+90242608, 94436848, 93912552, 90242800, 90242672, 77463552, 98566304, 90177696,
+77594656, 107544440, 120979333, 119537664, 125632460, 124387328, 123732000, 111149216,
+102825760, 102825824, 98631520, 102825696, 111214384, 107020144, 102825755, 103874352,
+111738680, 111214320, 111738616, 99679960, 101777112, 101777104, 99679952, 98631152,
+102825456, 98631120, 94436768, 92339552, 100728160, 102825376, 102825424, 92863856,
+101252464, 90242336, 100203808, 98631136, 102825440, 93912496, 89193760, 98630880,
+83950816, 107544040, 103349736, 103349648, 111213840, 127991056, 127532343, 107019760,
+111214128, 111738408, 111738480, 111738608, 111214192, 127991648, 96009376, 81853600,
+81853536, 96009312, 97582112, 83950624, 4259317088, 4259316960, 4269802720, 4261414112,
+4255122784, 4255122656, 4261414048, 4269802656, 4255122528, 4265608288, 4255122592, 4249289504,
+4246733704, 4246734288, 4250928608, 4246734464, 4250928768, 4248307328, 4255123072, 4255122928,
+4253025760, 4259317376, 4259317232, 4259317192, 4271900104, 4271900312, 4259317400, 4259317440,
+4259317568, 4246734480, 4258268816, 4258268864, 4258268992, 4261414768, 4269803376, 4258269040,
+4246735328, 4246735456, 4269803360, 4261414752, 4234151328, 4225762720, 4225762696, 4225762688,
+4234151552, 4227335808, 4225762944, 4225762920, 4238345856, 4238345648, 4242540160, 4242539968,
+4225762960, 4227335824, 4225763808, 4225763936, 4224714344, 4224714384, 4224714144, 4224715225,
+4204792160, 4199089434, 4224714108, 4195617064, 4192994562, 4196403808, 4217373472, 4224713696,
+4196401952, 4192207840, 4238345136, 4246733744, 4244243488, 4236248096, 4236248080, 4244636688,
+4244636704, 4242539616, 4234151008, 4246733728, 4238345120, 4238345096, 4237099808, 4240442528,
+4232053920, 4238345440, 4229956832, 4236248352, 4227859744, 4234151264, 4225762656, 4234151304,
+4250991904, 4250992000, 4242603392, 4250991776, 4246141984, 4250991648, 4246797728, 4250992056,
+4246797856, 4242603552, 4242603424, 4245224864, 4245224992, 4238408960, 4221631904, 4221631744,
+4221632032, 4232117632, 4238408736, 4221631584, 4234214496, 4234214624, 4221631712, 4232117792,
+4234214944, 4234214816, 4232117888, 4221632128, 4221632160, 4230020768, 4230020896, 4236312352,
+4236312312, 4250992416, 4246798112, 4246797912, 4242603616, 4234215008, 4209049248, 4209049376,
+4196466464, 4188077856, 4188077728, 4200660640, 4200660448, 4209049056, 4200660576, 4188077664,
+4188077536, 4196466144, 4213243424, 4213243520, 4221632288, 4213243680, 4213243552, 4213242912,
+4213242976, 4213243104, 4204854496, 4204854304, 4198038784, 4198038944, 4196465696, 4196465920,
+4188077088, 4196466080, 4253088928, 4253089056, 4255186208, 4255186080, 4257283232, 4257283360,
+4260428960, 4260429088, 4261477664, 4261477536, 4261477472, 4253088864, 4253088800, 4261477408,
+4253088824, 4261477432, 4267768928, 4267768864, 4262526368, 4263574928, 4262526352, 4255186720,
+4261477760, 4263574912, 4236247776, 4236247264, 4236312544, 4242603936, 4242538784, 4242539056,
+4242539088, 4246733216, 4255121824, 4255122144, 4250927840, 4246733392, 4246733360, 4243587680,
+4245684832, 4245684768, 4243587616, 4255121728, 4246732992, 4246733088, 4242538624, 4245684400,
+4255186816, 4246732800, 4246798240, 4242538560, 4245684240, 4255121704, 4247257264, 4245684376,
+4255186840, 4247257104, 4245684264, 4255121680, 4248830128, 4247257240, 4255186864, 4248829968,
+4247257128, 4255121440, 4255121568, 4221567200, 4221632480, 4221567104, 4221567040, 4230021024,
+4221632416, 4221632352, 4213243808, 4213178528, 4204789920, 4204855136, 4213243744, 4204855264,
+4219469952, 4219469888, 4204789984, 4213178592, 4213178976, 4204790240, 4204790112, 4204790368,
+4167041632, 4167041504, 4200595936, 4186964576, 4180673120, 4185916000, 4181721696, 4188077984,
+4175495072, 4167106464, 4167106336, 4179624352, 4179623968, 4188012576, 4188012960, 4175430048,
+4192272352, 4200660960, 4192207264, 4200595808, 4196466592, 4181721760, 4185916064, 4188013344,
+4179624736, 4179624608, 4188013216, 4263510048, 4268753056, 4267180192, 4256694304, 4259315744,
+4256694432, 4259381216, 4263575520, 4263510024, 4259381056, 4263575360, 4259381192, 4267769696,
+4267769824, 4265148224, 4265148384, 4270391136, 4270391264, 4257218912, 4257218752, 4263510208,
+4259316096, 4263510400, 4263510240, 4263510304, 4267704608, 4265607392, 4266656000, 4268753152,
+4269801696, 4265607360, 4269801664, 4263510752, 4263510432, 4259316128, 4264559328, 4264559008,
+4263510416, 4259316112, 60881312, 60881248, 65075616, 64027040, 58784160, 58784064,
+56686912, 56687008, 59308576, 59308704, 56687264, 56687136, 64026976, 65075552,
+81852832, 81852768, 85522936, 86047264, 82377160, 86047392, 86047216, 82901440,
+86047104, 96532864, 94435776, 88668608, 98630080, 90241568, 90241696, 94436000,
+98630304, 99154912, 86047712, 88800160, 100727712, 100727728, 88144816, 88144800,
+100727648, 88144736, 94436192, 98630496, 94436160, 98630464, 94436176, 98630480,
+94436096, 88668928, 86047552, 82901760, 86047440, 85523144, 82377464, 81853216,
+65076000, 81853280, 65076064, 54589760, 54589856, 52492608, 52492704, 50395456,
+50395552, 48298304, 48298400, 44104032, 41482656, 50395680, 50395808, 48822816,
+48822944, 41482784, 45677088, 41482912, 45676992, 45677072, 41482768, 16513568,
+18938272, 10549728, 14743968, 18938208, 10549696, 10549552, 14743856, 18938176,
+10549712, 35715576, 39909920, 21035552, 19986848, 19986786, 33093952, 35715432,
+35715512, 19986752, 39910208, 33618848, 27327392, 27327136, 39910048, 39910144,
+27327008, 21035840, 14744384, 14744192, 21035936, 10550176, 4238408528, 4244699872,
+4244699616, 4250991072, 4250991392, 4244699936, 4250991168, 4238408480, 4238408416, 4244700128,
+4250991584, 4243782624, 4261476832, 4261476928, 4255185472, 4261477024, 4255185632, 4260428512,
+4253088608, 4260428640, 4261477280, 4230020128, 4230020000, 4230019808, 4236835552, 4236835664,
+4236835812, 4238407968, 4238408096, 4230019488, 4221630752, 4225825056, 4221631008, 4230019784,
+4221631176, 4221631136, 4221631264, 4221631200, 4202756576, 4202756896, 4192271136, 4192271008,
+4192270752, 4196465056, 4204853728, 4204853536, 4204853600, 4196464928, 4209048224, 4217436704,
+4209048096, 4217436512, 4217436640, 4209048032, 4183882528, 4183882400, 4206427040, 4206426912,
+4213242784, 4213242656, 4192271264, 4188077024, 4183882720, 4214815520, 4214815648, 4278254144,
+4267768384, 4267768320, 4278254080, 4267768224, 4278254056, 4266719904, 4266720160, 4267768408,
+4278254168, 4278254528, 4270389584, 4278778320, 4269341024, 4276156704, 4279302592, 4280351008,
+4280351168, 4279302432, 4283496736, 4283496896, 4286642464, 4286642624, 4289788192, 4289788352,
+4292933920, 4292934080, 1112352, 1112512, 4258080, 4258240, 7403808, 7403968,
+10549536, 4294376329, 4290837376, 4290836984, 8452656, 4290837216, 4290837152, 8453024,
+4267767712, 4267767584, 4269864736, 4269864864, 4271961888, 4271962016, 4274059040, 4274059168,
+4276156192, 4284544800, 4276156320, 4284544928, 4284544952, 4276156344, 4284545216, 4276156608,
+4271962248, 4271962080, 5830584, 8452024, 18937784, 12646432, 10549248, 18937824,
+18937768, 8452008, 4781992, 4285593296, 18937458, 23132128, 23132320, 24180896,
+24180704, 43644896, 48298144, 24180648, 24180320, 33617472, 23132088, 42137124,
+48297632, 6354336, 35714464, 23132352, 27326688, 44103904, 8976472, 8976424,
+12646496, 10549376, 8976512, 8976384, 5830696, 2160680, 2160672, 4257792,
+5830744, 5830784, 4257920, 2160736, 21559488, 14743744, 4286642368, 4290836408,
+4257720, 4257704, 4290836392, 4285593512, 23132368, 23132448, 14743760, 21559504,
+14743776, 14743840, 12122400, 10549472, 12122336, 7403744, 4255184736, 4255184864,
+4246796256, 4246796224, 4246796128, 4246796240, 4238407616, 4238407584, 4246796064, 4246796112,
+4234213600, 4238407904, 4225824864, 4234213344, 4255184896, 4246796288, 4255184928, 4246796320,
+4255185056, 4246796448, 4221630432, 4213241824, 4221630560, 4213241952, 4221630624, 4213242016,
+4196464736, 4196464608, 4209047648, 4209047776, 4204853472, 4196464864, 4213241632, 4221630368,
+4221630240, 4257282080, 4257282208, 4259379232, 4259379360, 4258330784, 4267767840, 4267767968,
+4267768000, 4267768096, 4259379488, 4259379392, 4259379200, 4267767808, 4259379168, 4267767776,
+4259379136, 4267767744, 4259379104, 4267767728, 4259379120, 4259378976};
 extern const uint32_t e1m1_WADLineDefs[3616] = {
-65536, 1, 0, 196607, 65536, 0, 4294901761, 262147,
-1, 131072, 393215, 65542, 0, 4294901763, 458758, 1,
-262144, 589823, 65545, 0, 4294901765, 720906, 1, 393216,
-851967, 65549, 0, 4294901767, 983054, 1, 524288, 1114111,
-393233, 0, 655369, 655378, 1, 720896, 1310719, 65556,
-0, 4294901772, 1441813, 1, 851968, 1507327, 65559, 0,
-4294901774, 1638424, 1, 983040, 1769471, 65563, 0, 4294901776,
-1900572, 1, 1114112, 2031615, 65564, 0, 4294901778, 2097183,
-1, 1245184, 2228223, 65570, 0, 4294901780, 2359331, 1,
-1376256, 2490367, 65574, 0, 4294901782, 2621479, 1, 1507328,
-2686975, 65577, 0, 4294901784, 2752553, 1, 1638400, 2818047,
-65579, 0, 4294901786, 2883627, 1, 1769472, 2949119, 65581,
-0, 4294901788, 3014701, 1, 1900544, 3080191, 65583, 0,
-4294901790, 3211312, 1, 2031616, 3342335, 65587, 0, 4294901792,
-3473460, 1, 2162688, 3604479, 65588, 0, 4294901794, 3670071,
-1, 2293760, 3801087, 65591, 0, 4294901796, 3735610, 1,
-2424832, 3932159, 65596, 0, 4294901798, 3866680, 1, 2555904,
-4063231, 65590, 0, 4294901800, 3997756, 1, 2686976, 4128767,
-65599, 0, 4294901802, 4194367, 1, 2818048, 4259839, 65601,
-0, 4294901804, 4390978, 1, 2949120, 4456447, 65604, 0,
-4294901806, 4522052, 1, 3080192, 4587519, 65606, 0, 4294901808,
-4653126, 1, 3211264, 4718591, 65608, 0, 4294901810, 4784200,
-1, 3342336, 4325375, 65610, 0, 4294901812, 3276874, 1,
-3473408, 4980735, 65612, 0, 4294901814, 5046348, 1, 3604480,
-5111807, 65614, 0, 4294901816, 5177422, 1, 3735552, 5242879,
-65616, 0, 4294901818, 5308496, 1, 3866624, 5373951, 65618,
-0, 4294901820, 5439570, 1, 3997696, 5570559, 65621, 0,
-4294901822, 5636181, 1, 4128768, 5701631, 65623, 0, 4294901824,
-5767255, 1, 4259840, 5832703, 65625, 0, 4294901826, 5898263,
-1, 4390912, 5963775, 65627, 0, 4294901828, 6029403, 1,
-4521984, 6094847, 65629, 0, 4294901830, 6160477, 1, 4653056,
-6225919, 65631, 0, 4294901832, 6291551, 1, 4784128, 6356991,
-65633, 0, 4294901834, 6488162, 1, 4915200, 6619135, 65637,
-0, 4294901836, 6684773, 1, 5046272, 6750207, 65639, 0,
-4294901838, 6422632, 1, 5177344, 6946815, 65642, 0, 4294901840,
-6881387, 1, 5308416, 7143423, 65643, 0, 4294901842, 7077997,
-1, 5439488, 7274495, 65645, 0, 4294901844, 7274599, 1,
-5570560, 7340031, 65648, 0, 4294901846, 7405680, 1, 5701632,
-7536639, 65651, 0, 4294901848, 7602291, 1, 5832704, 7667711,
-65653, 0, 4294901850, 4915317, 1, 5963776, 6422527, 65654,
-0, 4294901852, 7798902, 1, 6094848, 7864319, 65656, 0,
-4294901854, 7995513, 1, 6225920, 8126463, 65646, 0, 4294901856,
-4063281, 1, 6356992, 8191999, 786453, 0, 6488162, 8257661,
-1, 6553600, 8388607, 393344, 0, 6684773, 8454272, 1,
-6750208, 8519679, 65666, 0, 4294901864, 917634, 1, 6881280,
-8650751, 65668, 0, 4294901866, 8716420, 1, 7012352, 8781823,
-65670, 0, 4294901868, 8847494, 6, 7143424, 8913006, 1114249,
-0, 4294901871, 9109642, 9, 7340032, 9240575, 1114196, 0,
-4294901873, 9306253, 1, 7471104, 9437183, 65676, 0, 4294901875,
-8585360, 4, 7602176, 9502837, 262288, 0, 7798902, 9502734,
-4, 7864320, 9568377, 262276, 0, 8061050, 9568403, 4,
-8126464, 8519805, 262291, 0, 8323198, 8716436, 4, 8388608,
-9764993, 262292, 0, 8585346, 9764993, 4, 8650752, 5374085,
-4980791, 0, 8847494, 9896086, 9, 8912896, 10027007, 1114265,
-0, 4294901897, 10158234, 1, 9043968, 10223615, 1114268, 0,
-4294901899, 10289308, 1, 9175040, 10420223, 65695, 0, 4294901901,
-10485919, 17, 9306112, 10354687, 65697, 0, 4294901903, 10616992,
-1, 9437184, 10223615, 262304, 0, 9568401, 10223775, 4,
-9633792, 10682516, 1114276, 0, 4294901909, 10748056, 4, 9830400,
-10813591, 196736, 0, 4294901912, 10944678, 3, 10027008, 11075583,
-65667, 0, 4294901914, 11141289, 3, 10158080, 11010047, 196779,
-0, 4294901916, 786443, 14, 10289152, 10813598, 393225, 0,
-10485919, 11075755, 12, 10551296, 11272354, 262317, 0, 10748067,
-11468974, 12, 10813440, 11468966, 65709, 0, 4294901927, 11075757,
-1, 11010048, 11272191, 65708, 0, 4294901929, 11403436, 1,
-11141120, 655359, 262162, 0, 11272363, 11010063, 12, 11337728,
-11534510, 262321, 0, 11534511, 11468977, 1, 11599872, 11468799,
-65712, 0, 4294901938, 10879154, 3, 11730944, 327679, 1245325,
-0, 4294901940, 9240755, 6, 11862016, 262326, 917682, 0,
-12058807, 11665587, 19, 12124160, 11862015, 65717, 0, 4294901946,
-11927728, 1, 12255232, 8191999, 65560, 0, 4294901948, 1376276,
-1, 12386304, 2621439, 262268, 0, 12517566, 11993126, 1,
-12582912, 12058623, 65575, 0, 4294901953, 1769509, 4, 12713984,
-1704131, 262243, 0, 12910788, 6422551, 4, 12976128, 1900743,
-65660, 0, 4294901960, 2293787, 1, 13172736, 12124159, 65721,
-0, 4294901962, 12255418, 1, 13303808, 12386303, 262333, 0,
-13435084, 12452029, 1, 13500416, 12582911, 65728, 0, 4294901967,
-12648640, 4, 13631488, 12255441, 1835202, 0, 13828306, 12845251,
-4063236, 13893643, 12910805, 590022, 0, 4294901974, 13107399, 1,
-14090240, 13238271, 65738, 0, 4294901976, 13369547, 1, 14221312,
-13172735, 65725, 0, 4294901978, 13304013, 1, 14352384, 13434879,
-65742, 0, 4294901980, 13172928, 1, 14483456, 13303807, 65729,
-0, 4294901982, 13631695, 12, 14614528, 13697248, 590034, 0,
-4294901985, 13828306, 9, 14811136, 13959167, 590037, 0, 4294901987,
-14090454, 9, 14942208, 14221311, 1114326, 0, 4294901989, 14287065,
-17, 15073280, 14352383, 1114328, 0, 4294901991, 1245209, 4,
-15204352, 1638633, 65755, 0, 4294901994, 1245404, 1, 15400960,
-1638399, 262164, 0, 15532268, 14418139, 6, 15597568, 9896175,
-262365, 0, 15794416, 14614750, 4, 15859712, 14680307, 262369,
-0, 16056564, 9044192, 4, 16121856, 13697271, 262370, 0,
-16318712, 14876882, 4, 16384000, 13762811, 262372, 0, 16580860,
-15007955, 4, 16646144, 15073535, 262375, 0, 16843008, 15270120,
-4, 16908288, 15335683, 786667, 0, 17105156, 15401196, 4,
-17170432, 15532295, 262382, 0, 17367304, 15728879, 4, 17432576,
-15794443, 262359, 0, 17629452, 14745739, 9, 17694720, 14811135,
-590047, 0, 4294902031, 14483679, 9, 17825792, 9961471, 590046,
-0, 4294902033, 14680286, 9, 17956864, 14745599, 590033, 0,
-4294902035, 9044194, 9, 18087936, 15007743, 590066, 0, 4294902037,
-15139049, 9, 18219008, 15204351, 590053, 0, 4294902039, 14942437,
-9, 18350080, 13893631, 590054, 0, 4294902041, 15204582, 9,
-18481152, 15400959, 590067, 0, 4294902043, 15466739, 9, 18612224,
-14155775, 590064, 0, 4294902045, 15597808, 9, 18743296, 15663103,
-590059, 0, 4294902047, 15532268, 9, 18874368, 15597567, 590063,
-0, 4294902049, 15794415, 9, 19005440, 15859711, 590036, 0,
-4294902051, 16056564, 13, 19136512, 16122149, 852212, 0, 19333414,
-16122103, 13, 19398656, 16253225, 65785, 0, 4294902058, 16253178,
-1, 19595264, 16515071, 65788, 0, 4294902060, 16580860, 1,
-19726336, 16646143, 65790, 0, 4294902062, 16711934, 1, 19857408,
-16842751, 65793, 0, 4294902064, 16056571, 4, 19988480, 16515378,
-262388, 0, 20185395, 16122109, 4, 20250624, 16646454, 262391,
-0, 20447543, 16318719, 4, 20512768, 16777530, 262392, 0,
-20709691, 16384257, 4, 20774912, 16908606, 852227, 0, 20971839,
-17039619, 13, 21037056, 17039682, 852229, 0, 21233987, 17236230,
-9, 21299200, 17301503, 590088, 0, 4294902086, 17432841, 1,
-21430272, 17563647, 65804, 0, 4294902088, 17629452, 1, 21561344,
-17694719, 65806, 0, 4294902090, 17760526, 1, 21692416, 17367039,
-262409, 0, 21823820, 17432839, 4, 21889024, 17170767, 262411,
-0, 22085968, 17563909, 4, 22151168, 17039699, 262413, 0,
-22348116, 17694979, 4, 22413312, 16908631, 262415, 0, 22610264,
-17891600, 1, 22675456, 18022399, 65811, 0, 4294902107, 18088209,
-17, 22806528, 18219007, 1114386, 0, 4294902109, 18219283, 17,
-22937600, 18350079, 1114384, 0, 4294902111, 18088215, 29, 23068672,
-18153825, 1900822, 0, 23265634, 18415896, 29, 23330816, 18481509,
-65819, 0, 4294902118, 18678044, 17, 23527424, 18743295, 65817,
-0, 4294902120, 18743576, 1, 23658496, 18808831, 1114394, 0,
-4294902122, 18809083, 12, 23789568, 18547052, 65820, 0, 4294902125,
-18940192, 5767180, 23986180, 19005807, 786723, 262232, 24183152, 19005732,
-1, 24248320, 19267583, 262438, 1, 24379763, 19267879, 17,
-24444928, 19267583, 1114408, 0, 4294902134, 19464199, 1, 24576000,
-19595263, 65835, 0, 4294902136, 7929969, 1, 24707072, 19660799,
-65650, 0, 4294902138, 13435180, 1, 24838144, 12517375, 262444,
-0, 24969596, 19792173, 1, 25034752, 19922943, 65840, 0,
-4294902143, 19857713, 1, 25165824, 19857407, 65842, 0, 4294902145,
-20119758, 1, 25296896, 20185087, 262335, 0, 25428355, 19988788,
-1, 25493504, 20316159, 65846, 0, 4294902150, 20382002, 1,
-25624576, 20512767, 262457, 65624, 25756040, 20578617, 1, 25821184,
-20643839, 65851, 0, 4294902155, 524604, 1, 25952256, 20512767,
-786747, 65598, 26083725, 20775209, 1, 26148864, 20840447, 262460,
-65624, 26280336, 20840760, 1, 26345472, 20905983, 65855, 0,
-4294902163, 20513087, 1, 26476544, 131071, 65856, 0, 4294902165,
-21037376, 17, 26607616, 21102591, 65858, 0, 4294902167, 21168450,
-17, 26738688, 21233663, 65541, 0, 4294902169, 21168448, 4,
-26869760, 19333531, 262440, 1, 27066780, 21299524, 65540, 27131904,
-21365151, 1114437, 0, 4294902176, 21430596, 17, 27328512, 21430271,
-262471, 1, 27460002, 21496072, 1, 27525120, 21626879, 65866,
-0, 4294902181, 21692746, 1, 27656192, 8912895, 393548, 0,
-27787687, 1048908, 6, 27852800, 1114538, 393549, 0, 28049835,
-8323405, 6, 28114944, 21889454, 65852, 0, 4294902191, 21889339,
-1, 28311552, 20840447, 65871, 0, 4294902193, 20447567, 1,
-28442624, 917503, 786435, 0, 28574131, 22020238, 1, 28639232,
-22151167, 65538, 0, 4294902198, 22085928, 1, 28770304, 22085631,
-65831, 0, 4294902200, 196946, 1, 28901376, 917503, 65875,
-0, 4294902202, 21365075, 17, 29032448, 21495807, 1114450, 0,
-4294902204, 22282422, 1, 29163520, 11927551, 65877, 0, 4294902206,
-11600213, 1, 29294592, 1048575, 65878, 0, 4294902208, 19136854,
-1, 29425664, 22347775, 65879, 0, 4294902210, 11010391, 1,
-29556736, 11206655, 196773, 0, 4294902212, 22610264, 1, 29687808,
-22675455, 262435, 0, 29819334, 22741338, 4063236, 29884420, 22806985,
-65885, 0, 4294902218, 22937949, 1, 30081024, 23003135, 65825,
-0, 4294902220, 23003481, 1, 30212096, 23134207, 65827, 0,
-4294902222, 23069019, 1, 30343168, 23068671, 65882, 0, 4294902224,
-22544737, 1, 30474240, 19070975, 65889, 0, 4294902226, 23200035,
-1, 30605312, 23265279, 65716, 0, 4294902228, 22806816, 1,
-30736384, 22740991, 65891, 0, 4294902230, 18874723, 1, 30867456,
-23396351, 65883, 0, 4294902232, 23331105, 1, 30998528, 8847359,
-196965, 0, 4294902234, 11731301, 65574, 31129600, 23396828, 1245542,
-0, 4294902237, 11731303, 19, 31326208, 23658495, 1245545, 0,
-4294902239, 23724393, 19, 31457280, 23855103, 1245548, 0, 4294902241,
-23921004, 19, 31588352, 23986175, 1245550, 0, 4294902243, 23462247,
-65542, 31719424, 24052197, 393584, 0, 31916518, 24183146, 11,
-31981568, 24248319, 1245554, 327783, 4294902249, 23789938, 11, 32112640,
-24248319, 393587, 0, 32244203, 24379763, 6, 32309248, 24379886,
-393589, 0, 32506351, 24510837, 6, 32571392, 24510962, 393586,
-0, 32768499, 23593335, 19, 32833536, 24051711, 1245560, 0,
-4294902262, 23527800, 19, 32964608, 23527423, 1245559, 0, 4294902264,
-24576376, 14, 33095680, 23724538, 393593, 0, 33292795, 24052089,
-6, 33357824, 24117758, 393594, 0, 33554943, 23789946, 6,
-33619968, 24510978, 393594, 0, 33817091, 24314233, 6, 33882112,
-24838662, 65688, 0, 4294902279, 24903844, 1, 34078720, 24969215,
-65548, 0, 4294902281, 24838155, 1, 34209792, 25034751, 196990,
-0, 4294902283, 25100670, 3, 34340864, 25165823, 196992, 0,
-4294902285, 25231744, 3, 34471936, 25296895, 196994, 0, 4294902287,
-25362818, 3, 34603008, 25427967, 196996, 0, 4294902289, 24969604,
-3, 34734080, 25559039, 196998, 0, 4294902291, 25624966, 3,
-34865152, 25690111, 197000, 0, 4294902293, 25756040, 3, 34996224,
-25821183, 197002, 0, 4294902295, 25887114, 3, 35127296, 25952255,
-197004, 0, 4294902297, 25493900, 3, 35258368, 26083327, 262542,
-0, 35389979, 26083727, 1, 35454976, 18874367, 65935, 0,
-4294902302, 26214797, 1, 35586048, 26279935, 65787, 0, 4294902304,
-26345873, 1, 35717120, 26476543, 65940, 0, 4294902306, 26542325,
-13, 35848192, 26542628, 65942, 0, 4294902309, 26542482, 1,
-36044800, 26738687, 65937, 0, 4294902311, 26739094, 1, 36175872,
-26804223, 852255, 0, 36307497, 26673561, 29, 36372480, 26739244,
-65943, 0, 4294902317, 18809241, 1, 36569088, 26935295, 65947,
-0, 4294902319, 26411255, 1, 36700160, 26411007, 1900947, 0,
-36831793, 27001089, 1, 36896768, 27066367, 65813, 0, 4294902324,
-27066644, 1, 37027840, 27131903, 65801, 0, 4294902326, 16384414,
-1, 37158912, 27262975, 65950, 0, 4294902328, 27263304, 1,
-37289984, 27328511, 1900961, 0, 37421626, 27394465, 1, 37486592,
-27459583, 1900963, 0, 37618237, 27525539, 1, 37683200, 27590655,
-1900959, 0, 37814848, 27656613, 29, 37879808, 27722307, 1900968,
-0, 38076996, 27918761, 29, 38141952, 27263559, 65962, 0,
-4294902344, 27197861, 1, 38338560, 27590655, 65958, 0, 4294902346,
-27460007, 1, 38469632, 27459583, 65960, 0, 4294902348, 27328937,
-1, 38600704, 26542079, 65957, 0, 4294902350, 27984298, 1,
-38731776, 27721727, 65964, 0, 4294902352, 27722156, 1, 38862848,
-27852799, 65965, 0, 4294902354, 27853229, 1, 38993920, 18481151,
-65966, 0, 4294902356, 18284974, 1, 39124992, 18284543, 65967,
-0, 4294902358, 18350511, 1, 39256064, 28049407, 65968, 0,
-4294902360, 17105328, 1, 39387136, 28377087, 1900977, 0, 39518810,
-28508594, 9, 39583744, 28573695, 852226, 0, 39715421, 28377523,
-1, 39780352, 28442623, 65972, 0, 4294902368, 28705205, 28,
-39911424, 28770914, 65976, 0, 4294902371, 28705208, 1, 40108032,
-28901375, 1835449, 0, 40239717, 28901813, 1, 40304640, 28770303,
-65978, 0, 4294902376, 29032890, 1, 40435712, 29097983, 65865,
-0, 4294902378, 28443068, 36, 40566784, 29098604, 65981, 0,
-4294902381, 28639677, 1, 40763392, 28966911, 590268, 0, 4294902383,
-17760695, 12, 40894464, 29229681, 3408317, 31, 41091698, 29229492,
-1, 41156608, 29294591, 65970, 0, 4294902389, 29163967, 20,
-41287680, 29229687, 1311168, 0, 41484920, 29426112, 20, 41549824,
-29491835, 1311167, 0, 41747068, 29491649, 4, 41811968, 29360767,
-262591, 0, 42009216, 29557179, 4, 42074112, 29557379, 262596,
-0, 42271364, 29688260, 4, 42336256, 29753991, 197063, 0,
-4294902408, 29884871, 3, 42532864, 29949951, 197065, 0, 4294902410,
-30015945, 3, 42663936, 30081023, 197067, 0, 4294902412, 30147019,
-3, 42795008, 30212095, 197069, 0, 4294902414, 29753805, 3,
-42926080, 21757951, 65998, 0, 4294902416, 30343630, 1, 43057152,
-30474239, 1114577, 0, 4294902418, 30605778, 1, 43188224, 10616831,
-66004, 0, 4294902420, 30802389, 17, 43319296, 14417919, 66007,
-0, 4294902422, 2163159, 17, 43450368, 30670847, 1114584, 0,
-4294902424, 14418392, 1, 43581440, 30474239, 262614, 28, 43713178,
-30474709, 1835012, 43778048, 30605981, 2490401, 0, 43975326, 30933463,
-2031620, 44040192, 30999201, 66010, 0, 4294902434, 31130074, 1,
-44236800, 31260671, 66009, 0, 4294902436, 31195289, 1, 44367872,
-31195135, 65699, 0, 4294902438, 30736852, 1, 44498944, 30539775,
-66002, 0, 4294902440, 31260794, 1, 44630016, 31326207, 66014,
-0, 4294902442, 31392222, 1, 44761088, 31457279, 65659, 0,
-4294902444, 31457369, 1, 44892160, 31522815, 65573, 0, 4294902446,
-31588833, 1, 45023232, 31653887, 66019, 0, 4294902448, 3146211,
-1, 45154304, 31653887, 786469, 0, 45286066, 31654368, 12,
-45350912, 4784821, 66020, 0, 4294902454, 1704420, 1, 45547520,
-6553599, 66021, 0, 4294902456, 6554085, 1, 45678592, 31850495,
-786916, 0, 45810362, 6553673, 12, 45875200, 3343037, 66022,
-0, 4294902462, 31916518, 1, 46071808, 31981567, 66017, 0,
-4294902464, 31981604, 1, 46202880, 32047103, 65602, 0, 4294902466,
-31916520, 12, 46333952, 31851204, 786498, 0, 46531269, 32047210,
-1, 46596096, 32112639, 66026, 0, 4294902472, 6816234, 1,
-46727168, 6029311, 786922, 0, 46858954, 6029801, 12, 46923776,
-32178893, 66028, 0, 4294902478, 32309740, 1, 47120384, 32374783,
-66030, 0, 4294902480, 32178670, 1, 47251456, 5505023, 65672,
-0, 4294902482, 5505160, 3014756, 47382534, 3474132, 66031, 0,
-4294902485, 32506351, 37, 47579136, 32506583, 65594, 0, 4294902488,
-32571887, 1, 47775744, 32636927, 66034, 0, 4294902490, 32506354,
-1, 47906816, 3473407, 4980822, 0, 48038620, 32702601, 17,
-48103424, 32767999, 66036, 0, 4294902495, 32702604, 65572, 48234496,
-32834273, 66038, 0, 4294902498, 9372150, 1, 48431104, 33030143,
-65566, 0, 4294902500, 32965112, 1, 48562176, 33161215, 66040,
-0, 4294902502, 33227258, 1, 48693248, 33357823, 66041, 0,
-4294902504, 33292797, 1, 48824320, 33292287, 66045, 0, 4294902506,
-33489406, 4, 48955392, 33489644, 66042, 0, 4294902509, 33423407,
-1, 49152000, 14024703, 590021, 0, 4294902511, 33554933, 12,
-49283072, 32768753, 262287, 0, 49480434, 14024901, 4, 49545216,
-33620725, 1114329, 0, 4294902518, 33685702, 9, 49741824, 33751039,
-1901059, 0, 49873656, 33817091, 9, 49938432, 33882111, 1901061,
-0, 50070267, 33948165, 589841, 50135048, 34013183, 590343, 0,
-4294902526, 34079239, 28, 50266112, 34079488, 590345, 0, 4294902529,
-34275850, 29, 50462720, 34341635, 1901069, 0, 50660100, 34537998,
-29, 50724864, 34603783, 590350, 0, 4294902536, 34669071, 9,
-50921472, 34734079, 590348, 0, 4294902538, 34210317, 9, 51052544,
-34340863, 590354, 0, 4294902540, 34800146, 9, 51183616, 34865151,
-590356, 0, 4294902542, 34931220, 9, 51314688, 34996223, 590358,
-0, 4294902544, 35062294, 9, 51445760, 35127295, 590360, 0,
-4294902546, 34603544, 9, 51576832, 33751039, 590347, 0, 4294902548,
-33751562, 9, 51707904, 33882111, 590349, 0, 4294902550, 33882636,
-9, 51838976, 34078719, 590351, 0, 4294902552, 34079246, 9,
-51970048, 34865151, 9175577, 0, 52101914, 35062297, 140, 52166656,
-35259165, 1114625, 0, 4294902558, 12976666, 28, 52363264, 35324704,
-262684, 0, 52560673, 35455516, 4, 52625408, 35455780, 262686,
-0, 52822821, 35324446, 4, 52887552, 35586856, 262688, 0,
-53084969, 35717664, 4, 53149696, 35717932, 262690, 0, 53347117,
-35848738, 4, 53411840, 35849008, 262692, 0, 53609265, 35979812,
-4, 53673984, 35980084, 262694, 0, 53871413, 35586598, 4,
-53936128, 33882936, 1835559, 0, 54133561, 34013735, 28, 54198272,
-29688636, 262696, 0, 54395709, 30343720, 4, 54460416, 30344000,
-65946, 0, 4294902593, 36307497, 1, 54657024, 36372479, 66091,
-0, 4294902595, 36438571, 1, 54788096, 36503551, 66093, 0,
-4294902597, 36569645, 1, 54919168, 36634623, 66095, 0, 4294902599,
-36700719, 1, 55050240, 36765695, 66097, 0, 4294902601, 36241969,
-28, 55181312, 36832075, 262707, 0, 55378764, 36962867, 4,
-55443456, 36963151, 262709, 0, 55640912, 36831797, 4, 55705600,
-37094227, 66103, 0, 4294902612, 37225015, 6750225, 55902215, 37289983,
-66105, 0, 4294902614, 37093945, 1, 56033280, 37224447, 787002,
-0, 56165208, 37421626, 12, 56229888, 37421915, 787000, 0,
-56427356, 10093116, 1, 56492032, 36831231, 66108, 0, 4294902623,
-37552290, 1, 56623104, 37617663, 66089, 0, 4294902625, 37617872,
-1, 56754176, 37683199, 66111, 0, 4294902627, 37814848, 1,
-56885248, 37945343, 65743, 0, 4294902629, 37880382, 4, 57016320,
-37684071, 262723, 0, 57213800, 38011456, 12, 57278464, 37815147,
-262725, 0, 57475948, 38208070, 12, 57540608, 38208367, 66117,
-0, 4294902640, 38011461, 1, 57737216, 38076415, 66115, 0,
-4294902642, 37880387, 1, 57868288, 38338559, 787017, 0, 58000244,
-38404680, 1, 58064896, 38469631, 66123, 655422, 4294902647, 38601292,
-1, 58195968, 38731775, 66127, 0, 4294902649, 38863440, 1,
-58327040, 34209791, 590418, 0, 4294902651, 38994514, 28, 58458112,
-38994813, 590362, 0, 4294902654, 39125588, 29, 58654720, 39191424,
-66132, 0, 4294902657, 38535765, 1, 58851328, 38993919, 66133,
-0, 4294902659, 38994516, 1, 58982400, 38797311, 787031, 0,
-59114373, 38339159, 1, 59179008, 39387135, 66137, 0, 4294902664,
-39453261, 1, 59310080, 39256063, 262746, 655448, 59442058, 38666824,
-5767348, 59506698, 37684109, 66139, 0, 4294902670, 37749339, 1,
-59703296, 39518207, 66140, 0, 4294902672, 38666844, 1, 59834368,
-38797311, 66141, 0, 4294902674, 39715421, 1, 59965440, 39845887,
-65732, 0, 4294902676, 39846083, 1, 60096512, 39911423, 262751,
-720984, 60228502, 39911617, 1, 60293120, 39976959, 65731, 0,
-4294902681, 39977156, 1, 60424192, 40042495, 65724, 0, 4294902683,
-39977569, 5767172, 60555275, 2229149, 66147, 0, 4294902686, 10355300,
-1, 60751872, 13631487, 66148, 0, 4294902688, 13632099, 1,
-60882944, 39452671, 1835621, 0, 61014946, 39780966, 1, 61079552,
-39911423, 66151, 0, 4294902693, 40436328, 65572, 61210624, 40436647,
-66150, 0, 4294902696, 40567402, 65572, 61407232, 40502186, 1114729,
-0, 4294902699, 40567400, 17, 61603840, 40632319, 590444, 0,
-4294902701, 40501869, 9, 61734912, 40697855, 590446, 0, 4294902703,
-40698479, 9, 61865984, 40828927, 590448, 0, 4294902705, 40960624,
-9, 61997056, 41025535, 590450, 0, 4294902707, 41157235, 9,
-62128128, 41222143, 590447, 0, 4294902709, 41222770, 9, 62259200,
-41287679, 590454, 0, 4294902711, 41419383, 9, 62390272, 41484287,
-590451, 0, 4294902713, 41484918, 9, 62521344, 41615359, 590455,
-0, 4294902715, 41550459, 9, 62652416, 41549823, 590460, 0,
-4294902717, 40632941, 4, 62783488, 40829887, 262766, 0, 62981056,
-40895087, 4, 63045632, 41157571, 262769, 0, 63243204, 41026163,
-4, 63307776, 41419719, 262773, 0, 63505352, 41288311, 4,
-63569920, 41550795, 262777, 0, 63767500, 41681531, 4, 63832064,
-41681871, 590461, 0, 4294902736, 13042301, 17, 64028672, 12386303,
-1114750, 0, 4294902738, 41615998, 9, 64159744, 13107199, 262332,
-0, 64291796, 40370363, 1, 64356352, 40370175, 66175, 0,
-4294902743, 12714623, 1, 64487424, 19988479, 66176, 0, 4294902745,
-19726977, 1, 64618496, 12517375, 1114753, 0, 4294902747, 19661440,
-17, 64749568, 42008575, 262785, 0, 64881629, 42074422, 1,
-64946176, 42205183, 65844, 0, 4294902752, 42139955, 17, 65077248,
-42139647, 1114303, 0, 4294902754, 42140290, 4, 65208320, 13435876,
-262350, 786535, 65405925, 38273668, 1, 65470464, 38404095, 66181,
-0, 4294902760, 20382005, 4, 65601536, 42337258, 66183, 0,
-4294902763, 42533512, 1, 65798144, 42598399, 66186, 0, 4294902765,
-42730123, 1, 65929216, 42860543, 66190, 0, 4294902767, 42926734,
-1, 66060288, 43057151, 66189, 0, 4294902769, 43057802, 1,
-66191360, 43122687, 66194, 0, 4294902771, 43188882, 1, 66322432,
-43319295, 66197, 0, 4294902773, 42992277, 1, 66453504, 43450367,
-66196, 0, 4294902775, 43451027, 1, 66584576, 43581439, 66201,
-0, 4294902777, 43647641, 29, 66715648, 43647995, 66203, 0,
-4294902780, 43778715, 29, 66912256, 43779070, 66205, 0, 4294902783,
-43909789, 29, 67108864, 43975681, 1901216, 0, 67306498, 44106400,
-1, 67371008, 44171263, 1901218, 0, 67503109, 44237474, 1,
-67567616, 44302335, 1901220, 0, 67699720, 44303013, 1, 67764224,
-44302335, 66214, 0, 4294902795, 44171943, 1, 67895296, 44171263,
-66216, 0, 4294902797, 44630687, 1, 68026368, 44761087, 66206,
-0, 4294902799, 44761757, 1, 68157440, 44892159, 66204, 0,
-4294902801, 44892827, 1, 68288512, 45023231, 66202, 0, 4294902803,
-45023897, 1, 68419584, 44957695, 66222, 0, 4294902805, 45023918,
-29, 68550656, 44827671, 1901229, 0, 68748312, 44827307, 1,
-68812800, 44564479, 1901224, 0, 68944923, 44499622, 1, 69009408,
-44433407, 1901222, 0, 69141534, 44368560, 1, 69206016, 45219839,
-66224, 0, 4294902817, 45220520, 1, 69337088, 45285375, 66208,
-0, 4294902819, 44630706, 29, 69468160, 44631077, 66218, 0,
-4294902822, 44761770, 29, 69664768, 45024296, 66227, 0, 4294902825,
-45351603, 1, 69861376, 45416447, 66229, 0, 4294902827, 45482677,
-1, 69992448, 45547519, 66231, 0, 4294902829, 45613751, 1,
-70123520, 45678591, 66233, 0, 4294902831, 45744825, 1, 70254592,
-45809663, 66235, 0, 4294902833, 45875899, 1, 70385664, 45940735,
-66225, 0, 4294902835, 45941412, 1, 70516736, 46071807, 66239,
-0, 4294902837, 42402443, 4, 70647808, 42927159, 262792, 0,
-70845496, 42533518, 4, 70909952, 42796091, 262794, 0, 71107644,
-43057808, 4, 71172096, 43320383, 262802, 0, 71369792, 43188884,
-4, 71434240, 43385923, 787095, 0, 71631940, 43516605, 12,
-71696384, 46138439, 66241, 0, 4294902856, 46006977, 65540, 71892992,
-46072906, 66242, 0, 4294902859, 43385538, 1, 72089600, 43515903,
-66243, 0, 4294902861, 46138051, 1, 72220672, 46465023, 65845,
-0, 4294902863, 46465335, 1, 72351744, 46596095, 1114814, 0,
-4294902865, 46531261, 1, 72482816, 46268415, 1114823, 0, 4294902867,
-43516615, 1, 72613888, 46596095, 262855, 1, 72746069, 46662326,
-140, 72810496, 46728280, 9175740, 0, 73008217, 46727880, 140,
-73072640, 46793820, 787147, 852056, 73270365, 46990028, 5767180, 73334797,
-46990432, 787146, 852056, 73532513, 47055563, 1, 73596928, 47120383,
-1114831, 11, 4294902884, 46924495, 1, 73728000, 47251455, 66207,
-0, 4294902886, 47186636, 1, 73859072, 43974655, 66257, 0,
-4294902888, 46858961, 1, 73990144, 17498111, 66258, 0, 4294902890,
-17498834, 1, 74121216, 16777215, 66259, 0, 4294902892, 16777939,
-1, 74252288, 38535167, 66260, 0, 4294902894, 39191252, 1,
-74383360, 3735551, 4456529, 0, 74515568, 5832756, 68, 74579968,
-15860851, 2359523, 1, 74777716, 47513842, 17, 74842112, 47644671,
-1114339, 0, 4294902903, 47645397, 9, 74973184, 47710207, 590552,
-0, 4294902905, 47579864, 9, 75104256, 47644671, 262869, 1,
-75236475, 47775864, 1, 75300864, 47906815, 65834, 0, 4294902910,
-47973083, 65540, 75431936, 48039040, 2360030, 1, 75629697, 48038617,
-1, 75694080, 48168959, 66266, 0, 4294902916, 48104155, 17,
-75825152, 48103423, 1114844, 0, 4294902918, 48235231, 1, 75956224,
-48300031, 66273, 0, 4294902920, 48169698, 1, 76087296, 48037887,
-66274, 0, 4294902922, 47907553, 1, 76218368, 14942207, 66275,
-0, 4294902924, 14811875, 9, 76349440, 39452671, 1835748, 0,
-76481678, 12059364, 28, 76546048, 48563345, 1835750, 0, 76743826,
-12714726, 28, 76808192, 12256405, 1835751, 0, 77005974, 48759527,
-28, 77070336, 48759961, 1835753, 0, 77268122, 48890601, 28,
-77332480, 48891037, 1835755, 0, 77530270, 48956005, 28, 77594624,
-38667425, 2359883, 655422, 77792418, 49021529, 1, 77856768, 49086463,
-66135, 0, 4294902949, 49086934, 1, 77987840, 49151999, 65554,
-0, 4294902951, 49152009, 1, 78118912, 49217535, 66000, 0,
-4294902953, 48562302, 1, 78249984, 48627711, 65720, 0, 4294902955,
-49217730, 1, 78381056, 49283071, 65661, 0, 4294902957, 49283257,
-1, 78512128, 49348607, 66289, 0, 4294902959, 39322353, 1,
-78643200, 38928383, 66290, 0, 4294902961, 12190450, 1, 78774272,
-49545215, 787188, 0, 78906547, 49611508, 12, 78970880, 49611958,
-787190, 0, 79168695, 49480438, 12, 79233024, 46924986, 787147,
-852030, 79430843, 26018551, 1, 79495168, 49872895, 66295, 0,
-4294902974, 49808121, 1, 79626240, 50003967, 66297, 0, 4294902976,
-49939195, 1, 79757312, 26148863, 66300, 0, 4294902978, 50135804,
-1, 79888384, 50200575, 66302, 0, 4294902980, 50266878, 1,
-80019456, 50331647, 66304, 0, 4294902982, 50070263, 4, 80150528,
-49808584, 262909, 0, 80348361, 50201337, 4, 80412672, 49939660,
-262911, 0, 80610509, 50332411, 12, 80674816, 26936528, 65945,
-0, 4294902993, 50463489, 4, 80871424, 50529491, 66306, 0,
-4294902996, 50528527, 1, 81068032, 50462719, 66308, 0, 4294902998,
-28771076, 1, 81199104, 50724863, 66305, 0, 4294903000, 50660102,
-1, 81330176, 50855935, 66310, 0, 4294903002, 50791176, 1,
-81461248, 50987007, 66312, 0, 4294903004, 50987778, 1, 81592320,
-51052543, 66315, 0, 4294903006, 51118859, 1, 81723392, 51183615,
-66317, 0, 4294903008, 51249933, 1, 81854464, 50724863, 262922,
-0, 81986786, 51053318, 4, 82051072, 50791653, 262924, 0,
-82248934, 51184392, 4, 82313216, 50922729, 787214, 0, 82511082,
-51315456, 1, 82575360, 51380223, 65829, 0, 4294903021, 51380518,
-1, 82706432, 51445759, 66299, 0, 4294903023, 51446542, 1,
-82837504, 51511295, 65860, 0, 4294903025, 51511621, 1, 82968576,
-51576831, 66313, 0, 4294903027, 51577081, 1, 83099648, 51642367,
-65783, 0, 4294903029, 17171220, 9, 83230720, 17170431, 590612,
-0, 4294903031, 51708486, 1, 83361792, 51773439, 66326, 0,
-4294903033, 51839766, 1, 83492864, 51904511, 66328, 0, 4294903035,
-52036377, 1, 83623936, 52101119, 66331, 0, 4294903037, 52167451,
-1, 83755008, 52232191, 66119, 0, 4294903039, 52232984, 1,
-83886080, 52297727, 66180, 0, 4294903041, 52298373, 1, 84017152,
-52363263, 66329, 0, 4294903043, 52167445, 4, 84148224, 51774725,
-262939, 0, 84346118, 52036375, 4, 84410368, 51905801, 262937,
-0, 84608266, 52298525, 4, 84672512, 42206477, 262789, 0,
-84870414, 52363841, 1, 84934656, 52428799, 66118, 0, 4294903057,
-38798112, 1, 85065728, 52559871, 66336, 0, 4294903059, 52495083,
-1, 85196800, 39780351, 66283, 0, 4294903061, 52560093, 9,
-85327872, 52625407, 590325, 0, 4294903063, 9830912, 9, 85458944,
-32833535, 66339, 0, 4294903065, 33555235, 1, 85590016, 2162687,
-66340, 0, 4294903067, 33489700, 1, 85721088, 33488895, 66341,
-0, 4294903069, 2032421, 1, 85852160, 42795007, 66342, 0,
-4294903071, 46400294, 1, 85983232, 46530559, 66343, 0, 4294903073,
-42337063, 1, 86114304, 42467327, 66344, 0, 4294903075, 42468136,
-1, 86245376, 42991615, 66345, 0, 4294903077, 42664745, 1,
-86376448, 15466495, 590634, 0, 4294903079, 15270698, 9, 86507520,
-15269887, 590635, 0, 4294903081, 15336235, 9, 86638592, 65535};
-extern const uint32_t e1m1_WADSideDefs[9923] = {
-0, 45, 0, 45, 0, 1380013139, 843989332, 38,
-2949120, 0, 2949120, 0, 1414725632, 1096045121, 2503246, 0,
-45, 0, 45, 0, 1380013139, 843989332, 24, 2949120,
-0, 2949120, 0, 1414725632, 1096045121, 2503246, 0, 45,
-0, 45, 0, 1380013139, 843989332, 38, 2949120, 0,
-2949120, 0, 1414725632, 1096045121, 2503246, 0, 45, 0,
-45, 0, 1380013139, 843989332, 24, 2949120, 0, 2949120,
-0, 1414725632, 1096045121, 1585742, 16, 45, 0, 45,
-0, 1380013139, 843989332, 103, 1329790976, 1414877261, 2961989, 0,
-2949120, 0, 6553600, 0, 1414742337, 1498107465, 1414742337, 1498107465,
-45, 0, 38, 2949120, 0, 2949120, 0, 1414725632,
-1096045121, 1585742, 80, 45, 0, 45, 0, 1380013139,
-843989332, 94, 2949120, 0, 2949120, 0, 1414725632, 860312129,
-5439488, 0, 45, 0, 45, 0, 1380013139, 13127,
-83, 2949120, 0, 2949120, 0, 1414725632, 1096045121, 6173262,
-0, 45, 0, 45, 0, 1380013139, 13127, 83,
-2949120, 0, 2949120, 0, 1414725632, 860312129, 5505024, 0,
-45, 0, 45, 0, 1380013139, 13127, 84, 2949120,
-0, 2949120, 0, 1414725632, 860312129, 6422528, 0, 45,
-0, 45, 0, 1380013139, 843989332, 36, 2949120, 0,
-2949120, 0, 1414725632, 860312129, 9502720, 0, 45, 0,
-45, 0, 1380013139, 13127, 83, 2949120, 0, 2949120,
-0, 1414725632, 860312129, 5505024, 0, 45, 0, 45,
-0, 1380013139, 13127, 84, 2949120, 0, 2949120, 0,
-1414725632, 860312129, 5505024, 0, 45, 0, 45, 0,
-1380013139, 13127, 84, 2949120, 0, 2949120, 0, 1414725632,
-860312129, 5505024, 0, 45, 0, 45, 0, 1380013139,
-13127, 84, 2949120, 0, 2949120, 0, 1414725632, 860312129,
-5505024, 0, 45, 0, 45, 0, 1380013139, 13127,
-84, 2949120, 0, 2949120, 0, 1329790976, 1096044621, 5721164,
-0, 45, 0, 45, 0, 1347243843, 1280065876, 87,
-2949120, 0, 2949120, 0, 1329790976, 1096044621, 12012620, 192,
-45, 0, 45, 0, 1347243843, 1280065876, 87, 2949120,
-0, 2949120, 0, 1329790976, 1096044621, 9718860, 192, 45,
-0, 45, 0, 1347243843, 1280065876, 183, 2949120, 0,
-2949120, 0, 1329790976, 1096044621, 12012620, 0, 45, 0,
-45, 0, 1347243843, 1280065876, 87, 2949120, 0, 2949120,
-0, 1329790976, 1096044621, 5721164, 0, 45, 0, 45,
-0, 1347243843, 1280065876, 12582999, 2949120, 0, 2949120, 0,
-1329790976, 1096044621, 5721164, 0, 45, 0, 45, 0,
-1347243843, 1280065876, 87, 2949120, 0, 2949120, 0, 1329790976,
-1096044621, 5721164, 0, 45, 0, 45, 0, 1347243843,
-1280065876, 87, 2949120, 0, 2949120, 0, 1329790976, 1096044621,
-5721164, 0, 45, 0, 45, 0, 1347243843, 1280065876,
-87, 2949120, 0, 2949120, 0, 1329790976, 1096044621, 5721164,
-0, 45, 0, 45, 0, 1347243843, 1280065876, 87,
-2949120, 0, 2949120, 0, 1329790976, 1096044621, 5721164, 0,
-45, 0, 45, 0, 1347243843, 1280065876, 87, 2949120,
-0, 2949120, 0, 1329790976, 1096044621, 5721164, 0, 45,
-0, 45, 0, 1347243843, 1280065876, 87, 2949120, 0,
-2949120, 0, 1329790976, 1096044621, 5721164, 0, 45, 0,
-45, 0, 1347243843, 1280065876, 12582999, 2949120, 0, 2949120,
-0, 1329790976, 1096044621, 5721164, 0, 45, 0, 45,
-0, 1347243843, 1280065876, 87, 2949120, 0, 2949120, 0,
-1329790976, 1096044621, 5721164, 0, 45, 0, 45, 0,
-1347243843, 1280065876, 12582999, 2949120, 0, 2949120, 0, 1329790976,
-1096044621, 5721164, 0, 45, 0, 45, 0, 1347243843,
-1280065876, 148, 2949120, 0, 2949120, 0, 1329790976, 1096044621,
-12012620, 0, 45, 0, 45, 0, 1347243843, 1280065876,
-183, 2949120, 0, 2949120, 0, 1329790976, 1096044621, 12012620,
-192, 45, 0, 45, 0, 1347243843, 1280065876, 146,
-2949120, 0, 2949120, 0, 1329790976, 1096044621, 9587788, 0,
-45, 0, 45, 0, 1347243843, 1280065876, 146, 2949120,
-0, 2949120, 0, 1414725632, 860312129, 5767168, 0, 45,
-0, 45, 0, 1380013139, 13127, 524376, 2949120, 0,
-2949120, 0, 1431502848, 1380929616, 5976660, 0, 45, 0,
-45, 0, 1347243843, 1280065876, 87, 2949120, 0, 2949120,
-0, 1329790976, 1096044621, 5721164, 0, 45, 0, 45,
-0, 1347243843, 1280065876, 87, 2949120, 0, 2949120, 0,
-1329790976, 1096044621, 5721164, 0, 45, 0, 45, 0,
-1347243843, 1280065876, 87, 2949120, 0, 2949120, 0, 1414725632,
-860312129, 5439488, 192, 45, 0, 45, 0, 1347243843,
-1280065876, 87, 2949120, 0, 2949120, 0, 1329790976, 1096044621,
-5721164, 0, 45, 0, 45, 0, 1347243843, 1280065876,
-87, 2949120, 0, 2949120, 0, 1414725632, 860312129, 5767168,
-0, 45, 0, 45, 0, 1347243843, 1280065876, 12582999,
-2949120, 0, 2949120, 0, 1329790976, 1096044621, 5721164, 0,
-45, 0, 45, 0, 1347243843, 1280065876, 87, 2949120,
-0, 2949120, 0, 1329790976, 1096044621, 5721164, 0, 45,
-0, 45, 0, 1347243843, 1280065876, 87, 2949120, 0,
-2949120, 0, 1329790976, 1096044621, 5721164, 0, 45, 0,
-45, 0, 1347243843, 1280065876, 87, 2949120, 0, 2949120,
-0, 1329790976, 1096044621, 5721164, 0, 45, 0, 45,
-0, 1347243843, 1280065876, 87, 2949120, 0, 2949120, 0,
-1329790976, 1096044621, 5721164, 192, 45, 0, 45, 0,
-1347243843, 1280065876, 87, 2949120, 0, 2949120, 0, 1329790976,
-1096044621, 5721164, 192, 45, 0, 45, 0, 1347243843,
-1280065876, 87, 2949120, 0, 2949120, 0, 1329790976, 1096044621,
-5721164, 0, 45, 0, 45, 0, 1347243843, 1280065876,
-12582999, 2949120, 0, 2949120, 0, 1329790976, 1096044621, 5721164,
-0, 45, 0, 45, 0, 1347243843, 1280065876, 87,
-2949120, 0, 2949120, 0, 1329790976, 1096044621, 5721164, 0,
-1380013139, 13127, 1346720851, 54, 45, 0, 83, 1414725632,
-4542031, 2949120, 0, 2949120, 0, 6094848, 0, 45,
-0, 45, 0, 1145130067, 1280065879, 144, 1329790976, 1414877261,
-2961989, 0, 2949120, 0, 6553600, 0, 1414742337, 1498107465,
-1414742337, 1498107465, 45, 0, 38, 2949120, 0, 2949120,
-0, 1414725632, 1096045121, 6566478, 96, 45, 0, 45,
-0, 1380013139, 843989332, 7864421, 2949120, 0, 2949120, 0,
-1414725632, 1096045121, 6697550, 104, 45, 0, 45, 0,
-1380013139, 843989332, 102, 2949120, 0, 2949120, 0, 1414725632,
-1096045121, 6632014, 24, 45, 0, 45, 0, 1380013139,
-843989332, 100, 1329790976, 1414877261, 2961989, 0, 2949120, 0,
-6553600, 0, 1414742337, 1498107465, 1414742337, 1498107465, 45, 0,
-38, 2949128, 0, 2949120, 0, 1280507904, 1096238145, 12340300,
-0, 45, 0, 45, 0, 1145130067, 1280065879, 186,
-2949128, 0, 2949120, 0, 1280507904, 1096238145, 12340300, 0,
-45, 0, 45, 0, 1380013139, 843989332, 38, 2949120,
-0, 2949120, 0, 1280507904, 1096238145, 12405836, 0, 45,
-0, 1464816194, 3553614, 45, 0, 102, 2949120, 0,
-2949120, 0, 2949120, 0, 6750208, 0, 45, 0,
-1464816194, 3553614, 45, 0, 102, 2949120, 0, 2949120,
-0, 2949120, 0, 6750208, 0, 45, 0, 1464816194,
-3553614, 45, 0, 102, 2949120, 0, 2949120, 0,
-2949120, 0, 6750208, 0, 45, 0, 1464816194, 3553614,
-45, 0, 101, 2949120, 0, 2949120, 0, 2949120,
-0, 6684672, 0, 45, 0, 1464816194, 3553614, 45,
-0, 101, 2949120, 0, 2949120, 0, 2949120, 0,
-6684672, 0, 45, 0, 1464816194, 3553614, 45, 0,
-101, 2949120, 0, 2949120, 0, 2949120, 0, 6684672,
-0, 45, 0, 1464816194, 3553614, 45, 0, 100,
-2949120, 0, 2949120, 0, 2949120, 0, 6619136, 0,
-45, 0, 1464816194, 3553614, 45, 0, 100, 2949120,
-0, 2949120, 0, 2949120, 0, 6619136, 0, 45,
-0, 1464816194, 3553614, 45, 0, 100, 2949120, 0,
-2949120, 0, 2949120, 0, 6619136, 0, 1347243843, 1162627412,
-45, 0, 45, 0, 148, 2949120, 0, 2949120,
-0, 2949120, 0, 11993088, 0, 45, 0, 45,
-0, 1145130067, 1280065879, 181, 2949120, 0, 2949120, 0,
-1229717504, 3360084, 1835008, 0, 45, 0, 45, 0,
-1380013139, 860766548, 35, 2949120, 0, 2949120, 0, 1229717504,
-1279411540, 2437973, 0, 45, 0, 45, 0, 1380013139,
-843989332, 36, 2949120, 0, 2949120, 0, 1414725632, 1096045121,
-2372174, 0, 45, 0, 45, 0, 1163151692, 861228098,
-37, 2949120, 0, 2949120, 0, 1414725632, 1096045121, 2372174,
-0, 45, 0, 45, 0, 1380013139, 860766548, 35,
-1414725632, 4542031, 1094778880, 1313428563, 2971979, 0, 2293760, 0,
-45, 0, 45, 0, 45, 0, 37, 1868759040,
-1953853549, 1094791525, 1313428563, 2971979, 0, 2359296, 0, 45,
-0, 45, 0, 45, 0, 37, 2949120, 0,
-2949120, 0, 1229717504, 3360084, 1835008, 0, 1380013139, 843989332,
-1347243843, 1162627412, 45, 0, 27, 2949120, 0, 2949120,
-0, 2949120, 0, 1835008, 0, 45, 0, 45,
-0, 1380013139, 843989332, 38, 2949120, 0, 2949120, 0,
-1414725632, 1096045121, 1585742, 0, 45, 0, 45, 0,
-1380013139, 843989332, 103, 2949120, 0, 2949120, 0, 1414725632,
-1096045121, 1585742, 0, 45, 0, 45, 0, 1380013139,
-843989332, 24, 1414725632, 1096045121, 2961998, 0, 2949120, 0,
-1572864, 0, 1414742337, 1498107465, 1414742337, 1498107465, 45, 0,
-27, 1414725632, 1096045121, 2961998, 0, 2949120, 0, 1572864,
-0, 1414742337, 1498107465, 1414742337, 1498107465, 45, 0, 38,
-1414725632, 1096045121, 1414738510, 3362885, 2949120, 0, 1572864, 0,
-45, 0, 45, 0, 45, 0, 30, 2949120,
-0, 1414725632, 3362885, 2949120, 0, 1966080, 0, 45,
-0, 45, 0, 45, 0, 31, 1414725632, 1096045121,
-1414738510, 3362885, 2949120, 0, 2031616, 0, 45, 0,
-45, 0, 45, 0, 32, 2949120, 0, 2949120,
-0, 1431502848, 1380929616, 2044500, 0, 45, 0, 45,
-0, 1347442003, 844386895, 30, 2949120, 0, 2949120, 0,
-1431502848, 1380929616, 1978964, 0, 45, 0, 45, 0,
-1347442003, 844386895, 31, 1414725632, 1096045121, 2961998, 0, 2949120,
-0, 1572864, 0, 1414742337, 1498107465, 1414742337, 1498107465, 45,
-0, 38, 1414725632, 1096045121, 2961998, 0, 2949120, 0,
-6750208, 0, 45, 0, 45, 0, 45, 0,
-33, 1414725632, 1096045121, 1414738510, 1096045121, 2961998, 0, 2097152,
-0, 45, 0, 45, 0, 45, 0, 33,
-2949120, 0, 2949120, 0, 1229717504, 3491156, 2097152, 0,
-45, 0, 45, 0, 1163151692, 53, 32, 2949120,
-0, 2949120, 0, 1414725632, 1096045121, 1585742, 0, 45,
-0, 45, 0, 1163151692, 52, 114, 1380384768, 1096046913,
-1094798412, 1313428563, 2971979, 0, 2490368, 0, 1414742337, 1498107465,
-1414742337, 1498107465, 45, 0, 114, 1414725632, 1096045121, 2961998,
-0, 2949120, 0, 1572864, 0, 1414742337, 1498107465, 1414742337,
-1498107465, 45, 0, 114, 2949120, 0, 2949120, 0,
-1229717504, 3425620, 7471104, 0, 45, 0, 45, 0,
-1347243843, 826365011, 33, 2949120, 0, 2949120, 0, 1329790976,
-1414746189, 2175553, 0, 45, 0, 45, 0, 1163151692,
-51, 93, 2949120, 0, 2949120, 0, 1229717504, 3360084,
-6094848, 0, 1497453127, 1280065876, 1497453127, 1280065876, 45, 0,
-83, 1380384768, 1096046913, 1380404300, 1096046913, 2968652, 0, 5505024,
-0, 45, 0, 45, 0, 1380013139, 13127, 83,
-2949120, 0, 2949120, 0, 1431502848, 1380929616, 5452372, 0,
-1497453127, 1280065876, 1497453127, 1280065876, 45, 0, 145, 1380384768,
-1096046913, 1380404300, 1096046913, 2968652, 0, 5439488, 0, 1497453127,
-1280065876, 1497453127, 1280065876, 45, 0, 86, 1380384768, 1096046913,
-1380404300, 1096046913, 2968652, 0, 5439488, 0, 1497453127, 1280065876,
-1497453127, 1280065876, 45, 0, 83, 1380384768, 1096046913, 1380404300,
-1096046913, 2968652, 0, 5767168, 0, 45, 0, 45,
-0, 1380013139, 13127, 84, 2949120, 0, 2949120, 0,
-1414725632, 860312129, 9502720, 0, 45, 0, 45, 0,
-1145130067, 1280065879, 163, 2949120, 0, 2949120, 0, 1280507904,
-1096238145, 9260108, 0, 1162889552, 50, 1162889552, 50, 45,
-0, 120, 2949120, 0, 2949120, 0, 2949120, 0,
-7995392, 0, 45, 0, 45, 0, 1162889552, 50,
-120, 2949120, 0, 2949120, 0, 1229979648, 3294544, 7864320,
-0, 1162889552, 50, 1162889552, 50, 45, 0, 120,
-2949120, 0, 2949120, 0, 2949120, 0, 8519680, 7864320,
-1145130067, 1280065879, 1162564942, 1145130067, 45, 0, 142, 1380384768,
-1096046913, 2968652, 0, 2949120, 0, 9043968, 0, 45,
-0, 1347442003, 844386895, 45, 0, 121, 1229979648, 3294544,
-2949120, 0, 2949120, 0, 8978432, 0, 45, 0,
-45, 0, 1347442003, 844386895, 168, 2949120, 0, 2949120,
-0, 1329790976, 1414877261, 8008261, 0, 45, 0, 45,
-0, 1347243843, 843404373, 130, 2949120, 0, 2949120, 0,
-1329790976, 1414877261, 8204869, 0, 45, 0, 45, 0,
-1163151692, 52, 122, 2949120, 0, 2949120, 0, 1229717504,
-3425620, 8192000, 0, 45, 0, 45, 0, 1163151692,
-52, 125, 2949120, 0, 2949120, 0, 1229717504, 3425620,
-8519680, 0, 45, 0, 45, 0, 1163151692, 52,
-130, 1414725632, 1096045121, 2961998, 0, 2949120, 0, 9830400,
-0, 2002872435, 12910, 1346720851, 54, 45, 0, 36,
-2949120, 0, 2949120, 0, 1280507904, 1096238145, 12536908, 0,
-45, 0, 45, 0, 1145130067, 1280065879, 195, 2949120,
-0, 2949120, 0, 1280507904, 1096238145, 10964044, 0, 45,
-0, 45, 0, 1145130067, 1280065879, 167, 2949120, 0,
-2949120, 0, 1431502848, 1380929616, 11022932, 0, 45, 0,
-45, 0, 1145130067, 1280065879, 168, 2949120, 0, 2949120,
-0, 1280507904, 1096238145, 11029580, 0, 45, 0, 1346720851,
-54, 45, 0, 94, 1414725632, 4542031, 2949120, 0,
-2949120, 0, 6225920, 32, 45, 0, 45, 0,
-1380013139, 843989332, 3145823, 2949120, 0, 2949120, 0, 1414725632,
-1096045121, 6238798, 0, 45, 0, 1346720851, 54, 45,
-0, 93, 1414725640, 1096045121, 2961998, 0, 2949120, 0,
-6160384, 0, 1497453127, 1280065876, 1346720851, 54, 45, 0,
-95, 1414725632, 4542031, 1414725632, 4542031, 2949120, 0, 6291456,
-0, 1145130067, 1280065879, 1346720851, 54, 45, 0, 181,
-2949120, 0, 1213399040, 843994945, 2949120, 0, 12058624, 0,
-1145130067, 1280065879, 1346720851, 54, 45, 0, 184, 2949120,
-0, 2949120, 0, 2949120, 0, 12124160, 0, 1145130067,
-1280065879, 1346720851, 54, 45, 0, 185, 2949120, 0,
-2949120, 0, 2949120, 0, 12189696, 0, 1145130067, 1280065879,
-1346720851, 54, 45, 0, 186, 2949120, 0, 2949120,
-0, 2949120, 0, 12451840, 0, 1145130067, 1280065879, 1346720851,
-54, 45, 0, 190, 2949120, 0, 2949120, 0,
-2949120, 0, 12517376, 0, 1145130067, 1280065879, 1346720851, 54,
-45, 0, 191, 2949120, 0, 2949120, 0, 2949120,
-0, 12582912, 0, 1145130067, 1280065879, 1346720851, 54, 45,
-0, 192, 2949120, 0, 2949120, 0, 2949120, 0,
-12779520, 0, 1145130067, 1280065879, 1346720851, 54, 45, 0,
-195, 2949120, 0, 2949120, 0, 2949120, 0, 12845056,
-0, 1145130067, 1280065879, 1346720851, 54, 45, 0, 196,
-2949120, 0, 2949120, 0, 2949120, 0, 12910592, 0,
-1145130067, 1280065879, 1346720851, 54, 45, 0, 197, 2949120,
-0, 2949120, 0, 2949120, 0, 12976128, 0, 1145130067,
-1280065879, 1346720851, 54, 45, 0, 198, 1280507904, 1096238145,
-2968652, 0, 2949120, 0, 13041664, 0, 1145130067, 1280065879,
-1346720851, 54, 45, 0, 199, 1280507904, 1096238145, 2968652,
-0, 2949120, 0, 10747904, 0, 1145130067, 1280065879, 1346720851,
-54, 45, 0, 164, 2949120, 0, 2949120, 0,
-2949120, 0, 10813440, 0, 1145130067, 1280065879, 1346720851, 54,
-45, 0, 165, 2949120, 0, 2949120, 0, 2949120,
-0, 10878976, 0, 1145130067, 1280065879, 1346720851, 54, 45,
-0, 166, 2949120, 0, 2949120, 0, 2949120, 0,
-10944512, 0, 45, 0, 45, 0, 1145130067, 1280065879,
-186, 2949120, 0, 2949120, 0, 1280507904, 1096238145, 12143692,
-0, 45, 0, 45, 0, 1145130067, 1280065879, 184,
-2949120, 0, 2949120, 0, 1280507904, 1096238145, 12078156, 0,
-45, 0, 45, 0, 1145130067, 1280065879, 185, 2949120,
-0, 2949120, 0, 1280507904, 1096238145, 12471372, 0, 45,
-0, 45, 0, 1145130067, 1280065879, 190, 2949120, 0,
-2949120, 0, 1280507904, 1096238145, 12602444, 0, 45, 0,
-45, 0, 1145130067, 1280065879, 197, 2949120, 0, 2949120,
-0, 1280507904, 1096238145, 12864588, 0, 45, 0, 45,
-0, 1145130067, 1280065879, 195, 2949120, 0, 2949120, 0,
-1280507904, 1096238145, 12864588, 0, 45, 0, 45, 0,
-1145130067, 1280065879, 197, 2949120, 0, 2949120, 0, 1280507904,
-1096238145, 13061196, 0, 45, 0, 45, 0, 1145130067,
-1280065879, 199, 2949120, 0, 2949120, 0, 1280507904, 1096238145,
-10898508, 0, 45, 0, 45, 0, 1145130067, 1280065879,
-165, 2949120, 0, 2949120, 0, 1280507904, 1096238145, 10767436,
-0, 45, 0, 45, 0, 1145130067, 1280065879, 164,
-2949120, 0, 2949120, 0, 1280507904, 1096238145, 10832972, 0,
-45, 0, 45, 0, 1145130067, 1280065879, 166, 2949120,
-0, 2949120, 0, 1280507904, 1096238145, 10964044, 160, 1380013139,
-843989332, 1380013139, 843989332, 45, 0, 71, 2949120, 0,
-2949120, 0, 2949120, 0, 4849664, 128, 1380013139, 843989332,
-1380013139, 843989332, 45, 0, 72, 2949120, 0, 2949120,
-0, 2949120, 0, 4849664, 96, 1380013139, 843989332, 1380013139,
-843989332, 45, 0, 73, 2949120, 0, 2949120, 0,
-2949120, 0, 4849664, 32, 45, 0, 45, 0,
-1380013139, 843989332, 65, 2949120, 0, 2949120, 0, 1414725632,
-1096045121, 4338254, 0, 45, 0, 45, 0, 1380013139,
-843989332, 2621511, 2949120, 0, 2949120, 0, 1414725632, 1096045121,
-4731470, 80, 45, 0, 45, 0, 1380013139, 843989332,
-7864393, 2949120, 0, 2949120, 0, 1414725632, 1096045121, 4207182,
-16, 45, 0, 45, 0, 1380013139, 843989332, 262210,
-1414725632, 1096045121, 1414738510, 3493957, 2949120, 0, 4587520, 0,
-45, 0, 45, 0, 45, 0, 262215, 1414725632,
-1096045121, 1414738510, 3493957, 2949120, 0, 4653056, 0, 45,
-0, 45, 0, 45, 0, 262216, 1414725632, 1096045121,
-1414738510, 3493957, 2949120, 0, 4718592, 0, 45, 0,
-45, 0, 45, 0, 262217, 1414725632, 1096045121, 1414738510,
-3493957, 2949120, 0, 4784128, 0, 45, 0, 45,
-0, 45, 0, 262208, 1414725632, 1096045121, 1414738510, 3493957,
-2949120, 0, 4194304, 0, 1380013139, 843989332, 45, 0,
-45, 0, 262209, 1414725632, 1096045121, 1414738510, 3493957, 2949120,
-0, 4259840, 0, 45, 0, 45, 0, 45,
-0, 262210, 1414725632, 1096045121, 1414738510, 3493957, 2949120, 0,
-4325376, 0, 1347243843, 843404373, 45, 0, 45, 0,
-8388670, 1414725632, 1096045121, 1414738510, 1096045121, 2961998, 0, 720896,
-0, 45, 0, 45, 0, 45, 0, 10485783,
-1414725632, 1096045121, 1414738510, 1096045121, 2961998, 0, 786432, 0,
-45, 0, 45, 0, 45, 0, 12582935, 1414725632,
-1096045121, 1414738510, 1096045121, 2961998, 0, 851968, 0, 45,
-0, 45, 0, 45, 0, 16777239, 2949120, 0,
-2949120, 0, 1414725632, 1096045121, 995918, 288, 45, 0,
-45, 0, 1380013139, 843989332, 16, 2949120, 0, 2949120,
-0, 1414725632, 1096045121, 1061454, 72, 45, 0, 45,
-0, 1380013139, 843989332, 7340046, 2949120, 0, 2949120, 0,
-1414725632, 1096045121, 864846, 152, 45, 0, 45, 0,
-1380013139, 843989332, 12582924, 2949120, 0, 2949120, 0, 1414725632,
-1096045121, 733774, 0, 45, 0, 1346720851, 53, 45,
-0, 16, 1329790976, 1414877261, 2961989, 0, 2949120, 0,
-4063232, 0, 45, 0, 1346720851, 53, 45, 0,
-15, 2949120, 0, 2949120, 0, 2949120, 0, 1048576,
-0, 45, 0, 1346720851, 53, 45, 0, 14,
-1414725632, 1096045121, 2961998, 0, 2949120, 0, 983040, 0,
-45, 0, 1346720851, 53, 45, 0, 13, 2949120,
-0, 2949120, 0, 2949120, 0, 917504, 0, 45,
-0, 1346720851, 53, 45, 0, 12, 2949120, 0,
-2949120, 0, 2949120, 0, 851968, 0, 45, 0,
-1346720851, 53, 45, 0, 11, 2949120, 0, 2949120,
-0, 2949120, 0, 786432, 0, 45, 0, 1346720851,
-53, 45, 0, 19, 2949120, 0, 2949120, 0,
-2949120, 0, 720896, 0, 45, 0, 45, 0,
-1347243843, 826365011, 0, 2949120, 0, 2949120, 0, 1329790976,
-1414746189, 4141633, 0, 45, 0, 45, 0, 1163151692,
-51, 0, 2949120, 0, 2949120, 0, 1229717504, 3360084,
-4128768, 0, 45, 0, 45, 0, 1163151692, 51,
-63, 2949120, 0, 2949120, 0, 1229717504, 3360084, 0,
-0, 1464550740, 877415489, 1464550740, 877415489, 45, 0, 62,
-2949120, 0, 2949120, 0, 2949120, 0, 0, 0,
-1464550740, 877415489, 1464550740, 877415489, 45, 0, 62, 2949120,
-0, 2949120, 0, 2949120, 0, 4128768, 0, 1464550740,
-877415489, 1464550740, 877415489, 45, 0, 62, 2949120, 0,
-2949120, 0, 2949120, 0, 65536, 0, 45, 0,
-45, 0, 1347243843, 826365011, 1, 2949120, 0, 2949120,
-0, 1229717504, 3360084, 65536, 0, 1414742337, 1498107465, 1414742337,
-1498107465, 1497453127, 1280065876, 1, 1094778880, 1313428563, 1094801739, 1313428563,
-1380407627, 1096046913, 85068, 0, 45, 0, 45, 0,
-1163151692, 51, 262145, 1414725632, 1096045121, 1414738510, 3493957, 2949120,
-0, 4521984, 0, 1380013139, 843989332, 45, 0, 45,
-0, 70, 2949120, 0, 2949120, 0, 1329790976, 1414746189,
-78401, 0, 45, 0, 1380013139, 860766548, 45, 0,
-109, 1414725632, 1096045121, 2962254, 0, 2949120, 0, 2228224,
-0, 45, 0, 1346720851, 51, 45, 0, 33,
-1414725632, 1096045121, 2962254, 0, 2949120, 0, 7012352, 0,
-45, 0, 45, 0, 1380013139, 860766548, 33, 1229062144,
-1330594887, 2962002, 0, 2949120, 0, 4980736, 0, 45,
-0, 45, 0, 45, 0, 78, 2949120, 0,
-2949120, 0, 1329856512, 1381257807, 5131073, 0, 45, 0,
-45, 0, 1380929348, 1262572116, 78, 2949120, 0, 2949120,
-0, 1414725632, 1096045121, 2503246, 0, 45, 0, 45,
-0, 1347243843, 1280065876, 87, 2949120, 0, 2949120, 0,
-1329790976, 1096044621, 5721164, 0, 45, 0, 45, 0,
-1347243843, 1280065876, 87, 2949120, 0, 2949120, 0, 1229979648,
-3294544, 7864320, 0, 1162889552, 50, 45, 0, 45,
-0, 120, 2949120, 0, 2949120, 0, 2949120, 0,
-8126464, 0, 45, 0, 45, 0, 1464816194, 1314015054,
-123, 2949120, 0, 2949120, 0, 1380057088, 1196316495, 8080978,
-0, 45, 0, 45, 0, 1464816194, 1314015054, 123,
-2949120, 0, 2949120, 0, 1380057088, 1196316495, 8080978, 0,
-45, 0, 45, 0, 1162889552, 50, 120, 1229979648,
-3294544, 2949120, 0, 2949120, 0, 7864320, 0, 45,
-0, 45, 0, 45, 0, 129, 2949120, 0,
-2949120, 0, 1380057088, 1196316495, 8080978, 0, 45, 0,
-45, 0, 1464816194, 1314015054, 123, 2949120, 0, 2949120,
-0, 1380057088, 1196316495, 8080978, 524288, 1145130067, 1280065879, 1145130067,
-1280065879, 45, 0, 89, 1280507904, 1096238145, 2968652, 0,
-2949120, 0, 5898240, 0, 45, 0, 45, 0,
-1145130067, 1280065879, 89, 2949120, 0, 2949120, 0, 1280507904,
-1096238145, 5852236, 0, 45, 0, 45, 0, 1380013139,
-843989332, 38, 2949120, 0, 1280311296, 3232833, 2949120, 0,
-5570560, 0, 1497453127, 55, 45, 0, 45, 0,
-89, 2949120, 0, 2949120, 0, 1414725632, 1096045121, 2503246,
-524288, 45, 0, 45, 0, 45, 0, 38,
-1280507904, 1096238145, 2968652, 0, 2949120, 0, 5570560, 0,
-45, 0, 45, 0, 1145130067, 1280065879, 90, 2949120,
-0, 2949120, 0, 1280507904, 1096238145, 5917772, 0, 45,
-0, 45, 0, 1145130067, 1280065879, 90, 2949120, 0,
-2949120, 0, 1414725632, 1096045121, 2503246, 0, 45, 0,
-45, 0, 1163151692, 52, 104, 2949120, 0, 2949120,
-0, 1329856512, 3363407, 6815744, 0, 45, 0, 45,
-0, 1163151692, 52, 104, 2949120, 0, 2949120, 0,
-1414725632, 1096045121, 2503246, 0, 45, 0, 1346720851, 49,
-45, 0, 38, 1414725632, 3559493, 2949120, 0, 2949120,
-0, 6815744, 0, 1145522498, 844255055, 45, 0, 45,
-0, 38, 2949120, 0, 2949120, 0, 2949120, 0,
-5111808, 0, 1145522498, 844255055, 45, 0, 45, 0,
-4, 2949120, 0, 2949120, 0, 2949120, 0, 1703936,
-0, 45, 0, 45, 0, 1380929348, 1262572116, 26,
-2949120, 0, 2949120, 0, 1329856512, 1381257807, 1723201, 0,
-1145522498, 844255055, 45, 0, 45, 0, 25, 2949120,
-0, 2949120, 0, 2949120, 0, 1703936, 0, 45,
-0, 45, 0, 1347442003, 844386895, 62, 2949120, 0,
-2949120, 0, 1380057088, 827217743, 209972, 0, 45, 0,
-45, 0, 1464816194, 875835726, 3, 1329790976, 1414877261, 2961989,
-0, 2949120, 0, 6553600, 0, 1414742337, 1498107465, 1414742337,
-1498107465, 45, 0, 38, 1329790976, 1414877261, 2961989, 0,
-2949120, 0, 6553600, 0, 1414742337, 1498107465, 1414742337, 1498107465,
-45, 0, 38, 1329790976, 1414877261, 2961989, 0, 2949120,
-0, 6553600, 0, 1414742337, 1498107465, 1414742337, 1498107465, 45,
-0, 38, 1329790976, 1414877261, 2961989, 0, 2949120, 0,
-6553600, 0, 1414742337, 1498107465, 1414742337, 1498107465, 45, 0,
-38, 2949120, 0, 2949120, 0, 1431502848, 1380929616, 5583444,
-0, 45, 0, 45, 0, 1145130067, 1280065879, 85,
-2949120, 0, 2949120, 0, 1431502848, 1380929616, 5583444, 0,
-45, 0, 45, 0, 1145130067, 1280065879, 85, 1414725632,
-1096045121, 2961998, 0, 2949120, 0, 1572864, 0, 45,
-0, 45, 0, 45, 0, 25, 2949120, 0,
-2949120, 0, 1414725632, 1096045121, 2503246, 0, 45, 0,
-45, 0, 1380013139, 843989332, 38, 2949120, 0, 2949120,
-0, 1431502848, 1380929616, 2503252, 0, 45, 0, 45,
-0, 1347442003, 844386895, 38, 2949136, 0, 2949120, 0,
-1414725632, 1096045121, 1651278, 1048576, 45, 0, 45, 0,
-1380013139, 843989332, 25, 2949152, 0, 2949120, 0, 1431502848,
-1380929616, 1651284, 2097152, 45, 0, 45, 0, 1347442003,
-844386895, 25, 2949120, 0, 2949120, 0, 1431502848, 1380929616,
-2175572, 0, 45, 0, 45, 0, 1347442003, 844386895,
-33, 2949120, 0, 2949120, 0, 1414725632, 1096045121, 2175822,
-0, 45, 0, 45, 0, 1347442003, 844386895, 33,
-2949120, 0, 2949120, 0, 1414725632, 1096045121, 2175822, 0,
-45, 0, 45, 0, 1380013139, 860766548, 33, 2949120,
-0, 2949120, 0, 1431502848, 1380929616, 2175572, 0, 45,
-0, 45, 0, 1380013139, 843989332, 24, 2949120, 0,
-2949120, 0, 1414725632, 1096045121, 7025486, 0, 45, 0,
-1346720851, 51, 45, 0, 107, 1414725632, 1096045121, 2962254,
-0, 2949120, 0, 7077888, 0, 45, 0, 1413565520,
-49, 45, 0, 108, 2949120, 0, 2949120, 0,
-2949120, 0, 7143424, 0, 45, 0, 45, 0,
-1380013139, 860766548, 34, 2949120, 0, 2949120, 0, 1414725632,
-1096045121, 2241358, 0, 45, 0, 45, 0, 1380013139,
-860766548, 34, 2949120, 0, 2949120, 0, 1431502848, 1380929616,
-7090772, 0, 45, 0, 45, 0, 1347442003, 844386895,
-2621548, 2949120, 0, 2949120, 0, 1414725632, 1096045121, 7091022,
-0, 45, 0, 45, 0, 1380013139, 860766548, 108,
-2949120, 0, 2949120, 0, 1414725632, 1096045121, 7025486, 0,
-45, 0, 45, 0, 1347442003, 844386895, 107, 2949120,
-0, 2949120, 0, 1414725632, 1096045121, 2175822, 0, 45,
-0, 45, 0, 1347442003, 844386895, 33, 2949120, 0,
-2949120, 0, 1414725632, 1096045121, 2241358, 8, 45, 0,
-45, 0, 1380013139, 860766548, 109, 2949120, 0, 2949120,
-0, 1431502848, 1380929616, 7156308, 0, 45, 0, 45,
-0, 1380013139, 860766548, 109, 2949120, 0, 2949120, 0,
-1431502848, 1380929616, 7156308, 0, 45, 0, 45, 0,
-1380013139, 843989332, 38, 1414725632, 1096045121, 2962254, 0, 2949120,
-0, 2490368, 0, 45, 0, 45, 0, 45,
-0, 116, 2949120, 0, 2949120, 0, 1329856512, 1381257807,
-7621441, 0, 45, 0, 45, 0, 1380929348, 1262572116,
-131188, 2949120, 0, 2949120, 0, 1163132928, 1279350603, 1913164,
-2, 45, 0, 45, 0, 1464550740, 827083841, 131101,
-2949120, 0, 2949120, 0, 1163132928, 1279350603, 1913164, 2,
-45, 0, 45, 0, 1464550740, 827083841, 131101, 2949120,
-0, 2949120, 0, 1163132928, 1279350603, 1913164, 0, 1380929348,
-49, 45, 0, 45, 0, 115, 2949120, 0,
-2949120, 0, 2949120, 0, 7602176, 0, 1464550740, 843861057,
-1313821779, 13125, 45, 0, 29, 2949120, 0, 2949120,
-0, 2949120, 0, 7208960, 2, 45, 0, 45,
-0, 1464550740, 827083841, 112, 2949120, 0, 2949120, 0,
-1465057280, 1297040177, 7274576, 2, 45, 0, 45, 0,
-1464550740, 827083841, 113, 2949120, 0, 1414725632, 860180047, 2949120,
-0, 7340032, 0, 45, 0, 45, 0, 45,
-0, 111, 2949120, 0, 1414725632, 860180047, 2949120, 0,
-7208960, 0, 45, 0, 45, 0, 45, 0,
-111, 2949120, 0, 1414725632, 860180047, 2949120, 0, 7208960,
-0, 45, 0, 45, 0, 45, 0, 111,
-2949120, 0, 1414725632, 860180047, 2949120, 0, 7208960, 0,
-45, 0, 45, 0, 45, 0, 111, 2949120,
-0, 1414725632, 860180047, 2949120, 0, 7405568, 0, 45,
-0, 45, 0, 45, 0, 131183, 2949120, 0,
-2949120, 0, 1163132928, 1279350603, 1913164, 2, 45, 0,
-45, 0, 1464550740, 827083841, 29, 2949120, 0, 2949120,
-0, 1163132928, 1279350603, 7549260, 0, 45, 0, 45,
-0, 1464550740, 827083841, 115, 1163132928, 1279350603, 2961740, 0,
-2949120, 0, 1900544, 0, 45, 0, 45, 0,
-45, 0, 115, 1163132928, 1279350603, 1414738508, 860180047, 2949120,
-0, 1900544, 0, 45, 0, 45, 0, 45,
-0, 112, 1163132928, 1279350603, 1414738508, 860180047, 2949120, 0,
-1900544, 0, 45, 0, 45, 0, 45, 0,
-110, 1163132928, 1279350603, 1414738508, 860180047, 2949120, 0, 1900544,
-0, 45, 0, 45, 0, 45, 0, 110,
-1163132928, 1279350603, 1414738508, 860180047, 2949120, 0, 1900544, 0,
-45, 0, 45, 0, 45, 0, 113, 2949120,
-0, 1414725632, 860180047, 2949120, 0, 7208960, 0, 45,
-0, 45, 0, 45, 0, 113, 2949120, 0,
-1414725632, 860180047, 2949120, 0, 7208960, 0, 45, 0,
-45, 0, 45, 0, 112, 2949120, 0, 2949120,
-0, 1414725632, 1096045121, 1782350, 0, 45, 0, 45,
-0, 1380013139, 843989332, 27, 2949120, 0, 2949120, 0,
-1431502848, 1380929616, 1782356, 0, 45, 0, 45, 0,
-1347442003, 844386895, 27, 2949120, 0, 2949120, 0, 1414725632,
-843402831, 1572864, 0, 45, 0, 45, 0, 1313821779,
-12869, 24, 2949120, 0, 2949120, 0, 1414725632, 843402831,
-1572864, 0, 45, 0, 45, 0, 1313821779, 12869,
-24, 2949120, 0, 2949120, 0, 1414725632, 843402831, 1572864,
-0, 45, 0, 45, 0, 1313821779, 12869, 24,
-2949120, 0, 2949120, 0, 1414725632, 843402831, 1572864, 0,
-45, 0, 45, 0, 1313821779, 12869, 24, 2949120,
-0, 2949120, 0, 1414725632, 843402831, 1572864, 0, 45,
-0, 45, 0, 1313821779, 12869, 24, 2949120, 0,
-2949120, 0, 1414725632, 843402831, 1572864, 0, 45, 0,
-45, 0, 1313821779, 12869, 24, 2949120, 0, 2949120,
-0, 1414725632, 843402831, 1572864, 0, 45, 0, 45,
-0, 1313821779, 12869, 24, 2949120, 0, 2949120, 0,
-1414725632, 843402831, 1572864, 0, 45, 0, 45, 0,
-1313821779, 12869, 262168, 1414725632, 1096045121, 1414738510, 3493957, 2949120,
-0, 5373952, 0, 1497453127, 1280065876, 45, 0, 45,
-0, 69, 2949120, 0, 2949120, 0, 1414725632, 1096045121,
-4534862, 0, 45, 0, 45, 0, 1347442003, 844386895,
-3145797, 2949120, 0, 2949120, 0, 1414725632, 1096045121, 4534862,
-0, 45, 0, 45, 0, 1347442003, 844386895, 69,
-2949120, 0, 2949120, 0, 1380057088, 827217743, 131072, 0,
-45, 0, 45, 0, 1464816194, 12622, 12582914, 1414725632,
-1096045121, 1414738510, 1096045121, 2961998, 0, 4587520, 0, 45,
-0, 45, 0, 45, 0, 74, 2949120, 0,
-2949120, 0, 1431502848, 1380929616, 4600404, 0, 45, 0,
-45, 0, 1380929348, 1347376211, 74, 2949120, 0, 2949120,
-0, 1380057088, 827217743, 131072, 0, 45, 0, 45,
-0, 1347442003, 844386895, 70, 1414725632, 1096045121, 1414738510, 1096045121,
-2961998, 0, 4587520, 0, 45, 0, 45, 0,
-45, 0, 75, 1380057088, 827217743, 1380057088, 827217743, 2949120,
-0, 131072, 0, 45, 0, 45, 0, 45,
-0, 75, 2949120, 0, 2949120, 0, 1329856512, 1414746703,
-4935759, 0, 45, 0, 45, 0, 1380929348, 1347376211,
-75, 2949120, 0, 2949120, 0, 1380057088, 827217743, 131072,
-0, 45, 0, 45, 0, 1380929348, 1347376211, 74,
-1380057088, 827217743, 1380057088, 827217743, 2949120, 0, 131072, 0,
-45, 0, 45, 0, 45, 0, 74, 2949120,
-0, 2949120, 0, 1431502848, 1380929616, 4076116, 0, 45,
-0, 45, 0, 1464550740, 877415489, 62, 2949120, 0,
-2949120, 0, 1163132928, 1279350603, 4076620, 0, 45, 0,
-45, 0, 1347442003, 844386895, 62, 2949120, 0, 2949120,
-0, 1431502848, 1380929616, 4076116, 0, 45, 0, 45,
-0, 1096041805, 12620, 1572926, 2949120, 0, 2949120, 0,
-1162674176, 827081044, 4063232, 0, 1096041805, 12620, 1096041805, 12620,
-45, 0, 62, 2949120, 0, 2949120, 0, 2949120,
-0, 1441792, 0, 45, 0, 45, 0, 1096041805,
-12620, 2097214, 1162674176, 827081044, 1162674176, 827081044, 2949120, 0,
-4063232, 0, 45, 0, 45, 0, 45, 0,
-2097220, 2949120, 0, 2949120, 0, 1162674176, 827081044, 4063232,
-0, 1096041805, 12620, 1096041805, 12620, 45, 0, 62,
-2949120, 0, 2949120, 0, 2949120, 0, 4390912, 0,
-1464816194, 12622, 1464816194, 12622, 45, 0, 2, 2949120,
-0, 2949120, 0, 2949120, 0, 4390912, 0, 1464816194,
-12622, 1464816194, 12622, 45, 0, 2, 2949120, 0,
-2949120, 0, 2949120, 0, 4456448, 0, 1464816194, 12622,
-1464816194, 12622, 45, 0, 2, 2949120, 0, 2949120,
-0, 2949120, 0, 1441792, 0, 45, 0, 45,
-0, 1380929348, 1347376211, 22, 2949120, 0, 2949120, 0,
-1329856512, 1414746703, 4411471, 0, 45, 0, 45, 0,
-1380929348, 1347376211, 67, 2949120, 0, 2949120, 0, 1329856512,
-1414746703, 4477007, 0, 45, 0, 45, 0, 1380929348,
-1347376211, 68, 2949120, 0, 2949120, 0, 1329856512, 1414746703,
-1462351, 0, 45, 0, 45, 0, 1464816194, 12622,
-2, 2949120, 0, 2949120, 0, 1380057088, 827217743, 131072,
-0, 45, 0, 45, 0, 1464816194, 12622, 2,
-2949120, 0, 2949120, 0, 1380057088, 827217743, 131072, 0,
-45, 0, 45, 0, 1464816194, 12622, 2, 2949120,
-0, 2949120, 0, 1380057088, 827217743, 131072, 0, 45,
-0, 45, 0, 1464550740, 877415489, 4194366, 2949120, 0,
-2949120, 0, 1163132928, 1279350603, 4076620, 0, 45, 0,
-45, 0, 1464550740, 877415489, 2097214, 2949120, 0, 2949120,
-0, 1163132928, 1279350603, 4076620, 0, 45, 0, 45,
-0, 1464816194, 12622, 2, 2949120, 0, 2949120, 0,
-1329856512, 1414746703, 1527887, 0, 1464816194, 12622, 1464816194, 12622,
-45, 0, 2, 2949120, 0, 2949120, 0, 2949120,
-0, 1507328, 0, 45, 0, 45, 0, 1347442003,
-844386895, 2097171, 1414725632, 1096045121, 1414738510, 1096045121, 2961998, 0,
-1245184, 0, 45, 0, 45, 0, 45, 0,
-23, 2949120, 0, 2949120, 0, 1329856512, 1414746703, 1527887,
-0, 45, 0, 45, 0, 1464816194, 12622, 2,
-1380057088, 827217743, 1380057088, 827217743, 2949120, 0, 131072, 0,
-45, 0, 45, 0, 45, 0, 20, 2949120,
-0, 2949120, 0, 1414725632, 1096045121, 1258062, 0, 45,
-0, 45, 0, 1380929348, 1347376211, 1572884, 1414725632, 1096045121,
-1414738510, 1096045121, 2961998, 0, 1245184, 0, 45, 0,
-45, 0, 45, 0, 20, 2949120, 0, 2949120,
-0, 1329856512, 1414746703, 1331279, 0, 45, 0, 45,
-0, 1464816194, 12622, 2, 2949120, 0, 2949120, 0,
-1380057088, 827217743, 131072, 0, 45, 0, 45, 0,
-1464816194, 875835726, 3, 1414725688, 1096045121, 1414738510, 1096045121, 2961998,
-0, 1245184, 0, 45, 0, 1347442003, 844386895, 45,
-0, 21, 2949120, 0, 2949120, 0, 1329856512, 1381257807,
-1395521, 0, 45, 0, 45, 0, 1464816194, 12622,
-6815746, 2949120, 0, 2949120, 0, 1414725632, 1096045121, 1258062,
-0, 45, 0, 1346720851, 53, 45, 0, 10,
-1414725632, 1096045121, 2961998, 0, 2949120, 0, 1245184, 7340032,
-1464816194, 12622, 1464816194, 12622, 45, 0, 18, 2949120,
-0, 2949120, 0, 2949120, 0, 1376256, 0, 45,
-0, 45, 0, 1464816194, 12622, 2, 2949120, 0,
-2949120, 0, 1329856512, 1381257807, 1395521, 3145728, 45, 0,
-1464816194, 12622, 45, 0, 2, 2949120, 0, 1431502848,
-1380929616, 2962004, 0, 1179648, 3145728, 45, 0, 1464816194,
-12622, 45, 0, 2, 2949120, 0, 1431502848, 1380929616,
-2962004, 0, 1179648, 3145728, 45, 0, 1464816194, 12622,
-45, 0, 2, 2949120, 0, 1431502848, 1380929616, 2962004,
-0, 1114112, 3145728, 45, 0, 1464816194, 12622, 45,
-0, 2, 2949120, 0, 1431502848, 1380929616, 2962004, 0,
-1114112, 3145728, 45, 0, 1464816194, 12622, 45, 0,
-2, 2949120, 0, 1431502848, 1380929616, 2962004, 0, 1114112,
-3145728, 45, 0, 1464816194, 12622, 45, 0, 17,
-2949120, 0, 1431502848, 1380929616, 2962004, 0, 1179648, 0,
-1464816194, 875835726, 1464816194, 875835726, 45, 0, 2, 2949120,
-0, 2949120, 0, 2949120, 0, 196608, 0, 1464816194,
-875835726, 1464816194, 875835726, 45, 0, 2, 2949120, 0,
-2949120, 0, 2949120, 0, 196608, 0, 1464816194, 875835726,
-1464816194, 875835726, 45, 0, 2, 2949120, 0, 2949120,
-0, 2949120, 0, 196608, 0, 45, 0, 45,
-0, 1313821779, 12869, 38, 2949120, 0, 2949120, 0,
-1414725632, 843402831, 2490368, 0, 45, 0, 45, 0,
-1313821779, 12869, 38, 2949120, 0, 2949120, 0, 1414725632,
-843402831, 2490368, 0, 45, 0, 45, 0, 1313821779,
-12869, 38, 2949120, 0, 2949120, 0, 1414725632, 843402831,
-2490368, 0, 45, 0, 45, 0, 1313821779, 12869,
-38, 2949120, 0, 2949120, 0, 1414725632, 843402831, 2490368,
-0, 45, 0, 45, 0, 1464816194, 875835726, 3,
-2949120, 0, 2949120, 0, 1380057088, 827217743, 209972, 0,
-45, 0, 45, 0, 1380929348, 1262572116, 99, 2949120,
-0, 2949120, 0, 1414725632, 1096045121, 2372174, 0, 45,
-0, 45, 0, 1380013139, 843989332, 36, 2949120, 0,
-2949120, 0, 1329856512, 1381257807, 6507329, 64, 45, 0,
-45, 0, 1380013139, 843989332, 96, 2949120, 0, 2949120,
-0, 1329856512, 1381257807, 6376257, 0, 45, 0, 45,
-0, 1380929348, 1262572116, 97, 2949120, 0, 2949120, 0,
-1414725632, 1096045121, 6304334, 0, 1145522498, 844255055, 45, 0,
-45, 0, 38, 1094778880, 1313428563, 1094801739, 1313428563, 2971979,
-0, 6488064, 0, 1145522498, 844255055, 45, 0, 45,
-0, 36, 1094778880, 1313428563, 1094801739, 1313428563, 2971979, 0,
-6488064, 0, 1380013139, 843989332, 45, 0, 45, 0,
-36, 1094778880, 1313428563, 1094801739, 1313428563, 2971979, 0, 6356992,
-0, 1380013139, 843989332, 45, 0, 45, 0, 96,
-1094778880, 1313428563, 1094801739, 1313428563, 2971979, 0, 6356992, 0,
-45, 0, 45, 0, 1347243843, 1280065876, 28, 2949120,
-0, 2949120, 0, 1329790976, 1096044621, 1854540, 0, 45,
-0, 45, 0, 1347243843, 1280065876, 28, 2949120, 0,
-2949120, 0, 1329790976, 1096044621, 1854540, 0, 45, 0,
-45, 0, 1347243843, 1280065876, 28, 2949120, 0, 2949120,
-0, 1329856512, 1163022927, 2359364, 0, 45, 0, 45,
-0, 1380929348, 4474194, 36, 2949120, 0, 2949120, 0,
-1329790976, 1096044621, 5721164, 0, 45, 0, 45, 0,
-1347243843, 1280065876, 87, 2949120, 0, 2949120, 0, 1329790976,
-1096044621, 5721164, 192, 45, 0, 45, 0, 1347243843,
-1280065876, 87, 2949120, 0, 2949120, 0, 1329790976, 1096044621,
-5721164, 0, 45, 0, 45, 0, 1347442003, 844386895,
-147, 2949120, 0, 2949120, 0, 1414725632, 860312129, 9502720,
-0, 45, 0, 45, 0, 1347442003, 844386895, 147,
-2949120, 0, 2949120, 0, 1329790976, 1230262349, 5719372, 0,
-1380013139, 13127, 45, 0, 45, 0, 145, 1380384768,
-1096046913, 1380404300, 1096046913, 2968652, 0, 9633792, 0, 1347243843,
-1162627412, 1346720851, 51, 45, 0, 87, 1380384768, 1096046913,
-1380404300, 1096046913, 2968652, 0, 9633792, 0, 45, 0,
-45, 0, 1347442003, 844386895, 92, 2949120, 0, 2949120,
-0, 1414725632, 860312129, 5636096, 0, 45, 0, 45,
-0, 1380013139, 13127, 86, 2949120, 0, 2949120, 0,
-1431502848, 1380929616, 6042196, 0, 1380013139, 13127, 45, 0,
-45, 0, 86, 1380384768, 1096046913, 1380404300, 1096046913, 2968652,
-0, 6029312, 0, 1347243843, 1162627412, 1346720851, 51, 45,
-0, 87, 1380384768, 1096046913, 1380404300, 1096046913, 2968652, 0,
-6029312, 0, 45, 0, 45, 0, 1347243843, 1280065876,
-87, 2949120, 0, 2949120, 0, 1431502848, 1380929616, 9777748,
-0, 45, 0, 45, 0, 1380013139, 13127, 145,
-2949120, 0, 2949120, 0, 1414725632, 860312129, 9502720, 0,
-45, 0, 45, 0, 1347442003, 844386895, 149, 1414725632,
-860312129, 2949120, 0, 2949120, 0, 9502720, 0, 1497453127,
-1280065876, 1497453127, 1280065876, 45, 0, 149, 1329790976, 1230262349,
-1414743372, 3362885, 2949120, 0, 5701632, 0, 1497453127, 1280065876,
-1497453127, 1280065876, 45, 0, 149, 2949120, 0, 2949120,
-0, 1329790976, 1096044621, 5721164, 8, 45, 0, 45,
-0, 1347442003, 844386895, 91, 2949120, 0, 2949120, 0,
-1414725632, 860312129, 5767168, 0, 1380013139, 13127, 45, 0,
-45, 0, 88, 1380384768, 1096046913, 1380404300, 1096046913, 2968652,
-0, 5963776, 0, 1347243843, 1162627412, 1346720851, 51, 45,
-0, 87, 1380384768, 1096046913, 1380404300, 1096046913, 2968652, 0,
-5963776, 0, 45, 0, 45, 0, 1347243843, 826627157,
-87, 2949120, 0, 2949120, 0, 1329790976, 1414877261, 5714245,
-0, 45, 0, 45, 0, 1347243843, 826627157, 87,
-2949120, 0, 2949120, 0, 1329790976, 1414877261, 5714245, 0,
-45, 0, 45, 0, 1347243843, 1280065876, 183, 1329790976,
-1096044621, 2968652, 0, 2949120, 0, 11993088, 0, 45,
-0, 45, 0, 45, 0, 188, 2949120, 0,
-2949120, 0, 1329790976, 1096044621, 12012620, 2097216, 1347243843, 1280065876,
-1347243843, 1280065876, 45, 0, 183, 2949120, 0, 2949120,
-0, 2949120, 0, 12255232, 64, 45, 0, 45,
-0, 1347243843, 1280065876, 183, 2949120, 0, 2949120, 0,
-1329790976, 1096044621, 12274764, 0, 45, 0, 45, 0,
-1347243843, 1280065876, 187, 2949120, 0, 2949120, 0, 1329790976,
-1096044621, 12274764, 0, 1347243843, 1280065876, 45, 0, 45,
-0, 146, 2949120, 0, 2949120, 0, 2949120, 0,
-11993088, 524288, 45, 0, 45, 0, 1145130067, 1280065879,
-188, 2949120, 0, 2949120, 0, 1280507904, 1096238145, 12405836,
-524288, 1145130067, 1280065879, 45, 0, 45, 0, 189,
-2949120, 0, 2949120, 0, 2949120, 0, 12320768, 0,
-45, 0, 45, 0, 1145130067, 1280065879, 182, 2949120,
-0, 2949120, 0, 1280507904, 1096238145, 11947084, 0, 45,
-0, 45, 0, 1380013139, 13127, 84, 2949120, 0,
-2949120, 0, 1414725632, 860312129, 5505024, 0, 45, 0,
-45, 0, 1380013139, 13127, 84, 2949120, 0, 2949120,
-0, 1414725632, 860312129, 5505024, 0, 45, 0, 45,
-0, 1380013139, 13127, 84, 2949120, 0, 2949120, 0,
-1414725632, 860312129, 5505024, 0, 45, 0, 45, 0,
-1380013139, 13127, 84, 1414725632, 1380405825, 1414725681, 3362885, 2949120,
-0, 5505024, 0, 45, 0, 45, 0, 45,
-0, 98, 2949120, 0, 2949120, 0, 1414725632, 860312129,
-5505024, 0, 45, 0, 45, 0, 1380013139, 13127,
-84, 2949120, 0, 2949120, 0, 1280507904, 1096238145, 10964044,
-0, 1145130067, 1280065879, 45, 0, 45, 0, 181,
-2949120, 0, 1414725632, 3559493, 2949120, 0, 11927552, 0,
-1145130067, 1280065879, 1346720851, 54, 45, 0, 189, 2949120,
-0, 2949120, 0, 2949120, 0, 11927552, 0, 1145130067,
-1280065879, 1346720851, 54, 45, 0, 167, 2949120, 0,
-2949120, 0, 2949120, 0, 11010048, 0, 45, 0,
-45, 0, 1145130067, 1280065879, 168, 2949120, 0, 2949120,
-0, 1280507904, 1096238145, 11095116, 0, 1145130067, 1280065879, 1145130067,
-1280065879, 45, 0, 169, 2949120, 0, 2949120, 0,
-2949120, 0, 11599872, 0, 45, 0, 45, 0,
-1145130067, 1280065879, 169, 1280507904, 1096238145, 1280527436, 1096238145, 2968652,
-0, 11075584, 0, 45, 0, 45, 0, 45,
-0, 171, 2949240, 0, 2949120, 0, 1465057280, 1095521073,
-11337796, 7340032, 45, 0, 45, 0, 1145130067, 1280065879,
-173, 1280507904, 1096238145, 1280527436, 1096238145, 2968652, 0, 11075584,
-0, 45, 0, 45, 0, 45, 0, 172,
-2949120, 0, 2949120, 0, 1280507904, 1096238145, 11095116, 0,
-1464816194, 12622, 1464816194, 12622, 45, 0, 170, 2949120,
-0, 2949120, 0, 2949120, 0, 11599872, 0, 1464816194,
-12622, 1464816194, 12622, 45, 0, 170, 2949120, 0,
-2949120, 0, 2949120, 0, 11206656, 0, 1464816194, 12622,
-1464816194, 12622, 45, 0, 170, 2949120, 0, 2949120,
-0, 2949120, 0, 11272192, 0, 45, 0, 45,
-0, 1464816194, 12622, 170, 2949120, 0, 2949120, 0,
-1380057088, 827217743, 11141120, 0, 45, 0, 45, 0,
-1464816194, 12622, 170, 2949120, 0, 2949120, 0, 1380057088,
-827217743, 11141120, 0, 45, 0, 45, 0, 1464816194,
-12622, 170, 2949120, 0, 2949120, 0, 1380057088, 827217743,
-11141120, 0, 45, 0, 45, 0, 1464816194, 875835726,
-174, 2949120, 0, 2949120, 0, 1380057088, 827217743, 11416628,
-0, 45, 0, 45, 0, 1464816194, 875835726, 174,
-2949120, 0, 2949120, 0, 1380057088, 827217743, 11416628, 0,
-45, 0, 45, 0, 1464816194, 12622, 170, 2949120,
-0, 2949120, 0, 1380057088, 827217743, 11141120, 0, 45,
-0, 45, 0, 1380929348, 1347376211, 177, 2949120, 0,
-2949120, 0, 1329856512, 1414746703, 11620431, 0, 45, 0,
-45, 0, 1380929348, 1347376211, 171, 2949120, 0, 2949120,
-0, 1329856512, 1414746703, 11227215, 0, 45, 0, 45,
-0, 1380929348, 1347376211, 172, 2949120, 0, 2949120, 0,
-1329856512, 1414746703, 11292751, 0, 45, 0, 1464816194, 875835726,
-45, 0, 170, 2949120, 0, 2949120, 0, 2949120,
-0, 11403264, 0, 45, 0, 1464816194, 875835726, 45,
-0, 170, 2949120, 0, 2949120, 0, 2949120, 0,
-11403264, 0, 45, 0, 45, 0, 1145130067, 1280065879,
-168, 1280507904, 1096238145, 1280527436, 1096238145, 2968652, 0, 11075584,
-0, 45, 0, 45, 0, 45, 0, 168,
-2949120, 0, 1380057088, 1213093711, 2967381, 0, 11468800, 0,
-45, 0, 45, 0, 45, 0, 176, 2949120,
-0, 1380057088, 1213093711, 2967381, 0, 11468800, 0, 45,
-0, 45, 0, 45, 0, 176, 2949120, 0,
-1380057088, 1213093711, 2967381, 0, 11468800, 0, 45, 0,
-45, 0, 45, 0, 176, 2949120, 0, 1380057088,
-1213093711, 2967381, 0, 11468800, 0, 45, 0, 45,
-0, 45, 0, 176, 2949120, 0, 1380057088, 961435471,
-2949174, 0, 11468800, 0, 45, 0, 45, 0,
-45, 0, 169, 2949120, 0, 1380057088, 961435471, 2949174,
-0, 11468800, 0, 45, 0, 45, 0, 45,
-0, 169, 2949120, 0, 1380057088, 961435471, 2949174, 0,
-11468800, 0, 45, 0, 45, 0, 45, 0,
-169, 2949120, 0, 1380057088, 961435471, 2949174, 0, 11468800,
-0, 45, 0, 45, 0, 45, 0, 169,
-2949120, 0, 1380057088, 961435471, 2949174, 0, 11468800, 0,
-45, 0, 45, 0, 45, 0, 169, 2949120,
-0, 1380057088, 961435471, 2949174, 0, 11468800, 0, 45,
-0, 45, 0, 45, 0, 169, 2949120, 0,
-1380057088, 961435471, 2949174, 0, 11468800, 0, 45, 0,
-45, 0, 45, 0, 169, 2949120, 0, 1380057088,
-961435471, 2949174, 0, 11468800, 0, 45, 0, 45,
-0, 45, 0, 169, 1280507904, 1096238145, 1280527436, 1096238145,
-2968652, 0, 11075584, 0, 45, 0, 45, 0,
-45, 0, 173, 1280507904, 1096238145, 1280527436, 1096238145, 2968652,
-0, 11075584, 0, 45, 0, 45, 0, 45,
-0, 173, 1380057088, 827217743, 1380070452, 827217743, 2962484, 0,
-131072, 0, 45, 0, 45, 0, 45, 0,
-3, 1380057088, 827217743, 1380070452, 827217743, 2962484, 0, 131072,
-0, 45, 0, 45, 0, 45, 0, 3,
-2949120, 0, 2949120, 0, 1380057088, 827217743, 131072, 0,
-45, 0, 45, 0, 1162564942, 1145130067, 39, 2949120,
-0, 2949120, 0, 1280507904, 1230128193, 2568784, 0, 45,
-0, 45, 0, 1162564942, 1145130067, 39, 2949120, 0,
-2949120, 0, 1280507904, 1230128193, 2568784, 0, 45, 0,
-45, 0, 1162564942, 1145130067, 39, 2949120, 0, 2949120,
-0, 1280507904, 1230128193, 2568784, 0, 45, 0, 45,
-0, 1162564942, 1145130067, 39, 2949120, 0, 2949120, 0,
-1431175168, 1280525643, 2573377, 0, 1145130067, 1280065879, 1162564942, 1145130067,
-45, 0, 39, 2949120, 0, 2949120, 0, 2949120,
-0, 2293760, 0, 45, 0, 1162564942, 13362, 45,
-0, 39, 2949120, 0, 2949120, 0, 2949120, 0,
-2621440, 0, 45, 0, 1162564942, 13362, 45, 0,
-39, 2949120, 0, 2949120, 0, 2949120, 0, 2621440,
-0, 45, 0, 1162564942, 13362, 45, 0, 39,
-2949120, 0, 2949120, 0, 2949120, 0, 2621440, 0,
-45, 0, 1162564942, 13362, 45, 0, 39, 2949120,
-0, 2949120, 0, 2949120, 0, 2621440, 0, 45,
-0, 45, 0, 1313821779, 13125, 40, 2949240, 0,
-2949120, 0, 1465057280, 1330926385, 2699598, 0, 45, 0,
-45, 0, 1313821779, 13125, 40, 2949120, 0, 2949120,
-0, 1414725632, 860180047, 2621440, 0, 1313821779, 13125, 1313821779,
-13125, 45, 0, 40, 2949120, 0, 2949120, 0,
-2949120, 0, 2686976, 0, 1313821779, 13125, 1313821779, 13125,
-45, 0, 40, 2949120, 0, 2949120, 0, 2949120,
-0, 2686976, 0, 1313821779, 13125, 1313821779, 13125, 45,
-0, 40, 2949120, 0, 2949120, 0, 2949120, 0,
-2686976, 0, 45, 0, 45, 0, 1380013139, 860766548,
-35, 2949120, 0, 2949120, 0, 1431502848, 1380929616, 2306644,
-0, 45, 0, 45, 0, 1380013139, 860766548, 35,
-2949120, 0, 2949120, 0, 1431502848, 1380929616, 2306644, 0,
-45, 0, 45, 0, 1380013139, 843989332, 4194454, 2949120,
-0, 2949120, 0, 1414725632, 1096045121, 9908814, 0, 45,
-0, 45, 0, 1380013139, 843989332, 3145881, 2949120, 0,
-2949120, 0, 1414725632, 1096045121, 9843278, 0, 45, 0,
-1346720851, 54, 45, 0, 150, 1414725632, 1096045121, 2961998,
-0, 2949120, 0, 9895936, 0, 45, 0, 1346720851,
-54, 45, 0, 151, 1414725632, 1096045121, 2961998, 0,
-2949120, 0, 9961472, 0, 45, 0, 1346720851, 54,
-45, 0, 152, 1414725632, 1096045121, 2961998, 0, 2949120,
-0, 10027008, 0, 45, 0, 1346720851, 54, 45,
-0, 153, 1414725632, 1096045121, 2961998, 0, 2949120, 0,
-10092544, 0, 45, 0, 1346720851, 54, 45, 0,
-154, 1414725632, 1096045121, 2961998, 0, 2949120, 0, 10158080,
-4, 45, 0, 45, 0, 1347442003, 844386895, 262298,
-2949120, 0, 2949120, 0, 1431502848, 1380929616, 10039892, 0,
-45, 0, 45, 0, 1380013139, 843989332, 1573016, 2949120,
-0, 2949120, 0, 1414725632, 1096045121, 9908814, 0, 1380013139,
-827212116, 1346720851, 54, 45, 0, 161, 1414725632, 1096045121,
-2961742, 0, 2949120, 0, 10616832, 0, 45, 0,
-45, 0, 1380013139, 843989332, 180, 2949120, 0, 2949120,
-0, 1229717504, 3425620, 11796480, 0, 45, 0, 45,
-0, 1380013139, 12615, 262322, 2949120, 0, 2949120, 0,
-1431502848, 1380929616, 10629716, 0, 45, 0, 45, 0,
-1145130067, 1280065879, 141, 2949120, 0, 2949120, 0, 1280507904,
-1096238145, 11095116, 0, 1145130067, 1280065879, 1145130067, 1280065879, 45,
-0, 169, 2949120, 0, 2949120, 0, 2949120, 0,
-11730944, 0, 45, 0, 45, 0, 1145130067, 1280065879,
-169, 1414725680, 826757697, 1414725632, 826757697, 2949120, 0, 11665408,
-0, 45, 0, 45, 0, 45, 0, 262323,
-2949120, 0, 2949120, 0, 1431502848, 1380929616, 11678292, 0,
-45, 0, 45, 0, 1380013139, 12615, 178, 2949120,
-0, 2949120, 0, 1329856512, 1414746703, 11751503, 0, 45,
-0, 45, 0, 1380929348, 1347376211, 179, 1414725632, 1096045121,
-1414738510, 3559493, 2949120, 0, 10616832, 0, 45, 0,
-45, 0, 45, 0, 143, 2949120, 0, 2949120,
-0, 1414725632, 1096045121, 10629710, 0, 45, 0, 45,
-0, 1145130067, 1280065879, 163, 2949120, 0, 2949120, 0,
-1414725632, 826757697, 11665408, 0, 1380013139, 827212116, 1413565520, 49,
-45, 0, 178, 2949120, 0, 1280311296, 3232833, 2949120,
-0, 11665408, 0, 1380013139, 843989332, 1380013139, 843989332, 45,
-0, 162, 1414725632, 1096045121, 1414738510, 1096045121, 2961998, 0,
-11796480, 0, 45, 0, 45, 0, 1380013139, 843989332,
-152, 2949120, 0, 2949120, 0, 1431502848, 1380929616, 9974356,
-0, 45, 0, 45, 0, 1380013139, 12615, 178,
-2949120, 0, 2949120, 0, 1431502848, 1380929616, 11678292, 0,
-45, 0, 45, 0, 1347442003, 844386895, 143, 2949120,
-0, 2949120, 0, 1280507904, 1096238145, 9391180, 0, 45,
-0, 45, 0, 1162889552, 50, 137, 2949120, 0,
-2949120, 0, 1229979648, 3294544, 8978432, 0, 1162889552, 50,
-1347442003, 844386895, 45, 0, 137, 1380384768, 1096046913, 2968652,
-0, 2949120, 0, 9043968, 0, 45, 0, 45,
-0, 1162889552, 50, 120, 2949120, 0, 2949120, 0,
-1229979648, 3294544, 7929856, 0, 45, 0, 45, 0,
-1162889552, 50, 121, 2949120, 0, 2949120, 0, 1229979648,
-3294544, 7864320, 0, 1162889552, 50, 45, 0, 45,
-0, 120, 1380384768, 1096046913, 2968652, 0, 2949120, 0,
-7929856, 0, 45, 0, 45, 0, 1380013139, 843989332,
-36, 2949120, 0, 2949120, 0, 1414725632, 1096045121, 2372174,
-0, 45, 0, 45, 0, 1347442003, 844386895, 36,
-2949120, 0, 2949120, 0, 1431502848, 1380929616, 2372180, 7864320,
-1145130067, 1280065879, 1162564942, 1145130067, 45, 0, 142, 1280507904,
-1096238145, 1431194700, 1280525643, 2966593, 0, 9371648, 0, 45,
-0, 45, 0, 1347442003, 844386895, 138, 2949120, 0,
-2949120, 0, 1431502848, 1380929616, 9056852, 0, 1380013139, 860766548,
-45, 0, 45, 0, 138, 2949120, 0, 2949120,
-0, 2949120, 0, 9175040, 96, 45, 0, 45,
-0, 1380013139, 843989332, 138, 1329856512, 3232335, 2949120, 0,
-2949120, 0, 9109504, 0, 45, 0, 45, 0,
-45, 0, 140, 2949120, 0, 2949120, 0, 1329856512,
-1381257807, 9194305, 0, 45, 0, 45, 0, 1380929348,
-1262572116, 140, 2949120, 0, 2949120, 0, 1280507904, 1096238145,
-9129036, 0, 45, 0, 45, 0, 1145130067, 1280065879,
-139, 2949120, 0, 2949120, 0, 1280507904, 1096238145, 8932428,
-0, 45, 0, 45, 0, 1145130067, 1280065879, 136,
-2949120, 0, 2949120, 0, 1280507904, 1096238145, 8866892, 0,
-45, 0, 45, 0, 1145130067, 1280065879, 134, 2949120,
-0, 2949120, 0, 1280507904, 1096238145, 8735820, 0, 45,
-0, 45, 0, 1145130067, 1280065879, 133, 2949120, 0,
-2949120, 0, 1280507904, 1096238145, 8801356, 0, 45, 0,
-45, 0, 1145130067, 1280065879, 132, 2949120, 0, 2949120,
-0, 1280507904, 1096238145, 8604748, 0, 45, 0, 45,
-0, 1145130067, 1280065879, 131, 2949120, 0, 2949120, 0,
-1280507904, 1096238145, 8670284, 0, 45, 0, 45, 0,
-1145130067, 1280065879, 119, 2949120, 0, 2949120, 0, 1280507904,
-1096238145, 7818316, 0, 45, 0, 45, 0, 1145130067,
-1280065879, 118, 2949120, 0, 2949120, 0, 1280507904, 1096238145,
-7752780, 32, 1145130067, 1280065879, 1346720851, 54, 45, 0,
-136, 2949120, 0, 2949120, 0, 2949120, 0, 9109504,
-32, 1145130067, 1280065879, 1346720851, 54, 45, 0, 135,
-2949120, 0, 2949120, 0, 2949120, 0, 8912896, 32,
-1145130067, 1280065879, 1346720851, 54, 45, 0, 134, 2949120,
-0, 2949120, 0, 2949120, 0, 8847360, 32, 1145130067,
-1280065879, 1346720851, 54, 45, 0, 133, 2949120, 0,
-2949120, 0, 2949120, 0, 8781824, 32, 1145130067, 1280065879,
-1346720851, 54, 45, 0, 132, 2949120, 0, 2949120,
-0, 2949120, 0, 8716288, 32, 1145130067, 1280065879, 1346720851,
-54, 45, 0, 131, 2949120, 0, 2949120, 0,
-2949120, 0, 8650752, 32, 1145130067, 1280065879, 1346720851, 54,
-45, 0, 119, 2949120, 0, 2949120, 0, 2949120,
-0, 8585216, 32, 1145130067, 1280065879, 1346720851, 54, 45,
-0, 118, 2949120, 0, 2949120, 0, 2949120, 0,
-7798784, 32, 1145130067, 1280065879, 1346720851, 54, 45, 0,
-117, 2949120, 0, 2949120, 0, 2949120, 0, 7733248,
-0, 45, 0, 45, 0, 1145130067, 1280065879, 262261,
-2949120, 0, 2949120, 0, 1431502848, 1380929616, 7680596, 4,
-45, 0, 45, 0, 1347442003, 844386895, 117, 2949120,
-0, 2949120, 0, 1280507904, 1096238145, 7687244, 32, 1145130067,
-1280065879, 45, 0, 45, 0, 117, 2949120, 0,
-2949120, 0, 2949120, 0, 7995392, 0, 45, 0,
-45, 0, 1347442003, 844386895, 138, 2949120, 0, 2949120,
-0, 1414725632, 1096045121, 9056846, 0, 45, 0, 45,
-0, 1347442003, 844386895, 138, 2949120, 0, 2949120, 0,
-1380057088, 1196316495, 8080978, 0, 45, 0, 45, 0,
-1464816194, 1314015054, 123, 2949120, 0, 2949120, 0, 1229717504,
-3491156, 8126464, 0, 45, 0, 45, 0, 1163151692,
-53, 124, 1380057088, 1196316495, 2969170, 0, 2949120, 0,
-8060928, 0, 45, 0, 45, 0, 45, 0,
-124, 2949120, 0, 2949120, 0, 1380057088, 1196316495, 8080978,
-0, 45, 0, 45, 0, 1464816194, 1314015054, 123,
-2949120, 0, 2949120, 0, 1229717504, 3491156, 8454144, 0,
-45, 0, 45, 0, 1163151692, 53, 129, 1380057088,
-1196316495, 2969170, 0, 2949120, 0, 8060928, 0, 45,
-0, 45, 0, 45, 0, 129, 1229979664, 3294544,
-1465057280, 1346981937, 2949189, 0, 7864320, 0, 45, 0,
-45, 0, 45, 0, 18874493, 2949120, 0, 2949120,
-0, 1414725632, 1096045121, 10564174, 48, 45, 0, 45,
-0, 1380013139, 843989332, 161, 1380057088, 827217743, 1414725632, 3559493,
-2949120, 0, 8388608, 0, 45, 0, 45, 0,
-45, 0, 123, 2949120, 0, 2949120, 0, 1380057088,
-827217743, 8388608, 0, 45, 0, 45, 0, 1464816194,
-12622, 126, 2949120, 0, 2949120, 0, 1380057088, 827217743,
-3997696, 0, 45, 0, 45, 0, 1464816194, 12622,
-128, 2949120, 0, 2949120, 0, 1380057088, 827217743, 3997696,
-0, 45, 0, 45, 0, 1464816194, 12622, 126,
-2949120, 0, 2949120, 0, 1380057088, 827217743, 3932160, 0,
-45, 0, 45, 0, 1464816194, 12622, 60, 2949120,
-0, 2949120, 0, 1380057088, 827217743, 3866624, 0, 45,
-0, 45, 0, 1464816194, 12622, 56, 2949120, 0,
-2949120, 0, 1380057088, 827217743, 3670016, 0, 45, 0,
-45, 0, 1464816194, 12622, 59, 2949120, 0, 2949120,
-0, 1380057088, 827217743, 3473408, 0, 45, 0, 45,
-0, 1464816194, 12622, 53, 2949120, 0, 2949120, 0,
-1380057088, 827217743, 2818048, 0, 1464816194, 12622, 1464816194, 12622,
-45, 0, 43, 2949120, 0, 2949120, 0, 2949120,
-0, 3735552, 0, 45, 0, 45, 0, 1464816194,
-12622, 43, 1380057088, 827217743, 1380057088, 827217743, 2949120, 0,
-2818048, 0, 45, 0, 45, 0, 45, 0,
-58, 2949120, 0, 2949120, 0, 1380057088, 827217743, 2818048,
-0, 1464816194, 12622, 1464816194, 12622, 45, 0, 43,
-2949120, 0, 2949120, 0, 2949120, 0, 3276800, 0,
-1464816194, 12622, 1464816194, 12622, 45, 0, 43, 2949120,
-0, 2949120, 0, 2949120, 0, 2883584, 0, 45,
-0, 45, 0, 1464816194, 12622, 43, 1380057088, 827217743,
-1380057088, 827217743, 2949120, 0, 2818048, 0, 45, 0,
-45, 0, 45, 0, 46, 2949120, 0, 2949120,
-0, 1380057088, 827217743, 2818048, 0, 1464816194, 12622, 1464816194,
-12622, 45, 0, 43, 2949120, 0, 2949120, 0,
-2949120, 0, 2949120, 0, 45, 0, 45, 0,
-1380929348, 1347376211, 45, 2949120, 0, 2949120, 0, 1329856512,
-1414746703, 2969679, 0, 45, 0, 45, 0, 1380929348,
-1347376211, 46, 2949120, 0, 2949120, 0, 1329856512, 1414746703,
-3035215, 0, 45, 0, 45, 0, 1380929348, 1347376211,
-44, 2949120, 0, 2949120, 0, 1329856512, 1414746703, 3297359,
-0, 45, 0, 45, 0, 1380929348, 1347376211, 50,
-2949120, 0, 2949120, 0, 1329856512, 1414746703, 3821647, 0,
-45, 0, 45, 0, 1380929348, 1347376211, 58, 2949120,
-0, 2949120, 0, 1329856512, 1414746703, 3756111, 0, 45,
-0, 45, 0, 1380929348, 1347376211, 57, 2949120, 0,
-2949120, 0, 1380057088, 827217743, 2752512, 0, 1464816194, 12622,
-1464816194, 12622, 45, 0, 42, 2949120, 0, 2949120,
-0, 2949120, 0, 3735552, 0, 1464816194, 12622, 1464816194,
-12622, 45, 0, 42, 2949120, 0, 2949120, 0,
-2949120, 0, 3801088, 0, 45, 0, 45, 0,
-1464816194, 12622, 42, 1380057088, 827217743, 1380057088, 827217743, 2949120,
-0, 2752512, 0, 45, 0, 45, 0, 45,
-0, 46, 2949120, 0, 2949120, 0, 1380057088, 827217743,
-2752512, 0, 1464816194, 12622, 1464816194, 12622, 45, 0,
-42, 2949120, 0, 2949120, 0, 2949120, 0, 2949120,
-0, 45, 0, 45, 0, 1464816194, 12622, 42,
-2949120, 0, 2949120, 0, 1380057088, 827217743, 2752512, 0,
-45, 0, 45, 0, 1464816194, 12622, 42, 2949120,
-0, 2949120, 0, 1329856512, 1414746703, 2904143, 0, 1464816194,
-12622, 1464816194, 12622, 45, 0, 42, 2949120, 0,
-2949120, 0, 2949120, 0, 2883584, 0, 45, 0,
-45, 0, 1464816194, 12622, 42, 1380057088, 827217743, 1380057088,
-827217743, 2949120, 0, 2752512, 0, 45, 0, 45,
-0, 45, 0, 50, 2949120, 0, 2949120, 0,
-1380057088, 827217743, 2752512, 0, 45, 0, 45, 0,
-1464816194, 12622, 42, 2949120, 0, 2949120, 0, 1380057088,
-827217743, 2752512, 0, 45, 0, 45, 0, 1464816194,
-12622, 42, 2949120, 0, 2949120, 0, 1380057088, 1213093711,
-3098453, 0, 45, 0, 45, 0, 1464816194, 1196771406,
-47, 2949120, 0, 2949120, 0, 1380057088, 1213093711, 3098453,
-0, 45, 0, 45, 0, 1464816194, 1196771406, 47,
-2949120, 0, 2949120, 0, 1380057088, 1213093711, 3098453, 0,
-45, 0, 45, 0, 1464816194, 1196771406, 47, 2949120,
-0, 2949120, 0, 1380057088, 827217743, 2752512, 0, 45,
-0, 45, 0, 1464816194, 12622, 43, 2949120, 0,
-2949120, 0, 1380057088, 827217743, 3407872, 0, 1464816194, 12622,
-1346720851, 54, 45, 0, 127, 1380057088, 827217743, 2949120,
-0, 2949120, 0, 8388608, 0, 1464816194, 12622, 1346720851,
-54, 45, 0, 126, 2949120, 0, 2949120, 0,
-2949120, 0, 8323072, 0, 1464816194, 12622, 1346720851, 54,
-45, 0, 61, 2949120, 0, 2949120, 0, 2949120,
-0, 8257536, 0, 1464816194, 12622, 1346720851, 54, 45,
-0, 60, 2949120, 0, 2949120, 0, 2949120, 0,
-3997696, 0, 1464816194, 12622, 1346720851, 54, 45, 0,
-59, 2949120, 0, 2949120, 0, 2949120, 0, 3932160,
-0, 1464816194, 12622, 1346720851, 54, 45, 0, 56,
-2949120, 0, 2949120, 0, 2949120, 0, 3866624, 0,
-1464816194, 12622, 1346720851, 54, 45, 0, 53, 2949120,
-0, 2949120, 0, 2949120, 0, 3670016, 0, 1464816194,
-12622, 1346720851, 54, 45, 0, 52, 1380057088, 827217743,
-2949120, 0, 2949120, 0, 3473408, 0, 1464816194, 12622,
-45, 0, 45, 0, 43, 2949120, 0, 2949120,
-0, 2949120, 0, 3538944, 0, 45, 0, 45,
-0, 1464816194, 12622, 52, 1480916992, 1329878089, 2970191, 0,
-2949120, 0, 3407872, 0, 45, 0, 45, 0,
-45, 0, 55, 2949120, 0, 2949120, 0, 1380057088,
-827217743, 3407872, 4, 45, 0, 45, 0, 1347442003,
-844386895, 262196, 2949120, 0, 2949120, 0, 1431502848, 1380929616,
-3420756, 0, 45, 0, 45, 0, 1464816194, 12622,
-262196, 2949120, 0, 2949120, 0, 1431502848, 1380929616, 8401492,
-4, 45, 0, 45, 0, 1347442003, 844386895, 128,
-2949120, 0, 2949120, 0, 1329856512, 1381257807, 3623745, 0,
-45, 0, 45, 0, 1380929348, 1347376211, 54, 2949120,
-0, 2949120, 0, 1329856512, 1381257807, 3623745, 0, 45,
-0, 45, 0, 1380929348, 1347376211, 54, 1480916992, 1329878089,
-2970191, 0, 2949120, 0, 3538944, 0, 45, 0,
-45, 0, 45, 0, 55, 1380057088, 1213093711, 1380075349,
-1213093711, 2967381, 0, 2752512, 0, 45, 0, 45,
-0, 45, 0, 47, 1380057088, 1213093711, 1380075349, 1213093711,
-2967381, 0, 2752512, 0, 45, 0, 45, 0,
-45, 0, 47, 1380057088, 1213093711, 1380075349, 1213093711, 2967381,
-0, 2752512, 0, 45, 0, 45, 0, 45,
-0, 47, 1163132928, 1279350603, 1163145548, 1279350603, 2961740, 0,
-3211264, 0, 1464550740, 827083841, 45, 0, 45, 0,
-43, 1163132928, 1279350603, 1163145548, 1279350603, 2961740, 0, 3211264,
-0, 1464550740, 827083841, 45, 0, 45, 0, 4194347,
-1163132928, 1279350603, 1163145548, 1279350603, 2961740, 0, 3211264, 64,
-1464550740, 827083841, 45, 0, 45, 0, 43, 2949120,
-0, 2949120, 0, 1163132928, 1279350603, 3159372, 0, 45,
-0, 45, 0, 1127307091, 5262671, 48, 2949120, 0,
-2949120, 0, 1163132928, 1279350603, 3159372, 0, 45, 0,
-45, 0, 1464816194, 12622, 43, 2949120, 0, 2949120,
-0, 1431502848, 1380929616, 2830932, 0, 45, 0, 45,
-0, 1464816194, 12622, 43, 2949120, 0, 2949120, 0,
-1431502848, 1380929616, 2830932, 32, 45, 0, 45, 0,
-1380013139, 843989332, 393231, 2949120, 0, 2949120, 0, 1431502848,
-1380929616, 995924, 6, 45, 0, 45, 0, 1347442003,
-844386895, 65, 2949120, 0, 2949120, 0, 1414725632, 1096045121,
-4272718, 0, 45, 0, 45, 0, 1347442003, 844386895,
-1573042, 2949120, 0, 2949120, 0, 1414725632, 826757697, 11665408,
-0, 1347243843, 1162627412, 45, 0, 45, 0, 148,
-2949120, 0, 2949120, 0, 2949120, 0, 5701632, 0,
-1347243843, 1162627412, 45, 0, 45, 0, 87, 2949120,
-0, 2949120, 0, 2949120, 0, 9568256, 0, 1145130067,
-1280065879, 1145130067, 1280065879, 45, 0, 192, 2949120, 0,
-2949120, 0, 2949120, 0, 12713984, 0, 45, 0,
-45, 0, 1145130067, 1280065879, 194, 2949120, 0, 2949120,
-0, 1280507904, 1096238145, 12733516, 0, 45, 0, 45,
-0, 1145130067, 1280065879, 193, 2949120, 0, 2949120, 0,
-1280507904, 1096238145, 12667980, 0, 45, 0, 45, 0,
-1145130067, 1280065879, 193, 1280507904, 1096238145, 1280527436, 1096238145, 2968652,
-0, 12648448, 0, 45, 0, 45, 0, 45,
-0, 194, 2949120, 0, 2949120, 0, 1329790976, 1096044621,
-5721164, 0, 45, 0, 45, 0, 1347243843, 1280065876,
-12582999, 1329790976, 1096044621, 1329810508, 1096044621, 2968652, 0, 6881280,
-0, 45, 0, 45, 0, 45, 0, 12583018,
-1329790976, 1096044621, 1329810508, 1096044621, 2968652, 0, 5701632, 0,
-45, 0, 45, 0, 45, 0, 262250, 2949120,
-0, 2949120, 0, 1431502848, 1380929616, 5714516, 4, 45,
-0, 45, 0, 1347442003, 844386895, 87, 2949120, 0,
-2949120, 0, 1329856512, 1414746703, 6967375, 0, 45, 0,
-45, 0, 1380929348, 1347376211, 106, 2949120, 0, 2949120,
-0, 1163132928, 1279350603, 6894156, 0, 45, 0, 45,
-0, 1464550740, 843861057, 105, 2949120, 0, 2949120, 0,
-1163132928, 1279350603, 6894156, 0, 45, 0, 45, 0,
-1464550740, 843861057, 105, 2949120, 0, 2949120, 0, 1163132928,
-1279350603, 6894156, 4, 45, 0, 45, 0, 1347442003,
-844386895, 191, 2949120, 0, 2949120, 0, 1280507904, 1096238145,
-12536908, 0, 1145130067, 1280065879, 1145130067, 1280065879, 45, 0,
-163, 1380384768, 1096046913, 2968652, 0, 2949120, 0, 9306112,
-0, 1145130067, 1280065879, 1145130067, 1280065879, 45, 0, 163,
-1380384768, 1096046913, 2968652, 0, 2949120, 0, 9306112, 0,
-1145130067, 1280065879, 1145130067, 1280065879, 45, 0, 144, 1380384768,
-1096046913, 2968652, 0, 2949120, 0, 9306112, 0, 1145130067,
-1280065879, 1145130067, 1280065879, 45, 0, 144, 1380384768, 1096046913,
-2968652, 0, 2949120, 0, 9306112, 0, 1145130067, 1280065879,
-1145130067, 1280065879, 45, 0, 141, 1380384768, 1096046913, 2968652,
-0, 2949120, 0, 9306112, 0, 1145130067, 1280065879, 1145130067,
-1280065879, 45, 0, 141, 1380384768, 1096046913, 2968652, 0,
-2949120, 0, 9306112, 0, 1145130067, 1280065879, 1145130067, 1280065879,
-45, 0, 141, 1380384768, 1096046913, 2968652, 0, 2949120,
-0, 9306112, 0, 1145130067, 1280065879, 1145130067, 1280065879, 45,
-0, 141, 1380384768, 1096046913, 2968652, 0, 2949120, 0,
-9306112, 0, 1145130067, 1280065879, 1145130067, 1280065879, 45, 0,
-141, 1380384768, 1096046913, 2968652, 0, 2949120, 0, 9306112,
-7864320, 1145130067, 1280065879, 1162564942, 1145130067, 45, 0, 142,
-1280507904, 1096238145, 1431194700, 1280525643, 2966593, 0, 9371648, 0,
-1380013139, 827212116, 1413565520, 49, 45, 0, 178, 1414725632,
-1096045121, 1280323918, 3232833, 2949120, 0, 11796480, 0, 45,
-0, 45, 0, 1145130067, 1280065879, 262287, 2949120, 0,
-2949120, 0, 1431502848, 1380929616, 9384532, 0, 45, 0,
-45, 0, 1380929348, 4474194, 38, 2949120, 0, 2949120,
-0, 1329856512, 1163022927, 2490436, 0, 45, 0, 45,
-0, 1380929348, 4474194, 38, 2949120, 0, 2949120, 0,
-1329856512, 1163022927, 2490436, 0, 45, 0, 45, 0,
-1145130067, 1280065879, 144, 2949240, 0, 2949120, 0, 1280507904,
-1096238145, 9325644, 0, 45, 0, 45, 0, 1145130067,
-1280065879, 144, 2949120, 0, 2949120, 0, 1280507904, 1330660417,
-9458505, 0, 45, 0, 45, 0, 1145130067, 1280065879,
-163, 2949120, 0, 2949120, 0, 1280507904, 1330660417, 10703689,
-0, 45, 0, 45, 0, 1145130067, 1280065879, 163,
-2949120, 0, 2949120, 0, 1280507904, 1096238145, 9260108, 0,
-45, 0, 45, 0, 1145130067, 1397313360, 141, 1480916992,
-1230197833, 2969159, 0, 2949120, 0, 2818048, 0, 45,
-0, 1347442003, 844386895, 45, 0, 2097203, 1480916992, 1230197833,
-2969159, 0, 2949120, 0, 2818048, 0, 45, 0,
-1347442003, 844386895, 45, 0, 51, 1480916992, 1230197833, 2969159,
-0, 2949120, 0, 2818048, 0, 45, 0, 1347442003,
-844386895, 45, 0, 2097203, 1480916992, 1230197833, 2969159, 0,
-2949120, 0, 2818048, 0, 45, 0, 1347442003, 844386895,
-45, 0, 51, 2949120, 0, 1431502848, 1380929616, 2962004,
-0, 3145728, 0, 1464550740, 843861057, 45, 0, 45,
-0, 18874417, 2949120, 0, 2949120, 0, 1414725632, 1096045121,
-5386830, 216, 45, 0, 45, 0, 1380013139, 843989332,
-9437265, 2949120, 0, 2949120, 0, 1414725632, 1096045121, 5255758,
-72, 45, 0, 45, 0, 1380013139, 843989332, 79,
-2949120, 0, 2949120, 0, 1414725632, 1096045121, 5059150, 0,
-45, 0, 45, 0, 1380013139, 843989332, 4718674, 2949120,
-0, 2949120, 0, 1414725632, 1096045121, 5321294, 144, 45,
-0, 45, 0, 1380013139, 843989332, 14155856, 2949120, 0,
-2949120, 0, 1414725632, 1096045121, 5190222, 288, 45, 0,
-45, 0, 1380013139, 843989332, 262221, 1414725632, 1096045121, 1414738510,
-3493957, 2949120, 0, 5308416, 0, 1497453127, 1280065876, 45,
-0, 45, 0, 262226, 1414725632, 1096045121, 1414738510, 3493957,
-2949120, 0, 5242880, 0, 1497453127, 1280065876, 45, 0,
-45, 0, 262225, 1414725632, 1096045121, 1414738510, 3493957, 2949120,
-0, 5177344, 0, 1497453127, 1280065876, 45, 0, 45,
-0, 262224, 1414725632, 1096045121, 1414738510, 3493957, 2949120, 0,
-5046272, 0, 1497453127, 1280065876, 45, 0, 45, 0,
-262223, 1414725632, 1096045121, 1414738510, 3493957, 2949120, 0, 4980736,
-0, 1380013139, 843989332, 45, 0, 45, 0, 77,
-2949120, 0, 2949120, 0, 1380057088, 827217743, 131072, 0,
-45, 0, 1346720851, 53, 45, 0, 9, 1380384768,
-1096046913, 2968652, 0, 2949120, 0, 655360, 0, 45,
-0, 45, 0, 1380013139, 843989332, 10, 2949120, 0,
-2949120, 0, 1431502848, 1380929616, 668244, 48, 45, 0,
-45, 0, 1380013139, 843989332, 10, 2949120, 0, 2949120,
-0, 1431502848, 1380929616, 668244, 288, 45, 0, 45,
-0, 1380013139, 843989332, 14155785, 2949120, 0, 2949120, 0,
-1414725632, 1096045121, 537166, 144, 45, 0, 45, 0,
-1380013139, 843989332, 4718599, 2949120, 0, 2949120, 0, 1414725632,
-1096045121, 406094, 0, 45, 0, 45, 0, 1380013139,
-843989332, 5, 2949120, 0, 2949120, 0, 1414725632, 1096045121,
-602702, 72, 45, 0, 45, 0, 1380013139, 843989332,
-9437192, 2949120, 0, 2949120, 0, 1414725632, 1096045121, 471630,
-216, 45, 0, 45, 0, 1380013139, 843989332, 18874374,
-2949120, 0, 2949120, 0, 1414725632, 1096045121, 340558, 0,
-45, 0, 1346720851, 53, 45, 0, 8, 1380384768,
-1096046913, 2968652, 0, 2949120, 0, 589824, 0, 45,
-0, 1346720851, 53, 45, 0, 7, 1380384768, 1096046913,
-2968652, 0, 2949120, 0, 524288, 0, 45, 0,
-1346720851, 53, 45, 0, 6, 1380384768, 1096046913, 2968652,
-0, 2949120, 0, 458752, 0, 45, 0, 1346720851,
-53, 45, 0, 5, 1380384768, 1096046913, 2968652, 0,
-2949120, 0, 393216, 0, 45, 0, 1346720851, 53,
-45, 0, 4, 1414725632, 1096045121, 2961998, 0, 2949120,
-0, 327680, 4, 45, 0, 45, 0, 1347442003,
-844386895, 76, 2949120, 0, 2949120, 0, 1414725632, 1096045121,
-4993614, 0, 45, 0, 45, 0, 1380013139, 843989332,
-262220, 2949120, 0, 2949120, 0, 1431502848, 1380929616, 4993620,
-4, 45, 0, 45, 0, 1347442003, 844386895, 4,
-2949120, 0, 2949120, 0, 1414725632, 1096045121, 275022, 0,
-45, 0, 45, 0, 1380013139, 843989332, 262148, 2949120,
-0, 2949120, 0, 1431502848, 1380929616, 275028, 524352, 45,
-0, 45, 0, 1380013139, 843989332, 64, 2949120, 0,
-2949120, 0, 1431502848, 1380929616, 4207188, 1048800, 45, 0,
-45, 0, 1380013139, 843989332, 14, 2949120, 0, 2949120,
-0, 1431502848, 1380929616, 930388, 0, 45, 0, 45,
-0, 1380013139, 843989332, 3145883, 2949120, 0, 2949120, 0,
-1414725632, 1096045121, 10236494, 96, 45, 0, 45, 0,
-1380013139, 843989332, 9437341, 2949120, 0, 2949120, 0, 1414725632,
-1096045121, 10367566, 192, 45, 0, 45, 0, 1380013139,
-843989332, 15728798, 2949120, 0, 2949120, 0, 1414725632, 1096045121,
-10302030, 288, 45, 0, 45, 0, 1380013139, 843989332,
-22020252, 2949120, 0, 2949120, 0, 1414725632, 1096045121, 10170958,
-192, 45, 0, 45, 0, 1380013139, 843989332, 15728799,
-2949120, 0, 2949120, 0, 1414725632, 1096045121, 10498638, 96,
-45, 0, 45, 0, 1380013139, 843989332, 9437344, 2949120,
-0, 2949120, 0, 1414725632, 1096045121, 10433102, 0, 45,
-0, 1346720851, 54, 45, 0, 155, 1414725632, 1096045121,
-2961998, 0, 2949120, 0, 10223616, 0, 45, 0,
-1346720851, 54, 45, 0, 156, 1414725632, 1096045121, 2961998,
-0, 2949120, 0, 10289152, 0, 45, 0, 1346720851,
-54, 45, 0, 157, 1414725632, 1096045121, 2961998, 0,
-2949120, 0, 10354688, 0, 45, 0, 1346720851, 54,
-45, 0, 158, 1414725632, 1096045121, 2961998, 0, 2949120,
-0, 10420224, 0, 45, 0, 1346720851, 54, 45,
-0, 159, 1414725632, 1096045121, 2961998, 0, 2949120, 0,
-10485760, 0, 45, 0, 1346720851, 54, 45, 0,
-160, 1414725632, 1096045121, 2961998, 0, 2949120, 0, 10551296,
-0, 45, 0, 45, 0, 1380013139, 843989332, 262298,
-2949120, 0, 2949120, 0, 1431502848, 1380929616, 10105428, 0,
-45, 0, 45, 0, 1145130067, 1280065879, 141, 2949120,
-0, 2949120, 0, 1280507904, 1096238145, 9260108, 0, 45,
-0, 45, 0, 1145130067, 1280065879, 141, 2949120, 0,
-2949120, 0, 1280507904, 1096238145, 9391180, 0, 45, 0,
-45, 0, 1145130067, 1280065879, 262325, 2949120, 0, 2949120,
-0, 1431502848, 1380929616, 11874900, 0, 45, 0, 45,
-0, 1145130067, 1280065879, 181, 2949120, 0, 2949120, 0,
-1280507904, 1096238145, 11947084, 4, 45, 0, 45, 0,
-1347442003, 844386895, 182, 2949120, 0, 2949120, 0, 1414725632,
-860312129, 6422528, 0, 45, 0, 45, 0, 1347442003,
-844386895, 98, 2949120, 0, 2949120, 0, 1431502848, 1380929616,
-6435412, 0, 45, 0, 45, 0, 1380013139, 13127,
-98, 2949120, 0, 2949120, 0, 1380057088, 827217743, 8388608,
-0, 45, 0, 45, 0, 1464816194, 12622, 128,
-2949120, 0, 2949120, 0, 1380057088, 827217743, 8388608, 0,
-45, 0, 45, 0, 1464816194, 12622, 262272, 2949120,
-0, 2949120, 0, 1431502848, 1380929616, 8335956, 0, 45,
-0, 45, 0, 1464816194, 12622, 127, 2949120, 0,
-2949120, 0, 1380057088, 827217743, 8323072, 4, 45, 0,
-45, 0, 1347442003, 844386895, 262271, 2949120, 0, 2949120,
-0, 1431502848, 1380929616, 12989012, 0, 45, 0, 45,
-0, 1145130067, 1280065879, 198, 2949120, 0, 2949120, 0,
-1280507904, 1096238145, 12995660, 4, 45, 0, 45, 0,
-1347442003, 844386895, 8388806};
+33227219, 1, 0, 30605311, 66003, 0, 4294901761, 38666324,
+1, 131072, 33357823, 66004, 0, 4294901763, 26739156, 1,
+262144, 25165823, 65996, 0, 4294901765, 6226062, 1, 393216,
+6225919, 65619, 0, 4294901767, 33096182, 1, 524288, 30867455,
+393685, 0, 655369, 9306256, 1, 720896, 29163519, 65979,
+0, 4294901772, 24707448, 1, 851968, 24772607, 65929, 0,
+4294901774, 29163962, 1, 983040, 25559039, 65930, 0, 4294901776,
+46662343, 1, 1114112, 46399487, 66247, 0, 4294901778, 29688260,
+1, 1245184, 29622271, 65994, 0, 4294901780, 47448787, 1,
+1376256, 47579135, 66262, 0, 4294901782, 46531262, 1, 1507328,
+46596095, 66239, 0, 4294901784, 46138047, 1, 1638400, 46202879,
+66250, 0, 4294901786, 46990026, 1, 1769472, 47054847, 66309,
+0, 4294901788, 50725637, 1, 1900544, 50790399, 66258, 0,
+4294901790, 49152737, 1, 2031616, 49741823, 66295, 0, 4294901792,
+58852061, 1, 2162688, 48037887, 66269, 0, 4294901794, 49021844,
+1, 2293760, 60030975, 66452, 0, 4294901796, 59966354, 1,
+2424832, 49414143, 66287, 0, 4294901798, 49349356, 1, 2555904,
+48168959, 66268, 0, 4294901800, 48104175, 1, 2686976, 49545215,
+66276, 0, 4294901802, 48562916, 1, 2818048, 48627711, 66278,
+0, 4294901804, 28312312, 1, 2949120, 28377087, 65932, 0,
+4294901806, 26018188, 1, 3080192, 26083327, 65970, 0, 4294901808,
+28508594, 1, 3211264, 28573695, 65974, 0, 4294901810, 28770742,
+1, 3342336, 48693247, 66298, 0, 4294901812, 49677050, 1,
+3473408, 27787263, 66299, 0, 4294901814, 50070267, 1, 3604480,
+50135039, 66293, 0, 4294901816, 48694005, 1, 3735552, 48758783,
+66280, 0, 4294901818, 48825064, 1, 3866624, 48889855, 66453,
+0, 4294901820, 59835285, 1, 3997696, 59441151, 66435, 0,
+4294901822, 58721155, 1, 4128768, 58785791, 66433, 0, 4294901824,
+47842177, 1, 4259840, 47906815, 66267, 0, 4294901826, 26345865,
+1, 4390912, 26411007, 65939, 0, 4294901828, 26476947, 1,
+4521984, 26542079, 65941, 0, 4294901830, 33489301, 1, 4653056,
+33554431, 66050, 0, 4294901832, 33751554, 1, 4784128, 33816575,
+66052, 0, 4294901834, 25559432, 1, 4915200, 28966911, 65961,
+0, 4294901836, 27591081, 1, 5046272, 27656191, 65951, 0,
+4294901838, 25690538, 1, 5177344, 28114943, 65965, 0, 4294901840,
+28049921, 1, 5308416, 33947647, 66049, 0, 4294901842, 33882631,
+1, 5439488, 35717119, 66055, 0, 4294901844, 27263391, 1,
+5570560, 27328511, 66084, 0, 4294901846, 35127844, 1, 5701632,
+27394047, 65954, 0, 4294901848, 27460002, 1, 5832704, 27525119,
+65958, 0, 4294901850, 27722150, 1, 5963776, 33882111, 66058,
+0, 4294901852, 34275850, 1, 6094848, 34340863, 66060, 0,
+4294901854, 35324447, 1, 6225920, 35848191, 66080, 0, 4294901856,
+49480430, 1, 6356992, 24903679, 786808, 0, 6488162, 45286066,
+1, 6553600, 26935295, 393679, 0, 6684773, 31982031, 1,
+6750208, 32047103, 66032, 0, 4294901864, 32899568, 1, 6881280,
+32767999, 66029, 0, 4294901866, 31654381, 1, 7012352, 31719423,
+66010, 0, 4294901868, 30999002, 6, 7143424, 59441262, 1115030,
+0, 4294901871, 59310984, 9, 7340032, 60293119, 1115018, 0,
+4294901873, 31195723, 1, 7471104, 58589183, 66455, 0, 4294901875,
+32702964, 4, 7602176, 32964725, 262644, 0, 7798902, 32965110,
+4, 7864320, 32374905, 262637, 0, 8061050, 32375281, 4,
+8126464, 32505981, 262641, 0, 8323198, 31654375, 4, 8388608,
+32243841, 262631, 0, 8585346, 32244200, 4, 8650752, 60096645,
+4981652, 0, 8847494, 58131318, 9, 8912896, 6094847, 1114277,
+0, 4294901897, 10027203, 1, 9043968, 10092543, 1114267, 0,
+4294901899, 10223771, 1, 9175040, 50987007, 65693, 0, 4294901901,
+10092701, 17, 9306112, 10289151, 65694, 0, 4294901903, 12845210,
+1, 9437184, 10092543, 262298, 0, 9568401, 10158237, 4,
+9633792, 6619284, 1114205, 0, 4294901909, 6094940, 4, 9830400,
+8978583, 197071, 0, 4294901912, 6815851, 3, 10027008, 33226751,
+66035, 0, 4294901914, 8912998, 3, 10158080, 6881279, 196713,
+0, 4294901916, 6160479, 14, 10289152, 8978590, 393676, 0,
+10485919, 6684777, 12, 10551296, 7930018, 262266, 0, 10748067,
+8126587, 12, 10813440, 8126630, 65658, 0, 4294901927, 6684794,
+1, 11010048, 6946815, 65657, 0, 4294901929, 8061049, 1,
+11141120, 30212095, 262288, 0, 11272363, 33161721, 12, 11337728,
+8192174, 262270, 0, 11534511, 8126590, 1, 11599872, 8126463,
+65661, 0, 4294901938, 7012943, 3, 11730944, 38731775, 1245771,
+0, 4294901940, 38470220, 6, 11862016, 38666422, 918095, 0,
+12058807, 38732364, 19, 12124160, 36438015, 65664, 0, 4294901946,
+36438141, 1, 12255232, 24903679, 65978, 0, 4294901948, 24641979,
+1, 12386304, 46071807, 262523, 0, 12517566, 47645398, 1,
+12582912, 47710207, 66238, 0, 4294901953, 25821909, 4, 12713984,
+25493699, 262534, 0, 12910788, 25690505, 4, 12976128, 46661831,
+65915, 0, 4294901960, 47382922, 1, 13172736, 52953087, 66338,
+0, 4294901962, 44696233, 1, 13303808, 39124991, 262752, 0,
+13435084, 40108640, 1, 13500416, 42401791, 66183, 0, 4294901967,
+42467975, 4, 13631488, 44695761, 1835702, 0, 13828306, 39649884,
+4063236, 13893643, 53674197, 590644, 0, 4294901974, 39912031, 1,
+14090240, 42598399, 66186, 0, 4294901976, 40764013, 1, 14221312,
+39976959, 66144, 0, 4294901978, 40698467, 1, 14352384, 40828927,
+66149, 0, 4294901980, 42533511, 1, 14483456, 42663935, 66184,
+0, 4294901982, 50332415, 12, 14614528, 60358880, 590747, 0,
+4294901985, 61080475, 9, 14811136, 53542911, 590641, 0, 4294901987,
+53412658, 9, 14942208, 53870591, 1114930, 0, 4294901989, 54068024,
+17, 15073280, 54132735, 1114933, 0, 4294901991, 29098429, 4,
+15204352, 29163753, 65982, 0, 4294901994, 29098431, 1, 15400960,
+29032447, 262587, 0, 15532268, 29295038, 6, 15597568, 58130671,
+263032, 0, 15794416, 59048836, 4, 15859712, 59113715, 263047,
+0, 16056564, 59245446, 4, 16121856, 60358903, 263066, 0,
+16318712, 60556187, 4, 16384000, 60489979, 263070, 0, 16580860,
+61146020, 4, 16646144, 61210879, 263079, 0, 16843008, 61408168,
+4, 16908288, 61473027, 787240, 0, 17105156, 52953897, 4,
+17170432, 53084423, 262955, 0, 17367304, 53281580, 4, 17432576,
+53346571, 262959, 0, 17629452, 59179913, 9, 17694720, 59244543,
+590725, 0, 4294902031, 58196869, 9, 17825792, 58195967, 590724,
+0, 4294902033, 59114372, 9, 17956864, 59179007, 590745, 0,
+4294902035, 59245466, 9, 18087936, 60751871, 590751, 0, 4294902037,
+61277097, 9, 18219008, 61341695, 590757, 0, 4294902039, 60687269,
+9, 18350080, 61145087, 590758, 0, 4294902041, 61342630, 9,
+18481152, 61538303, 590765, 0, 4294902043, 53019565, 9, 18612224,
+53477375, 590637, 0, 4294902045, 53150509, 9, 18743296, 53215231,
+590632, 0, 4294902047, 53084969, 9, 18874368, 53149695, 590636,
+0, 4294902049, 53347116, 9, 19005440, 53411839, 590640, 0,
+4294902051, 21496140, 13, 19136512, 21889317, 852300, 0, 19333414,
+21889323, 13, 19398656, 19792169, 65836, 0, 4294902058, 19792177,
+1, 19595264, 21299199, 65869, 0, 4294902060, 21954893, 1,
+19726336, 22020095, 65833, 0, 4294902062, 19530025, 1, 19857408,
+19922943, 65842, 0, 4294902064, 21496132, 4, 19988480, 21823794,
+262476, 0, 20185395, 21889359, 4, 20250624, 19464502, 262443,
+0, 20447543, 19661098, 4, 20512768, 19857722, 262446, 0,
+20709691, 19988786, 4, 20774912, 2294078, 852004, 0, 20971839,
+2490404, 13, 21037056, 2490690, 852008, 0, 21233987, 2949163,
+9, 21299200, 3014655, 589872, 0, 4294902086, 3014705, 1,
+21430272, 2818047, 65577, 0, 4294902088, 2555945, 1, 21561344,
+2621439, 65573, 0, 4294902090, 2097189, 1, 21692416, 3211263,
+262193, 0, 21823820, 3014701, 4, 21889024, 2818383, 262186,
+0, 22085968, 2687016, 4, 22151168, 2490707, 262183, 0,
+22348116, 2424868, 4, 22413312, 2294103, 262176, 0, 22610264,
+65536, 1, 22675456, 18939903, 65825, 0, 4294902107, 131073,
+17, 22806528, 18677759, 1114400, 0, 4294902109, 18678049, 17,
+22937600, 262143, 1114112, 0, 4294902111, 131075, 29, 23068672,
+18612577, 1900829, 0, 23265634, 19071266, 29, 23330816, 19136869,
+65829, 0, 4294902118, 327684, 17, 23527424, 393215, 65827,
+0, 4294902120, 19267874, 1, 23658496, 19333119, 1114404, 0,
+4294902122, 21299524, 12, 23789568, 19202412, 65540, 0, 4294902125,
+8519820, 5767180, 23986180, 36766063, 786994, 262232, 24183152, 36766255,
+1, 24248320, 23265279, 262499, 1, 24379763, 23265643, 17,
+24444928, 23265279, 1114476, 0, 4294902134, 26935704, 1, 24576000,
+34668543, 66074, 0, 4294902136, 35586584, 1, 24707072, 35323903,
+65953, 0, 4294902138, 40043106, 1, 24838144, 40173567, 262754,
+0, 24969596, 40436328, 1, 25034752, 40566783, 66155, 0,
+4294902143, 40501888, 1, 25165824, 40501247, 66156, 0, 4294902145,
+42271333, 1, 25296896, 42336255, 262790, 0, 25428355, 41943681,
+1, 25493504, 41746431, 66178, 0, 4294902150, 41747052, 1,
+25624576, 25296895, 262544, 65624, 25756040, 26280336, 1, 25821184,
+26345471, 65922, 0, 4294902155, 25100670, 1, 25952256, 25296895,
+786818, 65598, 26083725, 25166235, 1, 26148864, 25231359, 262526,
+65624, 26280336, 27001217, 1, 26345472, 27066367, 65949, 0,
+4294902163, 26214813, 1, 26476544, 33292287, 66045, 0, 4294902165,
+34079229, 17, 26607616, 34144255, 66057, 0, 4294902167, 33423881,
+17, 26738688, 33488895, 66044, 0, 4294902169, 33423869, 4,
+26869760, 23789979, 262508, 1, 27066780, 983060, 65540, 27131904,
+5702047, 1114127, 0, 4294902176, 5963796, 17, 27328512, 5767167,
+262235, 1, 27460002, 20250672, 1, 27525120, 851967, 65618,
+0, 4294902181, 22872146, 1, 27656192, 31064063, 393701, 0,
+27787687, 30802405, 6, 27852800, 30736810, 393706, 0, 28049835,
+26870250, 6, 28114944, 25362862, 65918, 0, 4294902191, 25362818,
+1, 28311552, 25231359, 65924, 0, 4294902193, 25231748, 1,
+28442624, 5505023, 786516, 0, 28574131, 19399132, 1, 28639232,
+23986175, 66002, 0, 4294902198, 23921004, 1, 28770304, 19464191,
+65899, 0, 4294902200, 5505113, 1, 28901376, 5505023, 65626,
+0, 4294902202, 5701722, 17, 29032448, 6029311, 1114201, 0,
+4294902204, 36504108, 1, 29163520, 8454143, 65665, 0, 4294902206,
+8257665, 1, 29294592, 33161215, 66094, 0, 4294902208, 36635182,
+1, 29425664, 36569087, 66096, 0, 4294902210, 33161776, 1,
+29556736, 8978431, 196745, 0, 4294902212, 37028404, 1, 29687808,
+37093375, 262706, 0, 29819334, 37225015, 4063236, 29884420, 9241033,
+65669, 0, 4294902218, 8781957, 1, 30081024, 8847359, 65666,
+0, 4294902220, 37290549, 1, 30212096, 37421055, 66098, 0,
+4294902222, 37356088, 1, 30343168, 37355519, 66103, 0, 4294902224,
+36962870, 1, 30474240, 36831231, 66102, 0, 4294902226, 36897330,
+1, 30605312, 36962303, 66091, 0, 4294902228, 9240716, 1,
+30736384, 37224447, 66107, 0, 4294902230, 9175611, 1, 30867456,
+37552127, 66104, 0, 4294902232, 37486722, 1, 30998528, 31129599,
+197197, 0, 4294902234, 38535757, 65574, 31129600, 38601180, 1245777,
+0, 4294902237, 38535760, 19, 31326208, 37617663, 1245758, 0,
+4294902239, 37683774, 19, 31457280, 7274495, 1245295, 0, 4294902241,
+7340143, 19, 31588352, 7405567, 1245297, 0, 4294902243, 38863440,
+65542, 31719424, 37945829, 393330, 0, 31916518, 38339135, 11,
+31981568, 38404095, 1245770, 327783, 4294902249, 7209546, 11, 32112640,
+38404095, 393797, 0, 32244203, 38142533, 6, 32309248, 38142446,
+393799, 0, 32506351, 38273607, 6, 32571392, 38273522, 393802,
+0, 32768499, 37552704, 19, 32833536, 7471103, 1245761, 0,
+4294902262, 38797889, 19, 32964608, 38928383, 1245760, 0, 4294902264,
+37749313, 14, 33095680, 37683706, 393794, 0, 33292795, 37945922,
+6, 33357824, 7471614, 393331, 0, 33554943, 7209075, 6,
+33619968, 38273538, 393331, 0, 33817091, 38076994, 6, 33882112,
+6291974, 65628, 0, 4294902279, 6357085, 1, 34078720, 6422527,
+65630, 0, 4294902281, 6291551, 1, 34209792, 7864319, 196725,
+0, 4294902283, 7733365, 3, 34340864, 7798783, 196728, 0,
+4294902285, 5570680, 3, 34471936, 5636095, 196694, 0, 4294902287,
+7077974, 3, 34603008, 7143423, 196717, 0, 4294902289, 7798893,
+3, 34734080, 9830399, 196746, 0, 4294902291, 9109642, 3,
+34865152, 9175039, 196756, 0, 4294902293, 9830548, 3, 34996224,
+9895935, 196754, 0, 4294902295, 9633938, 3, 35127296, 9699327,
+196759, 0, 4294902297, 9765015, 3, 35258368, 24510463, 262518,
+0, 35389979, 24510790, 1, 35454976, 21364735, 65862, 0,
+4294902302, 24576373, 1, 35586048, 24641535, 65860, 0, 4294902304,
+22085973, 1, 35717120, 20578303, 65850, 0, 4294902306, 21561672,
+13, 35848192, 21561892, 65866, 0, 4294902309, 21561681, 1,
+36044800, 22347775, 65877, 0, 4294902311, 21692746, 1, 36175872,
+21757951, 852293, 0, 36307497, 22282582, 29, 36372480, 21692972,
+65876, 0, 4294902317, 21299542, 1, 36569088, 23003135, 65887,
+0, 4294902319, 20513067, 1, 36700160, 22151167, 1900857, 0,
+36831793, 20119858, 1, 36896768, 20185087, 65820, 0, 4294902324,
+20185090, 1, 37027840, 20250623, 65585, 0, 4294902326, 19988790,
+1, 37158912, 20447231, 65846, 0, 4294902328, 4784437, 1,
+37289984, 4849663, 1900616, 0, 37421626, 21102664, 1, 37486592,
+21168127, 1900867, 0, 37618237, 20447555, 1, 37683200, 20512767,
+1900855, 0, 37814848, 20709691, 29, 37879808, 20775491, 1900862,
+0, 38076996, 4325441, 29, 38141952, 4784711, 65602, 0,
+4294902344, 20382011, 1, 38338560, 20512767, 65852, 0, 4294902346,
+21168445, 1, 38469632, 21168127, 65854, 0, 4294902348, 4718657,
+1, 38600704, 20643839, 65851, 0, 4294902350, 5111874, 1,
+38731776, 20774911, 65855, 0, 4294902352, 20775231, 1, 38862848,
+20905983, 65603, 0, 4294902354, 4259907, 1, 38993920, 19136511,
+65822, 0, 4294902356, 196894, 1, 39124992, 18743295, 65823,
+0, 4294902358, 19005727, 1, 39256064, 5177343, 65615, 0,
+4294902360, 2621519, 1, 39387136, 5242879, 1900624, 0, 39518810,
+3997756, 9, 39583744, 4063231, 852003, 0, 39715421, 5242941,
+1, 39780352, 5308415, 65617, 0, 4294902368, 3735608, 28,
+39911424, 2032226, 65598, 0, 4294902371, 3735614, 1, 40108032,
+4128767, 1835071, 0, 40239717, 4128824, 1, 40304640, 3801087,
+65545, 0, 4294902376, 655369, 1, 40435712, 720895, 65548,
+0, 4294902378, 3932224, 36, 40566784, 4194924, 65594, 0,
+4294902381, 3670074, 1, 40763392, 4194303, 589888, 0, 4294902383,
+2097183, 12, 40894464, 3867249, 3407930, 31, 41091698, 3866705,
+1, 41156608, 3932159, 65596, 0, 4294902389, 3801142, 20,
+41287680, 3867255, 1310775, 0, 41484920, 3276855, 20, 41549824,
+3342971, 1310774, 0, 41747068, 3342386, 4, 41811968, 3605119,
+262198, 0, 42009216, 4521994, 4, 42074112, 4522627, 262214,
+0, 42271364, 22151238, 4, 42336256, 30868103, 197080, 0,
+4294902408, 31392216, 3, 42532864, 31457279, 197088, 0, 4294902410,
+31261152, 3, 42663936, 31326207, 197086, 0, 4294902412, 31523294,
+3, 42795008, 31588351, 197090, 0, 4294902414, 30867938, 3,
+42926080, 22937599, 65889, 0, 4294902416, 23069025, 1, 43057152,
+30277631, 1114577, 0, 4294902418, 29491664, 1, 43188224, 10420223,
+65695, 0, 4294902420, 10551456, 17, 43319296, 29294591, 65984,
+0, 4294902422, 29557184, 17, 43450368, 29556735, 1114561, 0,
+4294902424, 29295041, 1, 43581440, 30277631, 262305, 28, 43713178,
+30474400, 1835012, 43778048, 29491869, 2490819, 0, 43975326, 29426112,
+2031620, 44040192, 10683041, 65635, 0, 4294902434, 6553699, 1,
+44236800, 10813439, 65699, 0, 4294902436, 10748069, 1, 44367872,
+6619135, 65637, 0, 4294902438, 10485919, 1, 44498944, 30539775,
+66000, 0, 4294902440, 35389979, 1, 44630016, 35454975, 66077,
+0, 4294902442, 35521053, 1, 44761088, 35586047, 66082, 0,
+4294902444, 48169691, 1, 44892160, 48234495, 66261, 0, 4294902446,
+48431842, 1, 45023232, 48496639, 66272, 0, 4294902448, 48300768,
+1, 45154304, 48496639, 787157, 0, 45286066, 48235231, 12,
+45350912, 28770997, 65972, 0, 4294902454, 25493940, 1, 45547520,
+25624575, 65973, 0, 4294902456, 28901813, 1, 45678592, 28704767,
+786868, 0, 45810362, 28901815, 12, 45875200, 49742525, 66297,
+0, 4294902462, 50135801, 1, 46071808, 50200575, 66274, 0,
+4294902464, 50201300, 1, 46202880, 50266111, 66296, 0, 4294902466,
+50135806, 12, 46333952, 49873604, 787192, 0, 46531269, 28180909,
+1, 46596096, 28246015, 65963, 0, 4294902472, 27918763, 1,
+46727168, 26476543, 786859, 0, 46858954, 26476974, 12, 46923776,
+34734797, 66061, 0, 4294902478, 34472461, 1, 47120384, 34537471,
+66083, 0, 4294902480, 34734627, 1, 47251456, 59899903, 66443,
+0, 4294902482, 59376523, 3014756, 47382534, 58852052, 66444, 0,
+4294902485, 59573132, 37, 47579136, 59572951, 66450, 0, 4294902488,
+59638668, 1, 47775744, 59703295, 66447, 0, 4294902490, 59573135,
+1, 47906816, 48103423, 4981632, 0, 48038620, 60294038, 17,
+48103424, 60358655, 66430, 0, 4294902495, 60294039, 65572, 48234496,
+58262241, 66428, 0, 4294902498, 58524540, 1, 48431104, 46333951,
+66243, 0, 4294902500, 46269124, 1, 48562176, 46989311, 66244,
+0, 4294902502, 47252176, 1, 48693248, 47120383, 66252, 0,
+4294902504, 47055567, 1, 48824320, 47316991, 66255, 0, 4294902506,
+29753799, 4, 48955392, 29754092, 66256, 0, 4294902509, 29819602,
+1, 49152000, 53608447, 590643, 0, 4294902511, 58327929, 12,
+49283072, 58589937, 263037, 0, 49480434, 53609267, 4, 49545216,
+53936885, 1114936, 0, 4294902518, 57082676, 9, 49741824, 57147391,
+1901416, 0, 49873656, 54199144, 9, 49938432, 54263807, 1901372,
+0, 50070267, 55444284, 589841, 50135048, 55508991, 590661, 0,
+4294902526, 54920005, 28, 50266112, 54919936, 590675, 0, 4294902529,
+57279337, 29, 50462720, 54526723, 1901377, 0, 50660100, 55051079,
+29, 50724864, 55837447, 590663, 0, 4294902536, 55247688, 9,
+50921472, 55312383, 590656, 0, 4294902538, 57213761, 9, 51052544,
+57343999, 590699, 0, 4294902540, 54723435, 9, 51183616, 54788095,
+590673, 0, 4294902542, 55706449, 9, 51314688, 55771135, 590672,
+0, 4294902544, 55182160, 9, 51445760, 55246847, 590677, 0,
+4294902546, 55837525, 9, 51576832, 57147391, 590698, 0, 4294902548,
+57148265, 9, 51707904, 54263807, 590657, 0, 4294902550, 54264640,
+9, 51838976, 54919167, 590664, 0, 4294902552, 54920007, 9,
+51970048, 54788095, 9175885, 0, 52101914, 55182157, 140, 52166656,
+53871389, 1114935, 0, 4294902558, 53740342, 28, 52363264, 55968544,
+262999, 0, 52560673, 56361815, 4, 52625408, 56361764, 263008,
+0, 52822821, 55968608, 4, 52887552, 54330152, 263000, 0,
+53084969, 56165208, 4, 53149696, 56165164, 263010, 0, 53347117,
+56820578, 4, 53411840, 56820528, 263006, 0, 53609265, 56558430,
+4, 53673984, 56558388, 262974, 0, 53871413, 54330174, 4,
+53936128, 54264632, 1835839, 0, 54133561, 54854463, 28, 54198272,
+22151996, 262488, 0, 54395709, 23069016, 4, 54460416, 23069504,
+65886, 0, 4294902593, 10944678, 1, 54657024, 11010047, 65704,
+0, 4294902595, 11468968, 1, 54788096, 11534335, 65712, 0,
+4294902597, 11731120, 1, 54919168, 11796479, 65716, 0, 4294902599,
+11206836, 1, 55050240, 11272191, 65708, 0, 4294902601, 10879148,
+28, 55181312, 11928395, 262322, 0, 55378764, 11337906, 4,
+55443456, 11338575, 262318, 0, 55640912, 11927726, 4, 55705600,
+12583763, 65721, 0, 4294902612, 12452025, 6750225, 55902215, 12517375,
+65730, 0, 4294902614, 12583106, 1, 56033280, 12189695, 786618,
+0, 56165208, 12320954, 12, 56229888, 12321627, 786622, 0,
+56427356, 12779718, 1, 56492032, 11337727, 65734, 0, 4294902623,
+12910788, 1, 56623104, 12976127, 65702, 0, 4294902625, 50397952,
+1, 56754176, 50462719, 66307, 0, 4294902627, 51184394, 1,
+56885248, 50528255, 66303, 0, 4294902629, 50463489, 4, 57016320,
+50529127, 262916, 0, 57213800, 51053322, 12, 57278464, 51184491,
+262926, 0, 57475948, 51381007, 12, 57540608, 51381103, 66318,
+0, 4294902640, 51053326, 1, 57737216, 51118079, 66308, 0,
+4294902642, 50463492, 1, 57868288, 52363263, 787231, 0, 58000244,
+58000158, 1, 58064896, 58064895, 66419, 655422, 4294902647, 57475948,
+1, 58195968, 52494335, 66213, 0, 4294902649, 45023918, 1,
+58327040, 55836671, 590692, 0, 4294902651, 56951652, 28, 58458112,
+56951677, 590646, 0, 4294902654, 57607022, 29, 58654720, 57672576,
+66414, 0, 4294902657, 57410415, 1, 58851328, 56950783, 66415,
+0, 4294902659, 56951662, 1, 58982400, 44433407, 787108, 0,
+59114373, 52363940, 1, 59179008, 52690943, 66209, 0, 4294902664,
+57738093, 1, 59310080, 57737215, 263025, 655448, 59442058, 52429598,
+5767348, 59506698, 50529165, 66316, 0, 4294902670, 50987788, 1,
+59703296, 57802751, 66418, 0, 4294902672, 52429682, 1, 59834368,
+44433407, 66214, 0, 4294902674, 44499622, 1, 59965440, 43384831,
+66141, 0, 4294902676, 43385436, 1, 60096512, 43450367, 262805,
+720984, 60228502, 39518856, 1, 60293120, 39583743, 66140, 0,
+4294902681, 39453277, 1, 60424192, 39518207, 66132, 0, 4294902683,
+39453275, 5767172, 60555275, 30016413, 66311, 0, 4294902686, 50922248,
+1, 60751872, 50331647, 66312, 0, 4294902688, 50332423, 1,
+60882944, 44171263, 1835682, 0, 61014946, 43319959, 1, 61079552,
+43450367, 66200, 0, 4294902693, 43647641, 65572, 61210624, 43647911,
+66199, 0, 4294902696, 43909789, 65572, 61407232, 43844522, 1114778,
+0, 4294902699, 43909785, 17, 61603840, 43974655, 590484, 0,
+4294902701, 43844252, 9, 61734912, 43319295, 590483, 0, 4294902703,
+43778706, 9, 61865984, 43253759, 590481, 0, 4294902705, 42926737,
+9, 61997056, 42991615, 590477, 0, 4294902707, 42992270, 9,
+62128128, 43057151, 590482, 0, 4294902709, 42664589, 9, 62259200,
+42729471, 590424, 0, 4294902711, 42730073, 9, 62390272, 42795007,
+590478, 0, 4294902713, 39256664, 9, 62521344, 39256063, 590425,
+0, 4294902715, 39191122, 9, 62652416, 39321599, 590419, 0,
+4294902717, 43254428, 4, 62783488, 43123647, 262803, 0, 62981056,
+43057810, 4, 63045632, 42992579, 262799, 0, 63243204, 42795662,
+4, 63307776, 42730439, 262795, 0, 63505352, 39322201, 4,
+63569920, 39191499, 262743, 0, 63767500, 38994514, 4, 63832064,
+38994895, 590430, 0, 4294902736, 39780958, 17, 64028672, 39124991,
+1114709, 0, 4294902738, 38928981, 9, 64159744, 39845887, 262740,
+0, 64291796, 43582122, 1, 64356352, 43581439, 66203, 0,
+4294902743, 45482651, 1, 64487424, 40632319, 66150, 0, 4294902745,
+40370791, 1, 64618496, 40173567, 1114727, 0, 4294902747, 39977574,
+17, 64749568, 40304639, 262759, 0, 64881629, 42140290, 1,
+64946176, 42270719, 66177, 0, 4294902752, 42205829, 17, 65077248,
+42205183, 1114758, 0, 4294902754, 42205827, 4, 65208320, 40043492,
+262757, 786535, 65405925, 52298524, 1, 65470464, 52428799, 66333,
+0, 4294902760, 41747068, 4, 65601536, 41419754, 66164, 0,
+4294902763, 18481777, 1, 65798144, 18546687, 65817, 0, 4294902765,
+41484919, 1, 65929216, 18415615, 65819, 0, 4294902767, 41025819,
+1, 66060288, 18350079, 65816, 0, 4294902769, 18219289, 1,
+66191360, 18284543, 65799, 0, 4294902771, 16908551, 1, 66322432,
+16908287, 65800, 0, 4294902773, 18284808, 1, 66453504, 16515071,
+65793, 0, 4294902775, 16515330, 1, 66584576, 16318463, 65807,
+0, 4294902777, 17826063, 29, 66715648, 17826811, 65812, 0,
+4294902780, 15794452, 29, 66912256, 15795198, 65772, 0, 4294902783,
+15532268, 29, 67108864, 13370369, 1900749, 0, 67306498, 14352589,
+1, 67371008, 14417919, 1900764, 0, 67503109, 14155996, 1,
+67567616, 14221311, 1900761, 0, 67699720, 14221530, 1, 67764224,
+14221311, 65749, 0, 4294902795, 14418131, 1, 67895296, 14417919,
+65748, 0, 4294902797, 13107404, 1, 68026368, 14811135, 65773,
+0, 4294902799, 15728876, 1, 68157440, 18087935, 65777, 0,
+4294902801, 17957140, 1, 68288512, 17956863, 65808, 0, 4294902803,
+17367311, 1, 68419584, 18022399, 65809, 0, 4294902805, 17367313,
+29, 68550656, 18023447, 1900818, 0, 68748312, 18022640, 1,
+68812800, 13893631, 1900756, 0, 68944923, 13828309, 1, 69009408,
+14352383, 1900757, 0, 69141534, 14287109, 1, 69206016, 17235967,
+65797, 0, 4294902817, 13041876, 1, 69337088, 13107199, 65741,
+0, 4294902819, 13107399, 29, 69468160, 13108261, 65761, 0,
+4294902822, 15728865, 29, 69664768, 17368104, 65802, 0, 4294902825,
+17498378, 1, 69861376, 17563647, 65804, 0, 4294902827, 17629452,
+1, 69992448, 17694719, 65813, 0, 4294902829, 15073557, 1,
+70123520, 15138815, 65767, 0, 4294902831, 14614759, 1, 70254592,
+14680063, 65760, 0, 4294902833, 14024928, 1, 70385664, 14090239,
+65798, 0, 4294902835, 16187609, 1, 70516736, 16383999, 65786,
+0, 4294902837, 41157239, 4, 70647808, 41026615, 262769, 0,
+70845496, 18481435, 4, 70909952, 18351163, 262425, 0, 71107644,
+18219287, 4, 71172096, 17302591, 262407, 0, 71369792, 16908545,
+4, 71434240, 16450627, 786684, 0, 71631940, 16253175, 12,
+71696384, 16581703, 65790, 0, 4294902856, 16318718, 65540, 71892992,
+16385098, 65791, 0, 4294902859, 16449791, 1, 72089600, 16580607,
+65792, 0, 4294902861, 16580864, 1, 72220672, 41877503, 66172,
+0, 4294902863, 41878141, 1, 72351744, 17039359, 1114361, 0,
+4294902865, 16974071, 1, 72482816, 16711679, 1114372, 0, 4294902867,
+16253188, 1, 72613888, 17039359, 262404, 1, 72746069, 14876941,
+140, 72810496, 13173848, 9175254, 0, 73008217, 13172963, 140,
+73072640, 15402076, 786664, 852056, 73270365, 13500625, 5767180, 73334797,
+13501536, 786667, 852056, 73532513, 15270120, 1, 73596928, 15335423,
+1114346, 11, 4294902884, 13697258, 1, 73728000, 13697023, 65740,
+0, 4294902886, 13631697, 1, 73859072, 15597567, 65775, 0,
+4294902888, 15204591, 1, 73990144, 3080191, 65583, 0, 4294902890,
+2752559, 1, 74121216, 19595263, 65840, 0, 4294902892, 19857712,
+1, 74252288, 57933823, 66420, 0, 4294902894, 57672564, 1,
+74383360, 49086463, 4457193, 0, 74515568, 47907549, 68, 74579968,
+60753011, 2360220, 1, 74777716, 60818335, 17, 74842112, 61079551,
+1115036, 0, 4294902903, 60883872, 9, 74973184, 60948479, 590754,
+0, 4294902905, 61014946, 9, 75104256, 61079551, 263072, 1,
+75236475, 34800140, 1, 75300864, 34930687, 66064, 0, 4294902910,
+36045349, 65540, 75431936, 34931840, 2359830, 1, 75629697, 34931219,
+1, 75694080, 35061759, 66068, 0, 4294902916, 34996773, 17,
+75825152, 34996223, 1114662, 0, 4294902918, 36176423, 1, 75956224,
+36241407, 66089, 0, 4294902920, 36110890, 1, 76087296, 36110335,
+66090, 0, 4294902922, 35979817, 1, 76218368, 60620799, 66461,
+0, 4294902924, 60425117, 9, 76349440, 44171263, 1835812, 0,
+76481678, 52888356, 28, 76546048, 45352081, 1835701, 0, 76743826,
+45482677, 28, 76808192, 44696725, 1835691, 0, 77005974, 45679275,
+28, 77070336, 45679769, 1835706, 0, 77268122, 45810362, 28,
+77332480, 45810845, 1835680, 0, 77530270, 44040866, 28, 77594624,
+52429985, 2360179, 655422, 77792418, 44565153, 1, 77856768, 44630015,
+66212, 0, 4294902949, 10616993, 1, 77987840, 10682367, 65680,
+0, 4294902951, 30278092, 1, 78118912, 30343167, 65997, 0,
+4294902953, 45351603, 1, 78249984, 45416447, 66343, 0, 4294902955,
+45548214, 1, 78381056, 45613055, 66226, 0, 4294902957, 52757282,
+1, 78512128, 52822015, 66342, 0, 4294902959, 52626214, 1,
+78643200, 45088767, 66224, 0, 4294902961, 44630704, 1, 78774272,
+16121855, 786678, 0, 78906547, 15925494, 12, 78970880, 15926454,
+786676, 0, 79168695, 16056564, 12, 79233024, 13698234, 786664,
+852030, 79430843, 24445299, 1, 79495168, 24248319, 65907, 0,
+4294902974, 24183151, 1, 79626240, 23724031, 65903, 0, 4294902976,
+23658856, 1, 79757312, 24575999, 65908, 0, 4294902978, 24248692,
+1, 79888384, 24313855, 65904, 0, 4294902980, 23724400, 1,
+80019456, 23789567, 65893, 0, 4294902982, 24379763, 4, 80150528,
+24184008, 262514, 0, 80348361, 24117615, 4, 80412672, 23659724,
+262506, 0, 80610509, 23396712, 12, 80674816, 23004368, 65878,
+0, 4294902993, 1966109, 4, 80871424, 2163923, 65566, 0,
+4294902996, 2162720, 1, 81068032, 1966079, 65570, 0, 4294902998,
+2031650, 1, 81199104, 1835007, 65565, 0, 4294903000, 1769497,
+1, 81330176, 1572863, 65561, 0, 4294903002, 1507349, 1,
+81461248, 1114111, 65557, 0, 4294903004, 1835038, 1, 81592320,
+1900543, 65562, 0, 4294903006, 1572890, 1, 81723392, 1638399,
+65558, 0, 4294903008, 1114134, 1, 81854464, 1835007, 262172,
+0, 81986786, 1703961, 4, 82051072, 1508581, 262168, 0,
+82248934, 1441813, 4, 82313216, 1049833, 786449, 0, 82511082,
+23462245, 1, 82575360, 23527423, 65890, 0, 4294903021, 23527779,
+1, 82706432, 23592959, 65896, 0, 4294903023, 1179665, 1,
+82837504, 1245183, 65556, 0, 4294903025, 1245199, 1, 82968576,
+1310719, 65552, 0, 4294903027, 19726636, 1, 83099648, 19791871,
+65835, 0, 4294903029, 2818092, 9, 83230720, 2686975, 589868,
+0, 4294903031, 51512079, 1, 83361792, 51576831, 66324, 0,
+4294903033, 51774228, 1, 83492864, 51838975, 66328, 0, 4294903035,
+51839769, 1, 83623936, 51904511, 66325, 0, 4294903037, 51577621,
+1, 83755008, 51642367, 66320, 0, 4294903039, 52036376, 1,
+83886080, 52101119, 66332, 0, 4294903041, 52101917, 1, 84017152,
+52166655, 66329, 0, 4294903043, 51577618, 4, 84148224, 51643653,
+262933, 0, 84346118, 51839766, 4, 84410368, 51905801, 262937,
+0, 84608266, 52101914, 4, 84672512, 52167949, 262941, 0,
+84870414, 51446541, 1, 84934656, 51511295, 66319, 0, 4294903057,
+44958385, 1, 85065728, 44892159, 66225, 0, 4294903059, 44827296,
+1, 85196800, 44564479, 66208, 0, 4294903061, 58393464, 9,
+85327872, 58458111, 590713, 0, 4294903063, 58065786, 9, 85458944,
+58654719, 66431, 0, 4294903065, 58327935, 1, 85590016, 29753343,
+65992, 0, 4294903067, 29753800, 1, 85721088, 29884415, 65993,
+0, 4294903069, 29622729, 1, 85852160, 41549823, 66170, 0,
+4294903071, 41812602, 1, 85983232, 41943039, 66171, 0, 4294903073,
+41419387, 1, 86114304, 41222143, 66165, 0, 4294903075, 40960629,
+1, 86245376, 41091071, 66166, 0, 4294903077, 41353846, 1,
+86376448, 53018623, 590763, 0, 4294903079, 61408171, 9, 86507520,
+61407231, 590764, 0, 4294903081, 61473708, 9, 86638592, 65535};
+extern const uint32_t e1m1_WADSideDefs[3969] = {
+0, 0, 2490369, 0, 0, 2490369, 0, 0,
+1572865, 0, 0, 2490369, 0, 0, 2490369, 0,
+0, 2490369, 0, 0, 1572865, 0, 0, 1572865,
+16, 0, 6750209, 0, 2, 6553600, 0, 196611,
+2490368, 0, 0, 1572865, 80, 0, 6160385, 0,
+0, 5439492, 0, 0, 5439492, 0, 0, 6160385,
+0, 0, 5439492, 0, 0, 5505028, 0, 0,
+5505028, 0, 0, 6422532, 0, 0, 2359297, 0,
+0, 9502724, 0, 0, 5439492, 0, 0, 5505028,
+0, 0, 5505028, 0, 0, 5505028, 0, 0,
+5505028, 0, 0, 5505028, 0, 0, 5505028, 0,
+0, 5505028, 0, 0, 5505028, 0, 0, 5701637,
+0, 0, 5701637, 0, 0, 11993093, 192, 0,
+5701637, 0, 0, 9699333, 192, 0, 11993093, 0,
+0, 11993093, 0, 0, 5701637, 0, 0, 5701637,
+0, 0, 5701637, 192, 0, 5701637, 0, 0,
+5701637, 0, 0, 5701637, 0, 0, 5701637, 0,
+0, 5701637, 0, 0, 5701637, 0, 0, 5701637,
+0, 0, 5701637, 0, 0, 5701637, 0, 0,
+5701637, 0, 0, 5701637, 0, 0, 5701637, 0,
+0, 5701637, 0, 0, 5701637, 192, 0, 5701637,
+0, 0, 5701637, 0, 0, 5701637, 0, 0,
+5701637, 192, 0, 5701637, 0, 0, 9699333, 0,
+0, 11993093, 0, 0, 11993093, 0, 0, 11993093,
+192, 0, 9568261, 0, 0, 9568261, 0, 0,
+9568261, 0, 0, 5767172, 0, 0, 5767172, 8,
+0, 5963782, 0, 0, 5701637, 0, 0, 5701637,
+0, 0, 5701637, 0, 0, 5701637, 0, 0,
+5701637, 0, 0, 5439492, 192, 0, 5701637, 0,
+0, 5701637, 0, 0, 5701637, 0, 0, 5767172,
+0, 0, 5701637, 192, 0, 5701637, 0, 0,
+5701637, 0, 0, 5701637, 0, 0, 5701637, 0,
+0, 5701637, 0, 0, 5701637, 0, 0, 5701637,
+0, 0, 5701637, 0, 0, 5701637, 192, 0,
+5701637, 0, 0, 5701637, 192, 0, 5701637, 0,
+0, 5701637, 0, 0, 5701637, 192, 0, 5701637,
+0, 0, 5701637, 0, 0, 5701637, 0, 458756,
+5439488, 0, 8, 6094848, 0, 0, 9437193, 0,
+2, 6553600, 0, 196611, 2490368, 0, 0, 6553601,
+96, 0, 6619137, 120, 0, 6684673, 104, 0,
+6684673, 0, 0, 6619137, 24, 0, 6553601, 0,
+2, 6553600, 0, 196611, 2490368, 524288, 0, 12320777,
+0, 0, 12189705, 524288, 0, 12320777, 0, 0,
+2490369, 0, 0, 12386313, 0, 655360, 6684672, 0,
+0, 6750208, 0, 655360, 6684672, 0, 0, 6750208,
+0, 655360, 6684672, 0, 0, 6750208, 0, 655360,
+6619136, 0, 0, 6684672, 0, 655360, 6619136, 0,
+0, 6684672, 0, 655360, 6619136, 0, 0, 6684672,
+0, 655360, 6553600, 0, 0, 6619136, 0, 655360,
+6553600, 0, 0, 6619136, 0, 655360, 6553600, 0,
+0, 6619136, 0, 11, 9699328, 0, 0, 11993088,
+0, 0, 11862025, 0, 0, 1835020, 0, 0,
+2293773, 0, 0, 2424846, 0, 0, 2359297, 0,
+0, 2359297, 0, 0, 2424846, 0, 0, 2359297,
+0, 0, 2293773, 0, 196616, 2293760, 0, 0,
+2424832, 0, 196623, 2359296, 0, 0, 2424832, 0,
+0, 1835020, 0, 720897, 1769472, 0, 0, 1835008,
+0, 0, 2490369, 0, 0, 1572865, 0, 0,
+6750209, 0, 0, 1572865, 0, 0, 1572865, 0,
+1, 1572864, 0, 196611, 1769472, 0, 1, 1572864,
+0, 196611, 2490368, 0, 1048577, 1572864, 0, 0,
+1966080, 0, 1048576, 1966080, 0, 0, 2031616, 0,
+1048577, 2031616, 0, 0, 2097152, 0, 0, 2031622,
+0, 0, 1966086, 0, 0, 1966086, 0, 0,
+2031622, 0, 1, 1572864, 0, 196611, 2490368, 0,
+1, 6750208, 0, 0, 2162688, 0, 65537, 2097152,
+0, 0, 2162688, 0, 0, 2097169, 0, 0,
+2097169, 0, 0, 1572865, 0, 0, 7471122, 0,
+196627, 2490368, 0, 196611, 7471104, 0, 1, 1572864,
+0, 196611, 7471104, 0, 0, 7471122, 0, 0,
+2162708, 0, 0, 2162709, 0, 0, 6094860, 0,
+0, 6094860, 0, 1245203, 5439488, 0, 1245203, 5505024,
+0, 0, 5439492, 0, 0, 5439494, 0, 1245203,
+9502720, 0, 1245203, 5439488, 0, 1245203, 5636096, 0,
+1245203, 5439488, 0, 1245203, 5439488, 0, 1245203, 5767168,
+0, 0, 5505028, 0, 0, 9502724, 0, 0,
+10682377, 0, 0, 9240585, 0, 1441814, 7864320, 0,
+0, 7995392, 0, 0, 7864342, 0, 0, 7864342,
+0, 1441814, 7864320, 0, 0, 8519680, 7864320, 1507337,
+9306112, 0, 19, 9043968, 0, 393216, 7929856, 0,
+22, 8978432, 0, 0, 11010054, 0, 0, 7995394,
+0, 0, 8519682, 0, 0, 8192002, 0, 0,
+7995410, 0, 0, 8192018, 0, 0, 8192018, 0,
+0, 8519698, 0, 0, 8519698, 0, 1, 9830400,
+0, 458776, 2359296, 0, 0, 12517385, 0, 0,
+12779529, 0, 0, 10944521, 0, 0, 10944521, 0,
+0, 11010054, 0, 0, 11010057, 0, 0, 11010057,
+0, 458752, 6160384, 0, 8, 6225920, 32, 0,
+6225921, 48, 0, 6225921, 0, 458752, 6094848, 524288,
+1, 6160384, 0, 458771, 6225920, 0, 524296, 6291456,
+0, 458761, 11862016, 0, 1572864, 12058624, 0, 458761,
+12058624, 0, 0, 12124160, 0, 458761, 12124160, 0,
+0, 12189696, 0, 458761, 12189696, 0, 0, 12451840,
+0, 458761, 12451840, 0, 0, 12517376, 0, 458761,
+12517376, 0, 0, 12582912, 0, 458761, 12582912, 0,
+0, 12779520, 0, 458761, 12779520, 0, 0, 12845056,
+0, 458761, 12845056, 0, 0, 12910592, 0, 458761,
+12910592, 0, 0, 12976128, 0, 458761, 12976128, 0,
+9, 13041664, 0, 458761, 13041664, 0, 9, 10747904,
+0, 458761, 10747904, 0, 0, 10813440, 0, 458761,
+10813440, 0, 0, 10878976, 0, 458761, 10878976, 0,
+0, 10944512, 0, 0, 12189705, 0, 0, 12124169,
+0, 0, 12058633, 0, 0, 12058633, 0, 0,
+12124169, 0, 0, 12451849, 0, 0, 12451849, 0,
+0, 12582921, 0, 0, 12910601, 0, 0, 12845065,
+0, 0, 12779529, 0, 0, 12845065, 0, 0,
+12910601, 0, 0, 13041673, 0, 0, 13041673, 0,
+0, 10878985, 0, 0, 10813449, 0, 0, 10747913,
+0, 0, 10747913, 0, 0, 10813449, 0, 0,
+10878985, 0, 0, 10944521, 160, 65537, 4653056, 0,
+0, 4849664, 128, 65537, 4718592, 0, 0, 4849664,
+96, 65537, 4784128, 0, 0, 4849664, 32, 0,
+4259841, 0, 0, 4325377, 0, 0, 4653057, 40,
+0, 4718593, 80, 0, 4784129, 120, 0, 4194305,
+16, 0, 4325377, 4, 1638401, 4587520, 0, 0,
+4653056, 4, 1638401, 4653056, 0, 0, 4718592, 4,
+1638401, 4718592, 0, 0, 4784128, 4, 1638401, 4784128,
+0, 0, 4194304, 4, 1638401, 4194304, 0, 1,
+4259840, 4, 1638401, 4259840, 0, 0, 4325376, 4,
+1638401, 4325376, 0, 2, 4063232, 128, 65537, 720896,
+0, 0, 1507328, 160, 65537, 786432, 0, 0,
+1507328, 192, 65537, 851968, 0, 0, 1507328, 256,
+0, 983041, 288, 0, 1048577, 0, 0, 1048577,
+72, 0, 917505, 112, 0, 851969, 152, 0,
+786433, 192, 0, 720897, 0, 1638400, 1048576, 0,
+2, 4063232, 0, 1638400, 983040, 0, 0, 1048576,
+0, 1638400, 917504, 0, 1, 983040, 0, 1638400,
+851968, 0, 0, 917504, 0, 1638400, 786432, 0,
+0, 851968, 0, 1638400, 720896, 0, 0, 786432,
+0, 1638400, 1245184, 0, 0, 720896, 0, 0,
+20, 0, 0, 4128789, 0, 0, 12, 0,
+0, 4128780, 0, 0, 4128780, 0, 0, 12,
+0, 1703962, 4063232, 0, 0, 0, 0, 1703962,
+4063232, 0, 0, 4128768, 0, 1703962, 4063232, 0,
+0, 65536, 0, 0, 65556, 0, 0, 65548,
+0, 196611, 65555, 0, 196611, 65555, 0, 0,
+65548, 4, 1638401, 4521984, 0, 1, 4587520, 0,
+0, 65557, 0, 851968, 7143424, 0, 13, 2228224,
+0, 1048576, 2162688, 0, 13, 7012352, 0, 0,
+2162701, 0, 27, 4980736, 0, 0, 5111808, 0,
+0, 5111836, 0, 0, 5111836, 0, 0, 2490369,
+0, 0, 5701637, 0, 0, 5701637, 0, 0,
+5701637, 0, 0, 7864342, 0, 22, 7864320, 0,
+0, 8126464, 0, 0, 8060957, 0, 0, 8060957,
+0, 0, 8060957, 0, 0, 8060957, 0, 0,
+7864342, 0, 22, 7864320, 0, 0, 8454144, 0,
+0, 8060957, 0, 0, 8060957, 0, 0, 8060957,
+524288, 589833, 5832704, 0, 9, 5898240, 0, 0,
+5832713, 0, 0, 5832713, 0, 0, 2490369, 0,
+1966080, 5570560, 0, 31, 5832704, 0, 0, 2490369,
+524288, 0, 2490368, 0, 9, 5570560, 0, 0,
+5898249, 0, 0, 5898249, 0, 0, 5898249, 0,
+0, 2490369, 0, 0, 6815762, 0, 0, 6815776,
+0, 0, 6815762, 0, 0, 2490369, 0, 2162688,
+2490368, 0, 7, 6815744, 0, 27, 2490368, 0,
+0, 5111808, 0, 27, 262144, 0, 0, 1703936,
+0, 0, 1703964, 0, 0, 1703964, 0, 27,
+1638400, 0, 0, 1703936, 0, 0, 4063238, 0,
+0, 196642, 0, 0, 196642, 0, 2, 6553600,
+0, 196611, 2490368, 0, 2, 6553600, 0, 196611,
+2490368, 0, 2, 6553600, 0, 196611, 2490368, 0,
+2, 6553600, 0, 196611, 2490368, 0, 0, 5570566,
+0, 0, 5570569, 0, 0, 5570566, 0, 0,
+5570569, 0, 1, 1572864, 0, 0, 1638400, 0,
+0, 2490369, 0, 0, 2490369, 0, 0, 2490374,
+0, 0, 2490374, 1048576, 0, 1638401, 1048576, 0,
+1638401, 2097152, 0, 1638406, 2097152, 0, 1638406, 0,
+0, 2162694, 0, 0, 2162694, 0, 0, 2162701,
+0, 0, 2162694, 0, 0, 2162701, 0, 0,
+2162701, 0, 0, 2162694, 0, 0, 1572865, 0,
+0, 7012365, 0, 1048576, 7012352, 0, 13, 7077888,
+0, 1966080, 7077888, 0, 0, 7143424, 0, 0,
+2228237, 0, 0, 2228237, 0, 0, 2228237, 0,
+0, 7077894, 0, 0, 7077894, 40, 0, 7077901,
+0, 0, 7077901, 0, 0, 7012365, 0, 0,
+7012358, 0, 0, 2162701, 0, 0, 2162694, 0,
+0, 2228237, 8, 0, 7143437, 0, 0, 7143430,
+0, 0, 7143437, 0, 0, 7143430, 0, 0,
+2490369, 0, 13, 2490368, 0, 0, 7602176, 0,
+0, 7602204, 0, 0, 7602204, 2, 0, 1900579,
+2, 0, 1900579, 2, 0, 1900579, 2, 0,
+1900579, 2, 0, 1900579, 0, 36, 7536640, 0,
+0, 7602176, 0, 2490405, 1900544, 0, 0, 7208960,
+2, 0, 7340067, 0, 0, 7274535, 2, 0,
+7405603, 0, 2490368, 7340032, 0, 0, 7274496, 0,
+2490368, 7208960, 0, 0, 7274496, 0, 2490368, 7208960,
+0, 0, 7274496, 0, 2490368, 7208960, 0, 0,
+7274496, 0, 2490368, 7405568, 0, 0, 7274496, 2,
+0, 1900579, 2, 0, 1900579, 0, 0, 7536675,
+0, 0, 7536675, 0, 35, 1900544, 0, 0,
+7536640, 0, 2490405, 1900544, 0, 0, 7340032, 0,
+2490405, 1900544, 0, 0, 7208960, 0, 2490405, 1900544,
+0, 0, 7208960, 0, 2490405, 1900544, 0, 0,
+7405568, 0, 2490368, 7208960, 0, 0, 7405568, 0,
+2490368, 7208960, 0, 0, 7340032, 0, 0, 1769473,
+0, 0, 1769473, 0, 0, 1769478, 0, 0,
+1769478, 0, 0, 1572904, 0, 0, 1572904, 0,
+0, 1572904, 0, 0, 1572904, 0, 0, 1572904,
+0, 0, 1572904, 0, 0, 1572904, 0, 0,
+1572904, 0, 0, 1572904, 0, 0, 1572904, 0,
+0, 1572904, 0, 0, 1572904, 0, 0, 1572904,
+0, 0, 1572904, 0, 0, 1572904, 0, 0,
+1572904, 4, 1638401, 5373952, 0, 19, 4521984, 0,
+0, 4521985, 0, 0, 4521990, 48, 0, 4521985,
+0, 0, 4521990, 0, 0, 131113, 0, 0,
+131113, 192, 65537, 4587520, 0, 0, 4849664, 0,
+0, 4587526, 0, 0, 4849706, 0, 0, 131113,
+0, 0, 4587526, 0, 65537, 4587520, 0, 0,
+4915200, 0, 2687017, 131072, 0, 0, 4915200, 0,
+0, 4915242, 0, 0, 4915242, 0, 0, 131113,
+0, 0, 4849706, 0, 2687017, 131072, 0, 0,
+4849664, 0, 0, 4063238, 0, 0, 4063258, 0,
+0, 4063258, 0, 0, 4063238, 0, 0, 4063238,
+0, 0, 4063275, 24, 0, 4063275, 0, 2818091,
+4063232, 0, 0, 1441792, 0, 0, 4063275, 32,
+2818091, 4063232, 0, 0, 4456448, 32, 0, 4063275,
+0, 2818091, 4063232, 0, 0, 4390912, 0, 2687017,
+131072, 0, 0, 4390912, 0, 2687017, 131072, 0,
+0, 4456448, 0, 2687017, 131072, 0, 0, 1441792,
+0, 0, 1441834, 0, 0, 4390954, 0, 0,
+4390954, 0, 0, 4456490, 0, 0, 4456490, 0,
+0, 1441834, 0, 0, 131113, 0, 0, 131113,
+0, 0, 131113, 0, 0, 131113, 0, 0,
+131113, 0, 0, 131113, 0, 0, 4063258, 64,
+0, 4063258, 0, 0, 4063258, 32, 0, 4063258,
+0, 0, 131113, 0, 0, 1507370, 0, 2687017,
+131072, 0, 0, 1507328, 0, 0, 1245190, 32,
+65537, 1245184, 0, 0, 1507328, 0, 0, 1507370,
+0, 0, 131113, 0, 2687017, 131072, 0, 0,
+1310720, 0, 0, 1245185, 0, 0, 1310762, 24,
+65537, 1245184, 0, 0, 1310720, 0, 0, 1310762,
+0, 0, 131113, 0, 0, 131113, 0, 0,
+196642, 3670016, 65537, 1245184, 0, 393216, 1376256, 0,
+0, 1376284, 0, 0, 131113, 104, 0, 1245185,
+0, 1638400, 655360, 0, 1, 1245184, 7340032, 2687017,
+1179648, 0, 0, 1376256, 0, 0, 131113, 0,
+0, 1376284, 3145728, 2686976, 131072, 0, 393216, 1179648,
+3145728, 2686976, 131072, 0, 393216, 1179648, 3145728, 2686976,
+131072, 0, 393216, 1114112, 3145728, 2686976, 131072, 0,
+393216, 1114112, 3145728, 2686976, 131072, 0, 393216, 1114112,
+3145728, 2686976, 1114112, 0, 393216, 1179648, 0, 2228258,
+131072, 0, 0, 196608, 0, 2228258, 131072, 0,
+0, 196608, 0, 2228258, 131072, 0, 0, 196608,
+0, 0, 2490408, 0, 0, 2490408, 0, 0,
+2490408, 0, 0, 2490408, 0, 0, 2490408, 0,
+0, 2490408, 0, 0, 2490408, 0, 0, 2490408,
+0, 0, 196642, 0, 0, 196642, 0, 0,
+6488092, 0, 0, 2359297, 0, 0, 2359297, 0,
+0, 6488092, 64, 0, 6291457, 0, 0, 6357020,
+0, 0, 6357020, 0, 0, 6291457, 0, 27,
+2490368, 0, 196611, 6488064, 0, 27, 2359296, 0,
+196611, 6488064, 0, 1, 2359296, 0, 196611, 6356992,
+0, 1, 6291456, 0, 196611, 6356992, 0, 0,
+1835013, 0, 0, 1835013, 0, 0, 1835013, 0,
+0, 1835013, 0, 0, 1835013, 0, 0, 2359340,
+0, 0, 2359340, 0, 0, 5701637, 0, 0,
+5701637, 0, 0, 5701637, 192, 0, 5701637, 0,
+0, 5701637, 0, 0, 9633798, 0, 0, 9502724,
+0, 0, 9633798, 0, 0, 5701643, 0, 4,
+9502720, 0, 1245203, 9633792, 0, 1048587, 5701632, 0,
+1245203, 9633792, 0, 0, 6029318, 0, 0, 5636100,
+0, 0, 5636100, 0, 0, 6029318, 0, 4,
+5636096, 0, 1245203, 6029312, 0, 1048587, 5701632, 0,
+1245203, 6029312, 0, 0, 5701637, 0, 0, 9764870,
+0, 0, 9502724, 0, 0, 9502724, 0, 0,
+9764870, 0, 4, 9502720, 0, 1245203, 9764864, 0,
+1048587, 5701632, 0, 1245203, 9764864, 0, 0, 5701637,
+8, 0, 5963782, 0, 0, 5767172, 0, 4,
+5767168, 0, 1245203, 5963776, 0, 1048587, 5701632, 0,
+1245203, 5963776, 0, 0, 5701647, 0, 0, 5701647,
+0, 0, 5701647, 0, 0, 5701647, 0, 0,
+11993093, 0, 5, 11993088, 0, 0, 12320768, 0,
+0, 11993093, 2097216, 327685, 11993088, 0, 0, 12255232,
+64, 0, 11993093, 0, 0, 12255237, 0, 0,
+12255237, 0, 0, 12255237, 0, 5, 9568256, 0,
+0, 11993088, 524288, 0, 12320777, 0, 0, 12386313,
+524288, 9, 12386304, 0, 0, 12320768, 0, 0,
+11927561, 0, 0, 11927561, 0, 0, 5505028, 0,
+0, 5505028, 0, 0, 5505028, 0, 0, 5505028,
+0, 0, 5505028, 0, 0, 5505028, 0, 0,
+5505028, 0, 1048621, 5505024, 0, 0, 6422528, 0,
+0, 5505028, 0, 0, 5505028, 0, 0, 10944521,
+0, 9, 11862016, 0, 458752, 11927552, 0, 458761,
+12386304, 0, 0, 11927552, 0, 458761, 10944512, 0,
+0, 11010048, 0, 0, 11010057, 0, 0, 11075593,
+0, 589833, 11075584, 0, 0, 11599872, 0, 0,
+11075593, 0, 589833, 11075584, 0, 0, 11206656, 7864320,
+0, 11337774, 7340032, 0, 11337737, 0, 589833, 11075584,
+0, 0, 11272192, 0, 0, 11075593, 0, 2687017,
+11141120, 0, 0, 11599872, 0, 2687017, 11141120, 0,
+0, 11206656, 0, 2687017, 11141120, 0, 0, 11272192,
+0, 0, 11141161, 0, 0, 11141161, 0, 0,
+11141161, 0, 0, 11141161, 0, 0, 11141161, 0,
+0, 11141161, 0, 0, 11403298, 0, 0, 11403298,
+0, 0, 11403298, 0, 0, 11403298, 0, 0,
+11141161, 0, 0, 11141161, 0, 0, 11599914, 0,
+0, 11599914, 0, 0, 11206698, 0, 0, 11206698,
+0, 0, 11272234, 0, 0, 11272234, 0, 2228224,
+11141120, 0, 0, 11403264, 0, 2228224, 11141120, 0,
+0, 11403264, 0, 0, 11010057, 0, 589833, 11075584,
+0, 0, 11010048, 0, 3080192, 11468800, 0, 0,
+11534336, 0, 3080192, 11468800, 0, 0, 11534336, 0,
+3080192, 11468800, 0, 0, 11534336, 0, 3080192, 11468800,
+0, 0, 11534336, 0, 655360, 11468800, 0, 0,
+11075584, 0, 655360, 11468800, 0, 0, 11075584, 0,
+655360, 11468800, 0, 0, 11075584, 0, 655360, 11468800,
+0, 0, 11075584, 0, 655360, 11468800, 0, 0,
+11075584, 0, 655360, 11468800, 0, 0, 11075584, 0,
+655360, 11468800, 0, 0, 11075584, 0, 655360, 11468800,
+0, 0, 11075584, 0, 589833, 11075584, 0, 0,
+11337728, 0, 589833, 11075584, 0, 0, 11337728, 0,
+2228258, 131072, 0, 0, 196608, 0, 2228258, 131072,
+0, 0, 196608, 0, 0, 131113, 0, 0,
+2555927, 0, 0, 2555952, 0, 0, 2555927, 0,
+0, 2555952, 0, 0, 2555927, 0, 0, 2555952,
+0, 0, 2555927, 0, 0, 2555927, 0, 1507337,
+2555904, 0, 0, 2293760, 0, 3211264, 2555904, 0,
+0, 2621440, 0, 3211264, 2555904, 0, 0, 2621440,
+0, 3211264, 2555904, 0, 0, 2621440, 0, 3211264,
+2555904, 0, 0, 2621440, 0, 0, 2621478, 7864320,
+0, 2687026, 0, 0, 2621478, 0, 0, 2621478,
+0, 2490406, 2621440, 0, 0, 2686976, 0, 2490406,
+2621440, 0, 0, 2686976, 0, 2490406, 2621440, 0,
+0, 2686976, 0, 0, 2293773, 0, 0, 2293766,
+0, 0, 2293773, 0, 0, 2293766, 0, 0,
+9830401, 64, 0, 9895937, 0, 0, 10027009, 48,
+0, 9830401, 0, 458752, 9830400, 0, 1, 9895936,
+0, 458752, 9895936, 0, 1, 9961472, 0, 458752,
+9961472, 0, 1, 10027008, 0, 458752, 10027008, 0,
+1, 10092544, 0, 458752, 10092544, 0, 1, 10158080,
+4, 0, 10092550, 4, 0, 10027014, 0, 0,
+9961473, 24, 0, 9895937, 0, 458803, 10551296, 0,
+51, 10616832, 0, 0, 11796481, 0, 0, 11796498,
+0, 0, 11665460, 4, 0, 10616838, 0, 0,
+9240585, 0, 0, 11075593, 0, 589833, 11075584, 0,
+0, 11730944, 0, 0, 11075593, 3145728, 3407924, 11665408,
+0, 0, 11730944, 4, 0, 11665414, 0, 0,
+11665460, 0, 0, 11730986, 0, 0, 11730986, 0,
+458753, 10616832, 0, 0, 9371648, 0, 0, 10616833,
+0, 0, 10682377, 0, 0, 11665460, 0, 1966131,
+11665408, 0, 1966080, 11665408, 0, 65537, 10616832, 0,
+65537, 11796480, 0, 0, 9961473, 0, 0, 9961478,
+0, 0, 11665460, 0, 0, 11665414, 0, 0,
+9371654, 0, 0, 9371657, 0, 0, 8978454, 0,
+0, 8978454, 0, 393238, 8978432, 0, 19, 9043968,
+0, 0, 7864342, 0, 0, 7929878, 0, 0,
+7929878, 0, 0, 7864342, 0, 22, 7864320, 0,
+19, 7929856, 0, 0, 2359297, 0, 0, 2359297,
+0, 0, 2359302, 0, 0, 2359302, 7864320, 1507337,
+9306112, 0, 1507337, 9371648, 0, 0, 9043974, 0,
+0, 9043974, 0, 13, 9043968, 0, 0, 9175040,
+96, 0, 9043969, 0, 36, 9109504, 0, 0,
+9175040, 0, 0, 9175068, 0, 0, 9175068, 0,
+0, 9109513, 0, 0, 9109513, 0, 0, 8912905,
+0, 0, 8912905, 0, 0, 8847369, 0, 0,
+8781833, 0, 0, 8716297, 0, 0, 8716297, 0,
+0, 8781833, 0, 0, 8650761, 0, 0, 8585225,
+0, 0, 8585225, 0, 0, 8650761, 0, 0,
+7798793, 0, 0, 7798793, 0, 0, 7733257, 0,
+0, 7733257, 32, 458761, 8912896, 0, 0, 9109504,
+32, 458761, 8847360, 0, 0, 8912896, 32, 458761,
+8781824, 0, 0, 8847360, 32, 458761, 8716288, 0,
+0, 8781824, 32, 458761, 8650752, 0, 0, 8716288,
+32, 458761, 8585216, 0, 0, 8650752, 32, 458761,
+7798784, 0, 0, 8585216, 32, 458761, 7733248, 0,
+0, 7798784, 32, 458761, 7667712, 0, 0, 7733248,
+0, 0, 7667721, 4, 0, 7667718, 4, 0,
+7667718, 0, 0, 7667721, 32, 9, 7667712, 0,
+0, 7995392, 0, 0, 9043974, 0, 0, 9043969,
+0, 0, 9043974, 0, 0, 8060957, 0, 0,
+8060957, 0, 0, 8126481, 0, 0, 8126481, 0,
+29, 8060928, 0, 0, 8126464, 0, 0, 8060957,
+0, 0, 8060957, 0, 0, 8454161, 0, 0,
+8454161, 0, 29, 8060928, 0, 0, 8454144, 1048576,
+3473430, 7864320, 0, 0, 8192000, 288, 0, 10551297,
+48, 0, 10551297, 0, 458793, 8388608, 0, 0,
+8060928, 0, 0, 8388649, 0, 0, 8257577, 0,
+0, 3997737, 0, 0, 8388649, 0, 0, 3997737,
+0, 0, 8257577, 0, 0, 3932201, 0, 0,
+3932201, 0, 0, 3866665, 0, 0, 3670057, 0,
+0, 3670057, 0, 0, 3866665, 0, 0, 3473449,
+0, 0, 3473449, 0, 0, 2818089, 0, 2687017,
+2818048, 0, 0, 3735552, 0, 0, 2818089, 0,
+2687017, 2818048, 0, 0, 3801088, 0, 0, 2818089,
+0, 2687017, 2818048, 0, 0, 3276800, 0, 2687017,
+2818048, 0, 0, 2883584, 0, 0, 2818089, 0,
+2687017, 2818048, 0, 0, 3014656, 0, 0, 2818089,
+0, 2687017, 2818048, 0, 0, 2949120, 0, 0,
+2949162, 0, 0, 2949162, 0, 0, 3014698, 0,
+0, 3014698, 0, 0, 2883626, 0, 0, 3276842,
+0, 0, 3276842, 0, 0, 3801130, 0, 0,
+3801130, 0, 0, 3735594, 0, 0, 3735594, 0,
+0, 2752553, 0, 2687017, 2752512, 0, 0, 3735552,
+0, 2687017, 2752512, 0, 0, 3801088, 0, 0,
+2752553, 0, 2687017, 2752512, 0, 0, 3014656, 0,
+0, 2752553, 0, 2687017, 2752512, 0, 0, 2949120,
+0, 0, 2752553, 0, 0, 2752553, 0, 0,
+2752553, 0, 0, 2883626, 0, 2687017, 2752512, 0,
+0, 2883584, 0, 0, 2752553, 0, 2687017, 2752512,
+0, 0, 3276800, 0, 0, 2752553, 0, 0,
+2752553, 0, 0, 2752553, 0, 0, 2752553, 0,
+0, 3080239, 0, 0, 3080239, 0, 0, 3080239,
+0, 0, 3080239, 0, 0, 3080239, 0, 0,
+3080239, 0, 0, 2752553, 0, 0, 2818089, 0,
+0, 3407913, 0, 458793, 8323072, 0, 41, 8388608,
+0, 458793, 8257536, 0, 0, 8323072, 0, 458793,
+3997696, 0, 0, 8257536, 0, 458793, 3932160, 0,
+0, 3997696, 0, 458793, 3866624, 0, 0, 3932160,
+0, 458793, 3670016, 0, 0, 3866624, 0, 458793,
+3473408, 0, 0, 3670016, 0, 458793, 3407872, 0,
+41, 3473408, 0, 41, 2818048, 0, 0, 3538944,
+0, 0, 3407913, 0, 54, 3407872, 0, 0,
+3604480, 0, 0, 3407913, 4, 0, 3407878, 4,
+0, 3407878, 0, 0, 3407913, 4, 0, 8388614,
+4, 0, 8388614, 0, 0, 3604508, 0, 0,
+3538986, 0, 0, 3604508, 0, 0, 3538986, 0,
+54, 3538944, 0, 0, 3604480, 0, 3080239, 2752512,
+0, 0, 3080192, 0, 3080239, 2752512, 0, 0,
+3080192, 0, 3080239, 2752512, 0, 0, 3080192, 0,
+2293795, 3211264, 0, 35, 2818048, 0, 2293795, 3211264,
+0, 35, 2818048, 64, 2293795, 3211264, 64, 35,
+2818048, 0, 0, 3145783, 0, 0, 3145767, 0,
+0, 3145783, 0, 0, 2818089, 0, 0, 2818054,
+0, 0, 2818089, 0, 0, 2818054, 32, 0,
+983041, 6, 0, 983046, 6, 0, 4259846, 0,
+0, 4259841, 0, 0, 11665414, 24, 0, 11665460,
+0, 11, 9699328, 0, 0, 5701632, 0, 11,
+5701632, 0, 0, 9568256, 0, 589833, 12582912, 0,
+0, 12713984, 0, 0, 12713993, 0, 0, 12713993,
+0, 0, 12648457, 0, 0, 12648457, 0, 0,
+12648457, 0, 589833, 12648448, 0, 0, 12713984, 0,
+0, 5701637, 0, 0, 5701637, 192, 327685, 6881280,
+0, 0, 6946816, 192, 327685, 5701632, 0, 0,
+6946816, 4, 0, 5701638, 4, 0, 5701638, 0,
+0, 6946858, 0, 0, 6946858, 0, 0, 6881317,
+0, 0, 6881317, 0, 0, 6881317, 0, 0,
+6881317, 0, 0, 6881317, 4, 0, 12517382, 0,
+0, 12517385, 0, 589833, 10682368, 0, 19, 9306112,
+0, 589833, 10682368, 0, 19, 9306112, 0, 589833,
+9437184, 0, 19, 9306112, 0, 589833, 9437184, 0,
+19, 9306112, 0, 589833, 9240576, 0, 19, 9306112,
+0, 589833, 9240576, 0, 19, 9306112, 0, 589833,
+9240576, 0, 19, 9306112, 0, 589833, 9240576, 0,
+19, 9306112, 0, 589833, 9240576, 0, 19, 9306112,
+7864320, 1507337, 9306112, 0, 1507337, 9371648, 0, 1966131,
+11665408, 0, 1966131, 11796480, 0, 0, 9371657, 4,
+0, 9371654, 0, 0, 2490412, 0, 0, 2490412,
+0, 0, 2490412, 0, 0, 2490412, 0, 0,
+9437193, 7864320, 0, 9306121, 0, 0, 9437193, 0,
+0, 9437240, 0, 0, 10682377, 0, 0, 10682424,
+0, 0, 10682377, 0, 0, 9240585, 0, 0,
+9240632, 0, 57, 2818048, 0, 393216, 3342336, 32,
+57, 2818048, 0, 393216, 3342336, 0, 57, 2818048,
+0, 393216, 3342336, 32, 57, 2818048, 0, 393216,
+3342336, 0, 393216, 3145728, 0, 37, 3211264, 288,
+0, 5373953, 216, 0, 5308417, 144, 0, 5242881,
+72, 0, 5177345, 0, 0, 5046273, 0, 0,
+5373953, 72, 0, 5308417, 144, 0, 5242881, 216,
+0, 5177345, 288, 0, 5046273, 4, 1638401, 5308416,
+0, 19, 5373952, 4, 1638401, 5242880, 0, 19,
+5308416, 4, 1638401, 5177344, 0, 19, 5242880, 4,
+1638401, 5046272, 0, 19, 5177344, 4, 1638401, 4980736,
+0, 1, 5046272, 0, 0, 131113, 0, 1638400,
+589824, 0, 19, 655360, 0, 0, 655361, 0,
+0, 655366, 48, 0, 655361, 0, 0, 655366,
+288, 0, 589825, 216, 0, 524289, 144, 0,
+458753, 72, 0, 393217, 0, 0, 327681, 0,
+0, 589825, 72, 0, 524289, 144, 0, 458753,
+216, 0, 393217, 288, 0, 327681, 0, 1638400,
+524288, 0, 19, 589824, 0, 1638400, 458752, 0,
+19, 524288, 0, 1638400, 393216, 0, 19, 458752,
+0, 1638400, 327680, 0, 19, 393216, 0, 1638400,
+262144, 0, 1, 327680, 4, 0, 4980742, 0,
+0, 4980737, 0, 0, 4980737, 4, 0, 4980742,
+4, 0, 262150, 0, 0, 262145, 0, 0,
+262145, 4, 0, 262150, 524352, 0, 4194305, 0,
+0, 4194310, 1048800, 0, 917505, 0, 0, 917510,
+0, 0, 10158081, 48, 0, 10223617, 96, 0,
+10289153, 144, 0, 10354689, 192, 0, 10354689, 240,
+0, 10289153, 288, 0, 10223617, 336, 0, 10158081,
+192, 0, 10420225, 240, 0, 10485761, 96, 0,
+10485761, 144, 0, 10420225, 0, 458752, 10158080, 0,
+1, 10223616, 0, 458752, 10223616, 0, 1, 10289152,
+0, 458752, 10289152, 0, 1, 10354688, 0, 458752,
+10354688, 0, 1, 10420224, 0, 458752, 10420224, 0,
+1, 10485760, 0, 458752, 10485760, 0, 1, 10551296,
+0, 0, 10092545, 4, 0, 10092550, 0, 0,
+9240585, 0, 0, 9240585, 0, 0, 9240585, 0,
+0, 9371657, 0, 0, 11862025, 4, 0, 11862022,
+0, 0, 11862025, 0, 0, 11927561, 4, 0,
+11927558, 0, 0, 6422532, 0, 0, 6422534, 0,
+0, 6422534, 0, 0, 6422532, 0, 0, 8388649,
+0, 0, 8388649, 0, 0, 8388649, 0, 0,
+8388649, 4, 0, 8323078, 0, 0, 8323113, 0,
+0, 8323113, 4, 0, 8323078, 4, 0, 12976134,
+0, 0, 12976137, 0, 0, 12976137, 4, 0,
+12976134};
 extern const uint32_t e1m1_WADSegments[4389] = {
-17891600, 17825792, 0, 18088209, 18006016, 0, 17826071, 18169856,
-0, 18284820, 18251776, 1, 18678044, 18481152, 0, 53215517,
-18595840, 0, 18613037, 18825216, 6291456, 28967726, 32079872, 1048576,
-29032890, 32129024, 0, 53412283, 33225925, 0, 53477705, 21757518,
-0, 21561787, 32184002, 0, 29033263, 33193156, 63111169, 21300017,
-21381120, 2097152, 51249929, 63946752, 0, 51446542, 64258048, 0,
-51511621, 64359707, 0, 50922258, 64421888, 0, 53543236, 21381120,
-0, 21234449, 64326940, 0, 50856713, 63247076, 0, 51249933,
-63607525, 0, 51184392, 63881216, 0, 50922254, 63913984, 1,
-50791176, 63181540, 0, 51184396, 63541989, 0, 51118855, 63815680,
-0, 50856717, 63848448, 1, 50725639, 63116004, 0, 51118859,
-63476453, 0, 51053318, 63750144, 0, 50791180, 63782912, 1,
-50660102, 63050468, 0, 51053322, 63410917, 0, 50987781, 63684608,
-0, 50725643, 63717376, 1, 50463489, 62701568, 0, 50397957,
-62984932, 0, 50987778, 63345381, 0, 50660106, 63651840, 1,
-17760695, 32555008, 0, 50397954, 62668800, 1, 50463491, 62750720,
-0, 50528527, 62816256, 0, 50594561, 62849024, 0, 28771076,
-62914560, 0, 16974082, 16760832, 0, 17760526, 17320443, 0,
-17694979, 17727488, 0, 16908559, 17760256, 1, 17039619, 16826368,
-0, 17694989, 17254907, 0, 17629444, 17661952, 0, 16974094,
-17694720, 1, 17105156, 16891904, 0, 17629452, 17189371, 0,
-17563909, 17596416, 0, 17039629, 17629184, 1, 17563915, 17123835,
-0, 17498374, 17530880, 0, 17105164, 17563648, 1, 17171220,
-64667648, 0, 51642629, 64733184, 0, 17236230, 16957440, 0,
-17432839, 17465344, 0, 17170699, 17498112, 1, 47317258, 57627364,
-0, 17498834, 57688064, 0, 17301767, 17022976, 0, 17432841,
-17055744, 0, 17367304, 17399808, 0, 17236234, 17432576, 1,
-29491649, 33062912, 0, 53609263, 33225925, 29425664, 53674800, 21757518,
-20971520, 53412658, 33193156, 48365569, 29295042, 33013760, 0, 29360577,
-32948224, 1, 29491647, 32980992, 1, 29426114, 33030144, 1,
-29295040, 33128448, 0, 28705205, 31752192, 0, 53346742, 32079872,
-0, 28639677, 32407552, 0, 29163967, 32817152, 0, 29163966,
-32604160, 0, 29295037, 32784384, 1, 29229504, 32882688, 1,
-29360575, 33095680, 1, 17760514, 17793024, 0, 28508594, 31506432,
-0, 16908723, 31571968, 0, 28836279, 31784960, 0, 28901816,
-31916032, 0, 28443068, 32243712, 0, 29098425, 32440320, 0,
-28770575, 32522240, 1, 28639670, 31719424, 1, 28705208, 31866880,
-0, 28836281, 31948800, 1, 28901813, 32030720, 0, 29098418,
-32276480, 1, 29163964, 32325632, 0, 29229501, 32571392, 1,
-28443070, 32751616, 0, 27918761, 30179328, 0, 27853229, 30965760,
-0, 29557556, 33225923, 48300032, 29622723, 33280741, 0, 53805508,
-33341440, 0, 27263393, 29720576, 1, 27853226, 30146560, 1,
-27918752, 30228480, 0, 27328937, 30588928, 0, 28115766, 30883840,
-2097152, 53936949, 33341440, 50331648, 29557188, 33247972, 1, 54068024,
-21807104, 9699328, 29623095, 33308672, 46137345, 27984298, 30703616, 0,
-28311979, 31277056, 0, 28377520, 31408128, 0, 16908547, 16728064,
-1, 16974084, 16793600, 1, 17039621, 16859136, 1, 17105328,
-31358976, 0, 28311985, 31440896, 1, 28508418, 31539200, 1,
-28377523, 31588352, 0, 29229492, 32669696, 0, 29360574, 32849920,
-0, 29426112, 32915456, 0, 53740338, 33225939, 44105728, 28574129,
-31670272, 0, 21627699, 21757518, 35651584, 54001994, 21807104, 0,
-53608899, 33193156, 1, 196621, 22396928, 0, 25297281, 27230208,
-0, 54133062, 21610496, 0, 851971, 22364160, 1, 196946,
-22712021, 0, 22216717, 22744788, 0, 21365075, 22806528, 0,
-21431098, 21610496, 7733248, 22151495, 22904832, 0, 21233989, 21413888,
-1, 21299526, 21430272, 0, 21430596, 21528576, 0, 21365063,
-21577728, 1, 10748056, 8781824, 0, 720908, 9207808, 1,
-9961851, 26685898, 0, 24903844, 26791478, 0, 786812, 26853376,
-0, 24838155, 26886144, 0, 31064891, 34799616, 7208960, 31130074,
-34914304, 0, 10682843, 35094528, 0, 10748067, 8765440, 0,
-9961636, 8814592, 1, 851980, 523152, 0, 54263977, 9076736,
-0, 11206823, 9142272, 0, 786443, 9175040, 0, 11075755,
-9338880, 0, 721725, 394370, 33161216, 10944678, 8937472, 0,
-25428355, 27377664, 0, 23855467, 25116672, 0, 23921004, 25165824,
-0, 23986541, 25288704, 0, 24772976, 26443776, 0, 23789946,
-26509312, 0, 54394883, 180224, 0, 25100670, 27009024, 0,
-25035133, 26935296, 0, 25166207, 27082752, 0, 25231744, 27156480,
-0, 25362818, 27303936, 0, 24969604, 27451392, 0, 11206825,
-9306112, 1, 11337900, 9404416, 0, 11075757, 9592832, 0,
-11272363, 9674752, 0, 11272365, 9371648, 1, 11468974, 9469952,
-0, 11337903, 9527296, 0, 11403436, 9740288, 0, 11403439,
-9437184, 1, 11600048, 9928704, 0, 11468977, 9977856, 0,
-11534510, 10076160, 0, 11534513, 9895936, 1, 54460592, 10534912,
-0, 22347957, 23019520, 0, 11600213, 23085056, 0, 54526241,
-18907136, 1, 22872897, 23658496, 2621440, 22937949, 23773184, 0,
-18940254, 23822336, 0, 54330178, 394351, 22478848, 11141948, 9076736,
-7012352, 10813610, 23445504, 0, 25624966, 27533312, 0, 18875200,
-18907136, 7995393, 54591836, 23658496, 0, 22806816, 24395776, 0,
-54722570, 394351, 0, 655378, 669025, 0, 1180484, 9781248,
-9437184, 25887114, 27828224, 0, 54657859, 394351, 15400960, 25690503,
-27607040, 0, 25559429, 27459584, 0, 25756040, 27680768, 0,
-25821577, 27754496, 0, 25952651, 27901952, 0, 25493900, 27975680,
-0, 10158917, 8175616, 10682368, 10485915, 8617984, 0, 10289308,
-8306688, 0, 10223775, 8650752, 0, 10223771, 8241152, 0,
-10485919, 8404992, 0, 10158240, 8585216, 1, 10420380, 8683520,
-1, 10551453, 8514844, 0, 30671009, 34144256, 0, 30736852,
-35176448, 0, 54788114, 9814016, 1, 49086934, 60440576, 0,
-1180397, 60489728, 0, 54198745, 34799616, 0, 30999004, 34947072,
-0, 31195289, 35028992, 0, 10027160, 8077312, 0, 36307497,
-42614784, 0, 36373034, 42672128, 0, 54919723, 42729472, 0,
-36700999, 43024384, 17301504, 36766256, 43081728, 0, 36241969, 43147264,
-0, 37028404, 43368448, 0, 36438854, 42729472, 13107200, 36504108,
-42852352, 0, 55050797, 42909696, 0, 36962867, 43286528, 0,
-36569928, 42909696, 4718592, 36635182, 42967040, 0, 55116335, 43024384,
-0, 36897330, 43204608, 0, 54985545, 43024384, 4718592, 36831797,
-43384832, 0, 36832074, 43237376, 8388609, 55247410, 43417600, 1,
-37356087, 43712512, 0, 55181875, 43237376, 1, 36897612, 43253760,
-8388609, 37421626, 43794432, 0, 55313229, 43253760, 7340033, 37225019,
-43876352, 0, 37225015, 43532288, 0, 37159482, 43745280, 1,
-37356091, 43827200, 1, 37421624, 43843584, 1, 55444021, 43335680,
-1, 37028683, 43417600, 5242881, 37159478, 43450368, 0, 55378484,
-43253760, 1, 36963151, 43335680, 8388609, 37290552, 43614208, 0,
-55509838, 43335680, 4194305, 37093945, 43696128, 0, 54853786, 8175616,
-0, 10616992, 8536064, 0, 37552290, 44050664, 0, 36241981,
-44113920, 0, 36766249, 43180032, 1, 10093116, 43946112, 0,
-37487153, 44015616, 0, 44630706, 54272000, 0, 55575241, 56854713,
-0, 46728017, 56934400, 20971520, 44040863, 52535296, 0, 55706317,
-57016320, 1, 43975376, 57402825, 0, 46924626, 57016320, 3801089,
-47186636, 57466880, 0, 43975328, 52502528, 1, 44630687, 53141504,
-0, 44040882, 54222848, 0, 45220521, 54304768, 1, 55771817,
-54345728, 0, 44565159, 53805056, 0, 44499622, 53870592, 0,
-45220520, 54132736, 0, 55837372, 55132160, 0, 45876048, 56854713,
-7929856, 44303011, 52781056, 0, 44434085, 53993472, 0, 44237476,
-52813824, 1, 44303013, 52830208, 0, 44434083, 52928512, 0,
-44368550, 53960704, 1, 44106400, 52592640, 0, 44171937, 52658176,
-0, 44237474, 52723712, 0, 44106402, 52625408, 1, 44171943,
-52969472, 0, 44565153, 53067776, 0, 44499624, 53837824, 1,
-45876053, 55083443, 2097152, 46727868, 56821944, 1, 45744982, 54968320,
-12582912, 45810362, 55027723, 0, 55902907, 55083443, 0, 55640777,
-56901632, 1, 44696403, 54345728, 4718592, 46662487, 56817949, 41811968,
-55640776, 56934400, 0, 56165208, 54850277, 7405568, 56033992, 56785180,
-1, 45613913, 54850276, 10944512, 45679288, 54908918, 0, 55968441,
-54968320, 0, 46662481, 56901632, 12582913, 47055563, 57147392, 0,
-47121102, 57262080, 0, 46924495, 57311232, 0, 46858956, 61554688,
-0, 46858954, 56950784, 0, 46990028, 57049088, 0, 46793421,
-57098240, 0, 46924491, 61587456, 1, 43909789, 52486144, 0,
-46793562, 56983552, 327681, 47252126, 57514552, 0, 56230603, 56983552,
-1, 46858961, 57581568, 0, 44761770, 54419456, 0, 43844254,
-52453376, 1, 43909802, 53190656, 0, 44761757, 53223424, 0,
-44696235, 54452224, 1, 43844252, 52363264, 0, 56296107, 53772288,
-0, 46990026, 57131008, 1, 49677045, 61423616, 0, 49545971,
-61325312, 0, 49611508, 61341696, 0, 49480438, 61505536, 0,
-49480436, 61292544, 1, 49545973, 61374464, 1, 49611510, 61456384,
-1, 49677043, 61472768, 1, 45941412, 55197696, 0, 43516605,
-55853056, 0, 46072510, 55289289, 0, 43451030, 55787520, 0,
-46203584, 55902208, 0, 46006977, 56016896, 0, 46269119, 56070885,
-0, 43385538, 56136421, 0, 46334615, 56169188, 0, 46138051,
-56234724, 0, 43254422, 52007653, 0, 43451027, 52036881, 0,
-43188884, 55721984, 0, 43385495, 55820288, 1, 45941400, 55885824,
-1, 46531261, 56524800, 0, 43516615, 56623104, 0, 46596806,
-56705024, 0, 46203582, 55984128, 1, 46006982, 56459264, 0,
-46596801, 56557568, 0, 46531271, 56737792, 1, 44368560, 54001664,
-0, 45089457, 54072036, 0, 45155156, 55132160, 5242880, 43188882,
-51777182, 0, 43319956, 51881995, 0, 43123349, 55656448, 0,
-43254419, 55754752, 1, 45286063, 54509568, 0, 45351603, 54558720,
-0, 45417140, 54616400, 0, 45482677, 54673408, 0, 56361654,
-56817955, 0, 43582104, 52117504, 0, 43647641, 52174848, 0,
-45023918, 53649408, 0, 43582106, 52207616, 1, 43647662, 53469184,
-0, 45023897, 53501952, 0, 44958383, 53616640, 1, 44958381,
-53575680, 0, 44892844, 53706752, 0, 44827483, 53772288, 4194304,
-56034140, 56817955, 2555904, 43713178, 52232192, 0, 43778715, 52297728,
-0, 43713180, 52330496, 1, 43778732, 53329920, 0, 44892827,
-53362688, 0, 44827309, 53673984, 1, 45548214, 54722560, 0,
-56099511, 54850277, 0, 45482839, 56785186, 8126465, 43123345, 51713730,
-0, 42992277, 51942117, 0, 43057808, 55590912, 0, 43319954,
-55689216, 1, 42795664, 51609600, 0, 43057802, 51642368, 0,
-42599053, 55525376, 0, 42992273, 55623680, 1, 42599049, 51376482,
-0, 42861197, 51473691, 0, 42533518, 55459840, 0, 42795658,
-55558144, 1, 18088215, 18219008, 0, 18219285, 18317312, 0,
-18284974, 31080448, 0, 28246294, 31145984, 0, 18022674, 17924096,
-0, 17957141, 18071552, 0, 18219283, 18104320, 0, 18153750,
-18284544, 1, 18415896, 18366464, 0, 28180761, 30998528, 0,
-18350511, 31227904, 0, 18350361, 18399232, 1, 18546970, 18432000,
-0, 18416428, 18595840, 4194304, 18743576, 18661376, 0, 18481438,
-18710528, 0, 53281051, 18825216, 0, 22020957, 22475052, 4456448,
-16711934, 16135684, 0, 16646391, 16482304, 1, 16318719, 16515072,
-0, 51577081, 64536576, 0, 16188179, 64602112, 0, 16318712,
-15843328, 0, 16711929, 16547840, 1, 16253184, 16580608, 0,
-47382783, 57753600, 0, 16777939, 57814299, 0, 16253178, 15908864,
-0, 16843008, 16203776, 0, 16777464, 16613376, 1, 16384257,
-16646144, 0, 16843002, 16678912, 1, 17301769, 17367040, 1,
-27001089, 29261824, 0, 18153884, 29327360, 0, 27066644, 29360128,
-0, 17367453, 29425664, 0, 21496072, 21626880, 0, 16384414,
-29523968, 0, 27132319, 29589504, 0, 27263304, 29622272, 0,
-27328928, 29687808, 0, 27197860, 29982720, 0, 26476947, 28393472,
-0, 27656613, 30015488, 0, 27591060, 30605312, 0, 27525535,
-29949952, 1, 27591078, 30048256, 1, 27197861, 30294016, 0,
-27656612, 30392320, 0, 27787687, 30097408, 0, 27722156, 30818304,
-0, 53871016, 30883840, 0, 56492855, 33341440, 51380224, 56558393,
-21807104, 76546048, 53936990, 33308672, 20971521, 27394465, 29810688, 0,
-27460002, 29868032, 0, 27394467, 29835264, 1, 27722152, 30130176,
-1, 27460007, 30441472, 0, 27787682, 30474240, 0, 27525539,
-29925376, 0, 28049830, 30736384, 0, 18809083, 18792448, 0,
-56623503, 28082176, 0, 26149151, 28147712, 0, 16056571, 16252928,
-0, 16449823, 18759680, 1, 26542325, 28491776, 0, 26608021,
-28557312, 0, 26739094, 28737536, 0, 18809240, 28803072, 0,
-16056564, 15646720, 0, 16515323, 15939076, 0, 16449781, 16285696,
-1, 15991036, 16318464, 0, 15991030, 15712256, 0, 16580860,
-16004612, 0, 16515316, 16351232, 1, 16122109, 16384000, 0,
-16122103, 15777792, 0, 16646397, 16070148, 0, 16580854, 16416768,
-1, 16187646, 16449536, 0, 26346337, 28327936, 1048576, 26411410,
-29179904, 0, 29688670, 33341440, 76546048, 56755039, 21807104, 101711872,
-56492485, 33308672, 1, 15991029, 15613952, 1, 16122100, 15679488,
-1, 16187638, 15745024, 1, 16056725, 28459008, 1, 26542482,
-28606464, 0, 26411255, 29097984, 0, 26345875, 29212672, 1,
-26280343, 28639232, 0, 26673561, 28835840, 0, 36176739, 42446976,
-1114112, 56885800, 42500929, 0, 26805093, 62586880, 27000832, 56689041,
-28327936, 0, 56820165, 42446976, 0, 26738975, 28770304, 1,
-26804631, 28868608, 1, 26673560, 28950528, 0, 18809241, 28983296,
-0, 57082726, 33915281, 20447232, 36176740, 42468160, 33226753, 21693282,
-21807104, 122683392, 57016651, 33915281, 0, 29688360, 42414207, 1,
-26935706, 29037956, 0, 30344036, 42500929, 71892992, 26870223, 42549248,
-0, 56951195, 62586880, 0, 30278503, 33915281, 90046464, 30343630,
-33977060, 0, 56885711, 42468160, 1, 19267877, 19087360, 0,
-50332520, 62570496, 327680, 51315456, 63995904, 0, 19202831, 64058084,
-0, 51380518, 64156389, 0, 57148155, 62570496, 0, 50004752,
-64159744, 0, 49939195, 61926684, 0, 50332415, 62221595, 0,
-50266874, 62504960, 0, 50004736, 62537728, 1, 19398951, 21348352,
-0, 22085928, 22577152, 0, 19333456, 22609920, 0, 57213265,
-22513580, 0, 19202342, 19120128, 1, 19267879, 19136512, 0,
-19398949, 19234816, 0, 19333416, 21315584, 1, 49873658, 61861148,
-0, 50266878, 62156059, 0, 50201337, 62439424, 0, 49939199,
-62472192, 1, 49808121, 61795612, 0, 50201341, 62090523, 0,
-50135800, 62373888, 0, 49873662, 62406656, 1, 49742584, 61730076,
-0, 50135804, 62024987, 0, 50070263, 62308352, 0, 49808125,
-62341120, 1, 26083725, 28033024, 0, 26018551, 61664540, 0,
-50069902, 61959451, 0, 49742588, 62275584, 1, 26018190, 28000256,
-1, 26084192, 28082176, 524288, 26214797, 28180480, 0, 16449936,
-28246016, 0, 1441813, 786432, 0, 57278486, 901120, 0,
-1376380, 6356992, 0, 8127339, 10687782, 15663104, 57344124, 10720551,
-1, 8127340, 11075584, 4194304, 524604, 20459873, 0, 20709693,
-20676608, 0, 20644152, 20545536, 0, 20775228, 20643840, 1,
-20709710, 22102016, 0, 21889339, 22167552, 0, 21954877, 22265856,
-0, 20447567, 22331392, 0, 6488090, 10999491, 0, 1704813,
-36061184, 23592960, 6488162, 4882432, 0, 1704035, 10966722, 1,
-6422551, 11067392, 0, 1769498, 1015808, 0, 4457326, 2965504,
-8388608, 4522052, 3014656, 0, 57606213, 3129344, 0, 57671703,
-4325376, 0, 1507426, 11034624, 1, 1508202, 901120, 8388608,
-20513080, 20299776, 0, 20578617, 20348928, 0, 20644154, 20398080,
-0, 20447547, 20512768, 1, 5899120, 4325376, 10485760, 5963866,
-4440064, 0, 6094940, 4538368, 0, 57737309, 4587520, 0,
-459634, 294912, 12582912, 8323955, 6537216, 4194305, 19464199, 19292160,
-0, 20775209, 20611072, 0, 20447545, 20267008, 1, 20840760,
-20709376, 0, 20906302, 20824064, 0, 20513087, 20873216, 0,
-6751092, 5046272, 12582912, 7274599, 5554176, 0, 7536754, 5734400,
-0, 7602291, 5783552, 0, 6685557, 4997120, 4194304, 57933926,
-5046272, 0, 7667828, 5865472, 0, 58064971, 3506176, 0,
-57999461, 4997120, 0, 4915317, 5947392, 0, 6422632, 5128192,
-0, 6816234, 36995072, 0, 32112731, 37076992, 0, 6946921,
-5226496, 0, 32047210, 36864000, 0, 6029801, 37109760, 0,
-6029403, 4456448, 0, 32113129, 36929536, 0, 5964266, 37044224,
-1, 32047196, 37142528, 1, 4391799, 2883584, 8388608, 4588408,
-3129344, 20971520, 4653126, 3178496, 0, 57540675, 2965504, 0,
-58196847, 3129344, 12582912, 57475556, 36061184, 0, 31785059, 36159488,
-0, 31719909, 36274176, 0, 4784200, 3276800, 0, 58262390,
-3506176, 8388608, 6619236, 4915200, 0, 6553673, 36306944, 0,
-31719497, 35995648, 0, 6554085, 36225024, 0, 31785444, 36241408,
-1, 4784228, 36339712, 1, 8126485, 6389760, 1, 1572988,
-10567680, 0, 1376276, 10665984, 0, 1310744, 13041664, 0,
-1310739, 770048, 0, 1638424, 933888, 0, 1245209, 12845056,
-0, 1572884, 13074432, 1, 1638419, 12877824, 1, 14352409,
-12926976, 0, 1245404, 13025280, 0, 14418139, 13107200, 0,
-14352604, 13139968, 1, 30867675, 34291712, 0, 14418392, 34521088,
-0, 30933463, 34734080, 0, 2163155, 34701312, 0, 2163159,
-34357248, 0, 30933459, 34455552, 0, 30605345, 34668544, 1,
-30867928, 34766848, 1, 2097183, 1228800, 0, 33423871, 38813696,
-1, 52690976, 66682880, 0, 33489700, 66748416, 0, 52756990,
-66781184, 0, 2032421, 66846720, 0, 2228257, 1267701, 0,
-58327074, 47284224, 0, 589989, 9277087, 0, 54788105, 9781248,
-0, 590660, 9814016, 1048577, 30802384, 34553856, 0, 49152009,
-60588032, 0, 30409454, 60637184, 0, 589832, 345477, 0,
-57868416, 6537216, 1, 8388773, 8896512, 0, 10813449, 9244318,
-1, 30605778, 34111488, 0, 30474709, 34652160, 0, 30540241,
-35241984, 0, 30474704, 34045952, 0, 30802389, 34209792, 0,
-30409174, 34586624, 1, 30736849, 34619392, 1, 2, 98304,
-0, 57802758, 294912, 0, 1048593, 589824, 1, 131945,
-22513580, 6881280, 29819334, 33357824, 0, 8781959, 6963200, 1,
-9307003, 7258112, 8388608, 30081482, 33652736, 0, 56426638, 22475052,
-0, 29884871, 33431552, 0, 29950408, 33505280, 0, 30015945,
-33579008, 0, 30147019, 33726464, 0, 30212556, 33800192, 0,
-29753805, 33873920, 0, 8781957, 6881280, 0, 8847494, 6995968,
-0, 8717180, 7741440, 1441792, 21758087, 21856256, 0, 58523664,
-622592, 0, 58458260, 7741440, 0, 1048908, 21938176, 0,
-8847692, 21823488, 1, 21757968, 21905408, 1, 8388735, 6504448,
-0, 8454272, 6553600, 0, 58589313, 7921664, 0, 8323405,
-22052864, 0, 1115007, 622592, 14680064, 9765758, 7921664, 11862016,
-21823505, 21970944, 0, 1114445, 22003712, 1, 21823615, 22020096,
-1, 58655613, 622592, 10485760, 9699477, 7798784, 0, 8716420,
-6815744, 0, 8650898, 7544832, 0, 9699461, 7774208, 1,
-58720404, 7831552, 1, 8519809, 6619136, 0, 9633922, 7725056,
-0, 9765761, 7831552, 8912897, 8454293, 7888896, 1, 9568403,
-7602176, 0, 58786688, 7831552, 1572865, 8650883, 6750208, 0,
-8585360, 7348224, 0, 9568388, 7577600, 1, 58851474, 7634944,
-1, 917634, 6684672, 0, 9502734, 7528448, 0, 9634691,
-7634944, 8912897, 8519827, 7692288, 1, 9437329, 7405568, 0,
-58917762, 7634944, 1572865, 983054, 524288, 0, 9437315, 7380992,
-1, 9502864, 7438336, 1, 917649, 7495680, 1, 8585384,
-8978432, 0, 11010063, 9830400, 0, 65536, 49152, 0,
-393221, 212992, 0, 20971521, 20938752, 0, 328003, 21200896,
-0, 21168448, 21266432, 0, 6161265, 4587520, 8388608, 58982494,
-4702208, 0, 6881387, 5275648, 0, 6291551, 4718592, 0,
-6357088, 4833280, 0, 59048044, 5324800, 0, 7077997, 5406720,
-0, 6226820, 4702208, 8388608, 7013253, 5324800, 8388608, 21037376,
-21020672, 0, 21102913, 21069824, 0, 21168450, 21118976, 0,
-20971843, 21233664, 1, 7798902, 6045696, 0, 7864439, 6094848,
-0, 32309740, 37257216, 0, 59113592, 58638336, 0, 59179306,
-19365888, 0, 32244203, 37175296, 0, 47776646, 58638336, 8388608,
-19530458, 58703872, 0, 48104157, 58834944, 0, 48038617, 58900480,
-0, 47842014, 58966016, 0, 7406472, 5685248, 8388608, 19596169,
-19365888, 46137344, 7471403, 19480576, 0, 31260794, 35291136, 0,
-31326685, 35340288, 0, 31392222, 35389440, 0, 59310983, 19365888,
-8388608, 7929969, 19398656, 0, 7995513, 6176768, 0, 59375726,
-5455872, 0, 7209083, 6258688, 0, 32178670, 37355520, 0,
-7144330, 5455872, 8388608, 7733345, 5963776, 0, 32375277, 37339136,
-0, 8061407, 35471360, 0, 7340143, 5570560, 0, 59244656,
-5685248, 0, 47973083, 58736640, 0, 48235231, 59162624, 0,
-48300768, 59211776, 0, 48169698, 59244544, 0, 48366300, 59326464,
-0, 47907553, 59392000, 0, 47907548, 58769408, 1, 48038622,
-58802176, 1, 48104155, 59015168, 0, 47973085, 59047936, 0,
-983208, 9863168, 1, 11862196, 10436608, 0, 11928383, 10534912,
-5242880, 22282422, 22986752, 0, 22413327, 23150592, 0, 19136854,
-23216128, 0, 22479188, 23314432, 0, 11010391, 23379968, 0,
-19071266, 18956288, 0, 19005732, 19038208, 0, 23200035, 24248320,
-0, 11796834, 24313856, 0, 19005731, 18989056, 1, 22610264,
-23478272, 0, 19071321, 23527424, 0, 22544737, 24150016, 0,
-23134498, 24215552, 0, 22610211, 23560192, 1, 22741338, 23592960,
-0, 23003481, 23871488, 0, 19071328, 23969792, 0, 23069019,
-24035328, 0, 22675807, 24061058, 0, 18940192, 18874368, 0,
-22675803, 23625728, 1, 23265626, 24461312, 0, 18874723, 24526848,
-0, 22741348, 24625152, 0, 23331105, 24690688, 0, 23658856,
-25001984, 0, 23724393, 25051136, 0, 23593335, 25993216, 0,
-24576376, 26263552, 0, 24707434, 26279936, 0, 24052089, 26345472,
-0, 24117615, 25378816, 0, 24641902, 26066944, 0, 24052619,
-25411584, 4194305, 24379763, 25694948, 0, 24707439, 26378240, 1,
-24314233, 26624000, 0, 59441520, 25411584, 1, 24510837, 25849115,
-0, 24117626, 26411008, 1, 24772982, 26558464, 0, 24445300,
-25772032, 0, 24314228, 25727717, 1, 24379765, 25804800, 1,
-24445302, 25881884, 1, 24183146, 25444352, 0, 24314225, 25624576,
-0, 23724409, 26312704, 1, 24707443, 26656768, 1, 23789938,
-25575424, 0, 24248694, 25919488, 0, 24772971, 26476544, 1,
-24510842, 26591232, 1, 24248689, 25509888, 0, 24183155, 25657344,
-1, 24510834, 25886720, 1, 58392717, 7258112, 0, 9240755,
-10223616, 0, 23396486, 24723456, 0, 11731301, 24788992, 0,
-262974, 180224, 8388608, 10879154, 10108928, 0, 11665412, 10321920,
-0, 9240580, 10207232, 0, 11731085, 10256384, 1, 262322,
-10289152, 1, 11665587, 10371072, 0, 23462247, 25346048, 0,
-23527800, 26083328, 0, 24576358, 26181632, 0, 24641911, 26230784,
-1, 23396531, 24821760, 1, 23462245, 24870912, 0, 11731303,
-24903680, 0, 23527782, 25313280, 1, 41681531, 49709056, 0,
-41812156, 49922048, 0, 41615998, 49987584, 0, 41550459, 49070080,
-0, 41681529, 49094656, 0, 41484922, 49643520, 0, 41615996,
-49676288, 1, 41484918, 48906240, 0, 41353850, 49004544, 0,
-41288311, 49577984, 0, 41550457, 49610752, 1, 12321378, 47146869,
-0, 39977569, 47218688, 0, 12845251, 11698176, 0, 12780129,
-47038464, 0, 39977156, 47071232, 0, 39912034, 47185920, 1,
-41747068, 49758208, 0, 13042301, 49823744, 0, 12320967, 50003968,
-0, 12386492, 11354112, 0, 12320957, 11386880, 1, 13107399,
-11812864, 0, 12386504, 11993088, 0, 13041852, 50036736, 1,
-13435180, 19531786, 0, 19660990, 19603456, 0, 13500621, 50921472,
-0, 42009216, 50569216, 0, 12452140, 19636224, 1, 42008766,
-50421760, 0, 19661440, 50520064, 0, 41943681, 50536448, 1,
-12452029, 11405322, 0, 19726977, 50357704, 0, 19792173, 19677184,
-0, 19923247, 19775488, 0, 20054318, 19862244, 0, 13369547,
-11927552, 0, 13304013, 12075008, 0, 13500620, 12173312, 0,
-13435086, 50954240, 1, 41943344, 50324402, 0, 19858316, 19824640,
-6291456, 59572530, 20185088, 0, 42533512, 51310946, 0, 42926734,
-51539227, 0, 42467983, 55394304, 0, 42861193, 55492608, 1,
-42402702, 55328768, 655360, 42926728, 55427072, 1, 52953735, 67174400,
-0, 42468136, 67300636, 0, 53019279, 67332106, 0, 59638411,
-55328768, 0, 42664745, 67403776, 0, 42402438, 51183616, 0,
-42730123, 51412992, 0, 42664583, 55361536, 1, 52822668, 66928640,
-0, 42337063, 67125248, 0, 20382005, 51134464, 0, 20251332,
-56328192, 0, 46465335, 56360960, 0, 46400294, 67010560, 0,
-52888261, 67043328, 0, 59506993, 19824640, 0, 20382605, 20185088,
-14680064, 20250935, 51167232, 1, 19988788, 20070400, 0, 20316469,
-20168704, 0, 42074422, 50633272, 0, 20185731, 50666574, 0,
-42140290, 50880512, 0, 20119758, 19986422, 0, 12517683, 20045824,
-0, 20119743, 20013056, 1, 42139955, 50733056, 0, 12518018,
-50831360, 0, 42074755, 50913280, 1, 12583103, 11532278, 0,
-12648640, 11583488, 0, 39911617, 46962827, 0, 12583105, 11550720,
-1, 13238473, 11911168, 0, 13172928, 12189696, 0, 12648650,
-12288000, 0, 41288309, 48709632, 0, 41419383, 48807936, 0,
-41222776, 49512448, 0, 41353846, 49545216, 1, 41222770, 48644096,
-0, 41091704, 48873472, 0, 41026163, 49446912, 0, 41419381,
-49479680, 1, 41026161, 48447488, 0, 41157235, 48545792, 0,
-40960628, 49381376, 0, 41091698, 49414144, 1, 40960624, 48381952,
-0, 40829556, 48611328, 0, 40895087, 49315840, 0, 41157233,
-49348608, 1, 40895086, 48321252, 0, 40764015, 49258496, 0,
-40829552, 49283072, 1, 40764012, 48195901, 0, 40829550, 49225728,
-1, 12779716, 11665408, 1, 12845663, 46743552, 0, 39846083,
-46841856, 0, 39780960, 46891008, 0, 39846495, 46858240, 1,
-39780966, 47595520, 0, 40305248, 47693824, 0, 40436328, 47726592,
-0, 40239721, 47792128, 0, 41878119, 50184192, 0, 40698479,
-48290686, 0, 40632941, 49196316, 0, 40567402, 47890432, 0,
-40632939, 48070656, 0, 40501869, 48103424, 0, 40698476, 49163547,
-1, 40370793, 47759360, 1, 40501867, 47857664, 1, 40436330,
-47906816, 0, 40567400, 48005120, 0, 48956303, 60126377, 6488064,
-40174169, 47538176, 0, 59704043, 60159146, 1, 48956005, 60178432,
-0, 40174315, 60211200, 1, 48956304, 66256896, 2097152, 38732375,
-45973504, 1, 39649871, 46612480, 0, 39715421, 46675460, 0,
-39387749, 47570944, 1, 49021529, 60325888, 0, 39256812, 60391424,
-0, 59769438, 66256896, 0, 12255418, 11282749, 0, 48693435,
-59883520, 0, 59835169, 66158592, 0, 38863440, 45359104, 0,
-49414737, 61145088, 0, 12190450, 61210624, 0, 38798112, 66076672,
-0, 52429713, 66158592, 4063232, 52495083, 66207744, 0, 8257661,
-6479872, 0, 48628453, 59736064, 0, 12714726, 59785216, 0,
-48562302, 60735488, 0, 49217730, 60817408, 0, 8192751, 60882944,
-0, 12714171, 11599872, 0, 48627906, 59817984, 1, 12256146,
-59850752, 6291457, 48759527, 59899904, 0, 48825064, 60014592, 0,
-48890601, 60063744, 0, 59704042, 60126377, 0, 48825066, 60030976,
-1, 48759529, 59981824, 1, 60031891, 60801024, 6291456, 48562918,
-59703296, 1, 59900647, 59850752, 1, 48693992, 59932672, 1,
-59966181, 60801024, 0, 48890767, 60159146, 8716289, 12255426, 11632640,
-1, 40370363, 50085888, 0, 12714623, 50249728, 0, 57344039,
-10687782, 0, 2752553, 1605632, 0, 60096554, 1654784, 0,
-1966583, 38387712, 0, 32965112, 38404096, 0, 2622358, 1474560,
-3145728, 2687016, 1523712, 0, 1900572, 1064960, 0, 60228459,
-10720551, 9633793, 57409565, 11075584, 0, 1835038, 1114112, 0,
-60162087, 1474560, 0, 2556823, 10720551, 14417921, 2818965, 1654784,
-6291456, 60293163, 1703936, 0, 33030649, 38518784, 0, 2884504,
-1703936, 6291456, 33096188, 38633472, 0, 33292797, 38715392, 0,
-33227258, 38551552, 0, 33489406, 38846464, 0, 33161727, 38895616,
-0, 33423407, 38928384, 0, 33358331, 38764544, 0, 2359331,
-1343488, 0, 1769509, 10882944, 0, 2293787, 11190272, 0,
-2490405, 1392640, 0, 11993126, 10747904, 0, 2425753, 10915713,
-4194305, 2556087, 10829824, 0, 60358683, 10915713, 1, 5768090,
-4194304, 4194304, 5832792, 4308992, 0, 3407926, 2179072, 0,
-3539005, 2588672, 0, 31457369, 35520512, 0, 3146211, 35815424,
-0, 31654368, 35962880, 0, 5832756, 58069732, 0, 3407961,
-58102501, 1, 31588833, 35684352, 0, 2425314, 35864576, 0,
-2425312, 35586048, 0, 31654370, 35749888, 0, 31588389, 35897344,
-1, 31457763, 35930112, 1, 4194367, 2752512, 0, 4259904,
-2867200, 0, 5242959, 3768320, 0, 5308496, 3817472, 0,
-4129691, 2736128, 4194304, 3670940, 2228224, 4194304, 60620881, 3899392,
-0, 5308472, 58053349, 0, 3670097, 58020580, 1, 3211312,
-2015232, 0, 3997756, 2637824, 0, 60686385, 6324224, 0,
-60751931, 2424832, 0, 3866680, 2506752, 0, 60489790, 2736128,
-0, 3933087, 2424832, 8388608, 4064158, 6324224, 8388608, 5112736,
-3637248, 12582912, 5177422, 3686400, 0, 3342386, 2064384, 0,
-58130498, 2883584, 0, 31850547, 36388864, 0, 4325862, 36765696,
-0, 4849729, 3342336, 0, 4981625, 3506176, 37748736, 5046348,
-3588096, 0, 60817485, 3637248, 0, 4718663, 3260416, 0,
-3276874, 3424256, 0, 31523303, 36519936, 0, 31981604, 36618240,
-0, 31916520, 36732928, 0, 31916518, 36454400, 0, 4325864,
-36683776, 0, 31982055, 36700160, 1, 31850562, 36798464, 1,
-13631695, 12369920, 0, 37617872, 44204032, 0, 13566530, 44367872,
-0, 37880382, 44449792, 0, 37683774, 44269568, 0, 37618242,
-44482560, 1, 37945919, 44510917, 0, 37880387, 44957696, 0,
-2949164, 1785856, 0, 3014701, 1835008, 0, 3080238, 1949696,
-0, 13566160, 12337152, 1, 40043386, 47284224, 4194304, 10355300,
-47316992, 0, 40108239, 47382528, 0, 13632099, 47480832, 0,
-10420382, 8331264, 0, 37683779, 44543686, 1, 38011456, 44572672,
-0, 37945924, 44954341, 0, 39518783, 46362977, 0, 37749339,
-46424064, 0, 37814848, 44323928, 0, 37749316, 44605440, 1,
-38076993, 44633056, 0, 38011461, 44887324, 0, 37814853, 44665825,
-1, 38208070, 44695552, 0, 38076999, 44810240, 0, 52363841,
-65945600, 0, 38142751, 66011136, 0, 38142535, 44728320, 1,
-51708486, 64765952, 0, 38208284, 65257472, 0, 52167445, 65536000,
-0, 51774229, 64831488, 0, 52167451, 65191936, 0, 51708700,
-65568768, 1, 52101910, 65601536, 0, 51839766, 64897024, 0,
-52101914, 65126400, 0, 51774235, 65634304, 1, 52036375, 65667072,
-0, 51905303, 64962560, 0, 52036377, 65060864, 0, 51839770,
-65699840, 1, 51970840, 65732608, 0, 52232984, 65290240, 0,
-51970846, 65519616, 0, 51905305, 65765376, 1, 52298525, 65798144,
-0, 42205981, 65355776, 0, 52298373, 65454080, 0, 52232990,
-65830912, 1, 42271364, 65863680, 0, 38339144, 45023232, 0,
-38273668, 51003392, 0, 42271305, 51101696, 0, 42205829, 65896448,
-1, 38273609, 45056000, 1, 38732366, 45285376, 0, 39256655,
-45940736, 0, 38339159, 46055424, 0, 38666824, 46284800, 0,
-12125089, 11254086, 9175040, 39387736, 46089305, 0, 48497241, 59633792,
-0, 49283257, 60981248, 0, 49349360, 61046784, 0, 39322353,
-61112320, 0, 60883128, 11254086, 0, 12059364, 59637760, 0,
-39387876, 59601023, 1, 48496824, 59670528, 1, 12059540, 60801024,
-16777216, 15466731, 13926400, 1, 15597805, 13959168, 0, 15401198,
-15319040, 0, 15532268, 15351808, 0, 15532270, 13991936, 1,
-15728879, 14024704, 0, 15597808, 15253504, 0, 15663341, 15417344,
-0, 15663344, 14057472, 1, 14090481, 14090240, 0, 15728855,
-15187968, 0, 15794415, 15482880, 0, 13959380, 12533760, 0,
-14090454, 12632064, 0, 15794391, 14123008, 1, 13893873, 15548416,
-0, 12910805, 38993920, 0, 14024901, 39239680, 0, 12976325,
-11730944, 0, 14024920, 12681216, 0, 12910806, 39206912, 1,
-33620506, 41402368, 0, 35258566, 41418752, 1, 14287065, 12746752,
-0, 14155994, 12801730, 0, 14221825, 39297719, 0, 33817506,
-39469056, 1572864, 33882628, 39534592, 0, 36045343, 42246144, 1,
-36110853, 42270720, 0, 34406924, 39960576, 0, 61014541, 40288256,
-0, 61080083, 41240781, 0, 33817093, 39567360, 1, 34341389,
-39927808, 1, 34406916, 40992768, 0, 33882636, 41025536, 0,
-34079239, 39714816, 0, 34013735, 42352640, 0, 34537998, 40009728,
-0, 35062693, 41291361, 29032448, 34013704, 39747584, 1, 34472463,
-39976960, 1, 34537991, 41107456, 0, 34079246, 41205760, 0,
-34669071, 40140800, 0, 35193766, 41240781, 34340864, 61145625, 41291361,
-0, 33948165, 39600128, 0, 34013702, 39649280, 0, 33882663,
-42303488, 1, 36110855, 42385408, 1, 34341393, 40222720, 0,
-61211556, 41240781, 28966912, 34997159, 40573495, 10747904, 35062294, 40632320,
-0, 35193367, 41324130, 1, 34865683, 40461509, 0, 34931220,
-40517632, 0, 61276693, 40573495, 0, 34800153, 41273550, 1,
-34144776, 39780352, 0, 34472464, 40081976, 0, 35127831, 40755200,
-0, 34603544, 40812544, 0, 35389979, 41517056, 0, 35652127,
-41746432, 0, 35717664, 41869312, 0, 61342241, 41926656, 0,
-36045737, 42156032, 4718592, 35586598, 42213376, 0, 35455516, 41598976,
-0, 35914666, 42041344, 3670016, 35979812, 42098688, 0, 61407781,
-42156032, 0, 35521053, 41615360, 0, 35783595, 41926656, 4718592,
-35848738, 41984000, 0, 61473315, 42041344, 0, 35324446, 41697280,
-0, 61539240, 41926656, 1572864, 35324444, 41484288, 1, 35389981,
-41566208, 1, 35455518, 41648128, 1, 35521051, 41730048, 1,
-35979814, 42188800, 1, 35848740, 42008576, 1, 35783203, 41951232,
-1, 35652129, 41836544, 1, 35586592, 41779200, 1, 35717666,
-41893888, 1, 38928905, 45465600, 0, 38994514, 45531136, 0,
-61604435, 45596672, 0, 33685702, 39337984, 0, 33751554, 39403520,
-0, 60948995, 39469056, 0, 12976666, 41451520, 0, 35914277,
-42131456, 1, 35259308, 45596672, 23068672, 34275850, 39895040, 0,
-34210723, 40288256, 3670016, 34734603, 40353792, 0, 34800146, 40402944,
-0, 33686019, 39436288, 1, 34210315, 39862272, 1, 34275842,
-40861696, 0, 33751562, 40894464, 0, 38601292, 45219840, 0,
-39125588, 45629440, 0, 39060054, 45711360, 0, 38535765, 45760512,
-0, 39453261, 46186496, 0, 39191130, 46235648, 1, 38928979,
-45498368, 1, 39060053, 45662208, 1, 39125586, 45809664, 0,
-38994516, 45907968, 0, 39453270, 46202880, 0, 39584346, 46514176,
-0, 38666844, 46579712, 0, 47448651, 57884672, 0, 39191252,
-57950208, 0, 38470222, 60260352, 0, 38404680, 45121536, 0,
-38470218, 45170688, 0, 38273614, 46317568, 1, 38666827, 60227584,
-1, 9896086, 7995392, 0, 14483607, 13221888, 0, 33554933,
-39092224, 0, 52560093, 66355200, 0, 32834338, 66420736, 0,
-9830912, 66469888, 0, 32899573, 38256640, 0, 9372150, 38305792,
-0, 32834048, 39059456, 1, 32768143, 39149568, 1, 52625908,
-66519040, 0, 33555235, 66584576, 0, 5701718, 4145152, 0,
-60424279, 4194304, 0, 5636148, 37966564, 0, 3473460, 2129920,
-0, 5636181, 4063232, 0, 3407958, 37999333, 1, 9896157,
-13189120, 1, 14614750, 13287424, 0, 14483679, 14319616, 0,
-14549143, 14352384, 0, 14549215, 13254656, 1, 14745824, 13352960,
-0, 14614753, 14254080, 0, 14680286, 14417920, 0, 9109642,
-7127040, 0, 14680289, 13320192, 1, 9044192, 13369344, 0,
-14745739, 14188544, 0, 5570644, 4014080, 0, 5505160, 37502976,
-0, 32440373, 37601280, 0, 32506351, 37666816, 0, 32440816,
-37634048, 1, 32571887, 37748736, 0, 32637425, 37863424, 0,
-32506354, 37912576, 0, 5440429, 3964928, 8388608, 8912979, 37437440,
-0, 3801584, 37732352, 0, 3604537, 2342912, 0, 3735610,
-2359296, 0, 61669458, 3964928, 0, 5374007, 7979008, 1,
-60555319, 2228224, 0, 5374877, 3899392, 8388608, 3604562, 7946240,
-0, 8978568, 7045120, 0, 5505164, 7143424, 0, 8912980,
-37535744, 1, 32702601, 38027264, 0, 9175539, 38141952, 1,
-9175183, 7323648, 0, 32768499, 38092800, 0, 32702604, 38174720,
-0, 9372148, 39182336, 0, 14680202, 13402112, 1, 14811345,
-13434880, 0, 13697248, 14499840, 0, 9044194, 14598144, 0,
-13762769, 12402688, 0, 13697250, 13467648, 1, 14876882, 13500416,
-0, 48431331, 59490304, 0, 14811875, 59555840, 0, 13762787,
-13533184, 1, 14942418, 13582336, 0, 15859940, 14614528, 0,
-14876914, 58179584, 0, 47645397, 58327040, 0, 47710935, 58441728,
-0, 47579864, 58490880, 0, 47514326, 58540032, 0, 15859939,
-58146816, 1, 47513842, 58195968, 0, 14877398, 58294272, 0,
-47579861, 58572800, 1, 13828306, 12484608, 0, 13762788, 13615104,
-1, 15007955, 13647872, 0, 14942437, 14811136, 0, 13828325,
-13680640, 1, 15139046, 13713408, 0, 15007975, 14745600, 0,
-15073491, 14909440, 0, 15073511, 13746176, 1, 15270120, 13778944,
-0, 15139049, 14680064, 0, 15204582, 14974976, 0, 15204585,
-13811712, 1, 15401194, 13844480, 0, 53084395, 67436544, 0,
-15270698, 67502080, 0, 53149928, 67600384, 0, 15336235, 67665920,
-0, 15335659, 13877248, 1, 15401196, 13893632, 0, 15925482,
-15040512, 0, 15466739, 15089664, 0};
+65536, 17825792, 0, 131073, 18006016, 0, 3, 18169856,
+0, 196610, 18251776, 1, 327684, 18481152, 0, 393221,
+18595840, 0, 262151, 18825216, 6291456, 589832, 32079872, 1048576,
+655369, 32129024, 0, 720906, 33225925, 0, 851980, 21757518,
+0, 786442, 32184002, 0, 655371, 33193156, 63111169, 983054,
+21381120, 2097152, 1114128, 63946752, 0, 1179665, 64258048, 0,
+1245199, 64359707, 0, 1048595, 64421888, 0, 917524, 21381120,
+0, 1310738, 64326940, 0, 1376272, 63247076, 0, 1114134,
+63607525, 0, 1441813, 63881216, 0, 1048593, 63913984, 1,
+1507349, 63181540, 0, 1441816, 63541989, 0, 1572887, 63815680,
+0, 1376278, 63848448, 1, 1638423, 63116004, 0, 1572890,
+63476453, 0, 1703961, 63750144, 0, 1507352, 63782912, 1,
+1769497, 63050468, 0, 1703964, 63410917, 0, 1835035, 63684608,
+0, 1638426, 63717376, 1, 1966109, 62701568, 0, 1900571,
+62984932, 0, 1835038, 63345381, 0, 1769500, 63651840, 1,
+2097183, 32555008, 0, 1900574, 62668800, 1, 1966113, 62750720,
+0, 2162720, 62816256, 0, 2228253, 62849024, 0, 2031650,
+62914560, 0, 2359331, 16760832, 0, 2097189, 17320443, 0,
+2424868, 17727488, 0, 2293792, 17760256, 1, 2490404, 16826368,
+0, 2424871, 17254907, 0, 2555942, 17661952, 0, 2359333,
+17694720, 1, 2621478, 16891904, 0, 2555945, 17189371, 0,
+2687016, 17596416, 0, 2490407, 17629184, 1, 2687018, 17123835,
+0, 2752555, 17530880, 0, 2621481, 17563648, 1, 2818092,
+64667648, 0, 2883624, 64733184, 0, 2949163, 16957440, 0,
+3014701, 17465344, 0, 2818090, 17498112, 1, 3080238, 57627364,
+0, 2752559, 57688064, 0, 3145773, 17022976, 0, 3014705,
+17055744, 0, 3211312, 17399808, 0, 2949166, 17432576, 1,
+3342386, 33062912, 0, 3407883, 33225925, 29425664, 3473421, 21757518,
+20971520, 720948, 33193156, 48365569, 3538995, 33013760, 0, 3604530,
+32948224, 1, 3342390, 32980992, 1, 3276851, 33030144, 1,
+3538999, 33128448, 0, 3735608, 31752192, 0, 524345, 32079872,
+0, 3670074, 32407552, 0, 3801142, 32817152, 0, 3801147,
+32604160, 0, 3539002, 32784384, 1, 3866679, 32882688, 1,
+3604534, 33095680, 1, 2097187, 17793024, 0, 3997756, 31506432,
+0, 2293821, 31571968, 0, 4063263, 31784960, 0, 4128830,
+31916032, 0, 3932224, 32243712, 0, 4194367, 32440320, 0,
+2031648, 32522240, 1, 3670073, 31719424, 1, 3735614, 31866880,
+0, 4063295, 31948800, 1, 4128824, 32030720, 0, 4194364,
+32276480, 1, 3801152, 32325632, 0, 3866682, 32571392, 1,
+3932219, 32751616, 0, 4325441, 30179328, 0, 4259907, 30965760,
+0, 4522052, 33225923, 48300032, 4587589, 33280741, 0, 4653126,
+33341440, 0, 4784200, 29720576, 1, 4259906, 30146560, 1,
+4325449, 30228480, 0, 4718657, 30588928, 0, 4390986, 30883840,
+2097152, 4915271, 33341440, 50331648, 4522054, 33247972, 1, 5046348,
+21807104, 9699328, 4587595, 33308672, 46137345, 5111874, 30703616, 0,
+5177422, 31277056, 0, 5242959, 31408128, 0, 2293796, 16728064,
+1, 2359334, 16793600, 1, 2490408, 16859136, 1, 2621519,
+31358976, 0, 5177424, 31440896, 1, 3997731, 31539200, 1,
+5242941, 31588352, 0, 3866705, 32669696, 0, 3604539, 32849920,
+0, 3276855, 32915456, 0, 4456500, 33225939, 44105728, 5308496,
+31670272, 0, 5374005, 21757518, 35651584, 4980818, 21807104, 0,
+3407941, 33193156, 1, 5505107, 22396928, 0, 5636181, 27230208,
+0, 5767255, 21610496, 0, 5439572, 22364160, 1, 5505113,
+22712021, 0, 5898323, 22744788, 0, 5701722, 22806528, 0,
+5963864, 21610496, 7733248, 5832795, 22904832, 0, 1310735, 21413888,
+1, 983127, 21430272, 0, 5963796, 21528576, 0, 5701723,
+21577728, 1, 6094940, 8781824, 0, 6226014, 9207808, 1,
+6029408, 26685898, 0, 6357085, 26791478, 0, 6160481, 26853376,
+0, 6291551, 26886144, 0, 6488162, 34799616, 7208960, 6553699,
+34914304, 0, 6619236, 35094528, 0, 6094949, 8765440, 0,
+6029405, 8814592, 1, 5439582, 523152, 0, 6750310, 9076736,
+0, 6881384, 9142272, 0, 6160479, 9175040, 0, 6684777,
+9338880, 0, 6226026, 394370, 33161216, 6815851, 8937472, 0,
+7143532, 27377664, 0, 7274606, 25116672, 0, 7340143, 25165824,
+0, 7405680, 25288704, 0, 7536754, 26443776, 0, 7209075,
+26509312, 0, 7602260, 180224, 0, 7733365, 27009024, 0,
+7667831, 26935296, 0, 7864438, 27082752, 0, 5570680, 27156480,
+0, 7077974, 27303936, 0, 7798893, 27451392, 0, 6881382,
+9306112, 1, 7995513, 9404416, 0, 6684794, 9592832, 0,
+7929961, 9674752, 0, 7929978, 9371648, 1, 8126587, 9469952,
+0, 7995516, 9527296, 0, 8061049, 9740288, 0, 8061052,
+9437184, 1, 8257661, 9928704, 0, 8126590, 9977856, 0,
+8192123, 10076160, 0, 8192126, 9895936, 1, 8323197, 10534912,
+0, 8454272, 23019520, 0, 8257665, 23085056, 0, 8585346,
+18907136, 1, 8716420, 23658496, 2621440, 8781957, 23773184, 0,
+8519814, 23822336, 0, 6946951, 394351, 22478848, 8912999, 9076736,
+7012352, 8978568, 23445504, 0, 9109642, 27533312, 0, 9175171,
+18907136, 7995393, 8650893, 23658496, 0, 9240716, 24395776, 0,
+9371790, 394351, 0, 9306256, 669025, 0, 9437329, 9781248,
+9437184, 9633938, 27828224, 0, 8847503, 394351, 15400960, 9699467,
+27607040, 0, 9044117, 27459584, 0, 9830548, 27680768, 0,
+9568406, 27754496, 0, 9896083, 27901952, 0, 9765015, 27975680,
+0, 10027160, 8175616, 10682368, 10092697, 8617984, 0, 10223771,
+8306688, 0, 10158237, 8650752, 0, 10158233, 8241152, 0,
+10092701, 8404992, 0, 10027162, 8585216, 1, 10289307, 8683520,
+1, 10354844, 8514844, 0, 10420382, 34144256, 0, 10485919,
+35176448, 0, 9502864, 9814016, 1, 10616993, 60440576, 0,
+9437346, 60489728, 0, 6422691, 34799616, 0, 10682532, 34947072,
+0, 10748069, 35028992, 0, 10813532, 8077312, 0, 10944678,
+42614784, 0, 11010215, 42672128, 0, 11075752, 42729472, 0,
+11206826, 43024384, 17301504, 11272363, 43081728, 0, 10879148, 43147264,
+0, 11403437, 43368448, 0, 11468969, 42729472, 13107200, 11534511,
+42852352, 0, 11600048, 42909696, 0, 11337906, 43286528, 0,
+11731121, 42909696, 4718592, 11796659, 42967040, 0, 11862196, 43024384,
+0, 11665590, 43204608, 0, 11141301, 43024384, 4718592, 11927726,
+43384832, 0, 11927735, 43237376, 8388609, 12058806, 43417600, 1,
+12189881, 43712512, 0, 11993266, 43237376, 1, 11665595, 43253760,
+8388609, 12320954, 43794432, 0, 12255421, 43253760, 7340033, 12452028,
+43876352, 0, 12452025, 43532288, 0, 12124346, 43745280, 1,
+12189884, 43827200, 1, 12320958, 43843584, 1, 12517550, 43335680,
+1, 11403448, 43417600, 5242881, 12124352, 43450368, 0, 12386477,
+43253760, 1, 11337921, 43335680, 8388609, 12714174, 43614208, 0,
+12648639, 43335680, 4194305, 12583106, 43696128, 0, 9961667, 8175616,
+0, 12845210, 8536064, 0, 12910788, 44050664, 0, 10879173,
+44113920, 0, 11272358, 43180032, 1, 12779718, 43946112, 0,
+12976300, 44015616, 0, 13107399, 54272000, 0, 13238473, 56854713,
+0, 13172939, 56934400, 20971520, 13435084, 52535296, 0, 13566158,
+57016320, 1, 13369552, 57402825, 0, 13697231, 57016320, 3801089,
+13631697, 57466880, 0, 13369549, 52502528, 1, 13107404, 53141504,
+0, 13435079, 54222848, 0, 13041864, 54304768, 1, 13762760,
+54345728, 0, 13893843, 53805056, 0, 13828309, 53870592, 0,
+13041876, 54132736, 0, 14090454, 55132160, 0, 14024906, 56854713,
+7929856, 14221528, 52781056, 0, 13959386, 53993472, 0, 14155993,
+52813824, 1, 14221530, 52830208, 0, 13959384, 52928512, 0,
+14287061, 53960704, 1, 14352589, 52592640, 0, 14418139, 52658176,
+0, 14155996, 52723712, 0, 14352604, 52625408, 1, 14418131,
+52969472, 0, 13893851, 53067776, 0, 13828308, 53837824, 1,
+14024925, 55083443, 2097152, 13172950, 56821944, 1, 14614750, 54968320,
+12582912, 14680287, 55027723, 0, 14483680, 55083443, 0, 13304009,
+56901632, 1, 14745810, 54345728, 4718592, 14876898, 56817949, 41811968,
+13304035, 56934400, 0, 15007972, 54850277, 7405568, 14811363, 56785180,
+1, 15073509, 54850276, 10944512, 15139046, 54908918, 0, 14549223,
+54968320, 0, 14876875, 56901632, 12582913, 15270120, 57147392, 0,
+15335657, 57262080, 0, 13697258, 57311232, 0, 15204561, 61554688,
+0, 15204587, 56950784, 0, 13500625, 57049088, 0, 15401166,
+57098240, 0, 13697256, 61587456, 1, 15532268, 52486144, 0,
+15401198, 56983552, 327681, 15663341, 57514552, 0, 15597800, 56983552,
+1, 15204591, 57581568, 0, 15728865, 54419456, 0, 15466733,
+52453376, 1, 15532257, 53190656, 0, 15728876, 53223424, 0,
+14745840, 54452224, 1, 15466737, 52363264, 0, 15859952, 53772288,
+0, 13500651, 57131008, 1, 15991027, 61423616, 0, 16122101,
+61325312, 0, 15925494, 61341696, 0, 16056564, 61505536, 0,
+16056566, 61292544, 1, 16122099, 61374464, 1, 15925492, 61456384,
+1, 15991029, 61472768, 1, 16187609, 55197696, 0, 16253175,
+55853056, 0, 16384249, 55289289, 0, 16515323, 55787520, 0,
+16646397, 55902208, 0, 16318718, 56016896, 0, 16711930, 56070885,
+0, 16449791, 56136421, 0, 16777468, 56169188, 0, 16580864,
+56234724, 0, 16843003, 52007653, 0, 16515330, 52036881, 0,
+16908545, 55721984, 0, 16449788, 55820288, 1, 16187640, 55885824,
+1, 16974071, 56524800, 0, 16253188, 56623104, 0, 17039619,
+56705024, 0, 16646393, 55984128, 1, 16318723, 56459264, 0,
+17039614, 56557568, 0, 16974084, 56737792, 1, 14287109, 54001664,
+0, 17105158, 54072036, 0, 17170647, 55132160, 5242880, 16908551,
+51777182, 0, 17301761, 51881995, 0, 17236232, 55656448, 0,
+16843010, 55754752, 1, 17432841, 54509568, 0, 17498378, 54558720,
+0, 17563915, 54616400, 0, 17629452, 54673408, 0, 17694989,
+56817955, 0, 17760504, 52117504, 0, 17826063, 52174848, 0,
+17367313, 53649408, 0, 17760528, 52207616, 1, 17826065, 53469184,
+0, 17367311, 53501952, 0, 17891593, 53616640, 1, 17891602,
+53575680, 0, 17957139, 53706752, 0, 18022642, 53772288, 4194304,
+14811406, 56817955, 2555904, 18088208, 52232192, 0, 15794452, 52297728,
+0, 18088177, 52330496, 1, 15794451, 53329920, 0, 17957140,
+53362688, 0, 18022674, 53673984, 1, 18153741, 54722560, 0,
+14942485, 54850277, 0, 17629410, 56785186, 8126465, 17236246, 51713730,
+0, 18284808, 51942117, 0, 18219287, 55590912, 0, 17301767,
+55689216, 1, 18350359, 51609600, 0, 18219289, 51642368, 0,
+18415896, 55525376, 0, 18284822, 55623680, 1, 18415898, 51376482,
+0, 18546968, 51473691, 0, 18481435, 55459840, 0, 18350361,
+55558144, 1, 131075, 18219008, 0, 18678044, 18317312, 0,
+196894, 31080448, 0, 18809117, 31145984, 0, 18940192, 17924096,
+0, 18874652, 18071552, 0, 18678049, 18104320, 0, 18612509,
+18284544, 1, 19071266, 18366464, 0, 18743587, 30998528, 0,
+19005727, 31227904, 0, 19005731, 18399232, 1, 19202340, 18432000,
+0, 19070982, 18595840, 4194304, 19267874, 18661376, 0, 19136806,
+18710528, 0, 459045, 18825216, 0, 19398951, 22475052, 4456448,
+19530025, 16135684, 0, 19464491, 16482304, 1, 19661098, 16515072,
+0, 19726636, 64536576, 0, 19595565, 64602112, 0, 19661102,
+15843328, 0, 19530028, 16547840, 1, 19792175, 16580608, 0,
+19923242, 57753600, 0, 19857712, 57814299, 0, 19792177, 15908864,
+0, 20054319, 16203776, 0, 19857710, 16613376, 1, 19988786,
+16646144, 0, 20054321, 16678912, 1, 3145777, 17367040, 1,
+20119858, 29261824, 0, 18612531, 29327360, 0, 20185090, 29360128,
+0, 3211572, 29425664, 0, 20250672, 21626880, 0, 19988790,
+29523968, 0, 20316471, 29589504, 0, 4784437, 29622272, 0,
+4718665, 29687808, 0, 20382008, 29982720, 0, 20578617, 28393472,
+0, 20709691, 30015488, 0, 20644154, 30605312, 0, 20447543,
+29949952, 1, 20644156, 30048256, 1, 20382011, 30294016, 0,
+20709688, 30392320, 0, 20840765, 30097408, 0, 20775231, 30818304,
+0, 4849982, 30883840, 0, 20971595, 33341440, 51380224, 21037133,
+21807104, 76546048, 4915520, 33308672, 20971521, 21102664, 29810688, 0,
+21168450, 29868032, 0, 21102915, 29835264, 1, 20775230, 30130176,
+1, 21168445, 30441472, 0, 20840770, 30474240, 0, 20447555,
+29925376, 0, 20906300, 30736384, 0, 21299524, 18792448, 0,
+21430598, 28082176, 0, 21365061, 28147712, 0, 21496132, 16252928,
+0, 21233989, 18759680, 1, 21561672, 28491776, 0, 21627209,
+28557312, 0, 21692746, 28737536, 0, 21299531, 28803072, 0,
+21496140, 15646720, 0, 21823812, 15939076, 0, 21233992, 16285696,
+1, 21758285, 16318464, 0, 21758286, 15712256, 0, 21954893,
+16004612, 0, 21823820, 16351232, 1, 21889359, 16384000, 0,
+21889323, 15777792, 0, 19464527, 16070148, 0, 21954894, 16416768,
+1, 19595561, 16449536, 0, 22085968, 28327936, 1048576, 20513105,
+29179904, 0, 22151488, 33341440, 76546048, 22217025, 21807104, 101711872,
+20971858, 33308672, 1, 21758280, 15613952, 1, 21889356, 15679488,
+1, 19595598, 15745024, 1, 21496137, 28459008, 1, 21561681,
+28606464, 0, 20513067, 29097984, 0, 22085945, 29212672, 1,
+22348116, 28639232, 0, 22282582, 28835840, 0, 22544727, 42446976,
+1114112, 22610264, 42500929, 0, 22413658, 62586880, 27000832, 22020437,
+28327936, 0, 22479186, 42446976, 0, 21692741, 28770304, 1,
+22413652, 28868608, 1, 22282571, 28950528, 0, 21299542, 28983296,
+0, 22806875, 33915281, 20447232, 22544729, 42468160, 33226753, 22872403,
+21807104, 122683392, 22741341, 33915281, 0, 22151512, 42414207, 1,
+23003486, 29037956, 0, 23069017, 42500929, 71892992, 22937952, 42549248,
+0, 22675807, 62586880, 0, 23134556, 33915281, 90046464, 23069025,
+33977060, 0, 22610272, 42468160, 1, 23265634, 19087360, 0,
+23396708, 62570496, 327680, 23462245, 63995904, 0, 23200102, 64058084,
+0, 23527779, 64156389, 0, 23331176, 62570496, 0, 23593319,
+64159744, 0, 23658856, 61926684, 0, 23396714, 62221595, 0,
+23724393, 62504960, 0, 23593317, 62537728, 1, 23855467, 21348352,
+0, 23921004, 22577152, 0, 23789864, 22609920, 0, 23986541,
+22513580, 0, 23200099, 19120128, 1, 23265643, 19136512, 0,
+23855458, 19234816, 0, 23789932, 21315584, 1, 24052073, 61861148,
+0, 23724400, 62156059, 0, 24117615, 62439424, 0, 23658858,
+62472192, 1, 24183151, 61795612, 0, 24117618, 62090523, 0,
+24248689, 62373888, 0, 24052080, 62406656, 1, 24314225, 61730076,
+0, 24248692, 62024987, 0, 24379763, 62308352, 0, 24183154,
+62341120, 1, 24510837, 28033024, 0, 24445299, 61664540, 0,
+24379766, 61959451, 0, 24314228, 62275584, 1, 24445302, 28000256,
+1, 24510791, 28082176, 524288, 24576373, 28180480, 0, 21234039,
+28246016, 0, 24707448, 786432, 0, 24772985, 901120, 0,
+24641915, 6356992, 0, 24838524, 10687782, 15663104, 24904059, 10720551,
+1, 24838525, 11075584, 4194304, 25100670, 20459873, 0, 25035136,
+20676608, 0, 25297281, 20545536, 0, 25166206, 20643840, 1,
+25035139, 22102016, 0, 25362818, 22167552, 0, 25428352, 22265856,
+0, 25231748, 22331392, 0, 25559429, 10999491, 0, 25493895,
+36061184, 23592960, 25559432, 4882432, 0, 25493894, 10966722, 1,
+25690505, 11067392, 0, 25821573, 1015808, 0, 25952651, 2965504,
+8388608, 26018188, 3014656, 0, 26083725, 3129344, 0, 26149257,
+4325376, 0, 25756040, 11034624, 1, 25756026, 901120, 8388608,
+26214785, 20299776, 0, 26280336, 20348928, 0, 25297297, 20398080,
+0, 25231746, 20512768, 1, 26345871, 4325376, 10485760, 26411410,
+4440064, 0, 26542484, 4538368, 0, 26608021, 4587520, 0,
+26739095, 294912, 12582912, 26870169, 6537216, 4194305, 26935704, 19292160,
+0, 25166235, 20611072, 0, 25231760, 20267008, 1, 27001217,
+20709376, 0, 27066780, 20824064, 0, 26214813, 20873216, 0,
+27197854, 5046272, 12582912, 27263391, 5554176, 0, 27394465, 5734400,
+0, 27460002, 5783552, 0, 27591076, 4997120, 4194304, 27132325,
+5046272, 0, 27656611, 5865472, 0, 27787687, 3506176, 0,
+27525545, 4997120, 0, 27722150, 5947392, 0, 25690538, 5128192,
+0, 27918763, 36995072, 0, 27984275, 37076992, 0, 28115372,
+5226496, 0, 28180909, 36864000, 0, 26476974, 37109760, 0,
+26476947, 4456448, 0, 27984302, 36929536, 0, 26411435, 37044224,
+1, 28180884, 37142528, 1, 28311983, 2883584, 8388608, 28443057,
+3129344, 20971520, 28508594, 3178496, 0, 25887152, 2965504, 0,
+28377486, 3129344, 12582912, 25625012, 36061184, 0, 28639622, 36159488,
+0, 28574133, 36274176, 0, 28770742, 3276800, 0, 28836264,
+3506176, 8388608, 27853241, 4915200, 0, 28901815, 36306944, 0,
+28574135, 35995648, 0, 28901813, 36225024, 0, 28639668, 36241408,
+1, 28770745, 36339712, 1, 24838520, 6389760, 1, 28967291,
+10567680, 0, 24641979, 10665984, 0, 29032890, 13041664, 0,
+29032892, 770048, 0, 29163962, 933888, 0, 29098429, 12845056,
+0, 28967355, 13074432, 1, 29163964, 12877824, 1, 29229501,
+12926976, 0, 29098431, 13025280, 0, 29295038, 13107200, 0,
+29229503, 13139968, 1, 29360574, 34291712, 0, 29295041, 34521088,
+0, 29426112, 34734080, 0, 29557186, 34701312, 0, 29557184,
+34357248, 0, 29426114, 34455552, 0, 29491651, 34668544, 1,
+29360577, 34766848, 1, 29688260, 1228800, 0, 29819334, 38813696,
+1, 29884869, 66682880, 0, 29753800, 66748416, 0, 29950407,
+66781184, 0, 29622729, 66846720, 0, 30015939, 1267701, 0,
+30081482, 47284224, 0, 30146697, 9277087, 0, 9503180, 9781248,
+0, 30146705, 9814016, 1048577, 10551757, 34553856, 0, 30278092,
+60588032, 0, 30212558, 60637184, 0, 30146943, 345477, 0,
+26804687, 6537216, 1, 30343305, 8896512, 0, 8978892, 9244318,
+1, 29491664, 34111488, 0, 30474400, 34652160, 0, 30409169,
+35241984, 0, 30474701, 34045952, 0, 10551456, 34209792, 0,
+30212257, 34586624, 1, 10486225, 34619392, 1, 30605778, 98304,
+0, 26673620, 294912, 0, 30802389, 589824, 1, 30540142,
+22513580, 6881280, 30933463, 33357824, 0, 31064537, 6963200, 1,
+31195611, 7258112, 8388608, 31326685, 33652736, 0, 19333596, 22475052,
+0, 31392216, 33431552, 0, 31457759, 33505280, 0, 31261152,
+33579008, 0, 31523294, 33726464, 0, 31588833, 33800192, 0,
+30867938, 33873920, 0, 31064547, 6881280, 0, 30999002, 6995968,
+0, 31654372, 7741440, 1441792, 31785433, 21856256, 0, 31850966,
+622592, 0, 31719911, 7741440, 0, 30802405, 21938176, 0,
+30999013, 21823488, 1, 31785430, 21905408, 1, 30343578, 6504448,
+0, 31982031, 6553600, 0, 32047592, 7921664, 0, 26870250,
+22052864, 0, 30736875, 622592, 14680064, 32244201, 7921664, 11862016,
+32113109, 21970944, 0, 30736874, 22003712, 1, 32113050, 22020096,
+1, 32178662, 622592, 10485760, 31916524, 7798784, 0, 31654381,
+6815744, 0, 32309742, 7544832, 0, 31916515, 7774208, 1,
+32440807, 7831552, 1, 32506344, 6619136, 0, 32571888, 7725056,
+0, 32244210, 7831552, 8912897, 31982060, 7888896, 1, 32375281,
+7602176, 0, 32637423, 7831552, 1572865, 32309747, 6750208, 0,
+32702964, 7348224, 0, 32375277, 7577600, 1, 32834030, 7634944,
+1, 32899568, 6684672, 0, 32965110, 7528448, 0, 32571896,
+7634944, 8912897, 32506353, 7692288, 1, 32768503, 7405568, 0,
+33030645, 7634944, 1572865, 33096182, 524288, 0, 32768499, 7380992,
+1, 32965108, 7438336, 1, 32899575, 7495680, 1, 32702970,
+8978432, 0, 33161721, 9830400, 0, 33227219, 49152, 0,
+30671356, 212992, 0, 33358331, 20938752, 0, 33292798, 21200896,
+0, 33423869, 21266432, 0, 33489302, 4587520, 8388608, 33554943,
+4702208, 0, 28049921, 5275648, 0, 33751554, 4718592, 0,
+33817091, 4833280, 0, 33948165, 5324800, 0, 33882631, 5406720,
+0, 33686016, 4702208, 8388608, 33620486, 5324800, 8388608, 34079229,
+21020672, 0, 34144776, 21069824, 0, 33423881, 21118976, 0,
+33358334, 21233664, 1, 34275850, 6045696, 0, 34341387, 6094848,
+0, 34472461, 37257216, 0, 34537996, 58638336, 0, 34669072,
+19365888, 0, 34406930, 37175296, 0, 34800143, 58638336, 8388608,
+34603540, 58703872, 0, 34996757, 58834944, 0, 34931219, 58900480,
+0, 34865686, 58966016, 0, 35127831, 5685248, 8388608, 35258905,
+19365888, 46137344, 27329050, 19480576, 0, 35389979, 35291136, 0,
+35455516, 35340288, 0, 35521053, 35389440, 0, 35193361, 19365888,
+8388608, 35586584, 19398656, 0, 35324447, 6176768, 0, 35717664,
+5455872, 0, 35652130, 6258688, 0, 34734627, 37355520, 0,
+34013729, 5455872, 8388608, 34210308, 5963776, 0, 35848718, 37339136,
+0, 35783198, 35471360, 0, 35914144, 5570560, 0, 35062308,
+5685248, 0, 36045349, 58736640, 0, 36176423, 59162624, 0,
+36241960, 59211776, 0, 36110890, 59244544, 0, 36307494, 59326464,
+0, 35979817, 59392000, 0, 35979814, 58769408, 1, 34931222,
+58802176, 1, 34996773, 59015168, 0, 36045333, 59047936, 0,
+33096186, 9863168, 1, 8389163, 10436608, 0, 36438143, 10534912,
+5242880, 36504108, 22986752, 0, 36569593, 23150592, 0, 36635182,
+23216128, 0, 36700717, 23314432, 0, 33161776, 23379968, 0,
+36831793, 18956288, 0, 36766255, 19038208, 0, 36897330, 24248320,
+0, 36373043, 24313856, 0, 36766258, 18989056, 1, 37028404,
+23478272, 0, 36831797, 23527424, 0, 36962870, 24150016, 0,
+37093937, 24215552, 0, 37028402, 23560192, 1, 37225015, 23592960,
+0, 37290549, 23871488, 0, 36831802, 23969792, 0, 37356088,
+24035328, 0, 37159481, 24061058, 0, 8519820, 18874368, 0,
+37159480, 23625728, 1, 37421623, 24461312, 0, 9175611, 24526848,
+0, 37225020, 24625152, 0, 37486722, 24690688, 0, 37618237,
+25001984, 0, 37683774, 25051136, 0, 37552704, 25993216, 0,
+37749313, 26263552, 0, 37880383, 26279936, 0, 37945922, 26345472,
+0, 7471683, 25378816, 0, 37814385, 26066944, 0, 37945924,
+25411584, 4194305, 38142533, 25694948, 0, 37880387, 26378240, 1,
+38076994, 26624000, 0, 38010994, 25411584, 1, 38273607, 25849115,
+0, 7471219, 26411008, 1, 7537224, 26558464, 0, 38208070,
+25772032, 0, 38076998, 25727717, 1, 38142535, 25804800, 1,
+38208072, 25881884, 1, 38339135, 25444352, 0, 38077001, 25624576,
+0, 37683778, 26312704, 1, 37880389, 26656768, 1, 7209546,
+25575424, 0, 38404680, 25919488, 0, 7536750, 26476544, 1,
+38273139, 26591232, 1, 38404681, 25509888, 0, 38339141, 25657344,
+1, 38273610, 25886720, 1, 31130187, 7258112, 0, 38470220,
+10223616, 0, 38601178, 24723456, 0, 38535757, 24788992, 0,
+38666356, 180224, 8388608, 7012943, 10108928, 0, 38732366, 10321920,
+0, 38470222, 10207232, 0, 38535755, 10256384, 1, 38666831,
+10289152, 1, 38732364, 10371072, 0, 38863440, 25346048, 0,
+38797889, 26083328, 0, 37749329, 26181632, 0, 37814848, 26230784,
+1, 38601292, 24821760, 1, 38863437, 24870912, 0, 38535760,
+24903680, 0, 38797905, 25313280, 1, 38994514, 49709056, 0,
+39125588, 49922048, 0, 38928981, 49987584, 0, 39191122, 49070080,
+0, 38994519, 49094656, 0, 39256662, 49643520, 0, 38928979,
+49676288, 1, 39256664, 48906240, 0, 39387734, 49004544, 0,
+39322201, 49577984, 0, 39191127, 49610752, 1, 39060058, 47146869,
+0, 39453275, 47218688, 0, 39649884, 11698176, 0, 39584347,
+47038464, 0, 39453277, 47071232, 0, 39518810, 47185920, 1,
+39715411, 49758208, 0, 39780958, 49823744, 0, 39060063, 50003968,
+0, 39846484, 11354112, 0, 39060064, 11386880, 1, 39912031,
+11812864, 0, 39846497, 11993088, 0, 39780948, 50036736, 1,
+40043106, 19531786, 0, 39977572, 19603456, 0, 40174179, 50921472,
+0, 40305254, 50569216, 0, 40108642, 19636224, 1, 40305252,
+50421760, 0, 39977574, 50520064, 0, 40239719, 50536448, 1,
+40108640, 11405322, 0, 40370791, 50357704, 0, 40436328, 19677184,
+0, 40567402, 19775488, 0, 40632937, 19862244, 0, 40764013,
+11927552, 0, 40698467, 12075008, 0, 40174190, 12173312, 0,
+40043109, 50954240, 1, 40239723, 50324402, 0, 40501871, 19824640,
+6291456, 40895084, 20185088, 0, 18481777, 51310946, 0, 41025819,
+51539227, 0, 40960626, 55394304, 0, 18546970, 55492608, 1,
+41157235, 55328768, 655360, 41026161, 55427072, 1, 41222772, 67174400,
+0, 40960629, 67300636, 0, 41288306, 67332106, 0, 41091703,
+55328768, 0, 41353846, 67403776, 0, 41157240, 51183616, 0,
+41484919, 51412992, 0, 41353844, 55361536, 1, 41550457, 66928640,
+0, 41419387, 67125248, 0, 41747068, 51134464, 0, 41681534,
+56328192, 0, 41878141, 56360960, 0, 41812602, 67010560, 0,
+41615999, 67043328, 0, 40829568, 19824640, 0, 41747056, 20185088,
+14680064, 41681533, 51167232, 1, 41943681, 20070400, 0, 42074748,
+20168704, 0, 42140290, 50633272, 0, 42009220, 50666574, 0,
+42205827, 50880512, 0, 42271333, 19986422, 0, 42336901, 20045824,
+0, 42271366, 20013056, 1, 42205829, 50733056, 0, 42336899,
+50831360, 0, 42140292, 50913280, 1, 42402438, 11532278, 0,
+42467975, 11583488, 0, 39518856, 46962827, 0, 42402440, 11550720,
+1, 42599049, 11911168, 0, 42533511, 12189696, 0, 42467978,
+12288000, 0, 39322251, 48709632, 0, 42730073, 48807936, 0,
+42664588, 49512448, 0, 39387736, 49545216, 1, 42664589, 48644096,
+0, 42861196, 48873472, 0, 42795662, 49446912, 0, 42730123,
+49479680, 1, 42795663, 48447488, 0, 42992270, 48545792, 0,
+42926736, 49381376, 0, 42861197, 49414144, 1, 42926737, 48381952,
+0, 43123344, 48611328, 0, 43057810, 49315840, 0, 42992271,
+49348608, 1, 43057811, 48321252, 0, 43188882, 49258496, 0,
+43123345, 49283072, 1, 43188884, 48195901, 0, 43123347, 49225728,
+1, 39584349, 11665408, 1, 39649941, 46743552, 0, 43385436,
+46841856, 0, 43319958, 46891008, 0, 43385493, 46858240, 1,
+43319959, 47595520, 0, 43516566, 47693824, 0, 43647641, 47726592,
+0, 43451034, 47792128, 0, 43713176, 50184192, 0, 43778706,
+48290686, 0, 43254428, 49196316, 0, 43909789, 47890432, 0,
+43254430, 48070656, 0, 43844252, 48103424, 0, 43778708, 49163547,
+1, 43582106, 47759360, 1, 43844254, 47857664, 1, 43647645,
+47906816, 0, 43909785, 48005120, 0, 44040863, 60126377, 6488064,
+44171937, 47538176, 0, 43975328, 60159146, 1, 44040866, 60178432,
+0, 44171936, 60211200, 1, 44040867, 66256896, 2097152, 44368548,
+45973504, 1, 44434085, 46612480, 0, 44499622, 46675460, 0,
+44106402, 47570944, 1, 44565153, 60325888, 0, 44303016, 60391424,
+0, 44237479, 66256896, 0, 44696233, 11282749, 0, 44761770,
+59883520, 0, 44892844, 66158592, 0, 45023918, 45359104, 0,
+45089455, 61145088, 0, 44630704, 61210624, 0, 44958385, 66076672,
+0, 45154989, 66158592, 4063232, 44827296, 66207744, 0, 45286066,
+6479872, 0, 45417140, 59736064, 0, 45482677, 59785216, 0,
+45351603, 60735488, 0, 45548214, 60817408, 0, 45220535, 60882944,
+0, 45482666, 11599872, 0, 45417142, 59817984, 1, 44696248,
+59850752, 6291457, 45679275, 59899904, 0, 45744825, 60014592, 0,
+45810362, 60063744, 0, 43975355, 60126377, 0, 45744827, 60030976,
+1, 45679290, 59981824, 1, 45941436, 60801024, 6291456, 45351605,
+59703296, 1, 45613739, 59850752, 1, 44761785, 59932672, 1,
+45875892, 60801024, 0, 45810335, 60159146, 8716289, 44696246, 11632640,
+1, 43582122, 50085888, 0, 45482651, 50249728, 0, 24904382,
+10687782, 0, 46138047, 1605632, 0, 46203584, 1654784, 0,
+46334658, 38387712, 0, 46269124, 38404096, 0, 46531269, 1474560,
+3145728, 46072518, 1523712, 0, 46662343, 1064960, 0, 46727548,
+10720551, 9633793, 24969928, 11075584, 0, 46596803, 1114112, 0,
+46465726, 1474560, 0, 46006985, 10720551, 14417921, 46793409, 1654784,
+6291456, 46858954, 1703936, 0, 46400204, 38518784, 0, 46990027,
+1703936, 6291456, 46924494, 38633472, 0, 47055567, 38715392, 0,
+47252176, 38551552, 0, 29753799, 38846464, 0, 47186374, 38895616,
+0, 29819602, 38928384, 0, 47121105, 38764544, 0, 47448787,
+1343488, 0, 25821909, 10882944, 0, 47382922, 11190272, 0,
+47579861, 1392640, 0, 47645398, 10747904, 0, 47514328, 10915713,
+4194305, 46006999, 10829824, 0, 47710602, 10915713, 1, 47842009,
+4194304, 4194304, 47907546, 4308992, 0, 48038620, 2179072, 0,
+47973086, 2588672, 0, 48169691, 35520512, 0, 48300768, 35815424,
+0, 48235231, 35962880, 0, 47907549, 58069732, 0, 48038619,
+58102501, 1, 48431842, 35684352, 0, 47514339, 35864576, 0,
+47514335, 35586048, 0, 48235235, 35749888, 0, 48431829, 35897344,
+1, 48169696, 35930112, 1, 48562916, 2752512, 0, 48628453,
+2867200, 0, 48759527, 3768320, 0, 48825064, 3817472, 0,
+48497386, 2736128, 4194304, 49021675, 2228224, 4194304, 49087209, 3899392,
+0, 48825068, 58053349, 0, 49021673, 58020580, 1, 49152737,
+2015232, 0, 48104175, 2637824, 0, 49283822, 6324224, 0,
+49414897, 2424832, 0, 49349356, 2506752, 0, 48890611, 2736128,
+0, 49218290, 2424832, 8388608, 49480432, 6324224, 8388608, 49611508,
+3637248, 12582912, 48694005, 3686400, 0, 49742582, 2064384, 0,
+28246776, 2883584, 0, 49873655, 36388864, 0, 49808121, 36765696,
+0, 49939174, 3342336, 0, 50004408, 3506176, 37748736, 50070267,
+3588096, 0, 49545980, 3637248, 0, 28705203, 3260416, 0,
+49677050, 3424256, 0, 48366333, 36519936, 0, 50201300, 36618240,
+0, 50135806, 36732928, 0, 50135801, 36454400, 0, 49808126,
+36683776, 0, 50201341, 36700160, 1, 49873656, 36798464, 1,
+50332415, 12369920, 0, 50397952, 44204032, 0, 50266882, 44367872,
+0, 50463489, 44449792, 0, 50529025, 44269568, 0, 50397954,
+44482560, 1, 50594563, 44510917, 0, 50463492, 44957696, 0,
+50660045, 1785856, 0, 50725637, 1835008, 0, 47317766, 1949696,
+0, 50266880, 12337152, 1, 50790859, 47284224, 4194304, 50922248,
+47316992, 0, 50856703, 47382528, 0, 50332423, 47480832, 0,
+10289929, 8331264, 0, 50529028, 44543686, 1, 51053322, 44572672,
+0, 50594571, 44954341, 0, 51118851, 46362977, 0, 50987788,
+46424064, 0, 51184394, 44323928, 0, 50987787, 44605440, 1,
+51249933, 44633056, 0, 51053326, 44887324, 0, 51184398, 44665825,
+1, 51381007, 44695552, 0, 51249936, 44810240, 0, 51446541,
+65945600, 0, 51315473, 66011136, 0, 51315472, 44728320, 1,
+51512079, 64765952, 0, 51381011, 65257472, 0, 51577618, 65536000,
+0, 51643154, 64831488, 0, 51577621, 65191936, 0, 51512083,
+65568768, 1, 51708692, 65601536, 0, 51774228, 64897024, 0,
+51708695, 65126400, 0, 51643157, 65634304, 1, 51839766, 65667072,
+0, 51905302, 64962560, 0, 51839769, 65060864, 0, 51774231,
+65699840, 1, 51970840, 65732608, 0, 52036376, 65290240, 0,
+51970843, 65519616, 0, 51905305, 65765376, 1, 52101914, 65798144,
+0, 52167450, 65355776, 0, 52101917, 65454080, 0, 52036379,
+65830912, 1, 52232988, 65863680, 0, 52364062, 45023232, 0,
+52298524, 51003392, 0, 52232991, 51101696, 0, 52167453, 65896448,
+1, 52298527, 45056000, 1, 44368672, 45285376, 0, 44303013,
+45940736, 0, 52363940, 46055424, 0, 52429598, 46284800, 0,
+52560673, 11254086, 9175040, 44106531, 46089305, 0, 52691617, 59633792,
+0, 52757282, 60981248, 0, 52822821, 61046784, 0, 52626214,
+61112320, 0, 52495143, 11254086, 0, 52888356, 59637760, 0,
+44106532, 59601023, 1, 52691751, 59670528, 1, 52888253, 60801024,
+16777216, 53019432, 13926400, 1, 53150506, 13959168, 0, 52953899,
+15319040, 0, 53084969, 15351808, 0, 53084971, 13991936, 1,
+53281580, 14024704, 0, 53150509, 15253504, 0, 53216042, 15417344,
+0, 53216045, 14057472, 1, 53412654, 14090240, 0, 53281583,
+15187968, 0, 53347116, 15482880, 0, 53543728, 12533760, 0,
+53412658, 12632064, 0, 53347119, 14123008, 1, 53478190, 15548416,
+0, 53674801, 38993920, 0, 53609267, 39239680, 0, 53740339,
+11730944, 0, 53609269, 12681216, 0, 53674802, 39206912, 1,
+53936950, 41402368, 0, 53871412, 41418752, 1, 54068024, 12746752,
+0, 53805881, 12801730, 0, 54002487, 39297719, 0, 54199098,
+39469056, 1572864, 54264635, 39534592, 0, 54395709, 42246144, 1,
+54461244, 42270720, 0, 54592320, 39960576, 0, 54657857, 40288256,
+0, 54788931, 41240781, 0, 54199100, 39567360, 1, 54526785,
+39927808, 1, 54592315, 40992768, 0, 54264640, 41025536, 0,
+54920005, 39714816, 0, 54854463, 42352640, 0, 55051079, 40009728,
+0, 55182153, 41291361, 29032448, 54854470, 39747584, 1, 54985544,
+39976960, 1, 55051077, 41107456, 0, 54920007, 41205760, 0,
+55247688, 40140800, 0, 55378764, 41240781, 34340864, 55116621, 41291361,
+0, 55444284, 39600128, 0, 54854478, 39649280, 0, 54264639,
+42303488, 1, 54461253, 42385408, 1, 54526795, 40222720, 0,
+55313220, 41240781, 28966912, 55575375, 40573495, 10747904, 55182160, 40632320,
+0, 55378762, 41324130, 1, 55640899, 40461509, 0, 55706449,
+40517632, 0, 55509842, 40573495, 0, 54723405, 41273550, 1,
+55771974, 39780352, 0, 54985556, 40081976, 0, 55903050, 40755200,
+0, 55837525, 40812544, 0, 56034134, 41517056, 0, 56099645,
+41746432, 0, 56165208, 41869312, 0, 56230745, 41926656, 0,
+54395739, 42156032, 4718592, 54330174, 42213376, 0, 56361815, 41598976,
+0, 56492893, 42041344, 3670016, 56558430, 42098688, 0, 56296287,
+42156032, 0, 56623964, 41615360, 0, 56755041, 41926656, 4718592,
+56820578, 41984000, 0, 56427363, 42041344, 0, 55968608, 41697280,
+0, 56689498, 41926656, 1572864, 55968599, 41484288, 1, 56034140,
+41566208, 1, 56361824, 41648128, 1, 56623958, 41730048, 1,
+56558398, 42188800, 1, 56820574, 42008576, 1, 56755043, 41951232,
+1, 56099673, 41836544, 1, 54330200, 41779200, 1, 56165218,
+41893888, 1, 56886099, 45465600, 0, 56951652, 45531136, 0,
+57017189, 45596672, 0, 57082676, 39337984, 0, 57148263, 39403520,
+0, 54133608, 39469056, 0, 53740342, 41451520, 0, 56492895,
+42131456, 1, 53871462, 45596672, 23068672, 57279337, 39895040, 0,
+57213762, 40288256, 3670016, 57344874, 40353792, 0, 54723435, 40402944,
+0, 57082728, 39436288, 1, 57213802, 39862272, 1, 57279335,
+40861696, 0, 57148265, 40894464, 0, 57475948, 45219840, 0,
+57607022, 45629440, 0, 57541488, 45711360, 0, 57410415, 45760512,
+0, 57738093, 46186496, 0, 57672561, 46235648, 1, 56886117,
+45498368, 1, 57541487, 45662208, 1, 57607012, 45809664, 0,
+56951662, 45907968, 0, 57738096, 46202880, 0, 57803633, 46514176,
+0, 52429682, 46579712, 0, 57934707, 57884672, 0, 57672564,
+57950208, 0, 57869088, 60260352, 0, 58000158, 45121536, 0,
+57869173, 45170688, 0, 52298528, 46317568, 1, 52429683, 60227584,
+1, 58131318, 7995392, 0, 58196855, 13221888, 0, 58327929,
+39092224, 0, 58393464, 66355200, 0, 58262395, 66420736, 0,
+58065786, 66469888, 0, 58459001, 38256640, 0, 58524540, 38305792,
+0, 58262394, 39059456, 1, 58590077, 39149568, 1, 58655614,
+66519040, 0, 58327935, 66584576, 0, 58786688, 4145152, 0,
+47776641, 4194304, 0, 58720989, 37966564, 0, 58852061, 2129920,
+0, 58721155, 4063232, 0, 48038784, 37999333, 1, 58131320,
+13189120, 1, 59048836, 13287424, 0, 58196869, 14319616, 0,
+58983287, 14352384, 0, 58983301, 13254656, 1, 59179910, 13352960,
+0, 59048839, 14254080, 0, 59114372, 14417920, 0, 59310984,
+7127040, 0, 59114375, 13320192, 1, 59245446, 13369344, 0,
+59179913, 14188544, 0, 58917770, 4014080, 0, 59376523, 37502976,
+0, 59507586, 37601280, 0, 59573132, 37666816, 0, 59507597,
+37634048, 1, 59638668, 37748736, 0, 59704206, 37863424, 0,
+59573135, 37912576, 0, 59835280, 3964928, 8388608, 59442065, 37437440,
+0, 59900813, 37732352, 0, 60031891, 2342912, 0, 59966354,
+2359296, 0, 59769749, 3964928, 0, 60097428, 7979008, 1,
+48956308, 2228224, 0, 60097261, 3899392, 8388608, 60031893, 7946240,
+0, 60162955, 7045120, 0, 59376535, 7143424, 0, 59442058,
+37535744, 1, 60294038, 38027264, 0, 60228504, 38141952, 1,
+60228477, 7323648, 0, 58590104, 38092800, 0, 60294039, 38174720,
+0, 58524542, 39182336, 0, 59114376, 13402112, 1, 60425113,
+13434880, 0, 60359558, 14499840, 0, 59245466, 14598144, 0,
+60490649, 12402688, 0, 60359578, 13467648, 1, 60556187, 13500416,
+0, 60621724, 59490304, 0, 60425117, 59555840, 0, 60490652,
+13533184, 1, 60687259, 13582336, 0, 60752798, 14614528, 0,
+60556191, 58179584, 0, 60883872, 58327040, 0, 60949409, 58441728,
+0, 61014946, 58490880, 0, 60818339, 58540032, 0, 60752796,
+58146816, 1, 60818335, 58195968, 0, 60556195, 58294272, 0,
+61014944, 58572800, 1, 61080475, 12484608, 0, 60490654, 13615104,
+1, 61146020, 13647872, 0, 60687269, 14811136, 0, 61080485,
+13680640, 1, 61277094, 13713408, 0, 61146023, 14745600, 0,
+61211556, 14909440, 0, 61211559, 13746176, 1, 61408168, 13778944,
+0, 61277097, 14680064, 0, 61342630, 14974976, 0, 61342633,
+13811712, 1, 52954026, 13844480, 0, 61539112, 67436544, 0,
+61408171, 67502080, 0, 61604776, 67600384, 0, 61473708, 67665920,
+0, 61473576, 13877248, 1, 52953897, 13893632, 0, 61670314,
+15040512, 0, 53019565, 15089664, 0};
 extern const uint32_t e1m1_WADSubSectors[448] = {
 4, 262147, 458755, 655363, 851973, 1179650, 1310724, 1572868,
 1835012, 2097156, 2359300, 2621446, 3014660, 3276804, 3538948, 3801093,
@@ -2539,680 +1677,1267 @@ extern const uint32_t e1m1_WADSubSectors[448] = {
 89325574, 89718790, 90112003, 90308611, 90505220, 90767364, 91029508, 91291652,
 91553796, 91815939, 92012548, 92274691, 92471301, 92798980, 93061124, 93323269,
 93650948, 93913092, 94175236, 94437380, 94699524, 94961668, 95223814, 95617028};
-extern const uint32_t e1m1_WADSectors[1300] = {
-220203680, 1397641027, 3235633, 1413565510, 12850, 524543, 178257920, 1329794336,
-1597068110, 1279655991, 842159169, 16711680, 8, 246416320, 1330596934, 828323666,
-1263755078, 12633, 255, 115343360, 1279658336, 928141135, 1598435679, 827935571,
-16711680, 0, 99614960, 1330596934, 945763410, 1279870275, 3497779, 160,
-26214400, 1279659136, 875648065, 1162018816, 1597197385, 10485813, 0, 209715760,
-1413565510, 13361, 1279870275, 3497779, 160, 47185920, 1279659136, 875648065,
-1162018816, 1597197385, 10485813, 0, 209716080, 1413565510, 13361, 1279870275,
-3497779, 160, 68157440, 1279659136, 875648065, 1162018816, 1597197385, 10485813,
-0, 209716400, 1413565510, 13361, 1279870275, 3497779, 160, 99614720,
-1279659136, 875648065, 1162018816, 1597197385, 10485813, 0, 209716880, 1413565510,
-13361, 1279870275, 3497779, 160, 120586240, 1279659136, 875648065, 1162018816,
-1597197385, 10485813, 0, 209717200, 1413565510, 13361, 1279870275, 3497779,
-160, 141557760, 1279659216, 875648065, 1329790976, 1597068110, 10485809, 0,
-214960400, 1413565510, 13361, 1397641027, 3235633, 160, 68157440, 1279659696,
-810700623, 1598436191, 827935571, 15728640, 0, 246416560, 1330596934, 861876306,
-1263755078, 12633, 240, 89128960, 1279659136, 875648065, 1162018816, 1597197385,
-10485813, 0, 188745360, 1413565510, 12338, 1279870275, 3497779, 160,
-89128960, 1279657296, 810700623, 1279669087, 808604737, 10485760, 327689, 230689440,
-1413565510, 12338, 1413565510, 12338, 160, 141557760, 1279658896, 808604737,
-1162018816, 1597197385, 10485813, 0, 110100720, 1330596934, 945763410, 1279870275,
-3497779, 144, 15728640, 1279657456, 877809487, 1162033247, 1597197385, 9437237,
-0, 15728880, 1330596934, 945763410, 1413565510, 12338, 160, 15728640,
-1279656896, 877809487, 1162033247, 1597197385, 8388661, 0, 78643760, 1397641027,
-3235633, 1414089812, 828323397, 524543, 15728640, 1279658176, 877809487, 1162033247,
-1597197385, 7340085, 0, 94372160, 1330596934, 945763410, 1279870275, 3497779,
-144, 26214400, 1279657376, 877809487, 1162033247, 1597197385, 9437237, 0,
-78643680, 1330596934, 945763410, 1330596934, 828322898, 224, 31457280, 1279657136,
-877809487, 1279670367, 877809487, 9449823, 0, 199231440, 1413565510, 13361,
-1414089812, 895432261, 524543, 15728640, 1279656896, 877809487, 1162033247, 1597197385,
-9437237, 0, 62914800, 1330596934, 945763410, 1279870275, 3497779, 144,
-15728640, 1279656896, 877809487, 1162033247, 1597197385, 16711733, 1, 62914800,
-1330596934, 945763410, 1279870275, 3497779, 144, 5242880, 1431176528, 1162297675,
-1279655987, 808539201, 9437184, 7, 89129120, 1330596934, 878654802, 1413565510,
-12337, 144, 10485760, 1279656736, 894586703, 1162032223, 1597197385, 9437237,
-0, 4263573392, 1330596934, 828323666, 1263755078, 12633, 144, 4200595456,
-1279721312, 877809487, 1179465823, 1597526604, 9437233, 0, 4242602832, 1413565510,
-12338, 1413565510, 12338, 144, 4216324096, 1279720672, 808604737, 1279655936,
-808604737, 9437184, 0, 4242602832, 1413565510, 12338, 1413565510, 12338,
-144, 4153409536, 1279720192, 928141135, 1598435679, 827935571, 9437184, 0,
-4226873072, 1330596934, 828322130, 1414089812, 828323397, 255, 4195352576, 1279720752,
-827477839, 1280586079, 910513225, 16724319, 851976, 4242602832, 1413565510, 12338,
-1413565510, 12338, 144, 4200595456, 1279721152, 877809487, 1279670367, 858936385,
-9437184, 0, 4247845472, 1330596934, 945763410, 1380730445, 3235640, 144,
-4211081216, 1279656576, 877809487, 1179465823, 1597526604, 9437233, 0, 4247845472,
-1330596934, 945763410, 1380730445, 3235640, 144, 4200595456, 1279720032, 877809487,
-1279670367, 808604737, 9437184, 0, 42007456, 1330596934, 945763410, 1380730445,
-3235640, 144, 4216324096, 1279720672, 808604737, 1279655936, 808604737, 9437184,
-0, 4242602832, 1413565510, 12338, 1413565510, 12338, 144, 4232052736,
-1279656576, 877809487, 1179465823, 1597526604, 9437233, 0, 42007776, 1330596934,
-945763410, 1380730445, 3235640, 144, 4253024256, 1279656576, 877809487, 1179465823,
-1597526604, 8388657, 0, 246417840, 1413565510, 13361, 1279870275, 3497779,
-160, 178257920, 1329794336, 1597068110, 1279655989, 842159169, 16711680, 8,
-209717200, 1413565510, 13361, 1279870275, 3497779, 160, 141557760, 1279659216,
-875648065, 1329790976, 1597068110, 10485809, 0, 214960400, 1413565510, 13361,
-1397641027, 3235633, 160, 178257920, 1279659456, 808604737, 1279655936, 808604737,
-10485760, 0, 230689440, 1413565510, 12338, 1413565510, 12338, 160,
-78643200, 1279659136, 875648065, 1162018816, 1597197385, 10485813, 0, 209716560,
-1413565510, 13361, 1279870275, 3497779, 160, 99614720, 1279659136, 875648065,
-1162018816, 1597197385, 10485813, 0, 209716880, 1413565510, 13361, 1279870275,
-3497779, 160, 120586240, 1279659136, 875648065, 1162018816, 1597197385, 10485813,
-0, 193988720, 1413565510, 12338, 1279870275, 3497779, 160, 110100480,
-1279658816, 808604737, 1162018816, 1597197385, 10485813, 0, 99614960, 1330596934,
-945763410, 1279870275, 3497779, 160, 26214400, 1279659136, 875648065, 1162018816,
-1597197385, 10485813, 0, 15728880, 1330596934, 945763410, 1413565510, 12338,
-160, 36700160, 1279659136, 875648065, 1162018816, 1597197385, 10485813, 0,
-209715920, 1413565510, 13361, 1279870275, 3497779, 160, 57671680, 1279659136,
-875648065, 1162018816, 1597197385, 10485813, 0, 209716240, 1413565510, 13361,
-1279870275, 3497779, 160, 4289724416, 1279657136, 894586703, 1162031455, 1597197385,
-16711733, 0, 78708656, 1330596934, 828323154, 1279870275, 3497779, 112,
-15728640, 1279658256, 877809487, 1162033247, 1597197385, 8388661, 0, 78708656,
-1330596934, 828323154, 1279870275, 3497779, 112, 4284481536, 1279657696, 894586703,
-1280586079, 910513225, 16724319, 3, 78708656, 1330596934, 828323154, 1279870275,
-3497779, 112, 99614720, 1414727952, 3231813, 1162018816, 1597197385, 7340085,
-65536, 157288000, 1330596934, 828323666, 1414089812, 912209477, 196800, 4289724416,
-1279656576, 894586703, 1162031455, 1597197385, 7340085, 0, 42008496, 1330596934,
-828323154, 1279870275, 3497779, 112, 0, 1279656896, 877809487, 1162033247,
-1597197385, 16711733, 0, 62914640, 1330596934, 945763410, 1279870275, 3497779,
-176, 10485760, 1279656896, 877809487, 1162033247, 1597197385, 10485813, 0,
-62914800, 1330596934, 945763410, 1279870275, 3497779, 144, 15728640, 1279656176,
-877809487, 1279670367, 808604737, 9437184, 458752, 47185920, 1330596934, 861877074,
-1414089812, 912209477, 176, 15728640, 1279656176, 877809487, 1279670367, 808604737,
-9437184, 0, 99614960, 1330596934, 945763410, 1414089812, 828323397, 255,
-20971520, 1279657456, 877809487, 1280587871, 910513225, 16724319, 0, 99615120,
-1330596934, 945763410, 1414089812, 828323397, 255, 31457280, 1279657456, 877809487,
-1280587871, 910513225, 16724319, 0, 68157760, 1330596934, 945763410, 1414089812,
-895432261, 65791, 4284481536, 1279657056, 894586703, 1280586079, 910513225, 16724319,
-8, 4284546912, 1330596934, 828323154, 1330596934, 945763410, 589936, 36700160,
-1279657296, 875648065, 1279655936, 877809487, 8401247, 0, 193987200, 1413565510,
-13361, 1330596934, 828322898, 128, 125829120, 1414728592, 3231813, 1279655936,
-877809487, 8401247, 262144, 104858000, 1330596934, 828323154, 1414089812, 895432261,
-524543, 36700160, 1279657536, 894586703, 1280586079, 910513225, 16725343, 8,
-104858000, 1330596934, 828323154, 1279870275, 3235637, 524400, 26214400, 1279657536,
-894586703, 1162031455, 1597328457, 7340081, 8, 62914800, 1330596934, 945763410,
-1279870275, 3497779, 65791, 15728640, 1279656896, 877809487, 1162033247, 1597197385,
-7340085, 0, 15728880, 1330596934, 945763410, 1413565510, 12338, 589968,
-73400320, 1279659136, 894586703, 1162031455, 1597197385, 7340085, 0, 209716400,
-1330596934, 828323154, 1279870275, 3497779, 112, 89128960, 1279659136, 894586703,
-1162031455, 1597197385, 7340085, 0, 131072000, 1330596934, 945763410, 1380730445,
-3235640, 112, 0, 1279657936, 877809487, 1162033247, 1597197385, 7340085,
-0, 110101600, 1330596934, 828322130, 1413565510, 12850, 852223, 0,
-1279656576, 877809487, 1179465823, 1597526604, 7340081, 0, 0, 1330596934,
-945763410, 1413565510, 12338, 255, 73400332, 1279657616, 827477839, 1279668575,
-842159169, 16711680, 13, 42008096, 1330596934, 945763410, 1380730445, 3235640,
-128, 4273995776, 1279656576, 877809487, 1179465823, 1597526604, 8388657, 0,
-52494176, 1330596934, 945763410, 1414089812, 912209477, 196863, 0, 1279655936,
-877809487, 1279670367, 808604737, 16711680, 786432, 110101600, 1330596934, 828322130,
-1413565510, 12850, 852223, 99614720, 1279659136, 894586703, 1162031455, 1597197385,
-7340085, 0, 209716880, 1330596934, 828323154, 1279870275, 3497779, 112,
-120586240, 1279659136, 894586703, 1162031455, 1597197385, 7340085, 0, 209717200,
-1330596934, 828323154, 1279870275, 3497779, 112, 141557760, 1279659136, 894586703,
-1162031455, 1597197385, 7340085, 0, 209717520, 1330596934, 828323154, 1279870275,
-3497779, 112, 162529280, 1414728832, 3297349, 1162018816, 1597197385, 16711733,
-720896, 209717680, 1330596934, 828323154, 1279870275, 3497779, 255, 162529280,
-1279659136, 894586703, 1162031455, 1597197385, 7340085, 0, 162531760, 1330596934,
-828323154, 1413565510, 12338, 590079, 146800640, 1431180288, 1162297675, 1162018867,
-1597197385, 9437237, 7, 235932080, 1330596934, 828323154, 1279870275, 3497779,
-160, 162529280, 1279659136, 894586703, 1162031455, 1597197385, 11534389, 0,
-335546560, 1095456078, 3360071, 1279870275, 3497779, 458896, 4289724416, 1279657136,
-894586703, 1162031455, 1597197385, 7340085, 0, 115408736, 1330596934, 828323154,
-1414089812, 828323397, 196863, 4289725415, 1279656576, 894586703, 1162031455, 1597197385,
-7340085, 0, 115408736, 1330596934, 828323154, 1414089812, 828323397, 196863,
-4289725415, 1279656576, 894586703, 1162031455, 1597197385, 7340085, 0, 110100880,
-1330596934, 945763410, 1279870275, 3497779, 144, 36700160, 1279657616, 877809487,
-1162033247, 1597197385, 9437237, 0, 110101200, 1330596934, 945763410, 1279870275,
-3497779, 144, 57671680, 1279658096, 877809487, 1162033247, 1597197385, 9437237,
-0, 141558800, 1330596934, 945763410, 1279870275, 3497779, 144, 78643200,
-1279659136, 877809487, 1162033247, 1597197385, 9437237, 0, 209716560, 1330596934,
-945763410, 1279870275, 3497779, 144, 99614720, 1279659136, 877809487, 1162033247,
-1597197385, 9437237, 0, 209716880, 1330596934, 945763410, 1279870275, 3497779,
-144, 120586240, 1279659136, 877809487, 1162033247, 1597197385, 9437237, 0,
-209717200, 1330596934, 945763410, 1279870275, 3497779, 144, 141557760, 1279659136,
-877809487, 1162033247, 1597197385, 9437237, 0, 209717520, 1330596934, 945763410,
-1279870275, 3497779, 144, 146800640, 1431180288, 1162297675, 1162018867, 1597197385,
-9437237, 7, 131072960, 1330596934, 945763410, 1330596934, 895431762, 144,
-68157440, 1279657936, 877809487, 1279670367, 877809487, 9450847, 0, 131073120,
-1330596934, 945763410, 1330596934, 895431762, 144, 78643200, 1279657936, 877809487,
-1279670367, 877809487, 9450847, 0, 131073280, 1330596934, 861877586, 1279870275,
-3497779, 144, 83886080, 1279659696, 894586703, 1162031967, 1597197385, 16711733,
-0, 267386880, 1330596934, 828323666, 1263755078, 12633, 255, 104857600,
-1279659456, 808604737, 1279655936, 808604737, 16711680, 0, 230688320, 1413565510,
-12338, 1413565510, 12338, 255, 83886080, 1279657936, 894586703, 1162031967,
-1597197385, 16711733, 0, 83886080, 1330596934, 828323666, 1263755078, 12633,
-255, 68157440, 1431178928, 1162297675, 1162018867, 1597197385, 16711733, 7,
-246417680, 1330596934, 945763410, 1279870275, 3497779, 255, 104857608, 1279659456,
-808604737, 1279655936, 808604737, 16711680, 0, 125830320, 1330596934, 945763410,
-1279870275, 3497779, 144, 94371840, 1279657856, 808604737, 1162018816, 1597197385,
-9437237, 0, 209717520, 1330596934, 945763410, 1279870275, 3497779, 786687,
-10, 1279657376, 894586703, 1279668575, 877809487, 9450847, 0, 36765616,
-1330596934, 828323154, 1414089812, 895432261, 255, 4284481536, 1279656416, 894586703,
-1280586079, 910513225, 16725343, 8, 94371920, 1330596934, 945763410, 1330596934,
-895431762, 144, 10485760, 1279657376, 877809487, 1279670367, 877809487, 9450847,
-0, 94372080, 1330596934, 945763410, 1330596934, 895431762, 144, 47185920,
-1279656736, 894586703, 1280586079, 910513225, 13663, 8, 4284546912, 1330596934,
-828323154, 1330596934, 945763410, 589920, 4284481542, 1279656496, 894586703, 1280586079,
-910513225, 16725343, 0, 94372160, 1330596934, 945763410, 1330596934, 895431762,
-144, 26214400, 1279657376, 877809487, 1279670367, 877809487, 9450847, 0,
-94372320, 1330596934, 945763410, 1330596934, 895431762, 144, 31457280, 1279657376,
-877809487, 1280587871, 910513225, 16725599, 2, 31457760, 1330596934, 945763410,
-1330596934, 895431762, 589968, 36700160, 1279657376, 877809487, 1279670367, 877809487,
-9450847, 0, 94372480, 1330596934, 945763410, 1330596934, 895431762, 144,
-47185920, 1279657376, 877809487, 1279670367, 877809487, 9450847, 0, 94372640,
-1330596934, 945763410, 1330596934, 895431762, 144, 57671680, 1279657936, 877809487,
-1279670367, 877809487, 9450847, 0};
-extern const uint32_t e1m1_WADNodes[4023] = {
-2555904, 4294246400, 0, 131072, 29360640, 83887232, 29360640, 71304192,
-2147581952, 2031616, 1638400, 917504, 4294895616, 63964736, 88081280, 102499984,
-88081280, 2147713026, 2162688, 4294705152, 4294934528, 0, 44040992, 62915408,
-41943712, 61866832, 2147844100, 2162688, 0, 0, 4294705152, 41943840,
-62915408, 44041024, 67109824, 2147876866, 2424832, 131072, 0, 4294705152,
-46138208, 71304192, 48235392, 75498560, 2148040711, 2293760, 65536, 0,
-4294705152, 41943872, 67109712, 46138240, 75498496, 262147, 2686976, 262144,
-0, 4294705152, 50332576, 79692928, 52429760, 83887296, 2148171785, 2818048,
-327680, 0, 4294705152, 50332608, 83887232, 54526912, 88081664, 2148204550,
-2555904, 196608, 0, 4294705152, 41943936, 75498320, 50332608, 88081536,
-458757, 2949120, 360448, 4294049792, 0, 63964816, 88081280, 41944000,
-88081232, 524289, 2555904, 4294377472, 262144, 0, 29360640, 83887104,
-41944720, 88081232, 589824, 3407872, 4294901760, 4294541312, 0, 50332480,
-102761792, 46138112, 102761808, 2148368396, 3407872, 4294770688, 4294574080, 0,
-46138176, 102761792, 41943744, 102761824, 2148401163, 3407872, 4294377472, 4294672384,
-0, 33555008, 102761856, 29360640, 102761872, 2148630544, 3407872, 4294508544,
-4294639616, 0, 37749376, 102761840, 29360704, 102761856, 884751, 3407872,
-4294639616, 4294606848, 0, 41943872, 102761792, 29360768, 102761840, 917516,
-2949120, 1564672, 458752, 4294932480, 71304732, 102761792, 101320322, 102761792,
-2148761618, 3194880, 589824, 0, 4294836224, 67109952, 95946168, 67109952,
-102761912, 2148892692, 3407872, 589824, 4294754304, 0, 71304834, 102761792,
-67109952, 102761912, 1114128, 3194880, 458752, 0, 4294868992, 63964160,
-95946048, 63964160, 102761912, 2149023766, 3407872, 458752, 4294754304, 0,
-67110530, 102761792, 63964160, 102761792, 1245202, 3145728, 360448, 0,
-4294934528, 62915536, 94373200, 62915536, 102761912, 2149220377, 2949120, 327680,
-32768, 0, 54526912, 102761792, 62915536, 102761808, 1409048, 3145728,
-360448, 4294803456, 0, 63964802, 102761792, 54526928, 102761792, 1441812,
-2949120, 65536, 458752, 0, 29360960, 102761792, 54527618, 102761792,
-1507343, 3801088, 4294279168, 0, 4294934528, 29360592, 115344992, 29360592,
-159385360, 2149416988, 3801088, 4294279168, 4294705152, 0, 30410245, 159385184,
-29360592, 159385184, 1671195, 4915200, 1409024, 262144, 4294443008, 29361669,
-159385184, 80741840, 159385856, 2149449754, 5177344, 884736, 0, 4293361664,
-29361669, 159385184, 29361595, 167774592, 2149515291, 3440640, 4294279168, 0,
-360448, 30409640, 106956336, 41943976, 103810592, 2149679136, 3440640, 360448,
-4294934528, 0, 63964682, 106956320, 61342672, 103810608, 2149810210, 3407872,
-278528, 32768, 0, 30409640, 106956320, 61343242, 106956320, 1966109,
-3538944, 4294246400, 0, 32768, 29361669, 167773792, 30410250, 106956320,
-2031644, 3407872, 1527808, 1507328, 4294848512, 29361674, 167773728, 96142969,
-167773728, 2149842976, 3407872, 65536, 0, 4294836224, 29361794, 102761792,
-29361785, 167773728, 2162712, 2949120, 327680, 0, 4294705152, 29361808,
-88081232, 29361794, 167773504, 2228234, 1851392, 4294639616, 4294623232, 4294836224,
-37749504, 54526592, 41943689, 54526760, 2150072358, 1507328, 4294770688, 0,
-4294705152, 37749440, 41943472, 37749504, 54526592, 2392101, 1900544, 4294901760,
-0, 4294705152, 37749504, 54526384, 41943808, 55575360, 2150105125, 458752,
-458752, 4294836224, 0, 67109952, 8454127, 62915584, 4259776, 2150334506,
-65536, 327680, 262144, 0, 49808320, 8454016, 62915648, 8454080,
-2588713, 4294901760, 4294885376, 524288, 0, 37749496, 42008373, 49742584,
-4286644087, 2150465580, 458752, 4294885376, 4294443008, 0, 49808448, 8454016,
-37749496, 42008373, 2687016, 1507328, 4294770688, 344064, 131072, 37749504,
-55574960, 37749824, 42008373, 2752550, 851968, 4294246400, 4294705152, 262144,
-29360704, 27263168, 29360672, 18874464, 2150596654, 1081344, 4294508544, 4294934528,
-4294934528, 36700736, 28311968, 33554960, 28311968, 2150989876, 1179648, 4294475776,
-4294934528, 32768, 36700736, 31457744, 33555008, 28311968, 2981939, 1179648,
-4294410240, 0, 65536, 34603568, 31457760, 33555008, 31457696, 3047474,
-1081344, 4294377472, 65536, 0, 33554944, 30409136, 33555008, 31457696,
-3113009, 1146880, 4294377472, 32768, 32768, 29360704, 41943504, 33555008,
-31457696, 3178544, 1048576, 4294475776, 0, 4294901760, 29360704, 27263072,
-29360704, 41943456, 3211308, 360448, 4294475776, 4294639616, 0, 36700736,
-6356896, 35652144, 5308336, 2151120950, 327680, 4294410240, 4294705152, 0,
-34603552, 4259776, 29360656, 4259776, 2151252024, 65536, 4294410240, 0,
-32768, 29360672, 4259776, 29360672, 4290313990, 2151284788, 327680, 4294443008,
-4294705152, 0, 35652160, 6356896, 29360672, 4259590, 3473459, 393216,
-4294246400, 0, 196608, 29360704, 41943136, 29360704, 6356742, 3538994,
-589824, 4294508544, 4294770688, 0, 37749824, 55639861, 29360704, 42008326,
-3604523, 1933312, 4294639616, 0, 262144, 29361808, 167773008, 29361216,
-55639814, 3670051, 4294508544, 4294508544, 0, 4294705152, 29360704, 4274060816,
-29360672, 4280942336, 2151514172, 4294748160, 4294508544, 4294729728, 0, 37749495,
-4286054080, 29360704, 4280942096, 3833915, 4294049792, 4294541312, 0, 4294901760,
-36700752, 4259380704, 35652144, 4260429280, 2151972931, 4294148096, 4294574080, 4294901760,
-0, 39846496, 4262526448, 35652176, 4260429280, 3964994, 4294180864, 4294541312,
-4294934528, 32768, 38797920, 4263575056, 35652192, 4262526432, 4030529, 4294082560,
-4294443008, 65536, 0, 35652128, 4262526448, 35652192, 4263575008, 4096064,
-4294180864, 4294475776, 0, 65536, 36700901, 4275502624, 35652192, 4263575008,
-4161599, 4294082560, 4294574080, 4294934528, 4294934528, 29360857, 4268424512, 35652325,
-4275502560, 4227134, 4294148096, 4294443008, 32768, 32768, 29360887, 4286053904,
-29360869, 4275502400, 4259899, 4292935680, 4294639616, 262144, 0, 33555072,
-4232117184, 41943696, 4232117184, 2152169542, 4293197824, 4294672384, 4294705152, 0,
-42992285, 4232117184, 33555088, 4232117184, 4423749, 4293197824, 4294377472, 131072,
-4294901760, 31457792, 4236311616, 29360608, 4246797440, 2152300616, 4293656576, 4294311936,
-0, 4294901760, 29360640, 4246797376, 29360592, 4248894768, 2152333381, 4293197824,
-4294699008, 0, 4294940672, 33555101, 4232117184, 29360640, 4248894528, 4587588,
-4293722112, 4294246400, 0, 32768, 29360887, 4286053696, 29360797, 4248894400,
-4653122, 65536, 458752, 4294836224, 0, 67109952, 4293918592, 62915584,
-4290838464, 2152497227, 4293984256, 655360, 4294934528, 0, 73401504, 4257283504,
-69207136, 4257283504, 2153021523, 4293984256, 524288, 0, 131072, 69207200,
-4261477824, 69207200, 4257283504, 4882514, 4293951488, 524288, 32768, 0,
-65012768, 4261477808, 69207200, 4261477808, 4948049, 4293951488, 655360, 4294868992,
-0, 73401504, 4256234816, 69207136, 4253089088, 2153218134, 4293853184, 524288,
-98304, 0, 65012768, 4256234816, 69207200, 4256234816, 5079125, 4293951488,
-524288, 0, 131072, 65012896, 4261477808, 65012896, 4256234816, 5111884,
-4293722112, 393216, 393216, 0, 54526944, 4261477696, 65012896, 4261477696,
-5210192, 4294115328, 393216, 0, 393216, 54527136, 4269866496, 54527136,
-4261477696, 5275727, 4294115328, 786432, 4294574080, 0, 77595936, 4269866304,
-54527136, 4269866304, 5341262, 4293722112, 786432, 0, 4294574080, 54527264,
-4248894528, 54527264, 4269866304, 5406797, 4294901760, 458752, 0, 131072,
-62915648, 4293918592, 54527264, 4269866048, 5439561, 4293197824, 65536, 0,
-4294633472, 42992640, 4232117184, 54526976, 4240505920, 2153349208, 4293591040, 65536,
-4294836224, 131072, 54527264, 4293917760, 42992640, 4240505792, 5570644, 4293853184,
-4294770688, 1030144, 112640, 29360887, 4286053312, 42992928, 4293917632, 5636168,
-4294541312, 3047424, 131072, 4294868992, 142608640, 4279303808, 149948672, 4275109563,
-2153545819, 4294672384, 2949120, 4294836224, 4294836224, 142608640, 4279303808, 142084288,
-4279828176, 2153578584, 4294672384, 2949120, 16384, 4294950912, 142084352, 4279828096,
-146278656, 4279828248, 2153644121, 4294557696, 2801664, 131072, 131072, 136710400,
-4288741080, 142084352, 4279828096, 5931098, 4293869568, 2932736, 131072, 4294836224,
-142084280, 4257807752, 142084288, 4258332040, 2153939041, 4294017024, 2818048, 4294836224,
-131072, 142608576, 4258332048, 142084288, 4258332040, 6062176, 4294541312, 2818048,
-4294836224, 0, 142608512, 4275109328, 142084224, 4270915088, 2154070115, 4294017024,
-2818048, 4294950912, 4294950912, 142084288, 4258332040, 142084224, 4275109328, 6160477,
-4294148096, 2801664, 262144, 0, 127928440, 4281007296, 142084288, 4275109256,
-6258783, 4294557696, 2801664, 4294950912, 16384, 136710400, 4288740992, 127928512,
-4281007296, 6291547, 0, 2686976, 4293459968, 4294639616, 127928576, 4288740544,
-127928384, 4288740544, 2154102881, 0, 3080192, 0, 4294574080, 127928576,
-4288740544, 129894656, 4259744, 2154168418, 4294715392, 3778560, 251904, 4294924288,
-150997589, 4288741144, 171969180, 4288741157, 2154332263, 0, 3735552, 0,
-4294311936, 150997660, 4288741144, 150997642, 4259744, 2154365028, 4294508544, 3080192,
-0, 131072, 150997312, 4278255296, 150997312, 4274060928, 2154528874, 4294672384,
-3342336, 4294836224, 4294868992, 155191744, 4279303808, 155191632, 4275109563, 2154659948,
-4294688768, 3358720, 4294836224, 131072, 159910344, 4279828184, 159386056, 4279828176,
-2154791022, 4294541312, 3473408, 131072, 4294836224, 155191744, 4279303808, 159386056,
-4279828176, 6815847, 4294410240, 3473408, 131072, 0, 163580352, 4275109520,
-164104648, 4275633816, 2154922096, 4294541312, 3473408, 16384, 16384, 155191752,
-4279828096, 163580360, 4275633808, 6946921, 4294377472, 3211264, 131072, 0,
-150997312, 4278255232, 155191752, 4279828096, 7012454, 4294688768, 3080192, 0,
-278528, 150997660, 4259608, 150997448, 4279828096, 7077989, 4294361088, 3178496,
-4294950912, 0, 154143024, 4269342320, 152045872, 4269342320, 2155249781, 4294344704,
-3112960, 16384, 0, 152045840, 4269342320, 152045872, 4269342320, 7241844,
-4294344704, 3178496, 0, 4294901760, 152045872, 4268818032, 152045872, 4269342320,
-7307379, 4294361088, 3112960, 0, 65536, 150997312, 4269866616, 152045872,
-4269342320, 7372914, 4294377472, 3080192, 0, 131072, 150997660, 4259456,
-150997312, 4269866608, 7405677, 4294377472, 3080192, 131072, 0, 127928576,
-4259008, 150997660, 4259440, 7471203, 4293591040, 2883584, 0, 262144,
-144705856, 4252040448, 142608672, 4244700352, 2155446392, 4293853184, 3080192, 0,
-131072, 150997312, 4254137728, 150997312, 4253089136, 2155577466, 4293820416, 3211264,
-0, 4294836224, 142608704, 4252040384, 150997312, 4254137712, 7667828, 4293591040,
-2883584, 4294836224, 4294901760, 142608704, 4254137536, 133171384, 4253613248, 2155610230,
-4293885952, 2949120, 0, 131072, 146803008, 4254137744, 133171520, 4254137536,
-7831671, 4293459968, 2523136, 0, 262144, 133171520, 4254137536, 136317208,
-4240505984, 2155675768, 4294000640, 3489792, 4294836224, 4294836224, 159910344, 4257807752,
-159386056, 4258332040, 2155970688, 4293885952, 3342336, 131072, 131072, 155191744,
-4258332048, 159386056, 4258332040, 8028287, 4293869568, 3358720, 0, 4294836224,
-155716288, 4253613232, 155191752, 4258332040, 8093822, 4294017024, 3473408, 131072,
-0, 163580352, 4270915024, 163580360, 4270915088, 2156167299, 4294148096, 3489792,
-4294819840, 0, 164104889, 4280679639, 163580360, 4270915024, 8224898, 4294000640,
-3489792, 16384, 4294950912, 155192000, 4258331824, 163580601, 4280679639, 8257660,
-4293427200, 3997696, 1288192, 4294748160, 155192000, 4280679600, 173345472, 4285332656,
-2156200063, 4293722112, 3211264, 98304, 0, 133171520, 4254137472, 155192000,
-4285332656, 8388729, 4293869568, 2932736, 16384, 16384, 127928988, 4259008,
-133171904, 4285332608, 8454259, 4293197824, 2555904, 0, 442368, 134220032,
-4236311616, 134219992, 4232117248, 2156363910, 4293066752, 2555904, 0, 442368,
-134220032, 4236311552, 134220016, 4227922880, 2156396675, 4293328896, 2621440, 0,
-458752, 127929024, 4258944, 134220032, 4236311488, 8650882, 4293312512, 1048576,
-950272, 0, 29361440, 4293917632, 127929024, 4258752, 8716375, 4294901760,
-4294934528, 131072, 360448, 29361808, 167837446, 29362880, 4258752, 8781881,
-2818048, 4293853184, 4294705152, 0, 16777664, 83887232, 12583168, 83887232,
-2156560521, 2293760, 4293722112, 0, 327680, 12583360, 71304192, 4194407,
-52953792, 2156757132, 2424832, 4293918720, 0, 262144, 18874784, 75498560,
-4194752, 71303872, 9011339, 2555904, 4293722112, 0, 131072, 12583360,
-83887232, 4194752, 75498176, 9044104, 3080192, 4293591040, 327680, 0,
-4194432, 102761840, 8388800, 102761856, 2156888206, 3112960, 4293853184, 294912,
-0, 12583168, 102761872, 16777664, 102761872, 2157019280, 3112960, 4293722112,
-0, 131072, 12583360, 102761872, 16777664, 93324544, 2157052045, 3112960,
-4293722112, 294912, 0, 4194496, 102761840, 12583360, 102761728, 9306252,
-2818048, 4293853184, 0, 4294836224, 4194752, 83886784, 4194752, 102761728,
-9371787, 3538944, 4293820416, 262144, 0, 4194544, 115344944, 15728896,
-115344992, 2157281428, 3457024, 4293853184, 4294918144, 0, 16777664, 115344928,
-4194560, 115344944, 9535635, 5177344, 4294246400, 0, 4294180864, 4194752,
-159385360, 4194752, 167774592, 2157412502, 3866624, 4294180864, 0, 4294705152,
-18874816, 117442272, 18874784, 118490880, 2157543576, 3866624, 4293918720, 4294901760,
-4294901760, 16777504, 117442272, 15728880, 118490848, 2157674650, 3899392, 4293918720,
-4294934528, 0, 18874816, 118490848, 15728928, 118490848, 9765012, 3899392,
-4293918720, 0, 262144, 4194752, 167773968, 15729088, 118490848, 9830547,
-3801088, 4293853184, 0, 4294934528, 4194752, 115344928, 4194752, 167773920,
-9896082, 3407872, 4293722112, 0, 4294836224, 4194752, 102761152, 4194752,
-167773728, 9961616, 2949120, 4293066752, 0, 4294705152, 4278255488, 88081696,
-4278255488, 102761792, 2157805724, 3014656, 4293328896, 393216, 0, 4290772992,
-102761808, 64, 102761824, 2158002335, 2981888, 4293197824, 425984, 0,
-4286644160, 102761792, 4290773056, 102761808, 10191006, 2949120, 4293066752, 458752,
-0, 4278255488, 102761760, 4286578752, 102761792, 10223770, 5177344, 4293459968,
-0, 4294311936, 4278190144, 159385136, 4278190144, 167774592, 2158133409, 3440640,
-4292804608, 0, 49152, 4278190144, 167773744, 4279763008, 103810592, 2158166174,
-3407872, 4293197824, 0, 4294836224, 4278190144, 102761760, 4278190144, 167773728,
-10420381, 3440640, 4292771840, 0, 32768, 4277206784, 159385136, 4277206784,
-101188928, 2158395557, 3358720, 4292771840, 81920, 0, 4251582192, 158926010,
-4277206784, 159384896, 10584228, 4915200, 4292149248, 4292728832, 4294789120, 4251582208,
-159384762, 4245487040, 150996130, 2158428322, 5177344, 4292804608, 4294705152, 4294311936,
-4245487360, 159384738, 4248108800, 167774408, 2158493859, 2949120, 4292804608, 4294918144,
-0, 4278190144, 167773472, 4245487360, 167773346, 10748064, 2674688, 4291971072,
-4293931008, 4294885376, 4248895216, 85721792, 4244700521, 79299264, 2158657705, 1933312,
-4293459968, 196608, 4294901760, 4288675904, 62915408, 1703968, 62915504, 2158788779,
-2162688, 4293394432, 0, 4294705152, 4288675904, 62915408, 4286578720, 67109824,
-2158821543, 1900544, 4293197824, 4294918144, 0, 4290773056, 54526760, 4289593280,
-52953792, 2158985390, 1900544, 4293459968, 0, 4294705152, 4289527872, 54526656,
-4290773056, 55575360, 2159018153, 1933312, 4293197824, 0, 262144, 4286578752,
-67109712, 4289527872, 55575232, 11141288, 2424832, 4293263360, 0, 4294705152,
-4284481536, 71304192, 4282449888, 75498560, 2159182001, 2555904, 4293197824, 0,
-4294705152, 4282384384, 75498496, 4280352704, 79692928, 2159214764, 2818048, 4293066752,
-0, 4294705152, 4278255520, 83887296, 4278255488, 88081664, 2159378612, 2686976,
-4293132288, 0, 4294705152, 4280287232, 79692800, 4278255520, 88081600, 11403437,
-2293760, 4293328896, 0, 4294705152, 4286578752, 67109568, 4278190080, 88081408,
-11468971, 2031616, 4292771840, 843776, 0, 4244700912, 85721792, 4278190144,
-88081088, 11534502, 2949120, 4293066752, 32768, 131072, 4245422144, 167773346,
-4244635712, 88081088, 11600037, 3407872, 4293459968, 4294606848, 0, 4194752,
-167772864, 4244635712, 167772864, 11665561, 4292935680, 4293439488, 262144, 149504,
-128, 4246797248, 3539072, 4232117184, 2159509686, 4293984256, 4293459968, 4294705152,
-0, 4194432, 4257283392, 64, 4257283392, 2159640760, 4293656576, 4293591040,
-0, 4294705152, 128, 4246797248, 128, 4257283392, 11862196, 4293394432,
-4293197824, 327680, 4294443008, 4274061248, 4248894624, 4274061248, 4257283232, 2159771834,
-4293394432, 4293197824, 4294508544, 0, 4290838464, 4238408640, 4274061184, 4236311552,
-2159902908, 4293394432, 4292673536, 0, 524288, 4274061248, 4257283232, 4274061248,
-4238408640, 12058807, 4293656576, 4293328896, 0, 4294639616, 4284481536, 4246797600,
-4286578688, 4257283392, 2160099519, 4293656576, 4293001216, 327680, 0, 4274061152,
-4257283360, 4284481536, 4257283360, 12222654, 4293656576, 4293001216, 327680, 4294639616,
-4274061248, 4257283008, 4273995776, 4257283360, 12255417, 4293984256, 4293328896, 4294705152,
-0, 128, 4257283008, 4273995776, 4257283008, 12320950, 4294180864, 4293001216,
-0, 4294639616, 4274061152, 4263574976, 4274061120, 4274060864, 2160230593, 4294098944,
-4293459968, 4294852608, 0, 4194368, 4260953536, 4286578688, 4261477824, 2160427204,
-4294426624, 4293132288, 4294639616, 327680, 4288675968, 4274060792, 4286578752, 4261477824,
-12550339, 4293984256, 4293001216, 196608, 0, 4274061152, 4274060736, 4286578816,
-4274060736, 12583102, 4293984256, 4293328896, 0, 4294705152, 4273995904, 4257283008,
-4273995904, 4274060736, 12648637, 4294246400, 4292018176, 4294836224, 0, 4253089280,
-4265672064, 4240506240, 4261477760, 2160623815, 4294246400, 4291624960, 0, 393216,
-4240506368, 4274060864, 4240506368, 4265672064, 12812486, 4294246400, 4292411392, 0,
-262144, 4265672384, 4274060864, 4265672384, 4265672224, 2160820426, 4294180864, 4292673536,
-0, 4294705152, 4265672384, 4263574976, 4265672384, 4274060832, 12943561, 4293853184,
-4292280320, 655360, 0, 4240506368, 4274060672, 4265672384, 4274060736, 12976324,
-4292935680, 4292411392, 131072, 0, 4257283648, 4236311488, 4265672384, 4236311552,
-2160951500, 4293328896, 4292673536, 0, 4294443008, 4257283776, 4236311488, 4250468032,
-4248894624, 2160984264, 4292935680, 4291887104, 458752, 0, 4240506176, 4253088704,
-4248894808, 4248894624, 2161148111, 4293722112, 4291936256, 4294639616, 0, 4250468032,
-4248894400, 4240506200, 4253088704, 13238473, 4293853184, 4291887104, 0, 393216,
-4240506560, 4274060672, 4240506560, 4253088704, 13304007, 4293984256, 4292673536, 4294705152,
-0, 4273995904, 4274060224, 4240506560, 4274060224, 13369538, 4293197824, 4293656576,
-262144, 0, 8388768, 4240505920, 10485952, 4240505920, 2161279185, 4293197824,
-4293722112, 262144, 0, 8388800, 4240505920, 12583136, 4240505920, 2161311950,
-4293459968, 4293918720, 4294705152, 0, 18874656, 4240505920, 17826080, 4240505920,
-2161541333, 4293197824, 4293885952, 262144, 0, 14680336, 4240505920, 17826080,
-4240505920, 13664468, 4293197824, 4293787648, 262144, 0, 8388832, 4240505920,
-14680352, 4240505920, 13697231, 4293197824, 4293918720, 4294836224, 196608, 18874752,
-4232117248, 25166208, 4227922880, 2161737944, 4292935680, 4293918720, 49152, 0,
-10486048, 4227922880, 18874752, 4232117184, 13861079, 4293197824, 4293656576, 0,
-65536, 8388896, 4240505920, 10486144, 4232117184, 13893842, 4293722112, 4293951488,
-0, 294912, 19923392, 4274060608, 19923392, 4248894768, 2161869018, 4294508544,
-4294246400, 4294180864, 4294672384, 19923392, 4274060592, 8389056, 4274060608, 2161901782,
-4293656576, 4294246400, 0, 4294705152, 18874816, 4246797504, 20971968, 4247846176,
-2162065629, 4293689344, 4293984256, 0, 262144, 8389056, 4274060592, 18874816,
-4247846080, 14155991, 4293459968, 4293885952, 0, 4294868992, 8388992, 4240505792,
-8389056, 4274060480, 14221525, 4293459968, 4293591040, 196608, 0, 4240441472,
-4274060224, 8389056, 4274060224, 14287053, 1507328, 4293722112, 0, 4294836224,
-4194496, 41943360, 6750336, 46137984, 2162262240, 1114112, 4293427200, 0,
-4294901760, 1048624, 29360576, 16, 30409152, 2162655462, 1146880, 4293459968,
-4294934528, 4294934528, 3145792, 30409152, 48, 30409152, 14516453, 1245184,
-4293427200, 4294934528, 32768, 3145792, 33554928, 64, 30409152, 14581988,
-1245184, 4293361664, 0, 65536, 1048624, 33554944, 64, 33554880,
-14647523, 1212416, 4293328896, 32768, 32768, 16, 33554928, 64,
-33554880, 14713058, 1212416, 4293459968, 4294901760, 0, 4194496, 46137664,
-64, 33554880, 14745820, 589824, 4293459968, 0, 4294836224, 64,
-12582944, 64, 20971712, 2162852073, 851968, 4293459968, 4294705152, 0,
-4194496, 20971616, 64, 20971552, 14909672, 4294770688, 4293328896, 0,
-131072, 64, 4292935488, 64, 4282449600, 2163048684, 4294770688, 4293459968,
-4294705152, 0, 4194496, 4288741056, 64, 4292935360, 15040747, 32768,
-4293525504, 327680, 0, 4718688, 5308336, 6291648, 11599696, 2163572980,
-4294803456, 4293722112, 196608, 4294770688, 4718784, 4291362616, 4718784, 11599696,
-15171827, 360448, 4293525504, 196608, 196608, 4718784, 13107256, 4718784,
-11599672, 15237362, 32768, 4293476352, 327680, 0, 3145800, 5308336,
-4718784, 13172536, 15302897, 4294754304, 4293722112, 245760, 4294721536, 3145920,
-4291362592, 3145920, 13172536, 15368432, 360448, 4293476352, 245760, 245760,
-3145920, 14680120, 3145920, 13172512, 15433967, 32768, 4293427200, 327680,
-0, 48, 5308336, 3145920, 14745376, 15499502, 4294705152, 4293722112,
-294912, 4294672384, 192, 4292935360, 192, 14745376, 15532262, 360448,
-4293427200, 294912, 294912, 192, 20971552, 192, 14745280, 15597796,
-851968, 4293459968, 0, 262144, 192, 46137664, 192, 21036736,
-15663330, 4294770688, 4293328896, 786432, 0, 4288675840, 46202560, 192,
-46202560, 15761631, 4294901760, 4292673536, 0, 458752, 4274061216, 8454016,
-4274061120, 4282449600, 2163704054, 4294770688, 4292673536, 0, 4294705152, 4265672384,
-4282449664, 4271963840, 2162656, 2163900665, 4294770688, 4292411392, 524288, 0,
-4257283648, 4259584, 4265672384, 2162432, 15958264, 4294639616, 4292673536, 4294836224,
-0, 4274061216, 8453824, 4257283776, 4259584, 15991026, 458752, 4293132288,
-0, 4294508544, 4257284000, 8453824, 4257283648, 33554560, 2163933429, 4294770688,
-4291231744, 1048576, 0, 4219534336, 25231168, 4227923008, 20971840, 2164293887,
-851968, 4291362816, 4294180864, 0, 4232117440, 21036992, 4219534400, 25231168,
-16220414, 4294770688, 4291624960, 0, 4294574080, 4219534528, 4282449600, 4219534528,
-25231168, 16285949, 720896, 4292018176, 262144, 0, 4244700544, 25231232,
-4253089216, 16842624, 2164424961, 851968, 4291756032, 4294049792, 0, 4244700608,
-25231232, 4240506112, 20971840, 2164457722, 4294901760, 4291756032, 0, 393216,
-4240506304, 25231232, 4240506176, 4282449600, 2164523259, 65536, 4291624960, 786432,
-0, 4219534528, 25231040, 4240506304, 25231040, 16515321, 983040, 4292018176,
-0, 131072, 4219534784, 33554816, 4219534784, 25231040, 16613628, 1376256,
-4291428352, 0, 131072, 4232117440, 46137920, 4234214560, 37749248, 2164687109,
-1245184, 4292149248, 0, 4294410240, 4219534784, 33619648, 4232117440, 46137856,
-16711934, 4294901760, 4292149248, 4294705152, 0, 4257284000, 33619648, 4219534784,
-46202560, 16777462, 4294901760, 4293132288, 4294574080, 0, 4288676032, 46202560,
-4219535264, 46202560, 16842993, 65536, 4293984256, 0, 262144, 12583360,
-4259776, 16777536, 4290838400, 2164818183, 4294574080, 4293984256, 327680, 0,
-16777536, 4286643936, 20971904, 4286643936, 2164949257, 4294639616, 4294115328, 262144,
-0, 16777600, 4286643936, 25166272, 4286643968, 2164982020, 4294901760, 4293853184,
-0, 131072, 12583360, 4259712, 16777664, 4286643936, 17105155, 524288,
-4294082560, 0, 65536, 24117648, 10485920, 23069088, 10485888, 2165408016,
-524288, 4294148096, 4294901760, 32768, 25166272, 12583040, 23069088, 10485888,
-17269007, 458752, 4294049792, 65536, 32768, 20971904, 12583040, 23069120,
-12583040, 17334542, 589824, 4293984256, 0, 262144, 20971968, 18874560,
-20971968, 12583040, 17400077, 458752, 4294180864, 4294901760, 0, 27263424,
-8388704, 23069088, 8388704, 2165604627, 393216, 4294049792, 65536, 0,
-20971872, 8388704, 23069120, 8388704, 17531154, 458752, 4294180864, 0,
-65536, 20971968, 18874496, 20971968, 8388704, 17563914, 393216, 4293984256,
-65536, 0, 14680384, 18874464, 20971968, 18874464, 17662220, 1507328,
-4294017024, 4294311936, 0, 22020544, 41943360, 20971856, 41943360, 2165801238,
-851968, 4293984256, 655360, 0, 12583232, 41943360, 20971968, 41943360,
-17793301, 819200, 4293984256, 0, 4294836224, 16777536, 19923232, 16777536,
-20971824, 2165932312, 851968, 4294017024, 0, 229376, 12583360, 41943360,
-16777536, 20971808, 17891600, 786432, 4294246400, 0, 4294705152, 14680512,
-18874464, 12583360, 41943328, 17957134, 327680, 4294148096, 0, 4294918144,
-12583360, 4259552, 12583360, 41943136, 18022662, 4294803456, 4293722112, 229376,
-0, 4219470016, 46202560, 12583360, 42008288, 18088194, 4294508544, 4293722112,
-0, 4294705152, 4240441792, 4274060224, 4219470272, 46202560, 18153691, 1638400,
-4291887104, 0, 655360, 4244636096, 167772864, 4219470272, 46201792, 18219187,
-3801088, 4294246400, 4294705152, 0, 29362880, 167836608, 4219470272, 167836608,
-18284679, 4291624960, 1900544, 4294836224, 0, 113248000, 4181784832, 111150784,
-4181784800, 2166063386, 4291624960, 1835008, 4294770688, 0, 111150848, 4181784800,
-109053600, 4181784800, 2166096153, 4292149248, 1851392, 4294705152, 0, 111675136,
-4198562112, 109053608, 4198562240, 2166259997, 4291624960, 1835008, 0, 4294901760,
-109053696, 4181784800, 109053696, 4198562112, 18546970, 4291624960, 2031616, 0,
-524288, 117442560, 4181784896, 117442560, 4181784832, 2166456608, 4291493888, 2031616,
-131072, 0, 113248000, 4181784832, 117442560, 4181784832, 18710815, 4291428352,
-1835008, 65536, 65536, 109053696, 4198562016, 113248256, 4181784832, 18743580,
-4291788800, 2686976, 4294868992, 4294868992, 135268416, 4187027808, 134744128, 4187552096,
-2166653219, 4291624960, 2555904, 81920, 16384, 134219784, 4184406336, 135268416,
-4183882016, 2166784293, 4291706880, 2572288, 4294950912, 16384, 134744128, 4187552096,
-134219840, 4184406304, 18940192, 4291706880, 2572288, 98304, 98304, 134744128,
-4198562152, 134219840, 4187552032, 19038498, 4291887104, 2686976, 0, 131072,
-138414208, 4198562240, 138414184, 4187027808, 2166980904, 4291887104, 2818048, 262144,
-0, 138414208, 4198562144, 146802944, 4198562144, 2167013668, 4291690496, 2949120,
-0, 4294787072, 138414336, 4183882016, 138414336, 4198562144, 19235111, 4291887104,
-2686976, 262144, 0, 134219840, 4198562080, 138414336, 4198562080, 19267875,
-4291493888, 2555904, 131072, 0, 109053952, 4198562016, 134220032, 4198562080,
-19333407, 4292804608, 2686976, 4294868992, 65536, 138414368, 4219534144, 140511338,
-4216388416, 2167243052, 4292804608, 2686976, 0, 409600, 136317192, 4223728512,
-138414368, 4219534144, 19497259, 4292673536, 2752512, 0, 393216, 136317216,
-4223728448, 140511520, 4215339776, 2167275818, 4292476928, 2949120, 0, 131072,
-146802944, 4211145440, 146802944, 4209048128, 2167439663, 4292345856, 2768896, 0,
-180224, 135268544, 4209048224, 135268456, 4204853872, 2167570737, 4292231168, 2670592,
-98304, 4294868992, 134744128, 4204329536, 134744128, 4204853864, 2167701811, 4292345856,
-2588672, 4294868992, 98304, 135268544, 4209048176, 134744128, 4204853824, 19792173,
-4292411392, 2555904, 0, 4294443008, 111675400, 4206950976, 117442560, 4211145408,
-2167832885, 4292476928, 2686976, 4294836224, 4294868992, 134744256, 4209048128, 111675400,
-4211145280, 19923247, 4292345856, 2949120, 4294770688, 0, 146802944, 4211145280,
-111675584, 4211145280, 19988780, 4292542464, 3080192, 0, 65536, 136317216,
-4223728384, 111675648, 4211145280, 20054315, 4292149248, 2818048, 0, 4294836224,
-109054208, 4198562016, 111675680, 4223728192, 20119848, 4291624960, 1703936, 4294770688,
-0, 106956416, 4181784800, 104859232, 4181784800, 2167963959, 4291624960, 1638400,
-4294770688, 0, 104859264, 4181784800, 102762048, 4181784800, 2167996725, 4291624960,
-1507328, 4294836224, 4294836224, 96470528, 4181784800, 93849088, 4181784832, 2168226107,
-4291624960, 1507328, 4294770688, 0, 100664864, 4181784800, 93849088, 4181784800,
-20414778, 4291624960, 1572864, 4294770688, 0, 102762112, 4181784800, 93849120,
-4181784800, 20447542, 4292149248, 1572864, 4294705152, 0, 102762112, 4198562240,
-93849120, 4198562240, 2168357181, 4291690496, 1425408, 4294901760, 4294836224, 93849088,
-4183882048, 93849048, 4189124928, 2168488255, 4291854336, 1425408, 0, 4294836224,
-93849088, 4189124928, 93849048, 4190173616, 2168521019, 4291887104, 1572864, 0,
-196608, 93849216, 4198562240, 93849088, 4190173504, 20709690, 4291624960, 1572864,
-0, 4294901760, 93849216, 4181784800, 93849216, 4198562112, 20775225, 4291624960,
-458752, 0, 131072, 62915648, 4190173504, 67109952, 4181784832, 2168750403,
-4291756032, 327680, 4294836224, 131072, 62915648, 4190173440, 62915648, 4185979088,
-2168783167, 4291887104, 514048, 4294705152, 73728, 68879424, 4190173504, 62915648,
-4190173392, 21004610, 4291805184, 1114112, 81920, 131072, 72353152, 4190173442,
-72353088, 4187551968, 2168947014, 4291624960, 622592, 4294770688, 0, 72353152,
-4190173408, 71304272, 4181784896, 2168979778, 4291428352, 589824, 196608, 0,
-62915648, 4190173392, 71304576, 4190173408, 21168449, 4292149248, 851968, 0,
-393216, 79693184, 4215339584, 79693184, 4198562240, 2169143625, 4292476928, 458752,
-4294574080, 0, 67109984, 4209048000, 67109888, 4209048096, 2169274699, 4292476928,
-655360, 0, 4294770688, 67109984, 4209048000, 62915680, 4215339744, 2169307462,
-4291887104, 655360, 589824, 0, 62915680, 4215339456, 73401536, 4215339456,
-2169372999, 4292673536, 851968, 4294443008, 0, 79693184, 4215339456, 62915776,
-4215339456, 21496133, 4292083712, 458752, 4294770688, 55296, 62915968, 4215339456,
-67109915, 4196465088, 2169438537, 4291887104, 1245184, 0, 4294377472, 62915968,
-4190173392, 62915968, 4215339456, 21627204, 4291887104, 1245184, 262144, 0,
-62915968, 4215339216, 92276120, 4198562240, 2169504075, 4291854336, 1294336, 4294737920,
-0, 93849216, 4198562016, 62915992, 4215339216, 21758270, 4292149248, 1769472,
-4294705152, 0, 109054240, 4223727840, 62916224, 4215339216, 21823796, 4292280320,
-4293394432, 4294443008, 0, 2097280, 4206950784, 4290773024, 4206951040, 2169733458,
-4292804608, 4293394432, 0, 196608, 1179776, 4223728512, 4290773024, 4219534016,
-2169864532, 4292411392, 4293591040, 0, 4294770688, 4290773120, 4206950784, 4290773120,
-4223728320, 22020431, 4291952640, 4293722112, 0, 4294836224, 8388896, 4192270720,
-12583200, 4202756576, 2169995606, 4292542464, 4293656576, 0, 229376, 10486048,
-4223728384, 17826064, 4211145344, 2170126680, 4292280320, 4293885952, 0, 4294803456,
-8388896, 4202756480, 10486048, 4223728256, 22217042, 4292804608, 4293591040, 131072,
-0, 4290773120, 4223728000, 8388896, 4223728000, 22282577, 4292509696, 4293197824,
-425984, 241664, 4290773046, 4223728368, 4290773280, 4223728000, 22380881, 4292280320,
-4293148672, 229376, 0, 4282449832, 4219796096, 4289265600, 4223728368, 2170323291,
-4292280320, 4292935680, 0, 212992, 4282449856, 4223728256, 4282449856, 4181784768,
-2170356055, 4292280320, 4292935680, 655360, 262144, 4282449856, 4223728256, 4282449856,
-4223727808, 22577498, 4292509696, 4293197824, 4294737920, 0, 4290773280, 4223728000,
-4282449856, 4223727808, 22610262, 4291362816, 4292804608, 262144, 131072, 4274061120,
-4201183424, 4278255424, 4181784768, 2170519902, 4292280320, 4292673536, 0, 262144,
-4274061120, 4206951040, 4274061120, 4202756712, 2170650976, 4292231168, 4292935680, 0,
-4294705152, 4274061120, 4201183424, 4274061120, 4206951016, 22806875, 4291756032, 4292083712,
-655360, 0, 4244700576, 4206950720, 4255186368, 4185979264, 2170782050, 4291493888,
-4292149248, 131072, 4294705152, 4248894912, 4181784768, 4248894912, 4181784832, 2170913124,
-4291624960, 4291756032, 0, 131072, 4244700608, 4206950720, 4248894912, 4181784768,
-23003486, 4291756032, 4292280320, 0, 4294836224, 4257283712, 4185979136, 4261478016,
-4190173568, 2171109735, 4291887104, 4292542464, 0, 131072, 4261478080, 4198562240,
-4257283712, 4190173440, 23167334, 4291362816, 4292149248, 131072, 0, 4244700608,
-4206950592, 4257283776, 4198562048, 23200096, 4292149248, 4291756032, 4294443008, 0,
-4244700864, 4206950592, 4236311808, 4206950976, 2171142499, 4291887104, 4292673536, 4294443008,
-0, 4274061120, 4206950592, 4236312256, 4206950592, 23331165, 4292935680, 4291624960,
-4294836224, 0, 4240506112, 4223728320, 4236311744, 4219534016, 2171371883, 4292411392,
-4291756032, 262144, 0, 4236311808, 4223728320, 4244700632, 4223728448, 2171404646,
-4292673536, 4292198400, 4294705152, 0, 4258856512, 4223728320, 4236312024, 4223728320,
-23560554, 4292673536, 4292460544, 4294705152, 0, 4267245376, 4215339712, 4265672280,
-4215339712, 2171568494, 4292673536, 4292411392, 262144, 0, 4236312128, 4223728320,
-4265672512, 4215339712, 23658856, 4292411392, 4292083712, 0, 4294639616, 4236312384,
-4206950592, 4236312384, 4223728320, 23724389, 4292935680, 4292935680, 4294705152, 0,
-4282384672, 4223727808, 4236312384, 4223727808, 23789914, 4291821568, 4294115328, 0,
-327680, 25166368, 4192270752, 25166368, 4188076352, 2171699568, 4292001792, 4294443008,
-737280, 0, 25166368, 4223728096, 35652224, 4223728480, 2171896179, 4292149248,
-4294082560, 524288, 0, 18874736, 4215339584, 25166464, 4223728096, 24019314,
-4291952640, 4294443008, 0, 4294639616, 25166368, 4192270656, 18875008, 4223728096,
-24052077, 4291461120, 4294197248, 262144, 262144, 25166376, 4186503408, 27787824,
-4184930496, 2172027253, 4291362816, 4294606848, 327680, 0, 37749360, 4183881920,
-40895136, 4183881920, 2172223864, 4291362816, 4294508544, 327680, 0, 33555008,
-4183881920, 37749408, 4183881920, 24281463, 4291362816, 4294377472, 327680, 98304,
-25166384, 4186503360, 33555104, 4183881920, 24314225, 4291624960, 4294115328, 147456,
-327680, 18875008, 4223727936, 25166496, 4186503360, 24379760, 4291362816, 4294901760,
-327680, 0, 47186688, 4183881920, 50332464, 4183881920, 2172420475, 4291362816,
-4294803456, 327680, 0, 44040912, 4183881920, 47186736, 4183881920, 24543610,
-4291362816, 131072, 327680, 0, 53478240, 4183881920, 56624016, 4183881920,
-2172551549, 4291362816, 229376, 327680, 0, 53478288, 4183881920, 59769792,
-4183881920, 2172584312, 4291362816, 32768, 327680, 0, 44041008, 4183881920,
-53478336, 4183881920, 24707447, 4291919872, 262144, 753664, 0, 51774368,
-4215339472, 60818368, 4215339392, 2172813697, 4291756032, 327680, 163840, 4294901760,
-48235456, 4213832064, 51774400, 4215339392, 24871296, 4291690496, 327680, 0,
-4294868992, 44041152, 4183881920, 48235456, 4215339392, 24904058, 4291362816, 4294705152,
-327680, 0, 18875040, 4223727808, 44041152, 4215339200, 24969589, 4291756032,
-4293918720, 393216, 0, 4236247328, 4223727808, 18875328, 4223727808, 25035116,
-4291723264, 327680, 4294934528, 0, 62916896, 4223727824, 4236248000, 4223727808,
-25100622, 4290314240, 4294180864, 262144, 0, 25166240, 4148229824, 27263424,
-4148229824, 2172944771, 4290314240, 4294311936, 262144, 0, 29360608, 4148229824,
-31457920, 4148229824, 2173075845, 4290314240, 4294246400, 262144, 0, 25166272,
-4148229824, 29360768, 4148229824, 25297281, 4290625536, 4294377472, 4294918144, 0,
-33555072, 4167104320, 29360640, 4167104344, 2173206919, 4290576384, 4294377472, 0,
-4294901760, 25166464, 4148229824, 29360768, 4167104320, 25428355, 4290592768, 589824,
-0, 4294639616, 42992704, 4148753938, 60818496, 4149802824, 2173403530, 4290625536,
-180224, 0, 81920, 58197056, 4156618584, 42992704, 4149802514, 25592201,
-4291100672, 753664, 4294574080, 0, 76547584, 4165007232, 75498640, 4165007232,
-2173600141, 4290707456, 720896, 393216, 0, 71304320, 4165007232, 75499008,
-4165007232, 25723276, 4290625536, 589824, 0, 131072, 71304320, 4152424280,
-71304336, 4148753920, 2173796752, 4290707456, 753664, 4294852608, 0, 76547513,
-4152423904, 71304336, 4152423936, 25854351, 4290707456, 720896, 0, 32768,
-71304704, 4165007232, 71304633, 4152423904, 25887113, 4290592768, 589824, 32768,
-0, 42992704, 4156618258, 71304704, 4165006816, 25952647, 4289855488, 1048576,
-1245184, 458752, 42993152, 4165006816, 85984768, 4165006788, 2173829517, 4290150400,
-4294672384, 4294672384, 1343488, 42993152, 4165006788, 42993058, 4134597952, 2173895054,
-4291100672, 720896, 65536, 0, 75498624, 4167104576, 76547584, 4169201728,
-2174058900, 4291100672, 753664, 0, 4294934528, 42993152, 4165006656, 75499008,
-4169201728, 26214799, 4290953216, 180224, 0, 98304, 58196904, 4162910200,
-58196904, 4160288712, 2174386585, 4290854912, 180224, 98304, 0, 54526840,
-4162910152, 58196904, 4162910152, 26378648, 4290854912, 278528, 0, 4294868992,
-54526888, 4157142944, 54526888, 4162910152, 26444183, 4290953216, 278528, 4294868992,
-0, 61342688, 4162910112, 54526888, 4162910112, 26509718, 4290772992, 131072,
-0, 196608, 54526944, 4162910112, 56624064, 4154521504, 2174419349, 4290969600,
-65536, 4294836224, 0, 54526944, 4162910112, 54526784, 4160812992, 2174484886,
-4291035136, 131072, 4294901760, 4294901760, 54526944, 4162910112, 54526816, 4162910208,
-2174550423, 4290969600, 393216, 65536, 4294901760, 54526944, 4162910112, 62915552,
-4162910208, 2174615960, 4290838528, 393216, 131072, 0, 54526944, 4162910112,
-65012704, 4160812992, 2174681497, 4291035136, 327680, 0, 4294770688, 54526944,
-4162910112, 44041344, 4167104544, 2174747034, 4290838528, 65536, 4294901760, 65536,
-44041344, 4167104416, 41943928, 4167104344, 2174812571, 4290592768, 131072, 0,
-4294705152, 42992488, 4148754032, 48235360, 4149802824, 2174976418, 4290625536, 4294639616,
-0, 196608, 41944192, 4167104344, 42992488, 4149802608, 27066780, 4291198976,
-458752, 0, 212992, 67110016, 4173396080, 67109992, 4168153184, 2175107492,
-4291362816, 327680, 4294836224, 0, 62915584, 4173396096, 59769792, 4173396096,
-2175238566, 4291231744, 458752, 4294934528, 0, 67110016, 4173396064, 59769856,
-4173396096, 27263391, 4291166208, 720896, 0, 4294918144, 41944192, 4167104112,
-59769984, 4173396064, 27328926, 4290838528, 393216, 4294901760, 4294901760, 42993152,
-4169200960, 41944192, 4173395568, 27394449, 4290576384, 4294639616, 49152, 0,
-25166464, 4167104192, 41944576, 4173395264, 27459973, 4290641920, 4293459968, 4294770688,
-0, 4194496, 4152424192, 4290773056, 4150326976, 2175369640, 4291362816, 4292804608,
-4294836224, 262144, 4278255552, 4173396096, 4278255488, 4173395840, 2175500714, 4290838528,
-4293722112, 0, 4294705152, 4194496, 4156618656, 4194496, 4165007296, 2175697325,
-4290772992, 4293722112, 0, 4294705152, 4194496, 4154521472, 4194496, 4165007264,
-27754924, 4291231744, 4293197824, 131072, 0, 4278255552, 4173395840, 4194496,
-4165007232, 27787686, 4290707456, 4293722112, 0, 4294705152, 4290773184, 4152424128,
-4278190272, 4173395840, 27853221, 4290969600, 4292804608, 0, 4294836224, 4265672576,
-4160812928, 4265672384, 4165007360, 2175828399, 4290969600, 4292411392, 0, 4294836224,
-4248895040, 4160812928, 4248894976, 4169201664, 2175959473, 4291231744, 4292280320, 0,
-4294836224, 4248895040, 4169201536, 4248894912, 4173396096, 2175992236, 4291100672, 4292411392,
-4294836224, 0, 4265672576, 4165007232, 4248895040, 4173395840, 28115371, 4290576384,
-4292673536, 131072, 0, 4265672384, 4152424128, 4273995840, 4148229824, 2176156084,
-4290707456, 4292673536, 0, 393216, 4248895360, 4173395840, 4265607232, 4152424128,
-28246446, 4290576384, 4293197824, 4294705152, 262144, 4278190272, 4173395648, 4248830016,
-4173395648, 28311978, 4290838528, 4293787648, 262144, 0, 12583136, 4165007296,
-14680320, 4165007296, 2176287158, 4291166208, 4293853184, 0, 262144, 16777600,
-4173396064, 16777600, 4167104576, 2176483769, 4291100672, 4294115328, 0, 4294705152,
-16777600, 4165007296, 16777600, 4173396032, 28541368, 4290838528, 4293853184, 262144,
-0, 12583168, 4165007296, 16777600, 4173395904, 28574130, 4290707456, 4293853184,
-0, 262144, 16777600, 4154521472, 16777600, 4152424288, 2176680380, 4290772992,
-4293853184, 0, 262144, 16777600, 4156618656, 16777600, 4154521440, 28737979,
-4290576384, 4293853184, 0, 262144, 16777600, 4150327104, 16777600, 4148229824,
-2176811454, 4290641920, 4293853184, 0, 262144, 16777600, 4156618592, 16777600,
-4150326976, 28836279, 4290838528, 4293787648, 0, 65536, 12583296, 4173395904,
-16777600, 4156618432, 28901813, 4290707456, 4293722112, 65536, 0, 4248830144,
-4173395648, 12583296, 4173395648, 28967345, 4290576384, 4294115328, 4294705152, 0,
-25167360, 4173395264, 4248830336, 4173395648, 29032868, 4291362816, 229376, 0,
-98304, 4236249376, 4223727808, 4248831488, 4173395264, 29098368, 4292935680, 4293656576,
-0, 262144, 4219472576, 167836608, 4236249376, 4223726912, 29163800};
+extern const uint32_t e1m1_WADSectors[700] = {
+220203680, 65536, 524543, 178257920, 134432, 16711681, 8, 246416320,
+262147, 255, 115343360, 199008, 16711684, 0, 99614960, 393221,
+160, 26214400, 461952, 10485766, 0, 209715760, 393223, 160,
+47185920, 461952, 10485766, 0, 209716080, 393223, 160, 68157440,
+461952, 10485766, 0, 209716400, 393223, 160, 99614720, 461952,
+10485766, 0, 209716880, 393223, 160, 120586240, 461952, 10485766,
+0, 209717200, 393223, 160, 141557760, 462032, 10485760, 0,
+214960400, 7, 160, 68157440, 528048, 15728644, 0, 246416560,
+262152, 240, 89128960, 461952, 10485766, 0, 188745360, 393225,
+160, 89128960, 525648, 10485769, 327689, 230689440, 589833, 160,
+141557760, 592784, 10485766, 0, 110100720, 393221, 144, 15728640,
+329200, 9437190, 0, 15728880, 589829, 160, 15728640, 328640,
+8388614, 0, 78643760, 655360, 524543, 15728640, 329920, 7340038,
+0, 94372160, 393221, 144, 26214400, 329120, 9437190, 0,
+78643680, 720901, 224, 31457280, 328880, 9437195, 0, 199231440,
+786439, 524543, 15728640, 328640, 9437190, 0, 62914800, 393221,
+144, 15728640, 328640, 16711686, 1, 62914800, 393221, 144,
+5242880, 853328, 9437198, 7, 89129120, 917519, 144, 10485760,
+983840, 9437190, 0, 4263573392, 262147, 144, 4200595456, 393056,
+9437200, 0, 4242602832, 589833, 144, 4216324096, 654560, 9437193,
+0, 4242602832, 589833, 144, 4153409536, 260864, 9437188, 0,
+4226873072, 655377, 255, 4195352576, 1178928, 16711690, 851976, 4242602832,
+589833, 144, 4200595456, 392896, 9437202, 0, 4247845472, 1048581,
+144, 4211081216, 328320, 9437200, 0, 4247845472, 1048581, 144,
+4200595456, 391776, 9437193, 0, 42007456, 1048581, 144, 4216324096,
+654560, 9437193, 0, 4242602832, 589833, 144, 4232052736, 328320,
+9437200, 0, 42007776, 1048581, 144, 4253024256, 328320, 8388624,
+0, 246417840, 393223, 160, 178257920, 1248544, 16711681, 8,
+209717200, 393223, 160, 141557760, 462032, 10485760, 0, 214960400,
+7, 160, 178257920, 593344, 10485769, 0, 230689440, 589833,
+160, 78643200, 461952, 10485766, 0, 209716560, 393223, 160,
+99614720, 461952, 10485766, 0, 209716880, 393223, 160, 120586240,
+461952, 10485766, 0, 193988720, 393225, 160, 110100480, 592704,
+10485766, 0, 99614960, 393221, 160, 26214400, 461952, 10485766,
+0, 15728880, 589829, 160, 36700160, 461952, 10485766, 0,
+209715920, 393223, 160, 57671680, 461952, 10485766, 0, 209716240,
+393223, 160, 4289724416, 1311920, 16711686, 0, 78708656, 393236,
+112, 15728640, 330000, 8388614, 0, 78708656, 393236, 112,
+4284481536, 1312480, 16711690, 3, 78708656, 393236, 112, 99614720,
+1378576, 7340038, 65536, 157288000, 1441795, 196800, 4289724416, 1311360,
+7340038, 0, 42008496, 393236, 112, 0, 328640, 16711686,
+0, 62914640, 393221, 176, 10485760, 328640, 10485766, 0,
+62914800, 393221, 144, 15728640, 327920, 9437193, 458752, 47185920,
+1441815, 176, 15728640, 327920, 9437193, 0, 99614960, 655365,
+255, 20971520, 329200, 16711690, 0, 99615120, 655365, 255,
+31457280, 329200, 16711690, 0, 68157760, 786437, 65791, 4284481536,
+1311840, 16711690, 8, 4284546912, 327700, 589936, 36700160, 460112,
+8388619, 0, 193987200, 720903, 128, 125829120, 1379216, 8388619,
+262144, 104858000, 786452, 524543, 36700160, 1312320, 16711692, 8,
+104858000, 1572884, 524400, 26214400, 1312320, 7340056, 8, 62914800,
+393221, 65791, 15728640, 328640, 7340038, 0, 15728880, 589829,
+589968, 73400320, 1313920, 7340038, 0, 209716400, 393236, 112,
+89128960, 1313920, 7340038, 0, 131072000, 1048581, 112, 0,
+329680, 7340038, 0, 110101600, 65553, 852223, 0, 328320,
+7340048, 0, 0, 589829, 255, 73400332, 1115792, 16711681,
+13, 42008096, 1048581, 128, 4273995776, 328320, 8388624, 0,
+52494176, 1441797, 196863, 0, 327680, 16711689, 786432, 110101600,
+65553, 852223, 99614720, 1313920, 7340038, 0, 209716880, 393236,
+112, 120586240, 1313920, 7340038, 0, 209717200, 393236, 112,
+141557760, 1313920, 7340038, 0, 209717520, 393236, 112, 162529280,
+1641600, 16711686, 720896, 209717680, 393236, 255, 162529280, 1313920,
+7340038, 0, 162531760, 589844, 590079, 146800640, 857088, 9437190,
+7, 235932080, 393236, 160, 162529280, 1313920, 11534342, 0,
+335546560, 393229, 458896, 4289724416, 1311920, 7340038, 0, 115408736,
+655380, 196863, 4289725415, 1311360, 7340038, 0, 115408736, 655380,
+196863, 4289725415, 1311360, 7340038, 0, 110100880, 393221, 144,
+36700160, 329360, 9437190, 0, 110101200, 393221, 144, 57671680,
+329840, 9437190, 0, 141558800, 393221, 144, 78643200, 330880,
+9437190, 0, 209716560, 393221, 144, 99614720, 330880, 9437190,
+0, 209716880, 393221, 144, 120586240, 330880, 9437190, 0,
+209717200, 393221, 144, 141557760, 330880, 9437190, 0, 209717520,
+393221, 144, 146800640, 857088, 9437190, 7, 131072960, 1703941,
+144, 68157440, 329680, 9437210, 0, 131073120, 1703941, 144,
+78643200, 329680, 9437210, 0, 131073280, 393243, 144, 83886080,
+1773232, 16711686, 0, 267386880, 262147, 255, 104857600, 593344,
+16711689, 0, 230688320, 589833, 255, 83886080, 1771472, 16711686,
+0, 83886080, 262147, 255, 68157440, 855728, 16711686, 7,
+246417680, 393221, 255, 104857608, 593344, 16711689, 0, 125830320,
+393221, 144, 94371840, 591744, 9437190, 0, 209717520, 393221,
+786687, 10, 1312160, 9437210, 0, 36765616, 786452, 255,
+4284481536, 1311200, 16711692, 8, 94371920, 1703941, 144, 10485760,
+329120, 9437210, 0, 94372080, 1703941, 144, 47185920, 1311520,
+12, 8, 4284546912, 327700, 589920, 4284481542, 1311280, 16711692,
+0, 94372160, 1703941, 144, 26214400, 329120, 9437210, 0,
+94372320, 1703941, 144, 31457280, 329120, 16711702, 2, 31457760,
+1703941, 589968, 36700160, 329120, 9437210, 0, 94372480, 1703941,
+144, 47185920, 329120, 9437210, 0, 94372640, 1703941, 144,
+57671680, 329680, 9437210, 0};
+extern const uint32_t e1m1_WADNodes[3129] = {
+4271900480, 65408, 29362880, 167836608, 4219470272, 167836608, 8978433, 4293984224,
+11534400, 29361808, 167837446, 29362880, 4258752, 3932162, 4284482480, 8388608,
+29361808, 167773008, 29361216, 55639814, 2555907, 10487200, 4286578688, 29361808,
+88081232, 29361794, 167773504, 983044, 4276094176, 128, 29360640, 83887104,
+41944720, 88081232, 393221, 4271899872, 4194304, 29360640, 83887232, 29360640,
+71304192, 2147581952, 11535776, 65088, 63964816, 88081280, 41944000, 88081232,
+524295, 52429792, 4292673984, 63964736, 88081280, 102499984, 88081280, 2147713026,
+6292704, 4286578688, 41943936, 75498320, 50332608, 88081536, 851977, 2098272,
+4286578688, 41943872, 67109712, 46138240, 75498496, 786442, 1056, 4286578688,
+41943840, 62915408, 44041024, 67109824, 2147876875, 4286579744, 65520, 44040992,
+62915408, 41943712, 61866832, 2147844100, 4195488, 4286578688, 46138208, 71304192,
+48235392, 75498560, 2148040711, 10487136, 4286578688, 50332608, 83887232, 54526912,
+88081664, 2148204558, 8389920, 4286578688, 50332576, 79692928, 52429760, 83887296,
+2148171785, 2098816, 4290772992, 29361794, 102761792, 29361785, 167773728, 1966096,
+2098592, 224, 29360960, 102761792, 54527618, 102761792, 1441809, 4284483200,
+65360, 41943872, 102761792, 29360768, 102761840, 1310738, 4288677504, 65344,
+46138176, 102761792, 41943744, 102761824, 2148401171, 4292871808, 65328, 50332480,
+102761792, 46138112, 102761808, 2148368396, 4280288896, 65376, 37749376, 102761840,
+29360704, 102761856, 1409039, 4276094592, 65392, 33555008, 102761856, 29360640,
+102761872, 2148630544, 11535872, 65456, 63964802, 102761792, 54526928, 102761792,
+1835031, 14681728, 65432, 67110530, 102761792, 63964160, 102761792, 1769496,
+18876032, 65432, 71304834, 102761792, 67109952, 102761912, 1703961, 50070944,
+4293853408, 71304732, 102761792, 101320322, 102761792, 2148761618, 18875928, 4290772992,
+67109952, 95946168, 67109952, 102761912, 2148892692, 14681624, 4291821568, 63964160,
+95946048, 63964160, 102761912, 2149023766, 10487200, 16, 54526912, 102761792,
+62915536, 102761808, 1933336, 11535872, 4293918720, 62915536, 94373200, 62915536,
+102761912, 2149220377, 48891520, 4291166944, 29361674, 167773728, 96142969, 167773728,
+2149842975, 4271900352, 1048576, 29361669, 167773792, 30410250, 106956320, 2359328,
+28314080, 4243587072, 29361669, 159385184, 29361595, 167774592, 2149515297, 45091168,
+4278190208, 29361669, 159385184, 80741840, 159385856, 2149449762, 4272949056, 65408,
+30410245, 159385184, 29360592, 159385184, 2326555, 4272949056, 4293918720, 29360592,
+115344992, 29360592, 159385360, 2149416988, 8914560, 16, 30409640, 106956320,
+61343242, 106956320, 2490405, 4272948880, 11534336, 30409640, 106956336, 41943976,
+103810592, 2149679136, 11536016, 65520, 63964682, 106956320, 61342672, 103810608,
+2149810210, 4280287520, 65440, 37749824, 55639861, 29360704, 42008326, 3145768,
+4288676576, 4194472, 37749504, 55574960, 37749824, 42008373, 2883625, 4292871072,
+4286578688, 37749504, 54526384, 41943808, 55575360, 2150105130, 4288676576, 4286578688,
+37749440, 41943472, 37749504, 54526592, 2850853, 4284482440, 4290838360, 37749504,
+54526592, 41943689, 54526760, 2150072358, 4292346080, 65280, 49808448, 8454016,
+37749496, 42008373, 3080237, 10485792, 128, 49808320, 8454016, 62915648,
+8454080, 3047465, 14680288, 65472, 67109952, 8454127, 62915584, 4259776,
+2150334506, 4292411360, 256, 37749496, 42008373, 49742584, 4286644087, 2150465580,
+4271898816, 6291456, 29360704, 41943136, 29360704, 6356742, 3670065, 4279239168,
+4292870144, 29360704, 27263072, 29360704, 41943456, 3342386, 4271899040, 8454016,
+29360704, 27263168, 29360672, 18874464, 2150596654, 4276093488, 1048592, 29360704,
+41943504, 33555008, 31457696, 3440688, 4276093456, 32, 33554944, 30409136,
+33555008, 31457696, 3506225, 4277142080, 2097152, 34603568, 31457760, 33555008,
+31457696, 3571762, 4279239232, 1114096, 36700736, 31457744, 33555008, 28311968,
+3637299, 4280287760, 4293984240, 36700736, 28311968, 33554960, 28311968, 2150989876,
+4278190240, 65408, 35652160, 6356896, 29360672, 4259590, 3801145, 4279238832,
+65376, 36700736, 6356896, 35652144, 5308336, 2151120950, 4277141536, 1048576,
+29360672, 4259776, 29360672, 4290313990, 2151284795, 4277141664, 65408, 34603552,
+4259776, 29360656, 4259776, 2151252024, 33619160, 464, 29361440, 4293917632,
+127929024, 4258752, 5963837, 4288740832, 3604983, 29360887, 4286053312, 42992928,
+4293917632, 5046334, 4271963552, 1048576, 29360887, 4286053696, 29360797, 4248894400,
+4718655, 4278255216, 1048592, 29360887, 4286053904, 29360869, 4275502400, 4325440,
+4280352661, 65420, 37749495, 4286054080, 29360704, 4280942096, 4292667, 4280352544,
+4286578688, 29360704, 4274060816, 29360672, 4280942336, 2151514172, 4282449488, 4293984240,
+29360857, 4268424512, 35652325, 4275502560, 4423742, 4279303808, 2097152, 36700901,
+4275502624, 35652192, 4263575008, 4489279, 4278255184, 32, 35652128, 4262526448,
+35652192, 4263575008, 4554816, 4281400960, 1114096, 38797920, 4263575056, 35652192,
+4262526432, 4620353, 4282449520, 65504, 39846496, 4262526448, 35652176, 4260429280,
+4685890, 4281400896, 4292870144, 36700752, 4259380704, 35652144, 4260429280, 2151972931,
+4286446752, 4294115328, 33555101, 4232117184, 29360640, 4248894528, 4915273, 4285594784,
+65408, 42992285, 4232117184, 33555088, 4232117184, 4882501, 4284546080, 128,
+33555072, 4232117184, 41943696, 4232117184, 2152169542, 4274060672, 4292870144, 29360640,
+4246797376, 29360592, 4248894768, 2152333388, 4276157600, 4292870208, 31457792, 4236311616,
+29360608, 4246797440, 2152300616, 2162016, 4259776, 54527264, 4293917760, 42992640,
+4240505792, 5898318, 14745568, 4194304, 62915648, 4293918592, 54527264, 4269866048,
+5242959, 14680096, 65472, 67109952, 4293918592, 62915584, 4290838464, 2152497227,
+25230752, 4282384384, 54527264, 4248894528, 54527264, 4269866304, 5341261, 25230944,
+65344, 77595936, 4269866304, 54527136, 4269866304, 5406798, 12648032, 12582912,
+54527136, 4269866496, 54527136, 4261477696, 5472335, 12647840, 192, 54526944,
+4261477696, 65012896, 4261477696, 5537872, 16842256, 4194304, 65012896, 4261477808,
+65012896, 4256234816, 5767253, 16842256, 16, 65012768, 4261477808, 69207200,
+4261477808, 5668945, 16842272, 4194304, 69207200, 4261477824, 69207200, 4257283504,
+5734482, 21036576, 65520, 73401504, 4257283504, 69207136, 4257283504, 2153021523,
+16842208, 48, 65012768, 4256234816, 69207200, 4256234816, 5865557, 21036560,
+65488, 73401504, 4256234816, 69207136, 4253089088, 2153218134, 2161824, 4284284928,
+42992640, 4232117184, 54526976, 4240505920, 2153349208, 83950816, 14680064, 127929024,
+4258944, 134220032, 4236311488, 8847452, 93912552, 524296, 127928988, 4259008,
+133171904, 4285332608, 7929949, 98631392, 64, 127928576, 4259008, 150997660,
+4259440, 6946910, 98566144, 4282384384, 127928576, 4288740544, 129894656, 4259744,
+2154168415, 85983232, 4284546336, 127928576, 4288740544, 127928384, 4288740544, 2154102880,
+89718584, 589816, 136710400, 4288740992, 127928512, 4281007296, 6619233, 89718584,
+4194368, 136710400, 4288741080, 142084352, 4279828096, 6455386, 94437232, 4294443016,
+142084352, 4279828096, 146278656, 4279828248, 2153644131, 94437232, 4290838464, 142608640,
+4279303808, 142084288, 4279828176, 2153578596, 97582896, 4291821632, 142608640, 4279303808,
+149948672, 4275109563, 2153545819, 89718384, 128, 127928440, 4281007296, 142084288,
+4275109256, 6717535, 90242608, 4294508536, 142084288, 4258332040, 142084224, 4275109328,
+6881383, 90242608, 4259776, 142608576, 4258332048, 142084288, 4258332040, 6848608,
+93912552, 4290773056, 142084280, 4257807752, 142084288, 4258332040, 2153939041, 90242864,
+65472, 142608512, 4275109328, 142084224, 4270915088, 2154070115, 98631392, 4194304,
+150997660, 4259456, 150997312, 4269866608, 7667819, 98631544, 8912896, 150997660,
+4259608, 150997448, 4279828096, 7209068, 119537664, 4273995776, 150997660, 4288741144,
+150997642, 4259744, 2154365037, 120979333, 4293591163, 150997589, 4288741144, 171969180,
+4288741157, 2154332263, 102825696, 64, 150997312, 4278255232, 155191752, 4279828096,
+7340143, 98631456, 4194304, 150997312, 4278255296, 150997312, 4274060928, 2154528874,
+111214384, 524296, 155191752, 4279828096, 163580360, 4275633808, 7602289, 111214384,
+4290773056, 155191744, 4279303808, 159386056, 4279828176, 7536754, 107020144, 4291887040,
+155191744, 4279303808, 155191632, 4275109563, 2154659948, 107544440, 4259776, 159910344,
+4279828184, 159386056, 4279828176, 2154791022, 111214320, 64, 163580352, 4275109520,
+164104648, 4275633816, 2154922096, 99679960, 2097152, 150997312, 4269866616, 152045872,
+4269342320, 7766130, 101777104, 4292870144, 152045872, 4268818032, 152045872, 4269342320,
+7831667, 99679952, 8, 152045840, 4269342320, 152045872, 4269342320, 7897204,
+101777112, 65528, 154143024, 4269342320, 152045872, 4269342320, 2155249781, 102825376,
+48, 133171520, 4254137472, 155192000, 4285332656, 8388730, 80805152, 8388608,
+133171520, 4254137536, 136317208, 4240505984, 2155675771, 94436848, 4194304, 146803008,
+4254137744, 133171520, 4254137536, 8159351, 92339552, 4292935616, 142608704, 4254137536,
+133171384, 4253613248, 2155610237, 102825424, 4290772992, 142608704, 4252040384, 150997312,
+4254137712, 8323198, 92339552, 8388608, 144705856, 4252040448, 142608672, 4244700352,
+2155446392, 98631136, 4194304, 150997312, 4254137728, 150997312, 4253089136, 2155577466,
+127991056, 4287955573, 155192000, 4280679600, 173345472, 4285332656, 2156200065, 111738408,
+4294443016, 155192000, 4258331824, 163580601, 4280679639, 8716418, 107544040, 4290772992,
+155716288, 4253613232, 155191752, 4258332040, 8618110, 107019760, 4194368, 155191744,
+4258332048, 159386056, 4258332040, 8683647, 111738408, 4290838464, 159910344, 4257807752,
+159386056, 4258332040, 2155970688, 111738480, 65464, 164104889, 4280679639, 163580360,
+4270915024, 8814722, 111214128, 64, 163580352, 4270915024, 163580360, 4270915088,
+2156167299, 81853536, 14155776, 134220032, 4236311552, 134220016, 4227922880, 2156396680,
+81853600, 14155776, 134220032, 4236311616, 134219992, 4232117248, 2156363910, 4196401952,
+20971520, 4244636096, 167772864, 4219470272, 46201792, 11927690, 4246734464, 65360,
+4194752, 167772864, 4244635712, 167772864, 10289291, 4255123072, 4290772992, 4194752,
+102761152, 4194752, 167773728, 9765004, 4259317088, 4290772992, 4194752, 83886784,
+4194752, 102761728, 9502861, 4255122656, 4194304, 12583360, 83887232, 4194752,
+75498176, 9371790, 4259317088, 65408, 16777664, 83887232, 12583168, 83887232,
+2156560521, 4261414048, 8388608, 18874784, 75498560, 4194752, 71303872, 9470091,
+4255122528, 10485760, 12583360, 71304192, 4194407, 52953792, 2156757132, 4255122928,
+144, 4194496, 102761840, 12583360, 102761728, 9633938, 4250928608, 160,
+4194432, 102761840, 8388800, 102761856, 2156888206, 4255122928, 4194304, 12583360,
+102761872, 16777664, 93324544, 2157052052, 4259317232, 144, 12583168, 102761872,
+16777664, 102761872, 2157019280, 4259317568, 4293918720, 4194752, 115344928, 4194752,
+167773920, 9961622, 4259317400, 65512, 16777664, 115344928, 4194560, 115344944,
+9928851, 4258268864, 128, 4194544, 115344944, 15728896, 115344992, 2157281428,
+4261414768, 8388608, 4194752, 167773968, 15729088, 118490848, 10092697, 4271901152,
+4269801472, 4194752, 159385360, 4194752, 167774592, 2157412502, 4261414768, 65520,
+18874816, 118490848, 15728928, 118490848, 10223771, 4269803360, 4286578688, 18874816,
+117442272, 18874784, 118490880, 2157543576, 4261414752, 4292935648, 16777504, 117442272,
+15728880, 118490848, 2157674650, 4234151328, 4194320, 4245422144, 167773346, 4244635712,
+88081088, 11141278, 4225762720, 65512, 4278190144, 167773472, 4245487360, 167773346,
+10879135, 4238345856, 4290772992, 4278190144, 102761760, 4278190144, 167773728, 10748064,
+4234151328, 224, 4278255488, 102761760, 4286578752, 102761792, 10616993, 4234151328,
+4286578688, 4278255488, 88081696, 4278255488, 102761792, 2157805724, 4238345648, 208,
+4286644160, 102761792, 4290773056, 102761808, 10715294, 4242539968, 192, 4290772992,
+102761808, 64, 102761824, 2158002335, 4225762960, 1572864, 4278190144, 167773744,
+4279763008, 103810592, 2158166181, 4246735328, 4273995776, 4278190144, 159385136, 4278190144,
+167774592, 2158133409, 4225763808, 4274061184, 4245487360, 159384738, 4248108800, 167774408,
+2158493863, 4204792160, 4289330107, 4251582208, 159384762, 4245487040, 150996130, 2158428328,
+4224714344, 40, 4251582192, 158926010, 4277206784, 159384896, 11108516, 4224714384,
+1048576, 4277206784, 159385136, 4277206784, 101188928, 2158395557, 4224713696, 412,
+4244700912, 85721792, 4278190144, 88081088, 11272363, 4199089434, 4292410886, 4248895216,
+85721792, 4244700521, 79299264, 2158657705, 4242539616, 4286578688, 4286578752, 67109568,
+4278190080, 88081408, 11665581, 4238345136, 8388608, 4286578752, 67109712, 4289527872,
+55575232, 11534510, 4244636704, 4286578688, 4288675904, 62915408, 4286578720, 67109824,
+2158821551, 4246733744, 4292870240, 4288675904, 62915408, 1703968, 62915504, 2158788779,
+4246733728, 4286578688, 4289527872, 54526656, 4290773056, 55575360, 2159018161, 4238345120,
+65512, 4290773056, 54526760, 4289593280, 52953792, 2158985390, 4236248352, 4286578688,
+4280287232, 79692800, 4278255520, 88081600, 11862195, 4238345440, 4286578688, 4282384384,
+75498496, 4280352704, 79692928, 2159214772, 4240442528, 4286578688, 4284481536, 71304192,
+4282449888, 75498560, 2159182001, 4234151264, 4286578688, 4278255520, 83887296, 4278255488,
+88081664, 2159378612, 4255186720, 4286578688, 4240441792, 4274060224, 4219470272, 46202560,
+14614711, 4250991904, 96, 4240441472, 4274060224, 8389056, 4274060224, 13762744,
+4221632032, 65408, 4273995904, 4274060224, 4240506560, 4274060224, 13107385, 4242603552,
+4286578688, 4273995904, 4257283008, 4273995904, 4274060736, 12845242, 4242603552, 65408,
+128, 4257283008, 4273995776, 4257283008, 12452027, 4250992000, 4286578688, 128,
+4246797248, 128, 4257283392, 12386492, 4246141984, 4784256, 128, 4246797248,
+3539072, 4232117184, 2159509686, 4246797856, 65408, 4194432, 4257283392, 64,
+4257283392, 2159640760, 4232117632, 4284481696, 4274061248, 4257283008, 4273995776, 4257283360,
+12714175, 4221631744, 16777216, 4274061248, 4257283232, 4274061248, 4238408640, 12648640,
+4238408960, 4278190240, 4274061248, 4248894624, 4274061248, 4257283232, 2159771834, 4238408960,
+65312, 4290838464, 4238408640, 4274061184, 4236311552, 2159902908, 4232117632, 160,
+4274061152, 4257283360, 4284481536, 4257283360, 12812478, 4242603392, 4284481536, 4284481536,
+4246797600, 4286578688, 4257283392, 2160099519, 4232117792, 96, 4274061152, 4274060736,
+4286578816, 4274060736, 12976325, 4232117888, 4284481536, 4274061152, 4263574976, 4274061120,
+4274060864, 2160230593, 4236312312, 10551136, 4288675968, 4274060792, 4286578752, 4261477824,
+13074627, 4246797912, 65480, 4194368, 4260953536, 4286578688, 4261477824, 2160427204,
+4196466144, 12582912, 4240506560, 4274060672, 4240506560, 4253088704, 13500617, 4209049056,
+320, 4240506368, 4274060672, 4265672384, 4274060736, 13369546, 4188077728, 12582912,
+4240506368, 4274060864, 4240506368, 4265672064, 13336774, 4200660640, 65472, 4253089280,
+4265672064, 4240506240, 4261477760, 2160623815, 4221632128, 4286578688, 4265672384, 4263574976,
+4265672384, 4274060832, 13467849, 4213243552, 8388608, 4265672384, 4274060864, 4265672384,
+4265672224, 2160820426, 4198038944, 65376, 4250468032, 4248894400, 4240506200, 4253088704,
+13697231, 4221631712, 4278190080, 4257283776, 4236311488, 4250468032, 4248894624, 2160984272,
+4213242912, 64, 4257283648, 4236311488, 4265672384, 4236311552, 2160951500, 4196465696,
+224, 4240506176, 4253088704, 4248894808, 4248894624, 2161148111, 4260429088, 4291821568,
+8388992, 4240505792, 8389056, 4274060480, 14352595, 4253088928, 2097152, 8388896,
+4240505920, 10486144, 4232117184, 14221524, 4257283232, 128, 8388832, 4240505920,
+14680352, 4240505920, 14090453, 4255186080, 128, 8388800, 4240505920, 12583136,
+4240505920, 2161311958, 4253088928, 128, 8388768, 4240505920, 10485952, 4240505920,
+2161279185, 4260428960, 128, 14680336, 4240505920, 17826080, 4240505920, 14188756,
+4261477664, 65408, 18874656, 4240505920, 17826080, 4240505920, 2161541333, 4261477408,
+24, 10486048, 4227922880, 18874752, 4232117184, 14319831, 4261477536, 6356928,
+18874752, 4232117248, 25166208, 4227922880, 2161737944, 4263574928, 8388608, 8389056,
+4274060592, 18874816, 4247846080, 14549212, 4271963936, 4285595264, 19923392, 4274060592,
+8389056, 4274060608, 2161901789, 4262526368, 9437184, 19923392, 4274060608, 19923392,
+4248894768, 2161869018, 4271963520, 4286578688, 18874816, 4246797504, 20971968, 4247846176,
+2162065629, 4255186864, 112, 4219470016, 46202560, 12583360, 42008288, 17236192,
+4236312544, 65344, 4288676032, 46202560, 4219535264, 46202560, 16187617, 4242603936,
+384, 4288675840, 46202560, 192, 46202560, 14844127, 4246733216, 8388608,
+192, 46137664, 192, 21036736, 15335651, 4246733392, 65504, 4194496,
+46137664, 64, 33554880, 15007972, 4255122144, 4290772992, 4194496, 41943360,
+6750336, 46137984, 2162262240, 4242539088, 1048592, 16, 33554928, 64,
+33554880, 15106274, 4243587680, 2097152, 1048624, 33554944, 64, 33554880,
+15171811, 4245684832, 1114096, 3145792, 33554928, 64, 30409152, 15237348,
+4246733360, 4293984240, 3145792, 30409152, 48, 30409152, 15302885, 4245684768,
+4292870144, 1048624, 29360576, 16, 30409152, 2162655462, 4245684400, 9437328,
+192, 20971552, 192, 14745280, 15532267, 4246733216, 65408, 4194496,
+20971616, 64, 20971552, 15499496, 4246733088, 4290772992, 64, 12582944,
+64, 20971712, 2162852073, 4255186816, 4285530256, 192, 4292935360, 192,
+14745376, 15728878, 4246798240, 65408, 4194496, 4288741056, 64, 4292935360,
+15696107, 4242603936, 4194304, 64, 4292935488, 64, 4282449600, 2163048684,
+4245684240, 160, 48, 5308336, 3145920, 14745376, 15827182, 4247257264,
+7864440, 3145920, 14680120, 3145920, 13172512, 15892719, 4255186840, 4287103096,
+3145920, 4291362592, 3145920, 13172536, 15958256, 4247257104, 160, 3145800,
+5308336, 4718784, 13172536, 16023793, 4248830128, 6291552, 4718784, 13107256,
+4718784, 11599672, 16089330, 4255186864, 4288675936, 4718784, 4291362616, 4718784,
+11599696, 16154867, 4248829968, 160, 4718688, 5308336, 6291648, 11599696,
+2163572980, 4204855264, 65408, 4257284000, 33619648, 4219534784, 46202560, 16580856,
+4236247264, 4280287232, 4257284000, 8453824, 4257283648, 33554560, 2163933433, 4221632352,
+65472, 4274061216, 8453824, 4257283776, 4259584, 16449786, 4221632480, 14680064,
+4274061216, 8454016, 4274061120, 4282449600, 2163704054, 4213243808, 256, 4257283648,
+4259584, 4265672384, 2162432, 16548088, 4221632416, 4286578688, 4265672384, 4282449664,
+4271963840, 2162656, 2163900665, 4204790368, 4277141504, 4219534784, 33619648, 4232117440,
+46137856, 17170686, 4200595936, 4194304, 4219534784, 33554816, 4219534784, 25231040,
+16744700, 4188012576, 384, 4219534528, 25231040, 4240506304, 25231040, 16974080,
+4188077984, 4282384384, 4219534528, 4282449600, 4219534528, 25231168, 16875773, 4179624352,
+65152, 4232117440, 21036992, 4219534400, 25231168, 16941310, 4175495072, 512,
+4219534336, 25231168, 4227923008, 20971840, 2164293887, 4192272352, 12582912, 4240506304,
+25231232, 4240506176, 4282449600, 2164523268, 4192207264, 65088, 4244700608, 25231232,
+4240506112, 20971840, 2164457733, 4200595808, 128, 4244700544, 25231232, 4253089216,
+16842624, 2164424961, 4181721760, 4194304, 4232117440, 46137920, 4234214560, 37749248,
+2164687109, 4268753056, 4293394432, 12583360, 4259552, 12583360, 41943136, 17563912,
+4259381216, 4194304, 12583360, 4259712, 16777664, 4286643936, 17432841, 4263510048,
+8388608, 12583360, 4259776, 16777536, 4290838400, 2164818183, 4267769696, 128,
+16777600, 4286643936, 25166272, 4286643968, 2164982027, 4263575360, 160, 16777536,
+4286643936, 20971904, 4286643936, 2164949257, 4271899008, 4286578688, 14680512, 18874464,
+12583360, 41943328, 18153741, 4263510208, 32, 14680384, 18874464, 20971968,
+18874464, 17727756, 4269801696, 2097152, 20971968, 18874496, 20971968, 8388704,
+18022671, 4263510304, 8388608, 20971968, 18874560, 20971968, 12583040, 17858829,
+4265607392, 1048608, 20971904, 12583040, 23069120, 12583040, 17924366, 4268753152,
+1114080, 25166272, 12583040, 23069088, 10485888, 17989903, 4266656000, 2097152,
+24117648, 10485920, 23069088, 10485888, 2165408016, 4265607360, 32, 20971872,
+8388704, 23069120, 8388704, 18120978, 4269801696, 65504, 27263424, 8388704,
+23069088, 8388704, 2165604627, 4264559008, 7340032, 12583360, 41943360, 16777536,
+20971808, 18350358, 4263510432, 320, 12583232, 41943360, 20971968, 41943360,
+18317589, 4264559328, 65216, 22020544, 41943360, 20971856, 41943360, 2165801238,
+4263510416, 4290772992, 16777536, 19923232, 16777536, 20971824, 2165932312, 7403808,
+3145728, 4236249376, 4223727808, 4248831488, 4173395264, 25297178, 10549712, 65520,
+62916896, 4223727824, 4236248000, 4223727808, 22085915, 56687264, 65408, 109054240,
+4223727840, 62916224, 4215339216, 20447516, 90241696, 4290772992, 109054208, 4198562016,
+111675680, 4223728192, 19726621, 81852768, 64, 109053952, 4198562016, 134220032,
+4198562080, 19202334, 58784064, 2097184, 109053696, 4198562016, 113248256, 4181784832,
+19071263, 58784160, 4292870144, 109053696, 4181784800, 109053696, 4198562112, 19005728,
+58784160, 65440, 111150848, 4181784800, 109053600, 4181784800, 2166096161, 60881312,
+65472, 113248000, 4181784832, 111150784, 4181784800, 2166063386, 59308704, 65408,
+111675136, 4198562112, 109053608, 4198562240, 2166259997, 65075552, 64, 113248000,
+4181784832, 117442560, 4181784832, 19169567, 65075616, 16777216, 117442560, 4181784896,
+117442560, 4181784832, 2166456608, 86047264, 128, 134219840, 4198562080, 138414336,
+4198562080, 19530022, 82377160, 3145776, 134744128, 4198562152, 134219840, 4187552032,
+19366178, 82377160, 589816, 134744128, 4187552096, 134219840, 4184406304, 19464488,
+86047216, 4291887056, 135268416, 4187027808, 134744128, 4187552096, 2166653219, 81852832,
+524328, 134219784, 4184406336, 135268416, 4183882016, 2166784293, 94435776, 4289200128,
+138414336, 4183882016, 138414336, 4198562144, 19628327, 90241568, 128, 138414208,
+4198562144, 146802944, 4198562144, 2167013676, 86047264, 4194304, 138414208, 4198562240,
+138414184, 4187027808, 2166980904, 98630496, 2097152, 136317216, 4223728384, 111675648,
+4211145280, 19988782, 88144800, 12582912, 136317216, 4223728448, 140511520, 4215339776,
+2167275823, 86047712, 13107200, 136317192, 4223728512, 138414368, 4219534144, 19956011,
+86047712, 2162640, 138414368, 4219534144, 140511338, 4216388416, 2167243052, 94436096,
+65440, 146802944, 4211145280, 111675584, 4211145280, 20119858, 94436160, 4194304,
+146802944, 4211145440, 146802944, 4209048128, 2167439663, 86047552, 4291887040, 134744256,
+4209048128, 111675400, 4211145280, 20382004, 82901760, 3211216, 135268544, 4209048176,
+134744128, 4204853824, 20316469, 88668928, 5767168, 135268544, 4209048224, 135268456,
+4204853872, 2167570737, 85523144, 4291821616, 134744128, 4204329536, 134744128, 4204853864,
+2167701811, 81853216, 4278190080, 111675400, 4206950976, 117442560, 4211145408, 2167832885,
+41482768, 65424, 93849216, 4198562016, 62915992, 4215339216, 21168441, 50395552,
+4292870144, 93849216, 4181784800, 93849216, 4198562112, 20906298, 50395552, 65440,
+102762112, 4181784800, 93849120, 4181784800, 20775227, 52492704, 65440, 104859264,
+4181784800, 102762048, 4181784800, 2167996732, 54589856, 65440, 106956416, 4181784800,
+104859232, 4181784800, 2167963959, 48298400, 65440, 100664864, 4181784800, 93849088,
+4181784800, 20873530, 48298400, 4290838464, 96470528, 4181784800, 93849088, 4181784832,
+2168226107, 50395680, 6291456, 93849216, 4198562240, 93849088, 4190173504, 21037376,
+50395808, 65408, 102762112, 4198562240, 93849120, 4198562240, 2168357181, 45677072,
+4290772992, 93849088, 4189124928, 93849048, 4190173616, 2168521026, 45676992, 4290838496,
+93849088, 4183882048, 93849048, 4189124928, 2168488255, 39909920, 128, 62915968,
+4215339216, 92276120, 4198562240, 2169504068, 39909920, 4276092928, 62915968, 4190173392,
+62915968, 4215339456, 21692741, 18938176, 96, 62915648, 4190173392, 71304576,
+4190173408, 21561670, 16513568, 2424704, 68879424, 4190173504, 62915648, 4190173392,
+21463362, 10549728, 4259776, 62915648, 4190173440, 62915648, 4185979088, 2168783176,
+14743968, 4194304, 62915648, 4190173504, 67109952, 4181784832, 2168750403, 19986848,
+65440, 72353152, 4190173408, 71304272, 4181784896, 2168979786, 35715576, 4194344,
+72353152, 4190173442, 72353088, 4187551968, 2168947014, 14744192, 1834912, 62915968,
+4215339456, 67109915, 4196465088, 2169438540, 27327392, 65280, 79693184, 4215339456,
+62915776, 4215339456, 21889357, 27327136, 12582912, 79693184, 4215339584, 79693184,
+4198562240, 2169143625, 21035552, 288, 62915680, 4215339456, 73401536, 4215339456,
+2169373007, 21035840, 4288675840, 67109984, 4209048000, 62915680, 4215339744, 2169307472,
+14744384, 65344, 67109984, 4209048000, 67109888, 4209048096, 2169274699, 4261476832,
+192, 4236247328, 4223727808, 18875328, 4223727808, 24117586, 4230020128, 65408,
+4282384672, 4223727808, 4236312384, 4223727808, 23003475, 4238408528, 65424, 4290773280,
+4223728000, 4282449856, 4223727808, 22806868, 4238408528, 7733456, 4290773046, 4223728368,
+4290773280, 4223728000, 22380881, 4250991584, 64, 4290773120, 4223728000, 8388896,
+4223728000, 22610262, 4250991392, 4288675840, 4290773120, 4206950784, 4290773120, 4223728320,
+22544727, 4244699872, 65280, 2097280, 4206950784, 4290773024, 4206951040, 2169733458,
+4244700128, 6291456, 1179776, 4223728512, 4290773024, 4219534016, 2169864532, 4260428512,
+4289724416, 8388896, 4202756480, 10486048, 4223728256, 22741338, 4255185472, 4290772992,
+8388896, 4192270720, 12583200, 4202756576, 2169995606, 4253088608, 7340032, 10486048,
+4223728384, 17826064, 4211145344, 2170126680, 4230019808, 8388928, 4282449856, 4223728256,
+4282449856, 4223727808, 22905178, 4230019808, 6815744, 4282449856, 4223728256, 4282449856,
+4181784768, 2170356062, 4236835552, 112, 4282449832, 4219796096, 4289265600, 4223728368,
+2170323291, 4202756896, 4284481536, 4236312384, 4206950592, 4236312384, 4223728320, 23789920,
+4221631008, 65280, 4274061120, 4206950592, 4236312256, 4206950592, 23331169, 4230019784,
+4286578688, 4274061120, 4201183424, 4274061120, 4206951016, 23265634, 4225825056, 4194432,
+4274061120, 4201183424, 4278255424, 4181784768, 2170519902, 4221631200, 8388608, 4274061120,
+4206951040, 4274061120, 4202756712, 2170650976, 4192271008, 65280, 4244700864, 4206950592,
+4236311808, 4206950976, 2171142501, 4204853536, 64, 4244700608, 4206950592, 4257283776,
+4198562048, 23658854, 4192270752, 4194304, 4244700608, 4206950720, 4248894912, 4181784768,
+23593319, 4202756576, 320, 4244700576, 4206950720, 4255186368, 4185979264, 2170782050,
+4204853600, 4286578752, 4248894912, 4181784768, 4248894912, 4181784832, 2170913124, 4217436704,
+4194304, 4261478080, 4198562240, 4257283712, 4190173440, 23757158, 4209048032, 4290772992,
+4257283712, 4185979136, 4261478016, 4190173568, 2171109735, 4213242784, 128, 4236312128,
+4223728320, 4265672512, 4215339712, 24052076, 4206427040, 65408, 4258856512, 4223728320,
+4236312024, 4223728320, 23953770, 4192271136, 128, 4236311808, 4223728320, 4244700632,
+4223728448, 2171404654, 4188077088, 65472, 4240506112, 4223728320, 4236311744, 4219534016,
+2171371883, 4214815648, 65408, 4267245376, 4215339712, 4265672280, 4215339712, 2171568494,
+4286642464, 160, 18875040, 4223727808, 44041152, 4215339200, 24772977, 4267768224,
+10485832, 18875008, 4223727936, 25166496, 4186503360, 24510834, 4278254144, 4284481536,
+25166368, 4192270656, 18875008, 4223728096, 24379763, 4267768320, 10485760, 25166368,
+4192270752, 25166368, 4188076352, 2171699568, 4266719904, 256, 18874736, 4215339584,
+25166464, 4223728096, 24478066, 4278254168, 360, 25166368, 4223728096, 35652224,
+4223728480, 2171896179, 4276156704, 3145888, 25166384, 4186503360, 33555104, 4183881920,
+24641911, 4270389584, 8388736, 25166376, 4186503408, 27787824, 4184930496, 2172027253,
+4280351008, 160, 33555008, 4183881920, 37749408, 4183881920, 24740215, 4283496736,
+160, 37749360, 4183881920, 40895136, 4183881920, 2172223864, 10549696, 4291821568,
+44041152, 4183881920, 48235456, 4215339392, 25166203, 1112352, 160, 44041008,
+4183881920, 53478336, 4183881920, 25035132, 4289788192, 160, 44040912, 4183881920,
+47186736, 4183881920, 25002362, 4292933920, 160, 47186688, 4183881920, 50332464,
+4183881920, 2172420475, 7403808, 160, 53478288, 4183881920, 59769792, 4183881920,
+2172584319, 4258080, 160, 53478240, 4183881920, 56624016, 4183881920, 2172551549,
+10549728, 4292870224, 48235456, 4213832064, 51774400, 4215339392, 25264512, 8452656,
+368, 51774368, 4215339472, 60818368, 4215339392, 2172813697, 4267767712, 65408,
+25167360, 4173395264, 4248830336, 4173395648, 27722115, 4284544928, 24, 25166464,
+4167104192, 41944576, 4173395264, 25756036, 4276156320, 4292870144, 25166464, 4148229824,
+29360768, 4167104320, 25690501, 4271961888, 128, 25166272, 4148229824, 29360768,
+4148229824, 25624966, 4269864736, 128, 25166240, 4148229824, 27263424, 4148229824,
+2172944771, 4274059040, 128, 29360608, 4148229824, 31457920, 4148229824, 2173075845,
+4276156344, 65512, 33555072, 4167104320, 29360640, 4167104344, 2173206919, 12646432,
+4292935648, 42993152, 4169200960, 41944192, 4173395568, 26608010, 24180896, 4293918720,
+42993152, 4165006656, 75499008, 4169201728, 26542475, 4285593296, 43057008, 42993152,
+4165006788, 42993058, 4134597952, 2173895052, 33617472, 14680672, 42993152, 4165006816,
+85984768, 4165006788, 2173829517, 18937768, 16, 42992704, 4156618258, 71304704,
+4165006816, 26214798, 5830584, 2621440, 58197056, 4156618584, 42992704, 4149802514,
+26182025, 18937768, 4284481536, 42992704, 4148753938, 60818496, 4149802824, 2173403530,
+23132128, 1048576, 71304704, 4165007232, 71304633, 4152423904, 26411409, 23132128,
+192, 71304320, 4165007232, 75499008, 4165007232, 26378636, 24180896, 65344,
+76547584, 4165007232, 75498640, 4165007232, 2173600141, 24180704, 65480, 76547513,
+4152423904, 71304336, 4152423936, 26509711, 18937784, 4194304, 71304320, 4152424280,
+71304336, 4148753920, 2173796752, 23132320, 32, 75498624, 4167104576, 76547584,
+4169201728, 2174058900, 23132352, 4293394432, 41944192, 4167104112, 59769984, 4173396064,
+27525527, 4284544952, 6291456, 41944192, 4167104344, 42992488, 4149802608, 27459992,
+2160672, 2162656, 44041344, 4167104416, 41943928, 4167104344, 2174812569, 10549376,
+4288675840, 54526944, 4162910112, 44041344, 4167104544, 2174747034, 12646432, 64,
+54526944, 4162910112, 65012704, 4160812992, 2174681499, 12646496, 4292870176, 54526944,
+4162910112, 62915552, 4162910208, 2174615964, 4257920, 4292935648, 54526944, 4162910112,
+54526816, 4162910208, 2174550429, 2160736, 65472, 54526944, 4162910112, 54526784,
+4160812992, 2174484894, 4257792, 6291456, 54526944, 4162910112, 56624064, 4154521504,
+2174419359, 8976472, 65488, 61342688, 4162910112, 54526888, 4162910112, 27296150,
+8976424, 4291821568, 54526888, 4157142944, 54526888, 4162910152, 27361687, 5830696,
+48, 54526840, 4162910152, 58196904, 4162910152, 27427224, 5830744, 3145728,
+58196904, 4162910200, 58196904, 4160288712, 2174386585, 4257704, 4286578688, 42992488,
+4148754032, 48235360, 4149802824, 2174976418, 14743776, 65520, 67110016, 4173396064,
+59769856, 4173396096, 27656613, 14743760, 6815744, 67110016, 4173396080, 67109992,
+4168153184, 2175107492, 10549536, 65472, 62915584, 4173396096, 59769792, 4173396096,
+2175238566, 4255184864, 32, 4248830144, 4173395648, 12583296, 4173395648, 28639656,
+4238407584, 8454016, 4278190272, 4173395648, 4248830016, 4173395648, 28246441, 4255184864,
+4286578688, 4290773184, 4152424128, 4278190272, 4173395840, 27984298, 4246796224, 65440,
+4194496, 4152424192, 4290773056, 4150326976, 2175369640, 4238407904, 64, 4278255552,
+4173395840, 4194496, 4165007232, 28115372, 4225825056, 8454080, 4278255552, 4173396096,
+4278255488, 4173395840, 2175500714, 4255184896, 4286578688, 4194496, 4154521472, 4194496,
+4165007264, 28213676, 4255184928, 4286578688, 4194496, 4156618656, 4194496, 4165007296,
+2175697325, 4221630432, 12582912, 4248895360, 4173395840, 4265607232, 4152424128, 28574128,
+4213242016, 65472, 4265672576, 4165007232, 4248895040, 4173395840, 28443057, 4225824864,
+4290772992, 4265672576, 4160812928, 4265672384, 4165007360, 2175828399, 4209047776, 4290772992,
+4248895040, 4169201536, 4248894912, 4173396096, 2175992243, 4213241952, 4290772992, 4248895040,
+4160812928, 4248894976, 4169201664, 2175959473, 4221630368, 64, 4265672384, 4152424128,
+4273995840, 4148229824, 2176156084, 4257282080, 2097152, 12583296, 4173395904, 16777600,
+4156618432, 28967350, 4259379232, 128, 12583168, 4165007296, 16777600, 4173395904,
+28836279, 4257282080, 128, 12583136, 4165007296, 14680320, 4165007296, 2176287158,
+4267767968, 4286578688, 16777600, 4165007296, 16777600, 4173396032, 28934584, 4259379392,
+8388608, 16777600, 4173396064, 16777600, 4167104576, 2176483769, 4259379136, 8388608,
+16777600, 4156618592, 16777600, 4150326976, 29163963, 4259379200, 8388608, 16777600,
+4156618656, 16777600, 4154521440, 29131195, 4259379168, 8388608, 16777600, 4154521472,
+16777600, 4152424288, 2176680380, 4259379104, 8388608, 16777600, 4150327104, 16777600,
+4148229824, 2176811454, 4253088800, 8388608, 4219472576, 167836608, 4236249376, 4223726912,
+18415616};
+extern const uint32_t e1m1_WADSegLights[732] = {
+4273566836, 1936964094, 4273566836, 1956624894, 3533167289, 3316896453, 2156903634, 1650489456,
+1684178025, 1434750055, 2156168324, 2237891939, 2223277188, 2237891939, 2223277188, 2237891939,
+2223277188, 2237891939, 2156168547, 2237891716, 1953789044, 1684300900, 1684300896, 2223284384,
+1682132836, 2223284384, 1682132836, 2223284384, 1665355620, 1330152580, 2694858819, 2694881440,
+1212633672, 2694545540, 2694881440, 1212696648, 3537018783, 3537031890, 3975216639, 2526474476,
+2678036118, 2678038431, 2526461946, 2934631086, 1684311693, 2693893748, 1684300900, 1684294500,
+1263237280, 1263247520, 892706976, 892689243, 2644466523, 3537018783, 4294955730, 1263225675,
+2694881440, 4294967295, 4294955730, 1956380671, 4294967225, 2694881440, 1684316280, 2023782520,
+2678023268, 4294835391, 4294955730, 4290616530, 2423116498, 2019973722, 1987146844, 1095591286,
+1329687668, 943216214, 1448491064, 943210560, 1734961511, 2105573501, 3115938719, 4294942579,
+1987474548, 1515870810, 1515870810, 1987475062, 1366331536, 1397964594, 843071814, 1987481744,
+2425379418, 1987475062, 1363900022, 1987465553, 1279293046, 1987465553, 1701148278, 3772803433,
+1094836448, 2425393296, 2124320912, 3115938970, 1987485300, 2425379418, 1954051702, 3120535668,
+1618376288, 1987481744, 2425386614, 1987467866, 2425379418, 2425386614, 2425372993, 4294918481,
+1954021375, 1987474548, 2238202202, 1820284237, 2675133249, 1939847609, 2190540799, 1515285355,
+1986744666, 2425383798, 1802195290, 1515884674, 1802207888, 2425379409, 1515870810, 1499107472,
+2425379418, 2425379418, 1515870809, 1095471248, 1262580081, 1515818896, 1499093594, 1515884687,
+2425393039, 2274398352, 1987475055, 1987269717, 1987474294, 2425386614, 1415211858, 1364293238,
+1499035254, 1987475062, 2425379157, 1515870810, 2422692442, 1802195062, 1499035243, 1987475062,
+1515870553, 1515870810, 2425374278, 1179029648, 1987466612, 1735362448, 2425386087, 1987481744,
+1987481744, 1836414582, 2424794989, 1939836816, 2675161529, 2678045113, 4294942623, 1382809599,
+1987467860, 1987465553, 1499035254, 1987475062, 1515869529, 2425379418, 2425393296, 1515870810,
+1515884688, 1515884688, 2425393296, 2019128175, 2254979413, 1987475059, 1870034550, 1987475062,
+2019913049, 1095454029, 1819036481, 859000141, 1296905011, 1935891031, 1987475600, 1954902134,
+1754236764, 1802195265, 1867606145, 1802211472, 1499035254, 1987475062, 1515870553, 1515870810,
+1515878000, 1179015770, 2425393296, 1480672838, 1987475060, 1936750198, 2018868057, 1515870039,
+1751672936, 1768319337, 1332171370, 1214538824, 2694881440, 3120460916, 1936981689, 1684305012,
+4278084708, 4278124473, 1953806846, 1903623935, 1128825988, 2694858831, 2694881440, 1213351752,
+2223020960, 2694881440, 1212696648, 1684300900, 1684300900, 1684300900, 1684300900, 1684300900,
+1683642980, 2677914111, 1263246196, 2694859595, 4294942880, 4294967295, 4294967295, 2223308799,
+2021167248, 1684306040, 2223268964, 1953800095, 1684300900, 2694866020, 2022807200, 1683839819,
+2223284384, 1682916196, 2223284384, 1682916196, 2223284384, 1682916195, 4294967295, 4294967295,
+2694905855, 2023792800, 1684316280, 2021155940, 2678038431, 3537031890, 4294942623, 1263260370,
+2694859595, 3537019040, 3170882258, 3537031835, 2547173041, 2677462988, 2832059858, 1736495819,
+1650749571, 2220190084, 1617067896, 2223277184, 1669686149, 1329687660, 1986937167, 943216214,
+1448491064, 2223277188, 1669686149, 2223277188, 1669686149, 2223277188, 1669686149, 2223268741,
+1669694592, 1617196148, 1684300900, 4290344095, 3537018783, 1179016263, 962229875, 976894522,
+2155904128, 2155905152, 1886410568, 3534987167, 2678046418, 1953806847, 1179058105, 4294922588,
+843469168, 1177710673, 1884369478, 2675227135, 2425377113, 1515877995, 1467452299, 2002226059,
+4290344095, 4290344095, 2675227135, 2675220383, 3120562175, 843477073, 3120517488, 4290355060,
+1179010630, 1364283729, 3120537503, 4294942580, 1886453759, 842166384, 2678038431, 2678038431,
+1886417008, 842150964, 4294931572, 1953824767, 2964369584, 1347440720, 2644527176, 1212719261,
+1754021438, 1094814824, 1364282970, 808472913, 2155884592, 1766883199, 1785556330, 1986482281,
+1616927322, 1297518736, 1095468164, 1987477356, 2425393296, 1514228829, 1753581447, 858993459,
+1296911693, 1499093594, 1987467866, 2425379418, 1515884688, 1987475062, 1987481744, 2425386614,
+2678027894, 3201499065, 2678038431, 4294955730, 2425379418, 2678045183, 2678051518, 3537018783,
+2425421823, 2678020698, 2678038431, 3535060690, 2678038431, 2678051518, 2678051538, 2678038431,
+3535060690, 2678038431, 2678051518, 2678051538, 2678038431, 2678051508, 2678051538, 1754308511,
+1514246248, 1515864410, 4273566879, 1956618143, 4273602489, 4278088863, 3119251198, 3954799732,
+3120522597, 2678027380, 2675244985, 4294967295, 4294949375, 4294967295, 1956642815, 1956642745,
+2675227065, 2678038431, 4290379775, 2678027423, 2678063103, 4294967295, 4290344095, 3115970800,
+1953789044, 3971594732, 1364283729, 842150450, 2425372993, 2425393296, 2425393296, 2425393296,
+1499031656, 1499027801, 2120047999, 978341690, 926568527, 1971141189, 2155905152, 976906593,
+2155887162, 2155905152, 843022464, 1398435921, 1077044080, 1886406209, 4294930533, 2527056590,
+4294967295, 2677460690, 4294967295, 4278107089, 1886441915, 843071538, 1886411611, 1077031488,
+4294925147, 2473882771, 1094815888, 2425393296, 2425393296, 4294918465, 1953789044, 1414856703,
+976368186, 1296907324, 858993459, 842157389, 1869573999, 1548972143, 842941746, 1886414190,
+842150194, 1094802524, 1365979698, 774794065, 1869573999, 1449210418, 3120496313, 1956618100,
+1448893526, 1178748229, 1886414952, 1751674992, 1346788444, 1869503841, 1953782093, 4273584638,
+1113355123, 1162036293, 1768515945, 1332171370, 1282037617, 1768312142, 1801480553, 2641645648,
+3115938975, 3119316921, 2678045113, 2678038431, 1162190751, 1867597125, 1634692975, 1547847248,
+1448886854, 1751669846, 1886417008, 1549559912, 1549558102, 3115956665, 2675209375, 1886416752,
+842150450, 1886417008, 842150450, 1886417008, 842150450, 1886417004, 842150450, 1012095319,
+1465335083, 1953776190, 4290361855, 1953789044, 4294967295, 4294967295, 1549598719, 1364279884,
+843399474, 2307476537, 1515882889, 1651923546, 2223277188, 2944442528, 1349414506, 1938927792,
+1852733585, 1750560366, 2423813750, 1802196314, 1515870801, 1096057192, 1802211472, 1754290753,
+1515884674, 1683312986, 2694881440, 2425379418, 1987467866, 2694866020, 1214554272, 1684316320,
+2223284384, 4294931572, 3535142911, 1884369478, 843476817, 1867592261, 1230786928, 1179010354,
+1464288838, 1177702768, 1179021424, 1366312498, 1364291665, 1179005510, 1177699910, 1366309724,
+2675227135, 4294936274, 1956631250, 4273602489, 2678027423, 3115949983, 3434073263, 1884374598,
+1179010630, 1414615377, 4290344095, 4273566879, 2678063103, 2192547743, 3120549074, 2675245055,
+3120537460, 2678063103, 1956618143, 1956642745, 4290355103, 2678038388, 3120471967, 4294942580,
+1886453759, 842166384, 1886417008, 842150962, 1515874408, 1751669338, 1751930714, 1515872843,
+842158448, 1751674961, 1515870810, 1515870810, 1498773110, 1987470164, 1987277171, 1347449202,
+1987472208, 1128353630, 2424934544, 1094815888, 2425393296, 2425372993, 1094815888, 2425372993,
+1094815888, 2425372993, 1094815888, 2425372993, 1094815888, 2425372993, 1094815888, 1094795585,
+2425392784, 1430339905, 1096308823, 1821282448, 1985633142, 1514436168, 1146772058, 1029338742,
+1682474116, 1094820000, 2425372993, 1094815888, 2425372993, 1094815888, 2425372993, 1754304656,
+1094815888, 1514246288, 1515884648, 1819040346, 1096450960, 1986350415, 4294928748, 3537043455,
+4294942623, 3534028799, 3217014719, 2678038431, 4294941338, 2949816213, 2004318071, 4294967295,
+3537018783, 3120485074, 1939380340, 4294963370, 3302150866, 3536556181, 3739203777, 3151155895,
+3535239062, 3739664062, 2678038431, 4294955730, 3537043455, 2678063103, 4294955730, 4294942623,
+2678051538, 4294967295, 4294942623, 4294942623, 2678063103, 3537031890, 4278099871, 4293650617,
+4294967295, 4294967295, 3537007732, 4294967295, 3120562175, 3217003124, 2678046655, 1094950815,
+1515881068, 2405984383, 1818777921, 1515875436, 1094802010, 1753186959, 2407694184, 1855406401,
+3014898611, 1514248814, 1096444008, 1515870810, 3120523408, 1956615028, 2608124586, 3120471965,
+3436355444, 2675220383, 1751679663, 1515874408, 1751669338, 1515874408, 1754290778, 1096454248,
+3120519745, 4294967295, 65535, 0, 1956577280, 4294967225, 1956642489, 3120537503,
+2678038431, 724285881, 1162160955, 1009468741, 3115956735, 3201463412, 1094795585, 2425393296,
+1094815888, 2425372993, 1514246288, 1096444048, 1953796200, 1953806777, 1532737977, 976894522,
+1515871067, 1751672936, 1751669338, 1515874408, 1751669338, 1515874408, 1751669338, 1515874408,
+1515870810, 1754290778, 1096440385, 36968};
+extern const uint32_t e1m1_WADSegVertices[1463] = {
+65536, 131073, 3, 196610, 327684, 393221, 262151, 589832,
+655369, 720906, 851980, 786442, 655371, 983054, 1114128, 1179665,
+1245199, 1048595, 917524, 1310738, 1376272, 1114134, 1441813, 1048593,
+1507349, 1441816, 1572887, 1376278, 1638423, 1572890, 1703961, 1507352,
+1769497, 1703964, 1835035, 1638426, 1966109, 1900571, 1835038, 1769500,
+2097183, 1900574, 1966113, 2162720, 2228253, 2031650, 2359331, 2097189,
+2424868, 2293792, 2490404, 2424871, 2555942, 2359333, 2621478, 2555945,
+2687016, 2490407, 2687018, 2752555, 2621481, 2818092, 2883624, 2949163,
+3014701, 2818090, 3080238, 2752559, 3145773, 3014705, 3211312, 2949166,
+3342386, 3407883, 3473421, 720948, 3538995, 3604530, 3342390, 3276851,
+3538999, 3735608, 524345, 3670074, 3801142, 3801147, 3539002, 3866679,
+3604534, 2097187, 3997756, 2293821, 4063263, 4128830, 3932224, 4194367,
+2031648, 3670073, 3735614, 4063295, 4128824, 4194364, 3801152, 3866682,
+3932219, 4325441, 4259907, 4522052, 4587589, 4653126, 4784200, 4259906,
+4325449, 4718657, 4390986, 4915271, 4522054, 5046348, 4587595, 5111874,
+5177422, 5242959, 2293796, 2359334, 2490408, 2621519, 5177424, 3997731,
+5242941, 3866705, 3604539, 3276855, 4456500, 5308496, 5374005, 4980818,
+3407941, 5505107, 5636181, 5767255, 5439572, 5505113, 5898323, 5701722,
+5963864, 5832795, 1310735, 983127, 5963796, 5701723, 6094940, 6226014,
+6029408, 6357085, 6160481, 6291551, 6488162, 6553699, 6619236, 6094949,
+6029405, 5439582, 6750310, 6881384, 6160479, 6684777, 6226026, 6815851,
+7143532, 7274606, 7340143, 7405680, 7536754, 7209075, 7602260, 7733365,
+7667831, 7864438, 5570680, 7077974, 7798893, 6881382, 7995513, 6684794,
+7929961, 7929978, 8126587, 7995516, 8061049, 8061052, 8257661, 8126590,
+8192123, 8192126, 8323197, 8454272, 8257665, 8585346, 8716420, 8781957,
+8519814, 6946951, 8912999, 8978568, 9109642, 9175171, 8650893, 9240716,
+9371790, 9306256, 9437329, 9633938, 8847503, 9699467, 9044117, 9830548,
+9568406, 9896083, 9765015, 10027160, 10092697, 10223771, 10158237, 10158233,
+10092701, 10027162, 10289307, 10354844, 10420382, 10485919, 9502864, 10616993,
+9437346, 6422691, 10682532, 10748069, 10813532, 10944678, 11010215, 11075752,
+11206826, 11272363, 10879148, 11403437, 11468969, 11534511, 11600048, 11337906,
+11731121, 11796659, 11862196, 11665590, 11141301, 11927726, 11927735, 12058806,
+12189881, 11993266, 11665595, 12320954, 12255421, 12452028, 12452025, 12124346,
+12189884, 12320958, 12517550, 11403448, 12124352, 12386477, 11337921, 12714174,
+12648639, 12583106, 9961667, 12845210, 12910788, 10879173, 11272358, 12779718,
+12976300, 13107399, 13238473, 13172939, 13435084, 13566158, 13369552, 13697231,
+13631697, 13369549, 13107404, 13435079, 13041864, 13762760, 13893843, 13828309,
+13041876, 14090454, 14024906, 14221528, 13959386, 14155993, 14221530, 13959384,
+14287061, 14352589, 14418139, 14155996, 14352604, 14418131, 13893851, 13828308,
+14024925, 13172950, 14614750, 14680287, 14483680, 13304009, 14745810, 14876898,
+13304035, 15007972, 14811363, 15073509, 15139046, 14549223, 14876875, 15270120,
+15335657, 13697258, 15204561, 15204587, 13500625, 15401166, 13697256, 15532268,
+15401198, 15663341, 15597800, 15204591, 15728865, 15466733, 15532257, 15728876,
+14745840, 15466737, 15859952, 13500651, 15991027, 16122101, 15925494, 16056564,
+16056566, 16122099, 15925492, 15991029, 16187609, 16253175, 16384249, 16515323,
+16646397, 16318718, 16711930, 16449791, 16777468, 16580864, 16843003, 16515330,
+16908545, 16449788, 16187640, 16974071, 16253188, 17039619, 16646393, 16318723,
+17039614, 16974084, 14287109, 17105158, 17170647, 16908551, 17301761, 17236232,
+16843010, 17432841, 17498378, 17563915, 17629452, 17694989, 17760504, 17826063,
+17367313, 17760528, 17826065, 17367311, 17891593, 17891602, 17957139, 18022642,
+14811406, 18088208, 15794452, 18088177, 15794451, 17957140, 18022674, 18153741,
+14942485, 17629410, 17236246, 18284808, 18219287, 17301767, 18350359, 18219289,
+18415896, 18284822, 18415898, 18546968, 18481435, 18350361, 131075, 18678044,
+196894, 18809117, 18940192, 18874652, 18678049, 18612509, 19071266, 18743587,
+19005727, 19005731, 19202340, 19070982, 19267874, 19136806, 459045, 19398951,
+19530025, 19464491, 19661098, 19726636, 19595565, 19661102, 19530028, 19792175,
+19923242, 19857712, 19792177, 20054319, 19857710, 19988786, 20054321, 3145777,
+20119858, 18612531, 20185090, 3211572, 20250672, 19988790, 20316471, 4784437,
+4718665, 20382008, 20578617, 20709691, 20644154, 20447543, 20644156, 20382011,
+20709688, 20840765, 20775231, 4849982, 20971595, 21037133, 4915520, 21102664,
+21168450, 21102915, 20775230, 21168445, 20840770, 20447555, 20906300, 21299524,
+21430598, 21365061, 21496132, 21233989, 21561672, 21627209, 21692746, 21299531,
+21496140, 21823812, 21233992, 21758285, 21758286, 21954893, 21823820, 21889359,
+21889323, 19464527, 21954894, 19595561, 22085968, 20513105, 22151488, 22217025,
+20971858, 21758280, 21889356, 19595598, 21496137, 21561681, 20513067, 22085945,
+22348116, 22282582, 22544727, 22610264, 22413658, 22020437, 22479186, 21692741,
+22413652, 22282571, 21299542, 22806875, 22544729, 22872403, 22741341, 22151512,
+23003486, 23069017, 22937952, 22675807, 23134556, 23069025, 22610272, 23265634,
+23396708, 23462245, 23200102, 23527779, 23331176, 23593319, 23658856, 23396714,
+23724393, 23593317, 23855467, 23921004, 23789864, 23986541, 23200099, 23265643,
+23855458, 23789932, 24052073, 23724400, 24117615, 23658858, 24183151, 24117618,
+24248689, 24052080, 24314225, 24248692, 24379763, 24183154, 24510837, 24445299,
+24379766, 24314228, 24445302, 24510791, 24576373, 21234039, 24707448, 24772985,
+24641915, 24838524, 24904059, 24838525, 25100670, 25035136, 25297281, 25166206,
+25035139, 25362818, 25428352, 25231748, 25559429, 25493895, 25559432, 25493894,
+25690505, 25821573, 25952651, 26018188, 26083725, 26149257, 25756040, 25756026,
+26214785, 26280336, 25297297, 25231746, 26345871, 26411410, 26542484, 26608021,
+26739095, 26870169, 26935704, 25166235, 25231760, 27001217, 27066780, 26214813,
+27197854, 27263391, 27394465, 27460002, 27591076, 27132325, 27656611, 27787687,
+27525545, 27722150, 25690538, 27918763, 27984275, 28115372, 28180909, 26476974,
+26476947, 27984302, 26411435, 28180884, 28311983, 28443057, 28508594, 25887152,
+28377486, 25625012, 28639622, 28574133, 28770742, 28836264, 27853241, 28901815,
+28574135, 28901813, 28639668, 28770745, 24838520, 28967291, 24641979, 29032890,
+29032892, 29163962, 29098429, 28967355, 29163964, 29229501, 29098431, 29295038,
+29229503, 29360574, 29295041, 29426112, 29557186, 29557184, 29426114, 29491651,
+29360577, 29688260, 29819334, 29884869, 29753800, 29950407, 29622729, 30015939,
+30081482, 30146697, 9503180, 30146705, 10551757, 30278092, 30212558, 30146943,
+26804687, 30343305, 8978892, 29491664, 30474400, 30409169, 30474701, 10551456,
+30212257, 10486225, 30605778, 26673620, 30802389, 30540142, 30933463, 31064537,
+31195611, 31326685, 19333596, 31392216, 31457759, 31261152, 31523294, 31588833,
+30867938, 31064547, 30999002, 31654372, 31785433, 31850966, 31719911, 30802405,
+30999013, 31785430, 30343578, 31982031, 32047592, 26870250, 30736875, 32244201,
+32113109, 30736874, 32113050, 32178662, 31916524, 31654381, 32309742, 31916515,
+32440807, 32506344, 32571888, 32244210, 31982060, 32375281, 32637423, 32309747,
+32702964, 32375277, 32834030, 32899568, 32965110, 32571896, 32506353, 32768503,
+33030645, 33096182, 32768499, 32965108, 32899575, 32702970, 33161721, 33227219,
+30671356, 33358331, 33292798, 33423869, 33489302, 33554943, 28049921, 33751554,
+33817091, 33948165, 33882631, 33686016, 33620486, 34079229, 34144776, 33423881,
+33358334, 34275850, 34341387, 34472461, 34537996, 34669072, 34406930, 34800143,
+34603540, 34996757, 34931219, 34865686, 35127831, 35258905, 27329050, 35389979,
+35455516, 35521053, 35193361, 35586584, 35324447, 35717664, 35652130, 34734627,
+34013729, 34210308, 35848718, 35783198, 35914144, 35062308, 36045349, 36176423,
+36241960, 36110890, 36307494, 35979817, 35979814, 34931222, 34996773, 36045333,
+33096186, 8389163, 36438143, 36504108, 36569593, 36635182, 36700717, 33161776,
+36831793, 36766255, 36897330, 36373043, 36766258, 37028404, 36831797, 36962870,
+37093937, 37028402, 37225015, 37290549, 36831802, 37356088, 37159481, 8519820,
+37159480, 37421623, 9175611, 37225020, 37486722, 37618237, 37683774, 37552704,
+37749313, 37880383, 37945922, 7471683, 37814385, 37945924, 38142533, 37880387,
+38076994, 38010994, 38273607, 7471219, 7537224, 38208070, 38076998, 38142535,
+38208072, 38339135, 38077001, 37683778, 37880389, 7209546, 38404680, 7536750,
+38273139, 38404681, 38339141, 38273610, 31130187, 38470220, 38601178, 38535757,
+38666356, 7012943, 38732366, 38470222, 38535755, 38666831, 38732364, 38863440,
+38797889, 37749329, 37814848, 38601292, 38863437, 38535760, 38797905, 38994514,
+39125588, 38928981, 39191122, 38994519, 39256662, 38928979, 39256664, 39387734,
+39322201, 39191127, 39060058, 39453275, 39649884, 39584347, 39453277, 39518810,
+39715411, 39780958, 39060063, 39846484, 39060064, 39912031, 39846497, 39780948,
+40043106, 39977572, 40174179, 40305254, 40108642, 40305252, 39977574, 40239719,
+40108640, 40370791, 40436328, 40567402, 40632937, 40764013, 40698467, 40174190,
+40043109, 40239723, 40501871, 40895084, 18481777, 41025819, 40960626, 18546970,
+41157235, 41026161, 41222772, 40960629, 41288306, 41091703, 41353846, 41157240,
+41484919, 41353844, 41550457, 41419387, 41747068, 41681534, 41878141, 41812602,
+41615999, 40829568, 41747056, 41681533, 41943681, 42074748, 42140290, 42009220,
+42205827, 42271333, 42336901, 42271366, 42205829, 42336899, 42140292, 42402438,
+42467975, 39518856, 42402440, 42599049, 42533511, 42467978, 39322251, 42730073,
+42664588, 39387736, 42664589, 42861196, 42795662, 42730123, 42795663, 42992270,
+42926736, 42861197, 42926737, 43123344, 43057810, 42992271, 43057811, 43188882,
+43123345, 43188884, 43123347, 39584349, 39649941, 43385436, 43319958, 43385493,
+43319959, 43516566, 43647641, 43451034, 43713176, 43778706, 43254428, 43909789,
+43254430, 43844252, 43778708, 43582106, 43844254, 43647645, 43909785, 44040863,
+44171937, 43975328, 44040866, 44171936, 44040867, 44368548, 44434085, 44499622,
+44106402, 44565153, 44303016, 44237479, 44696233, 44761770, 44892844, 45023918,
+45089455, 44630704, 44958385, 45154989, 44827296, 45286066, 45417140, 45482677,
+45351603, 45548214, 45220535, 45482666, 45417142, 44696248, 45679275, 45744825,
+45810362, 43975355, 45744827, 45679290, 45941436, 45351605, 45613739, 44761785,
+45875892, 45810335, 44696246, 43582122, 45482651, 24904382, 46138047, 46203584,
+46334658, 46269124, 46531269, 46072518, 46662343, 46727548, 24969928, 46596803,
+46465726, 46006985, 46793409, 46858954, 46400204, 46990027, 46924494, 47055567,
+47252176, 29753799, 47186374, 29819602, 47121105, 47448787, 25821909, 47382922,
+47579861, 47645398, 47514328, 46006999, 47710602, 47842009, 47907546, 48038620,
+47973086, 48169691, 48300768, 48235231, 47907549, 48038619, 48431842, 47514339,
+47514335, 48235235, 48431829, 48169696, 48562916, 48628453, 48759527, 48825064,
+48497386, 49021675, 49087209, 48825068, 49021673, 49152737, 48104175, 49283822,
+49414897, 49349356, 48890611, 49218290, 49480432, 49611508, 48694005, 49742582,
+28246776, 49873655, 49808121, 49939174, 50004408, 50070267, 49545980, 28705203,
+49677050, 48366333, 50201300, 50135806, 50135801, 49808126, 50201341, 49873656,
+50332415, 50397952, 50266882, 50463489, 50529025, 50397954, 50594563, 50463492,
+50660045, 50725637, 47317766, 50266880, 50790859, 50922248, 50856703, 50332423,
+10289929, 50529028, 51053322, 50594571, 51118851, 50987788, 51184394, 50987787,
+51249933, 51053326, 51184398, 51381007, 51249936, 51446541, 51315473, 51315472,
+51512079, 51381011, 51577618, 51643154, 51577621, 51512083, 51708692, 51774228,
+51708695, 51643157, 51839766, 51905302, 51839769, 51774231, 51970840, 52036376,
+51970843, 51905305, 52101914, 52167450, 52101917, 52036379, 52232988, 52364062,
+52298524, 52232991, 52167453, 52298527, 44368672, 44303013, 52363940, 52429598,
+52560673, 44106531, 52691617, 52757282, 52822821, 52626214, 52495143, 52888356,
+44106532, 52691751, 52888253, 53019432, 53150506, 52953899, 53084969, 53084971,
+53281580, 53150509, 53216042, 53216045, 53412654, 53281583, 53347116, 53543728,
+53412658, 53347119, 53478190, 53674801, 53609267, 53740339, 53609269, 53674802,
+53936950, 53871412, 54068024, 53805881, 54002487, 54199098, 54264635, 54395709,
+54461244, 54592320, 54657857, 54788931, 54199100, 54526785, 54592315, 54264640,
+54920005, 54854463, 55051079, 55182153, 54854470, 54985544, 55051077, 54920007,
+55247688, 55378764, 55116621, 55444284, 54854478, 54264639, 54461253, 54526795,
+55313220, 55575375, 55182160, 55378762, 55640899, 55706449, 55509842, 54723405,
+55771974, 54985556, 55903050, 55837525, 56034134, 56099645, 56165208, 56230745,
+54395739, 54330174, 56361815, 56492893, 56558430, 56296287, 56623964, 56755041,
+56820578, 56427363, 55968608, 56689498, 55968599, 56034140, 56361824, 56623958,
+56558398, 56820574, 56755043, 56099673, 54330200, 56165218, 56886099, 56951652,
+57017189, 57082676, 57148263, 54133608, 53740342, 56492895, 53871462, 57279337,
+57213762, 57344874, 54723435, 57082728, 57213802, 57279335, 57148265, 57475948,
+57607022, 57541488, 57410415, 57738093, 57672561, 56886117, 57541487, 57607012,
+56951662, 57738096, 57803633, 52429682, 57934707, 57672564, 57869088, 58000158,
+57869173, 52298528, 52429683, 58131318, 58196855, 58327929, 58393464, 58262395,
+58065786, 58459001, 58524540, 58262394, 58590077, 58655614, 58327935, 58786688,
+47776641, 58720989, 58852061, 58721155, 48038784, 58131320, 59048836, 58196869,
+58983287, 58983301, 59179910, 59048839, 59114372, 59310984, 59114375, 59245446,
+59179913, 58917770, 59376523, 59507586, 59573132, 59507597, 59638668, 59704206,
+59573135, 59835280, 59442065, 59900813, 60031891, 59966354, 59769749, 60097428,
+48956308, 60097261, 60031893, 60162955, 59376535, 59442058, 60294038, 60228504,
+60228477, 58590104, 60294039, 58524542, 59114376, 60425113, 60359558, 59245466,
+60490649, 60359578, 60556187, 60621724, 60425117, 60490652, 60687259, 60752798,
+60556191, 60883872, 60949409, 61014946, 60818339, 60752796, 60818335, 60556195,
+61014944, 61080475, 60490654, 61146020, 60687269, 61080485, 61277094, 61146023,
+61211556, 61211559, 61408168, 61277097, 61342630, 61342633, 52954026, 61539112,
+61408171, 61604776, 61473708, 61473576, 52953897, 61670314, 53019565};
+extern const uint32_t e1m1_WADSegFrontSectors[366] = {
+0, 33620225, 50528770, 67372035, 67372036, 84215045, 101058054, 117901063,
+134744072, 151587081, 168430090, 185272842, 202115851, 218958860, 235801869, 252579342,
+252645135, 269488144, 50528770, 286331138, 33686033, 303174146, 320017170, 320017171,
+336860179, 353703188, 33686037, 370541058, 33691158, 33751811, 387383810, 387389207,
+33686039, 50528770, 421009411, 421075225, 437917977, 454760986, 454761243, 471604252,
+404232220, 404232216, 488447256, 404233501, 404232216, 505290264, 522133278, 538976287,
+555819296, 572662305, 404232226, 572662296, 404232216, 404232216, 588781592, 623125539,
+606414117, 640033828, 471604262, 656877340, 656877351, 656877351, 656877351, 673720103,
+673720360, 690563112, 673720617, 673720360, 589506600, 589505315, 707406371, 724249387,
+741092395, 707406380, 724183594, 757935402, 724249389, 774778414, 791621423, 707407663,
+791621418, 808398639, 825241648, 724644145, 724249387, 842150442, 724183858, 724249387,
+858993459, 875834155, 875836468, 892679220, 909522229, 926365238, 707409719, 943208490,
+707406392, 724249130, 960051498, 707406393, 975907626, 792345146, 993734447, 1010580283,
+1027423292, 1044266301, 1061109310, 1044266815, 16843070, 637600001, 1077952576, 1094795584,
+1111638337, 1044267586, 1044266558, 1044266558, 33701438, 1128481538, 33686083, 1040384770,
+1145324606, 1157774916, 1179010373, 1179010630, 1195853639, 1212696648, 1229539657, 50463234,
+1246382595, 1246382666, 33686018, 1258422786, 55266123, 50529027, 33686018, 1275265795,
+1280068684, 1296911436, 640044365, 1313744422, 1330597454, 1347440463, 1364283472, 1381126481,
+1162170962, 1397966149, 1414812499, 1431643686, 1431655765, 1397970518, 1465340755, 1398298711,
+1499027801, 1465342040, 640034342, 1515870810, 1465341783, 1465341783, 1482184535, 1465341784,
+1532713819, 1465341783, 1448498775, 1465341783, 1549556828, 1566399837, 1583242846, 1600085855,
+1616928864, 1633771812, 1650614881, 610427490, 639113252, 640034342, 606479910, 1667441700,
+640050019, 640034342, 640034342, 640034342, 1684300838, 1684300900, 1684284966, 1684300900,
+1680221796, 1701143908, 1701143909, 1717921125, 1717986918, 1717986918, 1734829926, 644310887,
+640034342, 1465341783, 1465341783, 1751672919, 1465341800, 1465341783, 1465341783, 1465341783,
+1465341783, 1465341783, 1465341783, 1768511319, 1768515945, 1785358954, 555819297, 555819297,
+555819297, 1802201963, 1819044971, 1835822188, 1835887981, 488447341, 488447261, 1852730909,
+1852730990, 1869573742, 1886417007, 1903260016, 1869574001, 640034342, 1914181656, 1936880242,
+1953723251, 1970566260, 1987474805, 2004317814, 2021160823, 2038004089, 2020963701, 2054847098,
+2071492728, 2088533116, 2071690104, 2105376123, 2071690109, 2122219134, 2139062143, 2155839359,
+2155905152, 2155905152, 2071690112, 2071690107, 2172156027, 2021753217, 2189588600, 2206433922,
+2223276931, 2240119940, 2256962949, 2273805958, 2307426439, 2324269449, 2324335242, 2340980874,
+2357955467, 2374798476, 2408484494, 2408550287, 2408550287, 2374864269, 2374864269, 2425393293,
+2391838864, 2374864526, 2391707021, 2391707278, 2324336270, 1414812554, 1414812756, 1414812756,
+1414812756, 1414812756, 1414812756, 2442236244, 1397969747, 1469223507, 1465341783, 2442236503,
+2475922323, 1465341783, 2492765271, 1465341783, 1465341783, 1465341783, 1465341783, 1465341783,
+2442236247, 2509608341, 2526451350, 2543294359, 609506388, 606348324, 2560137252, 2576980120,
+2593823129, 2610600602, 2627443611, 2644286620, 2661129629, 2677972638, 2694815647, 2711658656,
+2728501665, 2728567458, 2745410467, 2745410467, 2760806030, 2779030692, 2795873701, 2812716710,
+2812782503, 2829625511, 2829625512, 2846468520, 2863311529, 2880154539, 2863311273, 2896997548,
+2913643178, 2863508909, 2930683562, 2930683566, 2863311529, 2947526575, 2947526575, 2947526575,
+2947526575, 2964369584, 2846468521, 2846468521, 2846468521, 2863245737, 2980752042, 2997989809,
+2998055602, 3014898610, 2998055603, 3031610034, 3048518836, 3048584629, 3065427637, 2461447862,
+3082261138, 3099113655, 3115956664, 3132799673, 3082270650, 3149642679, 3082270651, 3082270647,
+3163853972, 3166485692, 3183328701, 3200171710, 3217014719, 3233857727, 3250700736, 3267543745,
+3284386754, 3301229763, 3318072772, 3334915781, 3351692998, 13092807};
+extern const uint32_t e1m1_WADSegBackSectors[366] = {
+1056964607, 4294967295, 4294902783, 4278524418, 4279959551, 67567615, 84410367, 101253119,
+118095871, 150994698, 4294904083, 4279762943, 4279702284, 4279700237, 268373006, 4294967053,
+4294905360, 255787007, 50266897, 33686033, 4294906898, 33690898, 402590481, 4279571711,
+335479306, 318706687, 67049215, 37618435, 67108863, 4278386434, 202053631, 318963469,
+286457855, 4294967043, 452925698, 4294967064, 4278517530, 404494847, 4294967295, 4294967295,
+4294967067, 4294909467, 4294967295, 4294930798, 4294967295, 4280228095, 4280295167, 4280360959,
+4294910207, 4294929919, 4294967295, 4294929919, 4280745983, 4294967295, 4294967295, 4280680229,
+4280558591, 4279828479, 4294967295, 4294967295, 673447935, 687865855, 687865855, 656877823,
+690431785, 687810855, 656877608, 4280756223, 4294967079, 4280811519, 791620863, 838807852,
+4294913023, 4281270058, 758120447, 4294912813, 4281270058, 721420075, 4294912767, 805251839,
+4281007919, 4281008127, 724697087, 842017579, 4281466673, 4294912818, 838860586, 858993459,
+724249387, 905918207, 4294916095, 4294967295, 4281021496, 4281612287, 4294915839, 1006632959,
+4294967093, 973025279, 4294912825, 4282056490, 725286703, 4281008127, 4294912767, 4294916156,
+4294916925, 1056980094, 4294967295, 4278271743, 4294917887, 4294967295, 4282468863, 1111556095,
+4294967295, 272776769, 4294967295, 4294967295, 1140802326, 4278337279, 4294919423, 4278386435,
+4278337092, 1191182335, 1162346495, 1275068234, 1212612426, 1229455178, 1078525770, 4278405887,
+1229473538, 50331462, 50547711, 1174667263, 4294967042, 50331394, 4294902783, 1308819455,
+4294967117, 4294967117, 4283321423, 4283236351, 4294911743, 4294921552, 4294922065, 4282732626,
+4283585023, 4294967295, 4283651165, 643388927, 4294967295, 1459617619, 4294967128, 4283695103,
+1442840410, 4294967295, 4294927615, 4294967129, 4294967295, 4294967295, 4294967295, 1543503707,
+1465450495, 4294967295, 1560281087, 1560281087, 1465319423, 1593835347, 1566572543, 1627389790,
+1644167007, 620756833, 4283760480, 4294967295, 405153535, 4294967139, 4279828324, 4294967139,
+4294911014, 1694498660, 4294967295, 4294967295, 1697054719, 644163110, 4280706148, 1696999013,
+644113446, 1684471653, 1684471652, 4284769892, 4284835175, 1734698343, 1718026085, 4280418150,
+1761607679, 4294967295, 4294967295, 4294967295, 4294967078, 4294967295, 4294929151, 4294967295,
+4294967295, 4294967295, 4294967295, 4285202431, 4294967295, 4294924137, 4294967143, 4294967295,
+4294967147, 4285333281, 4285361151, 587202559, 4294967148, 4294967295, 1852731507, 493821439,
+493821296, 1852731249, 493879150, 493879150, 1903230830, 1962898175, 4285726719, 1962874918,
+639500287, 1987313663, 4294967295, 4294931831, 2046785155, 2030043017, 2054881279, 1979711352,
+2088598783, 2080374648, 4294967295, 4294967295, 4294967160, 1031798783, 4294934144, 4294934783,
+4294934527, 4294967163, 2164260863, 4294967295, 2021785473, 4286316543, 4286119810, 4294967295,
+4294932356, 4294935429, 4294935686, 2298447239, 2038955910, 2307588095, 4287430655, 2357985279,
+2324234239, 2399141771, 2391772559, 4294943487, 4294967182, 4294938367, 4294967295, 2391736319,
+2332033023, 2391707024, 2374864526, 2374865151, 4287532543, 4294923519, 4294967295, 4294923263,
+4294923263, 4294967295, 4294927103, 4283695103, 4287758335, 4294967185, 2483027967, 2482984850,
+1469186047, 4294967295, 1476395007, 4294967188, 4294967295, 4294967295, 4288020479, 4294967295,
+2516582399, 1469186047, 2550136612, 4288190207, 2533359615, 4294967295, 4288255999, 2566914047,
+2610560922, 2600468479, 4288479231, 4288519167, 4288584959, 4288650751, 4288716543, 2728501247,
+2711683071, 3036647423, 4287561727, 2399141887, 3355419555, 2768240549, 2785017766, 4294967207,
+4294944511, 2818572200, 4294945279, 2947284991, 2935991213, 4294945449, 2930552236, 4294945449,
+4289638143, 4289309183, 2868903854, 2868903935, 4294967295, 2846468528, 2846927273, 2846927273,
+2846927273, 2947526575, 2947526575, 3019878319, 4289855487, 2986323880, 2852126719, 4294967210,
+4294967219, 4289898930, 4294947583, 4290052095, 4289897215, 4294948536, 3053453311, 4294967229,
+4294948863, 4290360722, 4290427135, 3199860735, 4290576383, 4294948795, 4294967295, 2499805183,
+4290248703, 3187652607, 3065839615, 4294950842, 4290821887, 4291018751, 4294967234, 4294951106,
+3300982721, 4291150847, 4291216639, 4291282431, 3338665983, 16777124};
+extern const uint32_t e1m1_WADSegFlags[366] = {
+167837953, 16843009, 16843265, 16908810, 16908545, 167903489, 167903489, 167903489,
+167903489, 167837954, 16845314, 16908545, 16910850, 16910850, 33622530, 16843018,
+16845314, 167903489, 167838210, 168430082, 16843266, 168428034, 33620490, 16908801,
+167840266, 167840257, 33620481, 168428034, 33620225, 17432842, 168428033, 168427786,
+33685761, 16843010, 33620490, 16843018, 17432834, 167905793, 16843009, 16843009,
+16843018, 16843266, 16843009, 16843266, 16843009, 16910849, 16910849, 16779777,
+16844801, 16845313, 16843009, 16845313, 16908545, 16843009, 16843009, 16777472,
+17303553, 17432833, 16843009, 16843009, 33685761, 33620225, 33620225, 168428033,
+34212354, 167838218, 168430090, 17435137, 16843018, 17432833, 33686017, 167840258,
+16845313, 16908554, 33685761, 16845314, 16908554, 167837962, 16845313, 33622529,
+17432834, 17432833, 33685761, 34210306, 17432842, 16845314, 167837962, 33686018,
+168430090, 33620481, 16843265, 16843009, 17435138, 17433089, 16845313, 33620225,
+16843018, 33620481, 16845314, 16908554, 167903490, 17432833, 16845313, 16845314,
+16845314, 33688066, 16843009, 16910849, 16845313, 16843009, 16910849, 34210049,
+16843009, 168428042, 16843009, 16843009, 33620482, 17435137, 16843265, 17432834,
+17435138, 33620225, 167903489, 33620226, 34210050, 34210050, 34210050, 16908801,
+168430090, 167837962, 33686017, 167903489, 16843018, 167837962, 16843265, 34210049,
+16843010, 16843010, 16910850, 17432833, 16845313, 16845314, 16845314, 16910850,
+17435137, 16843009, 17301506, 167903745, 16843009, 134283520, 16843008, 17301761,
+167837954, 16843009, 16845313, 16843018, 16843009, 16843009, 16843009, 33620226,
+168427777, 16843009, 33620225, 33620225, 168427777, 33620234, 167903489, 33620234,
+33620234, 167837954, 17432842, 16843009, 167903745, 16843010, 17432842, 16843010,
+16845322, 167837962, 16843009, 16843009, 33685761, 33686018, 16910858, 33686018,
+34212354, 167903490, 167903498, 17433098, 17435138, 34212354, 168427786, 16908554,
+33620225, 16843009, 16843009, 16843009, 16843018, 16843009, 16843265, 16843009,
+16843009, 16843009, 16843009, 16908545, 16843009, 16845322, 16843018, 16843009,
+16843010, 16908554, 16910849, 33620225, 16843018, 16843009, 33686018, 167905793,
+167905792, 168428032, 167903498, 167903496, 168427784, 33619969, 16908545, 33622536,
+168427777, 34210049, 16843009, 16845314, 68098, 134283522, 33685761, 167837962,
+33686017, 167837962, 16843009, 16843009, 16843018, 167903489, 16845314, 16843265,
+16845313, 16843010, 167837953, 16843009, 167903490, 17432833, 17432834, 16843009,
+16845314, 16845314, 16845314, 33622530, 168427786, 134217985, 16908545, 33685761,
+168427777, 33620234, 167905794, 16845313, 16843018, 16843265, 16843009, 33685761,
+33620225, 33688074, 168428034, 168430081, 17435137, 16842753, 16843009, 16844801,
+16844801, 16843009, 16843265, 16777473, 17301761, 16843016, 33620225, 33622016,
+168427777, 16843009, 65793, 16843016, 16843009, 16843009, 16908545, 16843009,
+33620225, 168427777, 33620226, 16910849, 167837953, 16843009, 16910849, 167837953,
+34210050, 167837953, 16908545, 16910849, 16910849, 16910849, 16910849, 33688065,
+168427777, 66049, 16908545, 33620225, 167840266, 167837954, 167837954, 16843010,
+16845313, 167837954, 16845313, 167903489, 33620482, 16845322, 33686018, 16845322,
+16908801, 17435137, 167837954, 167837953, 16843009, 33686018, 33686018, 33686018,
+33686018, 168430090, 168430090, 33622538, 16908545, 33622530, 167837953, 16843018,
+16843010, 17435144, 16842753, 16908545, 17434625, 16843266, 167837953, 16843018,
+16843265, 16910858, 16910849, 34210049, 16908545, 16845314, 16843009, 167837953,
+16908545, 167840257, 33685761, 16843274, 16910849, 16910849, 16843010, 16845314,
+34210058, 16910849, 16910849, 16910849, 167837953, 65794};
+extern const uint32_t e1m1_WADBlockMap[2820] = {
+4291035053, 2031658, 85656858, 85787932, 85919006, 86050080, 86181154, 86312228,
+86443302, 86574376, 86705450, 86967596, 87557428, 87950651, 88474946, 88737097,
+88868171, 88999245, 89130319, 89261393, 89392467, 89523541, 89654615, 89785689,
+89916763, 90047837, 90178911, 90309985, 90703205, 91030890, 91161966, 91293040,
+91489650, 92079480, 92538241, 93062536, 93980052, 94242205, 94373279, 94504353,
+94635427, 94766501, 94897575, 95028649, 95159723, 95290797, 95421871, 95552945,
+95946165, 96601532, 97322439, 97584591, 97846739, 98436570, 99091938, 99550700,
+100074995, 100992511, 101385736, 101516812, 101647886, 101778960, 101910034, 102041108,
+102172182, 102303256, 102434330, 102696476, 103089697, 103745066, 104269362, 104859195,
+105449027, 106301007, 106890842, 107480675, 107742826, 108398193, 108791416, 109315712,
+109708935, 110102157, 110429843, 110691991, 110954139, 111216287, 111478436, 111609510,
+111806120, 112330413, 112854710, 113575614, 114296523, 114755283, 115148505, 115803874,
+116328172, 116786930, 117311226, 117573376, 117769988, 117901062, 118032136, 118294283,
+118556431, 118818579, 119080728, 119277339, 119539485, 119998243, 120719149, 121243445,
+122095423, 123078480, 123471705, 123995998, 124979052, 125699963, 126224257, 126486408,
+126879629, 127141779, 127272853, 127403927, 127535001, 127666075, 127797149, 128059296,
+128255908, 128583590, 129370032, 130287548, 131073996, 131991510, 132384738, 132712422,
+133367789, 134350844, 134940679, 135596050, 135727126, 135989272, 136382494, 136644643,
+137758767, 138348606, 138479680, 138610754, 138872900, 139069513, 139266123, 139724880,
+140445784, 141166694, 141756524, 142280823, 142870656, 143788171, 144574619, 145033377,
+145229990, 145361065, 145492139, 145623213, 146540724, 148048075, 148834526, 148965600,
+149096674, 149358820, 149555433, 149752043, 150538482, 150997243, 151390467, 151783687,
+152504594, 153291037, 154339626, 155126076, 155715907, 156174666, 156567891, 157092186,
+158009698, 159189365, 160434567, 161089945, 161221019, 161352093, 161548703, 161745315,
+162072997, 163252656, 163776960, 164039108, 164694475, 165284309, 166070751, 167643633,
+168495624, 169478672, 170461727, 171182638, 171969085, 172886597, 173345364, 173935190,
+174787178, 174918252, 175049326, 175245936, 175442548, 175704694, 177670784, 179571367,
+179899063, 180488893, 181209799, 183306973, 184224504, 184552188, 186059530, 187370272,
+188746554, 189008705, 189139781, 189860682, 190843734, 191957867, 192482168, 192613242,
+192809852, 193006464, 193399682, 195431312, 196873137, 197856195, 198839251, 199756769,
+201133044, 202443788, 202705939, 204213278, 205524019, 207227985, 207817821, 207948900,
+208800875, 209390710, 209980544, 210570380, 210701454, 210898064, 211094676, 211881110,
+214699188, 216009940, 217189611, 217648375, 217910523, 218500354, 219417872, 219811094,
+221187364, 222432565, 223219017, 223546705, 223677780, 224660827, 225447273, 226430329,
+227151241, 227282315, 227478925, 227675537, 228003219, 229117343, 230100394, 231607744,
+232066515, 232525271, 233311715, 233508329, 234294772, 235408892, 237047315, 237768230,
+238423602, 239144507, 239734341, 240520781, 241372770, 241503844, 241634918, 241831528,
+242028140, 242552431, 243666555, 244518536, 245698203, 246156968, 246746799, 247729854,
+247992005, 248254154, 248647374, 249040596, 249302746, 249695966, 251006698, 251924222,
+252514053, 253300504, 253431578, 253562652, 253759262, 254086946, 254414632, 255069995,
+256184124, 257298253, 257429335, 257757018, 258477922, 258936685, 259329905, 259592054,
+259854202, 259985278, 260116352, 261033862, 262213527, 263327659, 263851961, 263983035,
+264114109, 264310719, 264638403, 264835016, 265490378, 267259867, 269029374, 269553678,
+270209047, 270929952, 271519788, 271847474, 272306229, 273223747, 273354826, 273485900,
+273748046, 274337875, 276107364, 277024898, 277155972, 277287046, 277483656, 277745804,
+277942416, 278728850, 280105121, 281612480, 282136782, 282595542, 283119836, 283840738,
+284299504, 284692723, 285413630, 285544708, 285675782, 285872392, 286003467, 286396685,
+286789911, 286920985, 287052059, 287248669, 287510817, 287707429, 288362791, 289476918,
+289870149, 290328907, 290853202, 291246425, 291639647, 292032869, 292163945, 292295019,
+292426093, 292557167, 292753777, 292884852, 293015926, 293147000, 293278074, 293409148,
+293671294, 293998979, 294326665, 294523277, 294719887, 295440789, 296358308, 296817070,
+297079218, 297341367, 297669051, 297800127, 297931201, 298062275, 298193349, 298389959,
+298521034, 298652108, 298783182, 298914256, 299045330, 299307477, 299569625, 299962846,
+300356068, 300945899, 302780922, 304091673, 304353827, 304484901, 304615975, 304747049,
+304878123, 305009197, 305140271, 305271345, 305467955, 305599030, 305730104, 305926714,
+306188862, 306451010, 306713159, 306909770, 307302990, 307565139, 308089433, 310579824,
+311759502, 311890582, 312021656, 312152730, 312283804, 312414878, 312545952, 312677026,
+312808100, 313135782, 313463469, 313791153, 314184375, 314446524, 314708672, 314970820,
+315232969, 315364043, 315495117, 315626191, 317854434, 318968571, 319361800, 319492874,
+319623948, 319755022, 319886096, 320017170, 320148244, 320279318, 320410392, 320738076,
+321000224, 321131299, 321262373, 321393447, 321524521, 321655595, 321786669, 321917743,
+322048817, 322835257, 323162943, 323556168, 323687242, 323818316, 323949390, 324080464,
+324211538, 324342612, 324473686, 324604760, 324735834, 324866908, 324997982, 325129056,
+325260130, 325391204, 325522278, 325653352, 325784426, 325915500, 326505330, 326833015,
+327226240, 328078215, 328536978, 328930200, 329257885, 329520035, 329651109, 329782183,
+329913257, 330044331, 330175405, 330306479, 330437553, 330568627, 330699701, 330830775,
+330961849, 331092923, 331223997, 332665797, 334107611, 335418357, 336598022, 337122326,
+338170913, 338826287, 339219509, 339350585, 339481659, 339612733, 339743807, 339874881,
+340005955, 340137029, 340268103, 340399177, 340530251, 340661325, 340792399, 340923473,
+341578837, 342365282, 343479411, 344593537, 346100883, 347149480, 348132542, 348525763,
+348656839, 348787913, 348918987, 349050061, 349181135, 349312209, 349443283, 349574357,
+349705431, 349836505, 349967579, 350098653, 350229727, 350491873, 350754022, 351802609,
+352261369, 354030857, 354948379, 355931445, 356193593, 356324668, 356455742, 356586816,
+356717890, 356848964, 356980038, 357111112, 357242186, 357373260, 357504334, 357635408,
+357766482, 357897556, 358028630, 358159704, 358290778, 358552924, 359077217, 360060272,
+360781183, 361174404, 361305480, 361436554, 361567628, 361698702, 361829776, 361960850,
+362091924, 362222998, 362354072, 362485146, 362616220, 362747294, 362878368, 363009442,
+363140516, 363271590, 363468200, 363599275, 363861422, 364320178, 364582330, 364713404,
+364844478, 364975552, 365106626, 365237700, 365368774, 365499848, 365630922, 365761996,
+365893070, 366024144, 366155218, 366286292, 366417366, 366548440, 366679514, 367007196,
+367400419, 367728105, 368121326, 368383476, 368514550, 368645624, 368776698, 368907772,
+369038846, 369169920, 369300994, 369432068, 369563142, 4294967295, 4294967295, 4294967295,
+4294967295, 4294967295, 4294967295, 4294967295, 4294967295, 4294967295, 19464487, 5701631,
+19398951, 4294902057, 19333206, 4294902056, 19398951, 19398655, 4294902056, 19333214,
+4294902056, 19333214, 4294902056, 58655015, 4294967295, 4294967295, 4294967295, 4294967295,
+4294967295, 4294967295, 4294967295, 4294967295, 4294967295, 4294967295, 4294967295, 4294967295,
+4294967295, 3670071, 3670015, 4294901816, 4294901815, 3604534, 4294967295, 4294967295,
+4294967295, 4294902057, 19398742, 4294902057, 19398742, 35324442, 19464191, 35324442,
+19464191, 4294902298, 19398750, 4294902298, 19398750, 4294902298, 58721151, 58917761,
+59179908, 4294902666, 58983296, 59179910, 4294902666, 59179910, 4294967295, 4294967295,
+4294967295, 4294967295, 4294967295, 4294967295, 4294967295, 4294967295, 4294967295, 4294967295,
+4294967295, 3801145, 3801087, 4294901818, 3670071, 4294901817, 3342379, 3670071,
+4294901817, 3342379, 3604532, 3407871, 3473460, 3604534, 3538943, 3538943,
+3538943, 3538943, 3538943, 5767255, 4294901850, 5767255, 4294902057, 5701718,
+4294902057, 5636179, 35323999, 4294902300, 35323999, 4294902300, 35389535, 6291455,
+35455516, 6291455, 35455516, 58654719, 58786688, 59048834, 59310984, 58785791,
+59114373, 59310984, 59179007, 4294902664, 33948165, 4294967295, 4294967295, 4294967295,
+4294967295, 4294967295, 4294967295, 4294967295, 4294967295, 4294967295, 37421116, 3997695,
+3932159, 7929916, 3801087, 3866682, 4294902645, 3801145, 57999419, 3735551,
+4294901817, 3342379, 3735608, 2883583, 3407923, 3276799, 3342386, 4294901812,
+3276849, 3342335, 36045349, 36307497, 4980735, 36176423, 36307497, 4980735,
+36110412, 36241960, 4294902314, 5832792, 4294901850, 5570644, 5832792, 5570559,
+5636181, 5505023, 5636181, 4294901855, 4294901855, 4294901855, 35455071, 37356089,
+6291455, 37159453, 4294902330, 4294902654, 42467846, 4294902409, 42467846, 4294902409,
+33948165, 4294902408, 42467845, 33947647, 4294902408, 42467845, 33947647, 4294902408,
+42467845, 33947647, 33947647, 33947647, 33947647, 33947647, 33947647, 33947647,
+21823487, 4294902277, 4294967295, 4294967295, 4294902331, 37683236, 2293759, 2359331,
+4294901881, 2490402, 4294902645, 2752553, 4294901856, 2752542, 4294901856, 2031646,
+2818090, 36372576, 2097151, 2818090, 36372532, 2097151, 3211312, 4294901812,
+3211312, 3145727, 36044848, 36175871, 5046271, 36110413, 5111807, 5832792,
+4294901850, 5505101, 5832792, 5111807, 5374033, 4294901844, 5439570, 4849663,
+4294901851, 5963849, 4294901852, 37290552, 4294902330, 37225015, 4294902330, 4294902654,
+4294902409, 4294902409, 4294967295, 4294967295, 42532863, 42532863, 42532863, 42532863,
+42532863, 42532863, 42467327, 4294902408, 21823487, 4294967295, 7077887, 4294902340,
+38010987, 7077887, 37487163, 2424831, 37683774, 37880385, 2359295, 37814308,
+4294902338, 2490405, 2490367, 2687016, 4294901856, 2424862, 6291496, 2031615,
+36372576, 36504108, 36766256, 2949119, 36438571, 36569645, 36700719, 4294902321,
+36569132, 36700719, 4294902321, 2949164, 3145727, 4294902310, 4294902311, 5046348,
+36110414, 4294902324, 5111885, 36897330, 37028404, 4294902326, 5177421, 36831316,
+37093939, 4718591, 5046344, 5308495, 36831316, 4718591, 4294901832, 4784200,
+4784127, 6029385, 4294901853, 4294901853, 4294901853, 58589277, 29097983, 4294902409,
+42533307, 4294967295, 4294967295, 4294967295, 4294967295, 4294967295, 4294967295, 4294902407,
+4294902407, 4294902092, 4294967295, 38076996, 4294902342, 7274605, 38076996, 4294902342,
+7143485, 37486703, 4294902342, 37552160, 37749310, 4294902337, 2162720, 37748775,
+37945921, 4294902646, 2162720, 2490405, 37945383, 4294902646, 2555941, 4294901800,
+2424862, 2621479, 4294902306, 35651614, 35783201, 35914275, 4294902317, 36504096,
+4294902318, 4294902318, 4294901805, 36044847, 4915199, 36110503, 4915199, 10944590,
+36110504, 4456447, 4522052, 5111882, 37028008, 4294902326, 4522052, 5242959,
+4294902326, 5177415, 5308496, 262143, 21168199, 20971519, 21037376, 21168450,
+4294902084, 20905984, 4294967295, 4294967295, 42533307, 29097983, 4294902409, 62587323,
+62652415, 62652415, 18808831, 28049835, 28770733, 28967352, 62587825, 18808831,
+28770733, 28967352, 4294902715, 28508592, 28705205, 28836279, 4294902201, 4294967295,
+4294967295, 4294967295, 42402300, 21823487, 4294967295, 38141951, 7340031, 4294902341,
+4063293, 4294901871, 4063264, 4294902333, 2162720, 4128830, 58065475, 2162687,
+4259873, 37945886, 4294902646, 35520577, 4294902646, 4294902302, 10878997, 35586590,
+35914275, 1376255, 36569254, 1376255, 36569258, 1376255, 3014701, 4294901930,
+3080238, 4294902310, 4325389, 11010215, 20382006, 4390911, 20250792, 20382006,
+4294902078, 4390978, 4587589, 20316469, 20840765, 4587519, 4294901830, 4653126,
+262143, 4653126, 4294967295, 4294901760, 4294967295, 4294967295, 4294967295, 62129075,
+62391221, 4294902713, 61998001, 62129075, 62325686, 4294902712, 16253171, 27984158,
+28115372, 28246446, 28967351, 61932460, 62260146, 15990783, 18743544, 28246445,
+28967351, 15663103, 28311800, 28508594, 28705204, 28901815, 4294902205, 4294967295,
+4294967295, 4294967295, 42402300, 21823487, 4294967295, 38141951, 7340031, 38273605,
+4294902357, 4063293, 38207599, 39125576, 4128767, 4128767, 4194367, 4294902339,
+4259904, 4259839, 4294901825, 1441791, 1507350, 4294901924, 10682390, 10813604,
+4294901926, 10682383, 11141286, 1048575, 3014701, 11141286, 1048575, 3080238,
+36044967, 917503, 20316327, 20513079, 4294902098, 20316469, 20513079, 20840764,
+22282578, 19333119, 20316469, 20709689, 20840765, 4294902100, 19267588, 327679,
+21954569, 262143, 589828, 4294902095, 4294901769, 65536, 21889033, 131071,
+21889033, 131071, 131071, 33423869, 4294902276, 22478849, 19267583, 22479173,
+4294902104, 19202339, 22544709, 62522293, 64029648, 61800447, 61866927, 62194612,
+62456760, 63964090, 61669375, 61735853, 62260143, 62391223, 15990783, 18743544,
+28180907, 61604271, 62260141, 15990783, 16056564, 16318712, 18743546, 4294902191,
+15663342, 16253168, 16384249, 29163954, 4294967295, 4294967295, 4294967295, 33357823,
+21823487, 4294967295, 38141951, 66519637, 38141951, 39125588, 66520054, 4294902776,
+13238473, 14155979, 14287065, 39060039, 66388980, 7143423, 14155979, 4294901977,
+14155884, 4294967295, 1638424, 1638399, 38470218, 1179647, 1572887, 38404681,
+1179647, 38404681, 1114111, 10682385, 4294901929, 10551393, 11075747, 851967,
+10551393, 10682530, 4294901929, 851980, 10616929, 20447543, 20644153, 22151505,
+393215, 20382005, 20513080, 20644154, 22085948, 22217042, 4294902100, 20250918,
+20578617, 20709691, 22217021, 4294902100, 22020195, 655359, 21954659, 4294902096,
+7405577, 7602290, 7798901, 21954680, 4294902096, 7405577, 7798900, 655359,
+7405680, 7602291, 7798902, 21889357, 655359, 21823594, 4294902094, 21823594,
+33751554, 4294902276, 33423869, 33554943, 33686017, 33817091, 7274495, 4294902102,
+21299492, 22610262, 19136511, 21299492, 61866329, 64095162, 4294902739, 61866927,
+62522297, 4294902739, 4294967295, 16056564, 16384246, 16515323, 4294902641, 15728879,
+16384241, 16515323, 29098417, 64487869, 4294902745, 4294967295, 4294967295, 4294967295,
+4294902268, 4294902092, 4294967295, 15073509, 8060927, 15007955, 66453734, 4294902792,
+12386426, 13172926, 13304010, 13435084, 13566158, 13697232, 13828306, 14418139,
+14876893, 15007972, 67634183, 7143423, 12452029, 13369547, 13500621, 14418127,
+14549213, 58262391, 59507595, 7143423, 13435084, 14549198, 58262391, 58459003,
+59442045, 4294902668, 58459003, 1703935, 38469631, 38601291, 38404095, 38601290,
+4294902350, 38404681, 38863436, 1114111, 38797481, 66716241, 983039, 6357010,
+10682529, 12845225, 13041861, 34275528, 38863440, 66716665, 786431, 917516,
+10551393, 10682530, 12845225, 12976325, 13107399, 34472459, 786431, 851980,
+10616929, 12976324, 13107399, 4294902286, 20447237, 4294967295, 6553699, 4294901895,
+6553699, 6684773, 7864437, 23462023, 4294902128, 6684680, 7667826, 9830520,
+19005729, 23200097, 24183152, 589823, 9830537, 23134498, 23265634, 4294902116,
+7340135, 7733363, 9830537, 23331171, 25035133, 6815743, 6881384, 7536746,
+24707190, 24838522, 25297277, 26149260, 4294902160, 6946921, 24772985, 4294902139,
+7274495, 4294902102, 4294967295, 18612505, 4294902045, 18088209, 18612503, 31129885,
+17956863, 18284819, 4294902207, 16187638, 16580860, 29229310, 57737663, 4294902642,
+15859953, 16580860, 28377342, 29557186, 64487891, 29622271, 30015945, 30605774,
+29949951, 30015945, 30736847, 4294902230, 4294967295, 4294967295, 4294902268, 4294902092,
+4294967295, 15007956, 15335654, 13893631, 15007956, 15270118, 67436778, 4294902792,
+12452029, 13566158, 13697232, 13828306, 14614740, 14745824, 14876898, 15007972,
+67436777, 67568646, 4294902792, 12452029, 13566158, 14811359, 58196855, 59442041,
+13565951, 58130655, 58262392, 58393466, 58524540, 4294902667, 44499619, 58327747,
+58459003, 1703935, 44171290, 44434083, 46334631, 1769471, 1835035, 44171452,
+47448785, 1769471, 1835035, 38732366, 4294902481, 1900572, 38732364, 47252050,
+1900543, 38797341, 47252050, 4294902779, 1245202, 34341387, 34734609, 38928976,
+66781905, 4294902780, 34078739, 34341387, 34472461, 34734609, 393215, 9765005,
+34079239, 34472461, 34603535, 34734609, 60555801, 4294902685, 9240581, 60555413,
+9306111, 8912895, 8912895, 23527782, 23855464, 24117615, 4294902133, 18940063,
+23200034, 23593319, 23986541, 24183152, 24314226, 4294902135, 19005599, 23200094,
+24314211, 23003135, 25035107, 25428355, 25624965, 25756040, 26345873, 4294902166,
+10223770, 10354845, 24772985, 24904059, 25362818, 26018188, 26149262, 26345872,
+10158079, 10289308, 24707230, 24838522, 4294902140, 10289308, 196607, 10158190,
+10289308, 4294967295, 18415615, 18612505, 31195423, 18153471, 18350359, 31129884,
+4294902236, 18284819, 4294902207, 16646391, 29295038, 15925247, 29491454, 4294902211,
+29950403, 4294902222, 29884871, 30081481, 30409167, 4294902230, 4294967295, 4294967295,
+4294902268, 4294902092, 4294967295, 13893823, 14024917, 15073495, 15401194, 15532268,
+12582911, 12648640, 13893843, 14024917, 15073495, 15204583, 15335657, 15466731,
+39190765, 4294902789, 12648640, 12779714, 13631695, 13762769, 13893843, 14024917,
+14614743, 14745824, 15139042, 15270120, 67437142, 4294902790, 13566146, 14811359,
+58131031, 4294902648, 39256287, 44302967, 58131113, 58327928, 58524539, 4294902766,
+44303011, 44565159, 46334633, 58327748, 65930107, 44236799, 44434083, 44565159,
+4294902467, 44171452, 47448785, 47316991, 47316991, 47316991, 1310719, 8454270,
+4294902481, 8454270, 4294902281, 9764874, 34210313, 34603535, 60424728, 4294902683,
+9764874, 4294902683, 4294901901, 9240711, 4294902117, 9240711, 23396640, 24052072,
+24445300, 4294902134, 18874527, 23069023, 23724392, 23986539, 24641911, 10485759,
+22937760, 23069023, 10551295, 25100638, 25493891, 25756038, 25887114, 26476947,
+4294902165, 10092680, 25362817, 26411405, 8978431, 26935450, 4294902178, 27001243,
+196607, 4294967295, 18415615, 18546970, 30998815, 17891327, 18219285, 18481432,
+30998811, 4294902234, 17957136, 29360406, 17104895, 17432841, 29426112, 4294902639,
+16974082, 17432841, 29622602, 31261140, 29687807, 30147013, 30671309, 29753343,
+29819334, 30147019, 30540241, 30933463, 4294967295, 4294967295, 33357823, 21823487,
+4294967295, 12582911, 38994157, 11796479, 12583103, 15532225, 39191123, 11796479,
+12648640, 38994115, 39322198, 4294902392, 4294902392, 41353815, 44302968, 44696233,
+64750263, 65536989, 65995758, 44367871, 44696233, 64816092, 65930216, 4294902767,
+44434085, 44565159, 44696233, 44827307, 44958381, 65209314, 4294902760, 44368060,
+47383250, 47382527, 47382527, 8388607, 8650880, 4294902482, 8257661, 8388735,
+8650881, 8257535, 8454270, 4294901892, 720895, 27525119, 27591076, 27722150,
+27853224, 4294902186, 23396490, 9109503, 23658853, 4294902132, 9306250, 9437327,
+9568401, 9961623, 23658848, 4294902122, 9371790, 9502864, 9896084, 10027160,
+23068832, 8978431, 9306251, 9437327, 9699475, 10027159, 25100448, 25231744,
+8978431, 25165963, 4294902145, 27197851, 27328928, 4294902178, 27001243, 27132317,
+4294902175, 22347778, 4294902106, 21561672, 22872410, 21430271, 21561672, 64291165,
+18546687, 18809115, 17891327, 18481429, 4294902043, 17957136, 17104895, 17170693,
+17498378, 57606412, 4294902640, 16908545, 17432835, 17563915, 31326685, 64618975,
+4294902747, 4294967295, 4294967295, 4294967295, 4294902268, 4294902092, 40501247, 12582911,
+40370771, 41222761, 11796479, 38994111, 40370774, 11796479, 39191123, 39387736,
+40305248, 40829544, 4294902392, 4294902392, 41419383, 64815799, 64947166, 65602532,
+65733610, 64880639, 64947166, 65602532, 65733610, 46137343, 65012644, 65143777,
+65602535, 65733610, 61079551, 4294902692, 61014946, 4294902692, 60948651, 8388607,
+8519808, 8650883, 8191999, 8257661, 8388735, 8585346, 4294901892, 8192124,
+8585342, 4294901892, 458751, 4294901770, 4294901766, 4294901766, 4294901766, 9175046,
+4294902170, 4294901900, 9175047, 4294902169, 4294901767, 4294901767, 4294901767, 22347783,
+4294902107, 21496135, 22675785, 22806875, 4294902109, 21430598, 21561672, 22872412,
+63898570, 64291796, 4294902742, 63505352, 63767498, 63898574, 4294902740, 63439815,
+63701961, 4294902733, 17170431, 17236230, 17563912, 17694989, 16777215, 16843008,
+17629452, 31260942, 31392222, 4294902747, 4294967295, 4294967295, 4294967295, 4294902268,
+4294902092, 40501865, 40501247, 4294902389, 4294902389, 39452671, 39846490, 40895078,
+42074753, 4294902403, 41615994, 41878140, 42009216, 4294902402, 50987703, 65274847,
+65733605, 65864684, 51052543, 65274847, 65733605, 65864684, 46137343, 65012491,
+65471462, 65799147, 4294902765, 4294967295, 4294901931, 44040322, 8191999, 43909250,
+4294902432, 43057276, 43909778, 4294902431, 43057808, 43975314, 43057151, 43057151,
+42926079, 42992271, 4294967295, 26870167, 4294967295, 26804632, 4294967295, 4294967295,
+21495807, 22741321, 4294902108, 21430598, 22806857, 63898565, 64422870, 63176703,
+63243204, 63833037, 64422863, 63111167, 63177667, 63374278, 63636424, 63767500,
+17367039, 32506127, 62718908, 63308734, 63636423, 17301503, 17694984, 32506127,
+4294902718, 16777471, 17760526, 31523295, 4294967295, 4294967295, 4294967295, 33357823,
+21823487, 40501247, 4294902378, 4294902389, 4294967295, 39518810, 40239713, 41747057,
+42205827, 41549823, 41681530, 41812605, 42205823, 45088767, 45154992, 45482675,
+45613751, 45875897, 46203584, 46465730, 50987718, 57934707, 4294902679, 45089455,
+45941427, 46203584, 46465730, 46596806, 47514312, 60162826, 4294902679, 45941423,
+46072510, 51053269, 60162957, 60359576, 59637759, 60031886, 4294902677, 60031886,
+11272191, 59966350, 60752788, 11272191, 60752782, 42663935, 44040850, 4294902433,
+43057802, 43975314, 4294902433, 43123345, 43385493, 4294902431, 43385493, 43253759,
+4294902422, 4294902414, 8126463, 26673286, 34996757, 8126463, 8781957, 26739095,
+35062294, 8781823, 26738822, 35062292, 4294967295, 4294967295, 4294967295, 32113129,
+32112639, 32112639, 63046593, 63636419, 4294902732, 32047589, 62652912, 62915519,
+63046593, 4294902731, 31785444, 31916518, 32047592, 32309740, 32440814, 32571888,
+32965108, 62915065, 31457279, 31523296, 31654370, 32571884, 32702962, 32899573,
+4294902265, 4294967295, 4294967295, 4294967295, 4294902268, 4294902092, 4294902378, 4294902389,
+4294967295, 39584347, 39715421, 40174177, 41091698, 42336901, 39780351, 41157215,
+39780351, 41157215, 45417138, 45548214, 45679288, 45810362, 46138044, 46465729,
+4294902644, 46138034, 46465729, 46662343, 60097237, 66061206, 66192369, 4294902771,
+59835093, 60097426, 66126742, 66257906, 59899903, 60031890, 4294902677, 60031890,
+59965439, 60031891, 4294902687, 4294902687, 43123338, 4294902433, 43123338, 4294902433,
+4294902421, 43451029, 43582104, 43713178, 43844252, 43253759, 43778715, 4294902429,
+4294902414, 8126463, 34931219, 4294902294, 8716411, 34996755, 4294902295, 34799749,
+35062292, 4294967295, 4294967295, 4294967295, 4294902250, 4294967295, 32833535, 33030647,
+4294902265, 32899573, 33096184, 4294967295, 4294967295, 4294967295, 33357823, 21823487,
+40566783, 41287679, 4294967295, 39649279, 39715421, 40108642, 41091685, 4294902406,
+39780958, 40043106, 4294902388, 39780958, 40043106, 41157230, 45417138, 46138042,
+45285375, 66060992, 59899903, 59768831, 59835280, 59768831, 4294902672, 60687247,
+4294902687, 60687247, 4294902687, 42664586, 42663935, 4294902411, 43319956, 43319295,
+4294902421, 43254419, 42860543, 4294902414, 4294967295, 4294967295, 4294967295, 4294967295,
+32178175, 4294967295, 4294967295, 4294967295, 4294967295, 4294967295, 4294967295, 33292795,
+21823487, 40566783, 4294902379, 41288309, 41353215, 41353215, 4294967295, 40828927,
+45416447, 66061221, 11337727, 50069681, 61146001, 4294902694, 11600044, 50201340,
+59835280, 4294902688, 50200753, 60818320, 4294902689, 60686434, 4294902689, 60686434,
+4294967295, 42730123, 42795007, 42795007, 42795007, 42795007, 4294902413, 4294967295,
+4294967295, 4294967295, 4294967295, 32178175, 4294967295, 4294967295, 4294967295, 4294967295,
+4294967295, 33292287, 33292287, 21823487, 40632319, 40632319, 4294902380, 40632939,
+40697855, 4294902390, 41288300, 40697855, 41288301, 40697855, 40764013, 4294902390,
+48169693, 48300768, 48562914, 49218286, 4294902512, 11600044, 47776472, 47907546,
+48038620, 48169694, 48562912, 49218286, 50070256, 4294902673, 11600044, 47776472,
+47973083, 50135804, 59769598, 60818321, 11665407, 50201341, 60818320, 4294902689,
+60883042, 4294967295, 4294967295, 4294967295, 4294967295, 4294967295, 4294967295, 4294967295,
+4294967295, 32178175, 4294967295, 4294967295, 4294967295, 4294902266, 4294902266, 4294902266,
+4294902266, 4294902266, 33227258, 4294967295, 4294902092, 40632319, 4294902380, 40632939,
+40697855, 40697855, 40697855, 41288301, 40697855, 41288301, 48300031, 48366305,
+48497379, 48628453, 48759527, 48890601, 49218283, 49349360, 49480434, 4294902516,
+46727346, 47055563, 47776470, 48497376, 48759525, 48956137, 49283823, 49414897,
+49545971, 11730943, 46793417, 46990027, 47579854, 47776471, 4294902525, 46792882,
+46990027, 50135767, 4294967295, 4294967295, 4294967295, 4294967295, 4294967295, 4294967295,
+4294967295, 4294967295, 4294967295, 32178666, 4294902266, 33161707, 33226751, 33226751,
+21757951, 4294902266, 33161547, 21757951, 4294902266, 4294902091, 4294902091, 4294902091,
+4294902091, 4294902091, 4294902091, 21758283, 4294967295, 4294967295, 4294967295, 4294967295,
+11796653, 48693967, 48890600, 49021675, 49545965, 49677045, 49808119, 49939193,
+4294902523, 11665581, 47055561, 47186639, 48956136, 49545964, 49677045, 49939193,
+4294902523, 46727346, 46924490, 47055565, 47186639, 11599871, 12255410, 46924490,
+47186637, 11599871, 12255413, 4294902476, 4294967295, 4294967295, 4294967295, 4294967295,
+4294967295, 4294967295, 4294967295, 4294967295, 21757951, 4294902251, 4294902091, 4294902091,
+4294902091, 4294967295, 4294967295, 4294967295, 4294967295, 4294967295, 4294967295, 4294967295,
+4294967295, 11796653, 49808079, 50004729, 11403263, 49873615, 4294902523, 11599871,
+46923963, 11599871, 12255413, 4294902476, 4294967295, 4294967295, 4294967295, 4294967295,
+4294967295, 4294967295, 4294967295, 4294967295, 4294967295, 4294967295, 4294967295, 4294967295,
+4294967295, 4294967295, 4294967295, 4294967295, 4294967295, 4294967295, 11403263, 11796654,
+4294901943, 11403437, 4294901943, 11534335, 12189872, 11534335, 11862192, 4294901946,
+51511295, 51905299, 55575375, 51642367, 55051032, 55575369, 4294902627, 55116616,
+4294902627, 56820552, 55115775, 4294902627, 56820552, 55115775, 55050239, 4294902600,
+55051079, 4294967295, 4294967295, 4294967295, 4294967295, 4294967295, 4294967295, 4294967295,
+4294967295, 4294967295, 4294967295, 4294967295, 4294967295, 4294967295, 4294967295, 11403437,
+11993268, 50331948, 11403263, 11927726, 12058807, 19595562, 50266413, 50397952,
+50529026, 4294902537, 12058806, 19529913, 50921776, 11534335, 11927728, 12189881,
+19988784, 50594098, 50725637, 50856711, 4294902537, 11534511, 12189877, 50594099,
+55313168, 67372029, 51445759, 51512081, 55378764, 67306318, 4294902788, 51512081,
+51905299, 55509838, 4294902608, 51839763, 51970840, 55116601, 55640912, 4294902610,
+51970839, 55116601, 4294902610, 4294902583, 52691747, 52888357, 53805864, 53936950,
+52625407, 53019427, 54133557, 4294902627, 52560673, 54199098, 56820540, 56885247,
+4294902628, 54985542, 54984703, 4294902599, 4294967295, 4294967295, 4294967295, 4294967295,
+4294967295, 4294967295, 4294967295, 4294967295, 4294967295, 4294967295, 4294967295, 4294967295,
+4294967295, 19857708, 11993087, 19726520, 19857710, 4294902068, 12058806, 19792057,
+4294902068, 12124342, 20054318, 4294902068, 20185395, 55313164, 56361819, 66978813,
+67109887, 51314687, 55313167, 55444301, 51314687, 51643151, 55444245, 55575375,
+51707903, 51774229, 51970839, 55640912, 4294902610, 51970839, 55247673, 55771986,
+56099671, 52822015, 53936934, 54068024, 55247690, 55968596, 56427351, 56689502,
+52690943, 52757284, 52953895, 4294902583, 52626210, 57017129, 57279335, 61539180,
+52559871, 53084962, 54264635, 57017149, 57279337, 57410411, 4294902699, 4294902628,
+54985542, 54984703, 4294902599, 4294967295, 4294967295, 4294967295, 4294967295, 4294967295,
+4294967295, 4294967295, 4294967295, 4294967295, 4294967295, 4294967295, 4294967295, 4294967295,
+19922943, 4294902068, 4294902068, 4294902068, 51118388, 55313165, 67044188, 67175424,
+51249151, 55313166, 67175245, 4294902786, 51773439, 52036374, 55706449, 51838975,
+54526746, 55706433, 55903059, 56230745, 52166655, 53478172, 54526783, 55247690,
+55903060, 56230742, 56492893, 56623967, 4294902625, 57016319, 57082726, 57279336,
+57541484, 61342631, 61473705, 4294902699, 53150496, 56951613, 57148262, 57279337,
+57475948, 61539182, 56950783, 54984703, 54984703, 4294967295, 4294967295, 4294967295,
+4294967295, 4294967295, 4294967295, 4294967295, 4294967295, 4294967295, 4294967295, 4294967295,
+4294967295, 4294967295, 4294967295, 4294967295, 4294967295, 4294967295, 54657857, 54657023,
+52166655, 53478172, 54461234, 52232191, 52298525, 53412654, 53609265, 4294902579,
+52364062, 53674797, 4294902580, 52429599, 53216043, 54330164, 57475902, 56950783,
+54919167, 4294902598, 54920005, 4294967295, 4294967295, 4294967295, 4294967295, 4294967295,
+4294967295, 4294967295, 4294967295, 4294967295, 4294967295, 4294967295, 4294967295, 4294967295,
+4294967295, 4294967295, 4294967295, 4294967295, 4294902594, 4294967295, 4294902626, 4294902626,
+4294902626, 54854468, 56886114, 54853631, 4294902597, 4294967295, 4294967295, 4294967295,
+4294967295, 4294967295, 4294967295, 4294967295, 4294967295, 4294967295, 4294967295, 4294967295,
+4294967295, 4294967295, 4294967295, 4294967295, 4294967295, 4294967295, 54723394, 4294902626,
+56755011, 54788095, 4294902626, 56755011, 54788095, 54788095, 4294902596, 54854468,
+54853631, 4294902597, 4294967295, 4294967295, 4294967295, 4294967295, 4294967295, 4294967295,
+4294967295, 4294967295, 4294967295, 4294967295};
 
 void loadMap_e1m1_WAD(WAD::LevelData& dstLevel) {
 	// Load vertex data
-	dstLevel.vertices = (const WAD::Vertex*)e1m1_WADVertices;
+	dstLevel.vertices = (const WAD::PackedVertex*)e1m1_WADVertices;
 
 	// Load line defs
+	dstLevel.numLineDefs = (e1m1_WADLineDefsSize * 4) / sizeof(WAD::LineDef);
 	dstLevel.lineDefs = (const WAD::LineDef*)e1m1_WADLineDefs;
 
 	// Load side defs
@@ -3230,4 +2955,16 @@ void loadMap_e1m1_WAD(WAD::LevelData& dstLevel) {
 	// Load nodes
 	dstLevel.numNodes = (e1m1_WADNodesSize * 4) / sizeof(WAD::Node);
 	dstLevel.nodes = (const WAD::Node*)e1m1_WADNodes;
+
+	// Load baked lighting
+	dstLevel.segLights = (const uint8_t*)e1m1_WADSegLights;
+
+	// Load render hot seg data
+	dstLevel.segVertices = (const uint16_t*)e1m1_WADSegVertices;
+	dstLevel.segFrontSectors = (const uint8_t*)e1m1_WADSegFrontSectors;
+	dstLevel.segBackSectors = (const uint8_t*)e1m1_WADSegBackSectors;
+	dstLevel.segFlags = (const uint8_t*)e1m1_WADSegFlags;
+
+	// Load collision blockmap
+	dstLevel.blockMap = (const uint16_t*)e1m1_WADBlockMap;
 }
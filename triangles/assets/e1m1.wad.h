@@ -3,13 +3,13 @@
 #include <base.h>
 #include <WAD.h>
 
-constexpr uint32_t e1m1_WADVerticesSize = 1884;
+constexpr uint32_t e1m1_WADVerticesSize = 942;
 extern const uint32_t e1m1_WADVertices[];
 
 constexpr uint32_t e1m1_WADLineDefsSize = 3616;
 extern const uint32_t e1m1_WADLineDefs[];
 
-constexpr uint32_t e1m1_WADSideDefsSize = 9923;
+constexpr uint32_t e1m1_WADSideDefsSize = 3969;
 extern const uint32_t e1m1_WADSideDefs[];
 
 constexpr uint32_t e1m1_WADSegmentsSize = 4389;
@@ -18,11 +18,29 @@ extern const uint32_t e1m1_WADSegments[];
 constexpr uint32_t e1m1_WADSubSectorsSize = 448;
 extern const uint32_t e1m1_WADSubSectors[];
 
-constexpr uint32_t e1m1_WADSectorsSize = 1300;
+constexpr uint32_t e1m1_WADSectorsSize = 700;
 extern const uint32_t e1m1_WADSectors[];
 
-constexpr uint32_t e1m1_WADNodesSize = 4023;
+constexpr uint32_t e1m1_WADNodesSize = 3129;
 extern const uint32_t e1m1_WADNodes[];
 
+constexpr uint32_t e1m1_WADSegLightsSize = 732;
+extern const uint32_t e1m1_WADSegLights[];
+
+constexpr uint32_t e1m1_WADSegVerticesSize = 1463;
+extern const uint32_t e1m1_WADSegVertices[];
+
+constexpr uint32_t e1m1_WADSegFrontSectorsSize = 366;
+extern const uint32_t e1m1_WADSegFrontSectors[];
+
+constexpr uint32_t e1m1_WADSegBackSectorsSize = 366;
+extern const uint32_t e1m1_WADSegBackSectors[];
+
+constexpr uint32_t e1m1_WADSegFlagsSize = 366;
+extern const uint32_t e1m1_WADSegFlags[];
+
+constexpr uint32_t e1m1_WADBlockMapSize = 2820;
+extern const uint32_t e1m1_WADBlockMap[];
+
 void loadMap_e1m1_WAD(WAD::LevelData& dstLevel);
 
@@ -1,1498 +1,960 @@
-#include "C:\repos\GBA\raycaster\assets\mercury.wad.h"
+#include "mercury.wad.h"
 
-extern const uint32_t mercury_WADVertices[1040] = {
-4294770688, 262144, 4294639616, 262144, 4294377472, 393216, 4294639616, 393216,
-4294508544, 524288, 4294508544, 655360, 4293591040, 917504, 4293328896, 1572864,
-4294770688, 4294443008, 196608, 4294443008, 196608, 262144, 327680, 262144,
-4294770688, 524288, 196608, 524288, 327680, 655360, 196608, 2097152,
-4294246400, 917504, 4294639616, 655360, 851968, 786432, 4294508544, 917504,
-458752, 655360, 458752, 524288, 327680, 393216, 589824, 393216,
-589824, 262144, 4294770688, 917504, 720896, 1703936, 458752, 1966080,
-458752, 2097152, 589824, 2097152, 65536, 1048576, 65536, 1310720,
-196608, 1310720, 196608, 1441792, 65536, 1703936, 4294770688, 1703936,
-4294770688, 1572864, 4294508544, 1572864, 4294639616, 1703936, 1376256, 2883584,
-458752, 1048576, 458752, 1441792, 4294901760, 917504, 458752, 1572864,
-327680, 1703936, 4294639616, 1835008, 4294901760, 1835008, 4294508544, 2097152,
-196608, 3538944, 4294377472, 2097152, 589824, 3538944, 4294901760, 2097152,
-196608, 1835008, 327680, 2359296, 327680, 2228224, 458752, 2228224,
-458752, 2359296, 327680, 3407872, 327680, 3276800, 458752, 3276800,
-458752, 3407872, 4294639616, 3407872, 4294508544, 3407872, 4294508544, 3276800,
-4294639616, 3276800, 4294639616, 2359296, 4294508544, 2359296, 4294508544, 2228224,
-4294639616, 2228224, 4294508544, 2883584, 4294508544, 2752512, 4294639616, 2752512,
-4294639616, 2883584, 327680, 2883584, 327680, 2752512, 458752, 2752512,
-458752, 2883584, 4291887104, 4849664, 4294901760, 3538944, 65536, 3538944,
-4291624960, 4980736, 4294770688, 3538944, 4294377472, 3538944, 4294377472, 262144,
-4293591040, 2883584, 65536, 917504, 196608, 917504, 458752, 917504,
-4294508544, 1048576, 4294639616, 1048576, 4294639616, 1179648, 4294901760, 1179648,
-4294901760, 1572864, 196608, 1572864, 4293984256, 5242880, 4293722112, 5242880,
-4294639616, 4325376, 4294246400, 4325376, 4293984256, 4980736, 4293853184, 4980736,
-4293853184, 4718592, 4291624960, 4718592, 4294246400, 4980736, 4294115328, 4980736,
-4294377472, 5242880, 4294508544, 5242880, 4294115328, 5242880, 4293591040, 6422528,
-4293591040, 6553600, 4294639616, 5242880, 4294639616, 5111808, 4294508544, 6553600,
-720896, 6029312, 4294377472, 5111808, 4294508544, 6029312, 4294770688, 5505024,
-4294377472, 5505024, 4294508544, 5505024, 4294770688, 6160384, 196608, 6160384,
-196608, 5505024, 458752, 6029312, 458752, 5505024, 589824, 5505024,
-458752, 6553600, 1900544, 6553600, 4294901760, 6553600, 4293722112, 8519680,
-4293984256, 8519680, 65536, 6553600, 4293459968, 8519680, 4294246400, 8519680,
-4294901760, 6815744, 65536, 6815744, 589824, 6291456, 589824, 6160384,
-720896, 6160384, 720896, 6291456, 4294246400, 6029312, 4294246400, 5505024,
-4291887104, 5242880, 4293853184, 5505024, 4293459968, 6291456, 4293459968, 6160384,
-4293591040, 6160384, 4293591040, 6291456, 4293853184, 6029312, 4293328896, 6029312,
-4294246400, 8781824, 4293328896, 6553600, 4294508544, 8912896, 4293459968, 6553600,
-4293328896, 6422528, 4293328896, 6815744, 4294508544, 8781824, 4293459968, 6815744,
-4293591040, 6815744, 4293984256, 7340032, 4293984256, 7208960, 4294115328, 7208960,
-4294115328, 7340032, 4293722112, 5505024, 4293591040, 5505024, 4292018176, 5242880,
-4292018176, 5308416, 4293853184, 6815744, 4293459968, 5505024, 4291493888, 5242880,
-4292542464, 5373952, 4292411392, 5308416, 4292411392, 5242880, 4292542464, 5242880,
-4293328896, 5505024, 4291493888, 4980736, 327680, 7340032, 4293459968, 9961472,
-4294639616, 7340032, 4294639616, 6815744, 4293722112, 9568256, 4294770688, 9961472,
-327680, 6815744, 4293328896, 8519680, 4293328896, 7340032, 4293853184, 7340032,
-4294639616, 3801088, 327680, 3801088, 4294901760, 3801088, 65536, 3801088,
-327680, 4325376, 720896, 4325376, 720896, 4980736, 851968, 4980736,
-851968, 5242880, 327680, 5242880, 589824, 5242880, 458752, 5242880,
-327680, 5111808, 589824, 5111808, 589824, 4456448, 4294377472, 4456448,
-4294770688, 5111808, 4294770688, 5242880, 196608, 5242880, 196608, 5111808,
-4292411392, 6029312, 4292411392, 6160384, 4292280320, 6160384, 4292280320, 6029312,
-4294901760, 7471104, 65536, 7471104, 65536, 7602176, 4294901760, 7602176,
-4294639616, 7733248, 327680, 7733248, 327680, 8388608, 4294639616, 8388608,
-4294901760, 8781824, 65536, 8781824, 65536, 8912896, 4294901760, 8912896,
-4294770688, 8912896, 4294770688, 8781824, 4294639616, 8781824, 4294639616, 8912896,
-4294639616, 9043968, 4294770688, 9043968, 4294770688, 9175040, 4294639616, 9175040,
-4294770688, 9306112, 4294508544, 9306112, 65536, 9306112, 65536, 9961472,
-1769472, 9961472, 4293984256, 8912896, 4293591040, 8388608, 4293459968, 8388608,
-4293459968, 8257536, 4293591040, 8257536, 720896, 7340032, 851968, 7340032,
-851968, 7208960, 720896, 7208960, 1507328, 7340032, 1638400, 7340032,
-1638400, 7208960, 1507328, 7208960, 1638400, 6291456, 1769472, 6291456,
-1769472, 6160384, 1638400, 6160384, 1900544, 6029312, 1376256, 6029312,
-1900544, 5505024, 1376256, 5505024, 1638400, 5505024, 1507328, 5242880,
-1376256, 4849664, 1769472, 5505024, 720896, 5505024, 1769472, 6815744,
-4293591040, 5242880, 4293459968, 5242880, 4293591040, 4849664, 4293459968, 5308416,
-4293066752, 5308416, 4293066752, 5242880, 4292935680, 5242880, 4292935680, 5373952,
-2949120, 4294049792, 4292673536, 5505024, 4292804608, 5373952, 2818048, 4293918720,
-4292804608, 5505024, 4292673536, 5373952, 4292935680, 5505024, 4292935680, 6684672,
-4291624960, 6291456, 4291756032, 6684672, 4291887104, 6684672, 4291231744, 5505024,
-4291231744, 6684672, 4291624960, 6684672, 4292542464, 6684672, 4292542464, 5898240,
-4291231744, 5898240, 4291756032, 6553600, 4291887104, 6553600, 4291231744, 6291456,
-4292673536, 6684672, 4292673536, 6946816, 4292804608, 6946816, 4292804608, 6684672,
-4294770688, 7864320, 196608, 7864320, 196608, 8257536, 4294770688, 8257536,
-4294901760, 7864320, 4294901760, 8192000, 65536, 8192000, 65536, 7864320,
-196608, 9699328, 196608, 9568256, 327680, 9568256, 327680, 9699328,
-458752, 9699328, 458752, 9568256, 589824, 9568256, 589824, 9699328,
-1507328, 9961472, 1507328, 9830400, 1769472, 9830400, 1245184, 9961472,
-1245184, 9830400, 1376256, 9830400, 1376256, 9961472, 458752, 9175040,
-458752, 9043968, 589824, 9043968, 589824, 9175040, 720896, 9175040,
-720896, 9043968, 851968, 9043968, 851968, 9175040, 720896, 8912896,
-720896, 8781824, 851968, 8781824, 851968, 8912896, 983040, 8912896,
-983040, 8781824, 1114112, 8781824, 1114112, 8912896, 1245184, 9175040,
-1245184, 9043968, 1376256, 9043968, 1376256, 9175040, 1245184, 9306112,
-1376256, 9306112, 1376256, 9437184, 1245184, 9437184, 983040, 8388608,
-1114112, 8388608, 1114112, 8257536, 983040, 8257536, 983040, 8126464,
-983040, 7995392, 1114112, 7995392, 1114112, 8126464, 1245184, 8126464,
-1245184, 7995392, 1376256, 7995392, 1376256, 8126464, 1507328, 8388608,
-1507328, 8257536, 1638400, 8257536, 1638400, 8388608, 4294770688, 9568256,
-4294639616, 4294705152, 4294639616, 4294836224, 4294508544, 4294836224, 4294508544, 4294705152,
-327680, 4294836224, 327680, 4294705152, 458752, 4294705152, 458752, 4294836224,
-4294770688, 2097152, 4294770688, 1966080, 4292935680, 1966080, 4294508544, 1966080,
-4294246400, 1703936, 720896, 917504, 4294115328, 786432, 4294115328, 262144,
-4293722112, 262144, 4293722112, 786432, 1376256, 917504, 4293328896, 917504,
-65536, 2097152, 65536, 1835008, 327680, 1835008, 851968, 262144,
-1245184, 262144, 1245184, 786432, 1638400, 917504, 1638400, 1572864,
-2031616, 1966080, 2031616, 2883584, 2949120, 1966080, 4292935680, 2883584,
-4292018176, 1966080, 4292018176, 4294049792, 4292149248, 4293918720, 4292542464, 5308416,
-4292935680, 5308416, 4294574080, 2097152, 4294574080, 1966080, 4294639616, 2097152,
-4294639616, 1966080, 4294705152, 2097152, 4294705152, 1966080, 4294443008, 393216,
-4294443008, 262144, 4294508544, 393216, 4294508544, 262144, 4294574080, 393216,
-4294574080, 262144, 393216, 393216, 393216, 262144, 458752, 393216,
-458752, 262144, 524288, 393216, 524288, 262144, 1507328, 5373952,
-1900544, 5373952, 1638400, 5373952, 1769472, 5373952, 1900544, 5242880,
-2031616, 5242880, 2031616, 5308416, 2424832, 5308416, 2424832, 5242880,
-2555904, 5242880, 2555904, 5373952, 2949120, 5373952, 2949120, 5242880,
-3080192, 4849664, 3080192, 5242880, 3473408, 5242880, 1376256, 5242880,
-983040, 5242880, 983040, 4980736, 1114112, 4980736, 1114112, 4718592,
-3342336, 4718592, 3342336, 4980736, 3473408, 4980736, 4294901760, 4980736,
-4294901760, 4849664, 65536, 4849664, 65536, 4980736, 4291887104, 5898240,
-4292542464, 6160384, 4292411392, 5898240, 458752, 6160384, 4294770688, 6553600,
-4294508544, 6422528, 4293459968, 6422528, 4293328896, 6160384, 4293591040, 6029312,
-589824, 6553600, 720896, 6553600, 1769472, 6029312, 1900544, 6291456,
-4293984256, 6815744, 4294639616, 7208960, 327680, 7208960, 851968, 6815744,
-1638400, 6815744, 1769472, 7340032, 4293591040, 7340032, 4293459968, 7340032,
-4293328896, 8388608, 327680, 7864320, 4294639616, 7864320, 196608, 8388608,
-4294639616, 8257536, 196608, 9961472, 458752, 9961472, 4293722112, 9961472,
-4294246400, 8912896, 4294508544, 9043968, 4294508544, 9175040, 1638400, 9830400,
-1769472, 8257536, 4294377472, 917504, 4294115328, 917504, 4293722112, 917504,
-4292018176, 262144, 4292018176, 917504, 458752, 4293918720, 4294770688, 4293918720,
-4294639616, 4293918720, 4294508544, 4293918720, 4294770688, 4294836224, 589824, 917504,
-851968, 917504, 1245184, 917504, 2949120, 917504, 2949120, 262144,
-4294639616, 1572864, 4293459968, 917504, 4294377472, 3276800, 4294377472, 3407872,
-4294639616, 3538944, 4294377472, 2752512, 65536, 1572864, 4294705152, 1835008,
-4294770688, 1835008, 196608, 1703936, 1507328, 917504, 327680, 3538944,
-458752, 3538944, 196608, 3276800, 196608, 2752512, 327680, 2097152,
-4291887104, 4718592, 4291624960, 5242880, 4293591040, 4718592, 4293591040, 4980736,
-589824, 4980736, 4294377472, 4980736, 589824, 4849664, 4294901760, 4456448,
-4294246400, 4456448, 589824, 4325376, 4294115328, 5111808, 720896, 5242880,
-3080192, 4718592, 1376256, 4718592, 3342336, 5242880, 1376256, 4980736};
+extern const uint32_t mercury_WADVertices[520] = {
+33619040, 33618976, 71367776, 33618912, 71367648, 71367712, 79756256, 79756320,
+33618208, 46201120, 46201760, 58784032, 58784224, 46201440, 67172896, 67172960,
+71367200, 71367264, 71367136, 71366944, 71367584, 54590304, 54590240, 54590368,
+50395936, 50396000, 46201696, 27327328, 25230176, 25229984, 27327136, 25230240,
+27327392, 27327584, 25230432, 29424736, 29424672, 29424544, 29424608, 54526112,
+54591456, 67109152, 54526240, 67174368, 67108896, 67108960, 33554592, 33554720,
+50331936, 50397024, 67174240, 33619936, 33619808, 33619488, 33619424, 33619232,
+50396448, 33619360, 33619296, 50396704, 33619744, 33619680, 50396896, 67173792,
+62979488, 62979360, 67173664, 67173728, 62979936, 54590816, 58785120, 54590880,
+58785184, 62979424, 54590752, 50396576, 25231136, 25231200, 27327840, 25230688,
+27327648, 25230496, 25230816, 25230752, 33555424, 33555360, 50332640, 33555296,
+33555168, 50332384, 33554784, 33554848, 50332064, 25166176, 25166112, 25166624,
+29360928, 29360992, 29361056, 29361120, 25166816, 25166880, 27264032, 27264224,
+25167072, 25167136, 29361440, 29361632, 25167328, 67109216, 58720608, 54526304,
+54526368, 58720672, 67109280, 58721120, 54526816, 58721184, 54526880, 50332576,
+58721248, 67109856, 75562272, 92339488, 75562336, 75562400, 75562528, 92339744,
+92339808, 88145504, 75562592, 88145568, 92339872, 92340128, 88145824, 75562912,
+88080608, 92274912, 92275104, 88080800, 92275168, 88080864, 75497696, 75497952,
+92275488, 92275552, 88081248, 88081184, 75498336, 75498400, 92275616, 75497504,
+75497568, 104857824, 125829344, 125829664, 121635360, 117441056, 113246752, 121635424,
+125829728, 117441120, 113246816, 117441184, 113246880, 125893984, 125894048, 121699680,
+121699744, 92339616, 92339552, 125893920, 125894560, 104923040, 130088416, 130088544,
+130088672, 130088288, 130088224, 109052128, 109117344, 109117408, 109051936, 109052000,
+109052064, 125829280, 121700256, 121634976, 121700320, 119537696, 119537760, 96469088,
+100663392, 96469024, 100663328, 138412128, 142606432, 142606752, 138412448, 138412512,
+142606816, 142606880, 138412576, 138412640, 142606944, 150995232, 146800928, 146800992,
+150995296, 150995360, 146801056, 146801120, 150995424, 150995616, 146801312, 176160864,
+176160928, 155189344, 167772320, 163578016, 176161056, 167772384, 163578080, 167772448,
+163578144, 176161440, 167772512, 171967136, 163578208, 159384224, 155189920, 138412064,
+142606368, 138477536, 142671840, 146866144, 151060448, 155254752, 163643360, 176226272,
+176225632, 163642848, 176225760, 142671776, 138477472, 138477408, 142671712, 142671584,
+138477280, 142671456, 151060384, 146866080, 146866016, 151060320, 155254624, 121635616,
+125829920, 121635680, 125829984, 171967264, 171967328, 171967392, 121635744, 176161568,
+176161696, 171967200, 176161504, 146801376, 150995680, 155189984, 159384288, 113246944,
+117441248, 4160814944, 4165009248, 4165009280, 4160814976, 4160815008, 4165009312, 4164944096,
+4164944128, 4160749792, 4160749824, 4164944160, 4160749856, 4160815072, 4160749728, 4169138336,
+4169203680, 4173332704, 4181721184, 4173397920, 4181721120, 4181786592, 4173397856, 4169203552,
+4181786464, 4181721248, 4173332768, 4169138464, 4181721376, 4160814880, 4165009184, 4165009216,
+4160814912, 4181786400, 4181786336, 4160814752, 4177591968, 4181786272, 4177591776, 4181786016,
+4181786080, 4160814560, 4181785888, 4160813728, 4181785248, 4143972576, 4148166880, 4143972640,
+4148166944, 4135583904, 4135649248, 4118806816, 4118872032, 4148232096, 4144037792, 4148232032,
+4144037728, 4118871968, 4118871904, 4148232160, 4123064992, 4118870752, 4164944192, 4160749888,
+4160749920, 4164944224, 4181721440, 4160750048, 4181721504, 4177527264, 4181721568, 4181721760,
+4160750240, 4177527456, 4181721824, 4181721952, 4181722592, 4160751072, 4118807968, 4123002336,
+4194304096, 4194304160, 4185915488, 4185915680, 4190109728, 4202692640, 4185980768, 4202757984,
+4202758048, 4185980832, 4190175136, 4202758112, 4206952416, 4206952352, 4211146656, 4244700256,
+4215340128, 4215339680, 4244700576, 4219535136, 4215340896, 4206952160, 4202757408, 4181785952,
+4219469984, 4219469920, 4219535328, 4265672672, 4219469856, 4265607328, 4265607200, 4265607264,
+4261478240, 4261478304, 4257283936, 4257284000, 4257283872, 4261478176, 4265672480, 4265672608,
+4240506720, 4244701024, 4240506784, 4244701088, 4240506656, 4227923808, 4227923872, 4223729504,
+4223729568, 4219535232, 4219535200, 4219535264, 4219535296, 4215340928, 4215340960, 4198498464,
+4202692768, 4206887008, 4211081312, 4202692704, 4211081376, 4211081248, 4215340992, 4211146688,
+4211146720, 4215341024, 4198498592, 4202692896, 4206887136, 4206887072, 4211081440, 4215275808,
+4206887328, 4181721888, 4244636384, 4244636704, 4219470176, 4215276576, 4202693472, 4215277024,
+4257218784, 4261413088, 4257218848, 4261413152, 4265607392, 4265607456, 4257218720, 4240441568,
+4244635872, 4240441632, 4244635936, 4240441504, 4223664352, 4227858656, 4223664416, 4227858720,
+4219470112, 4219470048, 4265607520, 25229920, 12647008, 8452704, 8452576, 16841184,
+25229792, 16841120, 25229728, 12647840, 8453536, 25230944, 16842336, 16842272,
+16842144, 8453664, 21036960, 21037024, 20971744, 20971872, 16777568, 16842528,
+21036832, 20971680, 16777312, 16777248, 12583264, 352, 32, 12582944,
+12583008, 65312, 65248, 16842464, 4290838240, 4290838432, 4290773344, 4290773216,
+16842400, 21036704, 25231008, 25231264, 25166048, 25231328, 25165984, 4290773408,
+16777632, 25166240, 16777696, 25166304, 4274061216, 4273995808, 4273995872, 4273996000,
+12583648, 12584480, 8390176, 8389344, 25167392, 25166560, 8390304, 16778912,
+25167520, 16778976, 25167584, 16777952, 25166368, 16777760, 16777824, 8389216};
 extern const uint32_t mercury_WADLineDefs[1782] = {
-589834, 4, 0, 524289, 262144, 0, 196610, 26869784,
-4, 262144, 1441797, 262549, 0, 458758, 2687009, 4,
-524288, 1507337, 262168, 0, 720906, 1769500, 4, 786432,
-13, 262145, 0, 983054, 26476545, 4, 1048576, 720913,
-262154, 0, 1245202, 1441803, 4, 1310720, 3145749, 65586,
-0, 4294901782, 65539, 4, 1507328, 589848, 262152, 0,
-1703961, 786445, 4, 1769472, 917532, 262157, 0, 1966109,
-917589, 4, 2031616, 3276832, 65565, 0, 4294901793, 2752529,
-4, 2228224, 786467, 262161, 0, 2424868, 2162720, 4,
-2490368, 2031655, 262176, 0, 2687016, 2031646, 4, 2752512,
-2621483, 262174, 0, 2949164, 5701672, 4, 3014656, 2687023,
-262184, 0, 3211312, 1703963, 4, 3276800, 1703987, 262513,
-0, 3473460, 1573243, 4, 3538944, 196663, 262166, 0,
-3735608, 1441813, 4, 3801088, 1048635, 262163, 0, 3997756,
-2752537, 4, 4063232, 1638463, 262163, 0, 4259904, 1310806,
-4, 4325376, 1310787, 262165, 0, 4522052, 131155, 4,
-4587520, 5767239, 262181, 0, 4784200, 24707106, 4, 4849664,
-2293835, 262178, 0, 5046348, 2293796, 4, 5111808, 2424911,
-262180, 0, 5308496, 24641551, 4, 5373952, 2752595, 262229,
-0, 5570644, 1638405, 4, 5636096, 262231, 262149, 0,
-5832792, 262147, 4, 5898240, 131163, 262543, 0, 6094940,
-3014701, 4, 6160384, 2490463, 262189, 0, 6357088, 2490405,
-4, 6422528, 3014755, 262195, 0, 6619236, 5308780, 4,
-6684672, 2818151, 262185, 0, 6881384, 24707118, 4, 6946816,
-3342443, 262508, 0, 7143532, 24641587, 4, 7208960, 2883695,
-262187, 0, 7405680, 983088, 4, 7471104, 5308531, 65614,
-0, 4294901876, 3473462, 4, 7667712, 3604598, 262198, 0,
-7864439, 3604536, 4, 7929856, 3473530, 262200, 0, 8126587,
-3735610, 4, 8192000, 3866750, 262202, 0, 8388735, 3866684,
-4, 8454144, 3735682, 262204, 0, 8650883, 3997758, 4,
-8716288, 4128902, 262206, 0, 8913031, 4128832, 4, 8978432,
-3997834, 262208, 0, 9175179, 4259906, 4, 9240576, 4391054,
-262210, 0, 9437327, 4390980, 4, 9502720, 4259986, 262212,
-0, 9699475, 4522054, 4, 9764864, 4653206, 262214, 0,
-9961623, 4653128, 4, 10027008, 4522138, 262216, 0, 10223771,
-4784202, 4, 10289152, 4915358, 262218, 0, 10485919, 4915276,
-4, 10551296, 4784290, 262220, 0, 10748067, 12189774, 1,
-10813440, 5177343, 262223, 0, 10944678, 5177531, 1, 11010048,
-5111807, 262406, 0, 11141289, 3145807, 1, 11206656, 5439487,
-65617, 0, 4294901932, 5374001, 1, 11337728, 23920639, 262541,
-0, 11468974, 1180017, 4, 11534336, 5439665, 262515, 0,
-11731122, 3211311, 4, 11796480, 24051893, 262191, 0, 11993270,
-5636181, 4, 12058624, 1245369, 262232, 0, 12255418, 5767257,
-4, 12320768, 5898429, 262233, 0, 12517566, 5898331, 4,
-12582912, 6029505, 262235, 0, 12779714, 6029405, 4, 12845056,
-3408069, 262237, 0, 13041862, 983068, 4, 13107200, 1179849,
-262523, 0, 13304010, 1835037, 4, 13369344, 9175245, 262221,
-0, 13566158, 13107310, 1, 13631488, 6291455, 262404, 0,
-13762769, 6160479, 1, 13828096, 6225919, 65634, 0, 4294901972,
-6488162, 1, 13959168, 6553599, 65636, 0, 4294901974, 6619236,
-1, 14090240, 6684671, 65616, 0, 4294901976, 6750310, 1,
-14221312, 6422527, 65638, 0, 4294901978, 6357088, 1, 14352384,
-6815743, 65642, 0, 4294901980, 7602280, 1, 14483456, 7143423,
-65647, 0, 4294901982, 6881397, 1, 14614528, 7012351, 65640,
-0, 4294901984, 11337808, 1, 14745600, 8126463, 65730, 0,
-4294901986, 7274610, 4, 14876672, 12779748, 65658, 0, 4294901989,
-6291640, 1, 15073280, 11403263, 65703, 0, 4294901991, 9109620,
-1, 15204352, 7667711, 262261, 0, 15335657, 7667827, 1,
-15400960, 7798783, 65651, 0, 4294901996, 7733367, 1, 15532032,
-7929855, 65655, 0, 4294901998, 7864442, 1, 15663104, 8060927,
-262267, 0, 15794416, 8061186, 1, 15859712, 8257535, 65786,
-0, 4294902003, 8192124, 1, 15990784, 8191999, 262265, 0,
-16122101, 8257647, 1, 16187392, 9109503, 262258, 0, 16318712,
-8650878, 1, 16384000, 8388607, 65664, 0, 4294902011, 8454277,
-1, 16515072, 8323071, 262273, 0, 16646397, 8126593, 1,
-16711680, 8716287, 65713, 0, 4294902016, 8716420, 4, 16842752,
-11796738, 65669, 0, 4294902019, 8585364, 4, 17039360, 8585477,
-262272, 0, 17236230, 8781959, 4, 17301504, 8913161, 262279,
-0, 17498378, 8913033, 4, 17563648, 8782093, 262281, 0,
-17760526, 7012460, 4, 17825792, 9240849, 65697, 0, 4294902034,
-9633964, 1, 18022400, 7077887, 262296, 0, 18153748, 9306255,
-4, 18219008, 9437463, 262287, 0, 18415896, 9437329, 4,
-18481152, 9306395, 262289, 0, 18678044, 9240715, 1, 18743296,
-9175039, 262282, 0, 18874655, 9896085, 1, 18939904, 10027007,
-65685, 0, 4294902050, 10158231, 1, 19070976, 9961471, 262252,
-0, 19202340, 7078044, 1, 19267584, 10092543, 65718, 0,
-4294902055, 10027163, 1, 19398656, 10223615, 262300, 0, 19530025,
-10223781, 1, 19595264, 8388607, 262274, 0, 19726636, 8519861,
-1, 19791872, 10420223, 262301, 0, 19923247, 10354847, 4,
-19988480, 10486066, 262303, 0, 20185395, 10485917, 4, 20250624,
-10551606, 262306, 0, 20447543, 10617092, 1, 20512768, 17235967,
-262404, 0, 20644154, 6226081, 1, 20709376, 10682367, 65702,
-0, 4294902077, 9175207, 1, 20840448, 11206655, 65707, 0,
-4294902079, 11141289, 1, 20971520, 8585215, 65711, 0, 4294902081,
-9961619, 1, 21102592, 9699327, 262290, 0, 21233987, 9240722,
-4, 21299200, 9175366, 65699, 0, 4294902087, 10748067, 1,
-21495808, 15204351, 65847, 0, 4294902089, 8323250, 1, 21626880,
-23330815, 65714, 0, 4294902091, 23265508, 1, 21757952, 11993087,
-65717, 0, 4294902093, 11993270, 4, 21889024, 11993423, 262309,
-0, 22085968, 10813617, 1, 22151168, 11665407, 262320, 0,
-22282579, 11403440, 4, 22347776, 11403606, 262324, 0, 22544727,
-11272358, 1, 22609920, 17039359, 65716, 0, 4294902106, 16974134,
-1, 22740992, 12255231, 65720, 0, 4294902108, 12255418, 4,
-22872064, 12124510, 65723, 0, 4294902111, 12124348, 1, 23068672,
-12451839, 65724, 0, 4294902113, 12386494, 1, 23199744, 12582911,
-65726, 0, 4294902115, 12517568, 1, 23330816, 12779519, 65728,
-0, 4294902117, 12779714, 4, 23461888, 12648807, 65731, 0,
-4294902120, 12648644, 1, 23658496, 12910591, 262341, 0, 23789930,
-12976325, 4, 23855104, 12976493, 262343, 0, 24052078, 7405767,
-4, 24117248, 7405937, 262254, 0, 24314226, 7209069, 1,
-24379392, 6946815, 65645, 0, 4294902133, 6815849, 4, 24510464,
-13107575, 65737, 0, 4294902136, 13238473, 1, 24707072, 13303807,
-65739, 0, 4294902138, 13304008, 4, 24838144, 13304188, 65732,
-0, 4294902141, 13369549, 4, 25034752, 13500799, 262349, 0,
-25231744, 13500623, 4, 25296896, 13369731, 262351, 0, 25493892,
-13631697, 4, 25559040, 13762951, 262353, 0, 25756040, 13762771,
-4, 25821184, 13631883, 262355, 0, 26018188, 13893845, 4,
-26083328, 14025103, 262357, 0, 26280336, 14024919, 4, 26345472,
-13894035, 262359, 0, 26542484, 14155993, 4, 26607616, 14287255,
-262361, 0, 26804632, 14287067, 4, 26869760, 14156187, 262363,
-0, 27066780, 14483676, 4, 27131904, 14483871, 262366, 0,
-27328928, 14614750, 4, 27394048, 14614947, 262364, 0, 27591076,
-14680289, 4, 27656192, 14811559, 262369, 0, 27853224, 14811363,
-4, 27918336, 14680491, 262371, 0, 28115372, 15007894, 1,
-28180480, 15073279, 65764, 0, 4294902191, 14942438, 4, 28311552,
-15139249, 262374, 0, 28508594, 15270016, 1, 28573696, 15335423,
-65686, 0, 4294902197, 15335659, 4, 28704768, 15466935, 262379,
-0, 28901816, 15466733, 4, 28966912, 15335867, 262381, 0,
-29163964, 15663342, 4, 29229056, 15663551, 262384, 0, 29426112,
-15794416, 4, 29491200, 15794627, 262382, 0, 29688260, 15925490,
-4, 29753344, 15925703, 262388, 0, 29950408, 16056564, 4,
-30015488, 16056779, 262386, 0, 30212556, 16187638, 4, 30277632,
-16187855, 262392, 0, 30474704, 16318712, 4, 30539776, 16318931,
-262390, 0, 30736852, 16908400, 4, 30801920, 16515543, 65793,
-0, 4294902232, 16515322, 1, 30998528, 7995391, 262256, 0,
-31130074, 16646557, 1, 31195136, 16777215, 65947, 0, 4294902237,
-16580862, 1, 31326208, 16908287, 65950, 0, 4294902239, 16646401,
-4, 31457280, 16581089, 65794, 0, 4294902242, 16449789, 4,
-31653888, 16450020, 262394, 0, 31850981, 10092694, 4, 31916032,
-10093032, 262292, 0, 32113129, 11731119, 1, 32178176, 17170431,
-65796, 0, 4294902252, 11075748, 1, 32309248, 17301503, 65797,
-0, 4294902254, 17236232, 1, 32440320, 17432575, 65800, 0,
-4294902256, 17367306, 1, 32571392, 17563647, 65928, 0, 4294902258,
-17498382, 1, 32702464, 25100287, 262518, 0, 32834036, 17694992,
-1, 32899072, 18022399, 65808, 0, 4294902263, 17891496, 1,
-33030144, 11272191, 65927, 0, 4294902265, 17629457, 1, 33161216,
-25165823, 262526, 0, 33292795, 17891598, 4, 33357824, 18022910,
-65810, 0, 4294902271, 18874650, 1, 33554432, 18481151, 262420,
-0, 33686017, 18809108, 4, 33751040, 18285060, 65820, 0,
-4294902277, 18284813, 1, 33947648, 17694719, 262416, 0, 34079239,
-18350367, 1, 34144256, 18284543, 65818, 0, 4294902282, 18219285,
-1, 34275328, 18415615, 65817, 0, 4294902284, 18153757, 4,
-34406400, 18743822, 262429, 0, 34603535, 18743574, 4, 34668544,
-18416146, 65813, 0, 4294902291, 18940192, 1, 34865152, 19005439,
-65826, 0, 4294902293, 19071266, 1, 34996224, 18939903, 262435,
-0, 35127831, 18022691, 1, 35192832, 18677759, 65823, 0,
-4294902298, 18546972, 4, 35323904, 18547228, 262426, 0, 35521053,
-19398948, 1, 35586048, 19267583, 65830, 0, 4294902304, 19333414,
-1, 35717120, 19398655, 65828, 0, 4294902306, 19464488, 1,
-35848192, 19529727, 65834, 0, 4294902308, 19595562, 1, 35979264,
-19464191, 262443, 0, 36110886, 19202347, 1, 36175872, 19726335,
-262445, 0, 36307497, 19792173, 4, 36372480, 19792428, 262447,
-0, 36569645, 19661103, 4, 36634624, 19923504, 262449, 0,
-36831793, 20054321, 4, 36896768, 20054580, 262451, 0, 37093941,
-19923251, 4, 37158912, 20185656, 262453, 0, 37356089, 20316469,
-4, 37421056, 15204924, 65846, 0, 4294902333, 15204660, 1,
-37617664, 20447231, 262456, 0, 37749311, 20513080, 4, 37814272,
-20513346, 262458, 0, 38011459, 20578615, 1, 38076416, 20643839,
-65844, 0, 4294902342, 20709691, 4, 38207488, 20709960, 262461,
-0, 38404681, 20840765, 4, 38469632, 20841036, 262459, 0,
-38666829, 20971839, 4, 38731776, 20972112, 262465, 0, 38928977,
-21102913, 4, 38993920, 21103188, 262463, 0, 39191125, 21233987,
-4, 39256064, 21234264, 262469, 0, 39453273, 21365061, 4,
-39518208, 21365340, 262467, 0, 39715421, 21496135, 4, 39780352,
-21496416, 262473, 0, 39977569, 21627209, 4, 40042496, 21627492,
-262471, 0, 40239717, 21758283, 4, 40304640, 21758568, 262477,
-0, 40501865, 21889357, 4, 40566784, 21889644, 262475, 0,
-40764013, 22020431, 4, 40828928, 22020720, 262481, 0, 41026161,
-22151505, 4, 41091072, 22151796, 262479, 0, 41288309, 22282579,
-4, 41353216, 22282872, 262485, 0, 41550457, 22413653, 4,
-41615360, 22413948, 262483, 0, 41812605, 22544727, 4, 41877504,
-22545024, 262489, 0, 42074753, 22675801, 4, 42139648, 22676100,
-262487, 0, 42336901, 22806875, 4, 42401792, 22807176, 262493,
-0, 42599049, 22937949, 4, 42663936, 22938252, 262491, 0,
-42861197, 23069023, 4, 42926080, 23069328, 262497, 0, 43123345,
-23200097, 4, 43188224, 23200404, 262495, 0, 43385493, 11731299,
-4, 43450368, 11731608, 65767, 0, 4294902425, 23331173, 4,
-43646976, 23462555, 262501, 0, 43844252, 23462247, 4, 43909120,
-23331487, 262503, 0, 44106400, 23593321, 4, 44171264, 23724707,
-262505, 0, 44368548, 23724395, 4, 44433408, 23593639, 262507,
-0, 44630696, 23921004, 4, 44695552, 23921323, 262542, 0,
-44892844, 3211348, 1, 44957696, 25427967, 65620, 0, 4294902447,
-24117615, 4, 45088768, 24117937, 262160, 0, 45286066, 1048946,
-4, 45350912, 24314549, 262514, 0, 45548214, 24379763, 4,
-45613056, 24380089, 262517, 0, 45810362, 393589, 4, 45875200,
-5702333, 262230, 0, 46072510, 24182871, 4, 46137344, 23986881,
-262531, 0, 46334658, 24183158, 4, 46399488, 24642245, 262521,
-0, 46596806, 3408249, 4, 46661632, 3408585, 262522, 0,
-46858954, 2883962, 4, 46923776, 24904397, 262523, 0, 47121102,
-24904061, 4, 47185920, 24511185, 262525, 0, 47383250, 23986183,
-4, 47448064, 1049301, 262150, 0, 47645398, 24576006, 4,
-47710208, 24576729, 262151, 0, 47907546, 25231399, 1, 47972352,
-1966079, 65575, 0, 4294902493, 25362820, 1, 48103424, 25559039,
-65924, 0, 4294902495, 25493894, 1, 48234496, 17825791, 65926,
-0, 4294902497, 17760524, 1, 48365568, 25362431, 65804, 0,
-4294902499, 25297281, 1, 48496640, 25296895, 262528, 0, 48628453,
-25100672, 4, 48693248, 25625320, 262536, 0, 48890601, 17432968,
-1, 48955392, 25690111, 65704, 0, 4294902508, 25821577, 4,
-49086464, 25756398, 262191, 0, 49283823, 24052106, 4, 49348608,
-25887474, 262540, 0, 49545971, 25756043, 4, 49610752, 25953014,
-262538, 0, 49808119, 26083725, 4, 49872896, 26018554, 262539,
-0, 50070267, 25952654, 4, 50135040, 26149630, 262544, 0,
-50332415, 5439888, 4, 50397184, 26149634, 262545, 0, 50594563,
-26345873, 4, 50659328, 26346246, 262544, 0, 50856711, 26411409,
-4, 50921472, 26411786, 262548, 0, 51118859, 26345876, 4,
-51183616, 26411790, 262147, 0, 51381007, 26608021, 4, 51445760,
-26608402, 262155, 0, 51643155, 26673557, 4, 51707904, 26673942,
-262552, 0, 51905303, 26608024, 4, 51970048, 26673946, 262553,
-0, 52167451, 26870169, 4, 52232192, 26870558, 262552, 0,
-52429599, 1507737, 4, 52494336, 26936098, 65949, 0, 4294902563,
-27066782, 4, 52690944, 27132709, 65948, 0, 4294902566, 27197852,
-1, 52887552, 27262975, 65952, 0, 4294902568, 27328928, 1,
-53018624, 27394047, 65954, 0, 4294902570, 27460002, 1, 53149696,
-27525119, 65956, 0, 4294902572, 27591076, 1, 53280768, 27656191,
-65958, 0, 4294902574, 27722150, 1, 53411840, 27787263, 65961,
-0, 4294902576, 27984128, 4, 53542912, 27788082, 262400, 0,
-53740339, 27787689, 4, 53805056, 27984694, 65791, 0, 4294902583,
-27984300, 1, 54001664, 28180479, 65964, 0, 4294902585, 28115374,
-1, 54132736, 28311551, 65966, 0, 4294902587, 28246448, 1,
-54263808, 28442623, 65968, 0, 4294902589, 28377522, 1, 54394880,
-27983871, 65970, 0, 4294902591, 27918761, 1, 54525952, 28573695,
-262580, 0, 54657857, 28639668, 4, 54722560, 28640068, 262582,
-0, 54920005, 28508598, 4, 54984704, 840};
-extern const uint32_t mercury_WADSideDefs[6308] = {
-0, 45, 0, 45, 0, 45, 0, 2,
-2949120, 0, 2949120, 0, 2949120, 0, 5636096, 0,
-45, 0, 45, 0, 45, 0, 2, 2949120,
-0, 2949120, 0, 2949120, 0, 5636096, 0, 45,
-0, 45, 0, 45, 0, 6291456, 2949120, 0,
-2949120, 0, 2949120, 0, 5636096, 0, 45, 0,
-1380929348, 51, 45, 0, 6291552, 2949120, 0, 2949120,
-0, 2949120, 0, 5570560, 0, 45, 0, 1464357697,
-5000257, 45, 0, 5, 2949120, 0, 2949120, 0,
-2949120, 0, 1245184, 0, 45, 0, 45, 0,
-45, 0, 0, 2949120, 0, 2949120, 0, 2949120,
-0, 5570560, 0, 45, 0, 1380929348, 51, 45,
-0, 82, 2949120, 0, 2949120, 0, 2949120, 0,
-5439488, 0, 45, 0, 45, 0, 45, 0,
-2, 2949120, 0, 2949120, 0, 2949120, 0, 5636096,
-0, 45, 0, 45, 0, 45, 0, 6291457,
-2949120, 0, 1329856512, 3363407, 2949120, 0, 5636096, 0,
-45, 0, 45, 0, 45, 0, 2, 2949120,
-0, 2949120, 0, 2949120, 0, 5636096, 0, 45,
-0, 45, 0, 45, 0, 96, 2949120, 0,
-2949120, 0, 2949120, 0, 131072, 0, 45, 0,
-45, 0, 1380929348, 51, 18, 2949120, 0, 2949120,
-0, 2949120, 0, 65536, 0, 45, 0, 45,
-0, 45, 0, 2, 2949120, 0, 2949120, 0,
-2949120, 0, 131072, 0, 45, 0, 45, 0,
-45, 0, 86, 2949120, 0, 1397161984, 1162760020, 2949169,
-0, 196608, 0, 45, 0, 45, 0, 45,
-0, 4, 2949120, 0, 1397161984, 1162760020, 2949169, 0,
-196608, 0, 45, 0, 45, 0, 45, 0,
-4, 2949120, 0, 1397161984, 1162760020, 2949169, 0, 196608,
-0, 45, 0, 45, 0, 45, 0, 4,
-2949120, 0, 2949120, 0, 1329856512, 3363407, 1179648, 0,
-45, 0, 1330926407, 3229006, 45, 0, 3, 2949120,
-0, 2949120, 0, 2949120, 0, 262144, 0, 45,
-0, 1330926407, 3229006, 45, 0, 3, 2949120, 0,
-2949120, 0, 2949120, 0, 262144, 0, 45, 0,
-1464357697, 5000257, 45, 0, 5, 2949120, 0, 2949120,
-0, 2949120, 0, 1245184, 0, 45, 0, 1464357697,
-5000257, 45, 0, 5, 2949120, 0, 2949120, 0,
-2949120, 0, 1245184, 0, 45, 0, 1464357697, 5000257,
-45, 0, 5, 2949120, 0, 2949120, 0, 2949120,
-0, 1245184, 0, 45, 0, 1464357697, 5000257, 45,
-0, 5, 2949120, 0, 2949120, 0, 2949120, 0,
-1245184, 0, 45, 0, 1380929348, 51, 45, 0,
-19, 2949120, 0, 2949120, 0, 2949120, 0, 5373952,
-0, 45, 0, 1380929348, 51, 45, 0, 5,
-2949120, 0, 2949120, 0, 2949120, 0, 5373952, 0,
-45, 0, 1380929348, 51, 45, 0, 82, 2949120,
-0, 2949120, 0, 2949120, 0, 5439488, 0, 45,
-0, 1380929348, 51, 45, 0, 82, 2949120, 0,
-2949120, 0, 2949120, 0, 5439488, 0, 45, 0,
-45, 0, 45, 0, 85, 2949120, 0, 2949120,
-0, 2949120, 0, 5636096, 64, 45, 0, 1330926407,
-3229006, 45, 0, 2, 2949120, 0, 2949120, 0,
-2949120, 0, 262144, 0, 45, 0, 1380929348, 51,
-45, 0, 4, 2949120, 0, 2949120, 0, 2949120,
-0, 5570560, 0, 45, 0, 1380929348, 51, 45,
-0, 84, 2949120, 0, 2949120, 0, 2949120, 0,
-5308416, 0, 45, 0, 1380929348, 51, 45, 0,
-4, 2949120, 0, 2949120, 0, 2949120, 0, 1245184,
-0, 45, 0, 45, 0, 45, 0, 19,
-2949120, 0, 2949120, 0, 2949120, 0, 5505024, 0,
-45, 0, 1380929348, 51, 45, 0, 4, 2949120,
-0, 2949120, 0, 2949120, 0, 5570560, 0, 45,
-0, 1380929348, 51, 45, 0, 4, 2949120, 0,
-2949120, 0, 2949120, 0, 5570560, 0, 45, 0,
-1380929348, 51, 45, 0, 93, 2949120, 0, 2949120,
-0, 2949120, 0, 5505024, 0, 45, 0, 1380929348,
-51, 45, 0, 6, 1329856512, 3363407, 2949120, 0,
-2949120, 0, 5308416, 0, 45, 0, 1464357697, 5000257,
-45, 0, 6, 2949120, 0, 2949120, 0, 2949120,
-0, 458752, 0, 45, 0, 1464357697, 5000257, 45,
-0, 6, 2949120, 0, 2949120, 0, 2949120, 0,
-458752, 0, 45, 0, 1464357697, 5000257, 45, 0,
-6, 2949120, 0, 2949120, 0, 2949120, 0, 458752,
-0, 45, 0, 1464357697, 5000257, 45, 0, 6,
-2949120, 0, 2949120, 0, 2949120, 0, 458752, 0,
-45, 0, 1380929348, 51, 45, 0, 9, 1329856512,
-3363407, 2949120, 0, 2949120, 0, 5373952, 0, 45,
-0, 1380929348, 51, 45, 0, 3, 2949120, 0,
-2949120, 0, 2949120, 0, 1245184, 0, 45, 0,
-1380929348, 51, 45, 0, 4, 2949120, 0, 2949120,
-0, 2949120, 0, 5505024, 0, 45, 0, 1380929348,
-51, 45, 0, 4, 2949120, 0, 2949120, 0,
-2949120, 0, 5505024, 0, 45, 0, 1380929348, 51,
-45, 0, 4, 2949120, 0, 2949120, 0, 2949120,
-0, 5505024, 0, 45, 0, 1380929348, 51, 45,
-0, 6291549, 2949120, 0, 2949120, 0, 2949120, 0,
-5505024, 0, 45, 0, 1380929348, 51, 45, 0,
-7, 2949120, 0, 1329856512, 3363407, 2949120, 0, 5308416,
-0, 45, 0, 1380929348, 51, 45, 0, 7,
-2949120, 0, 1329856512, 3363407, 2949120, 0, 5308416, 0,
-45, 0, 1380929348, 51, 45, 0, 7, 2949120,
-0, 1329856512, 3363407, 2949120, 0, 5308416, 0, 45,
-0, 1380929348, 51, 45, 0, 8, 1329856512, 3363407,
-1329856512, 3363407, 2949120, 0, 5308416, 0, 45, 0,
-45, 0, 45, 0, 9, 2949120, 0, 2949120,
-0, 2949120, 0, 1114112, 0, 45, 0, 1380929348,
-51, 45, 0, 19, 2949120, 0, 2949120, 0,
-2949120, 0, 5373952, 524416, 1380929348, 51, 45, 0,
-45, 0, 7, 2949136, 0, 2949120, 0, 2949120,
-0, 524288, 0, 45, 0, 1380929348, 51, 45,
-0, 9, 1329856512, 3363407, 1329856512, 3363407, 2949120, 0,
-5308416, 0, 45, 0, 45, 0, 45, 0,
-8, 1329856520, 3363407, 2949120, 0, 2949120, 0, 589824,
-0, 45, 0, 1380929348, 51, 45, 0, 19,
-2949120, 0, 2949120, 0, 2949120, 0, 5373952, 0,
-45, 0, 45, 0, 45, 0, 9, 2949120,
-0, 2949120, 0, 2949120, 0, 1179648, 0, 45,
-0, 45, 0, 1380929348, 51, 9, 2949120, 0,
-2949120, 0, 2949120, 0, 655360, 0, 45, 0,
-1112686925, 3229004, 45, 0, 18, 2949120, 0, 2949120,
-0, 2949120, 0, 655360, 0, 45, 0, 1112686925,
-3229004, 45, 0, 18, 2949120, 0, 2949120, 0,
-2949120, 0, 655360, 0, 45, 0, 45, 0,
-45, 0, 18, 2949120, 0, 2949120, 0, 2949120,
-0, 655360, 0, 45, 0, 1112686925, 3229004, 45,
-0, 18, 2949120, 0, 2949120, 0, 2949120, 0,
-720896, 0, 45, 0, 1112686925, 3229004, 45, 0,
-18, 2949120, 0, 2949120, 0, 2949120, 0, 720896,
-0, 45, 0, 1112686925, 3229004, 45, 0, 18,
-2949120, 0, 2949120, 0, 2949120, 0, 720896, 0,
-45, 0, 45, 0, 45, 0, 18, 2949120,
-0, 2949120, 0, 2949120, 0, 720896, 0, 45,
-0, 1112686925, 3229004, 45, 0, 18, 2949120, 0,
-2949120, 0, 2949120, 0, 786432, 0, 45, 0,
-1112686925, 3229004, 45, 0, 17, 2949120, 0, 2949120,
-0, 2949120, 0, 786432, 0, 45, 0, 45,
-0, 45, 0, 17, 2949120, 0, 2949120, 0,
-2949120, 0, 786432, 0, 45, 0, 1112686925, 3229004,
-45, 0, 17, 2949120, 0, 2949120, 0, 2949120,
-0, 786432, 0, 45, 0, 1112686925, 3229004, 45,
-0, 17, 2949120, 0, 2949120, 0, 2949120, 0,
-851968, 0, 45, 0, 1112686925, 3229004, 45, 0,
-17, 2949120, 0, 2949120, 0, 2949120, 0, 851968,
-0, 45, 0, 45, 0, 45, 0, 17,
-2949120, 0, 2949120, 0, 2949120, 0, 851968, 0,
-45, 0, 1112686925, 3229004, 45, 0, 17, 2949120,
-0, 2949120, 0, 2949120, 0, 851968, 0, 45,
-0, 1112686925, 3229004, 45, 0, 17, 2949120, 0,
-2949120, 0, 2949120, 0, 917504, 0, 45, 0,
-45, 0, 45, 0, 17, 2949120, 0, 2949120,
-0, 2949120, 0, 917504, 0, 45, 0, 1112686925,
-3229004, 45, 0, 17, 2949120, 0, 2949120, 0,
-2949120, 0, 917504, 0, 45, 0, 1112686925, 3229004,
-45, 0, 17, 2949120, 0, 2949120, 0, 2949120,
-0, 917504, 0, 45, 0, 1112686925, 3229004, 45,
-0, 17, 2949120, 0, 2949120, 0, 2949120, 0,
-983040, 0, 45, 0, 1112686925, 3229004, 45, 0,
-18, 2949120, 0, 2949120, 0, 2949120, 0, 983040,
-0, 45, 0, 1112686925, 3229004, 45, 0, 18,
-2949120, 0, 2949120, 0, 2949120, 0, 983040, 0,
-45, 0, 45, 0, 45, 0, 18, 2949120,
-0, 2949120, 0, 2949120, 0, 983040, 0, 45,
-0, 1112686925, 3229004, 45, 0, 18, 2949120, 0,
-2949120, 0, 1329856512, 3363407, 1048576, 524352, 1380929348, 51,
-45, 0, 45, 0, 9, 2949136, 0, 2949120,
-0, 2949120, 0, 1048576, 0, 45, 0, 45,
-0, 1380929348, 51, 16, 2949120, 0, 2949120, 0,
-2949120, 0, 1310720, 0, 45, 0, 1380929348, 51,
-45, 0, 8388697, 2949120, 0, 2949120, 0, 1329856512,
-3363407, 589824, 0, 45, 0, 45, 0, 1380929348,
-51, 17, 2949120, 0, 2949120, 0, 1329856512, 3363407,
-1114112, 0, 45, 0, 1380929348, 51, 45, 0,
-6291473, 1329856512, 3363407, 2949120, 0, 2949120, 0, 5177344,
-0, 45, 0, 1380929348, 51, 45, 0, 85,
-2949120, 0, 2949120, 0, 2949120, 0, 5701632, 0,
-45, 0, 45, 0, 45, 0, 84, 2949120,
-0, 1329856512, 3363407, 2949120, 0, 5636096, 128, 45,
-0, 1380929348, 51, 45, 0, 17, 1329856512, 3363407,
-2949120, 0, 2949120, 0, 5242880, 0, 45, 0,
-1380929348, 51, 45, 0, 90, 2949120, 0, 2949120,
-0, 2949120, 0, 5242880, 0, 45, 0, 1380929348,
-51, 45, 0, 4, 2949120, 0, 2949120, 0,
-2949120, 0, 1245184, 0, 1380929348, 51, 1380929348, 51,
-45, 0, 19, 2949120, 0, 1329856512, 3363407, 2949120,
-0, 5308416, 0, 45, 0, 1464357697, 5000257, 45,
-0, 6, 2949120, 0, 2949120, 0, 2949120, 0,
-1245184, 0, 45, 0, 1464357697, 5000257, 45, 0,
-6, 2949120, 0, 2949120, 0, 2949120, 0, 1245184,
-0, 45, 0, 1464357697, 5000257, 45, 0, 6,
-2949120, 0, 2949120, 0, 2949120, 0, 1245184, 0,
-45, 0, 1464357697, 5000257, 45, 0, 6, 2949120,
-0, 2949120, 0, 2949120, 0, 1245184, 0, 45,
-0, 1464357697, 5000257, 45, 0, 6, 2949120, 0,
-2949120, 0, 2949120, 0, 1245184, 0, 45, 0,
-1464357697, 5000257, 45, 0, 6, 2949120, 0, 2949120,
-0, 2949120, 0, 1245184, 64, 45, 0, 1380929348,
-51, 45, 0, 18, 1329856512, 3363407, 2949120, 0,
-2949120, 0, 5373952, 0, 45, 0, 1380929348, 51,
-45, 0, 85, 2949120, 0, 2949120, 0, 2949120,
-0, 5701632, 0, 45, 0, 1380929348, 51, 45,
-0, 18, 1329856512, 3363407, 2949120, 0, 2949120, 0,
-5439488, 0, 45, 0, 45, 0, 45, 0,
-20, 2949120, 0, 1329856512, 3363407, 2949120, 0, 5832704,
-128, 45, 0, 45, 0, 1380929348, 51, 21,
-2949120, 0, 2949120, 0, 2949120, 0, 2228224, 0,
-1380929348, 51, 45, 0, 45, 0, 20, 2949120,
-0, 2949120, 0, 1329856512, 3363407, 1310720, 0, 45,
-0, 45, 0, 1380929348, 51, 20, 2949120, 0,
-2949120, 0, 1329856512, 3363407, 1310720, 0, 45, 0,
-45, 0, 1380929348, 51, 20, 2949120, 0, 2949120,
-0, 1329856512, 3363407, 1310720, 0, 45, 0, 45,
-0, 1380929348, 51, 20, 2949120, 0, 2949120, 0,
-1329856512, 3363407, 2490368, 0, 45, 0, 45, 0,
-1380929348, 51, 38, 2949120, 0, 2949120, 0, 1329856512,
-3363407, 2490368, 0, 45, 0, 45, 0, 1380929348,
-51, 38, 2949120, 0, 2949120, 0, 1329856512, 3363407,
-1441792, 0, 45, 0, 45, 0, 1380929348, 51,
-35, 2949120, 0, 2949120, 0, 1329856512, 3363407, 1441792,
-0, 45, 0, 45, 0, 1380929348, 51, 38,
-2949120, 0, 2949120, 0, 1329856512, 3363407, 1310720, 0,
-45, 0, 45, 0, 1380929348, 51, 23, 2949120,
-0, 2949120, 0, 2949120, 0, 1572864, 0, 45,
-0, 45, 0, 45, 0, 35, 2949120, 0,
-2949120, 0, 1329856512, 3363407, 1507328, 0, 45, 0,
-45, 0, 1380929348, 51, 38, 2949120, 0, 2949120,
-0, 1329856512, 3363407, 1310720, 0, 45, 0, 45,
-0, 1380929348, 51, 24, 2949120, 0, 2949120, 0,
-2949120, 0, 1441792, 0, 45, 0, 45, 0,
-45, 0, 24, 2949120, 0, 2949120, 0, 1329856512,
-3363407, 1572864, 0, 45, 0, 45, 0, 1380929348,
-51, 24, 2949120, 0, 2949120, 0, 1329856512, 3363407,
-1572864, 0, 45, 0, 45, 0, 1380929348, 51,
-24, 2949120, 0, 2949120, 0, 1329856512, 3363407, 1572864,
-0, 45, 0, 45, 0, 45, 0, 23,
-2949120, 0, 2949120, 0, 2949120, 0, 1572864, 0,
-45, 0, 45, 0, 1380929348, 51, 24, 2949120,
-0, 2949120, 0, 1329856512, 3363407, 3473408, 0, 45,
-0, 45, 0, 1380929348, 51, 53, 2949120, 0,
-2949120, 0, 2949120, 0, 1572864, 0, 45, 0,
-45, 0, 45, 0, 53, 2949120, 0, 2949120,
-0, 1329856512, 3363407, 1572864, 0, 45, 0, 45,
-0, 45, 0, 24, 2949120, 0, 2949120, 0,
-2949120, 0, 2293760, 0, 45, 0, 45, 0,
-1380929348, 51, 25, 2949120, 0, 2949120, 0, 1329856512,
-3363407, 2359296, 0, 45, 0, 45, 0, 1380929348,
-51, 12582937, 2949120, 0, 2949120, 0, 2949120, 0,
-1572864, 0, 45, 0, 45, 0, 45, 0,
-16777241, 2949120, 0, 2949120, 0, 1329856512, 3363407, 1572864,
-0, 45, 0, 45, 0, 1380929348, 51, 26,
-2949120, 0, 2949120, 0, 2949120, 0, 1638400, 0,
-45, 0, 45, 0, 45, 0, 26, 2949120,
-0, 2949120, 0, 1329856512, 3363407, 1703936, 0, 45,
-0, 45, 0, 45, 0, 46, 2949120, 0,
-2949120, 0, 2949120, 0, 2359296, 0, 45, 0,
-45, 0, 45, 0, 46, 2949120, 0, 2949120,
-0, 2949120, 0, 2359296, 0, 45, 0, 45,
-0, 45, 0, 27, 2949120, 0, 2949120, 0,
-2949120, 0, 3473408, 0, 45, 0, 45, 0,
-45, 0, 27, 2949120, 0, 2949120, 0, 2949120,
-0, 3473408, 0, 45, 0, 45, 0, 45,
-0, 27, 2949120, 0, 2949120, 0, 2949120, 0,
-3473408, 0, 45, 0, 45, 0, 45, 0,
-27, 2949120, 0, 2949120, 0, 2949120, 0, 3473408,
-0, 45, 0, 45, 0, 45, 0, 30,
-2949120, 0, 2949120, 0, 2949120, 0, 2293760, 0,
-45, 0, 45, 0, 1380929348, 51, 28, 2949120,
-0, 2949120, 0, 1329856512, 3363407, 1835008, 0, 45,
-0, 45, 0, 45, 0, 30, 2949120, 0,
-2949120, 0, 2949120, 0, 2293760, 0, 45, 0,
-45, 0, 45, 0, 29, 2949120, 0, 2949120,
-0, 2949120, 0, 2293760, 0, 45, 0, 45,
-0, 45, 0, 29, 2949120, 0, 2949120, 0,
-2949120, 0, 2293760, 0, 45, 0, 45, 0,
-45, 0, 29, 2949120, 0, 2949120, 0, 2949120,
-0, 2293760, 0, 45, 0, 45, 0, 45,
-0, 29, 2949120, 0, 2949120, 0, 2949120, 0,
-2293760, 0, 45, 0, 45, 0, 1380929348, 51,
-35, 2949120, 0, 2949120, 0, 2949120, 0, 1572864,
-0, 45, 0, 45, 0, 45, 0, 35,
-2949120, 0, 2949120, 0, 1329856512, 3363407, 1966080, 0,
-45, 0, 45, 0, 1380929348, 51, 30, 2949120,
-0, 2949120, 0, 1329856512, 3363407, 2031616, 64, 45,
-0, 45, 0, 45, 0, 30, 2949120, 0,
-2949120, 0, 2949120, 0, 2031616, 0, 45, 0,
-45, 0, 1380929348, 51, 31, 2949120, 0, 2949120,
-0, 1329856512, 3363407, 2097152, 0, 45, 0, 45,
-0, 1380929348, 51, 32, 2949120, 0, 2949120, 0,
-2949120, 0, 2031616, 0, 45, 0, 45, 0,
-45, 0, 32, 2949120, 0, 2949120, 0, 1329856512,
-3363407, 2097152, 0, 45, 0, 45, 0, 45,
-0, 54, 2949120, 0, 2949120, 0, 2949120, 0,
-2359296, 0, 45, 0, 45, 0, 1380929348, 51,
-36, 2949120, 0, 2949120, 0, 2949120, 0, 2162688,
-0, 45, 0, 45, 0, 45, 0, 36,
-2949120, 0, 2949120, 0, 2949120, 0, 2162688, 0,
-45, 0, 45, 0, 45, 0, 36, 2949120,
-0, 2949120, 0, 2949120, 0, 2162688, 0, 45,
-0, 45, 0, 45, 0, 36, 2949120, 0,
-2949120, 0, 2949120, 0, 2162688, 0, 45, 0,
-45, 0, 45, 0, 4194340, 2949120, 0, 2949120,
-0, 2949120, 0, 1835008, 0, 45, 0, 45,
-0, 45, 0, 34, 2949120, 0, 2949120, 0,
-1329856512, 3363407, 2228224, 0, 45, 0, 45, 0,
-45, 0, 20, 2949120, 0, 1329856512, 3363407, 2949120,
-0, 5832704, 0, 45, 0, 45, 0, 1380929348,
-51, 8388642, 2949120, 0, 2949120, 0, 1329856512, 3363407,
-1835008, 0, 45, 0, 45, 0, 1380929348, 51,
-20, 2949120, 0, 2949120, 0, 1329856512, 3363407, 5832704,
-0, 45, 0, 45, 0, 1380929348, 51, 89,
-2949120, 0, 2949120, 0, 1329856512, 3363407, 3538944, 0,
-45, 0, 45, 0, 1380929348, 51, 35, 2949120,
-0, 2949120, 0, 2949120, 0, 1835008, 0, 45,
-0, 45, 0, 45, 0, 35, 2949120, 0,
-2949120, 0, 2949120, 0, 1835008, 0, 45, 0,
-45, 0, 45, 0, 35, 2949120, 0, 2949120,
-0, 1329856512, 3363407, 5832704, 0, 45, 0, 45,
-0, 1380929348, 51, 89, 2949120, 0, 2949120, 0,
-1329856512, 3363407, 2359296, 0, 45, 0, 45, 0,
-1380929348, 51, 54, 2949120, 0, 2949120, 0, 1329856512,
-3363407, 3538944, 0, 45, 0, 45, 0, 1380929348,
-51, 76, 2949120, 0, 2949120, 0, 1329856512, 3363407,
-2359296, 0, 45, 0, 45, 0, 45, 0,
-32, 2949120, 0, 2949120, 0, 2949120, 0, 2359296,
-0, 45, 0, 45, 0, 45, 0, 32,
-2949120, 0, 2949120, 0, 2949120, 0, 2359296, 0,
-45, 0, 45, 0, 1380929348, 51, 36, 2949120,
-0, 2949120, 0, 2949120, 0, 1703936, 0, 45,
-0, 45, 0, 45, 0, 36, 2949120, 0,
-2949120, 0, 2949120, 0, 1703936, 0, 45, 0,
-45, 0, 45, 0, 36, 2949120, 0, 2949120,
-0, 2949120, 0, 1703936, 0, 45, 0, 45,
-0, 45, 0, 12582948, 2949120, 0, 2949120, 0,
-1329856512, 3363407, 1835008, 0, 45, 0, 45, 0,
-1380929348, 51, 4194340, 2949120, 0, 2949120, 0, 1329856512,
-3363407, 2359296, 0, 45, 0, 45, 0, 1380929348,
-51, 38, 2949120, 0, 2949120, 0, 2949120, 0,
-1048576, 0, 1380929348, 51, 45, 0, 45, 0,
-38, 2949120, 0, 2949120, 0, 1329856512, 3363407, 2490368,
-0, 45, 0, 45, 0, 1380929348, 51, 38,
-2949120, 0, 2949120, 0, 1329856512, 3363407, 2490368, 0,
-45, 0, 45, 0, 1380929348, 51, 38, 2949120,
-0, 2949120, 0, 1329856512, 3363407, 2490368, 0, 45,
-0, 45, 0, 1380929348, 51, 38, 2949120, 0,
-2949120, 0, 1329856512, 3363407, 2490368, 0, 45, 0,
-45, 0, 45, 0, 23, 1329856512, 3363407, 2949120,
-0, 2949120, 0, 2490368, 0, 45, 0, 45,
-0, 1380929348, 51, 38, 2949120, 0, 2949120, 0,
-1329856512, 3363407, 2490368, 448, 45, 0, 1330926407, 3229006,
-45, 0, 21, 2949120, 0, 2949120, 0, 2949120,
-0, 2490368, 0, 45, 0, 1330926407, 3229006, 45,
-0, 21, 2949120, 0, 2949120, 0, 2949120, 0,
-2490368, 0, 45, 0, 1330926407, 3229006, 45, 0,
-21, 2949120, 0, 2949120, 0, 2949120, 0, 2490368,
-0, 45, 0, 1330926407, 3229006, 45, 0, 21,
-2949120, 0, 2949120, 0, 2949120, 0, 2490368, 0,
-45, 0, 1330926407, 3229006, 45, 0, 21, 2949120,
-0, 2949120, 0, 2949120, 0, 2490368, 0, 45,
-0, 45, 0, 1380929348, 51, 38, 2949120, 0,
-2949120, 0, 1329856512, 3363407, 2490368, 0, 45, 0,
-45, 0, 45, 0, 22, 1329856512, 3363407, 2949120,
-0, 2949120, 0, 2490368, 0, 45, 0, 45,
-0, 1380929348, 51, 39, 2949120, 0, 2949120, 0,
-1329856512, 3363407, 2555904, 0, 45, 0, 45, 0,
-1380929348, 51, 12582951, 1329856512, 3363407, 1397161984, 1162760020, 2949169,
-0, 1376256, 0, 45, 0, 45, 0, 45,
-0, 25165863, 2949120, 0, 2949120, 0, 1329856512, 3363407,
-1376256, 0, 45, 0, 45, 0, 45, 0,
-40, 2949120, 0, 2949120, 0, 2949120, 0, 3932160,
-0, 45, 0, 45, 0, 45, 0, 40,
-2949120, 0, 2949120, 0, 2949120, 0, 3932160, 0,
-45, 0, 45, 0, 45, 0, 40, 2949120,
-0, 2949120, 0, 2949120, 0, 3932160, 0, 45,
-0, 45, 0, 45, 0, 40, 2949120, 0,
-2949120, 0, 2949120, 0, 3932160, 0, 45, 0,
-45, 0, 45, 0, 41, 2949120, 0, 2949120,
-0, 2949120, 0, 2359296, 0, 45, 0, 45,
-0, 45, 0, 41, 2949120, 0, 2949120, 0,
-2949120, 0, 2359296, 0, 45, 0, 45, 0,
-45, 0, 41, 2949120, 0, 2949120, 0, 2949120,
-0, 2359296, 0, 45, 0, 45, 0, 45,
-0, 41, 2949120, 0, 2949120, 0, 2949120, 0,
-2359296, 0, 45, 0, 45, 0, 45, 0,
-42, 2949120, 0, 1397161984, 1162760020, 2949169, 0, 2359296,
-0, 45, 0, 45, 0, 45, 0, 42,
-2949120, 0, 1397161984, 1162760020, 2949169, 0, 2359296, 0,
-45, 0, 45, 0, 45, 0, 42, 2949120,
-0, 2949120, 0, 2949120, 0, 2359296, 0, 45,
-0, 45, 0, 45, 0, 42, 2949120, 0,
-2949120, 0, 2949120, 0, 2359296, 0, 45, 0,
-45, 0, 45, 0, 43, 2949120, 0, 2949120,
-0, 2949120, 0, 2359296, 0, 45, 0, 45,
-0, 45, 0, 43, 2949120, 0, 2949120, 0,
-2949120, 0, 2359296, 0, 45, 0, 45, 0,
-45, 0, 43, 2949120, 0, 2949120, 0, 2949120,
-0, 2359296, 0, 45, 0, 45, 0, 45,
-0, 43, 2949120, 0, 2949120, 0, 2949120, 0,
-2359296, 0, 45, 0, 45, 0, 45, 0,
-44, 2949120, 0, 2949120, 0, 2949120, 0, 2359296,
-0, 45, 0, 45, 0, 45, 0, 44,
-2949120, 0, 2949120, 0, 2949120, 0, 2359296, 0,
-45, 0, 45, 0, 45, 0, 44, 2949120,
-0, 2949120, 0, 2949120, 0, 2359296, 0, 45,
-0, 45, 0, 45, 0, 44, 2949120, 0,
-2949120, 0, 2949120, 0, 2359296, 0, 45, 0,
-45, 0, 45, 0, 45, 2949120, 0, 2949120,
-0, 2949120, 0, 2359296, 0, 45, 0, 45,
-0, 45, 0, 45, 2949120, 0, 2949120, 0,
-2949120, 0, 2359296, 0, 45, 0, 45, 0,
-45, 0, 45, 2949120, 0, 2949120, 0, 2949120,
-0, 2359296, 0, 45, 0, 45, 0, 45,
-0, 45, 2949120, 0, 2949120, 0, 2949120, 0,
-2359296, 0, 45, 0, 45, 0, 1380929348, 51,
-36, 2949120, 0, 2949120, 0, 1329856512, 3363407, 2359296,
-0, 45, 0, 45, 0, 45, 0, 76,
-2949120, 0, 2949120, 0, 2949120, 0, 2359296, 0,
-45, 0, 45, 0, 45, 0, 76, 2949120,
-0, 2949120, 0, 2949120, 0, 2359296, 0, 45,
-0, 45, 0, 1380929348, 51, 46, 2949120, 0,
-2949120, 0, 1329856512, 3363407, 3014656, 0, 45, 0,
-45, 0, 45, 0, 47, 2949120, 0, 2949120,
-0, 2949120, 0, 2359296, 0, 45, 0, 45,
-0, 45, 0, 47, 2949120, 0, 2949120, 0,
-2949120, 0, 2359296, 0, 45, 0, 45, 0,
-45, 0, 47, 2949120, 0, 2949120, 0, 2949120,
-0, 2359296, 0, 45, 0, 45, 0, 45,
-0, 47, 2949120, 0, 2949120, 0, 2949120, 0,
-2359296, 0, 45, 0, 45, 0, 45, 0,
-48, 2949120, 0, 2949120, 0, 2949120, 0, 2359296,
-0, 45, 0, 45, 0, 45, 0, 48,
-2949120, 0, 2949120, 0, 2949120, 0, 2359296, 0,
-45, 0, 45, 0, 45, 0, 48, 2949120,
-0, 2949120, 0, 2949120, 0, 2359296, 0, 45,
-0, 45, 0, 45, 0, 48, 2949120, 0,
-2949120, 0, 2949120, 0, 2359296, 0, 45, 0,
-45, 0, 45, 0, 49, 2949120, 0, 2949120,
-0, 2949120, 0, 2359296, 0, 45, 0, 45,
-0, 45, 0, 49, 2949120, 0, 2949120, 0,
-2949120, 0, 2359296, 0, 45, 0, 45, 0,
-45, 0, 49, 2949120, 0, 2949120, 0, 2949120,
-0, 2359296, 0, 45, 0, 45, 0, 45,
-0, 49, 2949120, 0, 2949120, 0, 2949120, 0,
-2359296, 0, 45, 0, 45, 0, 45, 0,
-50, 2949120, 0, 2949120, 0, 2949120, 0, 3473408,
-0, 45, 0, 45, 0, 45, 0, 50,
-2949120, 0, 2949120, 0, 2949120, 0, 3473408, 0,
-45, 0, 45, 0, 45, 0, 50, 2949120,
-0, 2949120, 0, 2949120, 0, 3473408, 0, 45,
-0, 45, 0, 45, 0, 50, 2949120, 0,
-2949120, 0, 2949120, 0, 3473408, 0, 45, 0,
-45, 0, 45, 0, 24, 2949120, 0, 2949120,
-0, 2949120, 0, 3473408, 0, 45, 0, 45,
-0, 1380929348, 51, 51, 2949120, 0, 2949120, 0,
-1329856512, 3363407, 3342336, 0, 45, 0, 45, 0,
-45, 0, 24, 2949120, 0, 2949120, 0, 2949120,
-0, 3473408, 0, 45, 0, 45, 0, 1380929348,
-51, 52, 2949120, 0, 2949120, 0, 1329856512, 3363407,
-6488064, 128, 45, 0, 45, 0, 1380929348, 51,
-51, 2949120, 0, 2949120, 0, 1329856512, 3363407, 3407872,
-64, 45, 0, 45, 0, 45, 0, 51,
-2949120, 0, 2949120, 0, 2949120, 0, 3407872, 0,
-45, 0, 45, 0, 1380929348, 51, 53, 2949120,
-0, 2949120, 0, 2949120, 0, 3342336, 0, 45,
-0, 45, 0, 45, 0, 53, 2949120, 0,
-2949120, 0, 2949120, 0, 3342336, 0, 45, 0,
-45, 0, 45, 0, 53, 2949120, 0, 2949120,
-0, 2949120, 0, 3014656, 0, 45, 0, 45,
-0, 45, 0, 36, 2949120, 0, 2949120, 0,
-2949120, 0, 3014656, 0, 45, 0, 45, 0,
-45, 0, 36, 2949120, 0, 2949120, 0, 1329856512,
-3363407, 3538944, 0, 45, 0, 45, 0, 1380929348,
-51, 89, 2949120, 0, 1329790976, 1279414349, 1329808725, 1279414349,
-5850453, 0, 45, 0, 45, 0, 1380929348, 51,
-89, 2949120, 0, 1329790976, 1279414349, 1329808725, 1279414349, 5850453,
-0, 45, 0, 45, 0, 1380929348, 51, 89,
-2949120, 0, 2949120, 0, 1329856512, 3363407, 5832704, 0,
-45, 0, 45, 0, 1380929348, 51, 55, 2949120,
-0, 2949120, 0, 1329856512, 3363407, 3604480, 0, 45,
-0, 45, 0, 45, 0, 83, 2949120, 0,
-1329856512, 3363407, 2949120, 0, 5636096, 0, 45, 0,
-45, 0, 1380929348, 51, 37, 2949120, 0, 2949120,
-0, 1329856512, 3363407, 3670016, 0, 45, 0, 45,
-0, 1380929348, 51, 55, 2949120, 0, 2949120, 0,
-1329856512, 3363407, 5832704, 0, 45, 0, 45, 0,
-1380929348, 51, 37, 2949120, 0, 2949120, 0, 2949120,
-0, 5439488, 0, 45, 0, 1380929348, 51, 45,
-0, 86, 2949120, 0, 2949120, 0, 2949120, 0,
-2424832, 0, 1380929348, 51, 1380929348, 51, 45, 0,
-55, 2949120, 0, 2949120, 0, 1329856512, 3363407, 3670016,
-0, 45, 0, 45, 0, 1380929348, 51, 56,
-2949120, 0, 2949120, 0, 2949120, 0, 3735552, 0,
-45, 0, 45, 0, 45, 0, 60, 2949120,
-0, 2949120, 0, 2949120, 0, 3735552, 0, 45,
-0, 45, 0, 45, 0, 60, 2949120, 0,
-2949120, 0, 1329856512, 3363407, 3670016, 0, 45, 0,
-45, 0, 1380929348, 51, 56, 2949120, 0, 2949120,
-0, 2949120, 0, 2424832, 0, 45, 0, 45,
-0, 45, 0, 56, 2949120, 0, 2949120, 0,
-1329856512, 3363407, 3735552, 0, 45, 0, 45, 0,
-1380929348, 51, 60, 2949120, 0, 2949120, 0, 1329856512,
-3363407, 3801088, 0, 45, 0, 45, 0, 1380929348,
-51, 57, 2949120, 0, 2949120, 0, 2949120, 0,
-3801088, 0, 45, 0, 45, 0, 45, 0,
-60, 2949120, 0, 2949120, 0, 2949120, 0, 3801088,
-0, 45, 0, 45, 0, 45, 0, 60,
-2949120, 0, 2949120, 0, 2949120, 0, 3801088, 0,
-45, 0, 45, 0, 45, 0, 60, 2949120,
-0, 2949120, 0, 1329856512, 3363407, 3932160, 0, 45,
-0, 45, 0, 1380929348, 51, 59, 2949120, 0,
-2949120, 0, 1329856512, 3363407, 3866624, 0, 45, 0,
-45, 0, 1380929348, 51, 4194363, 2949120, 0, 2949120,
-0, 2949120, 0, 3670016, 0, 45, 0, 45,
-0, 45, 0, 8388667, 2949120, 0, 2949120, 0,
-1329856512, 3363407, 3670016, 0, 45, 0, 45, 0,
-1380929348, 51, 60, 2949120, 0, 2949120, 0, 2949120,
-0, 3670016, 0, 45, 0, 45, 0, 45,
-0, 60, 2949120, 0, 2949120, 0, 2949120, 0,
-3670016, 0, 45, 0, 45, 0, 45, 0,
-60, 2949120, 0, 2949120, 0, 1329856512, 3363407, 2752512,
-0, 45, 0, 45, 0, 1380929348, 51, 42,
-2949120, 0, 2949120, 0, 1329856512, 3363407, 2752512, 0,
-45, 0, 45, 0, 1380929348, 51, 42, 2949120,
-0, 2949120, 0, 1329856512, 3363407, 3997696, 0, 45,
-0, 45, 0, 1380929348, 51, 61, 2949120, 0,
-2949120, 0, 1329856512, 3363407, 3997696, 64, 1380929348, 51,
-45, 0, 45, 0, 4194346, 2949120, 0, 2949120,
-0, 2949120, 0, 3997696, 128, 45, 0, 45,
-0, 1380929348, 51, 42, 2949120, 0, 2949120, 0,
-2949120, 0, 2359296, 0, 45, 0, 45, 0,
-45, 0, 62, 2949120, 0, 2949120, 0, 2949120,
-0, 2359296, 0, 45, 0, 45, 0, 45,
-0, 62, 2949120, 0, 2949120, 0, 2949120, 0,
-2359296, 0, 45, 0, 45, 0, 45, 0,
-62, 2949120, 0, 2949120, 0, 2949120, 0, 2359296,
-0, 45, 0, 45, 0, 45, 0, 62,
-2949120, 0, 2949120, 0, 2949120, 0, 2359296, 0,
-45, 0, 45, 0, 45, 0, 63, 2949120,
-0, 2949120, 0, 2949120, 0, 2359296, 0, 45,
-0, 45, 0, 45, 0, 63, 2949120, 0,
-2949120, 0, 2949120, 0, 2359296, 0, 45, 0,
-45, 0, 45, 0, 63, 2949120, 0, 2949120,
-0, 2949120, 0, 2359296, 0, 45, 0, 45,
-0, 45, 0, 63, 2949120, 0, 2949120, 0,
-2949120, 0, 2359296, 0, 45, 0, 45, 0,
-45, 0, 64, 2949120, 0, 2949120, 0, 2949120,
-0, 2359296, 0, 45, 0, 45, 0, 45,
-0, 64, 2949120, 0, 2949120, 0, 1329856512, 3363407,
-4194304, 704, 45, 0, 45, 0, 1380929348, 51,
-64, 2949120, 0, 2949120, 0, 2949120, 0, 2359296,
-0, 45, 0, 45, 0, 45, 0, 65,
-2949120, 0, 2949120, 0, 2949120, 0, 2359296, 0,
-45, 0, 45, 0, 45, 0, 65, 2949120,
-0, 2949120, 0, 2949120, 0, 2359296, 0, 45,
-0, 45, 0, 45, 0, 37748801, 2949120, 0,
-2949120, 0, 1329856512, 3363407, 4259840, 640, 45, 0,
-45, 0, 1380929348, 51, 36, 2949120, 0, 2949120,
-0, 2949120, 0, 2359296, 0, 45, 0, 45,
-0, 45, 0, 66, 2949120, 0, 2949120, 0,
-2949120, 0, 2359296, 0, 45, 0, 45, 0,
-45, 0, 66, 2949120, 0, 2949120, 0, 2949120,
-0, 2359296, 0, 45, 0, 45, 0, 45,
-0, 66, 2949120, 0, 2949120, 0, 2949120, 0,
-2359296, 0, 45, 0, 45, 0, 45, 0,
-66, 2949120, 0, 2949120, 0, 2949120, 0, 2359296,
-0, 45, 0, 45, 0, 45, 0, 67,
-2949120, 0, 2949120, 0, 2949120, 0, 2359296, 0,
-45, 0, 45, 0, 45, 0, 67, 2949120,
-0, 2949120, 0, 2949120, 0, 2359296, 0, 45,
-0, 45, 0, 45, 0, 67, 2949120, 0,
-2949120, 0, 2949120, 0, 2359296, 0, 45, 0,
-45, 0, 45, 0, 67, 2949120, 0, 2949120,
-0, 2949120, 0, 2359296, 0, 45, 0, 45,
-0, 45, 0, 68, 2949120, 0, 2949120, 0,
-2949120, 0, 2359296, 0, 45, 0, 45, 0,
-45, 0, 68, 2949120, 0, 2949120, 0, 2949120,
-0, 2359296, 0, 45, 0, 45, 0, 45,
-0, 68, 2949120, 0, 2949120, 0, 2949120, 0,
-2359296, 0, 45, 0, 45, 0, 45, 0,
-68, 2949120, 0, 2949120, 0, 2949120, 0, 2359296,
-0, 45, 0, 45, 0, 45, 0, 69,
-2949120, 0, 2949120, 0, 2949120, 0, 2359296, 0,
-45, 0, 45, 0, 45, 0, 69, 2949120,
-0, 2949120, 0, 2949120, 0, 2359296, 0, 45,
-0, 45, 0, 45, 0, 69, 2949120, 0,
-2949120, 0, 2949120, 0, 2359296, 0, 45, 0,
-45, 0, 45, 0, 69, 2949120, 0, 2949120,
-0, 2949120, 0, 2359296, 0, 45, 0, 45,
-0, 45, 0, 70, 2949120, 0, 2949120, 0,
-2949120, 0, 2359296, 0, 45, 0, 45, 0,
-45, 0, 70, 2949120, 0, 2949120, 0, 2949120,
-0, 2359296, 0, 45, 0, 45, 0, 45,
-0, 70, 2949120, 0, 2949120, 0, 2949120, 0,
-2359296, 0, 45, 0, 45, 0, 45, 0,
-70, 2949120, 0, 2949120, 0, 2949120, 0, 2359296,
-0, 45, 0, 45, 0, 45, 0, 71,
-2949120, 0, 2949120, 0, 2949120, 0, 2359296, 0,
-45, 0, 45, 0, 45, 0, 71, 2949120,
-0, 2949120, 0, 2949120, 0, 2359296, 0, 45,
-0, 45, 0, 45, 0, 71, 2949120, 0,
-2949120, 0, 2949120, 0, 2359296, 0, 45, 0,
-45, 0, 45, 0, 71, 2949120, 0, 2949120,
-0, 2949120, 0, 4718592, 0, 45, 0, 45,
-0, 45, 0, 36, 2949120, 0, 2949120, 0,
-2949120, 0, 4718592, 0, 45, 0, 45, 0,
-45, 0, 36, 2949120, 0, 2949120, 0, 2949120,
-0, 4718592, 0, 45, 0, 45, 0, 45,
-0, 36, 2949120, 0, 2949120, 0, 2949120, 0,
-4718592, 0, 45, 0, 45, 0, 45, 0,
-36, 2949120, 0, 2949120, 0, 2949120, 0, 2359296,
-0, 45, 0, 45, 0, 45, 0, 73,
-2949120, 0, 2949120, 0, 2949120, 0, 2359296, 0,
-45, 0, 45, 0, 45, 0, 73, 2949120,
-0, 2949120, 0, 2949120, 0, 2359296, 0, 45,
-0, 45, 0, 45, 0, 73, 2949120, 0,
-2949120, 0, 2949120, 0, 2359296, 0, 45, 0,
-45, 0, 45, 0, 73, 2949120, 0, 2949120,
-0, 2949120, 0, 2359296, 0, 45, 0, 45,
-0, 45, 0, 74, 2949120, 0, 2949120, 0,
-2949120, 0, 2359296, 0, 45, 0, 45, 0,
-45, 0, 74, 2949120, 0, 2949120, 0, 2949120,
-0, 2359296, 0, 45, 0, 45, 0, 45,
-0, 74, 2949120, 0, 2949120, 0, 2949120, 0,
-2359296, 0, 45, 0, 45, 0, 45, 0,
-74, 2949120, 0, 2949120, 0, 2949120, 0, 2359296,
-0, 45, 0, 45, 0, 45, 0, 75,
-2949120, 0, 2949120, 0, 2949120, 0, 2359296, 0,
-45, 0, 45, 0, 45, 0, 75, 2949120,
-0, 2949120, 0, 2949120, 0, 2359296, 0, 45,
-0, 45, 0, 45, 0, 75, 2949120, 0,
-2949120, 0, 2949120, 0, 2359296, 0, 45, 0,
-45, 0, 45, 0, 75, 2949120, 0, 2949120,
-0, 2949120, 0, 4980736, 0, 45, 0, 45,
-0, 45, 0, 41943094, 2949120, 0, 2949120, 0,
-1329856512, 3363407, 4980736, 0, 45, 0, 45, 0,
-45, 0, 77, 1329856512, 3363407, 1397161984, 1162760020, 2949169,
-0, 5636096, 0, 45, 0, 45, 0, 45,
-0, 77, 1329856512, 3363407, 1397161984, 1162760020, 2949169, 0,
-5636096, 0, 45, 0, 45, 0, 45, 0,
-77, 1329856512, 3363407, 1397161984, 1162760020, 2949169, 0, 5636096,
-0, 45, 0, 45, 0, 45, 0, 77,
-1329856512, 3363407, 1397161984, 1162760020, 2949169, 0, 5636096, 0,
-45, 0, 45, 0, 45, 0, 78, 1329856512,
-3363407, 1397161984, 1162760020, 2949169, 0, 5636096, 0, 45,
-0, 45, 0, 45, 0, 78, 1329856512, 3363407,
-1397161984, 1162760020, 2949169, 0, 5636096, 0, 45, 0,
-45, 0, 45, 0, 78, 1329856512, 3363407, 1397161984,
-1162760020, 2949169, 0, 5636096, 0, 45, 0, 45,
-0, 45, 0, 78, 1329856512, 3363407, 1397161984, 1162760020,
-2949169, 0, 5636096, 0, 45, 0, 45, 0,
-45, 0, 79, 2949120, 0, 1329856512, 3363407, 2949120,
-0, 5308416, 0, 45, 0, 45, 0, 45,
-0, 6291535, 2949120, 0, 1329856512, 3363407, 2949120, 0,
-5308416, 0, 45, 0, 45, 0, 1380929348, 51,
-80, 2949120, 0, 2949120, 0, 1329856512, 3363407, 5242880,
-0, 45, 0, 45, 0, 45, 0, 80,
-2949120, 0, 1329856512, 3363407, 2949120, 0, 5308416, 0,
-45, 0, 45, 0, 45, 0, 80, 2949120,
-0, 1329856512, 3363407, 2949120, 0, 5308416, 0, 45,
-0, 1380929348, 51, 45, 0, 84, 2949120, 0,
-2949120, 0, 2949120, 0, 5767168, 0, 45, 0,
-1380929348, 51, 45, 0, 84, 2949120, 0, 2949120,
-0, 2949120, 0, 5767168, 0, 45, 0, 45,
-0, 45, 0, 88, 2949120, 0, 1329856512, 3363407,
-2949120, 0, 5636096, 0, 45, 0, 45, 0,
-45, 0, 88, 2949120, 0, 1329856512, 3363407, 2949120,
-0, 5636096, 0, 45, 0, 45, 0, 45,
-0, 88, 2949120, 0, 1329856512, 3363407, 2949120, 0,
-5636096, 0, 45, 0, 45, 0, 45, 0,
-19, 2949120, 0, 2949120, 0, 2949120, 0, 5570560,
-0, 45, 0, 1380929348, 51, 45, 0, 85,
-2949120, 0, 2949120, 0, 2949120, 0, 5373952, 0,
-45, 0, 45, 0, 45, 0, 80, 2949120,
-0, 1329856512, 3363407, 2949120, 0, 5636096, 0, 45,
-0, 45, 0, 45, 0, 83, 2949120, 0,
-2949120, 0, 2949120, 0, 5701632, 0, 45, 0,
-1380929348, 51, 45, 0, 8, 1329856512, 3363407, 2949120,
-0, 2949120, 0, 5373952, 0, 45, 0, 1380929348,
-51, 45, 0, 6, 2949120, 0, 2949120, 0,
-2949120, 0, 5373952, 0, 45, 0, 1380929348, 51,
-45, 0, 19, 2949120, 0, 2949120, 0, 2949120,
-0, 5373952, 0, 45, 0, 1380929348, 51, 45,
-0, 19, 2949120, 0, 2949120, 0, 2949120, 0,
-5373952, 0, 45, 0, 45, 0, 45, 0,
-87, 2949120, 0, 1329856512, 3363407, 2949120, 0, 5636096,
-0, 45, 0, 45, 0, 45, 0, 87,
-2949120, 0, 1329856512, 3363407, 2949120, 0, 5636096, 0,
-45, 0, 45, 0, 45, 0, 87, 2949120,
-0, 1329856512, 3363407, 2949120, 0, 5636096, 0, 45,
-0, 45, 0, 45, 0, 80, 2949120, 0,
-1329856512, 3363407, 2949120, 0, 5636096, 0, 45, 0,
-45, 0, 45, 0, 80, 2949120, 0, 2949120,
-0, 2949120, 0, 5767168, 0, 45, 0, 45,
-0, 45, 0, 80, 2949120, 0, 1329856512, 3363407,
-2949120, 0, 5636096, 0, 45, 0, 45, 0,
-45, 0, 80, 2949120, 0, 1329856512, 3363407, 2949120,
-0, 5636096, 0, 45, 0, 45, 0, 1380929348,
-51, 83, 2949120, 0, 2949120, 0, 1329856512, 3363407,
-5439488, 0, 45, 0, 45, 0, 1380929348, 51,
-86, 2949120, 0, 2949120, 0, 1329856512, 3363407, 5636096,
-0, 45, 0, 45, 0, 1380929348, 51, 86,
-2949120, 0, 2949120, 0, 1329856512, 3363407, 5636096, 0,
-45, 0, 45, 0, 1380929348, 51, 86, 2949120,
-0, 2949120, 0, 1329856512, 3363407, 5636096, 0, 45,
-0, 45, 0, 1380929348, 51, 86, 2949120, 0,
-2949120, 0, 2949120, 0, 5439488, 0, 45, 0,
-1380929348, 51, 45, 0, 86, 2949120, 0, 2949120,
-0, 2949120, 0, 5439488, 0, 45, 0, 1380929348,
-51, 45, 0, 86, 2949120, 0, 1329790976, 1279414349,
-1329808725, 1279414349, 5850453, 0, 45, 0, 45, 0,
-1347243843, 1163217986, 2097207, 2949120, 0, 2949120, 0, 1329856512,
-3363407, 5832704, 32, 45, 0, 45, 0, 1380929348,
-51, 55, 2949120, 0, 2949120, 0, 2949120, 0,
-5898240, 0, 45, 0, 45, 0, 45, 0,
-6291547, 2949120, 0, 1329856512, 3363407, 2949120, 0, 1114112,
-0, 1380929348, 51, 45, 0, 45, 0, 6291546,
-2949120, 0, 2949120, 0, 2949120, 0, 5898240, 0,
-45, 0, 1380929348, 51, 45, 0, 81, 2949120,
-0, 2949120, 0, 2949120, 0, 5963776, 0, 45,
-0, 45, 0, 45, 0, 4194396, 2949120, 0,
-1329856512, 3363407, 2949120, 0, 1114112, 32, 1380929348, 51,
-45, 0, 45, 0, 4194395, 2949120, 0, 2949120,
-0, 2949120, 0, 5963776, 32, 45, 0, 1380929348,
-51, 45, 0, 81, 2949120, 0, 2949120, 0,
-2949120, 0, 6029312, 0, 45, 0, 45, 0,
-45, 0, 2097231, 2949120, 0, 1329856512, 3363407, 2949120,
-0, 1114112, 64, 1380929348, 51, 45, 0, 45,
-0, 2097244, 2949120, 0, 2949120, 0, 2949120, 0,
-6029312, 64, 45, 0, 1380929348, 51, 45, 0,
-81, 2949120, 0, 2949120, 0, 2949120, 0, 6094848,
-0, 45, 0, 45, 0, 45, 0, 6291550,
-2949120, 0, 2949120, 0, 2949120, 0, 6094848, 0,
-45, 0, 1380929348, 51, 45, 0, 2097238, 2949120,
-0, 1329856512, 3363407, 2949120, 0, 6160384, 64, 45,
-0, 45, 0, 45, 0, 84, 2949120, 0,
-2949120, 0, 2949120, 0, 6160384, 0, 45, 0,
-45, 0, 45, 0, 4194399, 2949120, 0, 2949120,
-0, 2949120, 0, 6160384, 32, 45, 0, 1380929348,
-51, 45, 0, 4194390, 2949120, 0, 1329856512, 3363407,
-2949120, 0, 6225920, 32, 45, 0, 45, 0,
-45, 0, 84, 2949120, 0, 2949120, 0, 2949120,
-0, 6225920, 0, 45, 0, 45, 0, 45,
-0, 2097153, 2949120, 0, 2949120, 0, 2949120, 0,
-6225920, 64, 45, 0, 1380929348, 51, 45, 0,
-6291542, 2949120, 0, 2949120, 0, 2949120, 0, 65536,
-0, 45, 0, 45, 0, 45, 0, 84,
-2949120, 0, 2949120, 0, 2949120, 0, 6291456, 0,
-45, 0, 45, 0, 45, 0, 6291553, 2949120,
-0, 2949120, 0, 2949120, 0, 6291456, 0, 45,
-0, 45, 0, 45, 0, 2097238, 2949120, 0,
-1329856512, 3363407, 2949120, 0, 6356992, 64, 45, 0,
-45, 0, 45, 0, 85, 2949120, 0, 2949120,
-0, 2949120, 0, 6356992, 0, 45, 0, 45,
-0, 45, 0, 4194402, 2949120, 0, 2949120, 0,
-2949120, 0, 6356992, 32, 45, 0, 45, 0,
-45, 0, 4194390, 2949120, 0, 1329856512, 3363407, 2949120,
-0, 6422528, 32, 45, 0, 45, 0, 45,
-0, 85, 2949120, 0, 2949120, 0, 2949120, 0,
-6422528, 0, 45, 0, 45, 0, 45, 0,
-2097152, 2949120, 0, 2949120, 0, 2949120, 0, 6422528,
-64, 45, 0, 45, 0, 45, 0, 6291542,
-2949120, 0, 2949120, 0, 2949120, 0, 0, 0,
-45, 0, 45, 0, 45, 0, 85, 2949120,
-0, 2949120, 0, 1329856512, 3363407, 6488064, 0, 45,
-0, 45, 0, 45, 0, 52, 2949120, 0,
-2949120, 0, 2949120, 0, 6488064, 0, 45, 0,
-45, 0, 1380929348, 51, 99, 2949120, 0, 2949120,
-0, 1329856512, 3363407, 6488064, 0, 45, 0, 45,
-0, 1380929348, 51, 99, 2949120, 0, 2949120, 0,
-1329856512, 3363407, 6488064, 0, 45, 0, 45, 0,
-1380929348, 51, 99, 2949120, 0, 2949120, 0, 1329856512,
-3363407, 6488064, 0, 45, 0, 45, 0, 1380929348,
-51, 99, 2949120, 0, 2949120, 0, 1329856512, 3363407,
-6488064, 0, 45, 0, 45, 0, 1380929348, 51,
-99, 2949120, 0, 2949120, 0, 1329856512, 3363407, 6488064,
-0, 45, 0, 45, 0, 1380929348, 51, 99,
-2949120, 0, 2949120, 0, 2949120, 0, 6488064, 0,
-45, 0, 45, 0, 45, 0, 100, 2949120,
-0, 2949120, 0, 2949120, 0, 6488064, 0, 45,
-0, 45, 0, 45, 0, 100, 2949120, 0,
-2949120, 0, 2949120, 0, 6488064, 0, 45, 0,
-45, 0, 45, 0, 100, 2949120, 0, 2949120,
-0, 1329856512, 3363407, 6488064, 0, 45, 0, 45,
-0, 1380929348, 51, 100, 2949120, 0, 2949120, 0,
-1329856512, 3363407, 6553600, 0, 45, 0, 45, 0,
-1380929348, 51, 100, 2949120, 0, 2949120, 0, 1329856512,
-3363407, 6553600, 0, 45, 0, 45, 0, 1380929348,
-51, 100, 2949120, 0, 2949120, 0, 1329856512, 3363407,
-6553600, 0, 45, 0, 45, 0, 1380929348, 51,
-100, 2949120, 0, 2949120, 0, 1329856512, 3363407, 6553600,
-0, 45, 0, 45, 0, 1380929348, 51, 100,
-2949120, 0, 1397161984, 1162760020, 2949169, 0, 1376256, 0,
-45, 0, 45, 0, 45, 0, 101, 2949120,
-0, 1397161984, 1162760020, 2949169, 0, 1376256, 0, 45,
-0, 45, 0, 45, 0, 101, 2949120, 0,
-1397161984, 1162760020, 2949169, 0, 1376256, 0, 45, 0,
-45, 0, 45, 0, 101, 2949120, 0, 1397161984,
-1162760020, 2949169, 0, 1376256, 0, 45, 0, 45,
-0, 45, 0, 4288675941};
+21037342, 4, 0, 21102593, 262429, 0, 196610, 21954896,
+4, 262144, 18284549, 262424, 0, 458758, 27394455, 4,
+524288, 22085641, 262480, 0, 720906, 27722176, 4, 786432,
+18677773, 262421, 0, 983054, 18088213, 4, 1048576, 18415633,
+262430, 0, 1245202, 18284825, 4, 1310720, 24969237, 65986,
+0, 4294901782, 18153750, 4, 1507328, 21037080, 262466, 0,
+1703961, 18874655, 4, 1769472, 18939932, 262431, 0, 1966109,
+18940194, 4, 2031616, 29491232, 65964, 0, 4294901793, 19136803,
+4, 2228224, 18874403, 262435, 0, 2424868, 26673505, 4,
+2490368, 23068711, 262497, 0, 2687016, 23069026, 4, 2752512,
+23265323, 262498, 0, 2949164, 19661155, 4, 3014656, 27394095,
+262499, 0, 3211312, 27787687, 4, 3276800, 27787315, 262484,
+0, 3473460, 22020435, 4, 3538944, 18219063, 262423, 0,
+3735608, 18284843, 4, 3801088, 20054075, 262440, 0, 3997756,
+19136805, 4, 4063232, 19202111, 262440, 0, 4259904, 19530025,
+4, 4325376, 19529795, 262443, 0, 4522052, 19792173, 4,
+4587520, 23461959, 262503, 0, 4784200, 26870169, 4, 4849664,
+23855179, 262553, 0, 5046348, 23855467, 4, 5111808, 23527503,
+262507, 0, 5308496, 24707448, 4, 5373952, 19136595, 262434,
+0, 5570644, 19202342, 4, 5636096, 19333207, 262438, 0,
+5832792, 19333398, 4, 5898240, 19791963, 262447, 0, 6094940,
+27066734, 4, 6160384, 23920735, 262510, 0, 6357088, 23920999,
+4, 6422528, 27066467, 262524, 0, 6619236, 24838522, 4,
+6684672, 27459687, 262562, 0, 6881384, 26870173, 4, 6946816,
+24903787, 262522, 0, 7143532, 24707452, 4, 7208960, 27525231,
+262563, 0, 7405680, 24641917, 4, 7471104, 24838259, 65918,
+0, 4294901876, 29163964, 4, 7667712, 29229174, 262588, 0,
+7864439, 29229503, 4, 7929856, 29163642, 262591, 0, 8126587,
+28377520, 4, 8192000, 28442750, 262576, 0, 8388735, 28443059,
+4, 8454144, 28377218, 262579, 0, 8650883, 25231744, 4,
+8716288, 25297030, 262528, 0, 8913031, 25297283, 4, 8978432,
+25231498, 262531, 0, 9175179, 26083725, 4, 9240576, 26149006,
+262541, 0, 9437327, 26149264, 4, 9502720, 26083474, 262544,
+0, 9699475, 25756040, 4, 9764864, 25821334, 262536, 0,
+9961623, 25821579, 4, 10027008, 25755802, 262539, 0, 10223771,
+28836279, 4, 10289152, 28901534, 262583, 0, 10485919, 28901818,
+4, 10551296, 28836002, 262586, 0, 10748067, 32833918, 1,
+10813440, 25100287, 262527, 0, 10944678, 25100790, 1, 11010048,
+29687807, 262603, 0, 11141289, 24969599, 1, 11206656, 25624575,
+65915, 0, 4294901932, 25559411, 1, 11337728, 24838143, 262548,
+0, 11468974, 22348116, 4, 11534336, 19726513, 262451, 0,
+11731122, 24314258, 4, 11796480, 24379573, 262546, 0, 11993270,
+19464482, 4, 12058624, 19398841, 262502, 0, 12255418, 23462249,
+4, 12320768, 23724221, 262505, 0, 12517566, 23724388, 4,
+12582912, 23396545, 262500, 0, 12779714, 23396760, 4, 12845056,
+27001029, 262552, 0, 13041862, 24641984, 4, 13107200, 22347977,
+262483, 0, 13304010, 29360556, 4, 13369344, 29556941, 262596,
+0, 13566158, 30605778, 1, 13631488, 5439487, 262227, 0,
+13762769, 30212178, 1, 13828096, 30277631, 65998, 0, 4294901972,
+30343630, 1, 13959168, 30408703, 66001, 0, 4294901974, 29753809,
+1, 14090240, 29818879, 65991, 0, 4294901976, 31982051, 1,
+14221312, 31784959, 66019, 0, 4294901978, 31719909, 1, 14352384,
+32047103, 66026, 0, 4294901980, 3932236, 1, 14483456, 4194303,
+65586, 0, 4294901982, 5046324, 1, 14614528, 32178175, 65612,
+0, 4294901984, 29950407, 1, 14745600, 5963775, 65629, 0,
+4294901986, 3276849, 4, 14876672, 6160612, 65583, 0, 4294901989,
+31785460, 1, 15073280, 30015487, 65994, 0, 4294901991, 3997756,
+1, 15204352, 3997695, 262196, 0, 15335657, 3407923, 1,
+15400960, 2686975, 65587, 0, 4294901996, 2621479, 1, 15532032,
+3080191, 65575, 0, 4294901998, 3014703, 1, 15663104, 3145727,
+262234, 0, 15794416, 5898331, 1, 15859712, 7995391, 65622,
+0, 4294902003, 7929897, 1, 15990784, 2752511, 262192, 0,
+16122101, 2883634, 1, 16187392, 4128767, 262193, 0, 16318712,
+9895980, 1, 16384000, 11468799, 65711, 0, 4294902011, 2949272,
+1, 16515072, 2949119, 262189, 0, 16646397, 2687021, 1,
+16711680, 9961471, 65671, 0, 4294902016, 9961623, 4, 16842752,
+9306370, 65688, 0, 4294902019, 11534584, 4, 17039360, 11534597,
+262319, 0, 17236230, 7209071, 4, 17301504, 7340297, 262255,
+0, 17498378, 7340145, 4, 17563648, 7209229, 262257, 0,
+17760526, 4194367, 4, 17825792, 3473681, 65590, 0, 4294902034,
+3670071, 1, 18022400, 4259839, 262209, 0, 18153748, 4587589,
+4, 18219008, 4653335, 262213, 0, 18415896, 4653128, 4,
+18481152, 4587803, 262216, 0, 18678044, 3473469, 1, 18743296,
+4063231, 262206, 0, 18874655, 4390978, 1, 18939904, 4325375,
+65602, 0, 4294902050, 8126531, 1, 19070976, 4456447, 262207,
+0, 19202340, 4128893, 1, 19267584, 8060927, 65659, 0,
+4294902055, 7995516, 1, 19398656, 8191999, 262269, 0, 19530025,
+8192126, 1, 19595264, 11468799, 262321, 0, 19726636, 11600050,
+1, 19791872, 8519679, 262272, 0, 19923247, 8454275, 4,
+19988480, 8651058, 262275, 0, 20185395, 8650880, 4, 20250624,
+3539254, 262201, 0, 20447543, 3735635, 1, 20512768, 30146559,
+262227, 0, 20644154, 5374006, 1, 20709376, 3801087, 65594,
+0, 4294902077, 29557194, 1, 20840448, 1900543, 65567, 0,
+4294902079, 1835035, 1, 20971520, 11665407, 65776, 0, 4294902081,
+4259896, 1, 21102592, 3735551, 262203, 0, 21233987, 3473467,
+4, 21299200, 29557062, 65565, 0, 4294902087, 1966109, 1,
+21495808, 14155775, 65761, 0, 4294902089, 11403505, 1, 21626880,
+15663103, 65777, 0, 4294902091, 15597805, 1, 21757952, 8126463,
+65714, 0, 4294902093, 8323195, 4, 21889024, 8323407, 262270,
+0, 22085968, 8257671, 1, 22151168, 8912895, 262277, 0,
+22282579, 8978565, 4, 22347776, 8978774, 262286, 0, 22544727,
+3604538, 1, 22609920, 9830399, 65678, 0, 4294902106, 9765125,
+1, 22740992, 32899071, 66036, 0, 4294902108, 32899573, 4,
+22872064, 32964958, 66038, 0, 4294902111, 32965095, 1, 23068672,
+32505855, 66023, 0, 4294902113, 32440816, 1, 23199744, 32702463,
+66032, 0, 4294902115, 32637427, 1, 23330816, 6160383, 66035,
+0, 4294902117, 6160477, 4, 23461888, 32244071, 65630, 0,
+4294902120, 32244180, 1, 23658496, 30736383, 262613, 0, 23789930,
+31261141, 4, 23855104, 31261037, 262625, 0, 24052078, 30933473,
+4, 24117248, 30933361, 262610, 0, 24314226, 30540267, 1,
+24379392, 5111807, 66027, 0, 4294902133, 4980813, 4, 24510464,
+30605687, 66029, 0, 4294902136, 32375277, 1, 24707072, 32440319,
+66009, 0, 4294902138, 30998995, 4, 24838144, 30998908, 66004,
+0, 4294902141, 1638421, 4, 25034752, 1442175, 262165, 0,
+25231744, 1441816, 4, 25296896, 1638787, 262168, 0, 25493892,
+12648639, 4, 25559040, 12583303, 262335, 0, 25756040, 12583106,
+4, 25821184, 12648843, 262338, 0, 26018188, 11337881, 4,
+26083328, 10092943, 262297, 0, 26280336, 10092716, 4, 26345472,
+11338131, 262316, 0, 26542484, 15139011, 4, 26607616, 12845463,
+262339, 0, 26804632, 12845288, 4, 26869760, 15139227, 262376,
+0, 27066780, 15270122, 4, 27131904, 15270303, 262388, 0,
+27328928, 15925492, 4, 27394048, 15925667, 262378, 0, 27591076,
+16449771, 4, 27656192, 15466919, 262379, 0, 27853224, 15466746,
+4, 27918336, 16449963, 262394, 0, 28115372, 16646390, 1,
+28180480, 16711679, 65773, 0, 4294902191, 15532249, 4, 28311552,
+14090673, 262361, 0, 28508594, 16318639, 1, 28573696, 16383999,
+65782, 0, 4294902197, 10879141, 4, 28704768, 10944951, 262309,
+0, 28901816, 10944680, 4, 28966912, 10879419, 262312, 0,
+29163964, 9175178, 4, 29229056, 9175487, 262285, 0, 29426112,
+9109645, 4, 29491200, 9109955, 262282, 0, 29688260, 9502864,
+4, 29753344, 9503175, 262290, 0, 29950408, 9633938, 4,
+30015488, 9634251, 262288, 0, 30212556, 7667827, 4, 30277632,
+7668175, 262262, 0, 30474704, 7602294, 4, 30539776, 7602643,
+262259, 0, 30736852, 5963868, 4, 30801920, 5505495, 65621,
+0, 4294902232, 5505110, 1, 30998528, 3211263, 262236, 0,
+31130074, 5701729, 1, 31195136, 6291455, 65632, 0, 4294902237,
+5767255, 1, 31326208, 5636095, 65634, 0, 4294902239, 5701717,
+4, 31457280, 5767649, 65627, 0, 4294902242, 5832792, 4,
+31653888, 5833188, 262230, 0, 31850981, 16056566, 4, 31916032,
+16056808, 262392, 0, 32113129, 15663344, 1, 32178176, 5242879,
+65619, 0, 4294902252, 1769502, 1, 32309248, 5177343, 65615,
+0, 4294902254, 5111888, 1, 32440320, 5373951, 65616, 0,
+4294902256, 5308450, 1, 32571392, 2359295, 65569, 0, 4294902258,
+2293796, 1, 32702464, 22806527, 262490, 0, 32834036, 2359297,
+1, 32899072, 65535, 65537, 0, 4294902263, 2490405, 1,
+33030144, 2097151, 65568, 0, 4294902265, 196646, 1, 33161216,
+28246015, 262491, 0, 33292795, 2490404, 4, 33357824, 131582,
+65536, 0, 4294902271, 262164, 1, 33554432, 1245183, 262156,
+0, 33686017, 720908, 4, 33751040, 524804, 65545, 0,
+4294902277, 524291, 1, 33947648, 262143, 262145, 0, 34079239,
+1245195, 1, 34144256, 1179647, 65556, 0, 4294902282, 1114128,
+1, 34275328, 1310719, 65554, 0, 4294902284, 1048590, 4,
+34406400, 983566, 262158, 0, 34603535, 983057, 4, 34668544,
+1180178, 65552, 0, 4294902291, 393220, 1, 34865152, 458751,
+65543, 0, 4294902293, 327687, 1, 34996224, 327679, 262149,
+0, 35127831, 131077, 1, 35192832, 655359, 65547, 0,
+4294902298, 655369, 4, 35323904, 655900, 262164, 0, 35521053,
+11927733, 1, 35586048, 12124159, 65723, 0, 4294902304, 12320955,
+1, 35717120, 12386303, 65717, 0, 4294902306, 12386486, 1,
+35848192, 12451839, 65726, 0, 4294902308, 11993278, 1, 35979264,
+11993087, 262327, 0, 36110886, 12058807, 1, 36175872, 14352383,
+262363, 0, 36307497, 14549211, 4, 36372480, 14549548, 262365,
+0, 36569645, 14287069, 4, 36634624, 14615088, 262368, 0,
+36831793, 14942432, 4, 36896768, 14942772, 262370, 0, 37093941,
+14614754, 4, 37158912, 17236536, 262403, 0, 37356089, 17105155,
+4, 37421056, 17302076, 65797, 0, 4294902333, 17301767, 1,
+37617664, 14811135, 262371, 0, 37749311, 17367267, 4, 37814272,
+17367618, 262410, 0, 38011459, 17432801, 1, 38076416, 17498111,
+65799, 0, 4294902342, 13500621, 4, 38207488, 13501000, 262351,
+0, 38404681, 13631695, 4, 38469632, 13632076, 262349, 0,
+38666829, 13762769, 4, 38731776, 13763152, 262355, 0, 38928977,
+13893843, 4, 38993920, 13894228, 262353, 0, 39191125, 12976325,
+4, 39256064, 12976728, 262343, 0, 39453273, 13107399, 4,
+39518208, 13107804, 262341, 0, 39715421, 13238473, 4, 39780352,
+13238880, 262347, 0, 39977569, 13369547, 4, 40042496, 13369956,
+262345, 0, 40239717, 14024917, 4, 40304640, 14025320, 262411,
+0, 40501865, 17563915, 4, 40566784, 17564268, 262357, 0,
+40764013, 17629414, 4, 40828928, 17629808, 262414, 0, 41026161,
+15008014, 4, 41091072, 15008372, 262374, 0, 41288309, 10485915,
+4, 41353216, 10486392, 262303, 0, 41550457, 10223775, 4,
+41615360, 10224252, 262299, 0, 41812605, 10354845, 4, 41877504,
+10355328, 262306, 0, 42074753, 10551458, 4, 42139648, 10551940,
+262301, 0, 42336901, 10748067, 4, 42401792, 10748552, 262415,
+0, 42599049, 17826063, 4, 42663936, 17826444, 262307, 0,
+42861197, 16711936, 4, 42926080, 16712336, 262401, 0, 43123345,
+16908545, 4, 43188224, 16908948, 262400, 0, 43385493, 15663342,
+4, 43450368, 15663768, 65751, 0, 4294902425, 21365061, 4,
+43646976, 21430939, 262469, 0, 43844252, 21430600, 4, 43909120,
+21365407, 262472, 0, 44106400, 20840765, 4, 44171264, 20906659,
+262461, 0, 44368548, 20906304, 4, 44433408, 20841127, 262464,
+0, 44630696, 27328890, 4, 44695552, 27329195, 262558, 0,
+44892844, 24314226, 1, 44957696, 24117247, 65906, 0, 4294902447,
+24445300, 4, 45088768, 24445617, 262450, 0, 45286066, 20054324,
+4, 45350912, 20120245, 262452, 0, 45548214, 20513075, 4,
+45613056, 20513465, 262454, 0, 45810362, 20382006, 4, 45875200,
+19661501, 262441, 0, 46072510, 22282540, 4, 46137344, 24117953,
+262511, 0, 46334658, 22282586, 4, 46399488, 24707781, 262554,
+0, 46596806, 27001242, 4, 46661632, 27001545, 262566, 0,
+46858954, 27525542, 4, 46923776, 22545101, 262483, 0, 47121102,
+22544729, 4, 47185920, 22676177, 262489, 0, 47383250, 24117622,
+4, 47448064, 20054741, 262455, 0, 47645398, 20578615, 4,
+47710208, 20579033, 262518, 0, 47907546, 27984298, 1, 47972352,
+28114943, 65962, 0, 4294902493, 24052081, 1, 48103424, 21823487,
+65905, 0, 4294902495, 21758285, 1, 48234496, 23003135, 65869,
+0, 4294902497, 22937951, 1, 48365568, 28311551, 65887, 0,
+4294902499, 28246443, 1, 48496640, 28049407, 262573, 0, 48628453,
+28180909, 4, 48693248, 2097896, 262177, 0, 48890601, 2228257,
+1, 48955392, 2162687, 65573, 0, 4294902508, 26542481, 4,
+49086464, 26280686, 262546, 0, 49283823, 24379797, 4, 49348608,
+26411762, 262550, 0, 49545971, 26280339, 4, 49610752, 26608374,
+262549, 0, 49808119, 27132308, 4, 49872896, 26477306, 262547,
+0, 50070267, 26608030, 4, 50135040, 19858174, 262448, 0,
+50332415, 19726640, 4, 50397184, 19858178, 262418, 0, 50594563,
+17891602, 4, 50659328, 17892102, 262448, 0, 50856711, 18022674,
+4, 50921472, 18023178, 262420, 0, 51118859, 17891604, 4,
+51183616, 18023182, 262422, 0, 51381007, 18481432, 4, 51445760,
+18481938, 262425, 0, 51643155, 18546968, 4, 51707904, 18547478,
+262428, 0, 51905303, 18481436, 4, 51970048, 18547482, 262478,
+0, 52167451, 21954894, 4, 52232192, 21955358, 262428, 0,
+52429599, 22085966, 4, 52494336, 6292258, 65633, 0, 4294902563,
+6357090, 4, 52690944, 6423333, 65635, 0, 4294902566, 6553699,
+1, 52887552, 6619135, 65637, 0, 4294902568, 6684773, 1,
+53018624, 6750207, 65639, 0, 4294902570, 6815847, 1, 53149696,
+6881279, 65641, 0, 4294902572, 6946921, 1, 53280768, 7012351,
+65643, 0, 4294902574, 7077995, 1, 53411840, 7143423, 66044,
+0, 4294902576, 33358328, 4, 53542912, 33096498, 262648, 0,
+53740339, 33096188, 4, 53805056, 33358646, 65631, 0, 4294902583,
+33358340, 1, 54001664, 33947647, 66052, 0, 4294902585, 33882630,
+1, 54132736, 34078719, 66054, 0, 4294902587, 34013694, 1,
+54263808, 33554431, 66046, 0, 4294902589, 33489409, 1, 54394880,
+33751039, 66049, 0, 4294902591, 33686012, 1, 54525952, 31195135,
+262623, 0, 54657857, 31457759, 4, 54722560, 31458116, 262618,
+0, 54920005, 31130074, 4, 54984704, 840};
+extern const uint32_t mercury_WADSideDefs[2523] = {
+0, 0, 131072, 0, 0, 5636096, 0, 0,
+131072, 0, 0, 5636096, 0, 0, 0, 96,
+0, 5636096, 0, 65536, 6291456, 96, 0, 5570560,
+0, 131072, 327680, 0, 0, 1245184, 0, 0,
+0, 0, 0, 5570560, 0, 65536, 5373952, 0,
+0, 5439488, 0, 0, 131072, 0, 0, 5636096,
+0, 0, 65536, 96, 65536, 5636096, 0, 0,
+131072, 0, 0, 5636096, 0, 0, 6291456, 0,
+0, 131072, 0, 0, 1179649, 0, 0, 65536,
+0, 0, 131072, 0, 0, 131072, 0, 0,
+5636096, 0, 196608, 196608, 0, 0, 262144, 0,
+196608, 196608, 0, 0, 262144, 0, 196608, 196608,
+0, 0, 262144, 0, 0, 1179649, 0, 196608,
+196608, 0, 0, 262144, 0, 196608, 196608, 0,
+0, 262144, 0, 131072, 327680, 0, 0, 1245184,
+0, 131072, 327680, 0, 0, 1245184, 0, 131072,
+327680, 0, 0, 1245184, 0, 131072, 327680, 0,
+0, 1245184, 0, 65536, 1245184, 0, 0, 5373952,
+0, 65536, 327680, 0, 0, 5373952, 0, 65536,
+5373952, 0, 0, 5439488, 0, 65536, 5373952, 0,
+0, 5439488, 0, 0, 5570560, 0, 0, 5636096,
+64, 196608, 131072, 0, 0, 262144, 0, 65536,
+262144, 0, 0, 5570560, 0, 65536, 5505024, 0,
+0, 5308416, 0, 65536, 262144, 0, 0, 1245184,
+0, 0, 1245184, 0, 0, 5505024, 0, 65536,
+262144, 0, 0, 5570560, 0, 65536, 262144, 0,
+0, 5570560, 0, 65536, 6094848, 0, 0, 5505024,
+0, 65536, 393216, 0, 1, 5308416, 0, 131072,
+393216, 0, 0, 458752, 0, 131072, 393216, 0,
+0, 458752, 0, 131072, 393216, 0, 0, 458752,
+0, 131072, 393216, 0, 0, 458752, 0, 65536,
+589824, 0, 1, 5373952, 0, 65536, 196608, 0,
+0, 1245184, 0, 65536, 262144, 0, 0, 5505024,
+0, 65536, 262144, 0, 0, 5505024, 0, 65536,
+262144, 0, 0, 5505024, 0, 65536, 6094848, 96,
+0, 5505024, 0, 65536, 458752, 0, 65536, 5308416,
+0, 65536, 458752, 0, 65536, 5308416, 0, 65536,
+458752, 0, 65536, 5308416, 0, 65536, 524288, 0,
+65537, 5308416, 0, 0, 589824, 0, 0, 1114112,
+0, 65536, 1245184, 0, 0, 5373952, 524416, 1,
+458752, 1048576, 0, 524288, 0, 65536, 589824, 0,
+65537, 5308416, 0, 0, 524288, 524288, 1, 589824,
+0, 65536, 1245184, 0, 0, 5373952, 0, 0,
+589824, 0, 0, 1179648, 0, 0, 589825, 0,
+0, 655360, 0, 262144, 1179648, 0, 0, 655360,
+0, 262144, 1179648, 0, 0, 655360, 0, 0,
+1179648, 0, 0, 655360, 0, 262144, 1179648, 0,
+0, 720896, 0, 262144, 1179648, 0, 0, 720896,
+0, 262144, 1179648, 0, 0, 720896, 0, 0,
+1179648, 0, 0, 720896, 0, 262144, 1179648, 0,
+0, 786432, 0, 262144, 1114112, 0, 0, 786432,
+0, 0, 1114112, 0, 0, 786432, 0, 262144,
+1114112, 0, 0, 786432, 0, 262144, 1114112, 0,
+0, 851968, 0, 262144, 1114112, 0, 0, 851968,
+0, 0, 1114112, 0, 0, 851968, 0, 262144,
+1114112, 0, 0, 851968, 0, 262144, 1114112, 0,
+0, 917504, 0, 0, 1114112, 0, 0, 917504,
+0, 262144, 1114112, 0, 0, 917504, 0, 262144,
+1114112, 0, 0, 917504, 0, 262144, 1114112, 0,
+0, 983040, 0, 262144, 1179648, 0, 0, 983040,
+0, 262144, 1179648, 0, 0, 983040, 0, 0,
+1179648, 0, 0, 983040, 0, 262144, 1179648, 0,
+0, 1048577, 524352, 1, 589824, 1048576, 0, 1048576,
+0, 0, 1048577, 0, 0, 1310720, 0, 65536,
+5832704, 128, 0, 589825, 0, 0, 1114113, 0,
+0, 1114113, 0, 65536, 1114112, 96, 1, 5177344,
+0, 65536, 5570560, 0, 0, 5701632, 0, 0,
+5505024, 0, 65536, 5636096, 128, 65536, 1114112, 0,
+1, 5242880, 0, 65536, 5898240, 0, 0, 5242880,
+0, 65536, 262144, 0, 0, 1245184, 0, 65537,
+1245184, 0, 65536, 5308416, 0, 131072, 393216, 0,
+0, 1245184, 0, 131072, 393216, 0, 0, 1245184,
+0, 131072, 393216, 0, 0, 1245184, 0, 131072,
+393216, 0, 0, 1245184, 0, 131072, 393216, 0,
+0, 1245184, 0, 131072, 393216, 0, 0, 1245184,
+64, 65536, 1179648, 0, 1, 5373952, 0, 65536,
+5570560, 0, 0, 5701632, 0, 65536, 1179648, 0,
+1, 5439488, 0, 0, 1310720, 0, 65536, 5832704,
+128, 0, 1376257, 0, 0, 2228224, 0, 1,
+1310720, 0, 0, 1310721, 0, 0, 1310721, 0,
+0, 1310721, 0, 0, 1310721, 0, 0, 1310721,
+0, 0, 1310721, 0, 0, 2490369, 0, 0,
+2490369, 0, 0, 2490369, 0, 0, 2490369, 0,
+0, 1441793, 0, 0, 2293761, 0, 0, 1441793,
+0, 0, 2490369, 0, 0, 1310721, 0, 0,
+1507329, 0, 0, 1572864, 0, 0, 2293760, 0,
+0, 1507329, 0, 0, 2490369, 0, 0, 1310721,
+0, 0, 1572865, 0, 0, 1441792, 0, 0,
+1572864, 0, 0, 1572865, 0, 0, 1572865, 0,
+0, 1572865, 0, 0, 1572865, 0, 0, 1572865,
+0, 0, 1507328, 0, 0, 1572864, 0, 0,
+1572865, 0, 0, 3473409, 0, 0, 3473409, 0,
+0, 1572864, 0, 0, 3473408, 0, 0, 1572865,
+0, 0, 1572864, 0, 0, 2293760, 0, 0,
+1638401, 0, 0, 2359297, 0, 0, 1638401, 192,
+0, 1572864, 0, 0, 1638400, 256, 0, 1572865,
+0, 0, 1703937, 0, 0, 1638400, 0, 0,
+1703936, 0, 0, 1703937, 0, 0, 3014656, 0,
+0, 2359296, 0, 0, 3014656, 0, 0, 2359296,
+0, 0, 1769472, 0, 0, 3473408, 0, 0,
+1769472, 0, 0, 3473408, 0, 0, 1769472, 0,
+0, 3473408, 0, 0, 1769472, 0, 0, 3473408,
+0, 0, 1966080, 0, 0, 2293760, 0, 0,
+1835009, 0, 0, 1835009, 0, 0, 1966080, 0,
+0, 2293760, 0, 0, 1900544, 0, 0, 2293760,
+0, 0, 1900544, 0, 0, 2293760, 0, 0,
+1900544, 0, 0, 2293760, 0, 0, 1900544, 0,
+0, 2293760, 0, 0, 2293761, 0, 0, 1572864,
+0, 0, 2293760, 0, 0, 1966081, 0, 0,
+1966081, 0, 0, 2031617, 64, 0, 1966080, 0,
+0, 2031616, 0, 0, 2031617, 0, 0, 2097153,
+0, 0, 2097153, 0, 0, 2031616, 0, 0,
+2097152, 0, 0, 2097153, 0, 0, 3538944, 0,
+0, 2359296, 0, 0, 2359297, 0, 0, 2162688,
+0, 0, 2359296, 0, 0, 2162688, 0, 0,
+2359296, 0, 0, 2162688, 0, 0, 2359296, 0,
+0, 2162688, 0, 0, 2359296, 64, 0, 1835008,
+0, 0, 2228224, 0, 0, 2228225, 0, 0,
+1310720, 0, 65536, 5832704, 0, 0, 2228225, 128,
+0, 1835009, 0, 0, 1310721, 0, 0, 5832705,
+0, 0, 5832705, 0, 0, 3538945, 0, 0,
+2293761, 0, 0, 1835008, 0, 0, 2293760, 0,
+0, 1835008, 0, 0, 2293760, 0, 0, 5832705,
+0, 0, 5832705, 0, 0, 2359297, 0, 0,
+3538945, 0, 0, 3538945, 0, 0, 4980737, 0,
+0, 2359297, 0, 0, 2097152, 0, 0, 2359296,
+0, 0, 2097152, 0, 0, 2359296, 0, 0,
+2359297, 0, 0, 1703936, 0, 0, 2359296, 0,
+0, 1703936, 0, 0, 2359296, 0, 0, 1703936,
+0, 0, 2359296, 192, 0, 1835009, 0, 0,
+2359297, 64, 0, 2359297, 0, 0, 2490369, 0,
+0, 1048576, 0, 1, 2490368, 0, 0, 2490369,
+0, 0, 2490369, 0, 0, 2490369, 0, 0,
+2490369, 0, 0, 2490369, 0, 0, 2490369, 0,
+0, 2490369, 0, 0, 1507328, 0, 1, 2490368,
+0, 0, 2490369, 0, 0, 2490369, 448, 196608,
+1376256, 0, 0, 2490368, 0, 196608, 1376256, 0,
+0, 2490368, 0, 196608, 1376256, 0, 0, 2490368,
+0, 196608, 1376256, 0, 0, 2490368, 0, 196608,
+1376256, 0, 0, 2490368, 0, 0, 2490369, 0,
+0, 2490369, 0, 0, 1441792, 0, 1, 2490368,
+0, 0, 2555905, 0, 0, 2555905, 0, 0,
+2555905, 192, 196609, 1376256, 0, 0, 2555904, 384,
+0, 1376257, 0, 0, 2621440, 0, 0, 3932160,
+0, 0, 2621440, 0, 0, 3932160, 0, 0,
+2621440, 0, 0, 3932160, 0, 0, 2621440, 0,
+0, 3932160, 0, 0, 2686976, 0, 0, 2359296,
+0, 0, 2686976, 0, 0, 2359296, 0, 0,
+2686976, 0, 0, 2359296, 0, 0, 2686976, 0,
+0, 2359296, 0, 0, 2752512, 0, 196608, 2359296,
+0, 0, 2752512, 0, 196608, 2359296, 0, 0,
+2752512, 0, 0, 2359296, 0, 0, 2752512, 0,
+0, 2359296, 0, 0, 2818048, 0, 0, 2359296,
+0, 0, 2818048, 0, 0, 2359296, 0, 0,
+2818048, 0, 0, 2359296, 0, 0, 2818048, 0,
+0, 2359296, 0, 0, 2883584, 0, 0, 2359296,
+0, 0, 2883584, 0, 0, 2359296, 0, 0,
+2883584, 0, 0, 2359296, 0, 0, 2883584, 0,
+0, 2359296, 0, 0, 2949120, 0, 0, 2359296,
+0, 0, 2949120, 0, 0, 2359296, 0, 0,
+2949120, 0, 0, 2359296, 0, 0, 2949120, 0,
+0, 2359296, 0, 0, 2359297, 0, 0, 2359297,
+0, 0, 4980736, 0, 0, 2359296, 0, 0,
+4980736, 0, 0, 2359296, 0, 0, 3014657, 0,
+0, 3014657, 0, 0, 3080192, 0, 0, 2359296,
+0, 0, 3080192, 0, 0, 2359296, 0, 0,
+3080192, 0, 0, 2359296, 0, 0, 3080192, 0,
+0, 2359296, 0, 0, 3145728, 0, 0, 2359296,
+0, 0, 3145728, 0, 0, 2359296, 0, 0,
+3145728, 0, 0, 2359296, 0, 0, 3145728, 0,
+0, 2359296, 0, 0, 3211264, 0, 0, 2359296,
+0, 0, 3211264, 0, 0, 2359296, 0, 0,
+3211264, 0, 0, 2359296, 0, 0, 3211264, 0,
+0, 2359296, 0, 0, 3276800, 0, 0, 3473408,
+0, 0, 3276800, 0, 0, 3473408, 0, 0,
+3276800, 0, 0, 3473408, 0, 0, 3276800, 0,
+0, 3473408, 0, 0, 1572864, 0, 0, 3473408,
+0, 0, 3342337, 0, 0, 3342337, 0, 0,
+1572864, 0, 0, 3473408, 0, 0, 3407873, 0,
+0, 6488065, 128, 0, 3342337, 0, 0, 3407873,
+64, 0, 3342336, 0, 0, 3407872, 0, 0,
+3473409, 0, 0, 3342336, 0, 0, 3473408, 0,
+0, 3342336, 0, 0, 3473408, 0, 0, 3014656,
+0, 0, 2359296, 0, 0, 3014656, 0, 0,
+2359296, 0, 0, 3538945, 0, 0, 5832705, 0,
+327680, 5832709, 0, 0, 5832705, 0, 327680, 5832709,
+0, 0, 5832705, 0, 0, 5832705, 0, 0,
+3604481, 0, 0, 3604481, 0, 0, 5439488, 0,
+65536, 5636096, 0, 0, 2424833, 0, 0, 3670017,
+0, 0, 3604481, 0, 0, 5832705, 0, 0,
+2424833, 0, 0, 5439488, 0, 65536, 5636096, 0,
+0, 2424832, 0, 65537, 3604480, 0, 0, 3670017,
+0, 0, 3670017, 0, 0, 3735552, 0, 0,
+3932160, 0, 0, 3735552, 0, 0, 3932160, 0,
+0, 3670017, 0, 0, 3670017, 0, 0, 2424832,
+0, 0, 3670016, 0, 0, 3735553, 0, 0,
+3932161, 0, 0, 3801089, 0, 0, 3735553, 0,
+0, 3801088, 0, 0, 3932160, 0, 0, 3801088,
+0, 0, 3932160, 0, 0, 3801088, 0, 0,
+3932160, 0, 0, 3932161, 0, 0, 3866625, 0,
+0, 3866625, 0, 0, 3866625, 64, 0, 3670016,
+0, 0, 3866624, 128, 0, 3670017, 0, 0,
+3932161, 0, 0, 3670016, 0, 0, 3932160, 0,
+0, 3670016, 0, 0, 3932160, 0, 0, 2752513,
+0, 0, 2752513, 0, 0, 2752513, 0, 0,
+2752513, 0, 0, 3997697, 0, 0, 3997697, 0,
+0, 3997697, 64, 1, 2752512, 64, 0, 3997696,
+128, 0, 2752513, 0, 0, 2359296, 0, 0,
+4063232, 0, 0, 2359296, 0, 0, 4063232, 0,
+0, 2359296, 0, 0, 4063232, 0, 0, 2359296,
+0, 0, 4063232, 0, 0, 2359296, 0, 0,
+4128768, 0, 0, 2359296, 0, 0, 4128768, 0,
+0, 2359296, 0, 0, 4128768, 0, 0, 2359296,
+0, 0, 4128768, 0, 0, 2359296, 0, 0,
+4194304, 0, 0, 2359296, 0, 0, 4194304, 0,
+0, 4194305, 704, 0, 4194305, 0, 0, 2359296,
+0, 0, 4259840, 0, 0, 2359296, 0, 0,
+4259840, 0, 0, 2359296, 0, 0, 4259840, 576,
+0, 4259841, 640, 0, 2359297, 0, 0, 2359296,
+0, 0, 4325376, 0, 0, 2359296, 0, 0,
+4325376, 0, 0, 2359296, 0, 0, 4325376, 0,
+0, 2359296, 0, 0, 4325376, 0, 0, 2359296,
+0, 0, 4390912, 0, 0, 2359296, 0, 0,
+4390912, 0, 0, 2359296, 0, 0, 4390912, 0,
+0, 2359296, 0, 0, 4390912, 0, 0, 2359296,
+0, 0, 4456448, 0, 0, 2359296, 0, 0,
+4456448, 0, 0, 2359296, 0, 0, 4456448, 0,
+0, 2359296, 0, 0, 4456448, 0, 0, 2359296,
+0, 0, 4521984, 0, 0, 2359296, 0, 0,
+4521984, 0, 0, 2359296, 0, 0, 4521984, 0,
+0, 2359296, 0, 0, 4521984, 0, 0, 2359296,
+0, 0, 4587520, 0, 0, 2359296, 0, 0,
+4587520, 0, 0, 2359296, 0, 0, 4587520, 0,
+0, 2359296, 0, 0, 4587520, 0, 0, 2359296,
+0, 0, 4653056, 0, 0, 2359296, 0, 0,
+4653056, 0, 0, 2359296, 0, 0, 4653056, 0,
+0, 2359296, 0, 0, 4653056, 0, 0, 4718592,
+0, 0, 2359296, 0, 0, 4718592, 0, 0,
+2359296, 0, 0, 4718592, 0, 0, 2359296, 0,
+0, 4718592, 0, 0, 2359296, 0, 0, 2359296,
+0, 0, 4784128, 0, 0, 2359296, 0, 0,
+4784128, 0, 0, 2359296, 0, 0, 4784128, 0,
+0, 2359296, 0, 0, 4784128, 0, 0, 2359296,
+0, 0, 4849664, 0, 0, 2359296, 0, 0,
+4849664, 0, 0, 2359296, 0, 0, 4849664, 0,
+0, 2359296, 0, 0, 4849664, 0, 0, 2359296,
+0, 0, 4915200, 0, 0, 2359296, 0, 0,
+4915200, 0, 0, 2359296, 0, 0, 4915200, 0,
+0, 2359296, 0, 0, 4915200, 0, 0, 4980736,
+0, 0, 3538944, 640, 0, 4980737, 0, 0,
+5046272, 0, 196609, 5636096, 0, 0, 5046272, 0,
+196609, 5636096, 0, 0, 5046272, 0, 196609, 5636096,
+0, 0, 5046272, 0, 196609, 5636096, 0, 0,
+5111808, 0, 196609, 5636096, 0, 0, 5111808, 0,
+196609, 5636096, 0, 0, 5111808, 0, 196609, 5636096,
+0, 0, 5111808, 0, 196609, 5636096, 0, 0,
+5177344, 0, 65536, 5308416, 0, 0, 5177344, 96,
+65536, 5308416, 0, 0, 5242881, 0, 0, 5242881,
+0, 0, 5242880, 0, 65536, 5308416, 0, 0,
+5242880, 0, 65536, 5308416, 0, 65536, 5505024, 0,
+0, 5767168, 0, 65536, 5505024, 0, 0, 5767168,
+0, 0, 5767168, 0, 65536, 5636096, 0, 0,
+5767168, 0, 65536, 5636096, 0, 0, 5767168, 0,
+65536, 5636096, 0, 0, 1245184, 0, 0, 5570560,
+0, 65536, 5570560, 0, 0, 5373952, 0, 0,
+5242880, 0, 65536, 5636096, 0, 0, 5439488, 0,
+0, 5701632, 0, 65536, 524288, 0, 1, 5373952,
+0, 65536, 393216, 0, 0, 5373952, 0, 65536,
+1245184, 0, 0, 5373952, 0, 65536, 1245184, 0,
+0, 5373952, 0, 0, 5701632, 0, 65536, 5636096,
+0, 0, 5701632, 0, 65536, 5636096, 0, 0,
+5701632, 0, 65536, 5636096, 0, 0, 5242880, 0,
+65536, 5636096, 0, 0, 5242880, 0, 0, 5767168,
+0, 0, 5242880, 0, 65536, 5636096, 0, 0,
+5242880, 0, 65536, 5636096, 0, 0, 5439489, 0,
+0, 5439489, 0, 0, 5636097, 0, 0, 5636097,
+0, 0, 5636097, 0, 0, 5636097, 0, 0,
+5636097, 0, 0, 5636097, 0, 0, 5636097, 0,
+0, 5439488, 0, 65536, 5636096, 0, 0, 5439488,
+0, 65536, 5636096, 0, 327680, 5832709, 0, 0,
+3604485, 32, 0, 5832705, 32, 0, 3604481, 0,
+0, 5898240, 0, 0, 5963776, 96, 65536, 1114112,
+0, 1, 5898240, 96, 0, 5898240, 0, 65536,
+5308416, 0, 0, 5963776, 0, 0, 6029312, 64,
+65536, 1114112, 32, 1, 5963776, 64, 0, 5963776,
+32, 65536, 5308416, 0, 0, 6029312, 0, 0,
+5177344, 32, 65536, 1114112, 64, 1, 6029312, 32,
+0, 6029312, 64, 65536, 5308416, 0, 0, 6094848,
+0, 0, 6160384, 96, 0, 6094848, 0, 65536,
+5636096, 32, 65536, 6160384, 64, 0, 5505024, 0,
+0, 6160384, 0, 0, 6225920, 64, 0, 6160384,
+32, 65536, 5636096, 64, 65536, 6225920, 32, 0,
+5505024, 0, 0, 6225920, 0, 0, 65536, 32,
+0, 6225920, 64, 65536, 5636096, 96, 0, 65536,
+0, 0, 5505024, 0, 0, 6291456, 0, 0,
+6356992, 96, 0, 6291456, 0, 0, 5636096, 32,
+65536, 6356992, 64, 0, 5570560, 0, 0, 6356992,
+0, 0, 6422528, 64, 0, 6356992, 32, 0,
+5636096, 64, 65536, 6422528, 32, 0, 5570560, 0,
+0, 6422528, 0, 0, 0, 32, 0, 6422528,
+64, 0, 5636096, 96, 0, 0, 0, 0,
+5570560, 0, 0, 6488065, 0, 0, 3407872, 0,
+0, 6488064, 0, 0, 6488065, 0, 0, 6488065,
+0, 0, 6488065, 0, 0, 6488065, 0, 0,
+6488065, 0, 0, 6488065, 0, 0, 6488065, 0,
+0, 6488065, 0, 0, 6488065, 0, 0, 6488065,
+0, 0, 6488065, 0, 0, 6488064, 0, 0,
+6553600, 0, 0, 6488064, 0, 0, 6553600, 0,
+0, 6488064, 0, 0, 6553600, 0, 0, 6488065,
+0, 0, 6553601, 0, 0, 6553601, 0, 0,
+6553601, 0, 0, 6553601, 0, 0, 6553601, 0,
+0, 6553601, 0, 0, 6553601, 0, 0, 6553601,
+0, 0, 6553601, 0, 196608, 1376256, 0, 0,
+6619136, 0, 196608, 1376256, 0, 0, 6619136, 0,
+196608, 1376256, 0, 0, 6619136, 0, 196608, 1376256,
+0, 0, 6619136};
 extern const uint32_t mercury_WADSegments[2772] = {
-17826066, 20152320, 0, 17957139, 20561920, 0, 17629456, 20938752,
-1, 19071264, 21692416, 0, 18022691, 21757952, 0, 18940192,
-21512192, 0, 19005729, 21561344, 0, 19071266, 21676032, 0,
-18874659, 21725184, 1, 18612503, 20791296, 0, 18284813, 20873216,
-0, 18546972, 21889024, 0, 18088223, 20709376, 1, 18809116,
-21839872, 0, 18612663, 21921792, 20971521, 18743581, 21299200, 1,
-18219285, 21102592, 0, 18153757, 21250048, 0, 18678046, 21331968,
-0, 18743574, 21413888, 0, 18415892, 20660224, 1, 18678037,
-21282816, 1, 18153753, 21430272, 0, 18088217, 20692992, 0,
-18809108, 20742144, 0, 18350367, 20987904, 0, 18415896, 21168128,
-0, 18874650, 20578304, 0, 18481435, 21970944, 0, 13500621,
-15564800, 1, 18481430, 21037056, 0, 18219294, 21381120, 1,
-28836122, 22003712, 1, 13369551, 15663104, 1, 28770745, 21921792,
-4194305, 13369549, 15515648, 0, 13435086, 15532032, 0, 13500623,
-15613952, 0, 13566156, 15695872, 0, 13566158, 15646720, 1,
-13435084, 15482880, 1, 28901659, 21921792, 1, 18547128, 22003712,
-16777217, 11141289, 12500992, 0, 10748067, 12861440, 0, 11075748,
-19529728, 0, 25624747, 20267008, 0, 25690503, 29425664, 0,
-17432968, 29540352, 0, 25690379, 19906560, 0, 17498382, 19922944,
-0, 17891496, 20185088, 0, 17694993, 20447232, 1, 25624968,
-29458432, 1, 11010439, 29573120, 0, 17694992, 20103168, 0,
-17629457, 20332544, 0, 17891598, 20480000, 0, 17826061, 20905984,
-0, 7733367, 8814592, 0, 28967036, 9289728, 0, 8257979,
-9306112, 8388608, 8454270, 9633792, 0, 8126593, 9699328, 0,
-7798904, 8863744, 0, 7864442, 8945664, 0, 7930298, 9289728,
-12582912, 7274610, 8273920, 0, 7667827, 8683520, 0, 7536758,
-8765440, 0, 29032559, 9306112, 0, 10551437, 10452992, 0,
-9633964, 10502144, 0, 10616993, 12025856, 0, 10879138, 12288000,
-0, 9568403, 12648448, 0, 9240722, 12763136, 0, 11272358,
-13664256, 0, 9109620, 8552448, 0, 7602293, 8617984, 1,
-7471242, 9371648, 0, 9044107, 10960896, 0, 9240715, 10911744,
-0, 9109642, 10993664, 1, 9568397, 12730368, 1, 7012460,
-10403840, 0, 9961579, 10584064, 0, 9896085, 11010048, 0,
-9765016, 11091968, 0, 7078039, 11206656, 0, 7274604, 7929856,
-0, 29098095, 8306688, 1, 7077995, 10371072, 1, 9306255,
-10633216, 0, 9371792, 10715136, 0, 9437329, 10797056, 0,
-9502862, 10813440, 0, 7012797, 10551296, 4194305, 9306257, 10846208,
-1, 29163672, 10551296, 1, 9371790, 10665984, 1, 9961918,
-12599296, 4194304, 9437327, 10682368, 1, 29229203, 12599296, 0,
-9634239, 12681216, 8388609, 7471548, 8306688, 4194305, 9044082, 9404416,
-1, 9502864, 10764288, 1, 29294738, 12681216, 1, 7602280,
-7880704, 0, 6881397, 8044544, 0, 7667828, 8585216, 0,
-6815849, 15106048, 0, 17105159, 19644416, 0, 17236232, 19660800,
-0, 17301769, 19742720, 0, 17039455, 7176192, 0, 10551458,
-11993088, 1, 10617092, 12075008, 0, 6226081, 12238848, 0,
-16843004, 18579456, 0, 16515322, 18661376, 0, 16580862, 18907136,
-0, 16646401, 19038208, 0, 16449789, 19152896, 0, 16384251,
-19202048, 0, 7995515, 9011200, 1, 8061186, 9076736, 0,
-16908400, 18530304, 0, 7340153, 18677760, 0, 7340290, 18497536,
-1, 16908541, 19103744, 0, 16580859, 19185664, 1, 12714107,
-8241152, 0, 7995587, 8339456, 0, 8061050, 8978432, 0,
-12779714, 14450688, 0, 26935551, 18825216, 0, 27066779, 31391744,
-0, 27132317, 31457280, 1, 16646557, 18759680, 0, 27132161,
-18989056, 0, 16843006, 19005440, 1, 27066782, 31490048, 0,
-27001246, 31522816, 0, 27197852, 31637504, 0, 27328928, 31735808,
-0, 27394465, 31784960, 0, 27460002, 31899648, 0, 27591076,
-31997952, 0, 27656613, 32047104, 0, 27722150, 32161792, 0,
-29360252, 9175040, 0, 8126906, 9256960, 4194305, 8847494, 10141696,
-1, 8781959, 10108928, 0, 8847496, 10190848, 0, 8913033,
-10272768, 0, 8978566, 10289152, 0, 29426112, 9175040, 4194304,
-8781961, 10321920, 1, 28967033, 9256960, 1, 8913031, 10158080,
-1, 7929968, 18710528, 1, 8978568, 10240000, 1, 16318710,
-18464768, 1, 16187638, 18219008, 0, 16253175, 18333696, 0,
-16318712, 18382848, 0, 16122105, 18432000, 0, 16253177, 18350080,
-1, 16449986, 19234816, 4194305, 16384451, 9158656, 8388608, 16187640,
-18300928, 1, 29491450, 19234816, 1, 29556861, 9158656, 0,
-8192449, 9175040, 8388608, 16122103, 18251776, 1, 11927705, 11354112,
-0, 10027163, 11436032, 0, 10158236, 11501568, 1, 10223781,
-11567104, 0, 11993270, 13238272, 0, 10813623, 13352960, 0,
-10158231, 11157504, 0, 9896044, 11239424, 1, 7078044, 11321344,
-0, 10223771, 11468800, 0, 10354845, 11780096, 1, 11993253,
-13320192, 1, 10813892, 13402112, 20971520, 10485919, 11878400, 1,
-29687984, 13484032, 1, 10289310, 11747328, 0, 10354847, 11829248,
-0, 10420384, 11911168, 0, 10485917, 11927552, 0, 10420382,
-11796480, 1, 29622449, 13402112, 0, 11600325, 13484032, 4194305,
-11403718, 13582336, 12582913, 15794414, 17940480, 1, 15663342, 17694720,
-0, 15728879, 17809408, 0, 15794416, 17858560, 0, 15597809,
-17907712, 0, 29753524, 13582336, 1, 11796935, 13729792, 29360128,
-15728881, 17825792, 1, 15925490, 17956864, 0, 15991027, 18071552,
-0, 16056564, 18120704, 0, 15859957, 18169856, 0, 15663344,
-17776640, 1, 16056562, 18202624, 1, 29819336, 13729792, 4194304,
-15991029, 18087936, 1, 29884675, 13729792, 0, 16974281, 13811712,
-79691776, 15925492, 18038784, 1, 11600004, 9797632, 0, 8650885,
-9863168, 1, 8716468, 9928704, 0, 11534513, 13451264, 0,
-11403440, 13500416, 0, 11796654, 13615104, 0, 8650878, 9453568,
-0, 8454277, 9617408, 0, 8257665, 9666560, 1, 8716420,
-9830400, 0, 14024917, 16072704, 1, 15597807, 17727488, 1,
-22413651, 25542656, 1, 22544727, 25608192, 0, 22282581, 25378816,
-1, 22282579, 25296896, 0, 22348116, 25411584, 0, 22413653,
-25460736, 0, 22217046, 25509888, 0, 22217044, 25329664, 1,
-22348118, 25427968, 1, 22479194, 25788416, 0, 22675801, 25706496,
-0, 22806875, 25870336, 0, 22610264, 25624576, 0, 22479192,
-25575424, 1, 22544729, 25657344, 1, 22610266, 25739264, 1,
-22675799, 25755648, 1, 15335659, 17432576, 0, 15401196, 17514496,
-0, 15466733, 17596416, 0, 15532266, 17678336, 0, 30081482,
-13271040, 8388609, 15532268, 17563648, 1, 30146742, 13189120, 0,
-11928011, 13271040, 12582913, 15466731, 17547264, 1, 10289312, 11960320,
-1, 30015671, 13271040, 1, 13893847, 16236544, 1, 15335661,
-17645568, 1, 8388735, 9502720, 0, 8585344, 10027008, 1,
-8323202, 11599872, 1, 8519861, 11665408, 0, 11862476, 13189120,
-33554432, 15401194, 17465344, 1, 13893845, 16023552, 0, 13959629,
-16105472, 16777216, 30277844, 16203776, 0, 19398948, 22020096, 0,
-19595560, 22478848, 0, 19202347, 22544384, 0, 30343383, 16121856,
-0, 14090704, 16203776, 16777216, 19333414, 22183936, 0, 19464488,
-22298624, 0, 19530025, 22347776, 0, 19595562, 22462464, 0,
-19398955, 22511616, 1, 30409166, 16203776, 4194304, 19136807, 22265856,
-0, 30212310, 16105472, 0, 14025167, 16121856, 16777216, 19267877,
-22102016, 0, 14090454, 16154624, 1, 13762769, 15810560, 1,
-13631697, 15761408, 0, 13697234, 15843328, 0, 13762771, 15859712,
-0, 13828304, 15941632, 0, 13631699, 15974400, 1, 13828306,
-15892480, 1, 13959380, 15990784, 1, 11534510, 13533184, 1,
-13697232, 15728640, 1, 14287065, 16334848, 1, 21233987, 24297472,
-0, 21168452, 24264704, 1, 21233989, 24346624, 1, 21299526,
-24428544, 1, 21365059, 24444928, 1, 21299524, 24313856, 0,
-21365061, 24395776, 0, 21496135, 24559616, 0, 21627209, 24657920,
-0, 21430600, 24526848, 1, 21496137, 24608768, 1, 21561674,
-24690688, 1, 21627207, 24707072, 1, 21561672, 24576000, 0,
-20709691, 23773184, 0, 20644156, 23740416, 1, 20709693, 23822336,
-1, 20775230, 23904256, 1, 20840763, 23920640, 1, 20775228,
-23789568, 0, 20840765, 23871488, 0, 20971839, 24035328, 0,
-20906304, 24002560, 1, 20971841, 24084480, 1, 21037378, 24166400,
-1, 21102911, 24182784, 1, 21102913, 24133632, 0, 21758283,
-24821760, 0, 21037376, 24051712, 0, 21168454, 24477696, 0,
-21430602, 24739840, 0, 30474471, 12910592, 0, 15139046, 17252352,
-1, 19726636, 22659072, 0, 30540241, 12910592, 4194304, 19661103,
-22839296, 0, 19857710, 22757376, 0, 19988784, 22921216, 0,
-19661101, 22626304, 1, 19726638, 22708224, 1, 19792175, 22790144,
-1, 19857708, 22806528, 1, 19792173, 22675456, 0, 20382162,
-12910592, 12582912, 19923251, 23101440, 0, 20447543, 23445504, 0,
-19923249, 22888448, 1, 19988786, 22970368, 1, 20054323, 23052288,
-1, 20119856, 23068672, 1, 20119858, 23019520, 0, 20054321,
-22937600, 0, 20644158, 23953408, 0, 20906306, 24215552, 0,
-21954898, 25280512, 0, 14155993, 16285696, 0, 14221530, 16367616,
-0, 14287067, 16384000, 0, 14352600, 16465920, 0, 14221528,
-16252928, 1, 14155995, 16498688, 1, 14418141, 16531456, 1,
-14352602, 16416768, 1, 14811361, 16859136, 1, 15073508, 17170432,
-1, 23265508, 13123584, 0, 14942438, 17203200, 0, 15073511,
-17285120, 0, 11731299, 26361856, 0, 15138995, 26411008, 0,
-8519807, 11632640, 0, 11468930, 12533760, 0, 8323250, 13025280,
-0, 30605487, 19398656, 0, 14549215, 16695296, 1, 9830554,
-19283968, 1, 14483676, 16564224, 0, 14549213, 16613376, 0,
-14614750, 16662528, 0, 14418143, 16711680, 0, 14483678, 16580608,
-1, 9830868, 17367040, 8388608, 10092694, 19316736, 0, 9699482,
-19365888, 0, 9699459, 9977856, 1, 10092692, 19333120, 1,
-8585364, 10010624, 0, 8388739, 10059776, 0, 15270016, 17317888,
-0, 30671081, 17367040, 0, 14680291, 17022976, 1, 30802389,
-17055744, 4194304, 14680289, 16809984, 0, 14745826, 16891904, 0,
-14811363, 16908288, 0, 14876896, 16990208, 0, 14876898, 16941056,
-1, 15008214, 17055744, 8388608, 14942437, 17104896, 0, 14614748,
-16744448, 1, 14745824, 16777216, 1, 30736534, 17055744, 0,
-11665763, 13074432, 0, 11731411, 19398656, 8388608, 23265459, 26394624,
-1, 23003488, 26099712, 1, 23069025, 26181632, 1, 23134562,
-26263552, 1, 23200095, 26279936, 1, 30867765, 23199744, 0,
-23003490, 26312704, 0, 30933302, 13811712, 0, 20316631, 23199744,
-4194304, 23200097, 26230784, 0, 29950424, 13811712, 50331648, 15859955,
-17989632, 1, 23134560, 26148864, 0, 20185397, 23150592, 1,
-20250934, 23232512, 1, 20316392, 23314432, 0, 15204660, 23330816,
-0, 20250932, 23183360, 0, 20578617, 23543808, 0, 20185402,
-23658496, 0, 21889357, 24920064, 0, 22085968, 25116672, 0,
-22937949, 25968640, 0, 23069023, 26132480, 0, 21692748, 24788992,
-1, 21758285, 24870912, 1, 21823822, 24952832, 1, 21889355,
-24969216, 1, 21823820, 24838144, 0, 22741342, 26050560, 0,
-22872412, 25886720, 0, 22741340, 25837568, 1, 22806877, 25919488,
-1, 22872414, 26001408, 1, 22937947, 26017792, 1, 20513080,
-23461888, 0, 22151505, 25198592, 0, 20382008, 23412736, 1,
-20447545, 23494656, 1, 20513082, 23576576, 1, 20578615, 23592960,
-0, 21692750, 25001984, 0, 22020431, 25034752, 0, 21954896,
-25067520, 1, 22020433, 25149440, 1, 22085970, 25165824, 1,
-22151503, 25247744, 1, 26280338, 30425088, 1, 26411409, 30539776,
-0, 26476947, 30654464, 0, 26345876, 30703616, 0, 26476545,
-557056, 0, 65539, 835584, 0, 26411412, 30621696, 1,
-197011, 30736384, 0, 26542102, 196608, 0, 1441803, 671744,
-0, 26608021, 30851072, 0, 721302, 30900224, 0, 26542486,
-30818304, 1, 26673557, 30932992, 0, 26739095, 31047680, 0,
-26608024, 31096832, 0, 65536, 491520, 0, 655371, 622592,
-0, 720918, 704512, 1, 196609, 802816, 1, 1441795,
-1900544, 0, 786445, 950272, 0, 851982, 1024000, 0,
-917589, 1105920, 0, 2752529, 1187840, 0, 1114124, 1269760,
-0, 5570602, 2818048, 0, 786449, 1302528, 1, 917517,
-991232, 1, 1114154, 1220608, 1, 2752537, 2097152, 0,
-1638405, 2891776, 0, 327684, 2965504, 0, 1638419, 2162688,
-1, 327705, 2924544, 1, 5570574, 1073152, 1, 1310806,
-2285568, 0, 1376276, 2342912, 0, 5636181, 6291456, 0,
-5636116, 2252800, 1, 5701718, 27721728, 1, 851980, 917504,
-1, 196630, 1933312, 1, 1441813, 2007040, 0, 262147,
-3039232, 0, 196612, 3072000, 1, 26280339, 30572544, 1,
-26411011, 30769152, 1, 1442197, 229376, 1, 1376278, 1974272,
-1, 26542487, 30965760, 1, 131155, 2375680, 0, 26148866,
-3080192, 0, 26214799, 30261248, 0, 5439888, 30310400, 0,
-26149264, 30228480, 1, 26280335, 30343168, 0, 26345873, 30457856,
-0, 26214802, 30507008, 0, 1245657, 2031616, 4194304, 262149,
-2998272, 1, 131471, 3112960, 1, 26149265, 30375936, 1,
-30998544, 2031616, 0, 5439490, 2408448, 1, 24313939, 6127616,
-0, 1048946, 27402240, 0, 24248691, 27475968, 0, 24248336,
-27435008, 1, 1049050, 28508160, 16777217, 393589, 27680768, 0,
-31129606, 28508160, 1, 24379765, 27639808, 1, 24444934, 27713536,
-1, 393591, 28573696, 1, 31261148, 28917760, 37748736, 24314226,
-27508736, 1, 24379763, 27557888, 0, 24445300, 27607040, 0,
-31064539, 28508160, 4194305, 23593321, 26755072, 0, 23658858, 26836992,
-0, 23724395, 26918912, 0, 23789928, 26935296, 0, 23724393,
-26804224, 1, 23593323, 26968064, 1, 26607627, 30867456, 1,
-26739094, 31064064, 1, 589834, 49152, 0, 8, 81920,
-0, 524297, 884736, 0, 655369, 16384, 1, 720906,
-589824, 1, 23658856, 26787840, 1, 589832, 851968, 1,
-31392222, 29065216, 75497472, 23331173, 26525696, 0, 23396710, 26542080,
-0, 23462247, 26624000, 0, 23527780, 26705920, 0, 23331175,
-26673152, 1, 31523296, 29065216, 100663296, 524770, 114688, 12582913,
-23396708, 26492928, 1, 31457759, 29065216, 96468992, 31588352, 114688,
-1, 1, 458752, 1, 65940, 524288, 1, 23462245,
-26574848, 1, 26476946, 30670848, 1, 5439859, 6094848, 1,
-23527782, 26656768, 1, 24314228, 27525120, 1, 31195525, 28917760,
-0, 25493894, 28991488, 0, 25559521, 29065216, 104857600, 26214483,
-30277632, 1, 26345872, 30474240, 1, 26673560, 31014912, 1,
-26804631, 31129600, 0, 26870169, 31244288, 0, 26739098, 31293440,
-0, 26869784, 163840, 0, 1572887, 376832, 0, 26804634,
-31211520, 1, 1507737, 31326208, 0, 1310741, 2310144, 1,
-31653975, 27787264, 0, 26673561, 31162368, 1, 26804247, 31358976,
-1, 1507352, 344064, 1, 1573243, 1867776, 0, 1180017,
-6086656, 0, 24838162, 6930432, 0, 24183267, 27787264, 4194304,
-24182802, 6053888, 1, 31719793, 27918336, 1, 1180027, 6897664,
-1, 31785444, 27918336, 4194305, 24838524, 28278784, 0, 24904061,
-28360704, 0, 24510949, 27918336, 16777217, 24969590, 28418048, 0,
-25035126, 19988480, 1, 24969596, 28327936, 1, 24510845, 28385280,
-1, 31916518, 29212672, 33554432, 1573274, 131072, 1, 24838168,
-1835008, 1, 23789930, 26886144, 1, 24904059, 28246016, 1,
-31326479, 29065216, 0, 17760524, 29138944, 0, 17564135, 29212672,
-54525952, 26870168, 31260672, 1, 2097183, 1376256, 0, 2031646,
-1458176, 0, 1966120, 1540096, 0, 2031648, 1409024, 1,
-1966111, 1490944, 1, 6029403, 6635520, 1, 2621470, 1507328,
-1, 5701672, 1622016, 0, 2752597, 2850816, 1, 5570646,
-6324224, 1, 5636183, 27754496, 0, 2621527, 1589248, 1,
-5702115, 27820032, 4194305, 2424920, 2441216, 0, 31981605, 2686976,
-0, 5767257, 6455296, 0, 5832794, 6537216, 0, 2359784,
-2686976, 4194304, 5898331, 6586368, 0, 5963868, 6668288, 0,
-5898329, 6504448, 1, 5963866, 6553600, 1, 1638442, 2129920,
-1, 1245209, 2195456, 0, 5767187, 6373376, 0, 5832792,
-6422528, 1, 2293796, 2637824, 0, 2359331, 2670592, 1,
-2424868, 2719744, 1, 2490405, 3284992, 0, 2490413, 3260416,
-1, 2424870, 3317760, 1, 2949158, 3227648, 0, 23986563,
-27901952, 1, 25362820, 28844032, 0, 25428445, 28917760, 58720256,
-3211348, 27189248, 0, 5505411, 27197440, 0, 24117615, 27303936,
-0, 25362798, 27869184, 0, 23986183, 28467200, 0, 24576489,
-28606464, 4194304, 459127, 28655616, 0, 459118, 28499968, 1,
-24576007, 28688384, 1, 1048595, 2064384, 1, 5767205, 2473984,
-1, 1245272, 6406144, 1, 24052080, 27271168, 1, 24117264,
-27344896, 1, 1048944, 27377664, 0, 393232, 28540928, 0,
-32047110, 28606464, 0, 24641551, 2785280, 0, 5308780, 3424256,
-0, 23855155, 3637248, 0, 3342712, 3702784, 1, 983088,
-3850240, 0, 5111889, 3866624, 0, 5177422, 5570560, 0,
-3145807, 5767168, 0, 3997758, 4456448, 0, 4063295, 4538368,
-0, 4128832, 4620288, 0, 4194365, 4702208, 0, 4128830,
-4571136, 1, 32178666, 5914624, 37748736, 4063293, 4489216, 1,
-32243794, 5832704, 0, 5374443, 5914624, 41943040, 4522054, 4997120,
-0, 4587591, 5079040, 0, 4653128, 5160960, 0, 4718661,
-5177344, 0, 4194367, 4587520, 1, 4522056, 5210112, 1,
-4587589, 5029888, 1, 32113133, 5914624, 20971520, 4259906, 4718592,
-0, 4325443, 4800512, 0, 4390980, 4882432, 0, 4456513,
-4964352, 0, 4325441, 4751360, 1, 4653126, 5046272, 1,
-4456515, 4849664, 1, 3080585, 29720576, 0, 25756043, 29917184,
-0, 4390978, 4833280, 1, 32309297, 5914624, 0, 3211311,
-6193152, 0, 23855185, 3457024, 1, 3997760, 4669440, 1,
-4259908, 4931584, 1, 4718663, 5128192, 1, 5308908, 5832704,
-8388608, 26018156, 5996544, 0, 25887117, 30113792, 0, 3080559,
-6242304, 0, 25821577, 29671424, 0, 25755695, 29687808, 1,
-24052106, 29786112, 0, 25821551, 29753344, 1, 3080241, 6160384,
-1, 24051759, 6275072, 1, 25756042, 29638656, 1, 25952651,
-29868032, 0, 25887113, 29884416, 1, 25821580, 29982720, 0,
-25952650, 29949952, 1, 2097185, 1359872, 1, 6094940, 6684672,
-1, 24707106, 2506752, 0, 32374877, 6717440, 0, 6094900,
-6799360, 0, 3408249, 28049408, 0, 2228259, 2555904, 0,
-6029806, 6717440, 4194304, 2228601, 2539520, 1, 2293794, 2588672,
-1, 3014701, 3145728, 0, 24707118, 3538944, 0, 983416,
-2752512, 1, 24641913, 28000256, 1, 24707124, 28082176, 1,
-3342382, 3358720, 0, 3015033, 3571712, 1, 24641587, 3670016,
-0, 24707448, 28033024, 0, 25887116, 29835264, 1, 26083725,
-30064640, 0, 26018187, 30081024, 1, 25952654, 30179328, 0,
-2949615, 3178496, 6291457, 26083724, 30146560, 1, 32505902, 3178496,
-1, 3014707, 3391488, 1, 3342700, 3604480, 1, 23855469,
-27017216, 1, 23855501, 5963776, 1, 23921004, 27049984, 0,
-26083693, 27099136, 0, 26018190, 30031872, 1, 32440816, 3178496,
-4194305, 23921038, 27066368, 1, 2687009, 262144, 0, 2162720,
-1327104, 0, 2621481, 1687552, 0, 2162729, 294912, 1,
-2687019, 3522560, 0, 2818092, 3792896, 0, 32571485, 6766592,
-1, 2883627, 3760128, 1, 24772652, 28196864, 1, 2883962,
-28229632, 0, 2687016, 1654784, 1, 1703963, 1761280, 0,
-24182810, 1818624, 0, 2818089, 3489792, 1, 31654257, 27820032,
-1, 1704305, 1785856, 1, 24510962, 20021248, 4194304, 24183158,
-27951104, 0, 1769498, 1728512, 1, 25231399, 28704768, 0,
-2555933, 28778496, 0, 25166209, 29343744, 0, 25100672, 29401088,
-0, 32637310, 20021248, 0, 25035135, 20430848, 0, 25100670,
-20398080, 1, 25166207, 29368320, 1, 31850882, 29212672, 0,
-25297281, 29286400, 0, 25231744, 29310976, 1, 3735610, 4210688,
-0, 3801147, 4292608, 0, 3866684, 4374528, 0, 3932217,
-4390912, 0, 32768499, 720896, 4194304, 3735612, 4423680, 1,
-32702512, 720896, 0, 3146229, 3817472, 37748737, 3801145, 4243456,
-1, 4784202, 5259264, 0, 4849739, 5341184, 0, 4915276,
-5423104, 0, 4980809, 5439488, 0, 3866682, 4259840, 1,
-4784204, 5472256, 1, 32834038, 3817472, 20971521, 4849737, 5292032,
-1, 3473462, 3948544, 0, 3538999, 4030464, 0, 3604536,
-4112384, 0, 3670069, 4128768, 0, 3473464, 4161536, 1,
-4915274, 5308416, 1, 3604534, 3997696, 1, 32964636, 6848512,
-0, 32899087, 3817472, 1, 3538997, 3981312, 1, 983543,
-6848512, 4194304, 3277300, 720896, 8388608, 1900594, 1163264, 0,
-3670071, 4079616, 1, 3932219, 4341760, 1, 4980811, 5390336,
-1, 1835037, 6979584, 0, 3408369, 6766592, 4194305, 24772660,
-28114944, 0, 1769500, 442368, 0, 1835023, 6815744, 1,
-3408250, 28147712, 1, 1835035, 409600, 1, 1900572, 6946816,
-1, 5046412, 7061504, 0, 6619640, 7503872, 62914560, 5242981,
-7553024, 0, 9175545, 12320768, 4194304, 11337808, 8159232, 0,
-10944685, 8470528, 0, 33095847, 12320768, 0, 17170509, 5701632,
-0, 33030650, 7503872, 8388608, 5046534, 5734400, 1, 9175117,
-7028736, 1, 17170692, 12173312, 1, 11206826, 12386304, 0,
-10682508, 12779520, 0, 17039621, 19464192, 0, 17367306, 19791872,
-0, 6226180, 7143424, 1, 6160479, 7208960, 0, 6422622,
-7323648, 0, 6488162, 7372800, 0, 17039867, 12140544, 4194304,
-6553699, 7454720, 0, 33161316, 7503872, 0, 33227014, 12140544,
-0, 13107310, 7077888, 0, 12910788, 14614528, 0, 33292485,
-14729216, 0, 7406077, 14827520, 16777216, 7209073, 14876672, 0,
-13304008, 15335424, 0, 12845259, 15400960, 0, 28508598, 33325056,
-0, 12976638, 14729216, 8388608, 33489094, 14778368, 0, 28639668,
-33161216, 0, 33423868, 14729216, 4194304, 28705205, 33243136, 0,
-28508596, 33112064, 1, 28574133, 33193984, 1, 28639670, 33275904,
-1, 28705203, 33292288, 1, 13042175, 14778368, 20971520, 33358023,
-14827520, 0, 28574131, 33144832, 0, 6685184, 7684096, 4194304,
-13041777, 14860288, 1, 33554529, 7684096, 0, 6357088, 7766016,
-0, 12321281, 14123008, 4194304, 12976327, 14745600, 1, 6750310,
-7634944, 0, 33685607, 7815168, 0, 6947330, 7815168, 4194304,
-6815850, 8060928, 0, 7405678, 14909440, 1, 7209069, 14991360,
-0, 7143529, 15007744, 0, 6881384, 15073280, 1, 12714179,
-14417920, 1, 12779713, 14483456, 0, 12648644, 14565376, 0,
-12845253, 14647296, 1, 13172936, 15155200, 0, 13238473, 15204352,
-0, 13304010, 15319040, 0, 13107403, 15368192, 1, 33620157,
-14123008, 0, 12386494, 14204928, 0, 33751234, 14352384, 0,
-12910790, 14696448, 1, 12452031, 14254080, 0, 12517568, 14336000,
-0, 12583427, 14352384, 4194304, 6291640, 8404992, 0, 12058810,
-13860864, 0, 12189883, 13926400, 1, 12255417, 13991936, 0,
-12124348, 14073856, 0, 12189774, 5521408, 0, 5111887, 5603328,
-1, 5177531, 5685248, 0, 12255418, 13893632, 0, 27787520,
-32309248, 1, 33882628, 32800768, 8388608, 27263391, 31653888, 0,
-27525539, 31916032, 0, 27853223, 32178176, 0, 27984128, 32260096,
-0, 16777640, 32342016, 0, 27787689, 32423936, 0, 16712107,
-32440320, 0, 27853224, 32391168, 1, 33817008, 32800768, 0,
-28311985, 32882688, 0, 33948073, 33030144, 0, 28377522, 32931840,
-0, 28443050, 33013760, 0, 27918854, 33030144, 8388608, 34013611,
-32292864, 1, 27984300, 32505856, 0, 28049837, 32587776, 0,
-28115374, 32669696, 0, 16777735, 32292864, 8388609, 28180911, 32718848,
-0, 28246533, 32800768, 62914560};
+65536, 20152320, 0, 2, 20561920, 0, 196609, 20938752,
+1, 327684, 21692416, 0, 131077, 21757952, 0, 393220,
+21512192, 0, 458758, 21561344, 0, 327687, 21676032, 0,
+262149, 21725184, 1, 589832, 20791296, 0, 524291, 20873216,
+0, 655369, 21889024, 0, 786443, 20709376, 1, 720905,
+21839872, 0, 589837, 21921792, 20971521, 983054, 21299200, 1,
+1114128, 21102592, 0, 1048590, 21250048, 0, 917519, 21331968,
+0, 983057, 21413888, 0, 1179660, 20660224, 1, 917520,
+21282816, 1, 1048594, 21430272, 0, 786450, 20692992, 0,
+720908, 20742144, 0, 1245195, 20987904, 0, 1179667, 21168128,
+0, 262164, 20578304, 0, 1310730, 21970944, 0, 1441813,
+15564800, 1, 1310737, 21037056, 0, 1114127, 21381120, 1,
+1507348, 22003712, 1, 1638424, 15663104, 1, 851994, 21921792,
+4194305, 1638421, 15515648, 0, 1376278, 15532032, 0, 1441816,
+15613952, 0, 1572889, 15695872, 0, 1572886, 15646720, 1,
+1376281, 15482880, 1, 1703946, 21921792, 1, 655383, 22003712,
+16777217, 1835035, 12500992, 0, 1966109, 12861440, 0, 1769502,
+19529728, 0, 2097183, 20267008, 0, 2162720, 29425664, 0,
+2228257, 29540352, 0, 2162723, 19906560, 0, 2293796, 19922944,
+0, 2490405, 20185088, 0, 2359334, 20447232, 1, 2097185,
+29458432, 1, 2424864, 29573120, 0, 2359297, 20103168, 0,
+196646, 20332544, 0, 2490404, 20480000, 0, 65539, 20905984,
+0, 2621479, 8814592, 0, 2752553, 9289728, 0, 2883627,
+9306112, 8388608, 2949164, 9633792, 0, 2687021, 9699328, 0,
+2555950, 8863744, 0, 3014703, 8945664, 0, 3145770, 9289728,
+12582912, 3276849, 8273920, 0, 3407923, 8683520, 0, 3342376,
+8765440, 0, 2818098, 9306112, 0, 3538997, 10452992, 0,
+3670071, 10502144, 0, 3735606, 12025856, 0, 3801145, 12288000,
+0, 3866680, 12648448, 0, 3473467, 12763136, 0, 3604538,
+13664256, 0, 3997756, 8552448, 0, 3932212, 8617984, 1,
+3211326, 9371648, 0, 4063293, 10960896, 0, 3473469, 10911744,
+0, 3997758, 10993664, 1, 3866677, 12730368, 1, 4194367,
+10403840, 0, 4259904, 10584064, 0, 4390978, 11010048, 0,
+4325441, 11091968, 0, 4128835, 11206656, 0, 3276863, 7929856,
+0, 4456498, 8306688, 1, 4128832, 10371072, 1, 4587589,
+10633216, 0, 4522055, 10715136, 0, 4653128, 10797056, 0,
+4718662, 10813440, 0, 4194377, 10551296, 4194305, 4587592, 10846208,
+1, 4784193, 10551296, 1, 4522054, 10665984, 1, 4259914,
+12599296, 4194304, 4653125, 10682368, 1, 4849720, 12599296, 0,
+3670091, 12681216, 8388609, 3211332, 8306688, 4194305, 4063281, 9404416,
+1, 4718663, 10764288, 1, 4915259, 12681216, 1, 3932236,
+7880704, 0, 5046324, 8044544, 0, 3407932, 8585216, 0,
+4980813, 15106048, 0, 5177422, 19644416, 0, 5111888, 19660800,
+0, 5242961, 19742720, 0, 5439570, 7176192, 0, 3539001,
+11993088, 1, 3735635, 12075008, 0, 5374006, 12238848, 0,
+5570644, 18579456, 0, 5505110, 18661376, 0, 5767255, 18907136,
+0, 5701717, 19038208, 0, 5832792, 19152896, 0, 5636185,
+19202048, 0, 3080282, 9011200, 1, 5898331, 9076736, 0,
+5963868, 18530304, 0, 6029360, 18677760, 0, 6029403, 18497536,
+1, 5963864, 19103744, 0, 5767257, 19185664, 1, 6094938,
+8241152, 0, 3080286, 8339456, 0, 5898287, 8978432, 0,
+6160477, 14450688, 0, 6291551, 18825216, 0, 6357088, 31391744,
+0, 6422625, 31457280, 1, 5701729, 18759680, 0, 6422613,
+18989056, 0, 5570647, 19005440, 1, 6357090, 31490048, 0,
+6488162, 31522816, 0, 6553699, 31637504, 0, 6684773, 31735808,
+0, 6750310, 31784960, 0, 6815847, 31899648, 0, 6946921,
+31997952, 0, 7012458, 32047104, 0, 7077995, 32161792, 0,
+7143465, 9175040, 0, 2687018, 9256960, 4194305, 7274606, 10141696,
+1, 7209071, 10108928, 0, 7274608, 10190848, 0, 7340145,
+10272768, 0, 7405678, 10289152, 0, 7471213, 9175040, 4194304,
+7209073, 10321920, 1, 2752560, 9256960, 1, 7340143, 10158080,
+1, 3145820, 18710528, 1, 7405680, 10240000, 1, 7602291,
+18464768, 1, 7667827, 18219008, 0, 7733365, 18333696, 0,
+7602294, 18382848, 0, 7536756, 18432000, 0, 7733364, 18350080,
+1, 5832823, 19234816, 4194305, 5636216, 9158656, 8388608, 7667830,
+18300928, 1, 7798870, 19234816, 1, 7864441, 9158656, 0,
+7929970, 9175040, 8388608, 7536757, 18251776, 1, 8061050, 11354112,
+0, 7995516, 11436032, 0, 8126589, 11501568, 1, 8192126,
+11567104, 0, 8323195, 13238272, 0, 8257663, 13352960, 0,
+8126531, 11157504, 0, 4390975, 11239424, 1, 4128893, 11321344,
+0, 8192124, 11468800, 0, 8454272, 11780096, 1, 8323198,
+13320192, 1, 8257666, 13402112, 20971520, 8650883, 11878400, 1,
+8781957, 13484032, 1, 8388737, 11747328, 0, 8454275, 11829248,
+0, 8585348, 11911168, 0, 8650880, 11927552, 0, 8585345,
+11796480, 1, 8519815, 13402112, 0, 8847494, 13484032, 4194305,
+8978568, 13582336, 12582913, 9109642, 17940480, 1, 9175178, 17694720,
+0, 9240716, 17809408, 0, 9109645, 17858560, 0, 9044107,
+17907712, 0, 8913038, 13582336, 1, 9306255, 13729792, 29360128,
+9240715, 17825792, 1, 9502864, 17956864, 0, 9568401, 18071552,
+0, 9633938, 18120704, 0, 9437331, 18169856, 0, 9175181,
+17776640, 1, 9633936, 18202624, 1, 9371796, 13729792, 4194304,
+9568403, 18087936, 1, 9699477, 13729792, 0, 9765014, 13811712,
+79691776, 9502866, 18038784, 1, 8847511, 9797632, 0, 9896088,
+9863168, 1, 9961614, 9928704, 0, 8716423, 13451264, 0,
+8978565, 13500416, 0, 9306249, 13615104, 0, 9895980, 9453568,
+0, 2949272, 9617408, 0, 2883629, 9666560, 1, 9961623,
+9830400, 0, 10092697, 16072704, 1, 9044108, 17727488, 1,
+10223771, 25542656, 1, 10354845, 25608192, 0, 10485919, 25378816,
+1, 10485915, 25296896, 0, 10420384, 25411584, 0, 10223775,
+25460736, 0, 10158236, 25509888, 0, 10158240, 25329664, 1,
+10420380, 25427968, 1, 10289313, 25788416, 0, 10551458, 25706496,
+0, 10748067, 25870336, 0, 10616990, 25624576, 0, 10289310,
+25575424, 1, 10354850, 25657344, 1, 10616993, 25739264, 1,
+10551453, 25755648, 1, 10879141, 17432576, 0, 10813607, 17514496,
+0, 10944680, 17596416, 0, 11010214, 17678336, 0, 11141289,
+13271040, 8388609, 11010215, 17563648, 1, 11206779, 13189120, 0,
+8061098, 13271040, 12582913, 10944677, 17547264, 1, 8388740, 11960320,
+1, 11075711, 13271040, 1, 11337900, 16236544, 1, 10879144,
+17645568, 1, 11468974, 9502720, 0, 11534511, 10027008, 1,
+11403441, 11599872, 1, 11600050, 11665408, 0, 11665579, 13189120,
+33554432, 10813606, 17465344, 1, 11337881, 16023552, 0, 10027187,
+16105472, 16777216, 11796653, 16203776, 0, 11927733, 22020096, 0,
+11993270, 22478848, 0, 12058807, 22544384, 0, 12124332, 16121856,
+0, 11272378, 16203776, 16777216, 12320955, 22183936, 0, 12386486,
+22298624, 0, 12452029, 22347776, 0, 11993278, 22462464, 0,
+11927735, 22511616, 1, 12189876, 16203776, 4194304, 11862204, 22265856,
+0, 11731098, 16105472, 0, 10092729, 16121856, 16777216, 12255416,
+22102016, 0, 11272346, 16154624, 1, 12583103, 15810560, 1,
+12648639, 15761408, 0, 12517568, 15843328, 0, 12583106, 15859712,
+0, 12714177, 15941632, 0, 12648642, 15974400, 1, 12714176,
+15892480, 1, 10027181, 15990784, 1, 8716425, 13533184, 1,
+12517569, 15728640, 1, 12845251, 16334848, 1, 12976325, 24297472,
+0, 12910790, 24264704, 1, 12976327, 24346624, 1, 13041864,
+24428544, 1, 13107397, 24444928, 1, 13041862, 24313856, 0,
+13107399, 24395776, 0, 13238473, 24559616, 0, 13369547, 24657920,
+0, 13172938, 24526848, 1, 13238475, 24608768, 1, 13304012,
+24690688, 1, 13369545, 24707072, 1, 13304010, 24576000, 0,
+13500621, 23773184, 0, 13435086, 23740416, 1, 13500623, 23822336,
+1, 13566160, 23904256, 1, 13631693, 23920640, 1, 13566158,
+23789568, 0, 13631695, 23871488, 0, 13762769, 24035328, 0,
+13697234, 24002560, 1, 13762771, 24084480, 1, 13828308, 24166400,
+1, 13893841, 24182784, 1, 13893843, 24133632, 0, 14024917,
+24821760, 0, 13828306, 24051712, 0, 12910792, 24477696, 0,
+13172940, 24739840, 0, 14155991, 12910592, 0, 14090457, 17252352,
+1, 14352602, 22659072, 0, 14418136, 12910592, 4194304, 14287069,
+22839296, 0, 14483678, 22757376, 0, 14680287, 22921216, 0,
+14287067, 22626304, 1, 14352606, 22708224, 1, 14549213, 22790144,
+1, 14483674, 22806528, 1, 14549211, 22675456, 0, 14745820,
+12910592, 12582912, 14614754, 23101440, 0, 14876897, 23445504, 0,
+14614752, 22888448, 1, 14680292, 22970368, 1, 14942434, 23052288,
+1, 14811359, 23068672, 1, 14811364, 23019520, 0, 14942432,
+22937600, 0, 13435088, 23953408, 0, 13697236, 24215552, 0,
+15073509, 25280512, 0, 15139011, 16285696, 0, 12779716, 16367616,
+0, 12845288, 16384000, 0, 15204583, 16465920, 0, 12779751,
+16252928, 1, 15139048, 16498688, 1, 15335657, 16531456, 1,
+15204548, 16416768, 1, 15466731, 16859136, 1, 14221549, 17170432,
+1, 15597805, 13123584, 0, 15532249, 17203200, 0, 14221527,
+17285120, 0, 15663342, 26361856, 0, 14090479, 26411008, 0,
+11600046, 11632640, 0, 15728817, 12533760, 0, 11403505, 13025280,
+0, 15859952, 19398656, 0, 15991027, 16695296, 1, 16122101,
+19283968, 1, 15270122, 16564224, 0, 15991017, 16613376, 0,
+15925492, 16662528, 0, 15335667, 16711680, 0, 15270132, 16580608,
+1, 16122103, 17367040, 8388608, 16056566, 19316736, 0, 16253173,
+19365888, 0, 16253104, 9977856, 1, 16056568, 19333120, 1,
+11534584, 10010624, 0, 11468976, 10059776, 0, 16318639, 17317888,
+0, 16187641, 17367040, 0, 16449786, 17022976, 1, 16580860,
+17055744, 4194304, 16449771, 16809984, 0, 15401196, 16891904, 0,
+15466746, 16908288, 0, 16384251, 16990208, 0, 16384236, 16941056,
+1, 16646397, 17055744, 8388608, 15532286, 17104896, 0, 15925482,
+16744448, 1, 15401211, 16777216, 1, 16515318, 17055744, 0,
+15794414, 13074432, 0, 15663346, 19398656, 8388608, 15597807, 26394624,
+1, 16777471, 26099712, 1, 16711937, 26181632, 1, 16843010,
+26263552, 1, 16908544, 26279936, 1, 17039619, 23199744, 0,
+16777474, 26312704, 0, 17170693, 13811712, 0, 17105156, 23199744,
+4194304, 16908545, 26230784, 0, 9830662, 13811712, 50331648, 9437329,
+17989632, 1, 16843007, 26148864, 0, 17236227, 23150592, 1,
+16974085, 23232512, 1, 17105160, 23314432, 0, 17301767, 23330816,
+0, 16974087, 23183360, 0, 17432841, 23543808, 0, 17236234,
+23658496, 0, 17563915, 24920064, 0, 17694989, 25116672, 0,
+17826063, 25968640, 0, 16711936, 26132480, 0, 13959382, 24788992,
+1, 14024971, 24870912, 1, 17498380, 24952832, 1, 17563861,
+24969216, 1, 17498326, 24838144, 0, 10682640, 26050560, 0,
+17760420, 25886720, 0, 10682532, 25837568, 1, 10748175, 25919488,
+1, 17760528, 26001408, 1, 17825955, 26017792, 1, 17367267,
+23461888, 0, 15008014, 25198592, 0, 14745827, 23412736, 1,
+14876937, 23494656, 1, 17367306, 23576576, 1, 17432801, 23592960,
+0, 13959436, 25001984, 0, 17629414, 25034752, 0, 15073549,
+25067520, 1, 17629454, 25149440, 1, 17694949, 25165824, 1,
+15007974, 25247744, 1, 17957137, 30425088, 1, 18022674, 30539776,
+0, 18088211, 30654464, 0, 17891604, 30703616, 0, 18088213,
+557056, 0, 18153750, 835584, 0, 18022676, 30621696, 1,
+18219283, 30736384, 0, 18350359, 196608, 0, 18284825, 671744,
+0, 18481432, 30851072, 0, 18415898, 30900224, 0, 18350362,
+30818304, 1, 18546968, 30932992, 0, 18612507, 31047680, 0,
+18481436, 31096832, 0, 18153757, 491520, 0, 18743577, 622592,
+0, 18415895, 704512, 1, 18219285, 802816, 1, 18284822,
+1900544, 0, 18874655, 950272, 0, 18809121, 1024000, 0,
+18940194, 1105920, 0, 19136803, 1187840, 0, 19071264, 1269760,
+0, 19005732, 2818048, 0, 18874659, 1302528, 1, 18940191,
+991232, 1, 19071268, 1220608, 1, 19136805, 2097152, 0,
+19202342, 2891776, 0, 19267879, 2965504, 0, 19202344, 2162688,
+1, 19267877, 2924544, 1, 19005729, 1073152, 1, 19530025,
+2285568, 0, 19595562, 2342912, 0, 19464482, 6291456, 0,
+19464490, 2252800, 1, 19661097, 27721728, 1, 18809120, 917504,
+1, 18219287, 1933312, 1, 18284843, 2007040, 0, 19333398,
+3039232, 0, 18219303, 3072000, 1, 17957139, 30572544, 1,
+18022678, 30769152, 1, 18284824, 229376, 1, 19595543, 1974272,
+1, 18350363, 30965760, 1, 19792173, 2375680, 0, 19857710,
+3080192, 0, 19923247, 30261248, 0, 19726640, 30310400, 0,
+19857712, 30228480, 1, 17957167, 30343168, 0, 17891602, 30457856,
+0, 19923217, 30507008, 0, 19398961, 2031616, 4194304, 19333414,
+2998272, 1, 19792175, 3112960, 1, 19857682, 30375936, 1,
+19988786, 2031616, 0, 19726638, 2408448, 1, 20119853, 6127616,
+0, 20054324, 27402240, 0, 20185395, 27475968, 0, 20185394,
+27435008, 1, 20054325, 28508160, 16777217, 20382006, 27680768, 0,
+20447543, 28508160, 1, 20513078, 27639808, 1, 20316471, 27713536,
+1, 20382010, 28573696, 1, 20709691, 28917760, 37748736, 20119860,
+27508736, 1, 20513075, 27557888, 0, 20316473, 27607040, 0,
+20250936, 28508160, 4194305, 20840765, 26755072, 0, 20775231, 26836992,
+0, 20906304, 26918912, 0, 20971838, 26935296, 0, 20906301,
+26804224, 1, 20840768, 26968064, 1, 18481433, 30867456, 1,
+18612506, 31064064, 1, 21037342, 49152, 0, 18678082, 81920,
+0, 21102913, 884736, 0, 18743617, 16384, 1, 18415902,
+589824, 1, 20775230, 26787840, 1, 21037378, 851968, 1,
+21233987, 29065216, 75497472, 21365061, 26525696, 0, 21299527, 26542080,
+0, 21430600, 26624000, 0, 21496134, 26705920, 0, 21365064,
+26673152, 1, 21627209, 29065216, 100663296, 21102923, 114688, 12582913,
+21299526, 26492928, 1, 21561668, 29065216, 96468992, 21692701, 114688,
+1, 18678037, 458752, 1, 18153748, 524288, 1, 21430597,
+26574848, 1, 18088209, 30670848, 1, 19726643, 6094848, 1,
+21496135, 26656768, 1, 20119865, 27525120, 1, 20644172, 28917760,
+0, 21758285, 28991488, 0, 21823818, 29065216, 104857600, 19923245,
+30277632, 1, 17891632, 30474240, 1, 18546972, 31014912, 1,
+21889307, 31129600, 0, 21954894, 31244288, 0, 18612559, 31293440,
+0, 21954896, 163840, 0, 22020433, 376832, 0, 21889359,
+31211520, 1, 22085966, 31326208, 0, 19530027, 2310144, 1,
+22151468, 27787264, 0, 18547022, 31162368, 1, 21889361, 31358976,
+1, 22085968, 344064, 1, 22020435, 1867776, 0, 22348116,
+6086656, 0, 22217045, 6930432, 0, 22282578, 27787264, 4194304,
+22282581, 6053888, 1, 22413652, 27918336, 1, 22348115, 6897664,
+1, 22479190, 27918336, 4194305, 22217048, 28278784, 0, 22544729,
+28360704, 0, 22675799, 27918336, 16777217, 22610266, 28418048, 0,
+22741338, 19988480, 1, 22610264, 28327936, 1, 22675801, 28385280,
+1, 22872412, 29212672, 33554432, 22020431, 131072, 1, 22217040,
+1835008, 1, 20971839, 26886144, 1, 22544723, 28246016, 1,
+21168478, 29065216, 0, 22937951, 29138944, 0, 23003485, 29212672,
+54525952, 21954844, 31260672, 1, 23134560, 1376256, 0, 23069026,
+1458176, 0, 23200099, 1540096, 0, 23069025, 1409024, 1,
+23200096, 1490944, 1, 23396708, 6635520, 1, 23265634, 1507328,
+1, 19661155, 1622016, 0, 19136802, 2850816, 1, 19005737,
+6324224, 1, 19464492, 27754496, 0, 23265580, 1589248, 1,
+19661138, 27820032, 4194305, 23527782, 2441216, 0, 23593319, 2686976,
+0, 23462249, 6455296, 0, 23658858, 6537216, 0, 23789928,
+2686976, 4194304, 23724388, 6586368, 0, 23331173, 6668288, 0,
+23724393, 6504448, 1, 23331178, 6553600, 1, 19202340, 2129920,
+1, 19398949, 2195456, 0, 23462184, 6373376, 0, 23658854,
+6422528, 1, 23855467, 2637824, 0, 23789932, 2670592, 1,
+23527787, 2719744, 1, 23920999, 3284992, 0, 23921006, 3260416,
+1, 23527789, 3317760, 1, 23986541, 3227648, 0, 24117615,
+27901952, 1, 24052081, 28844032, 0, 24183100, 28917760, 58720256,
+24314226, 27189248, 0, 24248687, 27197440, 0, 24445300, 27303936,
+0, 24052080, 27869184, 0, 24117622, 28467200, 0, 20578679,
+28606464, 4194304, 24510778, 28655616, 0, 24510832, 28499968, 1,
+20578678, 28688384, 1, 20054312, 2064384, 1, 23462247, 2473984,
+1, 19399014, 6406144, 1, 24379765, 27271168, 1, 24445234,
+27344896, 1, 20054389, 27377664, 0, 20382002, 28540928, 0,
+24576311, 28606464, 0, 24707448, 2785280, 0, 24838522, 3424256,
+0, 24772988, 3637248, 0, 24904057, 3702784, 1, 24641917,
+3850240, 0, 25035131, 3866624, 0, 25100670, 5570560, 0,
+24969599, 5767168, 0, 25231744, 4456448, 0, 25166210, 4538368,
+0, 25297283, 4620288, 0, 25362817, 4702208, 0, 25297280,
+4571136, 1, 25493892, 5914624, 37748736, 25166209, 4489216, 1,
+25624966, 5832704, 0, 25559429, 5914624, 41943040, 25756040, 4997120,
+0, 25690506, 5079040, 0, 25821579, 5160960, 0, 25887113,
+5177344, 0, 25362818, 4587520, 1, 25756043, 5210112, 1,
+25690505, 5029888, 1, 25428364, 5914624, 20971520, 26083725, 4718592,
+0, 26018191, 4800512, 0, 26149264, 4882432, 0, 26214798,
+4964352, 0, 26018190, 4751360, 1, 25821576, 5046272, 1,
+26214799, 4849664, 1, 26345873, 29720576, 0, 26280339, 29917184,
+0, 26149261, 4833280, 1, 25952627, 5914624, 0, 24314258,
+6193152, 0, 24772987, 3457024, 1, 25231747, 4669440, 1,
+26083728, 4931584, 1, 25887114, 5128192, 1, 24838535, 5832704,
+8388608, 26476922, 5996544, 0, 26411412, 30113792, 0, 26345844,
+6242304, 0, 26542481, 29671424, 0, 26280338, 29687808, 1,
+24379797, 29786112, 0, 26542452, 29753344, 1, 26345843, 6160384,
+1, 24379794, 6275072, 1, 26280341, 29638656, 1, 26608019,
+29868032, 0, 26411409, 29884416, 1, 26542486, 29982720, 0,
+26608021, 29949952, 1, 23134615, 1359872, 1, 26739045, 6684672,
+1, 26870169, 2506752, 0, 26935704, 6717440, 0, 26739100,
+6799360, 0, 27001242, 28049408, 0, 26804588, 2555904, 0,
+23396763, 6717440, 4194304, 26804634, 2539520, 1, 23855513, 2588672,
+1, 27066734, 3145728, 0, 26870173, 3538944, 0, 24641913,
+2752512, 1, 24707482, 28000256, 1, 26870172, 28082176, 1,
+24904093, 3358720, 0, 27066778, 3571712, 1, 24707452, 3670016,
+0, 26870137, 28033024, 0, 26411414, 29835264, 1, 27132308,
+30064640, 0, 26476947, 30081024, 1, 26608030, 30179328, 0,
+23986591, 3178496, 6291457, 27132310, 30146560, 1, 27263389, 3178496,
+1, 27066748, 3391488, 1, 24904058, 3604480, 1, 24773025,
+27017216, 1, 24773012, 5963776, 1, 27328890, 27049984, 0,
+27132321, 27099136, 0, 26476958, 30031872, 1, 27197856, 3178496,
+4194305, 27328926, 27066368, 1, 27394455, 262144, 0, 26673505,
+1327104, 0, 23265698, 1687552, 0, 26673570, 294912, 1,
+27394467, 3522560, 0, 27460004, 3792896, 0, 27591064, 6766592,
+1, 27525539, 3760128, 1, 27656612, 28196864, 1, 27525542,
+28229632, 0, 27394403, 1654784, 1, 27787687, 1761280, 0,
+22282664, 1818624, 0, 27460002, 3489792, 1, 22151508, 27820032,
+1, 27787604, 1785856, 1, 22675881, 20021248, 4194304, 22282586,
+27951104, 0, 27722152, 1728512, 1, 27984298, 28704768, 0,
+27918764, 28778496, 0, 28115371, 29343744, 0, 28180909, 29401088,
+0, 27853147, 20021248, 0, 22741422, 20430848, 0, 28180827,
+20398080, 1, 28115374, 29368320, 1, 22806959, 29212672, 0,
+28246443, 29286400, 0, 27984301, 29310976, 1, 28377520, 4210688,
+0, 28311986, 4292608, 0, 28443059, 4374528, 0, 28508593,
+4390912, 0, 28639668, 720896, 4194304, 28377523, 4423680, 1,
+28574077, 720896, 0, 24969654, 3817472, 37748737, 28311985, 4243456,
+1, 28836279, 5259264, 0, 28770745, 5341184, 0, 28901818,
+5423104, 0, 28967352, 5439488, 0, 28443056, 4259840, 1,
+28836282, 5472256, 1, 28705211, 3817472, 20971521, 28770744, 5292032,
+1, 29163964, 3948544, 0, 29098430, 4030464, 0, 29229503,
+4112384, 0, 29295037, 4128768, 0, 29163967, 4161536, 1,
+28901815, 5308416, 1, 29229500, 3997696, 1, 29426112, 6848512,
+0, 29032824, 3817472, 1, 29098429, 3981312, 1, 24641985,
+6848512, 4194304, 29491637, 720896, 8388608, 28049858, 1163264, 0,
+29295038, 4079616, 1, 28508594, 4341760, 1, 28967353, 5390336,
+1, 29360556, 6979584, 0, 27001253, 6766592, 4194305, 27656604,
+28114944, 0, 27722176, 442368, 0, 29360504, 6815744, 1,
+27001254, 28147712, 1, 29360551, 409600, 1, 28049856, 6946816,
+1, 29622723, 7061504, 0, 29753797, 7503872, 62914560, 29819334,
+7553024, 0, 29557192, 12320768, 4194304, 29950407, 8159232, 0,
+30015945, 8470528, 0, 29884874, 12320768, 0, 30081476, 5701632,
+0, 29688268, 7503872, 8388608, 29622731, 5734400, 1, 29557188,
+7028736, 1, 30081107, 12173312, 1, 2031644, 12386304, 0,
+1900995, 12779520, 0, 5439567, 19464192, 0, 5308450, 19791872,
+0, 5374035, 7143424, 1, 30212178, 7208960, 0, 30278093,
+7323648, 0, 30343630, 7372800, 0, 5439952, 12140544, 4194304,
+30474703, 7454720, 0, 30147025, 7503872, 0, 30409163, 12140544,
+0, 30605778, 7077888, 0, 30736852, 14614528, 0, 30802389,
+14729216, 0, 30933463, 14827520, 16777216, 30540248, 14876672, 0,
+30998995, 15335424, 0, 30671321, 15400960, 0, 31130074, 33325056,
+0, 31261148, 14729216, 8388608, 31326685, 14778368, 0, 31457759,
+33161216, 0, 31195606, 14729216, 4194304, 31064544, 33243136, 0,
+31130079, 33112064, 1, 31392224, 33193984, 1, 31457754, 33275904,
+1, 31064539, 33292288, 1, 31523294, 14778368, 20971520, 30867937,
+14827520, 0, 31392219, 33144832, 0, 31654370, 7684096, 4194304,
+31523288, 14860288, 1, 31588836, 7684096, 0, 31719909, 7766016,
+0, 31916518, 14123008, 4194304, 31261153, 14745600, 1, 31982051,
+7634944, 0, 32047592, 7815168, 0, 32113129, 7815168, 4194304,
+4981226, 8060928, 0, 30933458, 14909440, 1, 30540267, 14991360,
+0, 32178253, 15007744, 0, 5046348, 15073280, 1, 6094942,
+14417920, 1, 6160876, 14483456, 0, 32244180, 14565376, 0,
+30671317, 14647296, 1, 32309715, 15155200, 0, 32375277, 15204352,
+0, 30999022, 15319040, 0, 30605785, 15368192, 1, 31850991,
+14123008, 0, 32440816, 14204928, 0, 32571485, 14352384, 0,
+30736861, 14696448, 1, 32506354, 14254080, 0, 32637427, 14336000,
+0, 32702961, 14352384, 4194304, 31785460, 8404992, 0, 32768501,
+13860864, 0, 32834038, 13926400, 1, 32899575, 13991936, 0,
+32965095, 14073856, 0, 32833918, 5521408, 0, 25035135, 5603328,
+1, 25100790, 5685248, 0, 32899573, 13893632, 0, 33096184,
+32309248, 1, 33227258, 32800768, 8388608, 6619236, 31653888, 0,
+6881384, 31916032, 0, 33292396, 32178176, 0, 33358328, 32260096,
+0, 33030649, 32342016, 0, 33096188, 32423936, 0, 6226429,
+32440320, 0, 33292793, 32391168, 1, 33161726, 32800768, 0,
+33423871, 32882688, 0, 33554940, 33030144, 0, 33489409, 32931840,
+0, 33620482, 33013760, 0, 33686016, 33030144, 8388608, 33751549,
+32292864, 1, 33358340, 32505856, 0, 33817093, 32587776, 0,
+33882630, 32669696, 0, 33030659, 32292864, 8388609, 33948167, 32718848,
+0, 34013691, 32800768, 62914560};
 extern const uint32_t mercury_WADSubSectors[287] = {
 5, 327684, 589827, 786435, 983041, 1048580, 1310723, 1507332,
 1769474, 1900548, 2162690, 2293764, 2555905, 2621443, 2818051, 3014659,
@@ -1530,419 +992,861 @@ extern const uint32_t mercury_WADSubSectors[287] = {
 54722565, 55050243, 55246856, 55771139, 55967746, 56098820, 56360963, 56557570,
 56688644, 56950786, 57081862, 57475076, 57737220, 57999364, 58261507, 58458117,
 58785796, 59047938, 59179015, 59637764, 59899907, 60096516, 60358659};
-extern const uint32_t mercury_WADSectors[663] = {
-838926256, 1346720851, 49, 1263755078, 12633, 192, 4258267136, 1414738432,
-3231813, 1598423040, 827935571, 12582912, 0, 838925696, 1330596934, 945763410,
-1263755078, 12633, 192, 4268752896, 1464218112, 1380275265, 1598423089, 827935571,
-12582912, 0, 838926016, 1330596934, 945763410, 1263755078, 12633, 192,
-4195352576, 1095512576, 3227990, 1598423040, 827935571, 12582912, 0, 838924896,
-1096171852, 49, 1263755078, 12633, 192, 0, 1162097152, 912208205,
-1598423040, 827935571, 12582912, 0, 78643200, 827147588, 13919, 1279870275,
-3497779, 128, 0, 1162086912, 912208205, 1162018816, 1597197385, 12582965,
-0, 167772400, 1330596934, 945763410, 1279870275, 3497779, 192, 15728640,
-1279658496, 877809487, 1162033247, 1597197385, 12582965, 0, 167772400, 1330596934,
-945763410, 1279870275, 3497779, 192, 15728640, 1279658496, 877809487, 1162033247,
-1597197385, 12582965, 0, 167772400, 1330596934, 945763410, 1279870275, 3497779,
-192, 15728640, 1279658496, 877809487, 1162033247, 1597197385, 12582965, 0,
-78643200, 1330596934, 945763410, 1279870275, 3497779, 128, 4289724416, 1464207872,
-1380275265, 1162018865, 1597197385, 12582965, 0, 167837616, 1413568326, 3232325,
-1279870275, 3497779, 192, 0, 1162097152, 912208205, 1598423040, 827935571,
-12582912, 0, 94371840, 1330596934, 945763410, 1279870275, 3497779, 192,
-4289724416, 1464207872, 1380275265, 1162018865, 1597197385, 12582965, 0, 78643200,
-1330596934, 945763410, 1279870275, 3497779, 128, 0, 1279657136, 877809487,
-1162033247, 1597197385, 8388661, 0, 83886080, 1330596934, 945763410, 1279870275,
-3497779, 192, 0, 1279657136, 877809487, 1162033247, 1597197385, 8388661,
-0, 83886080, 1330596934, 945763410, 1279870275, 3497779, 192, 0,
-1279657216, 877809487, 1162033247, 1597197385, 12582965, 0, 83886080, 1330596934,
-945763410, 1279870275, 3497779, 192, 0, 1279657216, 877809487, 1162033247,
-1597197385, 12582965, 0, 83886080, 1330596934, 945763410, 1279870275, 3497779,
-192, 0, 1279657136, 877809487, 1162033247, 1597197385, 8388661, 0,
-83886080, 1330596934, 945763410, 1279870275, 3497779, 192, 0, 1279657216,
-877809487, 1162033247, 1597197385, 12582965, 0, 78643200, 1330596934, 945763410,
-1279870275, 3497779, 128, 4289724416, 1464206592, 1380275265, 1162018865, 1597197385,
-12582965, 0, 83951536, 1413568326, 3232325, 1279870275, 3497779, 192,
-0, 1279657136, 877809487, 1162033247, 1597197385, 8388661, 0, 167772160,
-1330596934, 945763410, 1279870275, 3497779, 192, 0, 1279657216, 877809487,
-1162033247, 1597197385, 11534389, 0, 83886080, 1330596934, 945763410, 1279870275,
-3497779, 192, 0, 1279657216, 877809487, 1162033247, 1597197385, 12582965,
-0, 83886080, 1330596934, 945763410, 1279870275, 3497779, 192, 0,
-1279657216, 877809487, 1162033247, 1597197385, 12582965, 0, 83886080, 1330596934,
-945763410, 1279870275, 3497779, 192, 0, 1279657216, 877809487, 1162033247,
-1597197385, 12582965, 0, 83886080, 1330596934, 945763410, 1279870275, 3497779,
-192, 0, 1279657216, 877809487, 1162033247, 1597197385, 12582965, 0,
-83886080, 1330596934, 945763410, 1279870275, 3497779, 192, 0, 1279657216,
-877809487, 1162033247, 1597197385, 12582965, 0, 83886080, 1330596934, 945763410,
-1279870275, 3497779, 192, 0, 1279657216, 877809487, 1162033247, 1597197385,
-12582965, 0, 78643200, 1330596934, 945763410, 1279870275, 3497779, 128,
-4289724416, 1464206592, 1380275265, 1162018865, 1597197385, 12582965, 0, 83886080,
-1330596934, 945763410, 1279870275, 3497779, 160, 4289724416, 1279657376, 877809487,
-1162033247, 1597197385, 12582965, 0, 83886080, 1330596934, 945763410, 1279870275,
-3497779, 192, 0, 1279657216, 877809487, 1162033247, 1597197385, 12582965,
-0, 83886080, 1330596934, 945763410, 1279870275, 3497779, 192, 0,
-1279657136, 877809487, 1162033247, 1597197385, 8388661, 0, 83951536, 1413568326,
-3232325, 1279870275, 3497779, 192, 0, 1279656576, 877809487, 1162033247,
-1597197385, 5242933, 0, 83951536, 1330596934, 945763410, 1279870275, 3497779,
-192, 4289724416, 1279657216, 877809487, 1162033247, 1597197385, 12582965, 0,
-83886080, 1330596934, 945763410, 1279870275, 3497779, 192, 0, 1279657216,
-877809487, 1162033247, 1597197385, 12582965, 0, 83886080, 1330596934, 945763410,
-1279870275, 3497779, 192, 0, 1279657216, 877809487, 1162033247, 1597197385,
-12582965, 0, 83886080, 1330596934, 945763410, 1279870275, 3497779, 192,
-0, 1279657216, 877809487, 1162033247, 1597197385, 12582965, 0, 83886080,
-1330596934, 945763410, 1279870275, 3497779, 192, 0, 1279657216, 877809487,
-1162033247, 1597197385, 12582965, 0, 83886080, 1330596934, 945763410, 1279870275,
-3497779, 192, 0, 1279657216, 877809487, 1162033247, 1597197385, 12582965,
-0, 83886080, 1330596934, 945763410, 1279870275, 3497779, 192, 0,
-1279657216, 877809487, 1162033247, 1597197385, 12582965, 0, 83886080, 1330596934,
-945763410, 1279870275, 3497779, 192, 4268752896, 1279668736, 877809487, 1162033247,
-1597197385, 12582965, 0, 838925936, 1330596934, 945763410, 1279870275, 3497779,
-192, 173015040, 1414738432, 3231813, 1598423040, 827935571, 12582912, 0,
-838864000, 1330596934, 945763410, 1263755078, 12633, 192, 167772160, 1279668736,
-877809487, 1598437471, 827935571, 12582912, 0, 838863360, 1330596934, 945763410,
-1263755078, 12633, 192, 209715200, 1279668736, 877809487, 1598437471, 827935571,
-12582912, 0, 838860800, 827147588, 13919, 1263755078, 12633, 192,
-0, 1162097152, 912208205, 1598423040, 827935571, 12582912, 0, 838925616,
-1413568326, 3232325, 1263755078, 12633, 192, 209715200, 1279668736, 877809487,
-1598437471, 827935571, 12582912, 0, 838864000, 1330596934, 945763410, 1263755078,
-12633, 192, 4289724416, 1279657376, 3429441, 1162018816, 1597197385, 12582965,
-0, 838863920, 1346720851, 49, 1263755078, 12633, 192, 193986560,
-1414738432, 3231813, 1598423040, 827935571, 12582912, 0, 838863600, 1346720851,
-49, 1263755078, 12633, 192, 4289724416, 1414738432, 3231813, 1598423040,
-827935571, 12582912, 0, 838926096, 1346720851, 49, 1263755078, 12633,
-192, 4268752896, 1414738432, 3231813, 1598423040, 827935571, 12582912, 0,
-838925776, 1346720851, 49, 1263755078, 12633, 192, 4268752896, 1414738432,
-3231813, 1598423040, 827935571, 12582912, 0, 838926096, 1346720851, 49,
-1263755078, 12633, 192, 0, 1279657216, 3429441, 1162018816, 1597197385,
-12582965, 0, 83886080, 1330596934, 945763410, 1279870275, 3497779, 192,
-0, 1279658496, 877809487, 1162033247, 1597197385, 12582965, 0};
-extern const uint32_t mercury_WADNodes[2574] = {
-4292673536, 6684672, 131072, 0, 176164032, 4230020000, 213912896, 4225825696,
-2147581952, 4291756032, 6553600, 131072, 0, 209718400, 4196465120, 209718464,
-4196465120, 2147844100, 4291624960, 6291456, 0, 393216, 201329856, 4192270752,
-201329856, 4188076256, 2147975174, 4291756032, 6553600, 0, 131072, 209718464,
-4196465120, 201329856, 4192270560, 131073, 4291231744, 6291456, 393216, 0,
-188746752, 4196464864, 201329856, 4196464864, 229379, 4292280320, 6029312, 0,
-131072, 192940992, 4213242592, 192940992, 4209048288, 2148302859, 4292280320, 6029312,
-131072, 0, 188746624, 4213242400, 192940992, 4213242592, 360458, 4292411392,
-6160384, 0, 4294836224, 188746688, 4213242400, 188746688, 4217436960, 2148335622,
-4292411392, 6160384, 4294836224, 0, 197135552, 4217436704, 188746688, 4217436704,
-491529, 4292542464, 5898240, 0, 786432, 188746944, 4221631328, 188746944,
-4217436704, 557064, 4291887104, 6684672, 0, 4294836224, 188746944, 4196464864,
-188746944, 4221631008, 589828, 4291231744, 5898240, 1310720, 0, 176163648,
-4221630688, 188746944, 4221630688, 688130, 4292673536, 6684672, 0, 262144,
-176164160, 4230020000, 176164032, 4221630688, 720896, 4292411392, 5308416, 0,
-4294901760, 167774752, 4213242464, 167774752, 4230019936, 2148499470, 4292673536, 5373952,
-131072, 0, 169871936, 4230019936, 171969152, 4225825696, 2148630544, 4292542464,
-5308416, 393216, 0, 167774752, 4230019680, 169872000, 4230019936, 917517,
-4292804608, 5505024, 4294836224, 0, 176164160, 4230019296, 167774848, 4230019680,
-983052, 196608, 6160384, 4294574080, 0, 197135488, 14745504, 176163776,
-14680160, 2148761618, 4294770688, 5505024, 0, 655360, 176163968, 14745504,
-176163968, 4288741152, 2148794385, 4294246400, 5505024, 0, 524288, 176163712,
-4280352416, 176163712, 4271963616, 2149023766, 4293853184, 6029312, 0, 4294443008,
-176163712, 4259380448, 176163712, 4280352224, 1277973, 4293591040, 6553600, 0,
-4294836224, 205524096, 4250991840, 205524096, 4280352096, 2149154840, 4293459968, 6291456,
-131072, 0, 197135360, 4250991904, 201329728, 4250991904, 2149285914, 4293459968,
-6160384, 0, 131072, 197135424, 4250991904, 197135424, 4246797536, 2149318678,
-4293591040, 6160384, 4294836224, 0, 197135424, 4250991840, 192940992, 4250991840,
-2149384215, 4293591040, 6291456, 0, 4294836224, 192941120, 4250991840, 192941120,
-4280352096, 2149449752, 4293591040, 6422528, 4294705152, 0, 205524096, 4280351968,
-192941120, 4280351968, 1638421, 4294246400, 6029312, 262144, 0, 176163712,
-4280351968, 192941184, 4280351968, 1703956, 4294508544, 6029312, 0, 524288,
-176163968, 14745376, 176163968, 4280351968, 1769490, 4293591040, 5505024, 0,
-4294705152, 167774752, 4246797408, 167774848, 4255186272, 2149679136, 4294377472, 5242880,
-0, 262144, 167774848, 4280352480, 167774848, 4255186016, 1933343, 4294508544,
-5505024, 4294836224, 0, 176163968, 14744800, 167774848, 4280351840, 1966108,
-720896, 6029312, 0, 4294443008, 176163712, 23068896, 176163712, 44040544,
-2149875747, 1376256, 5505024, 0, 524288, 176163712, 60818080, 176163712,
-44040416, 2129954, 589824, 5505024, 0, 4294705152, 167774848, 18874592,
-167774784, 52429536, 2150006821, 1638400, 5373952, 131072, 0, 171969088,
-56623904, 171969152, 56623904, 2150137895, 1638400, 5505024, 0, 4294836224,
-167774848, 52429024, 171969152, 56623904, 2293794, 1900544, 5373952, 0,
-4294836224, 167774784, 60818272, 167774752, 77595616, 2150268969, 2424832, 5308416,
-0, 4294901760, 167774784, 77595488, 167774784, 94373088, 2150301733, 1769472,
-5505024, 0, 4294836224, 167774848, 56623328, 167774784, 94372704, 2490404,
-589824, 5505024, 4294836224, 0, 176163712, 60817632, 167774848, 94372064,
-2555937, 589824, 6291456, 131072, 0, 197135360, 23068960, 201329792,
-23068960, 2150531117, 589824, 6291456, 0, 4294836224, 197135488, 18874592,
-197135488, 23068960, 2719788, 720896, 6160384, 4294836224, 0, 197135488,
-23068896, 192940992, 23068896, 2150563882, 1638400, 6291456, 0, 4294836224,
-197135360, 52429152, 197135360, 56623904, 2150727728, 1769472, 6160384, 4294836224,
-0, 197135360, 56623456, 192940992, 56623776, 2150760492, 1769472, 6291456,
-0, 4294836224, 192941056, 56623456, 192941056, 60818272, 2150826029, 1638400,
-6291456, 131072, 0, 192941056, 60817760, 201329792, 60817760, 2150891566,
-720896, 6291456, 0, 4294836224, 192941184, 23068896, 192941184, 60817760,
-3080235, 458752, 6029312, 262144, 0, 167775104, 94372064, 192941184,
-60817632, 3145768, 458752, 5505024, 0, 4294705152, 167775360, 14744672,
-167775360, 94372064, 3211295, 4293591040, 6815744, 4294836224, 0, 218107392,
-4259380448, 209718528, 4250991904, 2151055413, 4294115328, 7208960, 0, 131072,
-230690304, 4284546656, 230690304, 4267769376, 2151252024, 4294115328, 7208960, 4294836224,
-0, 230690304, 4284546592, 218107328, 4284546592, 2151284788, 4293984256, 7340032,
-0, 4294836224, 218107392, 4263575008, 218107392, 4284546592, 3506231, 4293853184,
-7340032, 0, 4294443008, 209718784, 4259380448, 218107392, 4284546528, 3538995,
-720896, 7340032, 0, 4294836224, 230690304, 23068832, 230690304, 27263328,
-2151448635, 851968, 7208960, 4294836224, 0, 230690304, 27263136, 218107328,
-27263136, 2151481400, 1507328, 7208960, 0, 131072, 230690304, 52429536,
-230690304, 48234912, 2151645246, 1638400, 7208960, 4294836224, 0, 230690304,
-52429216, 218107328, 52429216, 2151678010, 1638400, 7340032, 0, 4294836224,
-218107392, 52429216, 218107392, 56623904, 2151743547, 851968, 7340032, 0,
-4294836224, 218107392, 27263136, 218107392, 56623520, 3932217, 65536, 6815744,
-4294836224, 0, 218107392, 10551136, 209718528, 2162656, 2151907394, 327680,
-6815744, 0, 524288, 218107392, 56623264, 209718784, 10551136, 4063293,
-4294639616, 7340032, 0, 4294443008, 209718784, 4284546272, 209718784, 56688480,
-4128823, 4294508544, 6553600, 393216, 0, 167775360, 94436448, 209718784,
-56687840, 4194354, 4292935680, 5373952, 0, 4294901760, 167775552, 4230019296,
-167775744, 94436448, 4259856, 1114112, 8257536, 0, 131072, 264245248,
-35652128, 264245248, 35652064, 2152104005, 983040, 8388608, 131072, 0,
-264245248, 35652064, 268439552, 35652064, 2152136771, 1114112, 8257536, 4294836224,
-0, 264245248, 35652064, 260050880, 35652064, 2152202308, 983040, 7995392,
-131072, 0, 255856448, 35652064, 255856512, 35652064, 2152431690, 1114112,
-7995392, 0, 131072, 255856512, 39846432, 255856512, 35652064, 4620361,
-1114112, 8126464, 4294836224, 0, 260050944, 35652064, 255856512, 39846368,
-4653125, 983040, 8388608, 0, 4294836224, 234885120, 31457440, 255856640,
-39846368, 4751428, 4293591040, 8257536, 4294836224, 0, 264245248, 4250991904,
-234885056, 4250991904, 2152562764, 4293459968, 8257536, 0, 131072, 234885120,
-4250991904, 234885120, 4246797536, 2152595530, 4293591040, 8388608, 0, 4294836224,
-234885120, 4250991840, 234885120, 4284546400, 2152661067, 4293459968, 8388608, 131072,
-0, 234885120, 4284546272, 268439616, 4271963360, 2152726604, 4294770688, 7864320,
-0, 393216, 251662240, 2162656, 251662272, 4288741216, 2153021523, 196608,
-8257536, 4294574080, 0, 264245248, 6356832, 251662272, 2162528, 5144658,
-196608, 8257536, 0, 4294574080, 251662336, 6356832, 251662336, 10485856,
-2153054287, 4294770688, 7864320, 131072, 0, 247467776, 10551136, 251662336,
-10551136, 5275729, 4294639616, 8388608, 655360, 0, 247468032, 10551136,
-268439552, 10551136, 2153119825, 4294901760, 7471104, 0, 131072, 239079040,
-2162656, 239079040, 4292935648, 2153349208, 65536, 7471104, 0, 131072,
-239079040, 2097184, 239079040, 2162656, 5472343, 4294901760, 7602176, 131072,
-0, 239079040, 2162656, 243273408, 10551136, 2153381972, 65536, 7471104,
-4294836224, 0, 239079104, 10551136, 234884672, 10551136, 2153447509, 327680,
-7733248, 4294311936, 0, 247468032, 10551136, 234884800, 10551136, 5636178,
-4294639616, 8388608, 0, 4294311936, 234885184, 4284546272, 234885120, 10551136,
-5701709, 327680, 7733248, 0, 655360, 234885120, 39846048, 234885184,
-10550496, 5767241, 851968, 8781824, 4294836224, 0, 281022720, 27263328,
-281022656, 27263328, 2153676893, 720896, 8912896, 0, 4294836224, 281022720,
-23068704, 281022720, 27263328, 5931100, 1114112, 8781824, 0, 131072,
-281022720, 35652128, 281022720, 35652064, 2153873504, 1114112, 8781824, 4294836224,
-0, 281022720, 35652064, 281022656, 35652064, 2153906268, 983040, 8912896,
-0, 4294836224, 281022720, 31457696, 281022720, 35652064, 6127711, 851968,
-8912896, 0, 4294836224, 281022720, 27263008, 281022720, 35652000, 6160475,
-589824, 9043968, 4294836224, 0, 289411456, 18874592, 289411392, 18874592,
-2154135652, 458752, 9175040, 0, 4294836224, 289411456, 14680288, 289411456,
-18874592, 6324323, 589824, 9175040, 0, 4294836224, 289411456, 18874592,
-289411456, 23068960, 2154168417, 851968, 9175040, 0, 4294836224, 289411456,
-27263328, 289411456, 39846304, 2154332263, 851968, 9043968, 4294836224, 0,
-289411456, 39846240, 285217088, 35651936, 2154365027, 720896, 9175040, 0,
-4294836224, 289411456, 23068896, 285217152, 39846240, 6553698, 720896, 8912896,
-131072, 0, 281022720, 35651616, 285217152, 39846112, 6619231, 327680,
-9568256, 4294836224, 0, 306188928, 10485856, 306188864, 10485856, 2154725485,
-327680, 9568256, 0, 131072, 306188928, 14680224, 306188928, 10485856,
-6783084, 327680, 9699328, 4294836224, 0, 310383360, 14680160, 306188928,
-14680160, 6848619, 196608, 9699328, 0, 4294836224, 297800448, 6291488,
-306189056, 14680160, 6914154, 589824, 9699328, 0, 4294836224, 306188928,
-18874592, 306188928, 18874656, 2154922096, 589824, 9699328, 4294836224, 0,
-310383360, 39846112, 306188928, 18874592, 7045231, 589824, 9568256, 4294836224,
-0, 306189056, 39846112, 293605952, 39846112, 2154954860, 458752, 9699328,
-0, 4294836224, 297800448, 14680096, 293606144, 39846112, 7143530, 458752,
-9175040, 131072, 0, 281022848, 39845920, 293606144, 39845920, 7209062,
-65536, 8781824, 4294836224, 0, 281022720, 2162656, 281022656, 2162656,
-2155118707, 4294901760, 8781824, 0, 131072, 281022720, 2162656, 281022720,
-4292935584, 2155151472, 4294770688, 9306112, 262144, 0, 285217216, 2162592,
-297800448, 2162592, 2155315318, 4294901760, 8912896, 131072, 0, 281022720,
-2162592, 285217536, 2162592, 7471217, 4294770688, 8781824, 4294836224, 0,
-281022720, 4288741216, 281022656, 4288741216, 2155577466, 4294639616, 8912896, 0,
-4294836224, 281022720, 4284546848, 281022720, 4288741216, 7635065, 4294508544, 8781824,
-4294705152, 0, 281022720, 4280352416, 272634048, 4280352416, 2155708540, 4294246400,
-8519680, 0, 262144, 272634112, 4280352416, 272634112, 4271963680, 2155741302,
-4294508544, 8781824, 0, 131072, 281022720, 4288741152, 272634112, 4280352288,
-7798901, 4294639616, 9175040, 0, 4294836224, 289411456, 4284546848, 289411456,
-4288741216, 2155905151, 4294639616, 9175040, 131072, 0, 289411456, 4288741152,
-293605824, 4288741152, 2155937913, 4294770688, 9043968, 4294836224, 0, 289411520,
-4288741152, 285217088, 4288741152, 2156003450, 4294508544, 9306112, 262144, 0,
-285217216, 4288741152, 306189056, 4288740768, 2156068987, 4294639616, 8912896, 131072,
-0, 272634112, 4288740896, 285217536, 4288740768, 8126584, 4293722112, 9568256,
-0, 4293918720, 272634624, 4255186208, 272634624, 4288740768, 8224888, 4294770688,
-8781824, 0, 131072, 281023232, 2162592, 272634624, 4288740640, 8257651,
-65536, 8781824, 0, 131072, 281023232, 39845920, 272634624, 2161952,
-8323183, 4293722112, 8519680, 262144, 0, 234885184, 39910624, 272634624,
-39910688, 8388697, 1507328, 8388608, 131072, 0, 264245248, 52429536,
-268440256, 52429536, 2156232836, 1638400, 8388608, 0, 4294836224, 264245952,
-52429536, 264245952, 56623904, 2156265602, 1638400, 8257536, 4294836224, 0,
-264245952, 56623840, 234885056, 56623840, 2156331139, 1507328, 9830400, 262144,
-0, 234885824, 56623840, 314577664, 56623840, 2156396676, 1507328, 9830400,
-0, 131072, 234885888, 56623840, 255857408, 48235168, 2156462213, 1376256,
-9043968, 4294836224, 0, 289411456, 44040800, 260051264, 44040800, 2156626058,
-1245184, 7995392, 131072, 0, 255856448, 44040800, 255856512, 44040800,
-2156757132, 1376256, 8126464, 4294836224, 0, 260051328, 44040800, 255856512,
-44040800, 8913031, 1245184, 9830400, 131072, 0, 301994688, 44040800,
-314577664, 44040800, 2156888206, 1245184, 9306112, 131072, 0, 293605824,
-44040800, 297800192, 44040800, 2157019280, 1376256, 9437184, 4294836224, 0,
-301994752, 44040800, 293605888, 44040800, 9109642, 1245184, 9175040, 131072,
-0, 255857024, 44040800, 293606144, 44040800, 9175177, 1376256, 9830400,
-0, 131072, 234885888, 56623776, 255857408, 44040800, 9240710, 1245184,
-9961472, 0, 4294836224, 234885888, 39910624, 234885888, 56623712, 9306241,
-4294639616, 7340032, 655360, 0, 167775744, 94435552, 234885888, 56687840,
-9371714, 4294574080, 393216, 0, 4294836224, 8388800, 4282449696, 8388800,
-4284546880, 2157150354, 393216, 393216, 0, 4294836224, 8388800, 12583072,
-8388800, 14680256, 2157281428, 327680, 262144, 0, 131072, 8388800,
-14680224, 8388800, 10551136, 2157314194, 4294639616, 393216, 0, 4294836224,
-8388800, 4284546848, 8388800, 14745440, 9633937, 4294770688, 524288, 4294836224,
-131072, 16777664, 10551136, 16777536, 4288741216, 2157478039, 327680, 655360,
-4294836224, 4294836224, 16777664, 10551136, 16777536, 10485856, 2157510805, 4294508544,
-655360, 262144, 262144, 16777664, 4292935456, 20971968, 4288741152, 2157674650,
-4294639616, 655360, 262144, 262144, 16777664, 10551136, 16777664, 4292935456,
-9896086, 196608, 917504, 262144, 4294705152, 16777664, 14680096, 20971968,
-14680160, 2157805724, 65536, 917504, 262144, 4294705152, 16777664, 10551072,
-16777664, 14680096, 10027160, 4294639616, 393216, 4294836224, 131072, 12583168,
-14745376, 12583168, 4284546848, 2157936798, 458752, 524288, 4294836224, 4294836224,
-12583168, 14745376, 12583168, 14680224, 2157969563, 196608, 524288, 4294574080,
-0, 16777664, 14745376, 12583168, 14745376, 10223770, 4294574080, 393216,
-65536, 0, 8388800, 14745376, 12583360, 14745376, 10289300, 4294443008,
-393216, 0, 4294836224, 8388800, 4278255328, 8388800, 4280352512, 2158133409,
-4294377472, 393216, 65536, 0, 8388800, 4280352480, 12583360, 4280352480,
-2158166175, 4294115328, 786432, 131072, 131072, 8389056, 4276158048, 25166272,
-4271963744, 2158330020, 4293722112, 786432, 4294836224, 131072, 25166272, 4255186272,
-8389056, 4255185504, 2158461094, 4293722112, 786432, 0, 4294443008, 8389056,
-4255185504, 8389056, 4267769248, 2158493858, 4294115328, 262144, 0, 524288,
-8389056, 4276158048, 8389056, 4267768416, 10682529, 4294377472, 262144, 0,
-131072, 8389056, 4280352480, 8389056, 4276157024, 10748064, 4294508544, 524288,
-0, 131072, 8389056, 14745376, 8389056, 4280351328, 10813598, 458752,
-4294705152, 4294836224, 0, 4286644160, 14680224, 4286644096, 14680224, 2158657705,
-327680, 4294836224, 131072, 0, 4286644160, 14680224, 4290773120, 14680224,
-2158690471, 196608, 262144, 0, 4294180864, 4278190208, 6356896, 4278190208,
-10485856, 2158854316, 327680, 4294705152, 0, 131072, 4286578816, 14680224,
-4278190208, 10551200, 11075752, 196608, 4294443008, 4294574080, 0, 4278190208,
-14745504, 4261478144, 14745504, 2158887082, 4294639616, 4294705152, 4294836224, 0,
-4286644160, 4284546848, 4261478272, 4284546848, 2159050927, 4294639616, 4294836224, 0,
-4294836224, 4261478336, 4284546848, 4261478336, 4288741216, 2159083692, 4294508544, 4294836224,
-131072, 0, 4261478336, 4288741152, 4290773120, 4288741152, 2159149229, 4294508544,
-4294705152, 0, 131072, 4261412992, 4288741152, 4261412992, 4280351328, 2159214766,
-4294770688, 4294443008, 0, 786432, 4261412992, 14745504, 4261412992, 4288739936,
-11468971, 4294639616, 262144, 4294901760, 0, 8389056, 14744160, 4261412992,
-14744160, 11534502, 524288, 393216, 0, 4294836224, 8388800, 16777440,
-8388800, 18874624, 2159378612, 524288, 393216, 65536, 0, 8388800,
-18874592, 12583360, 18874592, 2159411378, 720896, 917504, 131072, 4294836224,
-8389056, 27263264, 25166272, 27263328, 2159575223, 1376256, 917504, 4294836224,
-4294836224, 25166272, 44040800, 8389056, 94372448, 2159771834, 1245184, 786432,
-0, 4294443008, 8389056, 39846304, 8389056, 94372448, 11894969, 851968,
-786432, 0, 4294443008, 8389056, 27263264, 8389056, 94372256, 11927732,
-589824, 393216, 0, 4294836224, 8389056, 18874592, 8389056, 94372128,
-11993267, 589824, 262144, 4294901760, 0, 8389056, 94372064, 4261412992,
-94372064, 2159804600, 458752, 655360, 0, 4294836224, 4261413312, 14744160,
-4261413312, 94372064, 12124337, 65536, 1310720, 131072, 0, 33555072,
-14680096, 41943680, 6291488, 2159968445, 65536, 1048576, 0, 262144,
-33555072, 14680096, 33555200, 2162656, 2160001211, 458752, 1048576, 0,
-4294836224, 29360640, 14745568, 29360640, 18874592, 2160165056, 458752, 1048576,
-4294574080, 0, 33555200, 14745568, 29360640, 18939872, 12386492, 4294901760,
-1179648, 4294705152, 0, 37749504, 4292935520, 33555008, 4292935520, 2160361667,
-4294639616, 1179648, 0, 4294836224, 33555200, 4284546848, 33555200, 4292935520,
-12550338, 4294639616, 1048576, 4294836224, 0, 33555200, 4292935456, 29360640,
-4292935456, 2160394432, 4294770688, 1572864, 0, 131072, 50332480, 4288741280,
-50332480, 4288741152, 2160558278, 4294639616, 1835008, 0, 4294836224, 50332544,
-4284546848, 54526848, 4284546912, 2160689352, 4294508544, 1572864, 131072, 131072,
-50332480, 4288741152, 50332544, 4284546848, 12779714, 4294508544, 1572864, 262144,
-0, 29360896, 4292935456, 50332544, 4288741152, 12845249, 4294901760, 1179648,
-0, 393216, 29360896, 18939872, 29361024, 4292935456, 12910782, 4293328896,
-917504, 0, 655360, 29360896, 4246797536, 29361088, 4242603040, 2160951500,
-4293328896, 1572864, 4294574080, 393216, 50333056, 4280351776, 29361088, 4246797344,
-13074635, 4294246400, 917504, 0, 786432, 29361088, 4280352416, 29360960,
-4271963424, 2161082574, 4294508544, 1966080, 4294705152, 4294705152, 29361536, 4280351776,
-29361088, 4280352032, 13172936, 4292935680, 2883584, 0, 4294049792, 29361536,
-4230019680, 29361536, 4280351776, 13271242, 4294508544, 1048576, 0, 524288,
-29361024, 18939680, 29361536, 4280351328, 13304006, 4294508544, 3276800, 0,
-131072, 104859264, 4284546848, 104859264, 4280352480, 2161279185, 4294508544, 3407872,
-131072, 0, 104859264, 4284546784, 109053632, 4284546784, 2161311949, 4294508544,
-2883584, 131072, 0, 88081792, 4284546848, 92276288, 4284546848, 2161475796,
-4294508544, 2752512, 0, 131072, 88081984, 4284546848, 88081984, 4280352480,
-2161508559, 4294639616, 3276800, 4294836224, 0, 104859328, 4284546784, 88081984,
-4284546784, 13631694, 4294508544, 2359296, 131072, 0, 71304320, 4284546848,
-75498816, 4284546848, 2161672407, 4294639616, 2228224, 4294836224, 0, 71304512,
-4284546848, 67109952, 4284546848, 2161705170, 4294508544, 2228224, 0, 131072,
-67110208, 4284546848, 67110208, 4280352480, 2161770707, 4294639616, 2752512, 4294836224,
-0, 88082112, 4284546784, 67110208, 4284546784, 13893841, 4294639616, 3407872,
-0, 4294836224, 67110592, 4284546784, 67110592, 4288741216, 2161836245, 4294770688,
-2097152, 0, 1441792, 67110592, 6356896, 67110592, 4288741088, 14057680,
-4294574080, 1966080, 4294901760, 0, 62915584, 4282449696, 62915520, 4282449696,
-2162000092, 4294508544, 1966080, 0, 131072, 62915584, 4282449696, 62915584,
-4280352480, 2162032856, 4294639616, 1966080, 4294901760, 0, 62915584, 4284546880,
-62915520, 4284546880, 2162196703, 4294574080, 2097152, 0, 4294836224, 62915584,
-4282449632, 62915584, 4284546880, 14287065, 4294770688, 1703936, 262144, 0,
-50332480, 2162592, 54526848, 2162528, 2162458851, 65536, 1703936, 0,
-131072, 50332544, 6291488, 50332544, 2162528, 14450914, 4294901760, 1572864,
-262144, 0, 41943808, 6356960, 50332544, 6356832, 14516449, 65536,
-1835008, 0, 262144, 58721280, 6291488, 58721280, 2162656, 2162589925,
-4294705152, 1966080, 4294901760, 0, 62915584, 4286644064, 58721216, 4286644064,
-2162720999, 4294770688, 1966080, 4294901760, 0, 62915584, 4288741248, 58721216,
-4288741248, 2162917610, 4294770688, 1966080, 0, 131072, 58721280, 4292935584,
-58721280, 4288741248, 14778601, 4294705152, 2097152, 0, 4294836224, 58721280,
-4286644064, 58721280, 4292935552, 14811360, 4294901760, 1835008, 0, 262144,
-58721280, 6356960, 58721280, 4292935520, 14876895, 65536, 1835008, 131072,
-0, 41943936, 6356832, 58721280, 6356832, 14942430, 4294639616, 2097152,
-0, 4294836224, 62915584, 4284546784, 41944064, 6356832, 15007963, 65536,
-2097152, 4294836224, 0, 67110592, 6356704, 41944064, 6356704, 15073495,
-327680, 1703936, 0, 131072, 50332544, 14680224, 54526848, 10485920,
-2163179758, 327680, 1703936, 131072, 4294836224, 46138176, 14680160, 50332544,
-14680224, 15237357, 196608, 1441792, 262144, 0, 33555136, 14680160,
-46138240, 14680160, 15302892, 720896, 1703936, 0, 4294180864, 29361088,
-23068896, 29360960, 48234848, 2163310832, 1638400, 1572864, 0, 4294311936,
-29360896, 52429536, 29361088, 65012512, 2163507443, 2031616, 1966080, 4294574080,
-4294574080, 50333056, 65011936, 29361088, 65012448, 15499506, 458752, 1966080,
-262144, 4294705152, 29361088, 48234720, 29361536, 65011936, 15532267, 2031616,
-2883584, 0, 4294049792, 29361536, 65011936, 29361536, 94372832, 2163540206,
-458752, 1441792, 0, 4294574080, 33555328, 14680160, 29361536, 94372064,
-15663338, 327680, 3407872, 131072, 0, 104859264, 14680224, 109053632,
-14680224, 2163704054, 327680, 3276800, 0, 131072, 104859328, 14680224,
-104859328, 10485856, 2163736817, 327680, 2883584, 131072, 0, 88081792,
-14680224, 92276288, 14680224, 2163900665, 327680, 2752512, 0, 131072,
-88081984, 14680224, 88081984, 10485856, 2163933427, 458752, 3276800, 4294836224,
-0, 104859328, 14680160, 88081984, 14680160, 15991026, 327680, 2359296,
-131072, 0, 71304320, 14680224, 75498816, 14680224, 2164097276, 458752,
-2228224, 4294836224, 0, 71304512, 14680224, 67109952, 14680224, 2164130038,
-327680, 2228224, 0, 131072, 67110208, 14680224, 67110208, 10485856,
-2164195575, 458752, 2752512, 4294836224, 0, 88082112, 14680160, 67110208,
-14680160, 16253173, 458752, 2359296, 0, 4294836224, 67110592, 14680160,
-67110592, 18874592, 2164261113, 458752, 2097152, 0, 4294836224, 58721280,
-14680160, 62915584, 18874592, 2164490498, 196608, 1835008, 131072, 0,
-54526848, 10485856, 58721280, 18874464, 16482561, 458752, 2097152, 4294705152,
-0, 67110592, 18874464, 54526976, 18874464, 16515322, 589824, 2097152,
-786432, 786432, 29361536, 94371936, 54527680, 18874464, 16580848, 196608,
-1441792, 0, 4294836224, 41944768, 6356704, 29361856, 94371936, 16646375,
-4293591040, 2883584, 786432, 4294180864, 29361536, 18938464, 29361856, 94437088,
-16711884, 4294901760, 917504, 131072, 0, 4261413312, 94435936, 29361856,
-94435936, 16777402, 4291624960, 4718592, 0, 262144, 150997504, 4196465056,
-159386112, 4188076384, 2164621572, 4291887104, 4849664, 1703936, 0, 150997312,
-4250991136, 155191808, 4250991136, 2164752646, 4291887104, 5242880, 0, 4294574080,
-150997504, 4196464992, 150997504, 4250991136, 16974082, 4293984256, 4980736, 4294836224,
-0, 159386112, 4263574880, 150997376, 4259380576, 2164883720, 4293591040, 5242880,
-0, 4294574080, 150997504, 4250990944, 150997504, 4263574880, 17105156, 65536,
-4849664, 0, 131072, 155191680, 18874400, 155191680, 2162656, 2165145868,
-4294901760, 4849664, 131072, 0, 142608704, 18939872, 155191680, 18939872,
-17269003, 4294901760, 4849664, 0, 131072, 142608768, 18939872, 142608768,
-4292935392, 2165178632, 65536, 4980736, 4294836224, 0, 159386048, 18939616,
-142608768, 18939616, 17400074, 4294377472, 4456448, 0, 655360, 142608832,
-18939616, 142608832, 4276158112, 2165244170, 589824, 4456448, 4293787648, 0,
-142608832, 18939552, 138414208, 18939552, 2165309707, 4294246400, 4325376, 0,
-655360, 138414528, 18939552, 159386048, 4271963744, 2165375244, 327680, 5111808,
-0, 131072, 163580416, 18874528, 163580416, 6356896, 2165604627, 4294639616,
-5242880, 0, 4294836224, 163580416, 4284546656, 163580416, 18939808, 17727762,
-4294639616, 5111808, 131072, 0, 138414528, 18939488, 163580416, 18939488,
-17760525, 720896, 4980736, 0, 4294311936, 138414592, 23068960, 159386112,
-27263328, 2165735701, 589824, 5111808, 0, 4294311936, 138414592, 18939488,
-138414592, 27263264, 17891600, 65536, 3801088, 4294836224, 0, 121636928,
-10551136, 113248064, 2162656, 2165866775, 4294639616, 4325376, 4294574080, 0,
-138414592, 27328096, 113248320, 10551136, 18022674, 1376256, 4849664, 1703936,
-0, 150997312, 98566816, 155191808, 98566816, 2165997849, 3342336, 4980736,
-0, 4294705152, 150997504, 106956256, 159386112, 111150688, 2166128923, 3080192,
-5242880, 0, 4294574080, 150997504, 98566816, 150997504, 111150560, 18219285,
-1114112, 4980736, 4294836224, 0, 159386112, 44040672, 150997376, 44040736,
-2166259997, 1376256, 4849664, 0, 393216, 150997504, 111149728, 150997504,
-44040672, 18350359, 851968, 5242880, 0, 4294705152, 113248768, 27328096,
-150997504, 111149536, 18415892, 4293984256, 5242880, 0, 4294705152, 150997504,
-4263573856, 113248768, 111214176, 18481414, 4294770688, 3538944, 131072, 0,
-4261414592, 94435936, 113248768, 111212896, 18546945, 4293722112, 5242880, 4294836224,
-0, 167777024, 94435552, 4261415424, 111212896, 18612368};
+extern const uint32_t mercury_WADSectors[357] = {
+838926256, 65536, 192, 4258267136, 12800, 12582913, 0, 838925696,
+65538, 192, 4268752896, 209408, 12582913, 0, 838926016, 65538,
+192, 4195352576, 274944, 12582913, 0, 838924896, 65540, 192,
+0, 340480, 12582913, 0, 78643200, 393221, 128, 0,
+330240, 12582918, 0, 167772400, 393218, 192, 15728640, 133632,
+12582918, 0, 167772400, 393218, 192, 15728640, 133632, 12582918,
+0, 167772400, 393218, 192, 15728640, 133632, 12582918, 0,
+78643200, 393218, 128, 4289724416, 199168, 12582918, 0, 167837616,
+393219, 192, 0, 340480, 12582913, 0, 94371840, 393218,
+192, 4289724416, 199168, 12582918, 0, 78643200, 393218, 128,
+0, 132272, 8388614, 0, 83886080, 393218, 192, 0,
+132272, 8388614, 0, 83886080, 393218, 192, 0, 132352,
+12582918, 0, 83886080, 393218, 192, 0, 132352, 12582918,
+0, 83886080, 393218, 192, 0, 132272, 8388614, 0,
+83886080, 393218, 192, 0, 132352, 12582918, 0, 78643200,
+393218, 128, 4289724416, 197888, 12582918, 0, 83951536, 393219,
+192, 0, 132272, 8388614, 0, 167772160, 393218, 192,
+0, 132352, 11534342, 0, 83886080, 393218, 192, 0,
+132352, 12582918, 0, 83886080, 393218, 192, 0, 132352,
+12582918, 0, 83886080, 393218, 192, 0, 132352, 12582918,
+0, 83886080, 393218, 192, 0, 132352, 12582918, 0,
+83886080, 393218, 192, 0, 132352, 12582918, 0, 83886080,
+393218, 192, 0, 132352, 12582918, 0, 78643200, 393218,
+128, 4289724416, 197888, 12582918, 0, 83886080, 393218, 160,
+4289724416, 132512, 12582918, 0, 83886080, 393218, 192, 0,
+132352, 12582918, 0, 83886080, 393218, 192, 0, 132272,
+8388614, 0, 83951536, 393219, 192, 0, 131712, 5242886,
+0, 83951536, 393218, 192, 4289724416, 132352, 12582918, 0,
+83886080, 393218, 192, 0, 132352, 12582918, 0, 83886080,
+393218, 192, 0, 132352, 12582918, 0, 83886080, 393218,
+192, 0, 132352, 12582918, 0, 83886080, 393218, 192,
+0, 132352, 12582918, 0, 83886080, 393218, 192, 0,
+132352, 12582918, 0, 83886080, 393218, 192, 0, 132352,
+12582918, 0, 83886080, 393218, 192, 4268752896, 143872, 12582918,
+0, 838925936, 393218, 192, 173015040, 12800, 12582913, 0,
+838864000, 65538, 192, 167772160, 143872, 12582913, 0, 838863360,
+65538, 192, 209715200, 143872, 12582913, 0, 838860800, 65541,
+192, 0, 340480, 12582913, 0, 838925616, 65539, 192,
+209715200, 143872, 12582913, 0, 838864000, 65538, 192, 4289724416,
+460192, 12582918, 0, 838863920, 65536, 192, 193986560, 12800,
+12582913, 0, 838863600, 65536, 192, 4289724416, 12800, 12582913,
+0, 838926096, 65536, 192, 4268752896, 12800, 12582913, 0,
+838925776, 65536, 192, 4268752896, 12800, 12582913, 0, 838926096,
+65536, 192, 0, 460032, 12582918, 0, 83886080, 393218,
+192, 0, 133632, 12582918, 0};
+extern const uint32_t mercury_WADNodes[2002] = {
+92340128, 320, 167775744, 94435552, 234885888, 56687840, 4456449, 29424736,
+4292870144, 167775552, 4230019296, 167775744, 94436448, 1245186, 33618976, 65472,
+176164160, 4230019296, 167774848, 4230019680, 1048579, 71367648, 8388608, 176164160,
+4230020000, 176164032, 4221630688, 327684, 71367648, 64, 176164032, 4230020000,
+213912896, 4225825696, 2147581952, 46201120, 640, 176163648, 4221630688, 188746944,
+4221630688, 425986, 71367264, 4290772992, 188746944, 4196464864, 188746944, 4221631008,
+720903, 58784032, 192, 188746752, 4196464864, 201329856, 4196464864, 557059,
+67172896, 4194304, 209718464, 4196465120, 201329856, 4192270560, 655369, 67172896,
+64, 209718400, 4196465120, 209718464, 4196465120, 2147844100, 58784224, 12582912,
+201329856, 4192270752, 201329856, 4188076256, 2147975174, 46201760, 25165824, 188746944,
+4221631328, 188746944, 4217436704, 819208, 54590304, 65472, 197135552, 4217436704,
+188746688, 4217436704, 884745, 54590304, 4290772992, 188746688, 4213242400, 188746688,
+4217436960, 2148335630, 50395936, 64, 188746624, 4213242400, 192940992, 4213242592,
+1015818, 50395936, 4194304, 192940992, 4213242592, 192940992, 4209048288, 2148302859,
+27327392, 192, 167774752, 4230019680, 169872000, 4230019936, 1179665, 27327328,
+4292870144, 167774752, 4213242464, 167774752, 4230019936, 2148499470, 29424608, 64,
+169871936, 4230019936, 171969152, 4225825696, 2148630544, 67174240, 192, 167775360,
+94436448, 209718784, 56687840, 3538964, 33554720, 4286578688, 167775360, 14744672,
+167775360, 94372064, 2359317, 33619808, 65472, 176163968, 14744800, 167774848,
+4280351840, 2228246, 50397024, 16777216, 176163968, 14745376, 176163968, 4280351968,
+1638423, 33619936, 20971520, 176163968, 14745504, 176163968, 4288741152, 2148794392,
+54526112, 65344, 197135488, 14745504, 176163776, 14680160, 2148761618, 50396896,
+128, 176163712, 4280351968, 192941184, 4280351968, 1835034, 50396704, 4278190080,
+176163712, 4259380448, 176163712, 4280352224, 1802261, 33619680, 16777216, 176163712,
+4280352416, 176163712, 4271963616, 2149023766, 62979488, 65408, 205524096, 4280351968,
+192941120, 4280351968, 1966109, 67173792, 4290772992, 205524096, 4250991840, 205524096,
+4280352096, 2149154840, 58785184, 4290772992, 192941120, 4250991840, 192941120, 4280352096,
+2149449759, 54590880, 65472, 197135424, 4250991840, 192940992, 4250991840, 2149384224,
+54590816, 4194304, 197135424, 4250991904, 197135424, 4246797536, 2149318689, 58785120,
+64, 197135360, 4250991904, 201329728, 4250991904, 2149285914, 25231136, 8388608,
+167774848, 4280352480, 167774848, 4255186016, 2326559, 33619360, 4286578688, 167774752,
+4246797408, 167774848, 4255186272, 2149679136, 50331936, 128, 167775104, 94372064,
+192941184, 60817632, 3014693, 33554784, 65472, 176163712, 60817632, 167774848,
+94372064, 2621478, 33555168, 16777216, 176163712, 60818080, 176163712, 44040416,
+2588706, 50332064, 4278190080, 176163712, 23068896, 176163712, 44040544, 2149875747,
+33555360, 4290772992, 167774848, 56623328, 167774784, 94372704, 2883625, 33555296,
+4290772992, 167774848, 52429024, 171969152, 56623904, 2818090, 33554784, 4286578688,
+167774848, 18874592, 167774784, 52429536, 2150006821, 29360992, 64, 171969088,
+56623904, 171969152, 56623904, 2150137895, 27264224, 4292870144, 167774784, 77595488,
+167774784, 94373088, 2150301741, 29361120, 4290772992, 167774784, 60818272, 167774752,
+77595616, 2150268969, 58720672, 4290772992, 192941184, 23068896, 192941184, 60817760,
+3276847, 54526368, 65472, 197135488, 23068896, 192940992, 23068896, 2150563888,
+58720608, 4290772992, 197135488, 18874592, 197135488, 23068960, 3244076, 58720608,
+64, 197135360, 23068960, 201329792, 23068960, 2150531117, 58721120, 64,
+192941056, 60817760, 201329792, 60817760, 2150891571, 58721184, 4290772992, 192941056,
+56623456, 192941056, 60818272, 2150826036, 54526880, 65472, 197135360, 56623456,
+192940992, 56623776, 2150760501, 58721120, 4290772992, 197135360, 52429152, 197135360,
+56623904, 2150727728, 92340128, 4278190080, 209718784, 4284546272, 209718784, 56688480,
+3932215, 92339744, 4278190080, 209718784, 4259380448, 218107392, 4284546528, 3735608,
+75562400, 65472, 218107392, 4259380448, 209718528, 4250991904, 2151055413, 92339808,
+4290772992, 218107392, 4263575008, 218107392, 4284546592, 3833911, 88145568, 65472,
+230690304, 4284546592, 218107328, 4284546592, 2151284795, 88145568, 4194304, 230690304,
+4284546656, 230690304, 4267769376, 2151252024, 75497696, 16777216, 218107392, 56623264,
+209718784, 10551136, 4390973, 92275168, 4290772992, 218107392, 27263136, 218107392,
+56623520, 4194366, 88080864, 65472, 230690304, 27263136, 218107328, 27263136,
+2151481407, 92275104, 4290772992, 230690304, 23068832, 230690304, 27263328, 2151448635,
+92275552, 4290772992, 218107392, 52429216, 218107392, 56623904, 2151743553, 88081248,
+65472, 230690304, 52429216, 218107328, 52429216, 2151678018, 88081184, 4194304,
+230690304, 52429536, 230690304, 48234912, 2151645246, 75497568, 65472, 218107392,
+10551136, 209718528, 2162656, 2151907394, 176161440, 4290772992, 234885888, 39910624,
+234885888, 56623712, 8650821, 130088416, 128, 234885184, 39910624, 272634624,
+39910688, 6094918, 104857824, 20971520, 234885120, 39846048, 234885184, 10550496,
+5111879, 125829664, 4290772992, 234885120, 31457440, 255856640, 39846368, 4751428,
+117441120, 65472, 260050944, 35652064, 255856512, 39846368, 4980809, 121635424,
+65472, 264245248, 35652064, 260050880, 35652064, 2152202314, 125829664, 64,
+264245248, 35652064, 268439552, 35652064, 2152136779, 121635424, 4194304, 264245248,
+35652128, 264245248, 35652064, 2152104005, 113246816, 4194304, 255856512, 39846432,
+255856512, 35652064, 5079113, 113246752, 64, 255856448, 35652064, 255856512,
+35652064, 2152431690, 125894560, 4273995776, 234885184, 4284546272, 234885120, 10551136,
+5439567, 125893984, 64, 234885120, 4284546272, 268439616, 4271963360, 2152726608,
+125894048, 4290772992, 234885120, 4250991840, 234885120, 4284546400, 2152661073, 121699680,
+4194304, 234885120, 4250991904, 234885120, 4246797536, 2152595538, 121699744, 65472,
+264245248, 4250991904, 234885056, 4250991904, 2152562764, 104857824, 65216, 247468032,
+10551136, 234884800, 10551136, 5832788, 125894560, 320, 247468032, 10551136,
+268439552, 10551136, 2153119829, 109117408, 64, 247467776, 10551136, 251662336,
+10551136, 5668945, 121634976, 4282384384, 251662336, 6356832, 251662336, 10485856,
+2153054295, 121634976, 65344, 264245248, 6356832, 251662272, 2162528, 5800018,
+109117408, 12582912, 251662240, 2162656, 251662272, 4288741216, 2153021523, 96469088,
+65472, 239079104, 10551136, 234884672, 10551136, 2153447514, 100663328, 64,
+239079040, 2162656, 243273408, 10551136, 2153381979, 96469088, 4194304, 239079040,
+2097184, 239079040, 2162656, 6062167, 96469024, 4194304, 239079040, 2162656,
+239079040, 4292935648, 2153349208, 138412128, 4194304, 281023232, 39845920, 272634624,
+2161952, 7602270, 150995232, 64, 281022848, 39845920, 293606144, 39845920,
+7077983, 142606752, 64, 281022720, 35651616, 285217152, 39846112, 6684768,
+142606816, 4290772992, 281022720, 27263008, 281022720, 35652000, 6488161, 142606752,
+4290772992, 281022720, 23068704, 281022720, 27263328, 6455388, 138412512, 65472,
+281022720, 27263328, 281022656, 27263328, 2153676893, 142606880, 4290772992, 281022720,
+31457696, 281022720, 35652064, 6586463, 138412640, 65472, 281022720, 35652064,
+281022656, 35652064, 2153906277, 138412640, 4194304, 281022720, 35652128, 281022720,
+35652064, 2153873504, 150995360, 4290772992, 289411456, 23068896, 285217152, 39846240,
+6946919, 150995296, 4290772992, 289411456, 18874592, 289411456, 23068960, 2154168424,
+150995232, 4290772992, 289411456, 14680288, 289411456, 18874592, 6914147, 146800992,
+65472, 289411456, 18874592, 289411392, 18874592, 2154135652, 146801120, 65472,
+289411456, 39846240, 285217088, 35651936, 2154365035, 150995424, 4290772992, 289411456,
+27263328, 289411456, 39846304, 2154332263, 167772448, 4290772992, 297800448, 14680096,
+293606144, 39846112, 7405677, 167772320, 4290772992, 297800448, 6291488, 306189056,
+14680160, 7241834, 167772384, 65472, 310383360, 14680160, 306188928, 14680160,
+7307371, 163578080, 4194304, 306188928, 14680224, 306188928, 10485856, 7372908,
+163578080, 65472, 306188928, 10485856, 306188864, 10485856, 2154725485, 163578208,
+65472, 306189056, 39846112, 293605952, 39846112, 2154954866, 167772512, 65472,
+310383360, 39846112, 306188928, 18874592, 7569519, 167772512, 4290772992, 306188928,
+18874592, 306188928, 18874656, 2154922096, 138477536, 4194304, 281023232, 2162592,
+272634624, 4288740640, 7929973, 142606368, 64, 281022720, 2162592, 285217536,
+2162592, 7864438, 138412064, 4194304, 281022720, 2162656, 281022720, 4292935584,
+2155151479, 138412128, 65472, 281022720, 2162656, 281022656, 2162656, 2155118707,
+155254752, 128, 285217216, 2162592, 297800448, 2162592, 2155315318, 163642848,
+4261412864, 272634624, 4255186208, 272634624, 4288740768, 8028280, 142671776, 64,
+272634112, 4288740896, 285217536, 4288740768, 8388731, 138477408, 4194304, 281022720,
+4288741152, 272634112, 4280352288, 8257660, 142671776, 4290772992, 281022720, 4284546848,
+281022720, 4288741216, 8224889, 138477536, 65472, 281022720, 4288741216, 281022656,
+4288741216, 2155577466, 130088672, 8388608, 272634112, 4280352416, 272634112, 4271963680,
+2155741311, 138477408, 65408, 281022720, 4280352416, 272634048, 4280352416, 2155708540,
+155254624, 128, 285217216, 4288741152, 306189056, 4288740768, 2156068993, 146866144,
+65472, 289411520, 4288741152, 285217088, 4288741152, 2156003458, 151060384, 64,
+289411456, 4288741152, 293605824, 4288741152, 2155937923, 151060384, 4290772992, 289411456,
+4284546848, 289411456, 4288741216, 2155905151, 171967200, 4194304, 234885888, 56623776,
+255857408, 44040800, 9044101, 171967264, 4194304, 234885888, 56623840, 255857408,
+48235168, 2156462214, 171967264, 128, 234885824, 56623840, 314577664, 56623840,
+2156396679, 121635680, 65472, 264245952, 56623840, 234885056, 56623840, 2156331144,
+125829984, 4290772992, 264245952, 52429536, 264245952, 56623904, 2156265609, 125829920,
+64, 264245248, 52429536, 268440256, 52429536, 2156232836, 150995616, 64,
+255857024, 44040800, 293606144, 44040800, 9306251, 117441248, 65472, 260051328,
+44040800, 255856512, 44040800, 9240716, 146801376, 65472, 289411456, 44040800,
+260051264, 44040800, 2156626058, 113246880, 64, 255856448, 44040800, 255856512,
+44040800, 2156757132, 159384288, 65472, 301994752, 44040800, 293605888, 44040800,
+9437327, 171967136, 64, 301994688, 44040800, 314577664, 44040800, 2156888206,
+155189920, 64, 293605824, 44040800, 297800192, 44040800, 2157019280, 4265672672,
+64, 4261414592, 94435936, 113248768, 111212896, 16973970, 4181721120, 64,
+4261413312, 94435936, 29361856, 94435936, 12386451, 4173332768, 4290772992, 4261413312,
+14744160, 4261413312, 94372064, 11862164, 4160815008, 65504, 8389056, 14744160,
+4261412992, 14744160, 11206805, 4169203552, 4194304, 8389056, 14745376, 8389056,
+4280351328, 10748054, 4165009280, 32, 8388800, 14745376, 12583360, 14745376,
+10158231, 4165009312, 4290772992, 8388800, 4284546848, 8388800, 14745440, 10027160,
+4165009280, 4290772992, 8388800, 4282449696, 8388800, 4284546880, 2157150354, 4160749792,
+4194304, 8388800, 14680224, 8388800, 10551136, 2157314202, 4164944128, 4290772992,
+8388800, 12583072, 8388800, 14680256, 2157281428, 4169138336, 65344, 16777664,
+14745376, 12583168, 14745376, 10616988, 4181721184, 4286578816, 16777664, 10551072,
+16777664, 14680096, 10551453, 4173397920, 8388736, 16777664, 10551136, 16777664,
+4292935456, 10485918, 4173332704, 4290838464, 16777664, 10551136, 16777536, 10485856,
+2157510815, 4169203680, 4259776, 16777664, 10551136, 16777536, 4288741216, 2157478039,
+4173397856, 8388736, 16777664, 4292935456, 20971968, 4288741152, 2157674650, 4181721248,
+4286578816, 16777664, 14680096, 20971968, 14680160, 2157805724, 4169138464, 4290838464,
+12583168, 14745376, 12583168, 14680224, 2157969571, 4165009312, 4259776, 12583168,
+14745376, 12583168, 4284546848, 2157936798, 4160814880, 4194304, 8389056, 4280352480,
+8389056, 4276157024, 10944677, 4165009184, 32, 8388800, 4280352480, 12583360,
+4280352480, 2158166182, 4165009216, 4290772992, 8388800, 4278255328, 8388800, 4280352512,
+2158133409, 4160814752, 16777216, 8389056, 4276158048, 8389056, 4267768416, 11075752,
+4177591968, 4194368, 8389056, 4276158048, 25166272, 4271963744, 2158330020, 4177591776,
+4278190080, 8389056, 4255185504, 8389056, 4267769248, 2158493866, 4177591776, 4259776,
+25166272, 4255186272, 8389056, 4255185504, 2158461094, 4135649248, 25165824, 4261412992,
+14745504, 4261412992, 4288739936, 11600044, 4135583904, 65344, 4278190208, 14745504,
+4261478144, 14745504, 2158887085, 4143972576, 4194304, 4286578816, 14680224, 4278190208,
+10551200, 11534510, 4148166880, 64, 4286644160, 14680224, 4290773120, 14680224,
+2158690479, 4143972640, 65472, 4286644160, 14680224, 4286644096, 14680224, 2158657705,
+4160749728, 4269801472, 4278190208, 6356896, 4278190208, 10485856, 2158854316, 4144037728,
+4194304, 4261412992, 4288741152, 4261412992, 4280351328, 2159214770, 4148232032, 64,
+4261478336, 4288741152, 4290773120, 4288741152, 2159149235, 4148232096, 4290772992, 4261478336,
+4284546848, 4261478336, 4288741216, 2159083700, 4144037792, 65472, 4286644160, 4284546848,
+4261478272, 4284546848, 2159050927, 4160749920, 65504, 8389056, 94372064, 4261412992,
+94372064, 2159804598, 4164944224, 4290772992, 8389056, 18874592, 8389056, 94372128,
+12124343, 4164944192, 32, 8388800, 18874592, 12583360, 18874592, 2159411384,
+4164944192, 4290772992, 8388800, 16777440, 8388800, 18874624, 2159378612, 4177527264,
+4278190080, 8389056, 27263264, 8389056, 94372256, 12255418, 4181721504, 4290773056,
+8389056, 27263264, 25166272, 27263328, 2159575223, 4177527456, 4278190080, 8389056,
+39846304, 8389056, 94372448, 12353721, 4181721824, 4290838464, 25166272, 44040800,
+8389056, 94372448, 2159771834, 4244700576, 4269801856, 29361536, 18938464, 29361856,
+94437088, 13631678, 4185980768, 16777216, 29361024, 18939680, 29361536, 4280351328,
+13303999, 4190109728, 12582912, 29360896, 18939872, 29361024, 4292935456, 12845248,
+4185915680, 65344, 33555200, 14745568, 29360640, 18939872, 12779713, 4185915488,
+8388608, 33555072, 14680096, 33555200, 2162656, 2160001218, 4194304096, 64,
+33555072, 14680096, 41943680, 6291488, 2159968445, 4185915680, 4290772992, 29360640,
+14745568, 29360640, 18874592, 2160165056, 4202757984, 128, 29360896, 4292935456,
+50332544, 4288741152, 13107397, 4185980832, 65472, 33555200, 4292935456, 29360640,
+4292935456, 2160394438, 4190175136, 4290772992, 33555200, 4284546848, 33555200, 4292935520,
+13074626, 4190109728, 65408, 37749504, 4292935520, 33555008, 4292935520, 2160361667,
+4202757984, 4194368, 50332480, 4288741152, 50332544, 4284546848, 13238473, 4202758112,
+4194304, 50332480, 4288741280, 50332480, 4288741152, 2160558278, 4211146656, 4290772992,
+50332544, 4284546848, 54526848, 4284546912, 2160689352, 4244700256, 4265607168, 29361536,
+4230019680, 29361536, 4280351776, 13402314, 4215340896, 4286644096, 29361536, 4280351776,
+29361088, 4280352032, 13566157, 4202757408, 12648256, 50333056, 4280351776, 29361088,
+4246797344, 13533387, 4181785888, 20971520, 29360896, 4246797536, 29361088, 4242603040,
+2160951500, 4181786336, 25165824, 29361088, 4280352416, 29360960, 4271963424, 2161082574,
+4198498464, 4290772992, 41944768, 6356704, 29361856, 94371936, 15466705, 4219469920,
+65472, 67110592, 6356704, 41944064, 6356704, 14483666, 4219535328, 46137344,
+67110592, 6356896, 67110592, 4288741088, 13861072, 4261478304, 4290772992, 67110592,
+4284546784, 67110592, 4288741216, 2161836244, 4240506784, 65472, 88082112, 4284546784,
+67110208, 4284546784, 14287061, 4257284000, 65472, 104859328, 4284546784, 88081984,
+4284546784, 14155990, 4261478240, 64, 104859264, 4284546784, 109053632, 4284546784,
+2161311959, 4257283936, 4194304, 104859264, 4284546848, 104859264, 4280352480, 2161279185,
+4240506720, 4194304, 88081984, 4284546848, 88081984, 4280352480, 2161508569, 4244701024,
+64, 88081792, 4284546848, 92276288, 4284546848, 2161475796, 4223729504, 4194304,
+67110208, 4284546848, 67110208, 4280352480, 2161770715, 4223729568, 65472, 71304512,
+4284546848, 67109952, 4284546848, 2161705180, 4227923808, 64, 71304320, 4284546848,
+75498816, 4284546848, 2161672407, 4219535264, 4290772992, 62915584, 4284546784, 41944064,
+6356832, 14811358, 4219535232, 4290772992, 62915584, 4282449632, 62915584, 4284546880,
+14745823, 4215340896, 4194304, 62915584, 4282449696, 62915584, 4280352480, 2162032864,
+4215340928, 65504, 62915584, 4282449696, 62915520, 4282449696, 2162000092, 4215340960,
+65504, 62915584, 4284546880, 62915520, 4284546880, 2162196703, 4211081312, 64,
+41943936, 6356832, 58721280, 6356832, 15073507, 4202692640, 128, 41943808,
+6356960, 50332544, 6356832, 14975201, 4206887008, 4194304, 50332544, 6291488,
+50332544, 2162528, 15040738, 4206952416, 128, 50332480, 2162592, 54526848,
+2162528, 2162458851, 4211081248, 8388608, 58721280, 6356960, 58721280, 4292935520,
+15204583, 4211081312, 8388608, 58721280, 6291488, 58721280, 2162656, 2162589925,
+4219535296, 4290772992, 58721280, 4286644064, 58721280, 4292935552, 15335657, 4215340992,
+65504, 62915584, 4286644064, 58721216, 4286644064, 2162720999, 4215341024, 4194304,
+58721280, 4292935584, 58721280, 4288741248, 15433961, 4215341024, 65504, 62915584,
+4288741248, 58721216, 4288741248, 2162917610, 4219470176, 25166208, 29361536, 94371936,
+54527680, 18874464, 16122093, 4198498592, 4282384384, 33555328, 14680160, 29361536,
+94372064, 15794414, 4198498464, 128, 33555136, 14680160, 46138240, 14680160,
+15696108, 4206887136, 4290773056, 46138176, 14680160, 50332544, 14680224, 15761645,
+4206887136, 4194304, 50332544, 14680224, 54526848, 10485920, 2163179758, 4244636704,
+4265607168, 29361536, 65011936, 29361536, 94372832, 2163540210, 4215275808, 4286578816,
+29361088, 48234720, 29361536, 65011936, 15991027, 4206887328, 4269801472, 29361088,
+23068896, 29360960, 48234848, 2163310832, 4215276576, 4282449728, 50333056, 65011936,
+29361088, 65012448, 16089330, 4202693472, 4273995776, 29360896, 52429536, 29361088,
+65012512, 2163507443, 4219470112, 65408, 67110592, 18874464, 54526976, 18874464,
+16842999, 4227858720, 4290772992, 67110592, 14680160, 67110592, 18874592, 2164261112,
+4240441632, 65472, 88082112, 14680160, 67110208, 14680160, 16646393, 4257218848,
+65472, 104859328, 14680160, 88081984, 14680160, 16515322, 4257218784, 4194304,
+104859328, 14680224, 104859328, 10485856, 2163736827, 4261413088, 64, 104859264,
+14680224, 109053632, 14680224, 2163704054, 4240441568, 4194304, 88081984, 14680224,
+88081984, 10485856, 2163933437, 4244635872, 64, 88081792, 14680224, 92276288,
+14680224, 2163900665, 4223664352, 4194304, 67110208, 14680224, 67110208, 10485856,
+2164195583, 4223664416, 65472, 71304512, 14680224, 67109952, 14680224, 2164130048,
+4227858656, 64, 71304320, 14680224, 75498816, 14680224, 2164097276, 4211081376,
+64, 54526848, 10485856, 58721280, 18874464, 16941313, 4219470112, 4290772992,
+58721280, 14680160, 62915584, 18874592, 2164490498, 25230944, 4286578688, 150997504,
+4263573856, 113248768, 111214176, 17367300, 25230752, 4282384384, 150997504, 4250990944,
+150997504, 4263574880, 17301765, 25229920, 4282384384, 150997504, 4196464992, 150997504,
+4250991136, 17236230, 8452576, 8388608, 150997504, 4196465056, 159386112, 4188076384,
+2164621572, 12647008, 832, 150997312, 4250991136, 155191808, 4250991136, 2164752646,
+16842336, 65472, 159386112, 4263574880, 150997376, 4259380576, 2164883720, 25166304,
+4286578688, 113248768, 27328096, 150997504, 111149536, 18350346, 4290838432, 65344,
+138414592, 27328096, 113248320, 10551136, 18284811, 20971872, 4273995776, 138414592,
+18939488, 138414592, 27263264, 18219276, 21036960, 64, 138414528, 18939488,
+163580416, 18939488, 18088205, 4290838240, 20971520, 138414528, 18939552, 159386048,
+4271963744, 2165375246, 352, 64960, 142608832, 18939552, 138414208, 18939552,
+2165309711, 65312, 20971520, 142608832, 18939616, 142608832, 4276158112, 2165244176,
+16777312, 65472, 159386048, 18939616, 142608768, 18939616, 17924362, 12582944,
+4194304, 142608768, 18939872, 142608768, 4292935392, 2165178642, 12582944, 64,
+142608704, 18939872, 155191680, 18939872, 18055435, 12583008, 4194304, 155191680,
+18874400, 155191680, 2162656, 2165145868, 25231264, 4290772992, 163580416, 4284546656,
+163580416, 18939808, 18186514, 20971744, 4194304, 163580416, 18874528, 163580416,
+6356896, 2165604627, 16777632, 4273995776, 138414592, 23068960, 159386112, 27263328,
+2165735701, 4273995872, 65472, 121636928, 10551136, 113248064, 2162656, 2165866775,
+12583648, 12582912, 150997504, 111149728, 150997504, 44040672, 18612505, 25167392,
+4282384384, 150997504, 98566816, 150997504, 111150560, 18546970, 12583648, 832,
+150997312, 98566816, 155191808, 98566816, 2165997849, 16778912, 4286578688, 150997504,
+106956256, 159386112, 111150688, 2166128923, 16777824, 65472, 159386112, 44040672,
+150997376, 44040736, 2166259997, 25230816, 65472, 167777024, 94435552, 4261415424,
+111212896, 9502720};
+extern const uint32_t mercury_WADSegLights[462] = {
+2341173079, 2021161080, 1568626551, 2136816186, 3230349882, 2018989944, 3233839191, 2021152632,
+2344581240, 3213588343, 3213593536, 3230365816, 2344638328, 2021161047, 2021166016, 2344581240,
+2021179531, 3233839224, 3233839224, 3233839224, 2021179584, 2978726080, 1465355185, 1465365695,
+2978725812, 2002212727, 1280079992, 2139065265, 976912255, 2021145146, 2021179531, 2021161080,
+1467531403, 2344665280, 2344646743, 2021161080, 2021179531, 2018998392, 1467452352, 2021161080,
+3230365816, 2344646776, 3233792139, 2002212727, 2021166015, 3213588600, 3233844159, 3233839224,
+2021161080, 2002221176, 3233857471, 3233839224, 3233830776, 3233839224, 2139060344, 976912255,
+2978691642, 2343655255, 976894522, 2139062143, 2344646487, 2021161080, 1467531403, 2021161080,
+2021166016, 2021179531, 2139065280, 976912255, 2344565306, 2021160791, 2139062143, 976894522,
+3213580151, 1465355185, 2344595851, 3213580119, 2344646776, 3233857728, 3233839224, 2021161080,
+3233839224, 2021161080, 3233857728, 3233839224, 3233839224, 2021161080, 3217014976, 3230365527,
+2021152632, 1467465867, 2021161080, 2344646743, 976912255, 976912255, 3230384320, 3233839224,
+3233857728, 3233839224, 2021161080, 2344646776, 3233857728, 3233839224, 3233839224, 2021179531,
+2021161080, 2021179584, 3233857728, 2021179584, 2002221176, 3217001408, 2021161080, 3230365816,
+2344646776, 2139062143, 976894522, 2021179584, 3233857728, 2021179584, 2021179584, 2021179584,
+2021161080, 3233857728, 3233839224, 3233839224, 2021161080, 2021179584, 2021179584, 3233839224,
+3216988023, 2021161080, 3233857728, 2021161080, 2002221176, 2004388799, 3233773688, 2021179328,
+2021161080, 3233773432, 978286712, 1329210404, 3216974884, 3217080512, 3233839223, 3233839224,
+3233839224, 3233839224, 2021179584, 2021161080, 3233839224, 3233857728, 3233839224, 2021161080,
+3233857728, 3233857728, 3233839224, 2021161080, 3233857728, 3233839224, 2021161080, 3233857728,
+2021179584, 2021179584, 3233857728, 2021161080, 2021161080, 3233844160, 2021161080, 3233857728,
+2021179584, 2021179584, 2021161080, 3213588600, 2021179584, 2021179584, 2021179584, 2021161080,
+2021179584, 2021179584, 2021179584, 3233857728, 3233839224, 3233839224, 3230357368, 2021166016,
+1956661320, 1682481312, 3233857727, 2021179584, 2021179584, 2021161080, 2004336523, 2021179584,
+1467531456, 2019003328, 3233857471, 3233839224, 3233839224, 2344580983, 2021161047, 3233839224,
+1684300900, 3233838196, 3233839224, 2021161080, 3233839224, 3216988023, 2021179584, 2344581240,
+3213588311, 3213580152, 2021166015, 3233857728, 3233857728, 2021179584, 2021179584, 2021161080,
+3233839224, 3233839224, 2021161080, 2344581240, 3213588343, 2021161080, 2021161080, 2021179584,
+3233857728, 3233839224, 2021161080, 3233857728, 2021161080, 3233857728, 3233839224, 3233839224,
+2021161080, 3233839224, 2021179584, 2661185656, 2661195422, 2021170846, 2661195422, 2021170846,
+3233848990, 2661185656, 2661195422, 2021179584, 2021170846, 2021161080, 2661195422, 2021170846,
+2021161080, 2021170846, 2021179584, 2021179584, 2021179584, 2021179584, 3233839224, 2021161080,
+3233839224, 2661185656, 2661204160, 2661185656, 3233839224, 2021170846, 3233857728, 3233839224,
+3233839224, 3233839224, 2021161080, 2021161080, 3233839224, 2021179584, 2021179584, 2021179584,
+3233839224, 3233839224, 2021161080, 3233839224, 2021179584, 2021179584, 2021161080, 2021161080,
+2021179584, 2408562861, 2021158008, 3233839224, 3233839224, 2021161080, 3233857728, 3233839224,
+2021161080, 3233839224, 2661185656, 2021179584, 2021170846, 2021179584, 3233839224, 2661185656,
+3233839224, 3233848990, 2021161080, 2021179584, 2408544364, 2021174720, 3233839224, 2021161080,
+3233857728, 3233839224, 2021161080, 3233839224, 3233839224, 2021161080, 2021179584, 3233839224,
+2021179584, 2021161080, 2021179584, 3233857728, 2661185656, 2661204160, 3233857728, 2915078031,
+1819057807, 2344656542, 2021170846, 2661204160, 2021179584, 3233857728, 3233848990, 2021179584,
+2021161080, 2021165963, 2341173368, 2021161080, 2021161080, 2021179584, 3217014976, 2004336832,
+2344581207, 2021179584, 2021179584, 2021161080, 3233857471, 3233839224, 3233839224, 2021161080,
+2021160823, 3216996472, 1467465867, 3233844107, 3233857728, 2021161080, 2344581240, 2021179275,
+2021160823, 3213588600, 3213593535, 2004318328, 3233839224, 3233839224, 3233773688, 2021161080,
+3233773688, 2021161080, 2002221176, 1467452352, 976912255, 2139044410, 3213593535, 2004318328,
+2021161080, 3230365527, 2344572791, 3213588600, 2344580983, 2021161080, 3233839224, 2021179584,
+2661204160, 2661204160, 3233857728, 2661204160, 3233857728, 3233839224, 2021161080, 1819057822,
+3230371742, 2021170846, 3233857728, 3232603806, 3233845135, 2021179584, 2021179584, 2004318328,
+2344646776, 3233857728, 3233839224, 2021161080, 3233839224, 3233857728, 3233839224, 2021161080,
+2004318328, 3230365816, 2021179584, 2341164919, 3217014719, 2002239423, 2021179584, 2021179275,
+2344581240, 3230365816, 3230357368, 1467447416, 2002226059, 2021160823, 2344646776, 2021179531,
+2021161080, 2021161080, 2341164920, 3217061719, 2019003328, 2021179584, 3233839224, 2021179584,
+2021161080, 3233839224, 2021161080, 3233857728, 2021179584, 2021179584, 3233839224, 3233857728,
+3213606848, 2021152632, 1467447159, 2344599435, 2002221143, 1467465611, 2021161080, 2344580951,
+2158974839, 2944421968, 2002210639, 2021166016, 2002239679, 1467452299, 1467531403, 2018998392,
+2139065280, 2139044410, 2004302394, 2021161080, 2021161080, 2021166016, 2021179531, 2019003328,
+2021166016, 2341173079, 3230357367, 2341173335, 3233830775, 1467531403};
+extern const uint32_t mercury_WADSegVertices[924] = {
+65536, 2, 196609, 327684, 131077, 393220, 458758, 327687,
+262149, 589832, 524291, 655369, 786443, 720905, 589837, 983054,
+1114128, 1048590, 917519, 983057, 1179660, 917520, 1048594, 786450,
+720908, 1245195, 1179667, 262164, 1310730, 1441813, 1310737, 1114127,
+1507348, 1638424, 851994, 1638421, 1376278, 1441816, 1572889, 1572886,
+1376281, 1703946, 655383, 1835035, 1966109, 1769502, 2097183, 2162720,
+2228257, 2162723, 2293796, 2490405, 2359334, 2097185, 2424864, 2359297,
+196646, 2490404, 65539, 2621479, 2752553, 2883627, 2949164, 2687021,
+2555950, 3014703, 3145770, 3276849, 3407923, 3342376, 2818098, 3538997,
+3670071, 3735606, 3801145, 3866680, 3473467, 3604538, 3997756, 3932212,
+3211326, 4063293, 3473469, 3997758, 3866677, 4194367, 4259904, 4390978,
+4325441, 4128835, 3276863, 4456498, 4128832, 4587589, 4522055, 4653128,
+4718662, 4194377, 4587592, 4784193, 4522054, 4259914, 4653125, 4849720,
+3670091, 3211332, 4063281, 4718663, 4915259, 3932236, 5046324, 3407932,
+4980813, 5177422, 5111888, 5242961, 5439570, 3539001, 3735635, 5374006,
+5570644, 5505110, 5767255, 5701717, 5832792, 5636185, 3080282, 5898331,
+5963868, 6029360, 6029403, 5963864, 5767257, 6094938, 3080286, 5898287,
+6160477, 6291551, 6357088, 6422625, 5701729, 6422613, 5570647, 6357090,
+6488162, 6553699, 6684773, 6750310, 6815847, 6946921, 7012458, 7077995,
+7143465, 2687018, 7274606, 7209071, 7274608, 7340145, 7405678, 7471213,
+7209073, 2752560, 7340143, 3145820, 7405680, 7602291, 7667827, 7733365,
+7602294, 7536756, 7733364, 5832823, 5636216, 7667830, 7798870, 7864441,
+7929970, 7536757, 8061050, 7995516, 8126589, 8192126, 8323195, 8257663,
+8126531, 4390975, 4128893, 8192124, 8454272, 8323198, 8257666, 8650883,
+8781957, 8388737, 8454275, 8585348, 8650880, 8585345, 8519815, 8847494,
+8978568, 9109642, 9175178, 9240716, 9109645, 9044107, 8913038, 9306255,
+9240715, 9502864, 9568401, 9633938, 9437331, 9175181, 9633936, 9371796,
+9568403, 9699477, 9765014, 9502866, 8847511, 9896088, 9961614, 8716423,
+8978565, 9306249, 9895980, 2949272, 2883629, 9961623, 10092697, 9044108,
+10223771, 10354845, 10485919, 10485915, 10420384, 10223775, 10158236, 10158240,
+10420380, 10289313, 10551458, 10748067, 10616990, 10289310, 10354850, 10616993,
+10551453, 10879141, 10813607, 10944680, 11010214, 11141289, 11010215, 11206779,
+8061098, 10944677, 8388740, 11075711, 11337900, 10879144, 11468974, 11534511,
+11403441, 11600050, 11665579, 10813606, 11337881, 10027187, 11796653, 11927733,
+11993270, 12058807, 12124332, 11272378, 12320955, 12386486, 12452029, 11993278,
+11927735, 12189876, 11862204, 11731098, 10092729, 12255416, 11272346, 12583103,
+12648639, 12517568, 12583106, 12714177, 12648642, 12714176, 10027181, 8716425,
+12517569, 12845251, 12976325, 12910790, 12976327, 13041864, 13107397, 13041862,
+13107399, 13238473, 13369547, 13172938, 13238475, 13304012, 13369545, 13304010,
+13500621, 13435086, 13500623, 13566160, 13631693, 13566158, 13631695, 13762769,
+13697234, 13762771, 13828308, 13893841, 13893843, 14024917, 13828306, 12910792,
+13172940, 14155991, 14090457, 14352602, 14418136, 14287069, 14483678, 14680287,
+14287067, 14352606, 14549213, 14483674, 14549211, 14745820, 14614754, 14876897,
+14614752, 14680292, 14942434, 14811359, 14811364, 14942432, 13435088, 13697236,
+15073509, 15139011, 12779716, 12845288, 15204583, 12779751, 15139048, 15335657,
+15204548, 15466731, 14221549, 15597805, 15532249, 14221527, 15663342, 14090479,
+11600046, 15728817, 11403505, 15859952, 15991027, 16122101, 15270122, 15991017,
+15925492, 15335667, 15270132, 16122103, 16056566, 16253173, 16253104, 16056568,
+11534584, 11468976, 16318639, 16187641, 16449786, 16580860, 16449771, 15401196,
+15466746, 16384251, 16384236, 16646397, 15532286, 15925482, 15401211, 16515318,
+15794414, 15663346, 15597807, 16777471, 16711937, 16843010, 16908544, 17039619,
+16777474, 17170693, 17105156, 16908545, 9830662, 9437329, 16843007, 17236227,
+16974085, 17105160, 17301767, 16974087, 17432841, 17236234, 17563915, 17694989,
+17826063, 16711936, 13959382, 14024971, 17498380, 17563861, 17498326, 10682640,
+17760420, 10682532, 10748175, 17760528, 17825955, 17367267, 15008014, 14745827,
+14876937, 17367306, 17432801, 13959436, 17629414, 15073549, 17629454, 17694949,
+15007974, 17957137, 18022674, 18088211, 17891604, 18088213, 18153750, 18022676,
+18219283, 18350359, 18284825, 18481432, 18415898, 18350362, 18546968, 18612507,
+18481436, 18153757, 18743577, 18415895, 18219285, 18284822, 18874655, 18809121,
+18940194, 19136803, 19071264, 19005732, 18874659, 18940191, 19071268, 19136805,
+19202342, 19267879, 19202344, 19267877, 19005729, 19530025, 19595562, 19464482,
+19464490, 19661097, 18809120, 18219287, 18284843, 19333398, 18219303, 17957139,
+18022678, 18284824, 19595543, 18350363, 19792173, 19857710, 19923247, 19726640,
+19857712, 17957167, 17891602, 19923217, 19398961, 19333414, 19792175, 19857682,
+19988786, 19726638, 20119853, 20054324, 20185395, 20185394, 20054325, 20382006,
+20447543, 20513078, 20316471, 20382010, 20709691, 20119860, 20513075, 20316473,
+20250936, 20840765, 20775231, 20906304, 20971838, 20906301, 20840768, 18481433,
+18612506, 21037342, 18678082, 21102913, 18743617, 18415902, 20775230, 21037378,
+21233987, 21365061, 21299527, 21430600, 21496134, 21365064, 21627209, 21102923,
+21299526, 21561668, 21692701, 18678037, 18153748, 21430597, 18088209, 19726643,
+21496135, 20119865, 20644172, 21758285, 21823818, 19923245, 17891632, 18546972,
+21889307, 21954894, 18612559, 21954896, 22020433, 21889359, 22085966, 19530027,
+22151468, 18547022, 21889361, 22085968, 22020435, 22348116, 22217045, 22282578,
+22282581, 22413652, 22348115, 22479190, 22217048, 22544729, 22675799, 22610266,
+22741338, 22610264, 22675801, 22872412, 22020431, 22217040, 20971839, 22544723,
+21168478, 22937951, 23003485, 21954844, 23134560, 23069026, 23200099, 23069025,
+23200096, 23396708, 23265634, 19661155, 19136802, 19005737, 19464492, 23265580,
+19661138, 23527782, 23593319, 23462249, 23658858, 23789928, 23724388, 23331173,
+23724393, 23331178, 19202340, 19398949, 23462184, 23658854, 23855467, 23789932,
+23527787, 23920999, 23921006, 23527789, 23986541, 24117615, 24052081, 24183100,
+24314226, 24248687, 24445300, 24052080, 24117622, 20578679, 24510778, 24510832,
+20578678, 20054312, 23462247, 19399014, 24379765, 24445234, 20054389, 20382002,
+24576311, 24707448, 24838522, 24772988, 24904057, 24641917, 25035131, 25100670,
+24969599, 25231744, 25166210, 25297283, 25362817, 25297280, 25493892, 25166209,
+25624966, 25559429, 25756040, 25690506, 25821579, 25887113, 25362818, 25756043,
+25690505, 25428364, 26083725, 26018191, 26149264, 26214798, 26018190, 25821576,
+26214799, 26345873, 26280339, 26149261, 25952627, 24314258, 24772987, 25231747,
+26083728, 25887114, 24838535, 26476922, 26411412, 26345844, 26542481, 26280338,
+24379797, 26542452, 26345843, 24379794, 26280341, 26608019, 26411409, 26542486,
+26608021, 23134615, 26739045, 26870169, 26935704, 26739100, 27001242, 26804588,
+23396763, 26804634, 23855513, 27066734, 26870173, 24641913, 24707482, 26870172,
+24904093, 27066778, 24707452, 26870137, 26411414, 27132308, 26476947, 26608030,
+23986591, 27132310, 27263389, 27066748, 24904058, 24773025, 24773012, 27328890,
+27132321, 26476958, 27197856, 27328926, 27394455, 26673505, 23265698, 26673570,
+27394467, 27460004, 27591064, 27525539, 27656612, 27525542, 27394403, 27787687,
+22282664, 27460002, 22151508, 27787604, 22675881, 22282586, 27722152, 27984298,
+27918764, 28115371, 28180909, 27853147, 22741422, 28180827, 28115374, 22806959,
+28246443, 27984301, 28377520, 28311986, 28443059, 28508593, 28639668, 28377523,
+28574077, 24969654, 28311985, 28836279, 28770745, 28901818, 28967352, 28443056,
+28836282, 28705211, 28770744, 29163964, 29098430, 29229503, 29295037, 29163967,
+28901815, 29229500, 29426112, 29032824, 29098429, 24641985, 29491637, 28049858,
+29295038, 28508594, 28967353, 29360556, 27001253, 27656604, 27722176, 29360504,
+27001254, 29360551, 28049856, 29622723, 29753797, 29819334, 29557192, 29950407,
+30015945, 29884874, 30081476, 29688268, 29622731, 29557188, 30081107, 2031644,
+1900995, 5439567, 5308450, 5374035, 30212178, 30278093, 30343630, 5439952,
+30474703, 30147025, 30409163, 30605778, 30736852, 30802389, 30933463, 30540248,
+30998995, 30671321, 31130074, 31261148, 31326685, 31457759, 31195606, 31064544,
+31130079, 31392224, 31457754, 31064539, 31523294, 30867937, 31392219, 31654370,
+31523288, 31588836, 31719909, 31916518, 31261153, 31982051, 32047592, 32113129,
+4981226, 30933458, 30540267, 32178253, 5046348, 6094942, 6160876, 32244180,
+30671317, 32309715, 32375277, 30999022, 30605785, 31850991, 32440816, 32571485,
+30736861, 32506354, 32637427, 32702961, 31785460, 32768501, 32834038, 32899575,
+32965095, 32833918, 25035135, 25100790, 32899573, 33096184, 33227258, 6619236,
+6881384, 33292396, 33358328, 33030649, 33096188, 6226429, 33292793, 33161726,
+33423871, 33554940, 33489409, 33620482, 33686016, 33751549, 33358340, 33817093,
+33882630, 33030659, 33948167, 34013691};
+extern const uint32_t mercury_WADSegFrontSectors[231] = {
+943208504, 993737528, 943208507, 1010580540, 976894522, 960248892, 943274297, 1010580536,
+675036220, 1009264680, 1497119804, 1499027801, 926365529, 624375607, 405087525, 404232216,
+404232216, 471341080, 471604252, 404233244, 589502488, 505290275, 589504030, 488447267,
+589505309, 589505315, 589505315, 370546211, 1499027734, 572662306, 858993459, 404239155,
+892672024, 387389237, 1667457815, 875836468, 1667457891, 1667457891, 456471861, 890968859,
+892679477, 842151221, 892678706, 892679477, 538981685, 538976288, 522133279, 606348324,
+555819300, 606348321, 808461348, 606351408, 825307428, 606348337, 606348324, 437918234,
+421075482, 606345497, 1210328100, 608716872, 606348324, 1229539620, 791621449, 606348335,
+606348324, 606348324, 606348324, 707406378, 707406378, 1027423530, 707406397, 606349866,
+690563369, 606348324, 1143219236, 608453700, 1159996452, 608519493, 1111638564, 606348354,
+1128481603, 606348324, 606348324, 606348324, 1044266558, 606348324, 1061109567, 606348324,
+724249380, 606348331, 1277436964, 1280068684, 909522486, 741090340, 774122540, 606350894,
+774778414, 757933092, 606350637, 606348324, 1261844022, 608914251, 606348324, 1076110372,
+608190528, 606348324, 1179001892, 606357062, 1246382628, 1092887626, 608256321, 1195853604,
+1600085831, 16843103, 1616928769, 1633771872, 33686113, 50528770, 50529027, 67372036,
+1414792196, 67372036, 67392853, 1414792196, 1431655764, 1566399837, 1583242846, 1414812756,
+1414812756, 1482184788, 1448498776, 1482184790, 1313754712, 1448498766, 33686102, 1448498774,
+1296911702, 1448498765, 1448498774, 1448498774, 1448498774, 1649825366, 6447714, 1426063360,
+1431655765, 1431655765, 1465341783, 1465341783, 1448498774, 1448498774, 1448498774, 319096069,
+320017171, 1376981779, 101058130, 101058054, 320017171, 117838611, 1364264711, 1448498695,
+1347440720, 1448104016, 1364283734, 1347440977, 151587152, 151587081, 202116105, 286331148,
+235802897, 286330382, 218960145, 286330125, 286331153, 286331153, 286331153, 1515870737,
+1347440986, 1532713819, 101913425, 101058054, 117901062, 1381126663, 134744072, 1549556828,
+1364283729, 1330598225, 1364283215, 319096069, 1376981779, 1381110610, 1397903954, 1397969747,
+1397969747, 1448498771, 185292374, 303172363, 252842514, 302976783, 168956434, 302647818,
+303174162, 303174162, 303174162, 1381110547, 341005138, 336860180, 336860180, 1499027801,
+341399897, 336860180, 353637396, 353703189, 353703189, 353703189, 1701143909, 638915861,
+640034342, 640034342, 640034342, 640034342, 656877350, 640034343, 640034342, 640034342,
+269488166, 1667523600, 1667457891, 1684300643, 1684300900, 1684300900, 1684300900};
+extern const uint32_t mercury_WADSegBackSectors[231] = {
+992346111, 4294967295, 1023409976, 976813881, 1010580735, 1023359545, 4294967100, 989800508,
+1010313272, 675036220, 4281874472, 939524095, 4294967295, 4294924581, 4281874431, 4279893813,
+590741503, 4294967295, 603923199, 385875747, 419373859, 4280492828, 419373055, 589505310,
+505224739, 4280155933, 488118300, 419430172, 4294967078, 4294908948, 889192447, 4279711029,
+4279776565, 419430195, 889192230, 1664352255, 4294967295, 4294967295, 890968319, 4281677109,
+404428827, 892678683, 858928437, 4281545471, 4294914815, 606404383, 553590527, 570368033,
+606348314, 452927780, 606351386, 4279903268, 606348336, 4281413668, 838860593, 620698111,
+4294911012, 808065560, 608717128, 1210328100, 1246316872, 606348361, 606348324, 4281278500,
+539045664, 788475690, 805306166, 4280558628, 606404413, 4294967295, 620700714, 690683684,
+606348324, 438970665, 608447273, 1143219236, 608519492, 1159996452, 606348354, 1128415780,
+606348324, 1145259587, 1045233477, 1061043967, 606348324, 1094713150, 606348324, 1128415039,
+606348359, 741026596, 4283182379, 4281738276, 4294967076, 606350892, 4281082916, 774775844,
+4294911012, 606404397, 4281148452, 4281150719, 609026047, 1076110372, 1262550859, 608907775,
+1090518820, 1195835201, 606358346, 1246110756, 606348362, 608649508, 1191126052, 606348359,
+22306340, 1593988694, 1627542868, 1649762390, 1616270934, 67372033, 319030276, 318964483,
+68375636, 324359427, 33755908, 1594119253, 1627676673, 1449022548, 1449088093, 1583154257,
+1482054993, 1448105048, 1347967056, 1448498431, 1448498768, 1615744598, 1448498785, 38666754,
+1448498943, 50285910, 33750861, 1415531777, 4294924365, 1633574399, 1448476757, 72704597,
+25170, 1381455702, 1398100821, 1448302166, 4283914067, 1464751360, 1660944383, 85136147,
+1376060933, 324338691, 319246677, 320014099, 1409549830, 101123665, 117920006, 4294922321,
+1448214527, 1347835478, 319181904, 1481723984, 1360089686, 285151752, 286331391, 218041361,
+286392319, 235671825, 286392078, 235737361, 224090637, 201937151, 1342115341, 291197020,
+1511086673, 1360092250, 117835099, 122819347, 1359349267, 101189896, 1376323409, 1360088923,
+134700039, 1360088841, 1325882449, 89264915, 319181394, 1392857619, 1381307219, 4283586390,
+1448498943, 4283650902, 303191039, 201265682, 302713343, 185733650, 302975247, 168956434,
+156371471, 4294922762, 1393494794, 307450374, 1494372883, 4294967295, 4284088319, 4279505940,
+587202559, 1509949439, 4284088319, 640034342, 644218663, 1697015078, 353703189, 4284818982,
+4294967061, 4294967061, 4294907391, 4294907670, 4294967061, 4294967061, 4294967061, 4279304191,
+4278845439, 4294927142, 1684340735, 4284743524, 4294967295, 4294927359, 4294927359};
+extern const uint32_t mercury_WADSegFlags[231] = {
+34210049, 16843009, 33620234, 168427786, 33686017, 33622538, 16843010, 167840258,
+34212362, 167903746, 17435146, 67174657, 16843009, 16845834, 16908801, 16908546,
+33685761, 16843009, 33620481, 167837954, 167838210, 16908810, 167838209, 33686026,
+168430082, 17432842, 168430090, 33620234, 16843010, 16845314, 33620225, 17433090,
+17433090, 33620234, 167837954, 34210049, 16843009, 16843009, 34212353, 16908802,
+168430090, 33688074, 168428034, 17435137, 16845313, 33685770, 33622529, 167840266,
+33686026, 167840258, 33688074, 17433090, 33686026, 17435138, 167837962, 33622529,
+16843266, 168428042, 34210314, 167903746, 33686026, 168430082, 33686026, 17435138,
+168430090, 167840266, 167837962, 16908802, 33685762, 16843009, 33620490, 168427778,
+33686018, 168430090, 167905802, 34212362, 167903746, 34212362, 168430082, 33686026,
+168430090, 33686018, 655618, 1, 134744072, 33554688, 134744072, 33685504,
+33686018, 168430082, 17435146, 16777730, 16843010, 33688074, 17433090, 168428034,
+16843266, 33685770, 17433090, 17435137, 168296705, 34212362, 33685762, 167905793,
+33620234, 33685762, 168428034, 33688074, 168430082, 167903754, 33622538, 168430082,
+33688074, 167903746, 33686018, 33688066, 167903746, 33686026, 33686018, 34212362,
+168296962, 33686026, 168429578, 168428034, 168430090, 33686018, 33686026, 168430082,
+33688066, 34081282, 168430088, 33688065, 33686024, 168430082, 33686026, 168430090,
+33686017, 167840258, 168427786, 168430090, 16845322, 168430081, 33686018, 167905794,
+168430082, 33686018, 134875146, 34079234, 17435146, 168430090, 167837953, 167903746,
+34212362, 167774730, 33686026, 33686018, 657930, 167905794, 168428042, 16845314,
+33685761, 167903746, 168430090, 133642, 33686018, 33620490, 33686017, 167840258,
+33685761, 168428034, 33685770, 168428034, 167903754, 168428033, 33622538, 167903746,
+168430082, 34210314, 34212362, 33686018, 34212354, 168430082, 33688066, 34210314,
+168430090, 34212362, 168430082, 167903746, 168428034, 34210314, 168430082, 17432578,
+33686017, 17435138, 33688065, 167838210, 34212353, 167903746, 34212362, 167903746,
+167905802, 16843274, 34212362, 167903754, 34212362, 16843009, 16908545, 17435146,
+167837953, 33620225, 16908545, 33686018, 33685762, 33686018, 168430090, 16908802,
+16843018, 16843018, 16845313, 16845322, 16843018, 16843018, 16843018, 17432833,
+17432833, 16844802, 257, 17301760, 16843009, 16844801, 16844801};
+extern const uint32_t mercury_WADBlockMap[2258] = {
+4289527753, 2818076, 79234232, 79496378, 79889601, 80151749, 80413897, 80676045,
+80938193, 81200341, 81462489, 81724637, 81986785, 82248933, 82576617, 82904304,
+83035378, 83231988, 83428600, 83559674, 83690748, 83821822, 83952896, 84346116,
+84608266, 84739340, 84870414, 85001488, 85132562, 85329173, 85460247, 85656857,
+85853469, 85984543, 86115617, 86246691, 86574373, 87098670, 87688503, 87819579,
+87950653, 88081727, 88212801, 88409412, 88540486, 88737096, 88933708, 89064782,
+89195856, 89326930, 89720148, 90178910, 90834278, 90965355, 91096429, 91227503,
+91358577, 91555188, 91686262, 91882872, 92079484, 92210558, 92341632, 92800388,
+93980046, 94504351, 95618475, 96077239, 96339389, 96470463, 96601537, 96798148,
+96929222, 97125832, 97322444, 97453518, 97584592, 98043348, 99747295, 100795900,
+102762003, 103220772, 103482922, 103613996, 103745070, 103941681, 104072755, 104269365,
+104465977, 104597051, 104728125, 105121345, 105711175, 106301010, 107021917, 107415140,
+107677290, 107808364, 107939438, 108136049, 108267123, 108463733, 108660345, 108791419,
+109315711, 109905545, 110823059, 112002723, 113182390, 113837765, 114362062, 114493138,
+114624212, 114820823, 114951897, 115148507, 115345119, 115476193, 115738340, 115869415,
+116393706, 117180149, 117901058, 118097673, 118294283, 118425358, 118556432, 118753043,
+118884117, 119080727, 119277339, 119408413, 119801633, 119932709, 120325928, 121177905,
+122160962, 122357578, 122619724, 122750800, 122881874, 123078485, 123209559, 123406169,
+123602781, 123799391, 124192612, 124323688, 124979052, 126486398, 127338386, 127600538,
+127862684, 128059297, 128190371, 128386982, 128518056, 128780202, 129042352, 129304498,
+129501111, 129632185, 131008447, 133040096, 134219769, 134350849, 134481923, 134875143,
+135071755, 135333904, 135464978, 135596052, 135858199, 136054810, 136185885, 136382495,
+137562149, 139003969, 140249171, 140445790, 140576864, 140839011, 141101159, 141297771,
+141428845, 141559919, 141756529, 142018677, 142149752, 142411899, 142936192, 143329417,
+143919248, 144181398, 144312473, 144640156, 144902305, 145033380, 145164454, 145295528,
+145426602, 145819821, 146147507, 146475193, 146999485, 147458248, 148179152, 148375766,
+148703451, 149227745, 149424359, 149555433, 149686507, 149817581, 149948655, 150276337,
+150604023, 150866173, 151324928, 151718153, 152307984, 152439061, 152766745, 153291039,
+153422116, 153553190, 153684264, 153815338, 153946412, 154077486, 154208560, 154339634,
+154863925, 155322688, 156043592, 156174670, 156305744, 156436818, 156567892, 156698966,
+156830040, 156961114, 157092188, 157223262, 157354336, 157485410, 158075238, 159123828,
+159910275, 160041353, 160172427, 160303501, 160434575, 160565649, 160696723, 160827797,
+160958871, 161089945, 161221019, 161352093, 161614239, 162335143, 162597296, 162728370,
+162859444, 162990518, 163121592, 163252666, 163383740, 163514814, 163645888, 163776962,
+163908036, 164039110, 164235720, 164432332, 164628943, 164760017, 164891091, 165022165,
+165153239, 165284313, 165415387, 165546461, 165677535, 165808609, 165939683, 166070757,
+166726123, 167119348, 167709178, 167971330, 168102404, 168233478, 168364552, 168495626,
+168626700, 168954384, 169216532, 169478680, 169740828, 170134049, 170592808, 170854957,
+171248177, 171575863, 171838012, 172100160, 172362308, 172689992, 173083214, 173673046,
+174066269, 174459491, 174918249, 175770227, 176228991, 176818821, 177146507, 177867413,
+178326174, 178719396, 179112618, 179767985, 180357820, 181013189, 181471949, 181930708,
+182520539, 183634666, 184879867, 186059535, 187370273, 188222259, 188746557, 189205316,
+189664075, 190384979, 191040350, 191761255, 192678771, 194382729, 195496860, 196807603,
+198052804, 198839253, 200215524, 201001975, 202312708, 203295770, 203951140, 204606510,
+204999733, 205261882, 205524030, 206244934, 206834766, 207621212, 208407654, 208800879,
+209652855, 210046083, 210701449, 211094676, 211225750, 211356824, 211684506, 211946656,
+212602022, 212929711, 213454005, 213847228, 214240450, 214502599, 215026893, 215289044,
+215616728, 215944414, 216075488, 216206562, 216534244, 216796395, 217451760, 217713912,
+218500350, 219090188, 219483410, 219876632, 220728608, 221187374, 221777202, 222301503,
+222432577, 222563651, 222891333, 223481166, 223677779, 223939927, 225119582, 225774963,
+226168183, 226823551, 227544457, 227937684, 228396440, 228789666, 228920740, 229051814,
+229313960, 230231474, 230624699, 231476679, 232590801, 233508326, 234163694, 235277821,
+236064269, 236457493, 236916251, 237309476, 237440550, 237571624, 237702698, 237833772,
+237964846, 238423603, 239078969, 239734342, 240127564, 240914006, 241307232, 241569380,
+241897064, 242159214, 242290288, 242421362, 242552436, 242683510, 242814584, 242945658,
+243469951, 244125318, 244584081, 244911767, 245370524, 245763749, 246419114, 246615730,
+246746804, 246877878, 247008952, 247140026, 247271100, 247402174, 247926467, 248516298,
+248909523, 249695964, 250089189, 250416876, 250941168, 251137783, 251268857, 251399931,
+251531005, 251662079, 251793153, 251924227, 252186374, 252317449, 252579595, 253890327,
+254283559, 254414633, 254611243, 254807855, 254938929, 255070003, 255201077, 255332151,
+255463225, 255594299, 255856446, 255987521, 256184131, 257036107, 257363798, 258150235,
+258609000, 258805612, 258936686, 259067760, 259198834, 259329908, 259460982, 259592056,
+260116347, 260444037, 260706183, 261623697, 262016925, 263065508, 263917493, 264114109,
+264245183, 264376257, 264507331, 264638405, 264769479, 264900553, 265621453, 266276827,
+266670050, 266997736, 267259885, 267718641, 268242936, 268439551, 268570625, 268701699,
+268832773, 268963847, 269094921, 269225995, 269422605, 269750289, 270536728, 271388712,
+271716398, 272568378, 272764992, 272961604, 273092678, 273223752, 273354826, 273485900,
+273616974, 273748048, 273944658, 274272342, 274993243, 275910766, 276828278, 277942410,
+278401174, 278597786, 278728860, 278859934, 278991008, 279122082, 279253156, 279384230,
+279580840, 279777452, 280170670, 280826042, 281415872, 282071242, 282726616, 282923228,
+283054302, 283185376, 283316450, 283447524, 283578598, 283709672, 283906282, 284233967,
+284496115, 285085945, 285937926, 286200076, 286593299, 286789911, 286920985, 287052059,
+287183133, 287314207, 287445281, 287576355, 287838501, 288100650, 288362798, 289018164,
+289804609, 290263368, 291377495, 291770723, 291901797, 292032871, 292163945, 292295019,
+292426093, 292557167, 292819313, 293081462, 293343610, 293867904, 294130054, 294523274,
+295375254, 295637406, 295768480, 295899554, 4294967295, 28967353, 28966911, 29032890,
+29097983, 29097983, 29097983, 29097983, 29097983, 29097983, 29097983, 29097983,
+29097983, 29097983, 29097983, 29097983, 29097983, 29097983, 29097983, 29097983,
+29097983, 29097983, 29097983, 29097983, 29097983, 4294902204, 29098427, 4294902205,
+4294967295, 4294967295, 4294902201, 4294902201, 4294967295, 4294967295, 4294967295, 4294967295,
+131071, 4294901773, 851968, 65535, 4294901773, 4294967295, 4294967295, 4294967295,
+4294967295, 29229055, 4294967295, 4294967295, 28966911, 28966911, 4294967295, 4294967295,
+4294967295, 4294967295, 26542079, 26673558, 131071, 26476557, 4294902167, 851968,
+65535, 26738701, 26870169, 26869759, 4294902170, 4294967295, 4294967295, 4294967295,
+4294967295, 4294902205, 4294967295, 4294967295, 4294902201, 4294902201, 4294967295, 4294967295,
+4294967295, 4294967295, 26542484, 26673558, 131071, 26542484, 4294902167, 4294901760,
+26738688, 26870169, 4294902171, 26870169, 4294902171, 4294967295, 4294967295, 4294967295,
+4294967295, 4294902205, 4294967295, 4294967295, 4294902201, 4294902201, 4294967295, 4294967295,
+27590655, 4294902181, 27459677, 4294902180, 6094884, 27525539, 4294902222, 524295,
+2359308, 30212189, 30409166, 30605777, 4294902228, 458753, 786440, 65535,
+4294901769, 589824, 30801930, 30998999, 31261146, 196607, 1835013, 31064537,
+31261148, 1900543, 28246121, 28311551, 4294902192, 28311983, 4294967295, 4294967295,
+4294967295, 4294902205, 4294967295, 4294967295, 4294902201, 4294902201, 4294967295, 4294967295,
+27590655, 4294902181, 27459677, 4294902180, 3080228, 27459677, 30278052, 524287,
+786440, 2359325, 3014701, 6094895, 30278093, 30409167, 30540241, 30671315,
+4294902229, 458753, 786440, 1245198, 3014685, 4294902229, 589824, 983054,
+4294901789, 196608, 655369, 983054, 1966109, 30801955, 30933463, 31064537,
+31261147, 196607, 1835013, 2293790, 30999000, 31130074, 31261148, 4294902238,
+6881308, 4294902191, 28311983, 28311551, 4294902192, 4294967295, 4294967295, 29229055,
+4294967295, 4294967295, 28966911, 28966911, 4294967295, 4294967295, 4294967295, 27656613,
+27459583, 4294902179, 27460002, 1245183, 2883603, 3014701, 983039, 1245202,
+4294901804, 983054, 4294901776, 983054, 1966096, 2293794, 2031615, 2293794,
+6094847, 4294901865, 28377520, 28377087, 4294902193, 4294967295, 4294967295, 29229055,
+4294967295, 4294967295, 28966911, 28966911, 4294967295, 4294967295, 28639668, 27721727,
+28574131, 4294902197, 27656613, 28574131, 27459583, 28508579, 2097151, 27394465,
+28508579, 2097151, 2424865, 6357036, 6488162, 1245183, 2162720, 2883627,
+6488162, 1114111, 1441810, 2097175, 2818082, 27721824, 1114111, 1572887,
+2228249, 27721824, 4294902184, 1572887, 1769497, 27721820, 27918760, 1835007,
+6881372, 27918760, 27983871, 28377520, 20054015, 28311978, 4294902193, 20382001,
+4294967295, 4294967295, 29229055, 4294967295, 4294967295, 28966911, 28966911, 4294967295,
+4294967295, 4294902197, 4294902197, 4294967295, 4294902177, 6357029, 6488162, 4294901860,
+6488162, 6619236, 1376255, 1441813, 6553623, 4294901861, 1376276, 1572887,
+4294901785, 1572887, 1769497, 1835007, 4294967295, 20447231, 4294967295, 4294967295,
+29229055, 4294967295, 4294967295, 28966911, 28966911, 4294967295, 4294967295, 28639666,
+28508159, 4294902197, 4294967295, 4294902177, 2687013, 4294901810, 2687016, 6684773,
+327679, 1376276, 6619158, 6750310, 327679, 1376276, 3473433, 6684729,
+4294901863, 1638404, 3473435, 4294901817, 4294901787, 4294967295, 29360439, 4294967295,
+4294967295, 29229055, 4294967295, 4294967295, 28966911, 28966911, 4294967295, 28508159,
+28508159, 4294902197, 28639666, 4294967295, 27328511, 4294902177, 2687013, 3211312,
+27263026, 2621439, 2687016, 3211312, 3342386, 6619190, 4294901862, 2555942,
+3342384, 6619190, 6750310, 28049835, 4294902189, 3735605, 6750310, 28115372,
+4294902190, 1769498, 3735605, 1769471, 4294901787, 4294967295, 29360439, 29425663,
+4294967295, 4294967295, 4294902205, 4294967295, 4294967295, 28901816, 28901375, 4294902201,
+4294967295, 28443049, 28508159, 4294967295, 4294967295, 6160474, 27263390, 3211263,
+5898289, 6226014, 27263390, 29688260, 29819334, 29950408, 30147019, 3211263,
+3342385, 3538996, 3670071, 27000923, 29819293, 29950408, 30081482, 4294902220,
+2752550, 3342384, 3604534, 3801144, 6815847, 28049835, 4294902189, 1703942,
+3801130, 6815847, 28049514, 28180909, 458751, 1703953, 6946920, 4294902199,
+4294967295, 4294967295, 29360575, 29360127, 4294902208, 29294591, 29229055, 4294902206,
+4294967295, 4294967295, 28901375, 28901375, 4294967295, 4294902185, 4294967295, 27197439,
+5963775, 27131998, 4784127, 4849737, 5898315, 6226014, 29622686, 29819333,
+30081480, 3407871, 3604532, 4718648, 4915274, 27000923, 29884871, 30081482,
+2818047, 3604531, 3801144, 27983976, 458751, 3801130, 3997756, 4128830,
+6946920, 458751, 3997713, 4128830, 6946920, 4294902199, 4294902199, 4294967295,
+29360127, 29360127, 29294591, 29294591, 29294591, 4294967295, 4294967295, 4294967295,
+28901375, 28901375, 27918335, 4294967295, 27197439, 27197439, 5963775, 4294902174,
+4784200, 5898315, 3473407, 4915272, 3866623, 3866623, 4063292, 4294901823,
+4063249, 4294901823, 4294902199, 4294902199, 4294967295, 4294902207, 29295038, 29294591,
+29294591, 4294967295, 4294967295, 4294967295, 4294967295, 28901375, 27262975, 28836265,
+27262975, 27197439, 4294902175, 27197854, 27197439, 5963775, 5046271, 5111885,
+5898319, 3473407, 5111885, 4294901839, 4294901818, 5242938, 5374033, 4294901843,
+5308433, 5439570, 4294967295, 4294902199, 28770742, 28770303, 28770303, 29295038,
+28770303, 29295038, 29294591, 4294967295, 4294967295, 4294967295, 4294967295, 4294967295,
+27262975, 28836265, 27262975, 27197439, 4294902175, 27197854, 4294967295, 4294901850,
+5111884, 5898319, 3473407, 5177422, 3866623, 3866623, 5374032, 4294901843,
+5373969, 4294901843, 4294967295, 28770742, 28770303, 28770303, 29295038, 28770303,
+29295038, 4294967295, 4294967295, 4294967295, 4294967295, 4294967295, 4294967295, 4294967295,
+4294967295, 5963775, 4521983, 4587589, 5898311, 3473407, 4587588, 4294901831,
+4294901818, 4194362, 4325441, 4294901827, 4259857, 4390978, 4294967295, 4294967295,
+4294967295, 4294967295, 4294967295, 4294967295, 4294967295, 4294967295, 4294967295, 4294967295,
+4294967295, 5898239, 4294901850, 4522052, 5832775, 4294901850, 3866676, 4653124,
+5570644, 4294901849, 3801099, 5505083, 5636181, 4294901848, 3801099, 4325440,
+5767235, 786431, 4325393, 4294901827, 4294967295, 4294967295, 4294967295, 4294967295,
+4294967295, 4294967295, 4294967295, 4294967295, 4294967295, 4294967295, 4294967295, 8454143,
+4294901971, 8388692, 13893843, 5570559, 13828182, 13959380, 14024703, 4294901974,
+4294967295, 4294967295, 4294967295, 4294967295, 4294967295, 4294967295, 4294967295, 4294967295,
+4294967295, 4294967295, 4294967295, 4294967295, 4294901888, 4294901888, 14090239, 4294967295,
+4294967295, 4294967295, 4294967295, 4294967295, 4294967295, 4294967295, 4294967295, 4294967295,
+4294967295, 4294967295, 4294967295, 7733365, 14811361, 7798783, 14745728, 4294901986,
+8388726, 4294901985, 4294901985, 14090454, 4294901985, 14155991, 14745824, 14155775,
+4294901976, 4294967295, 4294967295, 4294967295, 4294967295, 4294967295, 7536639, 4294901875,
+4294901874, 4294901874, 4294901874, 4294901874, 4294901874, 4294901874, 4294901874, 7471217,
+7471103, 4294901874, 14745717, 4294901986, 14811361, 14811135, 14811135, 14811135,
+14221311, 14745824, 14221311, 32767999, 4294902260, 4294902260, 4294902260, 4294902260,
+4294902260, 4294902260, 4294902260, 4294902260, 32834036, 32833535, 4294902261, 8454268,
+7536639, 8126579, 4294901889, 7012439, 4294901874, 7471191, 5767167, 4294901874,
+7471191, 5767167, 4294901874, 7471191, 5767167, 12124274, 5767167, 7405680,
+12124274, 7340031, 7405680, 7602290, 4294901879, 7667828, 14811255, 14876671,
+33161215, 33292794, 33161215, 33227258, 4294902268, 14221311, 14680281, 14221311,
+14287065, 32637425, 32636927, 32702962, 4294902260, 32309740, 4294902260, 32768493,
+32374783, 4294902260, 32768493, 32374783, 4294902260, 32768493, 32374783, 32768494,
+32374783, 32768494, 32899573, 32833535, 32899573, 4294902263, 8454268, 4294901948,
+8126579, 12320897, 7077887, 12779708, 4294901956, 12845251, 12451839, 20250814,
+12451839, 4294902069, 19792173, 4294902210, 19792173, 7208959, 12124344, 19595561,
+7208959, 7340142, 12058737, 12189881, 4294902057, 7274606, 7405680, 7798900,
+4294901883, 7667828, 7864439, 14811259, 15073507, 7143423, 7995512, 14811259,
+14942435, 15073509, 7143423, 14942435, 15139045, 15335656, 33292793, 15269887,
+15335657, 33095915, 33292795, 8388607, 14483676, 14614750, 15270120, 15401194,
+8257535, 14155903, 14352601, 14483676, 14680287, 14221311, 14287065, 32506075,
+32637425, 32571391, 32637425, 4294902259, 32243999, 32506351, 18874367, 4294902255,
+31654370, 4294902244, 31719907, 31916031, 31982055, 31981567, 4294902248, 32178666,
+33030638, 32243711, 32834030, 33030646, 32899071, 32965110, 4294902264, 12320897,
+20840765, 8519679, 20840636, 7077887, 12779708, 19529924, 4294902078, 12845251,
+20840746, 12451839, 19529918, 20250932, 29425982, 4294902211, 19923133, 20119858,
+20250932, 20447542, 20906302, 29557185, 19726335, 19792173, 19923247, 20119858,
+20513080, 29425983, 4294902210, 13631648, 19726636, 4294902062, 10485869, 12058807,
+12255417, 19464400, 19661099, 7208959, 10420334, 11993254, 12124344, 12255418,
+19464386, 7274495, 7798895, 10420347, 12714150, 7864319, 8061048, 8585346,
+10944678, 4294901990, 7995512, 8519803, 8650883, 15007972, 4294901990, 8716420,
+15007972, 15204583, 8912895, 15204488, 4294901993, 8847487, 8978568, 14483676,
+15204574, 4294901993, 8323197, 8978568, 14352522, 14483676, 19071258, 9109503,
+14352602, 19071258, 32571888, 19136511, 32571888, 18874367, 19071264, 31392036,
+32440812, 4294902256, 18743579, 18874655, 19005729, 31457759, 32440801, 18612223,
+18940188, 31457570, 31588833, 31719907, 4294902245, 31719907, 4294902245, 31850981,
+31982055, 4294902249, 31982055, 4294902249, 32113129, 32375275, 4294902264, 32375275,
+4294902264, 33030647, 20840447, 4294902078, 4294902078, 4294902078, 4294902078, 4294902078,
+20119858, 20840758, 4294902079, 20119858, 20906297, 10551295, 4294901968, 11993248,
+12255416, 4294901968, 10879135, 12058807, 12255418, 4294901954, 10879135, 4294901954,
+8519800, 10879107, 4294901927, 7995512, 8585346, 4294901892, 8716420, 8912895,
+4294901896, 8847487, 8978568, 8257535, 8913023, 9044105, 19071258, 9109503,
+19071258, 19136511, 18939903, 19136803, 18612223, 18874654, 19005729, 18612223,
+18940188, 4294902050, 4294967295, 4294967295, 4294967295, 21823805, 4294902094, 4294902094,
+4294902094, 15663342, 4294902094, 15597804, 21889263, 4294902095, 21954894, 20578303,
+10551295, 12648640, 10551295, 12648640, 12713983, 4294901954, 12714177, 9437183,
+4294901927, 9371774, 8781823, 8912895, 8912895, 18677901, 9306111, 18678042,
+18546687, 4294902045, 19202047, 4294902053, 4294902053, 18612363, 4294902053, 4294967295,
+4294967295, 4294967295, 20971836, 4294902093, 20709691, 4294967295, 15597805, 4294901999,
+15532268, 15663342, 4294902095, 4294902095, 4294902073, 12583072, 4294901953, 10616992,
+10748067, 12583077, 4294901953, 10748067, 12648613, 4294901954, 12714177, 9437183,
+4294901927, 9371774, 8781823, 4294901894, 8847494, 8847359, 9240711, 4294902045,
+10092685, 10223771, 18481309, 4294902045, 10223771, 18481309, 4294902045, 19202047,
+4294902053, 18284822, 18415896, 4294902053, 18219147, 18350359, 19202332, 4294967295,
+4294967295, 4294967295, 20774911, 21823808, 20709375, 21233980, 4294902085, 21299524,
+4294902086, 22020095, 22020095, 20578303, 10616831, 11075752, 4294901952, 10354809,
+10616993, 10813604, 11075752, 11206826, 12583084, 7995391, 10551454, 10813604,
+11272363, 7995391, 7995391, 7995391, 9306238, 9371647, 9633936, 9371647,
+9568400, 9699475, 9240575, 9699469, 9240575, 9699469, 10223770, 4294901917,
+10223756, 4294901917, 4294901900, 4294901900, 18219148, 18415895, 9175039, 18219148,
+4294902039, 4294967295, 4294967295, 4294967295, 21168448, 20709375, 21168450, 21299524,
+4294902087, 21102913, 21299524, 21430598, 21102591, 20643839, 21954881, 20643839,
+21496129, 21692746, 21954892, 20578303, 21692746, 4294902092, 11075752, 11403437,
+7995391, 11010206, 11141289, 11272363, 11403437, 11534511, 7995391, 11206814,
+11468972, 13303984, 4294901964, 11534457, 13369547, 7995391, 4294901964, 8257657,
+9765006, 13435084, 9371647, 9633936, 9830549, 13435084, 9371647, 9568400,
+9699475, 9830549, 4294901911, 9240716, 9896084, 13697231, 9240575, 9699469,
+4294901969, 13697164, 9240575, 4294901969, 13697164, 9240575, 13762769, 9175039,
+13697164, 4294901970, 4294967295, 4294967295, 4294967295, 4294967295, 4294967295, 21561343,
+21627209, 21626879, 4294902090, 11403437, 11206655, 11337900, 11468974, 4294901936,
+11468972, 13303984, 4294901964, 13303984, 4294901964, 4294901964, 13369493, 4294901965,
+9765008, 13369494, 4294901965, 9568400, 9830549, 4294901911, 13566103, 4294901969,
+4294901969, 4294901969, 4294901969, 4294901969, 13762769, 13762559, 4294901970, 4294967295,
+4294967295, 4294967295, 4294967295, 4294967295, 4294967295, 11403263, 13238473, 11403263,
+13238473, 13303807, 4294901963, 11796659, 11927733, 13304010, 11862015, 11927733,
+13500415, 4294901966, 13500621, 13565951, 13565951, 4294901967, 17826062, 4294902033,
+17760526, 17891600, 4294967295, 18088210, 4294902037, 17957074, 18088211, 4294902037,
+4294901970, 4294967295, 4294967295, 4294967295, 4294967295, 4294967295, 4294967295, 11403263,
+13238473, 11403263, 13238473, 13303807, 4294901963, 11862195, 13238454, 4294901963,
+11927733, 13500415, 4294901966, 13500621, 15859952, 4294902003, 15728846, 15859953,
+4294902003, 13566158, 17760255, 4294902033, 17760526, 4294902033, 18022399, 4294902037,
+17957074, 18153747, 13828095, 4294967295, 4294967295, 4294967295, 4294967295, 4294967295,
+4294967295, 4294967295, 4294901961, 4294901961, 4294967295, 16056319, 4294902007, 15925490,
+16187636, 22217040, 22479188, 15859711, 15925490, 22020340, 22282577, 22479190,
+4294902104, 16056564, 22544721, 4294967295, 4294967295, 13828095, 13828095, 4294967295,
+4294967295, 4294967295, 4294967295, 4294967295, 4294967295, 4294967295, 4294901961, 4294901961,
+4294967295, 16252927, 16252927, 22217040, 22479188, 22085631, 22282577, 22479190,
+4294902104, 22085877, 4294902104, 25624575, 25756039, 25624575, 25690503, 25821577,
+26018187, 25886719, 25952651, 4294902157, 4294901970, 4294901970, 4294967295, 4294967295,
+4294967295, 4294967295, 4294967295, 4294967295, 13238271, 13238271, 17498378, 17629452,
+17498111, 17629452, 4294967295, 16187391, 4294902007, 16187638, 22217042, 22348116,
+16187391, 22151505, 22348116, 4294902102, 16122101, 22151505, 4294967295, 25428354,
+25559429, 4294902153, 25362818, 25493892, 25690502, 25821577, 4294902157, 25952650,
+26083725, 26280335, 13828095, 26149262, 26280336, 13828095, 4294967295, 4294967295,
+4294967295, 4294967295, 4294967295, 4294967295, 4294967295, 13172914, 11665407, 12517554,
+17432777, 17629451, 9568255, 12976305, 17629450, 9568255, 17301657, 10027007,
+4294901913, 16187638, 16187391, 4294902007, 4294902006, 16122101, 4294967295, 25493890,
+25362431, 25493891, 26148863, 4294902161, 26083538, 26280336, 13828095, 4294967295,
+4294967295, 4294967295, 4294967295, 4294967295, 4294967295, 4294967295, 12582911, 13041663,
+17367039, 4294902025, 17367192, 4294902055, 16646397, 17039615, 19267849, 4294902055,
+16384248, 16515323, 16646397, 4294902015, 16318712, 16449786, 4294967295, 24314226,
+4294902133, 24314226, 24445300, 24576374, 4294902137, 24576374, 24707448, 4294967295,
+4294901970, 4294901970, 4294967295, 4294967295, 4294967295, 4294967295, 4294967295, 4294967295,
+4294967295, 4294901951, 4294901958, 17367304, 17432575, 16711679, 16777471, 16974082,
+17367300, 4294902054, 16449786, 16646396, 16777471, 16908545, 4294902019, 16384249,
+4294902011, 23789930, 4294902125, 23789930, 23921004, 24052078, 24248689, 4294902133,
+24052078, 24183152, 24379762, 24510837, 4294902137, 24641910, 24772985, 24969595,
+24838143, 24904059, 4294902141, 4294901970, 4294901970, 4294967295, 4294967295, 4294967295,
+4294967295, 4294967295, 4294967295, 4294967295, 4294901951, 4294901958, 4294967295, 16974082,
+17105156, 13172735, 16908545, 17105155, 4294902022, 17236230, 23789567, 4294902125,
+23855466, 23986541, 4294902129, 24117614, 4294902129, 24969594, 25166206, 4294902145,
+24904058, 25035133, 25166207, 4294902145, 4294901970, 4294901970, 4294967295, 4294967295,
+4294967295, 4294967295, 4294967295, 4294967295, 4294967295, 4294901951, 13041862, 13107199,
+13107199, 13107199, 13107199, 26345672, 17301503, 22675801, 4294902108, 22675801,
+22806875, 22937949, 4294902112, 22937949, 23069023, 4294967295, 25231744, 25165823,
+25231744, 13828095, 13828095, 4294967295, 4294967295, 4294967295, 4294967295, 4294967295,
+4294967295, 4294967295, 12582911, 4294902056, 4294902056, 4294902056, 4294902056, 4294902056,
+26345768, 4294902163, 17236165, 22806873, 4294902163, 22610117, 22806875, 23069021,
+12976127, 23003485, 4294902112, 4294901957, 23396549, 23593318, 12976127, 23200097,
+23396708, 23527782, 23658856, 13828095, 23200097, 23331171, 4294902121, 23199954,
+23331171, 4294967295, 4294967295, 4294967295, 4294967295, 4294967295, 4294967295, 4294967295,
+12582911, 4294902056, 4294902056, 4294902056, 4294902056, 4294902056, 26345768, 4294902163,
+17236165, 4294902163, 4294901957, 4294901957, 4294901957, 23396549, 4294902120, 23134405,
+23396708, 23593319, 4294902121, 23265633, 23658852, 23330815, 4294902116, 4294967295,
+4294967295, 4294967295};
 
 void loadMap_mercury_WAD(WAD::LevelData& dstLevel) {
 	// Load vertex data
-	dstLevel.vertices = (const WAD::Vertex*)mercury_WADVertices;
+	dstLevel.vertices = (const WAD::PackedVertex*)mercury_WADVertices;
 
 	// Load line defs
+	dstLevel.numLineDefs = (mercury_WADLineDefsSize * 4) / sizeof(WAD::LineDef);
 	dstLevel.lineDefs = (const WAD::LineDef*)mercury_WADLineDefs;
 
 	// Load side defs
@@ -1960,4 +1864,16 @@ void loadMap_mercury_WAD(WAD::LevelData& dstLevel) {
 	// Load nodes
 	dstLevel.numNodes = (mercury_WADNodesSize * 4) / sizeof(WAD::Node);
 	dstLevel.nodes = (const WAD::Node*)mercury_WADNodes;
+
+	// Load baked lighting
+	dstLevel.segLights = (const uint8_t*)mercury_WADSegLights;
+
+	// Load render hot seg data
+	dstLevel.segVertices = (const uint16_t*)mercury_WADSegVertices;
+	dstLevel.segFrontSectors = (const uint8_t*)mercury_WADSegFrontSectors;
+	dstLevel.segBackSectors = (const uint8_t*)mercury_WADSegBackSectors;
+	dstLevel.segFlags = (const uint8_t*)mercury_WADSegFlags;
+
+	// Load collision blockmap
+	dstLevel.blockMap = (const uint16_t*)mercury_WADBlockMap;
 }
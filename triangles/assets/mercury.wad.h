@@ -3,13 +3,13 @@
 #include <base.h>
 #include <WAD.h>
 
-constexpr uint32_t mercury_WADVerticesSize = 1040;
+constexpr uint32_t mercury_WADVerticesSize = 520;
 extern const uint32_t mercury_WADVertices[];
 
 constexpr uint32_t mercury_WADLineDefsSize = 1782;
 extern const uint32_t mercury_WADLineDefs[];
 
-constexpr uint32_t mercury_WADSideDefsSize = 6308;
+constexpr uint32_t mercury_WADSideDefsSize = 2523;
 extern const uint32_t mercury_WADSideDefs[];
 
 constexpr uint32_t mercury_WADSegmentsSize = 2772;
@@ -18,11 +18,29 @@ extern const uint32_t mercury_WADSegments[];
 constexpr uint32_t mercury_WADSubSectorsSize = 287;
 extern const uint32_t mercury_WADSubSectors[];
 
-constexpr uint32_t mercury_WADSectorsSize = 663;
+constexpr uint32_t mercury_WADSectorsSize = 357;
 extern const uint32_t mercury_WADSectors[];
 
-constexpr uint32_t mercury_WADNodesSize = 2574;
+constexpr uint32_t mercury_WADNodesSize = 2002;
 extern const uint32_t mercury_WADNodes[];
 
+constexpr uint32_t mercury_WADSegLightsSize = 462;
+extern const uint32_t mercury_WADSegLights[];
+
+constexpr uint32_t mercury_WADSegVerticesSize = 924;
+extern const uint32_t mercury_WADSegVertices[];
+
+constexpr uint32_t mercury_WADSegFrontSectorsSize = 231;
+extern const uint32_t mercury_WADSegFrontSectors[];
+
+constexpr uint32_t mercury_WADSegBackSectorsSize = 231;
+extern const uint32_t mercury_WADSegBackSectors[];
+
+constexpr uint32_t mercury_WADSegFlagsSize = 231;
+extern const uint32_t mercury_WADSegFlags[];
+
+constexpr uint32_t mercury_WADBlockMapSize = 2258;
+extern const uint32_t mercury_WADBlockMap[];
+
 void loadMap_mercury_WAD(WAD::LevelData& dstLevel);
 
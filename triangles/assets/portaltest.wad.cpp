@@ -1,241 +1,220 @@
-#include "C:\repos\GBA\raycaster\assets\portaltest.wad.h"
+#include "portaltest.wad.h"
 
-extern const uint32_t portaltest_WADVertices[144] = {
-491520, 589824, 622592, 589824, 688128, 524288, 688128, 131072,
-622592, 65536, 360448, 65536, 294912, 131072, 294912, 524288,
-360448, 589824, 491520, 524288, 425984, 458752, 491520, 393216,
-557056, 458752, 425984, 65536, 294912, 4294443008, 360448, 4294377472,
-557056, 65536, 294912, 4294770688, 425984, 4294901760, 557056, 4294901760,
-688128, 4294770688, 688128, 4294443008, 622592, 4294377472, 163840, 589824,
-229376, 524288, 229376, 4294443008, 163840, 4294377472, 4294803456, 4294377472,
-4294672384, 4294508544, 4294410240, 4294508544, 4294279168, 4294639616, 4294279168, 327680,
-4294541312, 589824, 229376, 4294705152, 294912, 4294705152, 294912, 4294508544,
-229376, 4294508544, 229376, 393216, 294912, 393216, 294912, 262144,
-229376, 262144, 4294606848, 196608, 4294672384, 262144, 4294672384, 327680,
-4294606848, 393216, 4294541312, 393216, 4294475776, 327680, 4294475776, 262144,
-4294541312, 196608, 4294672384, 65536, 4294737920, 131072, 4294934528, 131072,
-32768, 65536, 32768, 4294836224, 4294868992, 4294705152, 4294868992, 4294639616,
-4294803456, 4294574080, 4294737920, 4294574080, 4294672384, 4294639616, 4294672384, 4294770688,
-4294606848, 4294836224, 4294606848, 4294901760, 4294672384, 0, 4294672384, 589824,
-229376, 65536, 4294868992, 4294377472, 4294344704, 393216, 4294606848, 4294508544,
-655360, 557056, 294912, 196608, 327680, 557056, 557056, 589824};
+extern const uint32_t portaltest_WADVertices[72] = {
+2162544, 4259728, 4259824, 2097168, 4290773008, 4286644176, 4282449808, 4284546928,
+4288741232, 65392, 8454000, 10551152, 18874448, 16777328, 12583024, 18939760,
+8388720, 2097264, 4284547024, 4282449840, 4276158416, 4276158384, 4280352624, 4278190192,
+4276093008, 4286578800, 4280287344, 10551056, 8453904, 6356784, 6356816, 12648272,
+12648240, 12648144, 18939696, 4290838352, 4292935504, 4280352592, 4280352496, 4284546736,
+10550960, 17826112, 16777552, 4194640, 2097456, 2097424, 2097328, 4194448,
+6291600, 12583152, 14680336, 2097360, 8388752, 16777360, 17825952, 14680272,
+12583056, 18874608, 18874640, 18874544, 16777456, 18874672, 4292870352, 4292870416,
+4278190224, 4280287376, 4288675984, 4288676176, 4278190416, 4276093232, 4276093104, 4286578832};
 extern const uint32_t portaltest_WADLineDefs[242] = {
-65536, 1, 0, 131071, 65538, 0, 4294901761, 196610,
-1, 131072, 262143, 65540, 0, 4294901763, 1048580, 1,
-262144, 393215, 65542, 0, 4294901765, 2555910, 1, 393216,
-524287, 65544, 0, 4294901767, 8, 1, 524288, 655359,
-65546, 0, 4294901769, 720906, 1, 655360, 786431, 65548,
-0, 4294901771, 589836, 1, 786432, 1245183, 65549, 0,
-4294901773, 2293774, 1, 917504, 1114111, 65555, 0, 4294901775,
-851984, 4, 1048576, 851985, 65541, 0, 4294901778, 1179665,
-1, 1245184, 1310719, 262162, 0, 1376276, 1310739, 1,
-1441792, 1376255, 65557, 0, 4294901783, 1441813, 1, 1572864,
-1507327, 65551, 0, 4294901785, 917519, 1, 1703936, 1572863,
-65560, 0, 4294901787, 2424856, 1, 1835008, 1703935, 65562,
-0, 4294901789, 1769498, 1, 1966080, 1835007, 65564, 0,
-4294901791, 1900572, 1, 2097152, 1966079, 65566, 0, 4294901793,
-2031646, 1, 2228224, 2097151, 65568, 0, 4294901795, 1507360,
-1, 2359296, 2228223, 65570, 0, 4294901797, 2228259, 4,
-2490368, 2293799, 65572, 0, 4294901800, 2359329, 4, 2686976,
-2228266, 65553, 0, 4294901803, 1638436, 1, 2883584, 2490367,
-65574, 0, 4294901805, 2490407, 4, 3014656, 2555951, 65576,
-0, 4294901808, 2621477, 4, 3211264, 2490418, 65543, 0,
-4294901811, 2162728, 1, 3407872, 2752511, 262186, 0, 3538997,
-2818090, 4, 3604480, 2818104, 262188, 0, 3801145, 2949164,
-4, 3866624, 2949180, 262190, 0, 4063293, 3080238, 4,
-4128768, 3080256, 262192, 0, 4325441, 2687024, 4, 4390912,
-3211332, 262194, 0, 4587589, 3342386, 4, 4653056, 3342408,
-262196, 0, 4849737, 3473460, 4, 4915200, 3473484, 262198,
-0, 5111885, 3604534, 4, 5177344, 3604560, 262200, 0,
-5374033, 3735608, 4, 5439488, 3735636, 262202, 0, 5636181,
-3866682, 4, 5701632, 3866712, 262204, 0, 5898329, 3997756,
-4, 5963776, 3997788, 262206, 0, 6160477, 3211326, 4,
+3997753, 1, 0, 4063231, 65578, 0, 4294901761, 2818090,
+1, 131072, 2883583, 65580, 0, 4294901763, 2949164, 1,
+262144, 3080191, 65583, 0, 4294901765, 3407919, 1, 393216,
+3538943, 65595, 0, 4294901767, 3735611, 1, 524288, 3997695,
+65591, 0, 4294901769, 3211319, 1, 655360, 3276799, 65586,
+0, 4294901771, 3932210, 1, 786432, 4128767, 65587, 0,
+4294901773, 4259904, 1, 917504, 3014655, 65599, 0, 4294901775,
+3342381, 4, 1048576, 3342353, 65582, 0, 4294901778, 4063298,
+1, 1245184, 4194303, 262206, 0, 1376276, 4390975, 1,
+1441792, 4456447, 65604, 0, 4294901783, 4522052, 1, 1572864,
+4587519, 65606, 0, 4294901785, 4194374, 1, 1703936, 851967,
+65549, 0, 4294901787, 917517, 1, 1835008, 1572863, 65560,
+0, 4294901789, 1376280, 1, 1966080, 1441791, 65558, 0,
+4294901791, 2490390, 1, 2097152, 2555903, 65575, 0, 4294901793,
+2621479, 1, 2228224, 2686975, 65570, 0, 4294901795, 786466,
+1, 2359296, 1703935, 65607, 0, 4294901797, 4653121, 4,
+2490368, 4259879, 65562, 0, 4294901800, 1703961, 4, 2686976,
+4653098, 65602, 0, 4294901803, 1507354, 1, 2883584, 983039,
+65592, 0, 4294901805, 3670068, 4, 3014656, 3407919, 65552,
+0, 4294901808, 1048590, 4, 3211264, 3670066, 65589, 0,
+4294901811, 1638416, 1, 3407872, 2031615, 262154, 0, 3538997,
+720906, 4, 3604480, 720952, 262175, 0, 3801145, 2097183,
+4, 3866624, 2097212, 262171, 0, 4063293, 1835035, 4,
+4128768, 1835072, 262173, 0, 4325441, 1966109, 4, 4390912,
+68, 262145, 0, 4587589, 131073, 4, 4653056, 131144,
+262147, 0, 4849737, 262147, 4, 4915200, 262220, 262149,
+0, 5111885, 1179653, 4, 5177344, 1179728, 262163, 0,
+5374033, 393235, 4, 5439488, 393300, 262151, 0, 5636181,
+524295, 4, 5701632, 524376, 262179, 0, 5898329, 2359331,
+4, 5963776, 2359388, 262153, 0, 6160477, 9, 4,
 6225920, 96};
-extern const uint32_t portaltest_WADSideDefs[728] = {
-0, 45, 0, 45, 0, 1380013139, 827212116, 0,
-2949120, 0, 2949120, 0, 1414725632, 1096045121, 12622, 0,
-45, 0, 45, 0, 1380013139, 827212116, 0, 2949120,
-0, 2949120, 0, 1414725632, 1096045121, 12622, 0, 45,
-0, 45, 0, 1380013139, 827212116, 0, 2949120, 0,
-2949120, 0, 1414725632, 1096045121, 12622, 0, 45, 0,
-45, 0, 1380013139, 827212116, 0, 2949120, 0, 2949120,
-0, 1414725632, 1096045121, 12622, 0, 45, 0, 45,
-0, 1380013139, 827212116, 0, 2949120, 0, 2949120, 0,
-2949120, 0, 0, 0, 45, 0, 45, 0,
-45, 0, 0, 2949120, 0, 2949120, 0, 2949120,
-0, 0, 0, 45, 0, 45, 0, 45,
-0, 0, 2949120, 0, 2949120, 0, 1414725632, 1096045121,
-78158, 0, 45, 0, 45, 0, 1380013139, 827212116,
-2, 2949120, 0, 2949120, 0, 1414725632, 1096045121, 78158,
-32, 45, 0, 45, 0, 45, 0, 0,
-2949120, 0, 2949120, 0, 2949120, 0, 65536, 96,
-45, 0, 45, 0, 1380013139, 827212116, 0, 2949120,
-0, 2949120, 0, 1414725632, 1096045121, 143694, 0, 45,
-0, 45, 0, 45, 0, 1, 2949120, 0,
-2949120, 0, 2949120, 0, 131072, 0, 45, 0,
-45, 0, 1380013139, 827212116, 2, 2949120, 0, 2949120,
-0, 1414725632, 1096045121, 143694, 0, 45, 0, 45,
-0, 1380013139, 827212116, 2, 2949120, 0, 2949120, 0,
-1414725632, 1096045121, 143694, 0, 45, 0, 45, 0,
-1380013139, 827212116, 2, 2949120, 0, 2949120, 0, 1414725632,
-1096045121, 209230, 0, 45, 0, 45, 0, 1380013139,
-827212116, 3, 2949120, 0, 2949120, 0, 1414725632, 1096045121,
-209230, 0, 45, 0, 45, 0, 1380013139, 827212116,
-3, 2949120, 0, 2949120, 0, 1414725632, 1096045121, 209230,
-0, 45, 0, 45, 0, 1380013139, 827212116, 3,
-2949120, 0, 2949120, 0, 1414725632, 1096045121, 209230, 0,
-45, 0, 45, 0, 1380013139, 827212116, 3, 2949120,
-0, 2949120, 0, 1414725632, 1096045121, 209230, 0, 45,
-0, 45, 0, 1380013139, 827212116, 3, 2949120, 0,
-2949120, 0, 1414725632, 1096045121, 274766, 32, 45, 0,
-45, 0, 45, 0, 2, 2949120, 0, 2949120,
-0, 2949120, 0, 262144, 0, 45, 0, 45,
-0, 1380013139, 827212116, 25165828, 2949120, 0, 2949120, 0,
-2949120, 0, 196608, 0, 45, 0, 45, 0,
-45, 0, 8388612, 2949120, 0, 2949120, 0, 1414725632,
-1096045121, 143694, 480, 45, 0, 45, 0, 1380013139,
-827212116, 3, 2949120, 0, 2949120, 0, 1414725632, 1096045121,
-340302, 64, 45, 0, 45, 0, 45, 0,
-0, 2949120, 0, 2949120, 0, 2949120, 0, 327680,
-0, 45, 0, 45, 0, 1380013139, 827212116, 4194309,
-2949120, 0, 2949120, 0, 2949120, 0, 196608, 0,
-45, 0, 45, 0, 45, 0, 8388613, 2949120,
-0, 2949120, 0, 1414725632, 1096045121, 12622, 128, 45,
-0, 45, 0, 1380013139, 827212116, 3, 2949120, 0,
-2949120, 0, 2949120, 0, 196608, 0, 45, 0,
-45, 0, 45, 0, 6, 2949120, 0, 2949120,
-0, 2949120, 0, 196608, 0, 45, 0, 45,
-0, 45, 0, 6, 2949120, 0, 2949120, 0,
-2949120, 0, 196608, 0, 45, 0, 45, 0,
-45, 0, 6, 2949120, 0, 2949120, 0, 2949120,
-0, 196608, 0, 45, 0, 45, 0, 45,
-0, 6, 2949120, 0, 2949120, 0, 2949120, 0,
-196608, 0, 45, 0, 45, 0, 45, 0,
-6, 2949120, 0, 2949120, 0, 2949120, 0, 196608,
-0, 45, 0, 45, 0, 45, 0, 6,
-2949120, 0, 2949120, 0, 2949120, 0, 196608, 0,
-45, 0, 45, 0, 45, 0, 6, 2949120,
-0, 2949120, 0, 2949120, 0, 196608, 0, 45,
-0, 45, 0, 45, 0, 6, 2949120, 0,
-2949120, 0, 2949120, 0, 458752, 0, 45, 0,
-45, 0, 45, 0, 3, 2949120, 0, 2949120,
-0, 2949120, 0, 458752, 0, 45, 0, 45,
-0, 45, 0, 3, 2949120, 0, 2949120, 0,
-2949120, 0, 458752, 0, 45, 0, 45, 0,
-45, 0, 3, 2949120, 0, 2949120, 0, 2949120,
-0, 458752, 0, 45, 0, 45, 0, 45,
-0, 3, 2949120, 0, 2949120, 0, 2949120, 0,
-458752, 0, 45, 0, 45, 0, 45, 0,
-3, 2949120, 0, 2949120, 0, 2949120, 0, 458752,
-0, 45, 0, 45, 0, 45, 0, 3,
-2949120, 0, 2949120, 0, 2949120, 0, 458752, 0,
-45, 0, 45, 0, 45, 0, 3, 2949120,
-0, 2949120, 0, 2949120, 0, 458752, 0, 45,
-0, 45, 0, 45, 0, 3, 2949120, 0,
-2949120, 0, 2949120, 0, 458752, 0, 45, 0,
-45, 0, 45, 0, 3, 2949120, 0, 2949120,
-0, 2949120, 0, 458752, 0, 45, 0, 45,
-0, 45, 0, 3, 2949120, 0, 2949120, 0,
-2949120, 0, 458752, 0, 45, 0, 45, 0,
-45, 0, 3, 2949120, 0, 2949120, 0, 2949120,
-0, 458752, 0, 45, 0, 45, 0, 45,
-0, 3, 2949120, 0, 2949120, 0, 2949120, 0,
-458752, 0, 45, 0, 45, 0, 45, 0,
-3, 2949120, 0, 2949120, 0, 2949120, 0, 458752,
-0, 45, 0, 45, 0, 45, 0, 3};
+extern const uint32_t portaltest_WADSideDefs[291] = {
+0, 0, 1, 0, 0, 1, 0, 0,
+1, 0, 0, 1, 0, 0, 1, 0,
+0, 1, 0, 0, 1, 0, 0, 1,
+0, 0, 1, 0, 0, 0, 0, 0,
+0, 0, 0, 0, 0, 0, 0, 0,
+0, 65537, 0, 0, 131073, 0, 0, 65537,
+32, 0, 0, 0, 0, 65536, 96, 0,
+1, 0, 0, 131073, 0, 0, 65536, 0,
+0, 131072, 0, 0, 131073, 0, 0, 131073,
+0, 0, 131073, 0, 0, 131073, 0, 0,
+131073, 0, 0, 196609, 0, 0, 196609, 0,
+0, 196609, 0, 0, 196609, 0, 0, 196609,
+0, 0, 196609, 0, 0, 196609, 0, 0,
+196609, 0, 0, 196609, 0, 0, 196609, 0,
+0, 262145, 32, 0, 131072, 0, 0, 262144,
+0, 0, 262145, 384, 0, 196608, 0, 0,
+262144, 128, 0, 131073, 480, 0, 196609, 0,
+0, 327681, 64, 0, 0, 0, 0, 327680,
+0, 0, 327681, 64, 0, 196608, 0, 0,
+327680, 128, 0, 1, 128, 0, 196609, 0,
+0, 196608, 0, 0, 393216, 0, 0, 196608,
+0, 0, 393216, 0, 0, 196608, 0, 0,
+393216, 0, 0, 196608, 0, 0, 393216, 0,
+0, 196608, 0, 0, 393216, 0, 0, 196608,
+0, 0, 393216, 0, 0, 196608, 0, 0,
+393216, 0, 0, 196608, 0, 0, 393216, 0,
+0, 458752, 0, 0, 196608, 0, 0, 458752,
+0, 0, 196608, 0, 0, 458752, 0, 0,
+196608, 0, 0, 458752, 0, 0, 196608, 0,
+0, 458752, 0, 0, 196608, 0, 0, 458752,
+0, 0, 196608, 0, 0, 458752, 0, 0,
+196608, 0, 0, 458752, 0, 0, 196608, 0,
+0, 458752, 0, 0, 196608, 0, 0, 458752,
+0, 0, 196608, 0, 0, 458752, 0, 0,
+196608, 0, 0, 458752, 0, 0, 196608, 0,
+0, 458752, 0, 0, 196608, 0, 0, 458752,
+0, 0, 196608};
 extern const uint32_t portaltest_WADSegments[318] = {
-3276849, 3612672, 0, 3342386, 3670016, 0, 3407923, 3792896,
-0, 3473460, 3850240, 0, 3538997, 3907584, 0, 3801145,
-4153344, 0, 3866682, 4210688, 0, 3211326, 4472832, 0,
-3735610, 4186112, 1, 3211314, 3645440, 1, 3407925, 3817472,
-1, 2818090, 3162112, 0, 3276851, 3702784, 1, 1572887,
-1695744, 0, 2424856, 1753088, 0, 1507391, 2228224, 4194304,
-2621477, 2932736, 0, 4194344, 3063808, 0, 3342388, 3760128,
-1, 3604534, 3981312, 0, 3670071, 4038656, 0, 3735608,
-4096000, 0, 3604536, 4005888, 1, 1769537, 1867776, 8388608,
-1835035, 1925120, 0, 3670073, 4063232, 1, 1703961, 1810432,
-0, 4259866, 1867776, 0, 2359329, 2539520, 0, 1638436,
-2670592, 0, 2162752, 3063808, 6291456, 3473462, 3874816, 1,
-3538999, 3948544, 1, 3080238, 3457024, 0, 2687024, 3538944,
-0, 2752553, 3088384, 0, 2883627, 3235840, 0, 3014701,
-3383296, 0, 2687018, 3121152, 1, 2752555, 3194880, 1,
-2818092, 3268608, 1, 2883629, 3276800, 1, 2949166, 3350528,
-1, 3014703, 3424256, 1, 3080240, 3497984, 1, 3145769,
-3571712, 1, 2097218, 2170880, 2949120, 4128800, 2228224, 0,
-2949164, 3309568, 0, 3932219, 4284416, 0, 3997756, 4341760,
-0, 4063293, 4399104, 0, 3997758, 4431872, 1, 4063281,
-4505600, 1, 4390940, 1998848, 0, 3801147, 4243456, 1,
-3866684, 4317184, 1, 1900611, 1998848, 2097152, 1966109, 2056192,
-0, 2031646, 2113536, 0, 4325407, 2170880, 0, 3145775,
-3530752, 0, 3932221, 4374528, 1, 131140, 122880, 1507328,
-196610, 180224, 0, 262147, 237568, 0, 1048580, 294912,
-0, 393221, 352256, 0, 4521990, 409600, 0, 786443,
-729088, 0, 851984, 1081344, 0, 327693, 1146880, 0,
-2555973, 409600, 2097152, 4587527, 466944, 0, 720906, 712704,
-0, 2490407, 2768896, 0, 458790, 2965504, 0, 4653056,
-0, 0, 524358, 466944, 1507328, 8, 524288, 0,
-655369, 630784, 0, 65607, 0, 2097152, 4456449, 122880,
-0, 589836, 811008, 0, 2490405, 2686976, 0, 2555942,
-2801664, 1, 2621479, 2850816, 0, 2424872, 2899968, 1,
-851986, 868352, 0, 1245200, 1032192, 0, 1048589, 1048576,
-1, 1179667, 1277952, 0, 2293774, 933888, 0, 1179665,
-1187840, 0, 1245202, 1245184, 1, 1310739, 1368064, 0,
-1376276, 1425408, 0, 1441813, 1482752, 0, 983062, 1540096,
-0, 917519, 1597440, 0, 2228259, 2375680, 0, 1114146,
-2572288, 0, 2228257, 2293760, 0, 2293794, 2408448, 1,
-2359331, 2457600, 0, 2162724, 2506752, 1};
+65536, 3612672, 0, 131073, 3670016, 0, 196610, 3792896,
+0, 262147, 3850240, 0, 327684, 3907584, 0, 458758,
+4153344, 0, 524295, 4210688, 0, 9, 4472832, 0,
+393223, 4186112, 1, 1, 3645440, 1, 196612, 3817472,
+1, 720906, 3162112, 0, 65538, 3702784, 1, 851980,
+1695744, 0, 917517, 1753088, 0, 786447, 2228224, 4194304,
+1048590, 2932736, 0, 1114128, 3063808, 0, 131075, 3760128,
+1, 1179653, 3981312, 0, 1245202, 4038656, 0, 393235,
+4096000, 0, 1179667, 4005888, 1, 1376276, 1867776, 8388608,
+1441813, 1925120, 0, 1245190, 4063232, 1, 1572887, 1810432,
+0, 1310744, 1867776, 0, 1703961, 2539520, 0, 1507354,
+2670592, 0, 1638417, 3063808, 6291456, 262149, 3874816, 1,
+327698, 3948544, 1, 1835035, 3457024, 0, 1966109, 3538944,
+0, 655390, 3088384, 0, 2031627, 3235840, 0, 1769504,
+3383296, 0, 1966090, 3121152, 1, 655371, 3194880, 1,
+720927, 3268608, 1, 2031648, 3276800, 1, 2097179, 3350528,
+1, 1769500, 3424256, 1, 1835037, 3497984, 1, 1900574,
+3571712, 1, 2228257, 2170880, 2949120, 983074, 2228224, 0,
+2097183, 3309568, 0, 2293768, 4284416, 0, 2359331, 4341760,
+0, 589860, 4399104, 0, 2359305, 4431872, 1, 589824,
+4505600, 1, 2424854, 1998848, 0, 458760, 4243456, 1,
+524323, 4317184, 1, 2490405, 1998848, 2097152, 2555942, 2056192,
+0, 2621479, 2113536, 0, 2162728, 2170880, 0, 1900572,
+3530752, 0, 2293796, 4374528, 1, 2752553, 122880, 1507328,
+2818090, 180224, 0, 2883627, 237568, 0, 2949164, 294912,
+0, 3080238, 352256, 0, 3145775, 409600, 0, 3276849,
+729088, 0, 3342381, 1081344, 0, 3014707, 1146880, 0,
+3407920, 409600, 2097152, 3538997, 466944, 0, 3211319, 712704,
+0, 3670068, 2768896, 0, 3473464, 2965504, 0, 3801145,
+0, 0, 3866678, 466944, 1507328, 3735611, 524288, 0,
+3604540, 630784, 0, 3997754, 0, 2097152, 2687037, 122880,
+0, 3932210, 811008, 0, 3670030, 2686976, 0, 3407928,
+2801664, 1, 1048628, 2850816, 0, 917520, 2899968, 1,
+3342398, 868352, 0, 4128813, 1032192, 0, 2949171, 1048576,
+1, 4063295, 1277952, 0, 4259904, 933888, 0, 4063298,
+1187840, 0, 4128830, 1245184, 1, 4390975, 1368064, 0,
+4456515, 1425408, 0, 4522052, 1482752, 0, 4587589, 1540096,
+0, 4194374, 1597440, 0, 4653121, 2375680, 0, 4325447,
+2572288, 0, 4653081, 2293760, 0, 4259911, 2408448, 1,
+1704001, 2457600, 0, 1638426, 2506752, 1};
 extern const uint32_t portaltest_WADSubSectors[29] = {
 8, 524289, 589825, 655361, 720898, 851974, 1245187, 1441793,
 1507331, 1703943, 2162689, 2228225, 2293761, 2359297, 2424833, 2490376,
 3014659, 3211267, 3407874, 3538947, 3735558, 4128777, 4718597, 5046276,
 5308419, 5505028, 5767172, 6029322, 6684676};
-extern const uint32_t portaltest_WADSectors[52] = {
-83886080, 1330596934, 828321874, 1279870275, 3235633, 192, 0, 1279657216,
-810700623, 1162031455, 1597066313, 12582961, 0, 83886080, 1330596934, 828321874,
-1279870275, 3235633, 192, 0, 1279657216, 810700623, 1162031455, 1597066313,
-12582961, 0, 52429120, 1330596934, 828321874, 1279870275, 3235633, 192,
-20971520, 1279656736, 810700623, 1162031455, 1597066313, 12582961, 0, 83886400,
-1330596934, 828321874, 1279870275, 3235633, 192, 4279238656, 1279657216, 810700623,
-1162031455, 1597066313, 12582961, 0};
-extern const uint32_t portaltest_WADNodes[252] = {
-4294737920, 4294574080, 4294901760, 65536, 4271964064, 4280352384, 4271963840, 4271963776,
-2147581952, 4294672384, 65536, 65536, 65536, 4271964064, 4280352384, 4286644128,
-4271963776, 2147614720, 32768, 65536, 0, 4294770688, 4271964064, 4280352384,
-4280352640, 4280352544, 2147680257, 4294737920, 131072, 196608, 0, 4271964064,
-4280352384, 4288675840, 4278255232, 2147745794, 4294934528, 131072, 65536, 4294901760,
-4271898624, 4280352384, 4286578816, 4286643840, 2147811331, 4294868992, 4294639616, 4294901760,
-4294901760, 4271963872, 4276158112, 4271963840, 4276158144, 2147975174, 4294803456, 4294574080,
-4294901760, 0, 4271963872, 4276158112, 4265672352, 4276158080, 2148007941, 4294868992,
-4294705152, 0, 4294901760, 4265672416, 4276158080, 4265672576, 4286643936, 2148073478,
-32768, 4294836224, 4294836224, 4294836224, 4271898752, 4286643840, 4265672576, 4286643840,
-458756, 4294541312, 393216, 4294901760, 4294901760, 32, 4265672224, 4290773024,
-4269866528, 2148499470, 4294672384, 327680, 4294901760, 65536, 32, 4269866592,
-4290773024, 4269866528, 622605, 4294606848, 196608, 65536, 65536, 4290838496,
-4269866592, 4290773024, 4269866528, 688140, 4294541312, 196608, 65536, 0,
-4290838464, 4267769408, 4290773024, 4269866528, 753675, 4294475776, 327680, 0,
-4294901760, 4292870144, 4263575072, 4290773024, 4269866528, 819210, 4294541312, 393216,
-65536, 0, 4290773024, 4269866528, 2097280, 4269866464, 2148532237, 4294606848,
-4294901760, 65536, 65536, 4278255456, 4269866592, 4282449792, 4269866592, 2148696081,
-4294672384, 4294770688, 4294901760, 65536, 4278255488, 4269866592, 4269866784, 4269866592,
-2148728847, 4294606848, 4294836224, 0, 65536, 4269866880, 4269866592, 4269801504,
-4267769280, 2148794384, 4294541312, 196608, 4294901760, 65536, 4290773120, 4269866464,
-4269801504, 4269866432, 1114126, 4294672384, 262144, 0, 65536, 4265607296,
-4286643840, 4269801600, 4269866432, 1179656, 491520, 524288, 4294901760, 4294901760,
-4194432, 2162608, 4194432, 5242880, 2149089303, 425984, 458752, 65536,
-4294901760, 4290773104, 65440, 4194432, 5308336, 1343510, 491520, 393216,
-65536, 65536, 4286578800, 6356896, 4290773120, 5308320, 1409045, 294912,
-131072, 0, 131072, 4286578816, 6356896, 4292870176, 4288741248, 2149122070,
-294912, 4294443008, 0, 65536, 4265672512, 6356896, 4269866720, 4288741248,
-2149351451, 557056, 4294901760, 4294836224, 0, 4282449792, 2162656, 4265672512,
-6356864, 1605658, 622592, 65536, 4294901760, 0, 4286578816, 6356864,
-4265672576, 6356864, 1638423, 229376, 524288, 0, 4294836224, 4265607296,
-4286643648, 4265607296, 6356864, 1703955};
+extern const uint32_t portaltest_WADSectors[28] = {
+83886080, 65536, 192, 0, 1280, 12582913, 0, 83886080,
+65536, 192, 0, 1280, 12582913, 0, 52429120, 65536,
+192, 20971520, 800, 12582913, 0, 83886400, 65536, 192,
+4279238656, 1280, 12582913, 0};
+extern const uint32_t portaltest_WADNodes[196] = {
+8454000, 2097152, 4265607296, 4286643840, 4269801600, 4269866432, 655361, 4290773008,
+4290838464, 4271898752, 4286643840, 4265672576, 4286643840, 458754, 4259824, 4292870176,
+4271898624, 4280352384, 4286578816, 4286643840, 2147811331, 4259728, 96, 4271964064,
+4280352384, 4288675840, 4278255232, 2147745796, 2097168, 4288675840, 4271964064, 4280352384,
+4280352640, 4280352544, 2147680261, 2162544, 2097184, 4271964064, 4280352384, 4286644128,
+4271963776, 2147614726, 4282449808, 2162656, 4271964064, 4280352384, 4271963840, 4271963776,
+2147581952, 4286644176, 4292870144, 4265672416, 4276158080, 4265672576, 4286643936, 2148073480,
+4282449840, 65504, 4271963872, 4276158112, 4265672352, 4276158080, 2148007945, 4284547024,
+4292935648, 4271963872, 4276158112, 4271963840, 4276158144, 2147975174, 6356784, 2162656,
+4290773120, 4269866464, 4269801504, 4269866432, 1114123, 12648240, 32, 4290773024,
+4269866528, 2097280, 4269866464, 2148532236, 10551056, 4292870144, 4292870144, 4263575072,
+4290773024, 4269866528, 884746, 6356784, 32, 4290838464, 4267769408, 4290773024,
+4269866528, 950283, 6356816, 2097184, 4290838496, 4269866592, 4290773024, 4269866528,
+1015820, 10551152, 2162656, 32, 4269866592, 4290773024, 4269866528, 1081357,
+12648240, 4292935648, 32, 4265672224, 4290773024, 4269866528, 2148499470, 4290838352,
+2097152, 4269866880, 4269866592, 4269801504, 4267769280, 2148794386, 4288741232, 2162656,
+4278255488, 4269866592, 4269866784, 4269866592, 2148728851, 4292935504, 2097184, 4278255456,
+4269866592, 4282449792, 4269866592, 2148696081, 2097456, 65504, 4286578816, 6356864,
+4265672576, 6356864, 1638421, 4194448, 4194304, 4286578816, 6356896, 4292870176,
+4288741248, 2149122070, 12583152, 2097184, 4286578800, 6356896, 4290773120, 5308320,
+1540117, 14680272, 4292870176, 4290773104, 65440, 4194432, 5308336, 1605654,
+16777456, 4292935648, 4194432, 2162608, 4194432, 5242880, 2149089303, 4292870416,
+65472, 4282449792, 2162656, 4265672512, 6356864, 1736730, 4278190224, 2097152,
+4265672512, 6356896, 4269866720, 4288741248, 2149351451, 16777328, 4290772992, 4265607296,
+4286643648, 4265607296, 6356864, 1310720};
+extern const uint32_t portaltest_WADSegLights[53] = {
+2021170846, 3233848990, 2661195422, 3233857728, 2661193374, 3233857728, 2408544376, 1786298539,
+3233857728, 3233848990, 2021170846, 1819713182, 2020777615, 1986695055, 2881339072, 2661204160,
+3233857728, 2661185656, 2661195422, 3233848990, 2021170846, 3233848990, 2021170846, 2020380574,
+2661185656, 2661204160, 3233848990, 3233839224, 1819844254, 2913832847, 2661195407, 2409021632,
+2408557483, 2408543850, 2661203371, 1786148470, 2526003390, 3233848990, 1919986624, 1886031766,
+1785830791, 2275251855, 2341173111, 2341173111, 3217014719, 1465341783, 2660220331, 2409524332,
+2408557485, 2408540778, 2914893502, 2341173368, 2341173368};
+extern const uint32_t portaltest_WADSegVertices[106] = {
+65536, 131073, 196610, 262147, 327684, 458758, 524295, 9,
+393223, 1, 196612, 720906, 65538, 851980, 917517, 786447,
+1048590, 1114128, 131075, 1179653, 1245202, 393235, 1179667, 1376276,
+1441813, 1245190, 1572887, 1310744, 1703961, 1507354, 1638417, 262149,
+327698, 1835035, 1966109, 655390, 2031627, 1769504, 1966090, 655371,
+720927, 2031648, 2097179, 1769500, 1835037, 1900574, 2228257, 983074,
+2097183, 2293768, 2359331, 589860, 2359305, 589824, 2424854, 458760,
+524323, 2490405, 2555942, 2621479, 2162728, 1900572, 2293796, 2752553,
+2818090, 2883627, 2949164, 3080238, 3145775, 3276849, 3342381, 3014707,
+3407920, 3538997, 3211319, 3670068, 3473464, 3801145, 3866678, 3735611,
+3604540, 3997754, 2687037, 3932210, 3670030, 3407928, 1048628, 917520,
+3342398, 4128813, 2949171, 4063295, 4259904, 4063298, 4128830, 4390975,
+4456515, 4522052, 4587589, 4194374, 4653121, 4325447, 4653081, 4259911,
+1704001, 1638426};
+extern const uint32_t portaltest_WADSegFrontSectors[27] = {
+117901063, 117901063, 50529027, 50529027, 117637891, 50530055, 50529027, 50529027,
+50529027, 101057283, 101058054, 50529798, 117901059, 50529027, 50529027, 197379,
+0, 0, 0, 0, 0, 84215045, 16843009, 33686018,
+33686018, 67371522, 1028};
+extern const uint32_t portaltest_WADSegBackSectors[27] = {
+50529027, 50529027, 101123847, 4294967047, 50855685, 4278649603, 4294903807, 134217476,
+101058055, 50529798, 50529027, 4294902531, 50529030, 134153991, 4294967047, 4278650623,
+4294967295, 4278321151, 100663295, 4294967295, 4294967295, 67043583, 33619967, 4278321151,
+4294967295, 50331396, 1023};
+extern const uint32_t portaltest_WADSegFlags[27] = {
+33686018, 33686018, 34212362, 16843018, 34210050, 17433090, 16845313, 167837954,
+33686026, 168428034, 168430090, 16845322, 33686018, 167840266, 16843018, 17433089,
+16843009, 16777473, 33620225, 16843009, 16843009, 167840257, 524545, 17301761,
+16843009, 167837954, 2561};
+extern const uint32_t portaltest_WADBlockMap[93] = {
+4294442997, 327686, 2490402, 3276844, 4063291, 4522050, 5242955, 6094935,
+6422624, 7274603, 8192115, 8847489, 9437327, 10354841, 10616992, 10944677,
+11862189, 2031646, 4294901792, 1966109, 4128830, 4294901824, 1900572, 3997756,
+4294901822, 1572878, 1835035, 2424868, 2621478, 1572863, 4294901784, 1441813,
+4294901783, 2097183, 4194303, 4259904, 4390978, 3866623, 3932219, 4294901821,
+2293778, 2490404, 3014695, 917503, 1179663, 1310739, 1376255, 4294901781,
+4294901792, 3473455, 3604534, 4325432, 4456515, 3735551, 3801145, 393215,
+3014662, 327679, 851973, 1048591, 1179665, 1310739, 196607, 262147,
+2162687, 3342369, 3473460, 3145727, 3211312, 3342386, 3538997, 4294967295,
+1703942, 2752553, 2883627, 3014701, 655359, 720906, 4294901772, 4294901762,
+4294901793, 2228257, 2293759, 524287, 1703961, 2949154, 65535, 524295,
+655369, 786443, 65535, 131073, 65535};
 
 void loadMap_portaltest_WAD(WAD::LevelData& dstLevel) {
 	// Load vertex data
-	dstLevel.vertices = (const WAD::Vertex*)portaltest_WADVertices;
+	dstLevel.vertices = (const WAD::PackedVertex*)portaltest_WADVertices;
 
 	// Load line defs
+	dstLevel.numLineDefs = (portaltest_WADLineDefsSize * 4) / sizeof(WAD::LineDef);
 	dstLevel.lineDefs = (const WAD::LineDef*)portaltest_WADLineDefs;
 
 	// Load side defs
@@ -253,4 +232,16 @@ void loadMap_portaltest_WAD(WAD::LevelData& dstLevel) {
 	// Load nodes
 	dstLevel.numNodes = (portaltest_WADNodesSize * 4) / sizeof(WAD::Node);
 	dstLevel.nodes = (const WAD::Node*)portaltest_WADNodes;
+
+	// Load baked lighting
+	dstLevel.segLights = (const uint8_t*)portaltest_WADSegLights;
+
+	// Load render hot seg data
+	dstLevel.segVertices = (const uint16_t*)portaltest_WADSegVertices;
+	dstLevel.segFrontSectors = (const uint8_t*)portaltest_WADSegFrontSectors;
+	dstLevel.segBackSectors = (const uint8_t*)portaltest_WADSegBackSectors;
+	dstLevel.segFlags = (const uint8_t*)portaltest_WADSegFlags;
+
+	// Load collision blockmap
+	dstLevel.blockMap = (const uint16_t*)portaltest_WADBlockMap;
 }
@@ -3,13 +3,13 @@
 #include <base.h>
 #include <WAD.h>
 
-constexpr uint32_t portaltest_WADVerticesSize = 144;
+constexpr uint32_t portaltest_WADVerticesSize = 72;
 extern const uint32_t portaltest_WADVertices[];
 
 constexpr uint32_t portaltest_WADLineDefsSize = 242;
 extern const uint32_t portaltest_WADLineDefs[];
 
-constexpr uint32_t portaltest_WADSideDefsSize = 728;
+constexpr uint32_t portaltest_WADSideDefsSize = 291;
 extern const uint32_t portaltest_WADSideDefs[];
 
 constexpr uint32_t portaltest_WADSegmentsSize = 318;
@@ -18,11 +18,29 @@ extern const uint32_t portaltest_WADSegments[];
 constexpr uint32_t portaltest_WADSubSectorsSize = 29;
 extern const uint32_t portaltest_WADSubSectors[];
 
-constexpr uint32_t portaltest_WADSectorsSize = 52;
+constexpr uint32_t portaltest_WADSectorsSize = 28;
 extern const uint32_t portaltest_WADSectors[];
 
-constexpr uint32_t portaltest_WADNodesSize = 252;
+constexpr uint32_t portaltest_WADNodesSize = 196;
 extern const uint32_t portaltest_WADNodes[];
 
+constexpr uint32_t portaltest_WADSegLightsSize = 53;
+extern const uint32_t portaltest_WADSegLights[];
+
+constexpr uint32_t portaltest_WADSegVerticesSize = 106;
+extern const uint32_t portaltest_WADSegVertices[];
+
+constexpr uint32_t portaltest_WADSegFrontSectorsSize = 27;
+extern const uint32_t portaltest_WADSegFrontSectors[];
+
+constexpr uint32_t portaltest_WADSegBackSectorsSize = 27;
+extern const uint32_t portaltest_WADSegBackSectors[];
+
+constexpr uint32_t portaltest_WADSegFlagsSize = 27;
+extern const uint32_t portaltest_WADSegFlags[];
+
+constexpr uint32_t portaltest_WADBlockMapSize = 93;
+extern const uint32_t portaltest_WADBlockMap[];
+
 void loadMap_portaltest_WAD(WAD::LevelData& dstLevel);
 
@@ -1,87 +1,84 @@
-#include "C:\repos\GBA\raycaster\assets\test.wad.h"
+#include "test.wad.h"
 
-extern const uint32_t test_WADVertices[48] = {
-4294868992, 327680, 32768, 327680, 98304, 262144, 98304, 4294836224,
-32768, 4294770688, 4294737920, 4294770688, 4294672384, 4294836224, 4294672384, 262144,
-4294737920, 327680, 4294868992, 262144, 4294803456, 196608, 4294868992, 131072,
-4294934528, 196608, 4294803456, 4294770688, 4294803456, 4294639616, 4294934528, 4294639616,
-4294934528, 4294770688, 98304, 131072, 294912, 131072, 294912, 4294901760,
-98304, 4294901760, 4294705152, 294912, 4294934528, 327680, 98304, 65536};
+extern const uint32_t test_WADVertices[24] = {
+4290773040, 4288675856, 4288741360, 4288741264, 4290838384, 8454000, 9502592, 6356912,
+4259792, 4288741296, 4292870192, 10551248, 10551280, 10551184, 8454096, 10485776,
+8388656, 4194352, 6356976, 2097200, 4284546992, 4284547056, 4194448, 4292870288};
 extern const uint32_t test_WADLineDefs[81] = {
-65536, 1, 0, 131071, 65538, 0, 4294901761, 1114114,
-1, 131072, 262143, 65540, 0, 4294901763, 1048580, 1,
-262144, 393215, 65542, 0, 4294901765, 458758, 1, 393216,
-524287, 65544, 0, 4294901767, 8, 1, 524288, 655359,
-262154, 0, 655369, 720906, 4, 720896, 720908, 262156,
-0, 917517, 589836, 4, 983040, 917520, 65549, 0,
-4294901777, 917519, 1, 1179648, 1114111, 65551, 0, 4294901779,
-851984, 4, 1310720, 851989, 65541, 0, 4294901782, 1179665,
-1, 1507328, 1245183, 65555, 0, 4294901784, 1310739, 1,
-1638400, 1179647, 262164, 0, 1769498, 196628, 1, 1835008,
+983051, 1, 0, 1048575, 65552, 0, 4294901761, 1114128,
+1, 131072, 65535, 65537, 0, 4294901763, 131073, 1,
+262144, 262143, 65540, 0, 4294901765, 327684, 1, 393216,
+393215, 65549, 0, 4294901767, 720909, 1, 524288, 983039,
+262151, 0, 655369, 524295, 4, 720896, 524300, 262162,
+0, 917517, 917522, 4, 983040, 1310736, 65545, 0,
+4294901777, 1310741, 1, 1179648, 196607, 65557, 0, 4294901779,
+589826, 4, 1310720, 589845, 65539, 0, 4294901782, 1441809,
+1, 1507328, 1507327, 65559, 0, 4294901784, 655383, 1,
+1638400, 1179647, 262154, 0, 1769498, 10, 1, 1835008,
 65535};
-extern const uint32_t test_WADSideDefs[218] = {
-0, 45, 0, 45, 0, 1380013139, 827212116, 0,
-2949120, 0, 2949120, 0, 1414725632, 1096045121, 12622, 0,
-45, 0, 45, 0, 1380013139, 827212116, 0, 2949120,
-0, 2949120, 0, 1414725632, 1096045121, 12622, 0, 45,
-0, 45, 0, 1380013139, 827212116, 0, 2949120, 0,
-2949120, 0, 1414725632, 1096045121, 12622, 0, 45, 0,
-45, 0, 1380013139, 827212116, 0, 2949120, 0, 2949120,
-0, 1414725632, 1096045121, 12622, 0, 45, 0, 45,
-0, 1380013139, 827212116, 0, 2949120, 0, 2949120, 0,
-2949120, 0, 0, 0, 45, 0, 45, 0,
-45, 0, 2, 2949120, 0, 2949120, 0, 2949120,
-0, 0, 0, 45, 0, 45, 0, 45,
-0, 2, 2949120, 0, 2949120, 0, 2949120, 0,
-0, 0, 45, 0, 45, 0, 45, 0,
-2, 2949120, 0, 2949120, 0, 2949120, 0, 0,
-0, 45, 0, 45, 0, 45, 0, 2,
-2949120, 0, 2949120, 0, 1414725632, 1096045121, 78158, 0,
-45, 0, 45, 0, 1380013139, 827212116, 1, 2949120,
-0, 2949120, 0, 1414725632, 1096045121, 78158, 32, 45,
-0, 45, 0, 45, 0, 0, 2949120, 0,
-2949120, 0, 2949120, 0, 65536, 96, 45, 0,
-45, 0, 1380013139, 827212116, 0, 2949120, 0, 2949120,
-0, 1414725632, 1096045121, 209230, 0, 45, 0, 45,
-0, 1380013139, 827212116, 3, 2949120, 0, 2949120, 0,
-1414725632, 1096045121, 209230, 64, 45, 0, 45, 0,
-45, 0, 0, 2949120, 0, 2949120, 0, 2949120,
-0, 196608, 160, 45, 0, 45, 0, 1380013139,
-827212116, 0};
+extern const uint32_t test_WADSideDefs[87] = {
+0, 0, 1, 0, 0, 1, 0, 0,
+1, 0, 0, 1, 0, 0, 1, 0,
+0, 1, 0, 0, 1, 0, 0, 1,
+0, 0, 1, 0, 0, 0, 0, 0,
+131072, 0, 0, 0, 0, 0, 131072, 0,
+0, 0, 0, 0, 131072, 0, 0, 0,
+0, 0, 131072, 0, 0, 65537, 0, 0,
+65537, 0, 0, 65537, 32, 0, 0, 0,
+0, 65536, 96, 0, 1, 0, 0, 196609,
+0, 0, 196609, 0, 0, 196609, 64, 0,
+0, 0, 0, 196608, 160, 0, 1};
 extern const uint32_t test_WADSegments[96] = {
-262147, 237568, 0, 1048580, 294912, 0, 393221, 352256,
-0, 458758, 409600, 0, 1376263, 466944, 0, 720906,
-712704, 0, 851984, 1081344, 0, 327693, 1146880, 0,
-196628, 1490944, 0, 1441792, 0, 0, 524309, 466944,
-1507328, 8, 524288, 0, 655369, 630784, 0, 65558,
-0, 2097152, 131073, 122880, 0, 1114114, 180224, 0,
-589836, 811008, 0, 1507345, 1425408, 0, 786443, 729088,
-0, 1310743, 1425408, 2097152, 589834, 598016, 1, 655371,
-679936, 1, 720908, 761856, 1, 786441, 843776, 1,
-851982, 868352, 0, 917519, 950272, 0, 983056, 1032192,
-0, 1048589, 1048576, 1, 1179665, 1179648, 0, 1245202,
-1294336, 0, 1310739, 1343488, 0, 1114132, 1392640, 1};
+65536, 237568, 0, 131073, 294912, 0, 262147, 352256,
+0, 327684, 409600, 0, 393221, 466944, 0, 524295,
+712704, 0, 589826, 1081344, 0, 196617, 1146880, 0,
+10, 1490944, 0, 786443, 0, 0, 851974, 466944,
+1507328, 720909, 524288, 0, 458766, 630784, 0, 983052,
+0, 2097152, 1048591, 122880, 0, 1114128, 180224, 0,
+917522, 811008, 0, 1245201, 1425408, 0, 1179656, 729088,
+0, 655379, 1425408, 2097152, 917511, 598016, 1, 458760,
+679936, 1, 524306, 761856, 1, 1179662, 843776, 1,
+589844, 868352, 0, 1310741, 950272, 0, 1376258, 1032192,
+0, 131081, 1048576, 1, 1441809, 1179648, 0, 1507350,
+1294336, 0, 655383, 1343488, 0, 1114122, 1392640, 1};
 extern const uint32_t test_WADSubSectors[7] = {
 9, 589828, 851973, 1179650, 1310724, 1572868, 1835012};
-extern const uint32_t test_WADSectors[26] = {
-62914560, 1330596934, 828321874, 1279870275, 3235633, 192, 20971520, 1279656896,
-810700623, 1162031455, 1597066313, 12582961, 0, 41943360, 1330596934, 828321874,
-1279870275, 3235633, 128, 0, 1279656896, 810700623, 1162031455, 1597066313,
-12582961, 0};
-extern const uint32_t test_WADNodes[54] = {
-4294868992, 131072, 65536, 65536, 4290773056, 6291456, 2097248, 2162656,
-2147778563, 4294934528, 196608, 4294901760, 65536, 128, 6291456, 4290773088,
-6356960, 32770, 4294868992, 262144, 4294901760, 4294901760, 4194432, 2162608,
-4290773120, 6356960, 98305, 4294803456, 196608, 65536, 4294901760, 4286578800,
-6356896, 4290773120, 6356912, 163840, 32768, 4294770688, 4294901760, 0,
-4286578816, 6356896, 4282449792, 2162656, 2147811331, 98304, 262144, 0,
-4294836224, 4282384512, 6356896, 4290773024, 12583008, 2147876868};
+extern const uint32_t test_WADSectors[14] = {
+62914560, 65536, 192, 20971520, 960, 12582913, 0, 41943360,
+65536, 128, 0, 960, 12582913, 0};
+extern const uint32_t test_WADNodes[42] = {
+4288675856, 65504, 4286578816, 6356896, 4282449792, 2162656, 2147811329, 6356912,
+4292870176, 4286578800, 6356896, 4290773120, 6356912, 163840, 8454096, 4292935648,
+4194432, 2162608, 4290773120, 6356960, 229377, 6356976, 2162656, 128,
+6291456, 4290773088, 6356960, 294914, 4259792, 2097184, 4290773056, 6291456,
+2097248, 2162656, 2147778563, 8388656, 4290772992, 4282384512, 6356896, 4290773024,
+12583008, 2147876864};
+extern const uint32_t test_WADSegLights[16] = {
+1986695055, 2880147343, 2661193359, 1786148470, 1987619773, 2020249494, 1786158471, 3232468879,
+3233843101, 3200294558, 1768515945, 1768515945, 1465368459, 1465355199, 2341164920, 2341173335};
+extern const uint32_t test_WADSegVertices[32] = {
+65536, 131073, 262147, 327684, 393221, 524295, 589826, 196617,
+10, 786443, 851974, 720909, 458766, 983052, 1048591, 1114128,
+917522, 1245201, 1179656, 655379, 917511, 458760, 524306, 1179662,
+589844, 1310741, 1376258, 131081, 1441809, 1507350, 655383, 1114122};
+extern const uint32_t test_WADSegFrontSectors[8] = {
+0, 0, 0, 0, 0, 33686018, 16843009, 50529027};
+extern const uint32_t test_WADSegBackSectors[8] = {
+4294967295, 4278256383, 4294967295, 4294967042, 50463490, 0, 16777215, 16777215};
+extern const uint32_t test_WADSegFlags[8] = {
+16843009, 16908801, 16843009, 16843010, 131074, 168430090, 167837953, 134283521};
+extern const uint32_t test_WADBlockMap[32] = {
+4294705147, 196611, 1310733, 2097181, 2949157, 3735601, 327743, 851974,
+1048590, 4294901777, 262147, 983054, 1310736, 1441813, 1310719, 4294901780,
+589830, 720906, 196607, 786443, 1310738, 1441813, 1245183, 1310739,
+65535, 458758, 589832, 786442, 65535, 131073, 786443, 4294967295};
 
 void loadMap_test_WAD(WAD::LevelData& dstLevel) {
 	// Load vertex data
-	dstLevel.vertices = (const WAD::Vertex*)test_WADVertices;
+	dstLevel.vertices = (const WAD::PackedVertex*)test_WADVertices;
 
 	// Load line defs
+	dstLevel.numLineDefs = (test_WADLineDefsSize * 4) / sizeof(WAD::LineDef);
 	dstLevel.lineDefs = (const WAD::LineDef*)test_WADLineDefs;
 
 	// Load side defs
@@ -99,4 +96,16 @@ void loadMap_test_WAD(WAD::LevelData& dstLevel) {
 	// Load nodes
 	dstLevel.numNodes = (test_WADNodesSize * 4) / sizeof(WAD::Node);
 	dstLevel.nodes = (const WAD::Node*)test_WADNodes;
+
+	// Load baked lighting
+	dstLevel.segLights = (const uint8_t*)test_WADSegLights;
+
+	// Load render hot seg data
+	dstLevel.segVertices = (const uint16_t*)test_WADSegVertices;
+	dstLevel.segFrontSectors = (const uint8_t*)test_WADSegFrontSectors;
+	dstLevel.segBackSectors = (const uint8_t*)test_WADSegBackSectors;
+	dstLevel.segFlags = (const uint8_t*)test_WADSegFlags;
+
+	// Load collision blockmap
+	dstLevel.blockMap = (const uint16_t*)test_WADBlockMap;
 }
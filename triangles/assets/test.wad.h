@@ -3,13 +3,13 @@
 #include <base.h>
 #include <WAD.h>
 
-constexpr uint32_t test_WADVerticesSize = 48;
+constexpr uint32_t test_WADVerticesSize = 24;
 extern const uint32_t test_WADVertices[];
 
 constexpr uint32_t test_WADLineDefsSize = 81;
 extern const uint32_t test_WADLineDefs[];
 
-constexpr uint32_t test_WADSideDefsSize = 218;
+constexpr uint32_t test_WADSideDefsSize = 87;
 extern const uint32_t test_WADSideDefs[];
 
 constexpr uint32_t test_WADSegmentsSize = 96;
@@ -18,11 +18,29 @@ extern const uint32_t test_WADSegments[];
 constexpr uint32_t test_WADSubSectorsSize = 7;
 extern const uint32_t test_WADSubSectors[];
 
-constexpr uint32_t test_WADSectorsSize = 26;
+constexpr uint32_t test_WADSectorsSize = 14;
 extern const uint32_t test_WADSectors[];
 
-constexpr uint32_t test_WADNodesSize = 54;
+constexpr uint32_t test_WADNodesSize = 42;
 extern const uint32_t test_WADNodes[];
 
+constexpr uint32_t test_WADSegLightsSize = 16;
+extern const uint32_t test_WADSegLights[];
+
+constexpr uint32_t test_WADSegVerticesSize = 32;
+extern const uint32_t test_WADSegVertices[];
+
+constexpr uint32_t test_WADSegFrontSectorsSize = 8;
+extern const uint32_t test_WADSegFrontSectors[];
+
+constexpr uint32_t test_WADSegBackSectorsSize = 8;
+extern const uint32_t test_WADSegBackSectors[];
+
+constexpr uint32_t test_WADSegFlagsSize = 8;
+extern const uint32_t test_WADSegFlags[];
+
+constexpr uint32_t test_WADBlockMapSize = 32;
+extern const uint32_t test_WADBlockMap[];
+
 void loadMap_test_WAD(WAD::LevelData& dstLevel);
 
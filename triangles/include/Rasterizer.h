@@ -39,7 +39,7 @@ void RasterLineOctant0(const Op& op, int x, int y, int dx, int dy, int signX)
             runningError += dy2;
         }
         x += signX;
-        Op(x, y);
+        op(x, y);
     }
 }
 
@@ -65,13 +65,13 @@ void RasterLineOctant1(const Op& op, int x, int y, int dx, int dy, int signX)
             runningError += dx2;
         }
         y++;
-        Op(x, y);
+        op(x, y);
     }
 }
 
 // Op syntax: void Op(int x, int y) const
 template<class Op>
-void rasterLine(const Op& op, const math::Vec2p16& a, const math::Vec2p16& b)
+void rasterLine(const Op& op, math::Vec2p16 a, math::Vec2p16 b)
 {
     // Force drawing lines in one of the first 4 octants
     if (a.y > b.y)
@@ -87,7 +87,7 @@ void rasterLine(const Op& op, const math::Vec2p16& a, const math::Vec2p16& b)
     int dx = b.x.floor() - x0;
     int dy = b.y.floor() - y0;
 
-    Op(x0, y0); // Draw the line's first pixel
+    op(x0, y0); // Draw the line's first pixel
 
     // Choose the correct octant and deltas
     if (dx > 0)
@@ -114,6 +114,186 @@ void rasterLine(const Op& op, const math::Vec2p16& a, const math::Vec2p16& b)
     }
 }
 
+// Cohen-Sutherland region codes
+namespace LineClip
+{
+    static constexpr uint8_t Inside = 0;
+    static constexpr uint8_t Left = 1 << 0;
+    static constexpr uint8_t Right = 1 << 1;
+    static constexpr uint8_t Top = 1 << 2;
+    static constexpr uint8_t Bottom = 1 << 3;
+
+    inline uint8_t outCode(int x, int y, int xEnd, int yEnd)
+    {
+        uint8_t code = Inside;
+        if (x < 0)
+            code |= Left;
+        else if (x >= xEnd)
+            code |= Right;
+        if (y < 0)
+            code |= Top;
+        else if (y >= yEnd)
+            code |= Bottom;
+        return code;
+    }
+}
+
+// Clips the segment between pixels (x0,y0) and (x1,y1) against the rectangle [0,xEnd)x[0,yEnd).
+// Returns false when no part of the segment is inside.
+// Coordinates must stay within +-16384 so the edge intersections can't overflow.
+inline bool clipLine(int& x0, int& y0, int& x1, int& y1, int xEnd, int yEnd)
+{
+    uint8_t code0 = LineClip::outCode(x0, y0, xEnd, yEnd);
+    uint8_t code1 = LineClip::outCode(x1, y1, xEnd, yEnd);
+
+    while (code0 | code1)
+    {
+        // Both points on the same outer side
+        if (code0 & code1)
+            return false;
+
+        // Move the point that's outside onto the edge it crosses
+        uint8_t code = code0 ? code0 : code1;
+        int x, y;
+        if (code & LineClip::Top)
+        {
+            x = x0 + (x1 - x0) * (0 - y0) / (y1 - y0);
+            y = 0;
+        }
+        else if (code & LineClip::Bottom)
+        {
+            x = x0 + (x1 - x0) * (yEnd - 1 - y0) / (y1 - y0);
+            y = yEnd - 1;
+        }
+        else if (code & LineClip::Left)
+        {
+            y = y0 + (y1 - y0) * (0 - x0) / (x1 - x0);
+            x = 0;
+        }
+        else // Right
+        {
+            y = y0 + (y1 - y0) * (xEnd - 1 - x0) / (x1 - x0);
+            x = xEnd - 1;
+        }
+
+        if (code == code0)
+        {
+            x0 = x;
+            y0 = y;
+            code0 = LineClip::outCode(x0, y0, xEnd, yEnd);
+        }
+        else
+        {
+            x1 = x;
+            y1 = y;
+            code1 = LineClip::outCode(x1, y1, xEnd, yEnd);
+        }
+    }
+    return true;
+}
+
+// Run-slice Bresenham.
+// Instead of stepping one pixel at a time, it steps one run at a time, where a run is the set of pixels
+// of the line that share a row (x major lines) or a column (y major lines).
+// Run lengths only ever take two values, so each run costs one error update.
+// Both end pixels are drawn.
+// Target syntax:
+//   void hRun(int x, int y, int length) const // Pixels [x, x+length) of row y
+//   void vRun(int x, int y, int length) const // Pixels [y, y+length) of column x
+template<class Target>
+void rasterLineRuns(const Target& target, int x0, int y0, int x1, int y1)
+{
+    // Always draw downwards
+    if (y0 > y1)
+    {
+        int tx = x0; x0 = x1; x1 = tx;
+        int ty = y0; y0 = y1; y1 = ty;
+    }
+
+    int dx = x1 - x0;
+    int dy = y1 - y0;
+    int xStep = 1;
+    if (dx < 0)
+    {
+        xStep = -1;
+        dx = -dx;
+    }
+
+    // Trivial cases
+    if (dx == 0)
+    {
+        target.vRun(x0, y0, dy + 1);
+        return;
+    }
+    if (dy == 0)
+    {
+        target.hRun(xStep > 0 ? x0 : x1, y0, dx + 1);
+        return;
+    }
+
+    // Split the line into a first and last half runs and a number of full runs in between.
+    // Half runs at both ends keep the line symmetric.
+    int major = dx >= dy ? dx : dy;
+    int minor = dx >= dy ? dy : dx;
+    int wholeStep = major / minor;
+    int adjUp = (major % minor) * 2;
+    int adjDown = minor * 2;
+    int errorTerm = (major % minor) - minor * 2;
+    int initialRun = wholeStep / 2 + 1;
+    int finalRun = initialRun;
+    if (adjUp == 0 && (wholeStep & 1) == 0)
+        initialRun--;
+    if (wholeStep & 1)
+        errorTerm += minor;
+
+    if (dx >= dy) // X major, one horizontal run per row
+    {
+        auto hRun = [&](int length)
+        {
+            target.hRun(xStep > 0 ? x0 : x0 - length + 1, y0, length);
+            x0 += xStep * length;
+            ++y0;
+        };
+
+        hRun(initialRun);
+        for (int i = 0; i < minor - 1; ++i)
+        {
+            int runLength = wholeStep;
+            errorTerm += adjUp;
+            if (errorTerm > 0)
+            {
+                ++runLength;
+                errorTerm -= adjDown;
+            }
+            hRun(runLength);
+        }
+        hRun(finalRun);
+    }
+    else // Y major, one vertical run per column
+    {
+        auto vRun = [&](int length)
+        {
+            target.vRun(x0, y0, length);
+            y0 += length;
+            x0 += xStep;
+        };
+
+        vRun(initialRun);
+        for (int i = 0; i < minor - 1; ++i)
+        {
+            int runLength = wholeStep;
+            errorTerm += adjUp;
+            if (errorTerm > 0)
+            {
+                ++runLength;
+                errorTerm -= adjDown;
+            }
+            vRun(runLength);
+        }
+        vRun(finalRun);
+    }
+}
+
 class Rasterizer
 {
 public:
@@ -125,10 +305,15 @@ public:
     static bool BeginFrame();
     static void EndFrame();
 
+    // Draws the line between the pixels containing a and b, clipped to [0,xEnd)x[0,yEnd)
     static void DrawLine(uint16_t* buffer, int stride, int16_t color, math::Vec2p16 a, math::Vec2p16 b, int xEnd, int yEnd);
     static void DrawHorizontalLine(uint16_t* buffer, int stride, int16_t color, int row, int xStart, int xEnd);
     static void DrawVerticalLine(uint16_t* buffer, int stride, int16_t color, int col, int y0, int y1);
 
+    // Wireframe overview of the level's linedefs around the given position.
+    // Forward always points up on screen. pixelsPerUnit sets the zoom.
+    static void DrawAutomap(uint16_t* buffer, const WAD::LevelData& level, const math::Vec3p8& center, math::unorm16 yaw, int pixelsPerUnit);
+
     static inline Color skyClr = BasicColor::SkyBlue;
     static inline Color groundClr = BasicColor::DarkGrey;
 
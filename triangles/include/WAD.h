@@ -2,6 +2,7 @@
 
 #include <linearMath.h>
 #include <vector.h>
+#include <initializer_list>
 
 // Original DOOM WAD types
 namespace WAD
@@ -28,6 +29,22 @@ namespace WAD
     // 16.16 vertex, as used in the game
     using Vertex = math::Vec2p16;
 
+    // Vertex as stored in the level: world units with 5 fractional bits, which is exactly one doom unit.
+    // Reads half the ROM bytes of a Vertex. Widen it with unpack() once it is in registers.
+    constexpr int32_t kPackedVertexShift = 5;
+
+    struct PackedVertex
+    {
+        int16_t x, y;
+
+        Vertex unpack() const
+        {
+            return Vertex(
+                math::intp16::castFromShiftedInteger<kPackedVertexShift>(int32_t(x)),
+                math::intp16::castFromShiftedInteger<kPackedVertexShift>(int32_t(y)));
+        }
+    };
+
     struct LineDef
     {
         uint16_t v0, v1;
@@ -37,7 +54,8 @@ namespace WAD
         uint16_t SideNum[2];
     };
 
-    struct SideDef
+    // Side and sector as stored in the WAD, with textures named
+    struct RawSideDef
     {
         uint16_t xOffet, yOffset;
         char upperTextureName[8];
@@ -46,6 +64,20 @@ namespace WAD
         uint8_t sector;
     };
 
+    // Wall texture ids index LevelData::wallTextures, and flat ids LevelData::flats.
+    // The converter assigns them in order of first use, so they only mean something within a level.
+    constexpr uint16_t kNoTexture = 0; // Wall texture "-"
+
+    struct SideDef
+    {
+        uint16_t xOffet, yOffset;
+        uint16_t upperTexture;
+        uint16_t lowerTexture;
+        uint16_t middleTexture;
+        uint8_t sector;
+        uint8_t padding; // Explicit, so converted levels don't depend on uninitialized bytes
+    };
+
     struct Seg
     {
         int16_t startVertex;
@@ -75,10 +107,11 @@ namespace WAD
         }
     };
 
+    // Node partition line, packed like vertices
     struct Plane
     {
-        math::Vec2p16 origin;
-        math::Vec2p16 dir;
+        PackedVertex origin;
+        PackedVertex dir;
     };
 
     struct Node
@@ -96,7 +129,7 @@ namespace WAD
         uint16_t child[2];
     };
 
-    struct Sector
+    struct RawSector
     {
         math::int8p8 floorhHeight;
         math::int8p8 ceilingHeight;
@@ -107,17 +140,117 @@ namespace WAD
         int16_t tagNumber;
     };
 
+    struct Sector
+    {
+        math::int8p8 floorhHeight;
+        math::int8p8 ceilingHeight;
+        uint16_t floorTexture;
+        uint16_t ceilingTexture;
+        math::int8p8 lightLevel;
+        int16_t type;
+        int16_t tagNumber;
+    };
+
+    // Wall texture composed from its patches. Texels are palette indices stored column by column,
+    // so walls are drawn reading sequential bytes. Identical columns are stored once and shared.
+    struct WallTexture
+    {
+        uint16_t width, height; // Zero for textures missing from the source WADs
+        uint32_t firstColumn; // Into LevelData::textureColumns
+    };
+
+    constexpr uint32_t kFlatSize = 64; // Flats are 64x64 texels, also column major
+
+    // Render flags, one byte per seg
+    constexpr uint8_t kSegOpaque = 1 << 0; // One sided, or two sided but flagged as blocking
+    constexpr uint8_t kSegStep = 1 << 1; // Floor or ceiling height changes across the seg
+    constexpr uint8_t kSegMasked = 1 << 2; // Has a middle texture on the side facing the seg
+    constexpr uint8_t kSegBackSide = 1 << 3; // Runs against its linedef (Seg::direction)
+
+    constexpr uint8_t kNoSector = 0xff;
+
     // Parsed WAD
     struct LevelData
     {
         uint32_t numNodes = 0;
+        uint32_t numLineDefs = 0;
 
-        const WAD::Vertex* vertices{};
+        const WAD::PackedVertex* vertices{};
         const WAD::LineDef* lineDefs{};
         const WAD::SideDef* sideDefs{};
         const WAD::Node* nodes{};
         const WAD::Seg* segments{};
         const WAD::Sector* sectors{};
         const WAD::SubSector* subSectors{};
+        const uint8_t* segLights{}; // Baked light for both ends of each seg
+
+        // Render hot data, split from the WAD structs above so that BSP traversal reads as few ROM bytes as possible.
+        // One entry per seg, with the sectors as seen from the seg's side of its linedef.
+        const uint16_t* segVertices{}; // Start and end vertex of each seg
+        const uint8_t* segFrontSectors{};
+        const uint8_t* segBackSectors{}; // kNoSector for one sided segs
+        const uint8_t* segFlags{};
+
+        const uint16_t* blockMap{}; // Linedefs near each point of the map, see BlockMapHeader
+
+        // Optional textures. Texel values index texturePalette, with 0 being transparent.
+        const WAD::WallTexture* wallTextures{};
+        const uint32_t* textureColumns{}; // Offset of each column into texels
+        const uint8_t* texels{};
+        const uint8_t* flats{}; // kFlatSize * kFlatSize texels per flat id
+        const uint16_t* texturePalette{}; // 15 bit colors
+    };
+
+    // Fills in the render hot arrays of a level from its WAD structs. wadToCpp emits them, the game reads them from ROM.
+    inline void buildSegRenderData(const LevelData& level, uint32_t numSegments,
+        uint16_t* segVertices, uint8_t* segFrontSectors, uint8_t* segBackSectors, uint8_t* segFlags)
+    {
+        constexpr uint16_t FlagTwoSided = 0x04;
+        for (uint32_t i = 0; i < numSegments; ++i)
+        {
+            auto& segment = level.segments[i];
+            auto& lineDef = level.lineDefs[segment.linedefNum];
+            auto& frontSide = level.sideDefs[lineDef.SideNum[segment.direction]];
+            uint16_t backSideNum = lineDef.SideNum[segment.direction ^ 1];
+
+            segVertices[2 * i] = segment.startVertex;
+            segVertices[2 * i + 1] = segment.endVertex;
+            segFrontSectors[i] = frontSide.sector;
+
+            uint8_t flags = segment.direction ? kSegBackSide : 0;
+
+            if (backSideNum == uint16_t(-1))
+            {
+                segBackSectors[i] = kNoSector;
+                flags |= kSegOpaque;
+            }
+            else
+            {
+                uint8_t backSector = level.sideDefs[backSideNum].sector;
+                segBackSectors[i] = backSector;
+                if (!(lineDef.flags & FlagTwoSided))
+                    flags |= kSegOpaque;
+                auto& front = level.sectors[frontSide.sector];
+                auto& back = level.sectors[backSector];
+                if (front.floorhHeight.raw != back.floorhHeight.raw || front.ceilingHeight.raw != back.ceilingHeight.raw)
+                    flags |= kSegStep;
+                if (frontSide.middleTexture != kNoTexture)
+                    flags |= kSegMasked;
+            }
+            segFlags[i] = flags;
+        }
+    }
+
+    // Blockmap: a grid of linedef lists, so that collision only tests the lines near the player.
+    // Stored as a uint16_t array: a BlockMapHeader, one offset per cell (row major, counted from the start of the
+    // array), then the linedef list of each cell ended by kBlockListEnd.
+    constexpr int32_t kBlockShift = 2; // Cells are 4 world units wide, which is 128 doom units like in Doom
+    constexpr uint16_t kBlockListEnd = 0xffff;
+
+    struct BlockMapHeader
+    {
+        int16_t originX, originY; // Corner of the first cell, in whole world units
+        uint16_t numCols, numRows;
     };
+    constexpr uint32_t kBlockMapHeaderSize = sizeof(BlockMapHeader) / sizeof(uint16_t);
 }
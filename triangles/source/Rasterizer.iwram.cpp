@@ -86,132 +86,105 @@ intp16 PointToDist(const Vec2p16& p)
 	return x / cosT;
 }
 
-// Follow Bresenham's algorithm for line rasterization
-void Rasterizer::DrawLine(uint16_t* buffer, int stride, int16_t color, math::Vec2p16 a, math::Vec2p16 b, int xEnd, int yEnd)
+// Writes line runs straight into a 16bpp frame buffer
+struct FrameBufferRunTarget
 {
-	if (b.x < a.x)
-	{
-		DrawLine(buffer, stride, color, b, a, xEnd, yEnd);
-		return;
-	}
-
-	// Compute deltas
-	auto dx = b.x - a.x;
-	auto dy = b.y - a.y;
+	uint16_t* buffer;
+	int stride;
+	uint16_t color;
 
-	if (dx == 0)
+	void hRun(int x, int y, int length) const
 	{
-		if (dy > 0)
-			DrawVerticalLine(buffer, stride, color, a.x.floor(), a.y.floor(), b.y.floor() + 1);
-		else
-			DrawVerticalLine(buffer, stride, color, a.x.floor(), b.y.floor(), a.y.floor() + 1);
-		return;
-	}
-	if (dy == 0)
-	{
-		DrawHorizontalLine(buffer, stride, color, a.y.floor(), a.x.floor(), b.x.floor() + 1);
-		return;
+		uint16_t* dst = &buffer[x + stride * y];
+		// Align to a word boundary so the rest of the run can be written in pairs
+		if ((reinterpret_cast<uintptr_t>(dst) & 2) && length > 0)
+		{
+			*dst++ = color;
+			--length;
+		}
+		uint32_t color2 = color | (uint32_t(color) << 16);
+		uint32_t* dst32 = reinterpret_cast<uint32_t*>(dst);
+		for (int i = 0; i < (length >> 1); ++i)
+		{
+			dst32[i] = color2;
+		}
+		if (length & 1)
+		{
+			dst[length - 1] = color;
+		}
 	}
 
-	intp16 m = dy / dx; // Slope
-
-	// Clamp to the screen
-	if (a.x < 0)
+	void vRun(int x, int y, int length) const
 	{
-		a.y -= a.x * m;
-		a.x = 0_p16;
+		uint16_t* dst = &buffer[x + stride * y];
+		for (int i = 0; i < length; ++i)
+		{
+			*dst = color;
+			dst += stride;
+		}
 	}
+};
 
-	while (a.y < 0)
+void Rasterizer::DrawLine(uint16_t* buffer, int stride, int16_t color, math::Vec2p16 a, math::Vec2p16 b, int xEnd, int yEnd)
+{
+	int x0 = a.x.floor();
+	int y0 = a.y.floor();
+	int x1 = b.x.floor();
+	int y1 = b.y.floor();
+
+	if (!clipLine(x0, y0, x1, y1, xEnd, yEnd))
 	{
-		a.x += 1_p16;
-		a.y += m;
+		return;
 	}
 
-	// Where to start drawing
-	int col = a.x.floor();
-	int row = a.y.floor();
-	int rowStart = stride * a.y.floor();
-	int endCol = math::min<int>(xEnd, b.x.floor());
-	int endRow = math::min<int>(yEnd, b.y.floor());
-
-	// Shift pixel centers to integer coordinates
-	a.x -= 0.5_p16;
-	a.y -= 0.5_p16;
-	b.x -= 0.5_p16;
-	b.y -= 0.5_p16;
+	rasterLineRuns(FrameBufferRunTarget{ buffer, stride, uint16_t(color) }, x0, y0, x1, y1);
+}
 
-	if (dy <= 0) // First quadrant
+void Rasterizer::DrawAutomap(uint16_t* buffer, const WAD::LevelData& level, const Vec3p8& center, unorm16 yaw, int pixelsPerUnit)
+{
+	constexpr uint16_t FlagTwoSided = 0x04;
+	constexpr int kMaxCoord = 16384; // Keep clipping math in range
+	constexpr int xCenter = DisplayMode::Width / 2;
+	constexpr int yCenter = DisplayMode::Height / 2;
+
+	// Rotate the map so forward points up
+	intp12 cosf = intp12::castFromShiftedInteger<12>(lu_cos(yaw.raw));
+	intp12 sinf = intp12::castFromShiftedInteger<12>(lu_sin(yaw.raw));
+	auto toScreen = [&](const WAD::Vertex& v, int& x, int& y)
 	{
-		if (dx <= -dy) // 2nd octant
-		{
-			a.x = a.x.fract();
-			m = dx / dy;
-			while (row >= endRow && col < xEnd)
-			{
-				buffer[col + rowStart] = color;
-				a.x += m;
-				rowStart -= stride;
-				--row;
-				if (a.x < 0)
-				{
-					a.x += 1;
-					col++;
-				}
-			}
-		}
-		else // 1st octant
-		{
-			a.y = a.y.fract();
-			while (col <= endCol && row >= 0)
-			{
-				buffer[col + rowStart] = color;
-				a.y += m;
-				++col;
-				if (a.y < 0)
-				{
-					a.y += 1;
-					row--;
-					rowStart -= stride;
-				}
-			}
-		}
-	}
-	else // 4th quadrant
+		intp8 relX = v.x.cast<8>() - center.x;
+		intp8 relY = v.y.cast<8>() - center.y;
+		intp8 right = (relX * cosf + relY * sinf).cast<8>();
+		intp8 forward = (relY * cosf - relX * sinf).cast<8>();
+		x = xCenter + (right * pixelsPerUnit).floor();
+		y = yCenter - (forward * pixelsPerUnit).floor();
+	};
+
+	FrameBufferRunTarget wallTarget = { buffer, int(DisplayMode::Width), BasicColor::Red.raw };
+	FrameBufferRunTarget portalTarget = { buffer, int(DisplayMode::Width), BasicColor::Yellow.raw };
+	for (uint32_t i = 0; i < level.numLineDefs; ++i)
 	{
-		if (dx <= dy) // 7th octant
+		auto& line = level.lineDefs[i];
+		int x0, y0, x1, y1;
+		toScreen(level.vertices[line.v0].unpack(), x0, y0);
+		toScreen(level.vertices[line.v1].unpack(), x1, y1);
+
+		if (abs(x0) > kMaxCoord || abs(y0) > kMaxCoord || abs(x1) > kMaxCoord || abs(y1) > kMaxCoord)
 		{
-			a.x = a.x.fract();
-			m = dx / dy;
-			while (row <= endRow && col < xEnd)
-			{
-				buffer[col + rowStart] = color;
-				a.x += m;
-				rowStart += stride;
-				++row;
-				if (a.x >= 1)
-				{
-					a.x -= 1;
-					col++;
-				}
-			}
+			continue; // Way off screen anyway
 		}
-		else // 8th octant
+
+		if (!clipLine(x0, y0, x1, y1, DisplayMode::Width, DisplayMode::Height))
 		{
-			a.y = a.y.fract();
-			while (col <= endCol && row < yEnd)
-			{
-				buffer[col + rowStart] = color;
-				a.y += m;
-				++col;
-				if (a.y >= 1)
-				{
-					a.y -= 1;
-					row++;
-					rowStart += stride;
-				}
-			}
+			continue;
 		}
+
+		bool twoSided = line.flags & FlagTwoSided;
+		rasterLineRuns(twoSided ? portalTarget : wallTarget, x0, y0, x1, y1);
 	}
 
-}
\ No newline at end of file
+	// Player marker
+	FrameBufferRunTarget playerTarget = { buffer, int(DisplayMode::Width), BasicColor::Green.raw };
+	playerTarget.hRun(xCenter - 1, yCenter, 3);
+	playerTarget.vRun(xCenter, yCenter - 2, 2);
+}
@@ -27,9 +27,11 @@
 #include <Rasterizer.h>
 #include <Camera.h>
 #include <matrix.h>
+#include <mesh.h>
 
 // Levels
 #include <test.wad.h>
+#include <mercury.wad.h>
 
 using namespace math;
 using namespace gfx;
@@ -55,15 +57,6 @@ void TriangulateScreen()
 
 volatile uint32_t timerT2 = 0;
 
-struct Mesh
-{
-	const Vec3p8* vertices;
-	const uint16_t* indices;
-	const Color* faceColors;
-	uint16_t numTris;
-	uint16_t numVertices;
-};
-
 void DrawStaticIndexedMesh(const YawPitchCamera& cam, const Mesh& mesh)
 {
 	constexpr int MAX_VERTICES = 16;
@@ -277,6 +270,11 @@ int main()
 	auto horSpeed = 0.06125_p16;
 	auto angSpeed = 0.001_p16;
 
+	// Level shown in the automap
+	WAD::LevelData level;
+	loadMap_mercury_WAD(level);
+	bool showAutomap = false;
+
 	// Unlock the display and start rendering
 	Display().EndBlank();
 	bool vBlank = true;
@@ -338,6 +336,10 @@ int main()
 
 		Timer1().reset<Timer::e64>(); // Set high precision profiler
 		RenderWorld(camera);
+		if (Keypad::Pressed(Keypad::SELECT))
+			showAutomap = !showAutomap;
+		if (showAutomap)
+			Rasterizer::DrawAutomap(Display().backBuffer(), level, camera.pos, camera.yaw, 4);
 #ifdef GBA
 		frameCounter.render(text);
 